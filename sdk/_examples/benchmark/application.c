@@ -0,0 +1,391 @@
+#include <application.h>
+
+// Every result is one CSV line on UART2 (115200 / 8N1), lines starting with '#' are comments:
+// name,param,iterations,cycles,cycles_per_iteration,ns_per_iteration
+// Cortex-M0+ has no DWT cycle counter, cycles are read from SysTick together with millisecond tick
+
+// Run at 32 MHz from PLL, drivers raising clock on their own (e.g. UART) change SysTick reload when run from MSI
+#ifndef BENCHMARK_PLL
+#define BENCHMARK_PLL 1
+#endif
+
+// EEPROM area overwritten by write benchmark
+#ifndef BENCHMARK_EEPROM_ADDRESS
+#define BENCHMARK_EEPROM_ADDRESS 0x400
+#endif
+
+#define BENCHMARK_TMP112_ADDRESS 0x49
+
+typedef struct
+{
+    const char *name;
+    uint32_t param;
+    uint32_t iterations;
+    bool (*run)(uint32_t param, uint32_t iterations);
+
+} benchmark_t;
+
+static bool fifo_run(uint32_t param, uint32_t iterations);
+static bool queue_run(uint32_t param, uint32_t iterations);
+static bool i2c_run(uint32_t param, uint32_t iterations);
+static bool spi_run(uint32_t param, uint32_t iterations);
+static bool uart_run(uint32_t param, uint32_t iterations);
+static bool data_stream_median_run(uint32_t param, uint32_t iterations);
+static bool data_stream_average_run(uint32_t param, uint32_t iterations);
+static bool gfx_draw_run(uint32_t param, uint32_t iterations);
+static bool sha256_run(uint32_t param, uint32_t iterations);
+static bool aes_ecb_run(uint32_t param, uint32_t iterations);
+static bool eeprom_write_run(uint32_t param, uint32_t iterations);
+
+static const benchmark_t benchmark[] =
+{
+    { "twr_fifo_write_read", 1, 1000, fifo_run },
+    { "twr_fifo_write_read", 16, 1000, fifo_run },
+    { "twr_fifo_write_read", 64, 500, fifo_run },
+    { "twr_fifo_write_read", 256, 100, fifo_run },
+    { "twr_queue_put_get", 8, 1000, queue_run },
+    { "twr_queue_put_get", 64, 500, queue_run },
+    { "twr_i2c_memory_read", TWR_I2C_SPEED_100_KHZ, 50, i2c_run },
+    { "twr_i2c_memory_read", TWR_I2C_SPEED_400_KHZ, 50, i2c_run },
+    { "twr_spi_transfer", TWR_SPI_SPEED_1_MHZ, 50, spi_run },
+    { "twr_spi_transfer", TWR_SPI_SPEED_4_MHZ, 50, spi_run },
+    { "twr_spi_transfer", TWR_SPI_SPEED_16_MHZ, 50, spi_run },
+    { "twr_uart_write", TWR_UART_BAUDRATE_9600, 2, uart_run },
+    { "twr_uart_write", TWR_UART_BAUDRATE_19200, 4, uart_run },
+    { "twr_uart_write", TWR_UART_BAUDRATE_38400, 8, uart_run },
+    { "twr_uart_write", TWR_UART_BAUDRATE_57600, 8, uart_run },
+    { "twr_uart_write", TWR_UART_BAUDRATE_115200, 16, uart_run },
+    { "twr_uart_write", TWR_UART_BAUDRATE_230400, 16, uart_run },
+    { "twr_uart_write", TWR_UART_BAUDRATE_460800, 16, uart_run },
+    { "twr_uart_write", TWR_UART_BAUDRATE_921600, 16, uart_run },
+    { "twr_data_stream_median", 8, 200, data_stream_median_run },
+    { "twr_data_stream_median", 32, 100, data_stream_median_run },
+    { "twr_data_stream_average", 8, 200, data_stream_average_run },
+    { "twr_data_stream_average", 32, 100, data_stream_average_run },
+    { "twr_gfx_draw", 0, 10, gfx_draw_run },
+    { "twr_sha256", 64, 50, sha256_run },
+    { "twr_sha256", 1024, 10, sha256_run },
+    { "twr_aes_ecb_encrypt", 16, 100, aes_ecb_run },
+    { "twr_aes_ecb_encrypt", 256, 20, aes_ecb_run },
+    { "twr_eeprom_write", 4, 8, eeprom_write_run },
+    { "twr_eeprom_write", 32, 4, eeprom_write_run }
+};
+
+static uint8_t data[1024];
+
+static size_t benchmark_index;
+
+static void report(const char *format, ...) __attribute__ ((format (printf, 1, 2)));
+
+static uint64_t cycles_get(void)
+{
+    uint32_t primask = twr_irq_save();
+
+    uint32_t value = SysTick->VAL;
+
+    uint32_t ms = HAL_GetTick();
+
+    // Counter has wrapped but its interrupt is still pending
+    if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0)
+    {
+        ms++;
+
+        value = SysTick->VAL;
+    }
+
+    uint64_t cycles = (uint64_t) ms * (SysTick->LOAD + 1) + SysTick->LOAD - value;
+
+    twr_irq_restore(primask);
+
+    return cycles;
+}
+
+static void report(const char *format, ...)
+{
+    char line[128];
+
+    va_list ap;
+
+    va_start(ap, format);
+
+    int length = twr_fmt_vsnprintf(line, sizeof(line), format, ap);
+
+    va_end(ap);
+
+    twr_uart_write(TWR_UART_UART2, line, length < (int) sizeof(line) ? (size_t) length : sizeof(line) - 1);
+}
+
+static bool fifo_run(uint32_t param, uint32_t iterations)
+{
+    static uint8_t buffer[512];
+    twr_fifo_t fifo;
+
+    twr_fifo_init(&fifo, buffer, sizeof(buffer));
+
+    while (iterations--)
+    {
+        twr_fifo_write(&fifo, data, param);
+        twr_fifo_read(&fifo, data + 512, param);
+    }
+
+    return true;
+}
+
+static bool queue_run(uint32_t param, uint32_t iterations)
+{
+    static uint8_t buffer[512];
+    twr_queue_t queue;
+
+    twr_queue_init(&queue, buffer, sizeof(buffer));
+
+    while (iterations--)
+    {
+        size_t length = 512;
+
+        twr_queue_put(&queue, data, param);
+        twr_queue_get(&queue, data + 512, &length);
+    }
+
+    return true;
+}
+
+static bool i2c_run(uint32_t param, uint32_t iterations)
+{
+    uint8_t temperature[2];
+
+    twr_i2c_memory_transfer_t transfer =
+    {
+        .device_address = BENCHMARK_TMP112_ADDRESS,
+        .memory_address = 0x00,
+        .buffer = temperature,
+        .length = sizeof(temperature)
+    };
+
+    twr_i2c_set_speed(TWR_I2C_I2C0, param);
+
+    while (iterations--)
+    {
+        if (!twr_i2c_memory_read(TWR_I2C_I2C0, &transfer))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool spi_run(uint32_t param, uint32_t iterations)
+{
+    twr_spi_set_speed(param);
+
+    // No module is selected, so the bus is only clocked
+    twr_spi_set_manual_cs_control(true);
+
+    bool success = true;
+
+    while (success && iterations--)
+    {
+        success = twr_spi_transfer(data, data + 512, 64);
+    }
+
+    twr_spi_set_manual_cs_control(false);
+
+    return success;
+}
+
+static bool uart_run(uint32_t param, uint32_t iterations)
+{
+    // Measured on UART1, so results are not mixed into report on UART2
+    twr_uart_init(TWR_UART_UART1, param, TWR_UART_SETTING_8N1);
+
+    bool success = true;
+
+    while (success && iterations--)
+    {
+        success = twr_uart_write(TWR_UART_UART1, data, 64) == 64;
+    }
+
+    twr_uart_deinit(TWR_UART_UART1);
+
+    return success;
+}
+
+static bool data_stream_run(uint32_t param, uint32_t iterations, bool median)
+{
+    TWR_DATA_STREAM_FLOAT_BUFFER(buffer_8, 8)
+    TWR_DATA_STREAM_FLOAT_BUFFER(buffer_32, 32)
+    twr_data_stream_t stream;
+    float value = 0;
+    float result;
+
+    twr_data_stream_init(&stream, 1, param == 8 ? &buffer_8 : &buffer_32);
+
+    for (uint32_t i = 0; i < param; i++)
+    {
+        value = value < 100 ? value + 7.25f : value - 93.5f;
+
+        twr_data_stream_feed(&stream, &value);
+    }
+
+    while (iterations--)
+    {
+        value = value < 100 ? value + 7.25f : value - 93.5f;
+
+        twr_data_stream_feed(&stream, &value);
+
+        if (median)
+        {
+            twr_data_stream_get_median(&stream, &result);
+        }
+        else
+        {
+            twr_data_stream_get_average(&stream, &result);
+        }
+    }
+
+    return true;
+}
+
+static bool data_stream_median_run(uint32_t param, uint32_t iterations)
+{
+    return data_stream_run(param, iterations, true);
+}
+
+static bool data_stream_average_run(uint32_t param, uint32_t iterations)
+{
+    return data_stream_run(param, iterations, false);
+}
+
+static bool gfx_draw_run(uint32_t param, uint32_t iterations)
+{
+    (void) param;
+
+    twr_gfx_t *gfx = twr_module_lcd_get_gfx();
+
+    // Rendering to frame buffer, transfer to display is queued on SPI and not included
+    while (iterations--)
+    {
+        twr_gfx_clear(gfx);
+
+        twr_gfx_draw_fill_rectangle(gfx, 0, 0, 127, 63, true);
+
+        twr_gfx_set_font(gfx, &twr_font_ubuntu_15);
+
+        twr_gfx_draw_string(gfx, 8, 80, "Benchmark", true);
+
+        twr_gfx_draw_circle(gfx, 64, 100, 20, true);
+    }
+
+    return true;
+}
+
+static bool sha256_run(uint32_t param, uint32_t iterations)
+{
+    twr_sha256_t sha256;
+    uint8_t hash[32];
+
+    while (iterations--)
+    {
+        twr_sha256_init(&sha256);
+        twr_sha256_update(&sha256, data, param);
+        twr_sha256_final(&sha256, hash, false);
+    }
+
+    return true;
+}
+
+static bool aes_ecb_run(uint32_t param, uint32_t iterations)
+{
+    twr_aes_key_t key = { 0x2b7e1516, 0x28aed2a6, 0xabf71588, 0x09cf4f3c };
+
+    while (iterations--)
+    {
+        if (!twr_aes_ecb_encrypt(data + 512, data, param, key))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool eeprom_write_run(uint32_t param, uint32_t iterations)
+{
+    while (iterations--)
+    {
+        // Pattern changes every time, so no write is skipped as unchanged
+        memset(data + 512, iterations & 1 ? 0x55 : 0xaa, param);
+
+        if (!twr_eeprom_write(BENCHMARK_EEPROM_ADDRESS, data + 512, param))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void application_init(void)
+{
+    twr_uart_init(TWR_UART_UART2, TWR_UART_BAUDRATE_115200, TWR_UART_SETTING_8N1);
+
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = i * 151 + 17;
+    }
+
+    twr_i2c_init(TWR_I2C_I2C0, TWR_I2C_SPEED_100_KHZ);
+
+    twr_spi_init(TWR_SPI_SPEED_1_MHZ, TWR_SPI_MODE_0);
+
+    twr_module_lcd_init();
+
+    twr_aes_init();
+
+#if BENCHMARK_PLL
+    twr_system_pll_enable();
+
+    twr_system_clock_commit();
+#endif
+
+    report("# clock=%lu\r\n", (unsigned long) twr_system_get_clock());
+
+    report("name,param,iterations,cycles,cycles_per_iteration,ns_per_iteration\r\n");
+}
+
+void application_task(void *param)
+{
+    (void) param;
+
+    if (benchmark_index == sizeof(benchmark) / sizeof(benchmark[0]))
+    {
+        report("# done\r\n");
+
+        return;
+    }
+
+    const benchmark_t *b = &benchmark[benchmark_index++];
+
+    uint64_t start = cycles_get();
+
+    bool success = b->run(b->param, b->iterations);
+
+    uint64_t cycles = cycles_get() - start;
+
+    if (success)
+    {
+        uint64_t cycles_per_iteration = cycles / b->iterations;
+
+        uint64_t ns = cycles * 1000000000ULL / twr_system_get_clock() / b->iterations;
+
+        report("%s,%lu,%lu,%llu,%llu,%llu\r\n", b->name, (unsigned long) b->param, (unsigned long) b->iterations,
+            (unsigned long long) cycles, (unsigned long long) cycles_per_iteration, (unsigned long long) ns);
+    }
+    else
+    {
+        report("# %s,%lu failed\r\n", b->name, (unsigned long) b->param);
+    }
+
+    // Every benchmark runs in its own spin, so other tasks (e.g. display transfer) are not starved
+    twr_scheduler_plan_current_relative(10);
+}
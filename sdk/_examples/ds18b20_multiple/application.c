@@ -52,6 +52,7 @@ void application_init(void)
 
     twr_module_sensor_init();
 
+    // All sensors convert at once, the whole chain takes a single conversion time (750 ms at 12 bits) per update
     twr_ds18b20_init_multiple(&ds18b20, ds18b20_sensors, DS18B20_SENSOR_COUNT, TWR_DS18B20_RESOLUTION_BITS_12);
     twr_ds18b20_set_event_handler(&ds18b20, ds18b20_event_handler, NULL);
     twr_ds18b20_set_update_interval(&ds18b20, 5 * 1000);
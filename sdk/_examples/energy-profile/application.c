@@ -0,0 +1,271 @@
+#include <application.h>
+
+// Duration of every scenario
+#define SCENARIO_DURATION (5 * 60 * 1000)
+
+// Marker is high during active phases of scenario, before scenario it is high for its number times this interval
+#define MARKER_GPIO TWR_GPIO_P4
+#define MARKER_BOUNDARY_INTERVAL 50
+
+#define TMP112_INTERVAL (10 * 1000)
+#define LIS2DH12_INTERVAL 1000
+#define UART_BURST_INTERVAL (10 * 1000)
+#define UART_BURST_LINES 8
+#define RADIO_PUB_INTERVAL (10 * 1000)
+
+typedef struct
+{
+    const char *name;
+
+    // Interval of active phase, TWR_TICK_INFINITY for none
+    twr_tick_t interval;
+
+    // Start of active phase
+    void (*active)(void);
+
+} scenario_t;
+
+typedef enum
+{
+    STATE_BOUNDARY = 0,
+    STATE_START = 1,
+    STATE_END = 2
+
+} state_t;
+
+static void idle_active(void);
+static void tmp112_active(void);
+static void lis2dh12_active(void);
+static void uart_burst_active(void);
+static void radio_pub_active(void);
+
+void radio_event_handler(twr_radio_event_t event, void *event_param);
+
+static const scenario_t scenario[] =
+{
+    { "idle", TWR_TICK_INFINITY, idle_active },
+    { "tmp112", TMP112_INTERVAL, tmp112_active },
+    { "lis2dh12", LIS2DH12_INTERVAL, lis2dh12_active },
+    { "uart_burst", UART_BURST_INTERVAL, uart_burst_active },
+    // Radio stays initialized once this scenario has run, sleeping node keeps transceiver in sleep
+    { "radio_pub_ack", RADIO_PUB_INTERVAL, radio_pub_active }
+};
+
+// Thermometer instance
+twr_tmp112_t tmp112;
+
+// Accelerometer instance
+twr_lis2dh12_t lis2dh12;
+
+size_t scenario_index;
+state_t state;
+bool radio_initialized;
+int radio_counter;
+
+twr_scheduler_task_id_t active_task_id;
+
+// This function writes line to UART2, clock is raised only for the write
+static void report(const char *format, ...) __attribute__ ((format (printf, 1, 2)));
+
+static void report(const char *format, ...)
+{
+    char line[128];
+
+    va_list ap;
+
+    va_start(ap, format);
+
+    int length = twr_fmt_vsnprintf(line, sizeof(line), format, ap);
+
+    va_end(ap);
+
+    twr_uart_write(TWR_UART_UART2, line, length < (int) sizeof(line) ? (size_t) length : sizeof(line) - 1);
+}
+
+static void idle_active(void)
+{
+}
+
+static void tmp112_active(void)
+{
+    twr_gpio_set_output(MARKER_GPIO, 1);
+
+    if (!twr_tmp112_measure(&tmp112))
+    {
+        twr_gpio_set_output(MARKER_GPIO, 0);
+    }
+}
+
+static void lis2dh12_active(void)
+{
+    twr_gpio_set_output(MARKER_GPIO, 1);
+
+    if (!twr_lis2dh12_measure(&lis2dh12))
+    {
+        twr_gpio_set_output(MARKER_GPIO, 0);
+    }
+}
+
+static void uart_burst_active(void)
+{
+    twr_gpio_set_output(MARKER_GPIO, 1);
+
+    for (int i = 0; i < UART_BURST_LINES; i++)
+    {
+        report("# burst %d: 0123456789abcdef0123456789abcdef0123456789abcdef\r\n", i);
+    }
+
+    twr_gpio_set_output(MARKER_GPIO, 0);
+}
+
+static void radio_pub_active(void)
+{
+    if (!radio_initialized)
+    {
+        twr_radio_init(TWR_RADIO_MODE_NODE_SLEEPING);
+        twr_radio_set_event_handler(radio_event_handler, NULL);
+
+        radio_initialized = true;
+    }
+
+    twr_gpio_set_output(MARKER_GPIO, 1);
+
+    radio_counter++;
+
+    // Gateway acknowledges every packet of paired node, marker goes low on TX done or error
+    if (!twr_radio_pub_int("energy/counter", &radio_counter))
+    {
+        twr_gpio_set_output(MARKER_GPIO, 0);
+    }
+}
+
+// This function dispatches thermometer events
+void tmp112_event_handler(twr_tmp112_t *self, twr_tmp112_event_t event, void *event_param)
+{
+    twr_gpio_set_output(MARKER_GPIO, 0);
+}
+
+// This function dispatches accelerometer events
+void lis2dh12_event_handler(twr_lis2dh12_t *self, twr_lis2dh12_event_t event, void *event_param)
+{
+    if (event == TWR_LIS2DH12_EVENT_UPDATE || event == TWR_LIS2DH12_EVENT_ERROR)
+    {
+        twr_gpio_set_output(MARKER_GPIO, 0);
+    }
+}
+
+// This function dispatches radio events
+void radio_event_handler(twr_radio_event_t event, void *event_param)
+{
+    if (event == TWR_RADIO_EVENT_TX_DONE || event == TWR_RADIO_EVENT_TX_ERROR)
+    {
+        twr_gpio_set_output(MARKER_GPIO, 0);
+    }
+}
+
+// This function is run as task and starts active phases of current scenario
+void active_task(void *param)
+{
+    (void) param;
+
+    scenario[scenario_index].active();
+
+    twr_scheduler_plan_current_relative(scenario[scenario_index].interval);
+}
+
+// This function reports time spent in clock and power states during scenario
+void residency_report(const scenario_t *s)
+{
+#if TWR_SYSTEM_RESIDENCY
+    twr_system_residency_t residency;
+
+    twr_system_get_residency(&residency);
+
+    report("%s,%lu,%llu,%llu,%llu,%llu,%llu,%llu,%lu\r\n", s->name, (unsigned long) SCENARIO_DURATION,
+        (unsigned long long) residency.time[TWR_SYSTEM_STATE_MSI],
+        (unsigned long long) residency.time[TWR_SYSTEM_STATE_MSI_FAST],
+        (unsigned long long) residency.time[TWR_SYSTEM_STATE_HSI],
+        (unsigned long long) residency.time[TWR_SYSTEM_STATE_PLL],
+        (unsigned long long) residency.time[TWR_SYSTEM_STATE_SLEEP],
+        (unsigned long long) residency.time[TWR_SYSTEM_STATE_STOP],
+        (unsigned long) residency.transitions);
+#else
+    report("# %s done, build with TWR_SYSTEM_RESIDENCY=1 for residency counters\r\n", s->name);
+#endif
+
+    if (radio_initialized)
+    {
+        twr_radio_stats_t stats;
+
+        twr_radio_get_stats(&stats);
+
+        report("# radio tx=%lu retries=%lu acked=%lu dropped=%lu\r\n", (unsigned long) stats.tx_packets,
+            (unsigned long) stats.tx_retries, (unsigned long) stats.tx_acked, (unsigned long) stats.tx_dropped);
+    }
+}
+
+// This function is run as task and steps through scenarios
+void scenario_task(void *param)
+{
+    (void) param;
+
+    const scenario_t *s = &scenario[scenario_index];
+
+    if (state == STATE_BOUNDARY)
+    {
+        twr_gpio_set_output(MARKER_GPIO, 1);
+
+        state = STATE_START;
+
+        twr_scheduler_plan_current_relative((scenario_index + 1) * MARKER_BOUNDARY_INTERVAL);
+    }
+    else if (state == STATE_START)
+    {
+        twr_gpio_set_output(MARKER_GPIO, 0);
+
+        twr_system_residency_reset();
+
+        twr_scheduler_plan_now(active_task_id);
+
+        state = STATE_END;
+
+        twr_scheduler_plan_current_relative(SCENARIO_DURATION);
+    }
+    else
+    {
+        twr_scheduler_plan_absolute(active_task_id, TWR_TICK_INFINITY);
+
+        twr_gpio_set_output(MARKER_GPIO, 0);
+
+        residency_report(s);
+
+        scenario_index = (scenario_index + 1) % (sizeof(scenario) / sizeof(scenario[0]));
+
+        state = STATE_BOUNDARY;
+
+        twr_scheduler_plan_current_now();
+    }
+}
+
+void application_init(void)
+{
+    twr_gpio_init(MARKER_GPIO);
+    twr_gpio_set_mode(MARKER_GPIO, TWR_GPIO_MODE_OUTPUT);
+    twr_gpio_set_output(MARKER_GPIO, 0);
+
+    twr_uart_init(TWR_UART_UART2, TWR_UART_BAUDRATE_115200, TWR_UART_SETTING_8N1);
+
+    // Sensors are measured only on request of scenario
+    twr_tmp112_init(&tmp112, TWR_I2C_I2C0, 0x49);
+    twr_tmp112_set_event_handler(&tmp112, tmp112_event_handler, NULL);
+
+    twr_lis2dh12_init(&lis2dh12, TWR_I2C_I2C0, 0x19);
+    twr_lis2dh12_set_event_handler(&lis2dh12, lis2dh12_event_handler, NULL);
+
+    report("name,duration_ms,msi_us,msi_fast_us,hsi_us,pll_us,sleep_us,stop_us,transitions\r\n");
+
+    active_task_id = twr_scheduler_register(active_task, NULL, TWR_TICK_INFINITY);
+
+    // First scenario starts after sensors have been initialized
+    twr_scheduler_register(scenario_task, NULL, 1000);
+}
@@ -8,7 +8,7 @@ twr_led_strip_t led_strip;
 uint32_t color;
 int effect = -1;
 
-static uint32_t _dma_buffer[COUNT * 4 * 2]; // count * type * 2
+static uint32_t _dma_buffer[TWR_WS2812B_BUFFER_LENGTH(COUNT, TWR_LED_STRIP_TYPE_RGBW)];
 
 const twr_led_strip_buffer_t _led_strip_buffer =
 {
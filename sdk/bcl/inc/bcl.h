@@ -2364,6 +2364,7 @@
 #define BC_UART_EVENT_ASYNC_WRITE_DONE TWR_UART_EVENT_ASYNC_WRITE_DONE
 #define BC_UART_EVENT_ASYNC_READ_DATA TWR_UART_EVENT_ASYNC_READ_DATA
 #define BC_UART_EVENT_ASYNC_READ_TIMEOUT TWR_UART_EVENT_ASYNC_READ_TIMEOUT
+#define BC_UART_EVENT_ASYNC_READ_OVERRUN TWR_UART_EVENT_ASYNC_READ_OVERRUN
 #define bc_uart_event_t twr_uart_event_t
 #define bc_uart_init twr_uart_init
 #define bc_uart_deinit twr_uart_deinit
@@ -0,0 +1,151 @@
+#include <twr_bench.h>
+#include <time.h>
+
+#define _TWR_BENCH_ITERATIONS_MAX 1000000000ULL
+
+typedef struct
+{
+    const char *name;
+    void (*function)(twr_bench_state_t *);
+
+} _twr_bench_t;
+
+static struct
+{
+    _twr_bench_t bench[TWR_BENCH_MAX];
+    int count;
+
+} _twr_bench;
+
+static double _twr_bench_run(_twr_bench_t *bench, uint64_t iterations, size_t *bytes);
+static double _twr_bench_time(void);
+
+void twr_bench_register(const char *name, void (*function)(twr_bench_state_t *))
+{
+    if (_twr_bench.count == TWR_BENCH_MAX)
+    {
+        fprintf(stderr, "twr_bench: too many benchmarks, %s skipped\n", name);
+
+        return;
+    }
+
+    _twr_bench.bench[_twr_bench.count].name = name;
+    _twr_bench.bench[_twr_bench.count].function = function;
+    _twr_bench.count++;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *filter = NULL;
+    double min_time = 0.5;
+    bool csv = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strncmp(argv[i], "--min-time=", 11) == 0)
+        {
+            min_time = atof(argv[i] + 11);
+        }
+        else if (strcmp(argv[i], "--csv") == 0)
+        {
+            csv = true;
+        }
+        else if (argv[i][0] != '-')
+        {
+            filter = argv[i];
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--min-time=SECONDS] [--csv] [FILTER]\n", argv[0]);
+
+            return 2;
+        }
+    }
+
+    if (csv)
+    {
+        printf("name,iterations,ns_per_iteration,mb_per_second\n");
+    }
+    else
+    {
+        printf("%-32s %12s %14s %12s\n", "Benchmark", "Iterations", "ns/iteration", "MB/s");
+    }
+
+    for (int i = 0; i < _twr_bench.count; i++)
+    {
+        _twr_bench_t *bench = &_twr_bench.bench[i];
+
+        if (filter != NULL && strstr(bench->name, filter) == NULL)
+        {
+            continue;
+        }
+
+        uint64_t iterations = 1;
+        size_t bytes = 0;
+        double elapsed;
+
+        // Iterations grow with margin towards minimum time estimated from previous run
+        while (true)
+        {
+            elapsed = _twr_bench_run(bench, iterations, &bytes);
+
+            if (elapsed >= min_time || iterations >= _TWR_BENCH_ITERATIONS_MAX)
+            {
+                break;
+            }
+
+            double estimate = elapsed > 0 ? iterations * min_time * 1.4 / elapsed : iterations * 100.0;
+
+            uint64_t next = estimate > iterations * 100.0 ? iterations * 100 : (uint64_t) estimate;
+
+            iterations = next > iterations ? next : iterations + 1;
+
+            if (iterations > _TWR_BENCH_ITERATIONS_MAX)
+            {
+                iterations = _TWR_BENCH_ITERATIONS_MAX;
+            }
+        }
+
+        double ns = elapsed * 1e9 / iterations;
+        double mbps = bytes != 0 ? (double) bytes * iterations / elapsed / 1e6 : 0;
+
+        if (csv)
+        {
+            printf("%s,%llu,%.3f,%.3f\n", bench->name, (unsigned long long) iterations, ns, mbps);
+        }
+        else if (bytes != 0)
+        {
+            printf("%-32s %12llu %14.1f %12.1f\n", bench->name, (unsigned long long) iterations, ns, mbps);
+        }
+        else
+        {
+            printf("%-32s %12llu %14.1f %12s\n", bench->name, (unsigned long long) iterations, ns, "-");
+        }
+    }
+
+    return 0;
+}
+
+static double _twr_bench_run(_twr_bench_t *bench, uint64_t iterations, size_t *bytes)
+{
+    twr_bench_state_t state = { ._iterations = iterations, ._remaining = iterations, ._bytes = 0 };
+
+    double start = _twr_bench_time();
+
+    bench->function(&state);
+
+    double elapsed = _twr_bench_time() - start;
+
+    *bytes = state._bytes;
+
+    return elapsed;
+}
+
+static double _twr_bench_time(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
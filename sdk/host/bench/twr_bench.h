@@ -0,0 +1,85 @@
+#ifndef _TWR_BENCH_H
+#define _TWR_BENCH_H
+
+#include <twr_common.h>
+
+//! @addtogroup twr_bench twr_bench
+//! @brief Micro-benchmark harness for host build
+//!
+//! Benchmark is function which repeats measured operation while @ref twr_bench_keep_running returns true. Number of
+//! iterations is raised until run takes at least minimum time, so result in nanoseconds per iteration is stable.
+//! @{
+
+//! @brief Maximum number of benchmarks
+
+#define TWR_BENCH_MAX 64
+
+//! @brief State of benchmark run
+
+typedef struct
+{
+    uint64_t _iterations;
+    uint64_t _remaining;
+    size_t _bytes;
+
+} twr_bench_state_t;
+
+//! @brief Define and register benchmark
+//! @param[in] name Name of benchmark, body of benchmark follows and gets pointer to state as state
+
+#define TWR_BENCH(name) \
+    static void _twr_bench_##name(twr_bench_state_t *state); \
+    __attribute__ ((constructor)) static void _twr_bench_##name##_register(void) { twr_bench_register(#name, _twr_bench_##name); } \
+    static void _twr_bench_##name(twr_bench_state_t *state)
+
+//! @brief Register benchmark (done by @ref TWR_BENCH)
+//! @param[in] name Name of benchmark
+//! @param[in] function Benchmark function
+
+void twr_bench_register(const char *name, void (*function)(twr_bench_state_t *));
+
+//! @brief Check whether next iteration is to be run
+//! @param[in] state State of run
+//! @return true When next iteration is to be run
+
+static inline bool twr_bench_keep_running(twr_bench_state_t *state)
+{
+    if (state->_remaining == 0)
+    {
+        return false;
+    }
+
+    state->_remaining--;
+
+    return true;
+}
+
+//! @brief Get number of iterations of run, for benchmarks which process all iterations at once
+//! @param[in] state State of run
+//! @return Number of iterations
+
+static inline uint64_t twr_bench_get_iterations(twr_bench_state_t *state)
+{
+    return state->_iterations;
+}
+
+//! @brief Set number of bytes processed by iteration, throughput is reported then
+//! @param[in] state State of run
+//! @param[in] bytes Number of bytes
+
+static inline void twr_bench_set_bytes(twr_bench_state_t *state, size_t bytes)
+{
+    state->_bytes = bytes;
+}
+
+//! @brief Prevent compiler from removing computation of value pointed to
+//! @param[in] pointer Pointer to value
+
+static inline void twr_bench_do_not_optimize(const void *pointer)
+{
+    __asm__ volatile ("" : : "r" (pointer) : "memory");
+}
+
+//! @}
+
+#endif // _TWR_BENCH_H
@@ -0,0 +1,262 @@
+#include <twr_bench.h>
+#include <twr_host.h>
+#include <twr_scheduler.h>
+#include <twr_fifo.h>
+#include <twr_queue.h>
+#include <twr_data_stream.h>
+#include <twr_dice.h>
+#include <twr_crc.h>
+#include <twr_base64.h>
+#include <twr_fmt.h>
+#include <setjmp.h>
+
+#define _TWR_BENCH_SCHEDULER_TASKS 16
+
+static uint8_t _twr_bench_data[256];
+
+static struct
+{
+    jmp_buf exit;
+    uint64_t remaining;
+
+} _twr_bench_scheduler;
+
+static void _twr_bench_data_fill(void)
+{
+    for (size_t i = 0; i < sizeof(_twr_bench_data); i++)
+    {
+        _twr_bench_data[i] = i * 151 + 17;
+    }
+}
+
+TWR_BENCH(crc8_256)
+{
+    _twr_bench_data_fill();
+
+    twr_bench_set_bytes(state, sizeof(_twr_bench_data));
+
+    while (twr_bench_keep_running(state))
+    {
+        uint8_t crc = twr_crc8(0x31, _twr_bench_data, sizeof(_twr_bench_data), 0xff);
+
+        twr_bench_do_not_optimize(&crc);
+    }
+}
+
+TWR_BENCH(crc16_256)
+{
+    _twr_bench_data_fill();
+
+    twr_bench_set_bytes(state, sizeof(_twr_bench_data));
+
+    while (twr_bench_keep_running(state))
+    {
+        uint16_t crc = twr_crc16(0x1021, _twr_bench_data, sizeof(_twr_bench_data), 0xffff);
+
+        twr_bench_do_not_optimize(&crc);
+    }
+}
+
+TWR_BENCH(crc32_256)
+{
+    _twr_bench_data_fill();
+
+    twr_bench_set_bytes(state, sizeof(_twr_bench_data));
+
+    while (twr_bench_keep_running(state))
+    {
+        uint32_t crc = twr_crc32(_twr_bench_data, sizeof(_twr_bench_data));
+
+        twr_bench_do_not_optimize(&crc);
+    }
+}
+
+TWR_BENCH(base64_encode_192)
+{
+    char output[256];
+
+    _twr_bench_data_fill();
+
+    twr_bench_set_bytes(state, 192);
+
+    while (twr_bench_keep_running(state))
+    {
+        size_t length = sizeof(output);
+
+        twr_base64_encode(output, &length, _twr_bench_data, 192);
+
+        twr_bench_do_not_optimize(output);
+    }
+}
+
+TWR_BENCH(base64_decode_256)
+{
+    char input[257];
+    uint8_t output[192];
+    size_t length = sizeof(input);
+
+    _twr_bench_data_fill();
+
+    twr_base64_encode(input, &length, _twr_bench_data, 192);
+
+    twr_bench_set_bytes(state, 256);
+
+    while (twr_bench_keep_running(state))
+    {
+        size_t output_length = sizeof(output);
+
+        twr_base64_decode(output, &output_length, input, 256);
+
+        twr_bench_do_not_optimize(output);
+    }
+}
+
+TWR_BENCH(fifo_write_read_64)
+{
+    static uint8_t buffer[512];
+    uint8_t chunk[64];
+    twr_fifo_t fifo;
+
+    twr_fifo_init(&fifo, buffer, sizeof(buffer));
+
+    twr_bench_set_bytes(state, sizeof(chunk));
+
+    while (twr_bench_keep_running(state))
+    {
+        twr_fifo_write(&fifo, _twr_bench_data, sizeof(chunk));
+        twr_fifo_read(&fifo, chunk, sizeof(chunk));
+
+        twr_bench_do_not_optimize(chunk);
+    }
+}
+
+TWR_BENCH(queue_put_get_32)
+{
+    static uint8_t buffer[512];
+    uint8_t message[32];
+    twr_queue_t queue;
+
+    twr_queue_init(&queue, buffer, sizeof(buffer));
+
+    twr_bench_set_bytes(state, sizeof(message));
+
+    while (twr_bench_keep_running(state))
+    {
+        size_t length = sizeof(message);
+
+        twr_queue_put(&queue, _twr_bench_data, sizeof(message));
+        twr_queue_get(&queue, message, &length);
+
+        twr_bench_do_not_optimize(message);
+    }
+}
+
+TWR_BENCH(data_stream_feed_median_32)
+{
+    TWR_DATA_STREAM_FLOAT_BUFFER(buffer, 32)
+    twr_data_stream_t stream;
+    float value = 0;
+
+    twr_data_stream_init(&stream, 1, &buffer);
+
+    while (twr_bench_keep_running(state))
+    {
+        float median;
+
+        value = value < 100 ? value + 7.25f : value - 93.5f;
+
+        twr_data_stream_feed(&stream, &value);
+        twr_data_stream_get_median(&stream, &median);
+
+        twr_bench_do_not_optimize(&median);
+    }
+}
+
+TWR_BENCH(dice_feed_vectors)
+{
+    twr_dice_t dice;
+    float z = 1;
+
+    twr_dice_init(&dice, TWR_DICE_FACE_UNKNOWN);
+
+    while (twr_bench_keep_running(state))
+    {
+        z = -z;
+
+        twr_dice_feed_vectors(&dice, 0.02f, -0.03f, z);
+
+        twr_dice_face_t face = twr_dice_get_face(&dice);
+
+        twr_bench_do_not_optimize(&face);
+    }
+}
+
+TWR_BENCH(fmt_snprintf)
+{
+    char buffer[64];
+
+    while (twr_bench_keep_running(state))
+    {
+        twr_fmt_snprintf(buffer, sizeof(buffer), "# %lu.%02lu <%c> %s %d", 12345UL, 67UL, 'I', "value", -42);
+
+        twr_bench_do_not_optimize(buffer);
+    }
+}
+
+TWR_BENCH(libc_snprintf)
+{
+    char buffer[64];
+
+    while (twr_bench_keep_running(state))
+    {
+        snprintf(buffer, sizeof(buffer), "# %lu.%02lu <%c> %s %d", 12345UL, 67UL, 'I', "value", -42);
+
+        twr_bench_do_not_optimize(buffer);
+    }
+}
+
+static void _twr_bench_scheduler_task(void *param)
+{
+    uintptr_t period = (uintptr_t) param;
+
+    if (--_twr_bench_scheduler.remaining == 0)
+    {
+        longjmp(_twr_bench_scheduler.exit, 1);
+    }
+
+    twr_scheduler_plan_current_relative(period);
+}
+
+static void _twr_bench_scheduler_idle(void *param)
+{
+    (void) param;
+
+    if (_twr_bench_scheduler.remaining == 0)
+    {
+        longjmp(_twr_bench_scheduler.exit, 1);
+    }
+}
+
+TWR_BENCH(scheduler_execute_16_tasks)
+{
+    twr_scheduler_init();
+
+    // Periods are prime, so tasks get due in changing order
+    static const uintptr_t period[] = { 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71 };
+
+    for (int i = 0; i < _TWR_BENCH_SCHEDULER_TASKS; i++)
+    {
+        twr_scheduler_register(_twr_bench_scheduler_task, (void *) period[i], twr_tick_get() + i);
+    }
+
+    _twr_bench_scheduler.remaining = twr_bench_get_iterations(state);
+
+    twr_host_set_idle_handler(_twr_bench_scheduler_idle, NULL);
+
+    if (setjmp(_twr_bench_scheduler.exit) == 0)
+    {
+        twr_scheduler_run();
+    }
+
+    twr_host_set_idle_handler(NULL, NULL);
+}
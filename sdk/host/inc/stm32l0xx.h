@@ -0,0 +1,74 @@
+#ifndef _TWR_HOST_STM32L0XX_H
+#define _TWR_HOST_STM32L0XX_H
+
+// Replacement of device header for host build, core intrinsics act on emulated PRIMASK and peripherals referenced
+// by headers of portable modules are plain memory
+
+#include <stdint.h>
+
+#define __IO volatile
+#define __I volatile const
+#define __O volatile
+
+typedef struct
+{
+    __IO uint32_t CPUID;
+    __IO uint32_t ICSR;
+    __IO uint32_t VTOR;
+    __IO uint32_t AIRCR;
+    __IO uint32_t SCR;
+    __IO uint32_t CCR;
+
+} SCB_Type;
+
+typedef struct
+{
+    __IO uint32_t ISR;
+    __IO uint32_t WPR;
+
+} RTC_TypeDef;
+
+typedef struct
+{
+    __IO uint32_t CR1;
+    __IO uint32_t CNT;
+
+} TIM_TypeDef;
+
+#define SCB_SCR_SLEEPDEEP_Msk (1UL << 2)
+#define RTC_ISR_RSF (1UL << 5)
+
+extern SCB_Type twr_host_scb;
+extern RTC_TypeDef twr_host_rtc;
+extern volatile uint32_t twr_host_primask;
+
+#define SCB (&twr_host_scb)
+#define RTC (&twr_host_rtc)
+
+static inline uint32_t __get_PRIMASK(void)
+{
+    return twr_host_primask;
+}
+
+static inline void __set_PRIMASK(uint32_t primask)
+{
+    twr_host_primask = primask;
+}
+
+static inline void __disable_irq(void)
+{
+    twr_host_primask = 1;
+}
+
+static inline void __enable_irq(void)
+{
+    twr_host_primask = 0;
+}
+
+#define __DMB() __sync_synchronize()
+#define __DSB() __sync_synchronize()
+#define __ISB() __sync_synchronize()
+#define __NOP() do { } while (0)
+#define __WFI() do { } while (0)
+
+#endif // _TWR_HOST_STM32L0XX_H
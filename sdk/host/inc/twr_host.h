@@ -0,0 +1,29 @@
+#ifndef _TWR_HOST_H
+#define _TWR_HOST_H
+
+#include <twr_common.h>
+#include <twr_tick.h>
+
+//! @addtogroup twr_host twr_host
+//! @brief Stubs of hardware dependent SDK functions for host build of portable modules
+//!
+//! Tick does not follow real time, it is advanced by @ref twr_host_advance and by idle of scheduler, which skips
+//! directly to the next planned task. Interrupts are never delivered, so primask is only tracked.
+//! @{
+
+//! @brief Advance tick as SysTick of target would
+//! @param[in] delta Number of milliseconds
+
+void twr_host_advance(twr_tick_t delta);
+
+//! @brief Set handler called from idle of scheduler before tick is advanced
+//!
+//! Handler may leave @ref twr_scheduler_run which never returns, e.g. by longjmp.
+//! @param[in] handler Function, NULL to clear
+//! @param[in] param Optional parameter of handler
+
+void twr_host_set_idle_handler(void (*handler)(void *), void *param);
+
+//! @}
+
+#endif // _TWR_HOST_H
@@ -0,0 +1,82 @@
+#include <twr_host.h>
+#include <twr_scheduler.h>
+#include <twr_system.h>
+#include <twr_error.h>
+#include <twr_irq.h>
+
+SCB_Type twr_host_scb;
+RTC_TypeDef twr_host_rtc;
+volatile uint32_t twr_host_primask;
+
+static struct
+{
+    void (*idle_handler)(void *);
+    void *idle_param;
+
+} _twr_host;
+
+void twr_host_advance(twr_tick_t delta)
+{
+    twr_tick_increment_irq(delta);
+}
+
+void twr_host_set_idle_handler(void (*handler)(void *), void *param)
+{
+    _twr_host.idle_handler = handler;
+    _twr_host.idle_param = param;
+}
+
+void application_idle(void)
+{
+    if (_twr_host.idle_handler != NULL)
+    {
+        _twr_host.idle_handler(_twr_host.idle_param);
+    }
+
+    twr_tick_t tick_now = twr_tick_get();
+
+    twr_tick_t tick_next = twr_scheduler_get_next_tick();
+
+    // Time runs only while nothing is due, the whole wait passes at once
+    twr_tick_increment_irq(tick_next > tick_now && tick_next != TWR_TICK_INFINITY ? tick_next - tick_now : 1);
+}
+
+void application_error(twr_error_t code)
+{
+    fprintf(stderr, "application_error: %d\n", (int) code);
+
+    abort();
+}
+
+void twr_irq_disable(void)
+{
+    __disable_irq();
+}
+
+void twr_irq_enable(void)
+{
+    __enable_irq();
+}
+
+void twr_system_clock_commit(void)
+{
+}
+
+void twr_system_deep_sleep_disable(void)
+{
+}
+
+void twr_system_deep_sleep_enable(void)
+{
+}
+
+bool twr_system_tickless_enter(uint32_t timeout)
+{
+    (void) timeout;
+
+    return false;
+}
+
+void twr_system_tickless_exit(void)
+{
+}
@@ -5,6 +5,7 @@
 
   .global g_pfnVectors
   .global Default_Handler
+  .weak twr_stack_paint
 
   .word _sidata
   .word _sdata
@@ -44,6 +45,12 @@ LoopFillZero:
   cmp r2, r3
   bcc FillZero
 
+  ldr r0, =twr_stack_paint
+  cmp r0, #0
+  beq StackPaintSkip
+  blx r0
+StackPaintSkip:
+
   bl SystemInit
   bl __libc_init_array
   bl main
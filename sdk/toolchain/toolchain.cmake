@@ -58,6 +58,42 @@ if(DEFINED SCHEDULER_INTERVAL)
     add_definitions("-DTWR_SCHEDULER_INTERVAL_MS=${SCHEDULER_INTERVAL}")
 endif()
 
+if(DEFINED SCHEDULER_HEAP)
+    add_definitions("-DTWR_SCHEDULER_HEAP=${SCHEDULER_HEAP}")
+endif()
+
+if(DEFINED SCHEDULER_TICKLESS)
+    add_definitions("-DTWR_SCHEDULER_TICKLESS=${SCHEDULER_TICKLESS}")
+endif()
+
+if(DEFINED SCHEDULER_STANDBY)
+    add_definitions("-DTWR_SCHEDULER_STANDBY=${SCHEDULER_STANDBY}")
+endif()
+
+if(DEFINED SCHEDULER_PROFILE)
+    add_definitions("-DTWR_SCHEDULER_PROFILE=${SCHEDULER_PROFILE}")
+endif()
+
+if(DEFINED SCHEDULER_WATCHDOG)
+    add_definitions("-DTWR_SCHEDULER_WATCHDOG=${SCHEDULER_WATCHDOG}")
+endif()
+
+if(DEFINED IRQ_RAMFUNC)
+    add_definitions("-DTWR_IRQ_RAMFUNC=${IRQ_RAMFUNC}")
+endif()
+
+if(DEFINED BUFFER_STATS)
+    add_definitions("-DTWR_FIFO_STATS=${BUFFER_STATS}" "-DTWR_QUEUE_STATS=${BUFFER_STATS}")
+endif()
+
+if(DEFINED I2C_STATS)
+    add_definitions("-DTWR_I2C_STATS=${I2C_STATS}")
+endif()
+
+if(DEFINED I2C_ADAPTIVE_TIMEOUT)
+    add_definitions("-DTWR_I2C_ADAPTIVE_TIMEOUT=${I2C_ADAPTIVE_TIMEOUT}")
+endif()
+
 # Setup utils
 set(CMAKE_OBJCOPY ${ARM_TOOLCHAIN_DIR}/${TOOLCHAIN_PREFIX}objcopy CACHE INTERNAL "objcopy tool")
 
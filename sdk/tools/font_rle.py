@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""Convert font generated by lcd-image-converter to TWR_FONT_IMAGE_FORMAT_RLE.
+
+Every glyph image is coded by bytes with count of skipped pixels in high nibble and count of drawn pixels
+in low nibble, runs continue on the next row and byte 0x00 ends the image. Glyphs which would not get
+smaller are kept as TWR_FONT_IMAGE_FORMAT_RAW.
+
+Usage: font_rle.py twr_font_ubuntu_11.c [output.c]
+"""
+
+import re
+import sys
+
+IMAGE_DATA = re.compile(r'static const uint8_t (image_data_\w+)\[(\d+)\] = \{(.*?)\};', re.S)
+IMAGE = re.compile(r'static const twr_font_image_t (\w+) = \{ (image_data_\w+),\s*(\d+), (\d+)[^}]*\};')
+
+
+def pixels(data, width, height):
+    stride = (width + 7) // 8
+
+    return [(data[y * stride + x // 8] >> (7 - x % 8)) & 1 == 0 for y in range(height) for x in range(width)]
+
+
+def encode(data, width, height):
+    runs = []
+    ink = False
+    count = 0
+
+    for pixel in pixels(data, width, height):
+        if pixel == ink:
+            count += 1
+        else:
+            runs.append(count)
+            ink = pixel
+            count = 1
+
+    runs.append(count)
+
+    if len(runs) % 2:
+        runs.append(0)
+
+    out = []
+
+    for i in range(0, len(runs), 2):
+        skip, draw = runs[i], runs[i + 1]
+
+        while skip > 15:
+            out.append(0xf0)
+            skip -= 15
+
+        while draw > 15:
+            out.append((skip << 4) | 0x0f)
+            skip = 0
+            draw -= 15
+
+        out.append((skip << 4) | draw)
+
+    # Trailing skipped pixels are not needed
+    while out and (out[-1] & 0x0f) == 0:
+        out.pop()
+
+    out.append(0x00)
+
+    return out
+
+
+def format_data(name, data):
+    lines = []
+
+    for i in range(0, len(data), 12):
+        lines.append('    ' + ', '.join('0x%02x' % b for b in data[i:i + 12]))
+
+    return 'static const uint8_t %s[%d] = {\n%s\n};' % (name, len(data), ',\n'.join(lines))
+
+
+def convert(source):
+    data = {m.group(1): [int(x, 16) for x in re.findall(r'0x[0-9a-fA-F]+', m.group(3))] for m in IMAGE_DATA.finditer(source)}
+    images = {}
+
+    for m in IMAGE.finditer(source):
+        name, width, height = m.group(2), int(m.group(3)), int(m.group(4))
+
+        rle = encode(data[name], width, height)
+
+        if len(rle) < len(data[name]):
+            images[name] = (rle, width, height, 'TWR_FONT_IMAGE_FORMAT_RLE')
+        else:
+            images[name] = (data[name], width, height, 'TWR_FONT_IMAGE_FORMAT_RAW')
+
+    source = IMAGE_DATA.sub(lambda m: format_data(m.group(1), images[m.group(1)][0]) if m.group(1) in images else m.group(0), source)
+
+    source = IMAGE.sub(lambda m: 'static const twr_font_image_t %s = { %s, %d, %d, %s };' % ((m.group(1), m.group(2)) + images[m.group(2)][1:]), source)
+
+    return source.replace('* RLE compression enabled: no', '* RLE compression enabled: no, converted by sdk/tools/font_rle.py')
+
+
+def main():
+    if len(sys.argv) not in (2, 3):
+        sys.exit(__doc__)
+
+    with open(sys.argv[1], encoding='utf-8') as f:
+        source = f.read()
+
+    with open(sys.argv[-1], 'w', encoding='utf-8') as f:
+        f.write(convert(source))
+
+
+if __name__ == '__main__':
+    main()
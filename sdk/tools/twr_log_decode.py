@@ -0,0 +1,221 @@
+#!/usr/bin/env python3
+"""Expand records of twr_log in deferred mode (TWR_LOG_DEFERRED) to text lines.
+
+Format strings are read from the ELF file of the firmware, records from serial port, file or stdin.
+
+Usage: twr_log_decode.py firmware.elf [--port /dev/ttyUSB0 | --input capture.bin] [--relative]
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+SYNC = 0xa5
+HEADER_SIZE = 11
+DUMP_WIDTH = 8
+
+CONVERSION = re.compile(r'%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|j|z|t|L)?([diuoxXcpfFeEgGaAsn%])')
+
+
+class Elf:
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self.data = f.read()
+
+        if self.data[:4] != b'\x7fELF' or self.data[4] != 1:
+            raise ValueError('%s is not 32-bit ELF file' % path)
+
+        shoff, = struct.unpack_from('<I', self.data, 0x20)
+        shentsize, shnum = struct.unpack_from('<HH', self.data, 0x2e)
+
+        self.sections = []
+
+        for i in range(shnum):
+            _, sh_type, flags, addr, offset, size = struct.unpack_from('<IIIIII', self.data, shoff + i * shentsize)
+
+            # Allocated sections with content
+            if sh_type == 1 and flags & 0x2:
+                self.sections.append((addr, offset, size))
+
+    def string(self, address):
+        for addr, offset, size in self.sections:
+            if addr <= address < addr + size:
+                start = offset + address - addr
+                end = self.data.index(b'\0', start)
+
+                return self.data[start:end].decode('utf-8', 'replace')
+
+        return None
+
+
+def expand(format, arguments):
+    out = []
+    position = 0
+    offset = 0
+
+    def take(size):
+        nonlocal offset
+
+        if offset + size > len(arguments):
+            raise IndexError
+
+        value = arguments[offset:offset + size]
+        offset += size
+
+        return value
+
+    try:
+        for m in CONVERSION.finditer(format):
+            out.append(format[position:m.start()])
+            position = m.end()
+
+            flags, width, precision, length, conversion = m.groups()
+
+            if conversion == '%':
+                out.append('%')
+                continue
+
+            if width == '*':
+                width = str(struct.unpack('<i', take(4))[0])
+
+            if precision == '*':
+                precision = str(struct.unpack('<i', take(4))[0])
+
+            spec = '%' + flags + (width or '') + ('.' + precision if precision is not None else '')
+
+            if conversion in 'diuoxXc':
+                wide = length in ('ll', 'j')
+                value, = struct.unpack(('<q' if wide else '<i') if conversion in 'di' else ('<Q' if wide else '<I'), take(8 if wide else 4))
+
+                if conversion == 'c':
+                    out.append((spec + 'c') % chr(value & 0xff))
+                else:
+                    out.append((spec + ('d' if conversion in 'iu' else conversion)) % value)
+
+            elif conversion == 'p':
+                out.append('0x%08x' % struct.unpack('<I', take(4)))
+
+            elif conversion in 'fFeEgGaA':
+                value, = struct.unpack('<d', take(8))
+
+                out.append((spec + ('f' if conversion in 'aA' else conversion)) % value)
+
+            elif conversion == 's':
+                count = take(1)[0]
+
+                out.append((spec + 's') % take(count).decode('utf-8', 'replace'))
+
+    except IndexError:
+        out.append('...')
+
+        return ''.join(out), b''
+
+    out.append(format[position:])
+
+    return ''.join(out), arguments[offset:]
+
+
+def dump(data):
+    lines = []
+
+    for position in range(0, len(data), DUMP_WIDTH):
+        line = data[position:position + DUMP_WIDTH]
+
+        hex = ' '.join('%02X' % b for b in line[:DUMP_WIDTH // 2])
+
+        if len(line) > DUMP_WIDTH // 2:
+            hex += ' | ' + ' '.join('%02X' % b for b in line[DUMP_WIDTH // 2:])
+
+        text = ''.join(chr(b) if 32 <= b <= 126 else '.' for b in line)
+
+        lines.append('%3d: %-*s %s' % (position, DUMP_WIDTH * 3 + 1, hex, text))
+
+    return lines
+
+
+def records(stream):
+    buffer = b''
+
+    while True:
+        chunk = stream.read(64)
+
+        if not chunk:
+            return
+
+        buffer += chunk
+
+        while True:
+            start = buffer.find(bytes([SYNC]))
+
+            if start < 0:
+                buffer = b''
+                break
+
+            buffer = buffer[start:]
+
+            if len(buffer) < HEADER_SIZE or len(buffer) < HEADER_SIZE + buffer[1]:
+                break
+
+            yield buffer[:HEADER_SIZE + buffer[1]]
+
+            buffer = buffer[HEADER_SIZE + buffer[1]:]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('elf', help='ELF file of firmware')
+    parser.add_argument('--port', help='serial port (requires pyserial)')
+    parser.add_argument('--input', help='file with captured records (default stdin)')
+    parser.add_argument('--relative', action='store_true', help='relative timestamps')
+    args = parser.parse_args()
+
+    elf = Elf(args.elf)
+
+    if args.port:
+        import serial
+
+        stream = serial.Serial(args.port, 115200, timeout=0.1)
+    elif args.input:
+        stream = open(args.input, 'rb')
+    else:
+        stream = sys.stdin.buffer
+
+    tick_last = 0
+
+    for record in records(stream):
+        letter = chr(record[2])
+        address, tick = struct.unpack_from('<II', record, 3)
+        arguments = record[HEADER_SIZE:]
+
+        if args.relative:
+            timestamp = '+%d.%02d' % ((tick - tick_last) // 1000, (tick - tick_last) // 10 % 100)
+            tick_last = tick
+        else:
+            timestamp = '%d.%02d' % (tick // 1000, tick // 10 % 100)
+
+        if address == 0:
+            message = '%d records dropped' % struct.unpack_from('<I', arguments)
+            rest = b''
+        else:
+            format = elf.string(address)
+
+            if format is None:
+                # Record lost its sync, resynchronization continues with the next record
+                continue
+
+            message, rest = expand(format, arguments)
+
+        prefix = '# %s <%s> ' % (timestamp, letter)
+
+        print(prefix + message)
+
+        if letter == 'X':
+            for line in dump(rest):
+                print(prefix + line)
+
+        sys.stdout.flush()
+
+
+if __name__ == '__main__':
+    main()
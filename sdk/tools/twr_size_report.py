@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+"""Report flash and RAM used by each SDK module and by the largest symbols from GNU ld map file.
+
+Input sections of the memory map are summed per object file. Objects of sdk/twr are reported as modules (twr_radio,
+twr_log, ...), the rest by their file name and libraries by archive. Flash holds code, constants and initial values
+of data, RAM holds data and zero initialized data. With limits given, exit status is 1 when any of them is exceeded,
+so the report can guard the build.
+
+Usage: twr_size_report.py firmware.map [--symbols 20] [--flash-limit BYTES] [--ram-limit BYTES]
+                          [--module-flash-limit BYTES] [--module-ram-limit BYTES]
+"""
+
+import argparse
+import collections
+import os
+import re
+import sys
+
+# Input section prefixes and where they are placed
+FLASH_SECTIONS = ('.text', '.rodata', '.ARM.exidx', '.ARM.extab', '.isr_vector', '.init', '.fini', '.glue_7')
+LOAD_SECTIONS = ('.data', '.ramfunc')
+RAM_SECTIONS = ('.bss', 'COMMON', '.noinit', '.stack', '.heap')
+
+SECTION = re.compile(r'^ (\S+)(?:\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s+(\S.*))?$')
+CONTINUATION = re.compile(r'^\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s+(\S.*)$')
+
+
+def placement(section):
+    for prefix in FLASH_SECTIONS:
+        if section == prefix or section.startswith(prefix + '.'):
+            return True, False
+
+    for prefix in LOAD_SECTIONS:
+        if section == prefix or section.startswith(prefix + '.'):
+            return True, True
+
+    for prefix in RAM_SECTIONS:
+        if section == prefix or section.startswith(prefix + '.'):
+            return False, True
+
+    return False, False
+
+
+def module(path):
+    match = re.match(r'.*?([^/\\]+\.a)\((.+)\)$', path)
+
+    if match:
+        return match.group(1)
+
+    name = os.path.basename(path)
+
+    for suffix in ('.c.obj', '.s.obj', '.S.obj', '.obj', '.o'):
+        if name.endswith(suffix):
+            return name[:-len(suffix)]
+
+    return name
+
+
+def sections(lines):
+    """Yield input sections (name, address, size, object) of the memory map."""
+    pending = None
+
+    for line in lines:
+        line = line.rstrip('\n')
+
+        if pending is not None:
+            match = CONTINUATION.match(line)
+
+            if match:
+                yield pending, int(match.group(1), 16), int(match.group(2), 16), match.group(3)
+
+            pending = None
+
+            continue
+
+        match = SECTION.match(line)
+
+        if not match or match.group(1) in ('*fill*', 'LOAD', 'OUTPUT'):
+            continue
+
+        if match.group(2) is None:
+            # Long section name, address, size and object follow on the next line
+            pending = match.group(1)
+        else:
+            yield match.group(1), int(match.group(2), 16), int(match.group(3), 16), match.group(4)
+
+
+def parse(stream):
+    modules = collections.defaultdict(lambda: [0, 0])
+    symbols = []
+
+    lines = iter(stream)
+
+    # Input sections before the memory map are discarded ones
+    for line in lines:
+        if line.startswith('Linker script and memory map'):
+            break
+
+    for name, address, size, path in sections(lines):
+        flash, ram = placement(name)
+
+        if size == 0 or address == 0 or not (flash or ram):
+            continue
+
+        entry = modules[module(path)]
+
+        entry[0] += size if flash else 0
+        entry[1] += size if ram else 0
+
+        # With -ffunction-sections and -fdata-sections section is named after its symbol
+        symbol = name.split('.', 2)[2] if name.count('.') >= 2 else '%s (%s)' % (name, module(path))
+
+        symbols.append((size, symbol, module(path), flash, ram))
+
+    return modules, symbols
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Flash and RAM budget per module from GNU ld map file')
+    parser.add_argument('map', help='map file written by linker (-Wl,-Map)')
+    parser.add_argument('--symbols', type=int, default=20, help='number of the largest symbols listed (default 20)')
+    parser.add_argument('--flash-limit', type=int, help='maximum total flash in bytes')
+    parser.add_argument('--ram-limit', type=int, help='maximum total RAM in bytes')
+    parser.add_argument('--module-flash-limit', type=int, help='maximum flash of any module in bytes')
+    parser.add_argument('--module-ram-limit', type=int, help='maximum RAM of any module in bytes')
+    args = parser.parse_args()
+
+    with open(args.map) as stream:
+        modules, symbols = parse(stream)
+
+    flash_total = sum(entry[0] for entry in modules.values())
+    ram_total = sum(entry[1] for entry in modules.values())
+
+    print('%-32s %10s %10s' % ('Module', 'Flash', 'RAM'))
+
+    for name, (flash, ram) in sorted(modules.items(), key=lambda item: (-item[1][0] - item[1][1], item[0])):
+        print('%-32s %10d %10d' % (name, flash, ram))
+
+    print('%-32s %10d %10d' % ('Total', flash_total, ram_total))
+
+    if args.symbols > 0:
+        print()
+        print('%-48s %-24s %8s %s' % ('Symbol', 'Module', 'Size', 'Memory'))
+
+        for size, symbol, name, flash, ram in sorted(symbols, reverse=True)[:args.symbols]:
+            memory = 'flash+RAM' if flash and ram else ('flash' if flash else 'RAM')
+
+            print('%-48s %-24s %8d %s' % (symbol[:48], name[:24], size, memory))
+
+    errors = []
+
+    if args.flash_limit is not None and flash_total > args.flash_limit:
+        errors.append('total flash %d exceeds limit %d' % (flash_total, args.flash_limit))
+
+    if args.ram_limit is not None and ram_total > args.ram_limit:
+        errors.append('total RAM %d exceeds limit %d' % (ram_total, args.ram_limit))
+
+    for name, (flash, ram) in sorted(modules.items()):
+        if args.module_flash_limit is not None and flash > args.module_flash_limit:
+            errors.append('flash %d of %s exceeds limit %d' % (flash, name, args.module_flash_limit))
+
+        if args.module_ram_limit is not None and ram > args.module_ram_limit:
+            errors.append('RAM %d of %s exceeds limit %d' % (ram, name, args.module_ram_limit))
+
+    for error in errors:
+        print('error: ' + error, file=sys.stderr)
+
+    sys.exit(1 if errors else 0)
+
+
+if __name__ == '__main__':
+    main()
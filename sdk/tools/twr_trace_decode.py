@@ -0,0 +1,207 @@
+#!/usr/bin/env python3
+"""Convert stream of twr_trace (TWR_TRACE) to timeline in Trace Event Format.
+
+Packets are read from serial port, file or stdin, timeline is written as JSON array which can be opened
+by chrome://tracing or https://ui.perfetto.dev (array is closed on end of input, viewers accept it unclosed too).
+
+Usage: twr_trace_decode.py [--port /dev/ttyUSB0 [--baudrate 115200] | --input capture.bin] [--output trace.json]
+"""
+
+import argparse
+import binascii
+import json
+import struct
+import sys
+
+SYNC = 0x5a
+RECORD_SIZE = 8
+
+TASK_START = 0
+TASK_END = 1
+ISR_ENTER = 2
+ISR_EXIT = 3
+STATE = 4
+SLEEP = 5
+WAKE = 6
+LOST = 7
+USER = 8
+
+IRQ = {
+    0: 'WWDG', 1: 'PVD', 2: 'RTC', 3: 'FLASH', 4: 'RCC_CRS', 5: 'EXTI0_1', 6: 'EXTI2_3', 7: 'EXTI4_15', 8: 'TSC',
+    9: 'DMA1_Channel1', 10: 'DMA1_Channel2_3', 11: 'DMA1_Channel4_5_6_7', 12: 'ADC1_COMP', 13: 'LPTIM1',
+    14: 'USART4_5', 15: 'TIM2', 16: 'TIM3', 17: 'TIM6_DAC', 18: 'TIM7', 20: 'TIM21', 21: 'I2C3', 22: 'TIM22',
+    23: 'I2C1', 24: 'I2C2', 25: 'SPI1', 26: 'SPI2', 27: 'USART1', 28: 'USART2', 29: 'AES_RNG_LPUART1', 30: 'LCD',
+    31: 'USB'
+}
+
+DRIVER = {0: 'lis2dh12', 1: 'spirit1', 2: 'cmwx1zzabz'}
+
+# Thread of timeline for each kind of event, drivers follow from TID_DRIVER
+TID_TASK = 1
+TID_ISR = 2
+TID_POWER = 3
+TID_USER = 4
+TID_DRIVER = 10
+
+
+def packets(stream, live):
+    buffer = b''
+    end = False
+
+    while not end:
+        chunk = stream.read(64)
+
+        if chunk:
+            buffer += chunk
+        elif live:
+            # Serial port returns nothing on timeout only
+            continue
+        else:
+            end = True
+
+        while True:
+            start = buffer.find(bytes([SYNC]))
+
+            if start < 0:
+                buffer = b''
+                break
+
+            buffer = buffer[start:]
+
+            count = buffer[1] if len(buffer) > 1 else 0
+            size = 2 + count * RECORD_SIZE + 2
+
+            if len(buffer) < size:
+                # Sync byte followed by large count inside data would hold the rest at the end of input
+                if end:
+                    buffer = buffer[1:]
+                    continue
+
+                break
+
+            crc, = struct.unpack_from('<H', buffer, size - 2)
+
+            # Sync byte found inside data, resynchronization continues with the next one
+            if count == 0 or binascii.crc_hqx(buffer[1:size - 2], 0xffff) != crc:
+                buffer = buffer[1:]
+                continue
+
+            yield buffer[2:size - 2]
+
+            buffer = buffer[size:]
+
+
+class Timeline:
+    def __init__(self, output):
+        self.output = output
+        self.first = True
+        self.base = 0
+        self.last = None
+        self.state = {}
+        self.sleep = None
+
+        self.emit({'ph': 'M', 'name': 'process_name', 'pid': 1, 'args': {'name': 'Core Module'}})
+
+        for tid, name in ((TID_TASK, 'Tasks'), (TID_ISR, 'Interrupts'), (TID_POWER, 'Power'), (TID_USER, 'User')):
+            self.emit({'ph': 'M', 'name': 'thread_name', 'pid': 1, 'tid': tid, 'args': {'name': name}})
+
+        for driver, name in DRIVER.items():
+            self.emit({'ph': 'M', 'name': 'thread_name', 'pid': 1, 'tid': TID_DRIVER + driver, 'args': {'name': name}})
+
+    def emit(self, event):
+        self.output.write(('[\n' if self.first else ',\n') + json.dumps(event))
+        self.output.flush()
+
+        self.first = False
+
+    def close(self):
+        self.output.write('[\n]\n' if self.first else '\n]\n')
+
+    def timestamp(self, value):
+        # Timestamps in microseconds wrap after 71 minutes
+        if self.last is not None and value < self.last and self.last - value > 0x80000000:
+            self.base += 0x100000000
+
+        self.last = value
+
+        return self.base + value
+
+    def record(self, record):
+        value, event, id, arg = struct.unpack('<IBBH', record)
+
+        ts = self.timestamp(value)
+
+        if event in (TASK_START, TASK_END):
+            self.emit({'ph': 'B' if event == TASK_START else 'E', 'name': 'task %d' % id, 'pid': 1, 'tid': TID_TASK, 'ts': ts})
+
+        elif event in (ISR_ENTER, ISR_EXIT):
+            name = IRQ.get(id, 'IRQ %d' % id)
+
+            self.emit({'ph': 'B' if event == ISR_ENTER else 'E', 'name': name, 'pid': 1, 'tid': TID_ISR, 'ts': ts})
+
+        elif event == STATE:
+            tid = TID_DRIVER + id
+
+            # Drivers record state on every pass of their state machine, only changes make slices
+            if self.state.get(id) == arg:
+                return
+
+            if id in self.state:
+                self.emit({'ph': 'E', 'pid': 1, 'tid': tid, 'ts': ts})
+
+            self.state[id] = arg
+
+            self.emit({'ph': 'B', 'name': 'state %d' % arg, 'pid': 1, 'tid': tid, 'ts': ts})
+
+        elif event == SLEEP:
+            self.sleep = 'stop' if id else 'sleep'
+
+            self.emit({'ph': 'B', 'name': self.sleep, 'pid': 1, 'tid': TID_POWER, 'ts': ts})
+
+        elif event == WAKE:
+            if self.sleep is not None:
+                self.emit({'ph': 'E', 'pid': 1, 'tid': TID_POWER, 'ts': ts})
+
+            self.sleep = None
+
+        elif event == LOST:
+            self.emit({'ph': 'i', 's': 'g', 'name': '%d records lost' % arg, 'pid': 1, 'ts': ts})
+
+        elif event == USER:
+            self.emit({'ph': 'i', 's': 't', 'name': 'user %d' % id, 'pid': 1, 'tid': TID_USER, 'ts': ts, 'args': {'arg': arg}})
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--port', help='serial port (requires pyserial)')
+    parser.add_argument('--baudrate', type=int, default=115200, help='baudrate of serial port')
+    parser.add_argument('--input', help='file with captured stream (default stdin)')
+    parser.add_argument('--output', help='file for timeline (default stdout)')
+    args = parser.parse_args()
+
+    if args.port:
+        import serial
+
+        stream = serial.Serial(args.port, args.baudrate, timeout=0.1)
+    elif args.input:
+        stream = open(args.input, 'rb')
+    else:
+        stream = sys.stdin.buffer
+
+    output = open(args.output, 'w') if args.output else sys.stdout
+
+    timeline = Timeline(output)
+
+    try:
+        for packet in packets(stream, args.port is not None):
+            for position in range(0, len(packet), RECORD_SIZE):
+                timeline.record(packet[position:position + RECORD_SIZE])
+
+    except KeyboardInterrupt:
+        pass
+
+    timeline.close()
+
+
+if __name__ == '__main__':
+    main()
@@ -86,30 +86,46 @@
 #include <twr_analog_sensor.h>
 #include <twr_atci.h>
 #include <twr_base64.h>
+#include <twr_boot.h>
 #include <twr_chester_a.h>
 #include <twr_config.h>
+#include <twr_coroutine.h>
+#include <twr_data_pipeline.h>
 #include <twr_data_stream.h>
 #include <twr_delay.h>
 #include <twr_dice.h>
 #include <twr_ds18b20.h>
 #include <twr_error.h>
 #include <twr_flood_detector.h>
+#include <twr_fmt.h>
 #include <twr_font_common.h>
 #include <twr_gfx.h>
+#include <twr_hrtick.h>
 #include <twr_image.h>
+#include <twr_kv.h>
+#include <twr_latency.h>
+#include <twr_modbus.h>
 #include <twr_onewire_ds2484.h>
 #include <twr_onewire_gpio.h>
 #include <twr_onewire_relay.h>
 #include <twr_onewire.h>
+#include <twr_payload.h>
+#include <twr_pool.h>
 #include <twr_pulse_counter.h>
 #include <twr_queue.h>
 #include <twr_ramp.h>
+#include <twr_sampler.h>
 #include <twr_sha256.h>
 #include <twr_soil_sensor.h>
+#include <twr_stack.h>
 #include <twr_switch.h>
 #include <twr_system.h>
 #include <twr_timer.h>
+#include <twr_trace.h>
+#include <twr_transport.h>
 #include <twr_usb_cdc.h>
+#include <twr_vibration.h>
+#include <twr_work.h>
 
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 
@@ -8,6 +8,18 @@
 //! @brief Driver for ADC (analog to digital converter)
 //! @{
 
+//! @brief Time in milliseconds for which measured VDDA is reused by asynchronous measurements
+
+#ifndef TWR_ADC_VDDA_CACHE_TIME
+#define TWR_ADC_VDDA_CACHE_TIME (60 * 1000)
+#endif
+
+//! @brief Change of temperature in degrees of Celsius which invalidates measured VDDA
+
+#ifndef TWR_ADC_VDDA_CACHE_TEMPERATURE
+#define TWR_ADC_VDDA_CACHE_TEMPERATURE 5.f
+#endif
+
 //! @brief ADC channel
 
 typedef enum
@@ -145,6 +157,56 @@ bool twr_adc_async_get_value(twr_adc_channel_t channel, uint16_t *result);
 
 bool twr_adc_async_get_voltage(twr_adc_channel_t channel, float *result);
 
+//! @brief Set callback function for scan mode
+//! @param[in] event_handler Function address
+//! @param[in] event_param Optional event parameter (can be NULL)
+
+void twr_adc_scan_set_event_handler(void (*event_handler)(twr_adc_event_t, void *), void *event_param);
+
+//! @brief Begins conversion of several channels in one sequence in asynchronous mode
+//!
+//! Channels are converted in a single ADC power-up together with internal reference, results are moved by DMA
+//! and only one event is fired when the whole sequence is done. Results are then available by
+//! @ref twr_adc_async_get_value and @ref twr_adc_async_get_voltage, VDDA by @ref twr_adc_get_vdda_voltage.
+//! Resolution is always 12 bit, channel event handlers are not called.
+//! @param[in] channel_mask Bit mask of channels, bit n represents ADC channel An
+//! @param[in] oversampling Oversampling applied to every conversion of the sequence
+//! @return true On success
+//! @return false On failure
+
+bool twr_adc_scan_measure(uint8_t channel_mask, twr_adc_oversampling_t oversampling);
+
+//! @brief Start continuous conversion of one channel triggered by timer
+//!
+//! Samples are moved by DMA into the buffer used as double buffer, every completed half is passed to the block
+//! handler from scheduler task while DMA fills the other half. ADC and TIM6 are taken until @ref twr_adc_stream_stop,
+//! other conversions are postponed and DAC channel 0 or IR receiver can not be used at the same time.
+//! Samples are right aligned 12 bit values, channel oversampling is applied and has to fit into sample period.
+//! @param[in] channel ADC channel
+//! @param[in] sample_rate Sample rate in Hz (16 to 1000000, limited in practice by sampling and oversampling time), rate is rounded to 32 MHz divided by integer
+//! @param[in] buffer Buffer for samples
+//! @param[in] length Number of samples in buffer, has to be even
+//! @param[in] block_handler Function called with every completed half of buffer
+//! @param[in] block_param Optional block handler parameter (can be NULL)
+//! @return true On success
+//! @return false When ADC is busy or parameters are invalid
+
+bool twr_adc_stream_start(twr_adc_channel_t channel, uint32_t sample_rate, uint16_t *buffer, size_t length, void (*block_handler)(const uint16_t *, size_t, void *), void *block_param);
+
+//! @brief Stop continuous conversion and run postponed conversions
+
+void twr_adc_stream_stop(void);
+
+//! @brief Block handler feeding samples into data stream
+//!
+//! Pass as block handler to @ref twr_adc_stream_start with data stream instance as parameter. Float data stream
+//! receives voltage in volts, integer data streams receive raw samples.
+//! @param[in] block Samples
+//! @param[in] count Number of samples
+//! @param[in] param Pointer to twr_data_stream_t instance
+
+void twr_adc_stream_feed_data_stream(const uint16_t *block, size_t count, void *param);
+
 //! @brief Get voltage on VDDA pin
 //! @param[out] vdda_voltage Pointer to destination where VDDA will be stored
 //! @return true On valid VDDA
@@ -152,6 +214,15 @@ bool twr_adc_async_get_voltage(twr_adc_channel_t channel, float *result);
 
 bool twr_adc_get_vdda_voltage(float *vdda_voltage);
 
+//! @brief Force measurement of internal reference with the next asynchronous measurement
+
+void twr_adc_vdda_invalidate(void);
+
+//! @brief Report ambient temperature, VDDA is measured again when it moves by @ref TWR_ADC_VDDA_CACHE_TEMPERATURE
+//! @param[in] temperature Temperature in degrees of Celsius
+
+void twr_adc_vdda_set_temperature(float temperature);
+
 //! @brief Calibration
 //! @return true On success
 //! @return false On failure
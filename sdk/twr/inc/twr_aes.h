@@ -18,6 +18,18 @@ typedef uint32_t twr_aes_key_t[TWR_AES_KEYLEN/8/4];
 
 typedef uint32_t twr_aes_iv_t[TWR_AES_IVLEN/8/4];
 
+//! @brief AES event of asynchronous operation
+
+typedef enum
+{
+    //! @brief Operation is done
+    TWR_AES_EVENT_DONE = 0,
+
+    //! @brief DMA transfer failed
+    TWR_AES_EVENT_ERROR = 1
+
+} twr_aes_event_t;
+
 //! @brief Initialize AES
 
 void twr_aes_init(void);
@@ -72,6 +84,67 @@ bool twr_aes_ctwr_encrypt(void *buffer_out, const void *buffer_in, size_t length
 
 bool twr_aes_ctwr_decrypt(void *buffer_out, const void *buffer_in, size_t length, twr_aes_key_t key, twr_aes_iv_t iv);
 
+//! @brief AES encryption Electronic CodeBook (ECB) by DMA in background
+//!
+//! Blocks are moved between buffers and AES peripheral by two DMA channels, which are allocated for the operation
+//! and released before the event handler is called from scheduler task. Buffers must stay valid until then, other
+//! AES functions fail while the operation is in progress. Core sleeps meanwhile, stop mode is held off since DMA
+//! does not run in it.
+//! @param[out] buffer_out Pointer to destination buffer (4 B aligned)
+//! @param[in] buffer_in Pointer to source buffer (4 B aligned)
+//! @param[in] length Number of bytes (multiple of 16)
+//! @param[in] key 128-bit encryption key
+//! @param[in] event_handler Function called on completion (can be NULL)
+//! @param[in] event_param Optional event parameter (can be NULL)
+//! @return true If operation has been started
+//! @return false When other operation is in progress, buffers are not aligned or DMA channel is not free
+
+bool twr_aes_ecb_encrypt_async(void *buffer_out, const void *buffer_in, size_t length, const twr_aes_key_t key, void (*event_handler)(twr_aes_event_t, void *), void *event_param);
+
+//! @brief AES decryption Electronic CodeBook (ECB) by DMA in background, see @ref twr_aes_ecb_encrypt_async
+//! @param[out] buffer_out Pointer to destination buffer (4 B aligned)
+//! @param[in] buffer_in Pointer to source buffer (4 B aligned)
+//! @param[in] length Number of bytes (multiple of 16)
+//! @param[in] key 128-bit decryption key
+//! @param[in] event_handler Function called on completion (can be NULL)
+//! @param[in] event_param Optional event parameter (can be NULL)
+//! @return true If operation has been started
+//! @return false When other operation is in progress, buffers are not aligned or DMA channel is not free
+
+bool twr_aes_ecb_decrypt_async(void *buffer_out, const void *buffer_in, size_t length, const twr_aes_key_t key, void (*event_handler)(twr_aes_event_t, void *), void *event_param);
+
+//! @brief AES Cipher block chaining (CBC) encryption by DMA in background, see @ref twr_aes_ecb_encrypt_async
+//! @param[out] buffer_out Pointer to destination buffer (4 B aligned)
+//! @param[in] buffer_in Pointer to source buffer (4 B aligned)
+//! @param[in] length Number of bytes (multiple of 16)
+//! @param[in] key 128-bit encryption key
+//! @param[in] iv 128-bit Initialization vector
+//! @param[in] event_handler Function called on completion (can be NULL)
+//! @param[in] event_param Optional event parameter (can be NULL)
+//! @return true If operation has been started
+//! @return false When other operation is in progress, buffers are not aligned or DMA channel is not free
+
+bool twr_aes_ctwr_encrypt_async(void *buffer_out, const void *buffer_in, size_t length, const twr_aes_key_t key, const twr_aes_iv_t iv, void (*event_handler)(twr_aes_event_t, void *), void *event_param);
+
+//! @brief AES Cipher block chaining (CBC) decryption by DMA in background, see @ref twr_aes_ecb_encrypt_async
+//! @param[out] buffer_out Pointer to destination buffer (4 B aligned)
+//! @param[in] buffer_in Pointer to source buffer (4 B aligned)
+//! @param[in] length Number of bytes (multiple of 16)
+//! @param[in] key 128-bit decryption key
+//! @param[in] iv 128-bit Initialization vector
+//! @param[in] event_handler Function called on completion (can be NULL)
+//! @param[in] event_param Optional event parameter (can be NULL)
+//! @return true If operation has been started
+//! @return false When other operation is in progress, buffers are not aligned or DMA channel is not free
+
+bool twr_aes_ctwr_decrypt_async(void *buffer_out, const void *buffer_in, size_t length, const twr_aes_key_t key, const twr_aes_iv_t iv, void (*event_handler)(twr_aes_event_t, void *), void *event_param);
+
+//! @brief Check if asynchronous operation is in progress
+//! @return true If operation is in progress
+//! @return false If AES is free
+
+bool twr_aes_is_busy(void);
+
 //! @brief Create key from uint8 array
 //! @param[out] key key 128-bit encryption key
 //! @param[in] buffer Pointer to source buffer
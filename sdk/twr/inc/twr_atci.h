@@ -11,6 +11,28 @@
 #define TWR_ATCI_UART TWR_UART_UART2
 #endif
 
+//! @brief Maximum number of commands sorted for binary search at initialization (0 disables index, lookup is linear)
+
+#ifndef TWR_ATCI_INDEX_SIZE
+#define TWR_ATCI_INDEX_SIZE 64
+#endif
+
+//! @brief Time in milliseconds after which unfinished binary transfer is cancelled
+
+#ifndef TWR_ATCI_BINARY_TIMEOUT
+#define TWR_ATCI_BINARY_TIMEOUT 1000
+#endif
+
+//! @brief Interval in milliseconds of polling input of transport set by twr_atci_set_transport
+
+#ifndef TWR_ATCI_POLL_INTERVAL
+#define TWR_ATCI_POLL_INTERVAL 20
+#endif
+
+//! @brief Start byte of binary frame
+
+#define TWR_ATCI_BINARY_START 0x02
+
 #define TWR_ATCI_COMMANDS_LENGTH(COMMANDS) (sizeof(COMMANDS) / sizeof(COMMANDS[0]))
 
 #define TWR_ATCI_COMMAND_CLAC {"+CLAC", twr_atci_clac_action, NULL, NULL, NULL, "List all available AT commands"}
@@ -43,6 +65,21 @@ typedef struct
 
 void twr_atci_init(const twr_atci_command_t *commands, int length);
 
+//! @brief Use transport instead of UART, e.g. USB CDC, call after initialization
+//! @param[in] transport Transport for output (see @ref twr_usb_cdc_get_transport_driver)
+//! @param[in] read Function reading available input without blocking (e.g. twr_usb_cdc_read), polled every TWR_ATCI_POLL_INTERVAL
+
+void twr_atci_set_transport(twr_transport_t *transport, size_t (*read)(void *buffer, size_t length));
+
+//! @brief Set interval of polling input of transport
+//! @param[in] interval Interval in milliseconds, TWR_TICK_INFINITY when input is signalled by @ref twr_atci_receive
+
+void twr_atci_set_poll_interval(twr_tick_t interval);
+
+//! @brief Process input of transport now, e.g. from its receive event
+
+void twr_atci_receive(void);
+
 //! @brief Write OK
 
 void twr_atci_write_ok(void);
@@ -84,10 +121,53 @@ size_t twr_atci_printfln(const char *format, ...);
 
 size_t twr_atci_print_buffer_as_hex(const void *buffer, size_t length);
 
+//! @brief Send binary frame
+//!
+//! Frame is | 0x02 | length (2 B) | data (length B) | CRC32 of data (4 B) |, multi-byte values little endian.
+//! Use in callback in twr_atci_command_t, response OK or ERROR follows the frame.
+//! @param[in] buffer Pointer to source buffer
+//! @param[in] length Number of bytes to be sent (up to 65535)
+//! @return Number of bytes written including framing
+
+size_t twr_atci_binary_send(const void *buffer, size_t length);
+
+//! @brief Receive binary frame after response of current command
+//!
+//! Frame has the same format as in @ref twr_atci_binary_send, bytes before its start byte are ignored.
+//! Response OK is written when frame with valid CRC is received and handler returns true, ERROR otherwise,
+//! also when frame does not fit into buffer or does not complete within @ref TWR_ATCI_BINARY_TIMEOUT.
+//! @param[out] buffer Pointer to destination buffer
+//! @param[in] size Size of destination buffer
+//! @param[in] handler Function called with received data
+//! @param[in] param Optional handler parameter (can be NULL)
+//! @return true On success
+//! @return false When other binary transfer is pending
+
+bool twr_atci_binary_receive(void *buffer, size_t size, bool (*handler)(const void *buffer, size_t length, void *param), void *param);
+
 //! @brief Skip response, use in callback in twr_atci_command_t
 
 bool twr_atci_skip_response(void);
 
+//! @brief Make response pending, use in callback in twr_atci_command_t of long-running command
+//!
+//! Command continues in task, prints its result and ends by @ref twr_atci_complete. Input is not processed
+//! meanwhile, lines received in the meantime wait in receive buffer of UART or transport.
+//! @return true Always, to be returned by callback
+
+bool twr_atci_pending(void);
+
+//! @brief Complete pending command by writing OK or ERROR and continue with processing of input
+//! @param[in] ok Result of command
+
+void twr_atci_complete(bool ok);
+
+//! @brief Check if response of command is pending
+//! @return true When response is pending
+//! @return false Otherwise
+
+bool twr_atci_is_pending(void);
+
 //! @brief Helper for clac action
 
 bool twr_atci_clac_action(void);
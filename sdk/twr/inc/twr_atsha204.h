@@ -91,6 +91,13 @@ bool twr_atsha204_read_serial_number(twr_atsha204_t *self);
 
 bool twr_atsha204_get_serial_number(twr_atsha204_t *self, void *destination, size_t size);
 
+//! @brief Check presence of chip by its wake-up response (blocking, takes about 1 ms)
+//! @param[in] self Instance
+//! @return true When chip responds
+//! @return false When chip does not respond or command is in progress
+
+bool twr_atsha204_is_present(twr_atsha204_t *self);
+
 //! @}
 
 #endif // _TWR_ATSHA204_H
@@ -7,6 +7,20 @@
 //! @brief BASE64
 //! @{
 
+//! @cond
+
+typedef struct
+{
+    uint32_t _bits;
+    uint8_t _count;
+    uint8_t _quantum;
+    bool _end;
+    bool _error;
+
+} twr_base64_t;
+
+//! @endcond
+
 //! @brief BASE64 encode
 //! @param[out] output Pointer to destination buffer
 //! @param[in,out] output_length Size of destination buffer, Number of used bytes
@@ -38,6 +52,53 @@ size_t twr_base64_calculate_encode_length(size_t length);
 
 size_t twr_base64_calculate_decode_length(char *input, size_t length);
 
+//! @brief Initialize context of streaming encoder or decoder
+//! @param[in] self Context
+
+void twr_base64_init(twr_base64_t *self);
+
+//! @brief BASE64 encode chunk of stream
+//!
+//! Up to two input bytes are kept in context until they form a group. Output is not null terminated. When output
+//! buffer gets full, the rest of input is not consumed and has to be passed again.
+//! @param[in] self Context
+//! @param[out] output Pointer to destination buffer
+//! @param[in,out] output_length Size of destination buffer, Number of used bytes
+//! @param[in] input Pointer to source buffer
+//! @param[in] input_length Number of bytes
+//! @return Number of consumed input bytes
+
+size_t twr_base64_encode_update(twr_base64_t *self, char *output, size_t *output_length, const uint8_t *input, size_t input_length);
+
+//! @brief BASE64 encode end of stream, remaining bytes are written with padding and context is initialized again
+//! @param[in] self Context
+//! @param[out] output Pointer to destination buffer (up to 4 bytes are written)
+//! @param[in,out] output_length Size of destination buffer, Number of used bytes
+//! @return true On success
+//! @return false When output buffer is too small
+
+bool twr_base64_encode_final(twr_base64_t *self, char *output, size_t *output_length);
+
+//! @brief BASE64 decode chunk of stream
+//!
+//! Whitespace and line breaks are skipped and padding ends the stream. Output is not null terminated. When output
+//! buffer gets full or invalid character is found, the rest of input is not consumed.
+//! @param[in] self Context
+//! @param[out] output Pointer to destination buffer
+//! @param[in,out] output_length Size of destination buffer, Number of used bytes
+//! @param[in] input Pointer to source buffer
+//! @param[in] input_length Number of bytes
+//! @return Number of consumed input bytes
+
+size_t twr_base64_decode_update(twr_base64_t *self, uint8_t *output, size_t *output_length, const char *input, size_t input_length);
+
+//! @brief BASE64 decode end of stream, context is initialized again
+//! @param[in] self Context
+//! @return true When stream was valid
+//! @return false When invalid character was found or stream was truncated
+
+bool twr_base64_decode_final(twr_base64_t *self);
+
 //! @}
 
 #endif // _TWR_BASE64_H
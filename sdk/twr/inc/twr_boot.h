@@ -0,0 +1,68 @@
+#ifndef _TWR_BOOT_H
+#define _TWR_BOOT_H
+
+#include <twr_scheduler.h>
+
+//! @addtogroup twr_boot twr_boot
+//! @brief Deferred boot steps run by scheduler
+//!
+//! Bring-up of peripherals is split into steps, every step runs once its delay has elapsed after the step it depends
+//! on has finished (or after registration for step without predecessor). Independent chains interleave with each
+//! other and with other tasks, so boot takes as long as the longest chain instead of the sum of all steps.
+//! @{
+
+//! @brief Maximum number of boot steps
+
+#ifndef TWR_BOOT_STEPS_MAX
+#define TWR_BOOT_STEPS_MAX 8
+#endif
+
+//! @brief ID of no step
+
+#define TWR_BOOT_STEP_NONE -1
+
+//! @brief Timing of boot step
+
+typedef struct
+{
+    //! @brief Name of step
+    const char *name;
+
+    //! @brief Tick at which step has been run (0 while waiting)
+    twr_tick_t tick_start;
+
+    //! @brief Duration of step in microseconds
+    uint32_t duration;
+
+} twr_boot_timing_t;
+
+//! @brief Register boot step
+//! @param[in] name Name of step in boot report
+//! @param[in] step Function of step
+//! @param[in] param Parameter of step
+//! @param[in] after ID of step which has to finish first or TWR_BOOT_STEP_NONE
+//! @param[in] delay Delay in milliseconds after the preceding step has finished
+//! @return ID of step or TWR_BOOT_STEP_NONE when all steps are taken
+
+int twr_boot_register(const char *name, void (*step)(void *), void *param, int after, twr_tick_t delay);
+
+//! @brief Check whether all registered steps have been run
+//! @return true When boot is complete
+
+bool twr_boot_is_done(void);
+
+//! @brief Get timing of boot step
+//! @param[in] id ID of step
+//! @param[out] timing Pointer to timing
+//! @return true On success
+//! @return false When no step is registered under ID
+
+bool twr_boot_get_timing(int id, twr_boot_timing_t *timing);
+
+//! @brief Print boot report through twr_log, every step and tick at which the last one has finished
+
+void twr_boot_log(void);
+
+//! @}
+
+#endif // _TWR_BOOT_H
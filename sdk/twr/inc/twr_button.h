@@ -4,6 +4,7 @@
 #include <twr_gpio.h>
 #include <twr_tick.h>
 #include <twr_scheduler.h>
+#include <twr_exti.h>
 
 //! @addtogroup twr_button twr_button
 //! @brief Driver for generic button
@@ -27,10 +28,20 @@ typedef enum
 
 } twr_button_event_t;
 
+//! @brief Maximum number of buttons in group
+
+#ifndef TWR_BUTTON_GROUP_SIZE
+#define TWR_BUTTON_GROUP_SIZE 4
+#endif
+
 //! @brief Button instance
 
 typedef struct twr_button_t twr_button_t;
 
+//! @brief Button group instance
+
+typedef struct twr_button_group_t twr_button_group_t;
+
 //! @brief Button driver interface
 
 typedef struct
@@ -41,6 +52,9 @@ typedef struct
     //! @brief Callback for reading input state
     int (*get_input)(twr_button_t *self);
 
+    //! @brief Optional callback for reading input state of all channels at once (bit per virtual channel), used by group
+    uint32_t (*get_input_mask)(twr_button_t *self);
+
 } twr_button_driver_t;
 
 //! @cond
@@ -69,6 +83,16 @@ struct twr_button_t
     twr_tick_t _tick_hold_threshold;
     int _state;
     bool _hold_signalized;
+    bool _interrupt;
+    twr_button_group_t *_group;
+    twr_scheduler_task_id_t _task_id;
+};
+
+struct twr_button_group_t
+{
+    twr_button_t *_button[TWR_BUTTON_GROUP_SIZE];
+    int _count;
+    twr_tick_t _scan_interval;
     twr_scheduler_task_id_t _task_id;
 };
 
@@ -121,6 +145,41 @@ void twr_button_set_click_timeout(twr_button_t *self, twr_tick_t click_timeout);
 
 void twr_button_set_hold_time(twr_button_t *self, twr_tick_t hold_time);
 
+//! @brief Enable or disable interrupt mode (GPIO button only)
+//!
+//! Input is sampled only from the edge signalled by EXTI until the button settles, i.e. it is released or hold
+//! has been recognized. Scan task is dormant meanwhile, so idle button does not wake MCU. EXTI line of channel is
+//! shared by pins with the same number on all ports, it must not be used by other driver.
+//! @param[in] self Instance
+//! @param[in] enable Enable interrupt mode
+//! @return true On success
+//! @return false When button is virtual or GPIO channel has no EXTI line
+
+bool twr_button_set_interrupt(twr_button_t *self, bool enable);
+
+//! @brief Initialize button group
+//!
+//! Buttons added to group are scanned by single task of group instead of their own ones. Input of buttons with the
+//! same driver providing get_input_mask is read once per scan, e.g. one I2C transaction for all buttons behind
+//! expander. Group is dormant when all of its buttons are in interrupt mode and settled.
+//! @param[in] self Instance
+
+void twr_button_group_init(twr_button_group_t *self);
+
+//! @brief Add initialized button to group, scan interval of button is replaced by the one of group
+//! @param[in] self Instance
+//! @param[in] button Button instance
+//! @return true On success
+//! @return false When group is full or button is already in group
+
+bool twr_button_group_add(twr_button_group_t *self, twr_button_t *button);
+
+//! @brief Set scan interval of group
+//! @param[in] self Instance
+//! @param[in] scan_interval Desired scan interval in ticks
+
+void twr_button_group_set_scan_interval(twr_button_group_t *self, twr_tick_t scan_interval);
+
 //! @}
 
 #endif // _TWR_BUTTON_H
@@ -4,6 +4,7 @@
 #include <twr_scheduler.h>
 #include <twr_gpio.h>
 #include <twr_uart.h>
+#include <twr_payload.h>
 
 //! @addtogroup twr_cmwx1zzabz twr_cmwx1zzabz
 //! @brief Driver for CMWX1ZZABZ muRata LoRa modem
@@ -21,6 +22,24 @@
 
 //! @endcond
 
+//! @brief Timeout of response to AT command in milliseconds, response is processed as soon as it is received
+
+#ifndef TWR_CMWX1ZZABZ_TIMEOUT_COMMAND_RESPONSE
+#define TWR_CMWX1ZZABZ_TIMEOUT_COMMAND_RESPONSE 500
+#endif
+
+//! @brief Timeout of link check answer in milliseconds
+
+#ifndef TWR_CMWX1ZZABZ_TIMEOUT_LNCHECK
+#define TWR_CMWX1ZZABZ_TIMEOUT_LNCHECK 20000
+#endif
+
+//! @brief Timeout of join in milliseconds
+
+#ifndef TWR_CMWX1ZZABZ_TIMEOUT_JOIN
+#define TWR_CMWX1ZZABZ_TIMEOUT_JOIN 120000
+#endif
+
 //! @brief Callback events
 
 typedef enum
@@ -291,6 +310,7 @@ struct twr_cmwx1zzabz_t
     bool _save_flag;
     uint32_t _save_config_mask;
     twr_cmwx1zzabz_config _config;
+    bool _config_cached;
     bool _join_command;
     bool _link_check_command;
     bool _custom_command;
@@ -362,6 +382,16 @@ bool twr_cmwx1zzabz_send_message(twr_cmwx1zzabz_t *self, const void *buffer, siz
 
 bool twr_cmwx1zzabz_send_message_confirmed(twr_cmwx1zzabz_t *self, const void *buffer, size_t length);
 
+//! @brief Pack values by schema and send them as binary LoRa message
+//! @param[in] self Instance
+//! @param[in] schema Pointer to schema of payload
+//! @param[in] value Pointer to array of values, one for every field of schema (NAN when not available)
+//! @param[in] confirmed Send confirmed message
+//! @return true If command was accepted for processing
+//! @return false If command was denied for processing or payload does not fit into message
+
+bool twr_cmwx1zzabz_send_payload(twr_cmwx1zzabz_t *self, const twr_payload_schema_t *schema, const float *value, bool confirmed);
+
 //! @brief Set DEVADDR
 //! @param[in] self Instance
 //! @param[in] devaddr Pointer to 8 character string
@@ -7,6 +7,34 @@
 //! @brief Library for saving and loading configuration to EEPROM
 //! @{
 
+//! @brief Number of slots configuration rotates through to spread wear of EEPROM
+//!
+//! Every slot keeps the configuration in three banks from start of EEPROM. With more slots save writes the next
+//! slot with higher sequence number only when configuration changed and load takes the valid slot with the highest
+//! one, so the previous configuration is kept until the new one is complete.
+
+#ifndef TWR_CONFIG_SLOTS
+#define TWR_CONFIG_SLOTS 1
+#endif
+
+//! @brief Integrity check of configuration by truncated SHA256
+
+#define TWR_CONFIG_INTEGRITY_SHA256 0
+
+//! @brief Integrity check of configuration by CRC32 (CRC peripheral unless TWR_CRC_HARDWARE is 0)
+
+#define TWR_CONFIG_INTEGRITY_CRC32 1
+
+//! @brief Integrity check of configuration
+//!
+//! CRC32 is much cheaper on load and save and is enough to detect torn or corrupted writes, SHA256 is kept as
+//! default for compatibility with stored configurations. Change of integrity check invalidates stored configuration,
+//! which is then reset to init_config.
+
+#ifndef TWR_CONFIG_INTEGRITY
+#define TWR_CONFIG_INTEGRITY TWR_CONFIG_INTEGRITY_SHA256
+#endif
+
 //! @brief Initialize and load the config from EEPROM
 //! @param[in] signature Any number specifying current configuration version.
 //! @param[in] config Pointer to configuration structure
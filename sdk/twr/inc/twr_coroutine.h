@@ -0,0 +1,106 @@
+#ifndef _TWR_COROUTINE_H
+#define _TWR_COROUTINE_H
+
+#include <twr_scheduler.h>
+#include <twr_i2c.h>
+
+//! @addtogroup twr_coroutine twr_coroutine
+//! @brief Stackless coroutines running as scheduler tasks
+//!
+//! Task function is written as straight sequence of steps between @ref TWR_COROUTINE_BEGIN and @ref TWR_COROUTINE_END,
+//! each waiting macro returns from task and the next run of task resumes right after it. Resume point is kept as
+//! line number in @ref twr_coroutine_t, so local variables are not preserved across waits (keep state in instance)
+//! and waiting macros cannot be used inside switch statement of coroutine body.
+//! @{
+
+//! @brief Coroutine state, has to be zeroed before first run (e.g. by memset of instance)
+
+typedef struct
+{
+    //! @cond
+
+    uint16_t _line;
+    bool _pending;
+    bool _result;
+    twr_scheduler_task_id_t _task_id;
+
+    //! @endcond
+
+} twr_coroutine_t;
+
+//! @brief Start of coroutine body, unknown resume point starts from beginning
+//! @param[in] co Pointer to coroutine state
+
+#define TWR_COROUTINE_BEGIN(co) switch ((co)->_line) { case 0: default:
+
+//! @brief End of coroutine body, next run of task starts from beginning
+//! @param[in] co Pointer to coroutine state
+
+#define TWR_COROUTINE_END(co) } (co)->_line = 0; return
+
+//! @brief Return from task and continue from beginning in the next run (without planning task)
+//! @param[in] co Pointer to coroutine state
+
+#define TWR_COROUTINE_RESTART(co) do { (co)->_line = 0; return; } while (0)
+
+//! @brief Return from task and continue when task is planned or signalled by someone else
+//! @param[in] co Pointer to coroutine state
+
+#define TWR_COROUTINE_SUSPEND(co) do { (co)->_line = __LINE__; return; case __LINE__:; } while (0)
+
+//! @brief Let other tasks run and continue in the next spin
+//! @param[in] co Pointer to coroutine state
+
+#define TWR_COROUTINE_YIELD(co) do { twr_scheduler_plan_current_now(); TWR_COROUTINE_SUSPEND(co); } while (0)
+
+//! @brief Continue after given time from now
+//! @param[in] co Pointer to coroutine state
+//! @param[in] ms Time in milliseconds
+
+#define TWR_COROUTINE_WAIT_MS(co, ms) do { twr_scheduler_plan_current_from_now(ms); TWR_COROUTINE_SUSPEND(co); } while (0)
+
+//! @brief Continue at absolute tick
+//! @param[in] co Pointer to coroutine state
+//! @param[in] tick Tick at which coroutine continues
+
+#define TWR_COROUTINE_WAIT_TICK(co, tick) do { twr_scheduler_plan_current_absolute(tick); TWR_COROUTINE_SUSPEND(co); } while (0)
+
+//! @brief Continue once condition is true, condition is evaluated whenever task is planned or signalled (e.g. by event)
+//! @param[in] co Pointer to coroutine state
+//! @param[in] condition Condition expression
+
+#define TWR_COROUTINE_WAIT_EVENT(co, condition) do { (co)->_line = __LINE__; case __LINE__: if (!(condition)) { return; } } while (0)
+
+//! @brief Submit asynchronous I2C transaction and continue once it is finished, result is given by @ref twr_coroutine_get_result
+//!
+//! Event handler and parameter of transaction are used by coroutine, transaction has to stay valid until it is finished.
+//! Transaction on TWR_I2C_I2C_1W is transferred blocking without returning from task.
+//! @param[in] co Pointer to coroutine state
+//! @param[in] channel I2C channel
+//! @param[in] transaction Pointer to transaction descriptor
+
+#define TWR_COROUTINE_AWAIT_I2C(co, channel, transaction) \
+    do { \
+        if (!_twr_coroutine_i2c_submit((co), (channel), (transaction))) { break; } \
+        TWR_COROUTINE_WAIT_EVENT(co, !(co)->_pending); \
+    } while (0)
+
+//! @brief Get result of the last awaited operation
+//! @param[in] co Pointer to coroutine state
+//! @return true On success
+//! @return false On failure
+
+static inline bool twr_coroutine_get_result(twr_coroutine_t *co)
+{
+    return co->_result;
+}
+
+//! @cond
+
+bool _twr_coroutine_i2c_submit(twr_coroutine_t *co, twr_i2c_channel_t channel, twr_i2c_async_t *transaction);
+
+//! @endcond
+
+//! @}
+
+#endif // _TWR_COROUTINE_H
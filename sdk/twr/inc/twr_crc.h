@@ -5,8 +5,17 @@
 
 //! @addtogroup twr_crc twr_crc
 //! @brief Calculate crc
+//!
+//! CRC is calculated by CRC peripheral, which must not be used from interrupt at the same time, or by table-driven
+//! software implementation when TWR_CRC_HARDWARE is 0.
 //! @{
 
+//! @brief Calculate CRC by CRC peripheral
+
+#ifndef TWR_CRC_HARDWARE
+#define TWR_CRC_HARDWARE 1
+#endif
+
 //! @brief Calculate CRC8
 //! @param[in] polynomial
 //! @param[in] buffer Data buffer
@@ -16,6 +25,29 @@
 
 uint8_t twr_crc8(const uint8_t polynomial, const void *buffer, size_t length, const uint8_t initialization);
 
+//! @brief Calculate CRC16, data are processed MSB first without final XOR (CRC-16/CCITT-FALSE with 0x1021 and 0xffff)
+//! @param[in] polynomial
+//! @param[in] buffer Data buffer
+//! @param[in] length Data buffer length
+//! @param[in] initialization data
+//! @return crc
+
+uint16_t twr_crc16(const uint16_t polynomial, const void *buffer, size_t length, const uint16_t initialization);
+
+//! @brief Calculate CRC32 as used by Ethernet, zlib and PNG (reflected 0x04c11db7, initialized and inverted by 0xffffffff)
+//! @param[in] buffer Data buffer
+//! @param[in] length Data buffer length
+//! @return crc
+
+uint32_t twr_crc32(const void *buffer, size_t length);
+
+//! @brief Calculate CRC16 as used by Modbus RTU (reflected 0x8005, initialized by 0xffff)
+//! @param[in] buffer Data buffer
+//! @param[in] length Data buffer length
+//! @return crc (transmitted low byte first, zero over frame including its CRC)
+
+uint16_t twr_crc16_modbus(const void *buffer, size_t length);
+
 //! @}
 
 #endif // _TWR_CRC_H
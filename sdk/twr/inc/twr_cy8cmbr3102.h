@@ -3,6 +3,7 @@
 
 #include <twr_i2c.h>
 #include <twr_scheduler.h>
+#include <twr_exti.h>
 
 //! @addtogroup twr_cy8cmbr3102 twr_cy8cmbr3102
 //! @brief Driver for CY8CMBR3102
@@ -20,6 +21,24 @@ typedef enum
 
 } twr_cy8cmbr3102_event_t;
 
+//! @brief Status registers read by one burst
+
+typedef struct
+{
+    //! @brief Button status, bit per sensor
+    uint16_t button;
+
+    //! @brief Buttons touched since previous read
+    uint16_t latched_button;
+
+    //! @brief Proximity status, bit per sensor
+    uint8_t proximity;
+
+    //! @brief Proximity detected since previous read
+    uint8_t latched_proximity;
+
+} twr_cy8cmbr3102_status_t;
+
 //! @brief TCA9534A instance
 
 typedef struct twr_cy8cmbr3102_t twr_cy8cmbr3102_t;
@@ -46,6 +65,8 @@ struct twr_cy8cmbr3102_t
     twr_cy8cmbr3102_state_t _state;
     twr_tick_t _scan_interval;
     int _error_cnt;
+    bool _wake_on_event;
+    twr_cy8cmbr3102_status_t _status;
 };
 
 //! @endcond
@@ -70,6 +91,29 @@ void twr_cy8cmbr3102_set_event_handler(twr_cy8cmbr3102_t *self, void (*event_han
 
 void twr_cy8cmbr3102_set_scan_interval(twr_cy8cmbr3102_t *self, twr_tick_t scan_interval);
 
+//! @brief Read status on falling edge of HI (host interrupt) pin instead of scanning periodically
+//!
+//! Controller pulls HI low on every change of status, so I2C is idle between touches. Each interrupt reads button,
+//! proximity and latched statuses by one burst, latched statuses keep short touches. It cannot be switched back.
+//! @param[in] self Instance
+//! @param[in] line EXTI line of HI pin
+
+void twr_cy8cmbr3102_set_wake_on_event(twr_cy8cmbr3102_t *self, twr_exti_line_t line);
+
+//! @brief Read all status registers by one burst, latched statuses are cleared by reading
+//! @param[in] self Instance
+//! @param[out] status Status
+//! @return true On success
+//! @return false On failure
+
+bool twr_cy8cmbr3102_read_status(twr_cy8cmbr3102_t *self, twr_cy8cmbr3102_status_t *status);
+
+//! @brief Get status from the last read done by driver
+//! @param[in] self Instance
+//! @param[out] status Status
+
+void twr_cy8cmbr3102_get_status(twr_cy8cmbr3102_t *self, twr_cy8cmbr3102_status_t *status);
+
 //! @brief Get proximity (Capacitive sensor difference count signal.)
 //! @param[in] self Instance
 //! @param[out] value
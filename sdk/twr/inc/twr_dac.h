@@ -126,10 +126,21 @@ void twr_dac_set_event_handler(twr_dac_channel_t channel, void (*event_handler)(
 //! @param[in] sample_rate Data sample rate
 //! @param[in] mode DAC channel DMA mode
 //! @return true On success
-//! @return false On failure (if DAC channel operation is in progress)
+//! @return false On failure (if DAC channel operation is in progress or its DMA channel is allocated by other driver)
 
 bool twr_dac_async_config(twr_dac_channel_t channel, twr_dac_config_t *config);
 
+//! @brief Set sample rate of asynchronous DAC channel operation instead of the one given by configuration
+//!
+//! Samples are moved by DMA on update event of timer (TIM6 for DAC0, TIM7 for DAC1) clocked by PLL, so the rate does not
+//! depend on scheduler or CPU load. The period is rounded to 1/32 us. TIM6 is shared with ADC streaming.
+//! @param[in] channel DAC channel
+//! @param[in] sample_rate Sample rate in Hz (from 1 Hz to 1 MHz)
+//! @return true On success
+//! @return false If sample rate is out of range or DAC channel operation is in progress
+
+bool twr_dac_async_set_sample_rate(twr_dac_channel_t channel, uint32_t sample_rate);
+
 //! @brief Start asynchronous DAC channel operation
 //! @param[in] channel DAC channel
 //! @return true On success
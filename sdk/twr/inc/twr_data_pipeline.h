@@ -0,0 +1,114 @@
+#ifndef _TWR_DATA_PIPELINE_H
+#define _TWR_DATA_PIPELINE_H
+
+#include <twr_data_stream.h>
+#include <twr_tick.h>
+
+//! @addtogroup twr_data_pipeline twr_data_pipeline
+//! @brief Filtering stages for building sensor to publish pipelines
+//!
+//! Every stage keeps constant state, takes one value at a time and passes its output to the event handler
+//! and to the next stage. Stages are chained by @ref twr_data_pipeline_set_next, NAN fed to a stage resets it
+//! and all stages behind it.
+//! @{
+
+//! @brief Pipeline stage type
+
+typedef enum
+{
+    //! @brief Exponential moving average, outputs every value
+    TWR_DATA_PIPELINE_TYPE_EWMA = 0,
+
+    //! @brief Decimation, outputs every n-th value
+    TWR_DATA_PIPELINE_TYPE_DECIMATE = 1,
+
+    //! @brief Delta compression, outputs value only when it changes significantly or interval expires
+    TWR_DATA_PIPELINE_TYPE_DELTA = 2
+
+} twr_data_pipeline_type_t;
+
+//! @brief Pipeline stage instance
+
+typedef struct twr_data_pipeline_t twr_data_pipeline_t;
+
+//! @cond
+
+struct twr_data_pipeline_t
+{
+    twr_data_pipeline_type_t _type;
+    float _alpha;
+    float _threshold;
+    int _factor;
+    twr_tick_t _interval;
+    float _value;
+    int _counter;
+    twr_tick_t _tick_timeout;
+    void (*_event_handler)(twr_data_pipeline_t *, float, void *);
+    void *_event_param;
+    twr_data_pipeline_t *_next;
+};
+
+//! @endcond
+
+//! @brief Initialize exponential moving average stage
+//! @param[in] self Instance
+//! @param[in] alpha Weight of new value (0 to 1)
+
+void twr_data_pipeline_init_ewma(twr_data_pipeline_t *self, float alpha);
+
+//! @brief Initialize decimation stage
+//! @param[in] self Instance
+//! @param[in] factor Number of values per output value
+
+void twr_data_pipeline_init_decimate(twr_data_pipeline_t *self, int factor);
+
+//! @brief Initialize delta compression stage
+//! @param[in] self Instance
+//! @param[in] threshold Minimal change from the last output value which is passed
+//! @param[in] interval Maximal time between output values (TWR_TICK_INFINITY to pass changes only)
+
+void twr_data_pipeline_init_delta(twr_data_pipeline_t *self, float threshold, twr_tick_t interval);
+
+//! @brief Set callback function called with every output value
+//! @param[in] self Instance
+//! @param[in] event_handler Function address
+//! @param[in] event_param Optional event parameter (can be NULL)
+
+void twr_data_pipeline_set_event_handler(twr_data_pipeline_t *self, void (*event_handler)(twr_data_pipeline_t *, float, void *), void *event_param);
+
+//! @brief Set stage fed by output of this stage
+//! @param[in] self Instance
+//! @param[in] next Next stage (can be NULL)
+
+void twr_data_pipeline_set_next(twr_data_pipeline_t *self, twr_data_pipeline_t *next);
+
+//! @brief Feed value into stage
+//! @param[in] self Instance
+//! @param[in] value Input value, NAN resets the pipeline from this stage
+
+void twr_data_pipeline_feed(twr_data_pipeline_t *self, float value);
+
+//! @brief Feed the last value of data stream into stage
+//! @param[in] self Instance
+//! @param[in] stream Data stream, fixed-point samples are converted by their fractional bits
+//! @return true On success
+//! @return false When data stream is empty
+
+bool twr_data_pipeline_feed_stream(twr_data_pipeline_t *self, twr_data_stream_t *stream);
+
+//! @brief Get the last output value of stage
+//! @param[in] self Instance
+//! @param[out] value Pointer to variable where value will be stored
+//! @return true On success
+//! @return false When stage has no output yet
+
+bool twr_data_pipeline_get_value(twr_data_pipeline_t *self, float *value);
+
+//! @brief Reset stage and all stages behind it
+//! @param[in] self Instance
+
+void twr_data_pipeline_reset(twr_data_pipeline_t *self);
+
+//! @}
+
+#endif // _TWR_DATA_PIPELINE_H
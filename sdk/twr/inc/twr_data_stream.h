@@ -5,6 +5,10 @@
 
 //! @addtogroup twr_data_stream twr_data_stream
 //! @brief Library for computations on stream of data
+//!
+//! Sum, minimum and maximum of the window are updated with every fed sample, so average, minimum and maximum
+//! are available in constant time. Minimum and maximum use monotonic queues stored in buffer window, buffers
+//! without window fall back to scanning all samples.
 //! @{
 
 //! @brief Macro for float data stream buffer declaration
@@ -12,11 +16,13 @@
 #define TWR_DATA_STREAM_FLOAT_BUFFER(NAME, NUMBER_OF_SAMPLES) \
     float NAME##_feed[NUMBER_OF_SAMPLES]; \
     float NAME##_sort[NUMBER_OF_SAMPLES]; \
+    uint16_t NAME##_window[2 * (NUMBER_OF_SAMPLES)]; \
     twr_data_stream_buffer_t NAME = { \
             .feed = NAME##_feed, \
             .sort = NAME##_sort, \
             .number_of_samples = NUMBER_OF_SAMPLES, \
-            .type=TWR_DATA_STREAM_TYPE_FLOAT \
+            .type=TWR_DATA_STREAM_TYPE_FLOAT, \
+            .window = NAME##_window \
     };
 
 //! @brief Macro for int data stream buffer declaration
@@ -24,18 +30,58 @@
 #define TWR_DATA_STREAM_INT_BUFFER(NAME, NUMBER_OF_SAMPLES) \
     int NAME##_feed[NUMBER_OF_SAMPLES]; \
     int NAME##_sort[NUMBER_OF_SAMPLES]; \
+    uint16_t NAME##_window[2 * (NUMBER_OF_SAMPLES)]; \
     twr_data_stream_buffer_t NAME = { \
             .feed = NAME##_feed, \
             .sort = NAME##_sort, \
             .number_of_samples = NUMBER_OF_SAMPLES, \
-            .type=TWR_DATA_STREAM_TYPE_INT \
+            .type=TWR_DATA_STREAM_TYPE_INT, \
+            .window = NAME##_window \
     };
 
+//! @brief Macro for int16 data stream buffer declaration
+
+#define TWR_DATA_STREAM_INT16_BUFFER(NAME, NUMBER_OF_SAMPLES) \
+    int16_t NAME##_feed[NUMBER_OF_SAMPLES]; \
+    int16_t NAME##_sort[NUMBER_OF_SAMPLES]; \
+    uint16_t NAME##_window[2 * (NUMBER_OF_SAMPLES)]; \
+    twr_data_stream_buffer_t NAME = { \
+            .feed = NAME##_feed, \
+            .sort = NAME##_sort, \
+            .number_of_samples = NUMBER_OF_SAMPLES, \
+            .type=TWR_DATA_STREAM_TYPE_INT16, \
+            .window = NAME##_window \
+    };
+
+//! @brief Macro for fixed-point data stream buffer declaration, samples are int16_t with FRACTION_BITS fractional bits
+
+#define TWR_DATA_STREAM_FIXED_BUFFER(NAME, NUMBER_OF_SAMPLES, FRACTION_BITS) \
+    int16_t NAME##_feed[NUMBER_OF_SAMPLES]; \
+    int16_t NAME##_sort[NUMBER_OF_SAMPLES]; \
+    uint16_t NAME##_window[2 * (NUMBER_OF_SAMPLES)]; \
+    twr_data_stream_buffer_t NAME = { \
+            .feed = NAME##_feed, \
+            .sort = NAME##_sort, \
+            .number_of_samples = NUMBER_OF_SAMPLES, \
+            .type=TWR_DATA_STREAM_TYPE_FIXED, \
+            .window = NAME##_window, \
+            .fraction_bits = FRACTION_BITS \
+    };
+
+//! @brief Convert float to fixed-point sample
+
+#define TWR_DATA_STREAM_FIXED_FROM_FLOAT(VALUE, FRACTION_BITS) ((int16_t) ((VALUE) * (float) (1 << (FRACTION_BITS))))
+
+//! @brief Convert fixed-point sample to float
+
+#define TWR_DATA_STREAM_FIXED_TO_FLOAT(VALUE, FRACTION_BITS) ((float) (VALUE) / (float) (1 << (FRACTION_BITS)))
+
 //! @brief Macro for float data stream array declaration
 
 #define TWR_DATA_STREAM_FLOAT_ARRAY(NAME, COUNT, NUMBER_OF_SAMPLES) \
     static float NAME##_feed[(COUNT)][(NUMBER_OF_SAMPLES)]; \
     static float NAME##_sort[(NUMBER_OF_SAMPLES)]; \
+    static uint16_t NAME##_window[(COUNT)][2 * (NUMBER_OF_SAMPLES)]; \
     static twr_data_stream_buffer_t NAME##_buffer[(COUNT)]; \
     static twr_data_stream_t NAME[(COUNT)];
 
@@ -48,6 +94,7 @@
         NAME##_buffer[i].sort = NAME##_sort; \
         NAME##_buffer[i].number_of_samples = (sizeof(NAME##_feed[i]) / sizeof(float)); \
         NAME##_buffer[i].type=TWR_DATA_STREAM_TYPE_FLOAT; \
+        NAME##_buffer[i].window = NAME##_window[i]; \
         twr_data_stream_init(&NAME[i], (MIN_NUMBER_OF_SAMPLES), &NAME##_buffer[i]); \
     }
 
@@ -56,7 +103,13 @@
 typedef enum
 {
     TWR_DATA_STREAM_TYPE_FLOAT = 0,
-    TWR_DATA_STREAM_TYPE_INT = 1
+    TWR_DATA_STREAM_TYPE_INT = 1,
+
+    //! @brief Samples and results are int16_t
+    TWR_DATA_STREAM_TYPE_INT16 = 2,
+
+    //! @brief Samples and results are int16_t in fixed-point format with buffer fraction_bits fractional bits
+    TWR_DATA_STREAM_TYPE_FIXED = 3
 
 } twr_data_stream_type_t;
 
@@ -65,10 +118,19 @@ typedef enum
 typedef struct
 {
     void *feed;
+
+    //! @brief Optional scratch buffer of number_of_samples for median, can be shared by streams (can be NULL)
     void *sort;
+
     int number_of_samples;
     twr_data_stream_type_t type;
 
+    //! @brief Optional storage of 2 * number_of_samples positions for minimum and maximum (can be NULL)
+    uint16_t *window;
+
+    //! @brief Number of fractional bits of TWR_DATA_STREAM_TYPE_FIXED samples
+    uint8_t fraction_bits;
+
 } twr_data_stream_buffer_t;
 
 
@@ -84,6 +146,13 @@ struct twr_data_stream_t
     int _counter;
     int _min_number_of_samples;
     int _feed_head;
+    int64_t _sum_int;
+    float _sum_float;
+    int _sum_feeds;
+    int _min_head;
+    int _min_count;
+    int _max_head;
+    int _max_count;
 };
 
 //! @endcond
@@ -123,6 +192,10 @@ twr_data_stream_type_t twr_data_stream_get_type(twr_data_stream_t *self);
 
 int twr_data_stream_get_number_of_samples(twr_data_stream_t *self);
 
+//! @brief Get number of fractional bits, zero for other than fixed-point stream
+
+int twr_data_stream_get_fraction_bits(twr_data_stream_t *self);
+
 //! @brief Get average value of data stream
 //! @param[in] self Instance
 //! @param[out] self Pointer to buffer where result will be stored
@@ -132,6 +205,8 @@ int twr_data_stream_get_number_of_samples(twr_data_stream_t *self);
 bool twr_data_stream_get_average(twr_data_stream_t *self, void *result);
 
 //! @brief Get median value of data stream
+//!
+//! Median is selected in linear time in sort buffer, without sort buffer it takes time quadratic in length.
 //! @param[in] self Instance
 //! @param[out] self Pointer to buffer where result will be stored
 //! @return true On success (desired value is available)
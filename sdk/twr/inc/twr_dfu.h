@@ -4,12 +4,125 @@
 #include <twr_common.h>
 
 //! @addtogroup twr_dfu twr_dfu
-//! @brief USB DFU Bootloader function
+//! @brief USB DFU Bootloader function and staged firmware update received by blocks
+//!
+//! New firmware is received by numbered blocks with CRC16 (see @ref twr_crc16, polynomial 0x1021 initialized by 0xffff)
+//! over any transport, e.g. @ref twr_radio_send_sub_data of gateway, and staged in spare flash bank. Blocks are
+//! accepted only in order, so sender continues from @ref twr_dfu_get_next_block after interruption. With state key set,
+//! progress is stored every TWR_DFU_CHECKPOINT_BLOCKS blocks and transfer resumes after reset as well. Blocks carry
+//! either the whole image or delta against the running firmware made of commands:
+//!
+//! | 0x00 | length (2 B) | data | - bytes of new image
+//! | 0x01 | offset (3 B) | length (2 B) | - bytes copied from running firmware at offset
+//!
+//! Numbers are little endian. Staged image is verified by CRC32 (see @ref twr_crc32) and copied over the running
+//! firmware by @ref twr_dfu_install from RAM. Firmware must fit below staging area, reset during installation leaves
+//! device recoverable only by USB DFU bootloader.
 //! @{
 
+//! @brief Size of block (multiple of 4), only the last block may be shorter
+
+#ifndef TWR_DFU_BLOCK_SIZE
+#define TWR_DFU_BLOCK_SIZE 32
+#endif
+
+//! @brief Start address of staging area in flash (start of bank 2, so that writes do not stall running code)
+
+#ifndef TWR_DFU_STAGING_ADDRESS
+#define TWR_DFU_STAGING_ADDRESS 0x08018000
+#endif
+
+//! @brief Size of staging area in flash (up to product information block at the end of flash)
+
+#ifndef TWR_DFU_STAGING_SIZE
+#define TWR_DFU_STAGING_SIZE (0x08030000 - 128 - TWR_DFU_STAGING_ADDRESS)
+#endif
+
+//! @brief Number of blocks between stored checkpoints of progress
+
+#ifndef TWR_DFU_CHECKPOINT_BLOCKS
+#define TWR_DFU_CHECKPOINT_BLOCKS 32
+#endif
+
+//! @brief Content of blocks
+
+typedef enum
+{
+    //! @brief Whole image
+    TWR_DFU_MODE_FULL = 0,
+
+    //! @brief Delta against running firmware
+    TWR_DFU_MODE_DELTA = 1
+
+} twr_dfu_mode_t;
+
+//! @brief Results of block write
+
+typedef enum
+{
+    //! @brief Block is written
+    TWR_DFU_RESULT_OK = 0,
+
+    //! @brief Block has been written before
+    TWR_DFU_RESULT_DUPLICATE = 1,
+
+    //! @brief Block is not the next one (see twr_dfu_get_next_block)
+    TWR_DFU_RESULT_OUT_OF_ORDER = 2,
+
+    //! @brief Block has wrong CRC or length
+    TWR_DFU_RESULT_CRC = 3,
+
+    //! @brief Transfer is not started, delta or image is invalid or flash write failed, transfer is aborted
+    TWR_DFU_RESULT_ERROR = 4
+
+} twr_dfu_result_t;
+
 //! @brief Reset the CPU and jump to the USB DFU bootloader.
 void twr_dfu_jump(void);
 
+//! @brief Set key of progress stored by twr_kv (twr_kv has to be initialized), transfer resumes after reset then
+//! @param[in] key Key
+
+void twr_dfu_set_state_key(uint16_t key);
+
+//! @brief Start transfer, transfer of the same image is resumed
+//! @param[in] mode Content of blocks
+//! @param[in] image_size Size of new image in bytes
+//! @param[in] image_crc CRC32 of new image
+//! @return true On success
+//! @return false When image does not fit staging area or running firmware overlaps it
+
+bool twr_dfu_begin(twr_dfu_mode_t mode, uint32_t image_size, uint32_t image_crc);
+
+//! @brief Get number of the next expected block
+//! @return Number of block
+
+uint16_t twr_dfu_get_next_block(void);
+
+//! @brief Write block
+//! @param[in] index Number of block
+//! @param[in] buffer Pointer to content of block
+//! @param[in] length Length of block
+//! @param[in] crc CRC16 of content
+//! @return Result
+
+twr_dfu_result_t twr_dfu_write_block(uint16_t index, const void *buffer, size_t length, uint16_t crc);
+
+//! @brief Finish transfer and verify staged image
+//! @return true When staged image is complete and its CRC32 matches
+//! @return false Otherwise
+
+bool twr_dfu_finish(void);
+
+//! @brief Copy verified staged image over running firmware and reset, runs from RAM with interrupts disabled
+//! @return false When no verified image is staged, does not return otherwise
+
+bool twr_dfu_install(void);
+
+//! @brief Abort transfer and drop stored progress
+
+void twr_dfu_abort(void);
+
 //! @}
 
 #endif // _TWR_DFU_H
@@ -1,7 +1,7 @@
 #ifndef _TWR_DICE_H
 #define _TWR_DICE_H
 
-#include <twr_common.h>
+#include <twr_scheduler.h>
 
 //! @addtogroup twr_dice twr_dice
 //! @brief Helper library to determine dice (cube) face position from vectors
@@ -34,6 +34,15 @@ typedef enum
 
 } twr_dice_face_t;
 
+//! @brief Callback events
+
+typedef enum
+{
+    //! @brief Face change event
+    TWR_DICE_EVENT_FACE_CHANGE = 0
+
+} twr_dice_event_t;
+
 //! @brief Dice instance
 
 typedef struct twr_dice_t twr_dice_t;
@@ -44,6 +53,19 @@ struct twr_dice_t
 {
     twr_dice_face_t _face;
     float _threshold;
+    int32_t _raw_one_g;
+    int32_t _raw_threshold;
+    float _hysteresis;
+    int32_t _raw_hysteresis;
+    uint8_t _dwell_samples;
+    twr_tick_t _dwell_time;
+    twr_dice_face_t _candidate;
+    uint8_t _candidate_count;
+    twr_tick_t _candidate_tick;
+    bool _task_registered;
+    twr_scheduler_task_id_t _task_id;
+    void (*_event_handler)(twr_dice_t *, twr_dice_event_t, void *);
+    void *_event_param;
 };
 
 //! @endcond
@@ -68,6 +90,55 @@ void twr_dice_set_threshold(twr_dice_t *self, float threshold);
 
 void twr_dice_feed_vectors(twr_dice_t *self, float x_axis, float y_axis, float z_axis);
 
+//! @brief Set hysteresis
+//!
+//! Current face is left only when a vector deviates from it by more than threshold plus hysteresis, new face is still
+//! entered within threshold, so noise around the threshold does not toggle the face.
+//! @param[in] self Instance
+//! @param[in] hysteresis Hysteresis in g (default 0)
+
+void twr_dice_set_hysteresis(twr_dice_t *self, float hysteresis);
+
+//! @brief Set dwell filter
+//!
+//! New face is accepted only after it has been recognized in given number of consecutive feeds and it has stayed for
+//! given time since the first of them. Time condition is checked by scheduler task as well, so it works with feeds
+//! coming only on change (e.g. twr_dice_feed_face from orientation interrupt), use event handler to be notified.
+//! @param[in] self Instance
+//! @param[in] samples Number of consecutive feeds (default 1, 0 is taken as 1)
+//! @param[in] time Time in milliseconds (default 0)
+
+void twr_dice_set_dwell(twr_dice_t *self, uint8_t samples, twr_tick_t time);
+
+//! @brief Set callback function called on accepted face change
+//! @param[in] self Instance
+//! @param[in] event_handler Function address
+//! @param[in] event_param Optional event parameter (can be NULL)
+
+void twr_dice_set_event_handler(twr_dice_t *self, void (*event_handler)(twr_dice_t *, twr_dice_event_t, void *), void *event_param);
+
+//! @brief Set raw value corresponding to 1 g for twr_dice_feed_raw
+//!
+//! Threshold is converted to raw units here, default is 16000 which matches LIS2DH12 raw results at ±2 g scale.
+//! @param[in] self Instance
+//! @param[in] one_g Raw value of 1 g (see twr_lis2dh12_get_raw_one_g)
+
+void twr_dice_set_raw_one_g(twr_dice_t *self, int16_t one_g);
+
+//! @brief Feed dice with X/Y/Z axis raw samples, same as twr_dice_feed_vectors in integer arithmetic
+//! @param[in] self Instance
+//! @param[in] x_axis Raw sample of X axis
+//! @param[in] y_axis Raw sample of Y axis
+//! @param[in] z_axis Raw sample of Z axis
+
+void twr_dice_feed_raw(twr_dice_t *self, int16_t x_axis, int16_t y_axis, int16_t z_axis);
+
+//! @brief Feed dice with face recognized by sensor itself (e.g. LIS2DH12 6D orientation interrupt)
+//! @param[in] self Instance
+//! @param[in] face Recognized face, unknown face keeps the last one
+
+void twr_dice_feed_face(twr_dice_t *self, twr_dice_face_t face);
+
 //! @brief Get calculated dice face
 //! @param[in] self Instance
 //! @return Dice face
@@ -23,7 +23,7 @@ typedef enum
     //! @brief DMA channel 4
     TWR_DMA_CHANNEL_4 = 3,
 
-    //! @brief DMA channel 5, used for SPI
+    //! @brief DMA channel 5
     TWR_DMA_CHANNEL_5 = 4,
 
     //! @brief DMA channel 6
@@ -88,6 +88,72 @@ typedef enum
 
 } twr_dma_request_t;
 
+//! @brief DMA peripheral request lines
+
+typedef enum
+{
+    //! @brief ADC (channel 1 or 2)
+    TWR_DMA_LINE_ADC = 0,
+
+    //! @brief SPI1 receive (channel 2)
+    TWR_DMA_LINE_SPI1_RX = 1,
+
+    //! @brief SPI1 transmit (channel 3)
+    TWR_DMA_LINE_SPI1_TX = 2,
+
+    //! @brief SPI2 receive (channel 4 or 6)
+    TWR_DMA_LINE_SPI2_RX = 3,
+
+    //! @brief SPI2 transmit (channel 5 or 7)
+    TWR_DMA_LINE_SPI2_TX = 4,
+
+    //! @brief USART1 receive (channel 3 or 5)
+    TWR_DMA_LINE_USART1_RX = 5,
+
+    //! @brief USART1 transmit (channel 4 or 2)
+    TWR_DMA_LINE_USART1_TX = 6,
+
+    //! @brief USART2 receive (channel 6 or 5)
+    TWR_DMA_LINE_USART2_RX = 7,
+
+    //! @brief USART2 transmit (channel 7 or 4)
+    TWR_DMA_LINE_USART2_TX = 8,
+
+    //! @brief USART4 receive (channel 6 or 2)
+    TWR_DMA_LINE_USART4_RX = 9,
+
+    //! @brief USART4 transmit (channel 7 or 3)
+    TWR_DMA_LINE_USART4_TX = 10,
+
+    //! @brief LPUART1 receive (channel 6 or 3)
+    TWR_DMA_LINE_LPUART1_RX = 11,
+
+    //! @brief LPUART1 transmit (channel 7 or 2)
+    TWR_DMA_LINE_LPUART1_TX = 12,
+
+    //! @brief TIM2 update (channel 2)
+    TWR_DMA_LINE_TIM2_UP = 13,
+
+    //! @brief TIM6 update and DAC channel 1 (channel 2)
+    TWR_DMA_LINE_DAC1 = 14,
+
+    //! @brief TIM7 update and DAC channel 2 (channel 4)
+    TWR_DMA_LINE_DAC2 = 15,
+
+    //! @brief TIM2 capture/compare 2 (channel 3 or 7)
+    TWR_DMA_LINE_TIM2_CH2 = 16,
+
+    //! @brief AES input (channel 5 or 1)
+    TWR_DMA_LINE_AES_IN = 17,
+
+    //! @brief AES output (channel 3 or 2)
+    TWR_DMA_LINE_AES_OUT = 18,
+
+    //! @brief TIM3 update (channel 3)
+    TWR_DMA_LINE_TIM3_UP = 19
+
+} twr_dma_line_t;
+
 //! @brief DMA channel directions
 
 typedef enum
@@ -197,6 +263,30 @@ typedef struct
 
 void twr_dma_init(void);
 
+//! @brief Allocate DMA channel able to serve peripheral request line
+//!
+//! Preferred channel of the line is tried first, then its alternative. Drivers keeping the channel for their whole life
+//! should allocate it at initialization, so the conflict is reported right away.
+//! @param[in] line Peripheral request line
+//! @param[out] channel Allocated DMA channel
+//! @param[out] request DMA request to be used in channel configuration (can be NULL)
+//! @return true On success
+//! @return false When all channels able to serve the line are already allocated
+
+bool twr_dma_channel_allocate(twr_dma_line_t line, twr_dma_channel_t *channel, twr_dma_request_t *request);
+
+//! @brief Release DMA channel allocated by twr_dma_channel_allocate, channel is stopped and its handlers are removed
+//! @param[in] channel DMA channel
+
+void twr_dma_channel_release(twr_dma_channel_t channel);
+
+//! @brief Check if DMA channel is allocated
+//! @param[in] channel DMA channel
+//! @return true If channel is allocated
+//! @return false If channel is free
+
+bool twr_dma_channel_is_allocated(twr_dma_channel_t channel);
+
 //! @brief Configure DMA channel
 //! @param[in] channel DMA channel
 //! @param[in] config Pointer to DMA channel configuration
@@ -210,6 +300,16 @@ void twr_dma_channel_config(twr_dma_channel_t channel, twr_dma_channel_config_t
 
 void twr_dma_set_event_handler(twr_dma_channel_t channel, void (*event_handler)(twr_dma_channel_t, twr_dma_event_t, void *), void *event_param);
 
+//! @brief Set callback function called directly from DMA interrupt
+//!
+//! Interrupt handler is called before the event is passed to the event handler set by twr_dma_set_event_handler,
+//! channel in standard mode is already stopped on TWR_DMA_EVENT_DONE, so it can be reconfigured and run again.
+//! @param[in] channel DMA channel
+//! @param[in] irq_handler Function address (can be NULL)
+//! @param[in] irq_param Optional interrupt handler parameter (can be NULL)
+
+void twr_dma_set_irq_handler(twr_dma_channel_t channel, void (*irq_handler)(twr_dma_channel_t, twr_dma_event_t, void *), void *irq_param);
+
 //! @brief Start DMA channel
 //! @param[in] channel DMA channel
 
@@ -222,6 +322,20 @@ void twr_dma_channel_stop(twr_dma_channel_t channel);
 
 size_t twr_dma_channel_get_length(twr_dma_channel_t channel);
 
+//! @brief Copy memory block by DMA in background
+//!
+//! Free DMA channel is allocated for the copy and released before the event handler is called from scheduler task.
+//! Buffers must stay valid until then. Word transfers are used when both addresses and length are 4 B aligned.
+//! @param[in] destination Destination address
+//! @param[in] source Source address
+//! @param[in] length Number of bytes to copy (at most 65535 transfers)
+//! @param[in] event_handler Function called with TWR_DMA_EVENT_DONE or TWR_DMA_EVENT_ERROR (can be NULL)
+//! @param[in] event_param Optional event parameter (can be NULL)
+//! @return true If copy has been started
+//! @return false If there is no free DMA channel or length is out of range
+
+bool twr_dma_memcpy_async(void *destination, const void *source, size_t length, void (*event_handler)(twr_dma_event_t, void *), void *event_param);
+
 
 //! @}
 
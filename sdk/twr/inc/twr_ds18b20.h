@@ -76,6 +76,9 @@ struct twr_ds18b20_t
     bool _power;
     bool _power_dynamic;
     twr_onewire_t *_onewire;
+    bool _rom_cache;
+    bool _rom_cache_stale;
+    uint32_t _rom_cache_address;
 };
 
 //! @endcond
@@ -118,6 +121,9 @@ void twr_ds18b20_set_event_handler(twr_ds18b20_t *self, void (*event_handler)(tw
 void twr_ds18b20_set_update_interval(twr_ds18b20_t *self, twr_tick_t interval);
 
 //! @brief Start measurement manually
+//!
+//! Conversion is started on all sensors on the bus at once by Skip ROM Convert T, scratchpads of all found sensors are
+//! read in one pass after single conversion time of the slowest sensor.
 //! @param[in] self Instance
 //! @return true On success
 //! @return false When other measurement is in progress
@@ -164,6 +170,15 @@ int twr_ds18b20_get_sensor_found(twr_ds18b20_t *self);
 
 void twr_ds18b20_rescan(twr_ds18b20_t *self);
 
+//! @brief Keep device addresses of found sensors in EEPROM
+//!
+//! On start and after error the cached sensors are only verified one by one and the full search of the bus runs
+//! when any of them is missing or after @ref twr_ds18b20_rescan. Newly attached sensor is not found until rescan.
+//! @param[in] self Instance
+//! @param[in] eeprom_address EEPROM address of the cache, it takes 2 + 8 * sensor_count bytes
+
+void twr_ds18b20_set_rom_cache(twr_ds18b20_t *self, uint32_t eeprom_address);
+
 //! @brief Set power dynamic, Turns VDD on and pull 4k7 only for measurement
 //! @param[in] self Instance
 //! @param[in] on True enable dynamic, False disable dynamic
@@ -18,6 +18,18 @@
 #define	TWR_DS2484_STATUS_TSB   (1<<6) // Triplet Second Bit
 #define	TWR_DS2484_STATUS_DIR   (1<<7) // Branch Direction Taken
 
+//! @brief 1-Wire speed
+
+typedef enum
+{
+    //! @brief Standard speed (default)
+    TWR_DS2484_SPEED_STANDARD = 0,
+
+    //! @brief Overdrive speed, about 7 times faster time slots
+    TWR_DS2484_SPEED_OVERDRIVE = 1
+
+} twr_ds2484_speed_t;
+
 //! @brief TMP112 instance
 
 typedef struct twr_ds2484_t twr_ds2484_t;
@@ -28,6 +40,9 @@ struct twr_ds2484_t
 {
     bool _ready;
     bool _spu_on;
+    bool _busy;
+    uint16_t _busy_us;
+    twr_ds2484_speed_t _speed;
     uint8_t _status;
     uint8_t _srp;
     twr_i2c_channel_t _i2c_channel;
@@ -60,7 +75,18 @@ void twr_ds2484_disable(twr_ds2484_t *self);
 
 bool twr_ds2484_reset(twr_ds2484_t *self);
 
+//! @brief Set 1-Wire speed, kept over disable and enable
+//!
+//! Devices have to be switched to overdrive speed by Overdrive Skip ROM (0x3c) or Overdrive Match ROM (0x69) command at
+//! standard speed before, reset pulse at standard speed returns them back.
+//! @param[in] self Instance
+//! @param[in] speed 1-Wire speed
+
+bool twr_ds2484_set_speed(twr_ds2484_t *self, twr_ds2484_speed_t speed);
+
 //! @brief Wait until not busy
+//!
+//! Expected duration of the last 1-Wire command is waited out by timer before status register is read.
 //! @param[in] self Instance
 
 bool twr_ds2484_busy_wait(twr_ds2484_t *self);
@@ -73,6 +99,24 @@ bool twr_ds2484_read_bit(twr_ds2484_t *self, uint8_t *bit);
 
 bool twr_ds2484_triplet(twr_ds2484_t *self, const uint8_t direction);
 
+//! @brief Write bytes to 1-Wire, every byte is started right when the previous one is done
+//! @param[in] self Instance
+//! @param[in] buffer Bytes to write
+//! @param[in] length Number of bytes
+//! @return true On success
+//! @return false On failure, remaining bytes are not written
+
+bool twr_ds2484_write(twr_ds2484_t *self, const void *buffer, size_t length);
+
+//! @brief Read bytes from 1-Wire, every byte is started right when the previous one is done
+//! @param[in] self Instance
+//! @param[out] buffer Bytes read
+//! @param[in] length Number of bytes
+//! @return true On success
+//! @return false On failure, remaining bytes are not read
+
+bool twr_ds2484_read(twr_ds2484_t *self, void *buffer, size_t length);
+
 bool twr_ds2484_is_ready(twr_ds2484_t *self);
 
 uint8_t twr_ds2484_status_get(twr_ds2484_t *self);
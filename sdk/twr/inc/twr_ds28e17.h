@@ -77,6 +77,17 @@ bool twr_ds28e17_memory_write(twr_ds28e17_t *self, const twr_i2c_memory_transfer
 
 bool twr_ds28e17_memory_read(twr_ds28e17_t *self, const twr_i2c_memory_transfer_t *transfer);
 
+//! @brief Run batch of memory transfers to I2C within one 1-Wire session
+//!
+//! Bridge is woken up and put back to sleep once, ROM is matched by the first transfer and resumed by the following
+//! ones. A failed transfer does not stop the following ones.
+//! @param[in] self Instance
+//! @param[in,out] batch Array of batch items, success member is updated for each item
+//! @param[in] count Number of batch items
+//! @return Number of successful transfers
+
+size_t twr_ds28e17_memory_batch(twr_ds28e17_t *self, twr_i2c_batch_t *batch, size_t count);
+
 //! @}
 
 #endif // _TWR_DS28E17_H
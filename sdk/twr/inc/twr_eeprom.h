@@ -7,6 +7,12 @@
 //! @brief Driver for internal EEPROM memory
 //! @{
 
+//! @brief Number of async writes which can be queued at once
+
+#ifndef TWR_EEPROM_ASYNC_QUEUE_LENGTH
+#define TWR_EEPROM_ASYNC_QUEUE_LENGTH 4
+#endif
+
 typedef enum
 {
     //! @brief EEPROM event sync write error
@@ -27,17 +33,21 @@ typedef enum
 bool twr_eeprom_write(uint32_t address, const void *buffer, size_t length);
 
 //! @brief Async write buffer to EEPROM area and verify it
+//!
+//! Writes are queued and done in order of requests, one programmed word per scheduler run, words which hold
+//! the value already are skipped. Queued write whose range is covered by later request is not done, it completes
+//! with its own event when it comes on turn as its content is superseded. Buffer has to be valid until completion.
 //! @param[in] address EEPROM start address (starts at 0)
 //! @param[in] buffer Pointer to source buffer
 //! @param[in] length Number of bytes to be written
 //! @param[in] event_handler Function address
 //! @param[in] event_param Optional event parameter (can be NULL)
 //! @return true On success start
-//! @return false On failure start
+//! @return false On failure start (range out of EEPROM or full queue)
 
 bool twr_eeprom_async_write(uint32_t address, const void *buffer, size_t length, void (*event_handler)(twr_eepromc_event_t, void *), void *event_param);
 
-//! @brief Cancel async write
+//! @brief Cancel all queued async writes, event handlers are not called
 
 void twr_eeprom_async_cancel(void);
 
@@ -10,6 +10,7 @@ typedef enum
     TWR_ERROR_ERROR_UNLOCK = 2,
     TWR_ERROR_CALLBACK = 3,
     TWR_ERROR_INVALID_PARAMETER = 4,
+    TWR_ERROR_STACK_OVERFLOW = 5,
 
 } twr_error_t;
 
@@ -44,6 +44,13 @@ typedef enum
 
 typedef struct twr_esp8266_t twr_esp8266_t;
 
+//! @brief Receive handler, called with regions of RX ring holding data of received message
+//!
+//! Message can be passed in several calls (ring wraps around or rest of message is not received yet), data are
+//! valid only during the call. @ref TWR_ESP8266_EVENT_DATA_RECEIVED follows the last call of message.
+
+typedef void (twr_esp8266_receive_handler_t)(twr_esp8266_t *self, const uint8_t *data, size_t length, void *param);
+
 typedef enum
 {
     TWR_ESP8266_STATE_READY = 0,
@@ -111,6 +118,10 @@ struct twr_esp8266_t
     uint8_t _message_buffer[TWR_ESP8266_TX_MAX_PACKET_SIZE];
     size_t _message_length;
     size_t _message_part_length;
+    const twr_transport_segment_t *_tx_segment;
+    size_t _tx_segment_count;
+    twr_esp8266_receive_handler_t *_receive_handler;
+    void *_receive_param;
     uint8_t _init_command_index;
     uint8_t _timeout_cnt;
     twr_esp8266_config _config;
@@ -212,6 +223,22 @@ bool twr_esp8266_ssl_connect(twr_esp8266_t *self, const char *host, uint16_t por
 
 bool twr_esp8266_send_data(twr_esp8266_t *self, const void *buffer, size_t length);
 
+//! @brief Send data gathered from segments without copy to internal buffer
+//! @param[in] self Instance
+//! @param[in] segments Array of segments, segments and their data must stay valid until send success or error event
+//! @param[in] count Number of segments
+//! @return true If command was accepted for processing
+//! @return false If command was denied for processing or total length exceeds TWR_ESP8266_TX_MAX_PACKET_SIZE
+
+bool twr_esp8266_send_datav(twr_esp8266_t *self, const twr_transport_segment_t *segments, size_t count);
+
+//! @brief Set receive handler, received messages are then passed in place from RX ring instead of copy to internal buffer
+//! @param[in] self Instance
+//! @param[in] handler Function address, NULL to use internal buffer and @ref twr_esp8266_get_received_message_data
+//! @param[in] param Optional handler parameter (can be NULL)
+
+void twr_esp8266_set_receive_handler(twr_esp8266_t *self, twr_esp8266_receive_handler_t *handler, void *param);
+
 //! @brief Get length of the received message
 //! @param[in] self Instance
 //! @return length
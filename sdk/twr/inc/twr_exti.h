@@ -213,6 +213,17 @@ typedef enum
 
 void twr_exti_register(twr_exti_line_t line, twr_exti_edge_t edge, void (*callback)(twr_exti_line_t, void *), void *param);
 
+//! @brief Enable EXTI line interrupt and register callback function run by scheduler task instead of interrupt
+//!
+//! Interrupt only signals the task through @ref twr_scheduler_signal, several edges before the task runs call the
+//! callback once. Has to be called after the scheduler has been initialized.
+//! @param[in] line EXTI line
+//! @param[in] edge Desired interrupt edge sensitivity
+//! @param[in] callback Function address (called from task)
+//! @param[in] param Optional parameter being passed to callback function (can be NULL)
+
+void twr_exti_register_deferred(twr_exti_line_t line, twr_exti_edge_t edge, void (*callback)(twr_exti_line_t, void *), void *param);
+
 //! @brief Disable EXTI line interrupt
 //! @param[in] line EXTI line
 
@@ -7,6 +7,31 @@
 //! @brief FIFO buffer implementation
 //! @{
 
+//! @brief Track peak occupancy, dropped and written bytes of every FIFO
+
+#ifndef TWR_FIFO_STATS
+#define TWR_FIFO_STATS 0
+#endif
+
+#if TWR_FIFO_STATS
+
+//! @brief FIFO statistics
+
+typedef struct
+{
+    //! @brief Highest number of bytes stored at once
+    size_t peak;
+
+    //! @brief Number of bytes which did not fit in
+    uint32_t dropped;
+
+    //! @brief Number of bytes written
+    uint32_t total;
+
+} twr_fifo_stats_t;
+
+#endif
+
 //! @brief Structure of FIFO instance
 
 typedef struct
@@ -18,10 +43,18 @@ typedef struct
     size_t size;
 
     //! @brief Position of FIFO's head
-    size_t head;
+    volatile size_t head;
 
     //! @brief Position of FIFO's tail
-    size_t tail;
+    volatile size_t tail;
+
+    //! @brief Single producer and single consumer mode (no interrupt masking)
+    bool spsc;
+
+#if TWR_FIFO_STATS
+    //! @brief Statistics, updated by writer
+    twr_fifo_stats_t stats;
+#endif
 
 } twr_fifo_t;
 
@@ -32,6 +65,15 @@ typedef struct
 
 void twr_fifo_init(twr_fifo_t *fifo, void *buffer, size_t size);
 
+//! @brief Set single producer and single consumer mode
+//!
+//! In this mode twr_fifo_write, twr_fifo_read and twr_fifo_is_empty do not disable interrupts, FIFO must have exactly
+//! one writer and one reader (typically interrupt on one side and task on the other).
+//! @param[in] fifo FIFO instance
+//! @param[in] spsc Enable when true, disable when false
+
+void twr_fifo_set_spsc(twr_fifo_t *fifo, bool spsc);
+
 //! @brief Purge FIFO buffer
 //! @param[in] fifo FIFO instance
 
@@ -69,6 +111,47 @@ size_t twr_fifo_irq_write(twr_fifo_t *fifo, const void *buffer, size_t length);
 
 size_t twr_fifo_irq_read(twr_fifo_t *fifo, void *buffer, size_t length);
 
+//! @brief Get contiguous free space to be written in place (e.g. by DMA)
+//! @param[in] fifo FIFO instance
+//! @param[out] buffer Pointer to start of free space
+//! @return Number of bytes which can be written at buffer (free space may continue at start of FIFO buffer)
+
+size_t twr_fifo_reserve(twr_fifo_t *fifo, void **buffer);
+
+//! @brief Make data written in place after twr_fifo_reserve available to reader
+//! @param[in] fifo FIFO instance
+//! @param[in] length Number of bytes written, must not exceed the reserved space
+
+void twr_fifo_commit(twr_fifo_t *fifo, size_t length);
+
+//! @brief Get contiguous stored data to be read in place
+//! @param[in] fifo FIFO instance
+//! @param[out] buffer Pointer to start of stored data
+//! @return Number of bytes which can be read at buffer (data may continue at start of FIFO buffer)
+
+size_t twr_fifo_peek(twr_fifo_t *fifo, const void **buffer);
+
+//! @brief Release data read in place after twr_fifo_peek
+//! @param[in] fifo FIFO instance
+//! @param[in] length Number of bytes read, must not exceed the peeked data
+
+void twr_fifo_consume(twr_fifo_t *fifo, size_t length);
+
+#if TWR_FIFO_STATS
+
+//! @brief Get FIFO statistics
+//! @param[in] fifo FIFO instance
+//! @param[out] stats Statistics
+
+void twr_fifo_get_stats(twr_fifo_t *fifo, twr_fifo_stats_t *stats);
+
+//! @brief Clear FIFO statistics
+//! @param[in] fifo FIFO instance
+
+void twr_fifo_reset_stats(twr_fifo_t *fifo);
+
+#endif
+
 //! @brief Is empty
 //! @param[in] fifo FIFO instance
 //! @return true When is empty
@@ -5,6 +5,7 @@
 #include <twr_module_sensor.h>
 #include <twr_scheduler.h>
 #include <twr_gpio.h>
+#include <twr_exti.h>
 
 //! @addtogroup twr_flood_detector twr_flood_detector
 //! @brief Driver flood detector
@@ -54,6 +55,8 @@ struct twr_flood_detector_t
     twr_scheduler_task_id_t _task_id_measure;
     bool _measurement_active;
     bool _alarm;
+    bool _wake_on_event;
+    bool _exti_registered;
 
 };
 
@@ -92,6 +95,16 @@ bool twr_flood_detector_measure(twr_flood_detector_t *self);
 
 bool twr_flood_detector_is_alarm(twr_flood_detector_t *self);
 
+//! @brief Measure on change of sensor output instead of update interval
+//!
+//! Pull-up stays enabled and both edges of sensor output wake up MCU by EXTI, so nothing runs while the state does not
+//! change. Output is measured when it has been stable for 50 ms, update event is raised after every measurement.
+//! Pull-up current flows all the time while sensor output is low.
+//! @param[in] self Instance
+//! @param[in] enable Enable or disable wake on event
+
+void twr_flood_detector_set_wake_on_event(twr_flood_detector_t *self, bool enable);
+
 //! @}
 
 #endif // _TWR_FLOOD_DETECTOR_H
@@ -0,0 +1,50 @@
+#ifndef _TWR_FMT_H
+#define _TWR_FMT_H
+
+#include <twr_common.h>
+
+//! @addtogroup twr_fmt twr_fmt
+//! @brief Compact formatter without allocation and without floating point printf of C library
+//!
+//! Conversions d, i, u, o, x, X, c, s, p and % are supported with flags '-', '0', '+', ' ' and '#', width,
+//! precision (also given by '*') and length modifiers hh, h, l, ll, j, z and t. Floating point conversions f, F, e,
+//! E, g and G are all printed in notation of f (6 digits by default) by conversion to 64-bit integer, digits beyond
+//! 9th decimal place are printed as zeros and last digit is rounded half up, so it can differ from C library on ties.
+//! Output is always null terminated when size is not zero and return value is length of the whole output as with
+//! snprintf, so truncation is detected by return value not less than size.
+//! @{
+
+//! @brief Format string to buffer (checked by compiler as printf format)
+//! @param[out] buffer Pointer to destination buffer
+//! @param[in] size Size of destination buffer
+//! @param[in] format Format string
+//! @param[in] ... Optional format arguments
+//! @return Length of formatted string without terminating null
+
+int twr_fmt_snprintf(char *buffer, size_t size, const char *format, ...) __attribute__ ((format (printf, 3, 4)));
+
+//! @brief Format string to buffer with argument list
+//! @param[out] buffer Pointer to destination buffer
+//! @param[in] size Size of destination buffer
+//! @param[in] format Format string
+//! @param[in] ap Argument list
+//! @return Length of formatted string without terminating null
+
+int twr_fmt_vsnprintf(char *buffer, size_t size, const char *format, va_list ap) __attribute__ ((format (printf, 3, 0)));
+
+//! @brief Format fixed-point decimal number
+//!
+//! Value 2345 with scale 2 stands for 23.45 and is printed as "23.5" with 1 digit or "23.450" with 3 digits.
+//! Removed digits are rounded half away from zero.
+//! @param[out] buffer Pointer to destination buffer
+//! @param[in] size Size of destination buffer
+//! @param[in] value Value in units of 10^-scale
+//! @param[in] scale Number of decimal digits of value (0 to 9)
+//! @param[in] digits Number of printed decimal digits (0 to 9)
+//! @return Length of formatted number without terminating null
+
+int twr_fmt_fixed(char *buffer, size_t size, int32_t value, int scale, int digits);
+
+//! @}
+
+#endif // _TWR_FMT_H
@@ -5,11 +5,25 @@
 
 #include <twr_common.h>
 
+//! @brief Font image format
+
+typedef enum
+{
+    //! @brief Rows of (width + 7) / 8 bytes MSB first, cleared bits are drawn
+    TWR_FONT_IMAGE_FORMAT_RAW = 0,
+
+    //! @brief Pixels scanned row by row coded by bytes with high nibble count of skipped pixels and low nibble
+    //! count of drawn pixels which follow, runs continue on the next row, byte 0x00 ends the image
+    TWR_FONT_IMAGE_FORMAT_RLE = 1
+
+} twr_font_image_format_t;
+
 typedef struct
 {
     const uint8_t *image;
     uint8_t width;
     uint8_t heigth;
+    uint8_t format;
 } twr_font_image_t;
 
 typedef struct  {
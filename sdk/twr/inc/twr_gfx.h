@@ -39,6 +39,17 @@ typedef struct
     //! @brief Callback for get capabilities
     twr_gfx_caps_t (*get_caps)(void *self);
 
+    //! @brief Optional callback for draw horizontal span of length pixels, span is always inside display (can be NULL)
+    void (*draw_span)(void *self, int left, int top, int length, uint32_t color);
+
+    //! @brief Optional callback for draw 1bpp bitmap, rows of (width + 7) / 8 bytes MSB first with cleared bits drawn
+    //! in color and set bits left untouched, bitmap is always inside display (can be NULL)
+    void (*draw_bitmap)(void *self, int left, int top, const uint8_t *image, int width, int height, uint32_t color);
+
+    //! @brief Optional callback for draw 1bpp image, rows of (width + 7) / 8 bytes LSB first with set bits drawn in
+    //! color 1 and cleared bits in color 0, image is always inside display (can be NULL)
+    void (*draw_image)(void *self, int left, int top, const uint8_t *image, int width, int height);
+
 } twr_gfx_driver_t;
 
 //! @brief Rotation
@@ -135,6 +146,27 @@ twr_gfx_rotation_t twr_gfx_get_rotation(twr_gfx_t *self);
 
 void twr_gfx_draw_pixel(twr_gfx_t *self, int x, int y, uint32_t color);
 
+//! @brief Display draw 1bpp bitmap in format of font images
+//! @param[in] self Instance
+//! @param[in] left Pixels from left edge
+//! @param[in] top Pixels from top edge
+//! @param[in] image Rows of (width + 7) / 8 bytes MSB first, cleared bits are drawn in color
+//! @param[in] width Bitmap width in pixels
+//! @param[in] height Bitmap height in pixels
+//! @param[in] color
+
+void twr_gfx_draw_bitmap(twr_gfx_t *self, int left, int top, const uint8_t *image, int width, int height, uint32_t color);
+
+//! @brief Display draw 1bpp image in format of twr_image_t, all pixels of image are drawn
+//! @param[in] self Instance
+//! @param[in] left Pixels from left edge
+//! @param[in] top Pixels from top edge
+//! @param[in] image Rows of (width + 7) / 8 bytes LSB first, set bits are drawn in color 1, cleared in color 0
+//! @param[in] width Image width in pixels
+//! @param[in] height Image height in pixels
+
+void twr_gfx_draw_image(twr_gfx_t *self, int left, int top, const uint8_t *image, int width, int height);
+
 //! @brief Display draw char
 //! @param[in] self Instance
 //! @param[in] left Pixels from left edge
@@ -2,6 +2,7 @@
 #define _TWR_GPIO_H
 
 #include <twr_common.h>
+#include <stm32l0xx.h>
 
 //! @addtogroup twr_gpio twr_gpio
 //! @brief Driver for general purpose input/output
@@ -194,6 +195,122 @@ int twr_gpio_get_output(twr_gpio_channel_t channel);
 
 void twr_gpio_toggle_output(twr_gpio_channel_t channel);
 
+//! @brief Port of GPIO channel (indexed by channel)
+
+extern GPIO_TypeDef * const twr_gpio_port[];
+
+//! @brief Mask of GPIO channel in 16-bit port registers (indexed by channel)
+
+extern const uint16_t twr_gpio_16_bit_mask[];
+
+//! @brief Mask of GPIO channel in upper half of BSRR register (indexed by channel)
+
+extern const uint32_t twr_gpio_32_bit_upper_mask[];
+
+//! @brief Set output of GPIO channel to high (inline, no check of channel)
+//! @param[in] channel GPIO channel
+
+static inline void twr_gpio_set_output_fast(twr_gpio_channel_t channel)
+{
+    twr_gpio_port[channel]->BSRR = twr_gpio_16_bit_mask[channel];
+}
+
+//! @brief Set output of GPIO channel to low (inline, no check of channel)
+//! @param[in] channel GPIO channel
+
+static inline void twr_gpio_reset_output_fast(twr_gpio_channel_t channel)
+{
+    twr_gpio_port[channel]->BRR = twr_gpio_16_bit_mask[channel];
+}
+
+//! @brief Get input state of GPIO channel (inline, no check of channel)
+//! @param[in] channel GPIO channel
+//! @return Input state
+
+static inline bool twr_gpio_get_input_fast(twr_gpio_channel_t channel)
+{
+    return (twr_gpio_port[channel]->IDR & twr_gpio_16_bit_mask[channel]) != 0;
+}
+
+//! @brief Toggle output state of GPIO channel (inline, atomic by BSRR without disabling interrupts)
+//! @param[in] channel GPIO channel
+
+static inline void twr_gpio_toggle_output_fast(twr_gpio_channel_t channel)
+{
+    GPIO_TypeDef *port = twr_gpio_port[channel];
+
+    uint32_t mask = twr_gpio_16_bit_mask[channel];
+
+    // Pin being high is reset, pin being low is set, other pins of port are untouched
+    port->BSRR = (port->ODR & mask) != 0 ? mask << 16 : mask;
+}
+
+//! @brief Group of GPIO channels on the same port for multi-pin operations
+
+typedef struct
+{
+    //! @brief Port of channels
+    GPIO_TypeDef *port;
+
+    //! @brief Mask of channels in port
+    uint16_t mask;
+
+} twr_gpio_group_t;
+
+//! @brief Initialize group of GPIO channels, channels have to be on the same port
+//! @param[out] group Group instance
+//! @param[in] channels Array of GPIO channels
+//! @param[in] count Number of GPIO channels
+//! @return true On success
+//! @return false When channels are not on the same port
+
+bool twr_gpio_group_init(twr_gpio_group_t *group, const twr_gpio_channel_t *channels, size_t count);
+
+//! @brief Get mask of GPIO channel in its port, used to compose values of group
+//! @param[in] channel GPIO channel
+//! @return Mask of GPIO channel
+
+static inline uint16_t twr_gpio_get_mask(twr_gpio_channel_t channel)
+{
+    return twr_gpio_16_bit_mask[channel];
+}
+
+//! @brief Set outputs of group to high
+//! @param[in] group Group instance
+//! @param[in] mask Mask of channels to be set (masked by group)
+
+static inline void twr_gpio_group_set(const twr_gpio_group_t *group, uint16_t mask)
+{
+    group->port->BSRR = mask & group->mask;
+}
+
+//! @brief Set outputs of group to low
+//! @param[in] group Group instance
+//! @param[in] mask Mask of channels to be reset (masked by group)
+
+static inline void twr_gpio_group_reset(const twr_gpio_group_t *group, uint16_t mask)
+{
+    group->port->BRR = mask & group->mask;
+}
+
+//! @brief Write outputs of all channels in group at once
+//! @param[in] group Group instance
+//! @param[in] value Output states of channels in group (channels not in group are ignored)
+
+static inline void twr_gpio_group_write(const twr_gpio_group_t *group, uint16_t value)
+{
+    group->port->BSRR = ((uint32_t) (~value & group->mask) << 16) | (value & group->mask);
+}
+
+//! @brief Read inputs of all channels in group at once
+//! @param[in] group Group instance
+//! @return Input states of channels in group
+
+static inline uint16_t twr_gpio_group_read(const twr_gpio_group_t *group)
+{
+    return group->port->IDR & group->mask;
+}
+
 //! @}
 
 #endif // _TWR_GPIO_H
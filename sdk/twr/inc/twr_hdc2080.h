@@ -2,7 +2,8 @@
 #define _TWR_HDC2080_H
 
 #include <twr_i2c.h>
-#include <twr_scheduler.h>
+#include <twr_coroutine.h>
+#include <twr_exti.h>
 
 //! @addtogroup twr_hdc2080 twr_hdc2080
 //! @brief Driver for HDC2080 humidity sensor
@@ -16,26 +17,49 @@ typedef enum
     TWR_HDC2080_EVENT_ERROR = 0,
 
     //! @brief Update event
-    TWR_HDC2080_EVENT_UPDATE = 1
+    TWR_HDC2080_EVENT_UPDATE = 1,
+
+    //! @brief Threshold event, values have been updated by measurement beyond a threshold
+    TWR_HDC2080_EVENT_THRESHOLD = 2
 
 } twr_hdc2080_event_t;
 
+//! @brief Sampling rate of auto-measurement mode
+
+typedef enum
+{
+    //! @brief Auto-measurement disabled, measurement is triggered by MCU
+    TWR_HDC2080_AUTO_DISABLED = 0,
+
+    //! @brief One measurement every 2 minutes
+    TWR_HDC2080_AUTO_120_S = 1,
+
+    //! @brief One measurement every minute
+    TWR_HDC2080_AUTO_60_S = 2,
+
+    //! @brief One measurement every 10 seconds
+    TWR_HDC2080_AUTO_10_S = 3,
+
+    //! @brief One measurement every 5 seconds
+    TWR_HDC2080_AUTO_5_S = 4,
+
+    //! @brief One measurement every second
+    TWR_HDC2080_AUTO_1_S = 5,
+
+    //! @brief Two measurements every second
+    TWR_HDC2080_AUTO_500_MS = 6,
+
+    //! @brief Five measurements every second
+    TWR_HDC2080_AUTO_200_MS = 7
+
+} twr_hdc2080_auto_t;
+
 //! @brief HDC2080 instance
 
 typedef struct twr_hdc2080_t twr_hdc2080_t;
 
 //! @cond
 
-typedef enum
-{
-    TWR_HDC2080_STATE_ERROR = -1,
-    TWR_HDC2080_STATE_INITIALIZE = 0,
-    TWR_HDC2080_STATE_MEASURE = 1,
-    TWR_HDC2080_STATE_READ = 2,
-    TWR_HDC2080_STATE_UPDATE = 3
-
-} twr_hdc2080_state_t;
-
 struct twr_hdc2080_t
 {
     twr_i2c_channel_t _i2c_channel;
@@ -46,12 +70,21 @@ struct twr_hdc2080_t
     void *_event_param;
     bool _measurement_active;
     twr_tick_t _update_interval;
-    twr_hdc2080_state_t _state;
+    twr_coroutine_t _coroutine;
     twr_tick_t _tick_ready;
     bool _humidity_valid;
     bool _temperature_valid;
     uint16_t _reg_humidity;
     uint16_t _reg_temperature;
+    twr_i2c_async_t _transaction;
+    uint8_t _buffer[4];
+    twr_hdc2080_auto_t _auto;
+    bool _auto_configured;
+    bool _initialized;
+    twr_exti_line_t _exti_line;
+    bool _thresholds_enabled;
+    uint8_t _thresholds[4];
+    uint8_t _reg_interrupt;
 };
 
 //! @endcond
@@ -88,6 +121,31 @@ void twr_hdc2080_set_update_interval(twr_hdc2080_t *self, twr_tick_t interval);
 
 bool twr_hdc2080_measure(twr_hdc2080_t *self);
 
+//! @brief Set auto-measurement mode, in which sensor samples on its own and reports by DRDY/INT pin
+//!
+//! Pin is active high and it is cleared by reading the values, so MCU runs only when the values are read. Update event
+//! is raised after every measurement, or threshold event after every measurement beyond thresholds when they are set. Measurement started manually
+//! reads the last values. Update interval should not be used in this mode.
+//! @param[in] self Instance
+//! @param[in] rate Sampling rate (TWR_HDC2080_AUTO_DISABLED switches back to measurements triggered by MCU)
+//! @param[in] line EXTI line connected to DRDY/INT pin
+
+void twr_hdc2080_set_auto_measurement(twr_hdc2080_t *self, twr_hdc2080_auto_t rate, twr_exti_line_t line);
+
+//! @brief Set thresholds of auto-measurement mode, values have resolution of 8 bits
+//! @param[in] self Instance
+//! @param[in] temperature_low Event is raised when temperature is below (in degrees of Celsius)
+//! @param[in] temperature_high Event is raised when temperature is above (in degrees of Celsius)
+//! @param[in] humidity_low Event is raised when humidity is below (in percents)
+//! @param[in] humidity_high Event is raised when humidity is above (in percents)
+
+void twr_hdc2080_set_thresholds(twr_hdc2080_t *self, float temperature_low, float temperature_high, float humidity_low, float humidity_high);
+
+//! @brief Clear thresholds, update event is raised after every measurement of auto-measurement mode again
+//! @param[in] self Instance
+
+void twr_hdc2080_clear_thresholds(twr_hdc2080_t *self);
+
 //! @brief Get measured humidity as raw value
 //! @param[in] self Instance
 //! @param[in] raw Pointer to variable where result will be stored
@@ -0,0 +1,38 @@
+#ifndef _TWR_HRTICK_H
+#define _TWR_HRTICK_H
+
+#include <twr_common.h>
+
+//! @addtogroup twr_hrtick twr_hrtick
+//! @brief High-resolution monotonic timestamp in microseconds
+//!
+//! LPTIM1 runs from LSE without prescaler and its 16-bit counter is extended by counting overflows in interrupt.
+//! The clock keeps running in stop mode, which is left every 2 seconds to count the overflow. Resolution is one
+//! period of LSE (about 30.5 us) and the clock is locked to RTC, so it does not drift against tick. LPTIM1 is shared
+//! with hardware timing of twr_led, only one of them can run.
+//! @{
+
+//! @brief Start high-resolution clock (does nothing when already running)
+//! @return true On success
+//! @return false When LPTIM1 is used by hardware timing of LED
+
+bool twr_hrtick_init(void);
+
+//! @brief Check if high-resolution clock is running
+//! @return true When running
+
+bool twr_hrtick_is_running(void);
+
+//! @brief Get timestamp, can be called from interrupt and with interrupts disabled (interrupts are not disabled)
+//! @return Timestamp in microseconds since @ref twr_hrtick_init
+
+uint64_t twr_hrtick_get(void);
+
+//! @brief Get lower 32 bits of timestamp, cheaper for measuring short intervals
+//! @return Timestamp in microseconds, wraps around after about 71.6 minutes (compute differences in uint32_t)
+
+uint32_t twr_hrtick_get_32(void);
+
+//! @}
+
+#endif // _TWR_HRTICK_H
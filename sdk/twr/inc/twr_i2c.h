@@ -10,6 +10,24 @@
 //! @brief This flag extends I2C memory transfer address from 8-bit to 16-bit
 #define TWR_I2C_MEMORY_ADDRESS_16_BIT 0x80000000
 
+//! @brief Enable per-channel bus statistics
+
+#ifndef TWR_I2C_STATS
+#define TWR_I2C_STATS 0
+#endif
+
+//! @brief Enable timeouts derived from observed transfer times instead of fixed margin
+
+#ifndef TWR_I2C_ADAPTIVE_TIMEOUT
+#define TWR_I2C_ADAPTIVE_TIMEOUT 0
+#endif
+
+//! @brief Multiple of observed transfer time allowed before adaptive timeout expires
+
+#ifndef TWR_I2C_ADAPTIVE_TIMEOUT_FACTOR
+#define TWR_I2C_ADAPTIVE_TIMEOUT_FACTOR 4
+#endif
+
 //! @brief I2C channels
 
 typedef enum
@@ -33,7 +51,10 @@ typedef enum
     TWR_I2C_SPEED_100_KHZ = 0,
 
     //! @brief I2C communication speed is 400 kHz
-    TWR_I2C_SPEED_400_KHZ = 1
+    TWR_I2C_SPEED_400_KHZ = 1,
+
+    //! @brief I2C communication speed is 1 MHz (Fast-mode Plus, 900 kHz on TWR_I2C_I2C_1W)
+    TWR_I2C_SPEED_1_MHZ = 2
 
 } twr_i2c_speed_t;
 
@@ -70,6 +91,133 @@ typedef struct
 
 } twr_i2c_memory_transfer_t;
 
+//! @brief Number of registers tracked by one register shadow
+
+#ifndef TWR_I2C_SHADOW_SIZE
+#define TWR_I2C_SHADOW_SIZE 8
+#endif
+
+//! @brief Register shadow of one device, remembers values last written successfully
+
+typedef struct
+{
+    //! @cond
+
+    uint8_t memory_address[TWR_I2C_SHADOW_SIZE];
+    uint8_t value[TWR_I2C_SHADOW_SIZE];
+    uint8_t count;
+    uint8_t next;
+
+    //! @endcond
+
+} twr_i2c_shadow_t;
+
+//! @brief I2C batch item
+
+typedef struct
+{
+    //! @brief Direction of memory transfer, true for write, false for read
+    bool write;
+
+    //! @brief Memory transfer parameters
+    twr_i2c_memory_transfer_t transfer;
+
+    //! @brief Result of memory transfer, filled by twr_i2c_memory_batch
+    bool success;
+
+} twr_i2c_batch_t;
+
+#if TWR_I2C_STATS
+
+//! @brief I2C bus statistics
+
+typedef struct
+{
+    //! @brief Number of transactions
+    uint32_t transactions;
+
+    //! @brief Number of NACKs received
+    uint32_t nacks;
+
+    //! @brief Number of expired timeouts
+    uint32_t timeouts;
+
+    //! @brief Number of bus restores
+    uint32_t restores;
+
+    //! @brief Cumulative time of transactions in microseconds
+    uint64_t busy_time_us;
+
+} twr_i2c_stats_t;
+
+#endif
+
+//! @brief I2C asynchronous transaction type
+
+typedef enum
+{
+    //! @brief Write buffer to device
+    TWR_I2C_ASYNC_WRITE = 0,
+
+    //! @brief Read buffer from device
+    TWR_I2C_ASYNC_READ = 1,
+
+    //! @brief Write buffer to device memory
+    TWR_I2C_ASYNC_MEMORY_WRITE = 2,
+
+    //! @brief Read buffer from device memory
+    TWR_I2C_ASYNC_MEMORY_READ = 3
+
+} twr_i2c_async_type_t;
+
+//! @brief I2C asynchronous transaction events
+
+typedef enum
+{
+    //! @brief Transaction has been done
+    TWR_I2C_EVENT_ASYNC_DONE = 0,
+
+    //! @brief Transaction has failed (NACK, bus error or timeout)
+    TWR_I2C_EVENT_ASYNC_ERROR = 1
+
+} twr_i2c_event_t;
+
+//! @brief I2C asynchronous transaction descriptor
+//!
+//! Descriptor and its buffer have to stay valid until event handler is called.
+
+typedef struct twr_i2c_async_t twr_i2c_async_t;
+
+struct twr_i2c_async_t
+{
+    //! @brief Transaction type
+    twr_i2c_async_type_t type;
+
+    //! @brief 7-bit I2C device address
+    uint8_t device_address;
+
+    //! @brief 8-bit I2C memory address for memory transactions (it can be extended to 16-bit format if OR-ed with TWR_I2C_MEMORY_ADDRESS_16_BIT)
+    uint32_t memory_address;
+
+    //! @brief Pointer to buffer which is being written or read
+    void *buffer;
+
+    //! @brief Length of buffer which is being written or read
+    size_t length;
+
+    //! @brief Callback function called on finished transaction
+    void (*event_handler)(twr_i2c_channel_t, twr_i2c_event_t, void *);
+
+    //! @brief Optional event parameter
+    void *event_param;
+
+    //! @cond
+
+    twr_i2c_async_t *_next;
+
+    //! @endcond
+};
+
 //! @brief Initialize I2C channel
 //! @param[in] channel I2C channel
 //! @param[in] speed I2C communication speed
@@ -125,6 +273,52 @@ bool twr_i2c_memory_write(twr_i2c_channel_t channel, const twr_i2c_memory_transf
 
 bool twr_i2c_memory_read(twr_i2c_channel_t channel, const twr_i2c_memory_transfer_t *transfer);
 
+//! @brief Run batch of memory transfers on I2C channel back-to-back within one clock enable window (blocking call)
+//!
+//! Transfers may address different devices, a failed transfer does not stop the following ones.
+//! @param[in] channel I2C channel
+//! @param[in,out] batch Array of batch items, success member is updated for each item
+//! @param[in] count Number of batch items
+//! @return Number of successful transfers
+
+size_t twr_i2c_memory_batch(twr_i2c_channel_t channel, twr_i2c_batch_t *batch, size_t count);
+
+//! @brief Submit asynchronous transaction to I2C channel
+//!
+//! Transactions are queued per channel and transferred by I2C interrupts, so the core can sleep meanwhile.
+//! Event handler is called from scheduler task once transaction is finished.
+//! Blocking calls on the same channel wait for the transaction in progress to finish.
+//! @param[in] channel I2C channel (TWR_I2C_I2C0 or TWR_I2C_I2C1)
+//! @param[in] transaction Pointer to transaction descriptor
+//! @return true On success
+//! @return false On failure (channel not initialized, not supported or transaction longer than 255 bytes)
+
+bool twr_i2c_async_submit(twr_i2c_channel_t channel, twr_i2c_async_t *transaction);
+
+//! @brief Check if asynchronous transactions are pending on I2C channel
+//! @param[in] channel I2C channel
+//! @return true If any transaction is queued or in progress
+//! @return false Otherwise
+
+bool twr_i2c_async_is_busy(twr_i2c_channel_t channel);
+
+#if TWR_I2C_STATS
+
+//! @brief Get bus statistics of I2C channel
+//! @param[in] channel I2C channel (TWR_I2C_I2C0 or TWR_I2C_I2C1)
+//! @param[out] stats Pointer to statistics
+//! @return true On success
+//! @return false On channel without statistics
+
+bool twr_i2c_get_stats(twr_i2c_channel_t channel, twr_i2c_stats_t *stats);
+
+//! @brief Reset bus statistics of I2C channel
+//! @param[in] channel I2C channel (TWR_I2C_I2C0 or TWR_I2C_I2C1)
+
+void twr_i2c_stats_reset(twr_i2c_channel_t channel);
+
+#endif
+
 //! @brief Memory write 1 byte to I2C channel
 //! @param[in] channel I2C channel
 //! @param[in] device_address 7-bit I2C device address
@@ -141,6 +335,24 @@ bool twr_i2c_memory_write_8b(twr_i2c_channel_t channel, uint8_t device_address,
 
 bool twr_i2c_memory_write_16b(twr_i2c_channel_t channel, uint8_t device_address, uint32_t memory_address, uint16_t data);
 
+//! @brief Memory write 1 byte to I2C channel unless register shadow holds the same value
+//!
+//! Meant for configuration registers only, registers whose write triggers an action must not go through shadow.
+//! @param[in] channel I2C channel
+//! @param[in] device_address 7-bit I2C device address
+//! @param[in] memory_address 8-bit I2C memory address
+//! @param[in] data Input data to be written
+//! @param[in,out] shadow Register shadow of device
+//! @return true On success or when write has been skipped
+//! @return false On failure
+
+bool twr_i2c_memory_write_8b_shadow(twr_i2c_channel_t channel, uint8_t device_address, uint8_t memory_address, uint8_t data, twr_i2c_shadow_t *shadow);
+
+//! @brief Forget all values in register shadow (e.g. after device reset or communication error)
+//! @param[in,out] shadow Register shadow of device
+
+void twr_i2c_shadow_invalidate(twr_i2c_shadow_t *shadow);
+
 //! @brief Memory read 1 byte from I2C channel
 //! @param[in] channel I2C channel
 //! @param[in] device_address 7-bit I2C device address
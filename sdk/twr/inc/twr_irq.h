@@ -2,12 +2,52 @@
 #define _TWR_IRQ_H
 
 #include <twr_common.h>
+#include <stm32l0xx.h>
 
 //! @addtogroup twr_irq twr_irq
 //! @brief Functions for interrupt request manipulation
 //! @{
 
-//! @brief Disable interrupt requests globally (call can be nested)
+//! @brief Place interrupt handlers and their hot paths in RAM (no flash wait states nor flash wake-up latency)
+
+#ifndef TWR_IRQ_RAMFUNC
+#define TWR_IRQ_RAMFUNC 0
+#endif
+
+//! @brief Attribute of function placed in RAM, copied from flash by startup code together with initialized data
+//!
+//! Calls between RAM and flash are out of range of BL instruction, linker inserts veneers for them.
+
+#if TWR_IRQ_RAMFUNC
+#define TWR_RAMFUNC __attribute__ ((section(".ramfunc")))
+#else
+#define TWR_RAMFUNC
+#endif
+
+//! @brief Disable interrupt requests for critical section, state is kept by caller instead of shared counter
+//!
+//! Sections can be nested and mixed with @ref twr_irq_disable in both ways. Cortex-M0+ has no BASEPRI, so all
+//! interrupts are masked.
+//! @return Previous interrupt mask to be passed to @ref twr_irq_restore
+
+static inline uint32_t twr_irq_save(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    return primask;
+}
+
+//! @brief Leave critical section entered by @ref twr_irq_save
+//! @param[in] primask Interrupt mask returned by @ref twr_irq_save
+
+static inline void twr_irq_restore(uint32_t primask)
+{
+    __set_PRIMASK(primask);
+}
+
+//! @brief Disable interrupt requests globally (call can be nested, also across functions)
 
 void twr_irq_disable(void);
 
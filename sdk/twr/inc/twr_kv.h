@@ -0,0 +1,75 @@
+#ifndef _TWR_KV_H
+#define _TWR_KV_H
+
+#include <twr_common.h>
+
+//! @addtogroup twr_kv twr_kv
+//! @brief Log-structured key/value store in EEPROM
+//!
+//! Region of EEPROM is split into two halves, one of them is active and records are appended to it. Every record
+//! carries key, length, CRC16 and value, update of key appends new record and deletion appends record with empty
+//! value. Index of keys in RAM is built on initialization by scan of active half, which ends on the first record
+//! failing its CRC, e.g. torn by reset during write. When active half is full, live records are copied to the other
+//! half which becomes active when its header with higher generation is written, so content survives reset during
+//! compaction. Records left in the other half by interrupted compaction are invalidated before the next one. CRC is calculated by @ref twr_crc16, so the store must not be used from interrupt.
+//! @{
+
+//! @brief Maximum number of keys
+
+#ifndef TWR_KV_KEYS_MAX
+#define TWR_KV_KEYS_MAX 16
+#endif
+
+//! @brief Maximum length of value (up to 255)
+
+#ifndef TWR_KV_VALUE_SIZE_MAX
+#define TWR_KV_VALUE_SIZE_MAX 64
+#endif
+
+//! @brief Initialize store and build index of keys, region is formatted when it holds no valid half
+//! @param[in] address EEPROM start address of region (multiple of 4)
+//! @param[in] size Size of region in bytes
+//! @return true On success
+//! @return false When region is too small or EEPROM write fails
+
+bool twr_kv_init(uint32_t address, size_t size);
+
+//! @brief Set value of key, value equal to stored one is not written again
+//! @param[in] key Key
+//! @param[in] buffer Pointer to value
+//! @param[in] length Length of value (1 to TWR_KV_VALUE_SIZE_MAX)
+//! @return true On success
+//! @return false When value does not fit or EEPROM write fails
+
+bool twr_kv_set(uint16_t key, const void *buffer, size_t length);
+
+//! @brief Get value of key
+//! @param[in] key Key
+//! @param[out] buffer Pointer to destination buffer
+//! @param[in,out] length Size of destination buffer on input, length of value on output
+//! @return true On success
+//! @return false When key is not found or value does not fit into buffer
+
+bool twr_kv_get(uint16_t key, void *buffer, size_t *length);
+
+//! @brief Delete key
+//! @param[in] key Key
+//! @return true On success or when key is not found
+//! @return false When EEPROM write fails
+
+bool twr_kv_delete(uint16_t key);
+
+//! @brief Copy live records to the other half, called by set and delete when active half is full
+//! @return true On success
+//! @return false When EEPROM write fails
+
+bool twr_kv_compact(void);
+
+//! @brief Get number of bytes left in active half for appended records
+//! @return Number of bytes
+
+size_t twr_kv_get_free(void);
+
+//! @}
+
+#endif // _TWR_KV_H
@@ -0,0 +1,149 @@
+#ifndef _TWR_LATENCY_H
+#define _TWR_LATENCY_H
+
+#include <twr_common.h>
+
+//! @addtogroup twr_latency twr_latency
+//! @brief Latency probes of events from source to transmission
+//!
+//! Event is stamped by high-resolution clock (see @ref twr_hrtick) at its source (interrupt edge or scan detection),
+//! at entry of its handler and when its report is transmitted. Source stamps within TWR_LATENCY_BOUNCE of the first one
+//! are bounces and keep it, handler stamp without pending source and transmit stamp without pending handler are
+//! ignored. Events which are not reported have to be cancelled, so that they do not pair with unrelated
+//! transmission. Durations of stages are collected in histograms with two buckets per octave of microseconds,
+//! from which minimum, average, 99th percentile (upper bound of bucket) and maximum are computed. Hooks compile to
+//! nothing without @ref TWR_LATENCY.
+//! @{
+
+//! @brief Collect latency of events
+
+#ifndef TWR_LATENCY
+#define TWR_LATENCY 0
+#endif
+
+//! @brief Time in microseconds in which following source stamps are bounces of the first one
+
+#ifndef TWR_LATENCY_BOUNCE
+#define TWR_LATENCY_BOUNCE 50000
+#endif
+
+//! @brief Number of buckets of histogram, the last one covers durations from about 1 s up
+
+#ifndef TWR_LATENCY_BUCKETS
+#define TWR_LATENCY_BUCKETS 40
+#endif
+
+//! @brief Probes
+
+typedef enum
+{
+    //! @brief Button events of twr_button
+    TWR_LATENCY_PROBE_BUTTON = 0,
+
+    //! @brief Event defined by application
+    TWR_LATENCY_PROBE_USER = 1,
+
+    //! @brief Number of probes
+    TWR_LATENCY_PROBE_COUNT = 2
+
+} twr_latency_probe_t;
+
+//! @brief Measured stages
+
+typedef enum
+{
+    //! @brief From source to handler entry
+    TWR_LATENCY_STAGE_HANDLER = 0,
+
+    //! @brief From handler entry to transmit completion
+    TWR_LATENCY_STAGE_TRANSMIT = 1,
+
+    //! @brief From source to transmit completion
+    TWR_LATENCY_STAGE_TOTAL = 2,
+
+    //! @brief Number of stages
+    TWR_LATENCY_STAGE_COUNT = 3
+
+} twr_latency_stage_t;
+
+//! @brief Statistics of stage
+
+typedef struct
+{
+    //! @brief Number of events
+    uint32_t count;
+
+    //! @brief Minimum in microseconds
+    uint32_t min;
+
+    //! @brief Average in microseconds
+    uint32_t avg;
+
+    //! @brief 99th percentile in microseconds (upper bound of its bucket)
+    uint32_t p99;
+
+    //! @brief Maximum in microseconds
+    uint32_t max;
+
+} twr_latency_stats_t;
+
+#if TWR_LATENCY
+
+//! @brief Stamp source of event (callable from interrupt)
+//! @param[in] probe Probe
+
+#define twr_latency_source(probe) twr_latency_stamp((probe), 0)
+
+//! @brief Stamp entry of event handler
+//! @param[in] probe Probe
+
+#define twr_latency_handler(probe) twr_latency_stamp((probe), 1)
+
+//! @brief Stamp transmit completion of event report
+//! @param[in] probe Probe
+
+#define twr_latency_transmit(probe) twr_latency_stamp((probe), 2)
+
+//! @brief Drop event in flight, e.g. when handler does not report it
+//! @param[in] probe Probe
+
+#define twr_latency_cancel(probe) twr_latency_stamp((probe), 3)
+
+//! @brief Initialize probes and start high-resolution clock
+//! @return true On success
+//! @return false When high-resolution clock cannot be started
+
+bool twr_latency_init(void);
+
+//! @brief Stamp event (callable from interrupt), use hooks above instead
+//! @param[in] probe Probe
+//! @param[in] point 0 for source, 1 for handler entry, 2 for transmit completion, 3 for cancel
+
+void twr_latency_stamp(twr_latency_probe_t probe, int point);
+
+//! @brief Get statistics of stage
+//! @param[in] probe Probe
+//! @param[in] stage Stage
+//! @param[out] stats Statistics
+//! @return true When at least one event was measured
+//! @return false Otherwise
+
+bool twr_latency_get_stats(twr_latency_probe_t probe, twr_latency_stage_t stage, twr_latency_stats_t *stats);
+
+//! @brief Clear statistics of all stages of probe
+//! @param[in] probe Probe
+
+void twr_latency_reset(twr_latency_probe_t probe);
+
+#else
+
+#define twr_latency_source(probe) do { } while (0)
+#define twr_latency_handler(probe) do { } while (0)
+#define twr_latency_transmit(probe) do { } while (0)
+#define twr_latency_cancel(probe) do { } while (0)
+
+#endif
+
+//! @}
+
+#endif // _TWR_LATENCY_H
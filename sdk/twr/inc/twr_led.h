@@ -86,6 +86,9 @@ struct twr_led_t
     uint32_t _selector;
     int _count;
     bool _pulse_active;
+    bool _hardware;
+    bool _hardware_active;
+    twr_tick_t _tick_hardware_end;
     twr_scheduler_task_id_t _task_id;
 };
 
@@ -150,6 +153,18 @@ void twr_led_pulse(twr_led_t *self, twr_tick_t duration);
 
 bool twr_led_is_pulse(twr_led_t *self);
 
+//! @brief Enable or disable hardware timing of patterns (LED on P9 only)
+//!
+//! Periodic patterns with active slots at the beginning of period (all of blink and flash modes) are generated by
+//! LPTIM1 clocked from LSE, which runs in stop mode, so MCU wakes up only at the end of finite count. Other patterns
+//! and pulses are processed by scheduler task as without hardware timing, as are all patterns while twr_hrtick runs.
+//! @param[in] self Instance
+//! @param[in] enable Enable hardware timing
+//! @return true On success
+//! @return false When LED is virtual or it is not connected to P9 (LPTIM1_OUT)
+
+bool twr_led_set_hardware(twr_led_t *self, bool enable);
+
 //! @}
 
 #endif // _TWR_LED_H
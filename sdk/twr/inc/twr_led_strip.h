@@ -26,6 +26,9 @@ typedef struct
     bool (*write)(void);
     bool (*is_ready)(void);
 
+    // Optional, 256 B table applied to every color byte when pixel is encoded (NULL for linear output)
+    void (*set_lut)(const uint8_t *lut);
+
 } twr_led_strip_driver_t;
 
 typedef enum
@@ -34,6 +37,17 @@ typedef enum
 
 } twr_led_strip_event_t;
 
+// Keyframe of animation, colors of range are interpolated linearly in time and between first and last pixel
+typedef struct
+{
+    uint32_t color_first;
+    uint32_t color_last;
+
+    // Time of transition from previous keyframe (to the last one when looping to the first keyframe)
+    twr_tick_t duration;
+
+} twr_led_strip_keyframe_t;
+
 typedef struct twr_led_strip_t twr_led_strip_t;
 
 struct twr_led_strip_t
@@ -50,7 +64,27 @@ struct twr_led_strip_t
         twr_scheduler_task_id_t task_id;
 
     } _effect;
+
+    struct
+    {
+        const twr_led_strip_keyframe_t *keyframes;
+        int count;
+        int index;
+        int first;
+        int length;
+        bool loop;
+        twr_tick_t start;
+        twr_tick_t total;
+        twr_tick_t frame_interval;
+        bool rendered;
+        uint32_t color_first;
+        uint32_t color_last;
+
+    } _keyframes;
     uint8_t _brightness;
+    const uint8_t *_gamma;
+    bool _lut_active;
+    uint8_t _lut[256];
     void (*_event_handler)(twr_led_strip_t *, twr_led_strip_event_t, void *);
     void *_event_param;
 
@@ -78,6 +112,12 @@ bool twr_led_strip_is_ready(twr_led_strip_t *self);
 
 void twr_led_strip_set_brightness(twr_led_strip_t *self, uint8_t brightness);
 
+// Gamma table of 256 B combined with brightness into lookup table of strip (NULL for linear output)
+void twr_led_strip_set_gamma(twr_led_strip_t *self, const uint8_t *gamma);
+
+// Gamma 2.2 correction table for twr_led_strip_set_gamma
+extern const uint8_t twr_led_strip_gamma_2_2[256];
+
 void twr_led_strip_effect_stop(twr_led_strip_t *self);
 
 void twr_led_strip_effect_test(twr_led_strip_t *self);
@@ -101,6 +141,10 @@ void twr_led_strip_effect_icicle(twr_led_strip_t *self, uint32_t color, twr_tick
 
 void twr_led_strip_effect_pulse_color(twr_led_strip_t *self, uint32_t color, twr_tick_t wait);
 
+// Animate pixels first to first + length - 1 through keyframes (array has to stay valid), frame is rendered at most
+// every frame_interval and sent only when it differs from the previous one, keyframe holding color sleeps until its end
+void twr_led_strip_effect_keyframes(twr_led_strip_t *self, const twr_led_strip_keyframe_t *keyframes, int count, int first, int length, twr_tick_t frame_interval, bool loop);
+
 void twr_led_strip_thermometer(twr_led_strip_t *self, float temperature, float min, float max, uint8_t white_dots, float set_point, uint32_t color);
 
 #endif // _TWR_LED_STRIP_H
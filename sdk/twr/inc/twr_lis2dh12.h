@@ -4,6 +4,7 @@
 #include <twr_i2c.h>
 #include <twr_tick.h>
 #include <twr_scheduler.h>
+#include <twr_dice.h>
 
 //! @addtogroup twr_lis2dh12 twr_lis2dh12
 //! @brief Driver for LIS2DH12 3-axis MEMS accelerometer
@@ -20,7 +21,13 @@ typedef enum
     TWR_LIS2DH12_EVENT_UPDATE = 1,
 
     //! @brief Alarm event
-    TWR_LIS2DH12_EVENT_ALARM = 2
+    TWR_LIS2DH12_EVENT_ALARM = 2,
+
+    //! @brief Orientation change event
+    TWR_LIS2DH12_EVENT_ORIENTATION = 3,
+
+    //! @brief FIFO watermark event (block of samples is ready)
+    TWR_LIS2DH12_EVENT_FIFO = 4
 
 } twr_lis2dh12_event_t;
 
@@ -55,6 +62,37 @@ typedef enum
 
 } twr_lis2dh12_scale_t;
 
+//! @brief Output data rate
+
+typedef enum
+{
+    //! @brief 1 Hz
+    TWR_LIS2DH12_ODR_1HZ = 1,
+
+    //! @brief 10 Hz
+    TWR_LIS2DH12_ODR_10HZ = 2,
+
+    //! @brief 25 Hz
+    TWR_LIS2DH12_ODR_25HZ = 3,
+
+    //! @brief 50 Hz
+    TWR_LIS2DH12_ODR_50HZ = 4,
+
+    //! @brief 100 Hz
+    TWR_LIS2DH12_ODR_100HZ = 5,
+
+    //! @brief 200 Hz
+    TWR_LIS2DH12_ODR_200HZ = 6,
+
+    //! @brief 400 Hz
+    TWR_LIS2DH12_ODR_400HZ = 7
+
+} twr_lis2dh12_odr_t;
+
+//! @brief Depth of LIS2DH12 hardware FIFO in samples
+
+#define TWR_LIS2DH12_FIFO_SIZE 32
+
 //! @brief LIS2DH12 result in raw values
 
 typedef struct
@@ -101,6 +139,21 @@ typedef struct
 
 } twr_lis2dh12_alarm_t;
 
+//! @brief LIS2DH12 FIFO stream mode set structure
+
+typedef struct
+{
+    //! @brief Output data rate
+    twr_lis2dh12_odr_t odr;
+
+    //! @brief Number of samples which raise watermark interrupt (1 to 31)
+    uint8_t watermark;
+
+    //! @brief Buffer for block of raw samples (has to hold TWR_LIS2DH12_FIFO_SIZE samples)
+    twr_lis2dh12_result_raw_t *buffer;
+
+} twr_lis2dh12_fifo_t;
+
 //! @brief LIS2DH12 instance
 
 typedef struct twr_lis2dh12_t twr_lis2dh12_t;
@@ -134,6 +187,14 @@ struct twr_lis2dh12_t
     bool _measurement_active;
     twr_lis2dh12_resolution_t _resolution;
     twr_lis2dh12_scale_t _scale;
+    bool _orientation_active;
+    twr_scheduler_task_id_t _task_id_orientation;
+    twr_dice_face_t _face;
+    bool _fifo_active;
+    twr_lis2dh12_fifo_t _fifo;
+    size_t _fifo_count;
+    twr_scheduler_task_id_t _task_id_fifo;
+    twr_i2c_shadow_t _shadow;
 };
 
 //! @endcond
@@ -181,6 +242,14 @@ bool twr_lis2dh12_get_result_raw(twr_lis2dh12_t *self, twr_lis2dh12_result_raw_t
 
 bool twr_lis2dh12_get_result_g(twr_lis2dh12_t *self, twr_lis2dh12_result_g_t *result_g);
 
+//! @brief Get raw value corresponding to 1 g for configured scale
+//!
+//! Allows working with raw results in fixed point, e.g. to precompute thresholds in raw units.
+//! @param[in] self Instance
+//! @return Raw value of 1 g
+
+int16_t twr_lis2dh12_get_raw_one_g(twr_lis2dh12_t *self);
+
 //! @brief Enable or disable accelerometer threshold alarm
 //! @param[in] self Instance
 //! @param[in] alarm Pointer to structure with alarm configuration, if null then disable the alarm
@@ -189,6 +258,45 @@ bool twr_lis2dh12_get_result_g(twr_lis2dh12_t *self, twr_lis2dh12_result_g_t *re
 
 bool twr_lis2dh12_set_alarm(twr_lis2dh12_t *self, twr_lis2dh12_alarm_t *alarm);
 
+//! @brief Enable or disable orientation detection by 6D movement interrupt
+//!
+//! Accelerometer keeps running at 10 Hz in low-power mode and raises interrupt only when the position changes, which is
+//! then reported by @ref TWR_LIS2DH12_EVENT_ORIENTATION event. The interrupt uses the second interrupt generator, so it
+//! can be combined with the alarm. Call it again after scale change to update the threshold.
+//! @param[in] self Instance
+//! @param[in] enable Enable orientation detection
+//! @return true When configuration was successful
+//! @return false When configuration was not successful
+
+bool twr_lis2dh12_set_orientation_detection(twr_lis2dh12_t *self, bool enable);
+
+//! @brief Get last orientation detected by 6D movement interrupt as dice face
+//! @param[in] self Instance
+//! @param[out] face Pointer to variable where dice face will be stored
+//! @return true When orientation is known
+//! @return false When orientation is not known yet
+
+bool twr_lis2dh12_get_orientation(twr_lis2dh12_t *self, twr_dice_face_t *face);
+
+//! @brief Enable or disable FIFO stream mode
+//!
+//! Samples are collected by the hardware FIFO at given rate, on watermark interrupt all stored samples are read in a
+//! single I2C transfer into the buffer and @ref TWR_LIS2DH12_EVENT_FIFO event is raised. Periodic measurement is not
+//! available while FIFO stream mode is enabled.
+//! @param[in] self Instance
+//! @param[in] fifo Pointer to structure with FIFO configuration, if null then disable FIFO stream mode
+//! @return true When configuration was successful
+//! @return false When configuration was not successful
+
+bool twr_lis2dh12_set_fifo(twr_lis2dh12_t *self, twr_lis2dh12_fifo_t *fifo);
+
+//! @brief Get block of raw samples read from FIFO
+//! @param[in] self Instance
+//! @param[out] samples Pointer to variable where pointer to the first sample will be stored
+//! @return Number of samples in block
+
+size_t twr_lis2dh12_get_fifo_result_raw(twr_lis2dh12_t *self, const twr_lis2dh12_result_raw_t **samples);
+
 //! @brief Set resolution
 //! @param[in] self Instance
 //! @param[in] resolution
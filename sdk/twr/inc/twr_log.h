@@ -18,6 +18,69 @@
 
 #define TWR_LOG_DUMP_WIDTH 8
 
+//! @brief Asynchronous mode, formatted lines are queued in FIFO and drained to UART by scheduler task
+
+#ifndef TWR_LOG_ASYNC
+#define TWR_LOG_ASYNC 0
+#endif
+
+//! @brief Deferred mode, messages are not formatted but queued as binary records expanded on host (implies async)
+//!
+//! Every message is sent as record (multi-byte values little endian):
+//!
+//! | 0xa5 | length (1 B) | level letter (1 B) | format address (4 B) | tick (4 B) | arguments (length B) |
+//!
+//! Arguments follow conversions of format, integers and pointers take 4 B (8 B for ll), floating point values
+//! 8 B double and strings 1 B length followed by characters. Arguments of dump are followed by dumped bytes.
+//! Record with format address 0 reports number of dropped records (4 B). Host tool
+//! sdk/tools/twr_log_decode.py formats records using format strings from the ELF file of the firmware.
+
+#ifndef TWR_LOG_DEFERRED
+#define TWR_LOG_DEFERRED 0
+#endif
+
+//! @brief Size of FIFO for lines or records waiting for transmission in async and deferred mode
+
+#ifndef TWR_LOG_FIFO_SIZE
+#define TWR_LOG_FIFO_SIZE 512
+#endif
+
+//! @brief Overflow policy, message which does not fit into FIFO is dropped
+
+#define TWR_LOG_OVERFLOW_DROP_NEWEST 0
+
+//! @brief Overflow policy, oldest messages are dropped to make space for new one
+
+#define TWR_LOG_OVERFLOW_DROP_OLDEST 1
+
+//! @brief Overflow policy of FIFO in async and deferred mode, number of dropped messages is reported in log
+
+#ifndef TWR_LOG_OVERFLOW
+#define TWR_LOG_OVERFLOW TWR_LOG_OVERFLOW_DROP_NEWEST
+#endif
+
+//! @brief Output of log to UART, with 0 log goes only to RAM ring (see @ref TWR_LOG_RAM) and transport
+
+#ifndef TWR_LOG_UART_OUTPUT
+#define TWR_LOG_UART_OUTPUT 1
+#endif
+
+//! @brief Copy of log in RAM ring which survives reset, for post-mortem analysis of crashes and watchdog resets
+//!
+//! Ring is placed in .noinit section which is not cleared by startup. Header of ring is protected by magic and CRC,
+//! valid content is kept on initialization and separated from new messages by reset marker. Content is lost
+//! on power loss or when application uses the RAM before initialization of log.
+
+#ifndef TWR_LOG_RAM
+#define TWR_LOG_RAM 0
+#endif
+
+//! @brief Size of RAM ring in bytes
+
+#ifndef TWR_LOG_RAM_SIZE
+#define TWR_LOG_RAM_SIZE 1024
+#endif
+
 //! @brief Log level
 
 typedef enum
@@ -57,54 +120,198 @@ typedef enum
 
 } twr_log_timestamp_t;
 
+//! @brief Log module, each has its own runtime level
+
+typedef enum
+{
+    //! @brief Application (default module)
+    TWR_LOG_MODULE_APPLICATION = 0,
+
+    //! @brief System (startup, scheduler, info)
+    TWR_LOG_MODULE_SYSTEM = 1,
+
+    //! @brief Radio
+    TWR_LOG_MODULE_RADIO = 2,
+
+    //! @brief LoRa modem
+    TWR_LOG_MODULE_LORA = 3,
+
+    //! @brief 1-Wire bus and bridges
+    TWR_LOG_MODULE_ONEWIRE = 4,
+
+    //! @brief Sensors
+    TWR_LOG_MODULE_SENSOR = 5,
+
+    //! @brief Tower and CHESTER modules
+    TWR_LOG_MODULE_TOWER = 6
+
+} twr_log_module_t;
+
+//! @brief Number of log modules
+
+#define TWR_LOG_MODULE_COUNT 7
+
+//! @brief Minimum level of messages compiled in, calls below it are removed without evaluation of arguments
+
+#ifndef TWR_LOG_LEVEL_COMPILE
+#define TWR_LOG_LEVEL_COMPILE TWR_LOG_LEVEL_DUMP
+#endif
+
+//! @brief Module of messages logged from translation unit, define before the first include of the source file
+
+#ifndef TWR_LOG_MODULE
+#define TWR_LOG_MODULE TWR_LOG_MODULE_APPLICATION
+#endif
+
+//! @brief Log DUMP message of module TWR_LOG_MODULE (annotated in log as <X>)
+//! @param[in] buffer Pointer to source buffer
+//! @param[in] length Number of bytes to be printed
+//! @param[in] format Format string (printf style)
+//! @param[in] ... Optional format arguments
+
+#define twr_log_dump(...) do { if (TWR_LOG_LEVEL_DUMP >= TWR_LOG_LEVEL_COMPILE) { twr_log_module_dump(TWR_LOG_MODULE, __VA_ARGS__); } } while (0)
+
+//! @brief Log DEBUG message of module TWR_LOG_MODULE (annotated in log as <D>)
+//! @param[in] format Format string (printf style)
+//! @param[in] ... Optional format arguments
+
+#define twr_log_debug(...) do { if (TWR_LOG_LEVEL_DEBUG >= TWR_LOG_LEVEL_COMPILE) { twr_log_module_debug(TWR_LOG_MODULE, __VA_ARGS__); } } while (0)
+
+//! @brief Log INFO message of module TWR_LOG_MODULE (annotated in log as <I>)
+//! @param[in] format Format string (printf style)
+//! @param[in] ... Optional format arguments
+
+#define twr_log_info(...) do { if (TWR_LOG_LEVEL_INFO >= TWR_LOG_LEVEL_COMPILE) { twr_log_module_info(TWR_LOG_MODULE, __VA_ARGS__); } } while (0)
+
+//! @brief Log WARNING message of module TWR_LOG_MODULE (annotated in log as <W>)
+//! @param[in] format Format string (printf style)
+//! @param[in] ... Optional format arguments
+
+#define twr_log_warning(...) do { if (TWR_LOG_LEVEL_WARNING >= TWR_LOG_LEVEL_COMPILE) { twr_log_module_warning(TWR_LOG_MODULE, __VA_ARGS__); } } while (0)
+
+//! @brief Log ERROR message of module TWR_LOG_MODULE (annotated in log as <E>)
+//! @param[in] format Format string (printf style)
+//! @param[in] ... Optional format arguments
+
+#define twr_log_error(...) do { if (TWR_LOG_LEVEL_ERROR >= TWR_LOG_LEVEL_COMPILE) { twr_log_module_error(TWR_LOG_MODULE, __VA_ARGS__); } } while (0)
+
 #ifndef RELEASE
 
 //! @brief Initialize logging facility
-//! @param[in] level Minimum required message level for propagation
+//! @param[in] level Minimum required message level for propagation, set for all modules
 //! @param[in] timestamp Timestamp logging setting
 
 void twr_log_init(twr_log_level_t level, twr_log_timestamp_t timestamp);
 
-//! @brief Log DUMP message (annotated in log as <X>)
+//! @brief Set minimum required message level of one module
+//! @param[in] module Log module
+//! @param[in] level Minimum required message level for propagation
+
+void twr_log_set_module_level(twr_log_module_t module, twr_log_level_t level);
+
+//! @brief Get minimum required message level of one module
+//! @param[in] module Log module
+//! @return Minimum required message level
+
+twr_log_level_t twr_log_get_module_level(twr_log_module_t module);
+
+//! @brief Log DUMP message of module (annotated in log as <X>)
+//! @param[in] module Log module
 //! @param[in] buffer Pointer to source buffer
 //! @param[in] length Number of bytes to be printed
 //! @param[in] format Format string (printf style)
 //! @param[in] ... Optional format arguments
 
-void twr_log_dump(const void *buffer, size_t length, const char *format, ...) __attribute__ ((format (printf, 3, 4)));
+void twr_log_module_dump(twr_log_module_t module, const void *buffer, size_t length, const char *format, ...) __attribute__ ((format (printf, 4, 5)));
 
-//! @brief Log DEBUG message (annotated in log as <D>)
+//! @brief Log DEBUG message of module (annotated in log as <D>)
+//! @param[in] module Log module
 //! @param[in] format Format string (printf style)
 //! @param[in] ... Optional format arguments
 
-void twr_log_debug(const char *format, ...) __attribute__ ((format (printf, 1, 2)));
+void twr_log_module_debug(twr_log_module_t module, const char *format, ...) __attribute__ ((format (printf, 2, 3)));
 
-//! @brief Log INFO message (annotated in log as <I>)
+//! @brief Log INFO message of module (annotated in log as <I>)
+//! @param[in] module Log module
 //! @param[in] format Format string (printf style)
 //! @param[in] ... Optional format arguments
 
-void twr_log_info(const char *format, ...) __attribute__ ((format (printf, 1, 2)));
+void twr_log_module_info(twr_log_module_t module, const char *format, ...) __attribute__ ((format (printf, 2, 3)));
 
-//! @brief Log WARNING message (annotated in log as <W>)
+//! @brief Log WARNING message of module (annotated in log as <W>)
+//! @param[in] module Log module
 //! @param[in] format Format string (printf style)
 //! @param[in] ... Optional format arguments
 
-void twr_log_warning(const char *format, ...) __attribute__ ((format (printf, 1, 2)));
+void twr_log_module_warning(twr_log_module_t module, const char *format, ...) __attribute__ ((format (printf, 2, 3)));
 
-//! @brief Log ERROR message (annotated in log as <E>)
+//! @brief Log ERROR message of module (annotated in log as <E>)
+//! @param[in] module Log module
 //! @param[in] format Format string (printf style)
 //! @param[in] ... Optional format arguments
 
-void twr_log_error(const char *format, ...) __attribute__ ((format (printf, 1, 2)));
+void twr_log_module_error(twr_log_module_t module, const char *format, ...) __attribute__ ((format (printf, 2, 3)));
+
+//! @brief Set transport which receives every message in addition to UART output (call after initialization)
+//!
+//! With TWR_LOG_UART_OUTPUT 0 transport is the only output besides RAM ring. Messages are passed in the form of
+//! UART output (lines or deferred records) and are dropped while transport is not ready.
+//! @param[in] transport Pointer to initialized transport, NULL to stop output to transport
+
+void twr_log_set_transport(twr_transport_t *transport);
+
+//! @brief Get number of messages dropped on full FIFO in async and deferred mode since initialization
+//! @return Number of dropped messages
+
+uint32_t twr_log_get_dropped(void);
+
+//! @brief Get number of bytes kept in RAM ring
+//! @return Number of bytes (0 without @ref TWR_LOG_RAM)
+
+size_t twr_log_ram_get_length(void);
+
+//! @brief Read from RAM ring
+//! @param[in] offset Offset from the oldest byte
+//! @param[out] buffer Pointer to destination buffer
+//! @param[in] length Size of destination buffer
+//! @return Number of bytes read
+
+size_t twr_log_ram_read(size_t offset, void *buffer, size_t length);
+
+//! @brief Write content of RAM ring to UART (blocking)
+//! @param[in] channel UART channel, has to be initialized
+
+void twr_log_ram_dump(twr_uart_channel_t channel);
+
+//! @brief Clear RAM ring
+
+void twr_log_ram_clear(void);
+
+//! @brief ATCI action printing content of RAM ring
+//! @return true Always
+
+bool twr_log_ram_atci_action(void);
+
+//! @brief ATCI command printing content of RAM ring
+
+#define TWR_LOG_ATCI_COMMAND_RAM {"$LOG", twr_log_ram_atci_action, NULL, NULL, NULL, "Print log preserved in RAM"}
 
 #else
 
 #define twr_log_init(...)
-#define twr_log_dump(...)
-#define twr_log_debug(...)
-#define twr_log_info(...)
-#define twr_log_warning(...)
-#define twr_log_error(...)
+#define twr_log_set_module_level(...)
+#define twr_log_get_module_level(...) TWR_LOG_LEVEL_OFF
+#define twr_log_set_transport(...)
+#define twr_log_module_dump(...)
+#define twr_log_module_debug(...)
+#define twr_log_module_info(...)
+#define twr_log_module_warning(...)
+#define twr_log_module_error(...)
+#define twr_log_get_dropped() 0
+#define twr_log_ram_get_length() 0
+#define twr_log_ram_read(...) 0
+#define twr_log_ram_dump(...)
+#define twr_log_ram_clear(...)
 
 #endif
 
@@ -8,6 +8,12 @@
 //! @brief Driver for LP8 CO2 sensor
 //! @{
 
+//! @brief Interval of storing sensor state in key/value store (in milliseconds)
+
+#ifndef TWR_LP8_STATE_INTERVAL
+#define TWR_LP8_STATE_INTERVAL (60 * 60 * 1000)
+#endif
+
 //! @brief Callback events
 
 typedef enum
@@ -148,6 +154,12 @@ struct twr_lp8_t
     int16_t _concentration;
     uint16_t _pressure;
     twr_lp8_error_t _error;
+    bool _state_enabled;
+    uint16_t _state_key;
+    twr_tick_t _tick_state;
+    bool _charge_hold;
+    bool _charging;
+    twr_tick_t _tick_charged;
 
 };
 
@@ -199,6 +211,25 @@ bool twr_lp8_get_error(twr_lp8_t *self, twr_lp8_error_t *error);
 
 void twr_lp8_calibration(twr_lp8_t *self, twr_lp8_calibration_t calibration);
 
+//! @brief Enable persistence of sensor state in key/value store (see twr_kv), store has to be initialized by application
+//!
+//! Sensor state (filters and ABC data) is stored after the first measurement and then every @ref TWR_LP8_STATE_INTERVAL.
+//! It is restored on initialization, so the first measurement after reset continues in sequential mode instead of
+//! starting filters from scratch. Call right after init.
+//! @param[in] self Instance
+//! @param[in] key Key in key/value store
+
+void twr_lp8_set_state_key(twr_lp8_t *self, uint16_t key);
+
+//! @brief Keep capacitor charging between measurements
+//!
+//! Measurement then starts as soon as it is requested once the capacitor has been charged for 5 seconds since the
+//! previous one, instead of always waiting for 5 seconds of precharge. Meant for short update intervals.
+//! @param[in] self Instance
+//! @param[in] hold Enable or disable charging between measurements
+
+void twr_lp8_set_charge_hold(twr_lp8_t *self, bool hold);
+
 //! @}
 
 #endif // _TWR_LP8_H
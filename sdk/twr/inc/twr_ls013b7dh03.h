@@ -3,6 +3,7 @@
 
 #include <twr_gfx.h>
 #include <twr_scheduler.h>
+#include <twr_spi.h>
 
 //! @addtogroup twr_ls013b7dh03 twr_ls013b7dh03
 //! @brief Driver for LS013B7DH03 1.28" HR-TFT Memory LCD
@@ -30,10 +31,21 @@
 
 typedef struct
 {
-    uint8_t _framebuffer[TWR_LS013B7DH03_FRAMEBUFFER_SIZE];
+    uint8_t _buffer[TWR_LS013B7DH03_FRAMEBUFFER_SIZE];
+    uint8_t *_framebuffer;
+    uint8_t *_spare;
+    uint8_t *_transfer;
+    bool _update_pending;
     uint8_t _vcom;
     twr_scheduler_task_id_t _task_id;
     bool (*_pin_cs_set)(bool state);
+    twr_spi_transaction_t _spi_transaction;
+    bool _spi_pending;
+    int _dirty_first;
+    int _dirty_last;
+    uint32_t _mode_offset;
+    uint32_t _end_offset;
+    uint8_t _end_byte;
 
 } twr_ls013b7dh03_t;
 
@@ -47,7 +59,18 @@ void twr_ls013b7dh03_init(twr_ls013b7dh03_t *self, bool (*pin_cs_set)(bool state
 
 twr_gfx_caps_t twr_ls013b7dh03_get_caps(twr_ls013b7dh03_t *self);
 
-//! @brief Check if lcd is ready for commands
+//! @brief Enable or disable double buffering
+//!
+//! Drawing goes to one buffer while the other one is transferred, so the next frame can be drawn without waiting
+//! for the previous update. Update during transfer is postponed until the transfer is done.
+//! @param[in] self Instance
+//! @param[in] buffer Second buffer of TWR_LS013B7DH03_FRAMEBUFFER_SIZE bytes (NULL disables double buffering)
+//! @return true On success
+//! @return false When transfer is in progress
+
+bool twr_ls013b7dh03_set_double_buffer(twr_ls013b7dh03_t *self, uint8_t *buffer);
+
+//! @brief Check if lcd is ready for commands, with double buffering lcd is always ready for drawing
 //! @param[in] self Instance
 //! @return true If ready
 //! @return false If not ready
@@ -75,7 +98,40 @@ void twr_ls013b7dh03_draw_pixel(twr_ls013b7dh03_t *self, int x, int y, uint32_t
 
 uint32_t twr_ls013b7dh03_get_pixel(twr_ls013b7dh03_t *self, int x, int y);
 
+//! @brief Lcd draw horizontal span
+//! @param[in] self Instance
+//! @param[in] left Pixels from left edge
+//! @param[in] top Pixels from top edge
+//! @param[in] length Number of pixels
+//! @param[in] color Pixels state
+
+void twr_ls013b7dh03_draw_span(twr_ls013b7dh03_t *self, int left, int top, int length, uint32_t color);
+
+//! @brief Lcd draw 1bpp bitmap, cleared bits are drawn
+//! @param[in] self Instance
+//! @param[in] left Pixels from left edge
+//! @param[in] top Pixels from top edge
+//! @param[in] image Rows of (width + 7) / 8 bytes MSB first
+//! @param[in] width Bitmap width in pixels
+//! @param[in] height Bitmap height in pixels
+//! @param[in] color Pixels state
+
+void twr_ls013b7dh03_draw_bitmap(twr_ls013b7dh03_t *self, int left, int top, const uint8_t *image, int width, int height, uint32_t color);
+
+//! @brief Lcd draw 1bpp image by whole framebuffer bytes, all pixels are drawn
+//! @param[in] self Instance
+//! @param[in] left Pixels from left edge
+//! @param[in] top Pixels from top edge
+//! @param[in] image Rows of (width + 7) / 8 bytes LSB first, set bits are drawn in color 1
+//! @param[in] width Image width in pixels
+//! @param[in] height Image height in pixels
+
+void twr_ls013b7dh03_draw_image(twr_ls013b7dh03_t *self, int left, int top, const uint8_t *image, int width, int height);
+
 //! @brief Lcd update, send data
+//!
+//! Only the span of lines changed since the last update is sent, update without changes sends nothing.
+//! With double buffering update during transfer sends the frame after the transfer is done.
 //! @param[in] self Instance
 //! @return true On success
 //! @return false On failure
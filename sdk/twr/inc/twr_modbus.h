@@ -0,0 +1,127 @@
+#ifndef _TWR_MODBUS_H
+#define _TWR_MODBUS_H
+
+#include <twr_module_rs485.h>
+
+//! @addtogroup twr_modbus twr_modbus
+//! @brief Modbus RTU master on RS-485 Module
+//!
+//! Requests are queued and sent one after another as soon as the previous response has been received and the bus has
+//! been silent for 3.5 character times. Read requests of the same slave and function with adjacent or overlapping
+//! register ranges, which follow each other in queue, are coalesced into one transaction. Response ends when its
+//! expected length is received, or by RX timeout of UART bridge (silence of 4 character times) for shorter frames.
+//! Asynchronous reading of RS-485 Module cannot be used at the same time.
+//! @{
+
+//! @brief Maximum number of registers read by one transaction
+
+#define TWR_MODBUS_READ_COUNT_MAX 125
+
+//! @brief Maximum number of registers written by one transaction
+
+#define TWR_MODBUS_WRITE_COUNT_MAX 123
+
+//! @brief Function codes
+
+typedef enum
+{
+    //! @brief Read holding registers
+    TWR_MODBUS_FUNCTION_READ_HOLDING_REGISTERS = 0x03,
+
+    //! @brief Read input registers
+    TWR_MODBUS_FUNCTION_READ_INPUT_REGISTERS = 0x04,
+
+    //! @brief Write single register
+    TWR_MODBUS_FUNCTION_WRITE_SINGLE_REGISTER = 0x06,
+
+    //! @brief Write multiple registers
+    TWR_MODBUS_FUNCTION_WRITE_MULTIPLE_REGISTERS = 0x10
+
+} twr_modbus_function_t;
+
+//! @brief Results of request
+
+typedef enum
+{
+    //! @brief Request done
+    TWR_MODBUS_RESULT_OK = 0,
+
+    //! @brief No response in time
+    TWR_MODBUS_RESULT_TIMEOUT = 1,
+
+    //! @brief Response with wrong CRC, address, function or length
+    TWR_MODBUS_RESULT_FRAME = 2,
+
+    //! @brief Exception response, exception code is in request
+    TWR_MODBUS_RESULT_EXCEPTION = 3,
+
+    //! @brief Communication with RS-485 Module failed
+    TWR_MODBUS_RESULT_ERROR = 4
+
+} twr_modbus_result_t;
+
+//! @brief Request
+
+typedef struct twr_modbus_request_t twr_modbus_request_t;
+
+struct twr_modbus_request_t
+{
+    //! @brief Slave address (0 for broadcast write without response)
+    uint8_t slave;
+
+    //! @brief Function code
+    twr_modbus_function_t function;
+
+    //! @brief Address of the first register
+    uint16_t address;
+
+    //! @brief Number of registers (1 for write single register)
+    uint16_t count;
+
+    //! @brief Registers read or registers to write
+    uint16_t *registers;
+
+    //! @brief Callback function called when request is done (can be NULL)
+    void (*callback)(twr_modbus_request_t *request, twr_modbus_result_t result, void *param);
+
+    //! @brief Optional parameter passed to callback function
+    void *param;
+
+    //! @brief Exception code of exception response
+    uint8_t exception;
+
+    //! @cond
+
+    twr_modbus_request_t *_next;
+
+    //! @endcond
+};
+
+//! @brief Initialize Modbus RTU master, RS-485 Module has to be initialized before
+//! @param[in] baudrate Baudrate
+//! @return true On success
+//! @return false When baudrate cannot be set
+
+bool twr_modbus_init(twr_module_rs485_baudrate_t baudrate);
+
+//! @brief Set response timeout measured from the end of request (100 ms by default)
+//! @param[in] timeout Response timeout
+
+void twr_modbus_set_timeout(twr_tick_t timeout);
+
+//! @brief Queue request, it has to stay valid until its callback is called
+//! @param[in] request Request
+//! @return true When request is queued
+//! @return false When request is invalid or master is not initialized
+
+bool twr_modbus_submit(twr_modbus_request_t *request);
+
+//! @brief Check if no request is queued
+//! @return true When no request is queued
+//! @return false When any request is queued or in progress
+
+bool twr_modbus_is_idle(void);
+
+//! @}
+
+#endif // _TWR_MODBUS_H
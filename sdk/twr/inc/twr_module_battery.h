@@ -78,6 +78,17 @@ bool twr_module_battery_measure(void);
 
 bool twr_module_battery_get_voltage(float *voltage);
 
+//! @brief Measure Battery Module voltage right away without events
+//!
+//! Format has to be already detected by regular measurement. Presence and format detection and internal reference
+//! measurement are skipped, VDDA from the last measurement is used. Result is also returned by
+//! @ref twr_module_battery_get_voltage.
+//! @param[out] voltage Measured voltage
+//! @return true On success
+//! @return false When format is not known yet, measurement or other ADC conversion is in progress or voltage is invalid
+
+bool twr_module_battery_measure_voltage(float *voltage);
+
 //! @brief Get Battery Module charge in percents
 //! @param[out] percentage Measured charge
 //! @return true On success
@@ -33,7 +33,10 @@ typedef enum
     TWR_MODULE_CLIMATE_EVENT_UPDATE_LUX_METER = 6,
 
     //! @brief Update event for barometer
-    TWR_MODULE_CLIMATE_EVENT_UPDATE_BAROMETER = 7
+    TWR_MODULE_CLIMATE_EVENT_UPDATE_BAROMETER = 7,
+
+    //! @brief Update event for all sensors measured in synchronized mode
+    TWR_MODULE_CLIMATE_EVENT_UPDATE_ALL_SENSORS = 8
 
 } twr_module_climate_event_t;
 
@@ -84,6 +87,15 @@ void twr_module_climate_set_update_interval_lux_meter(twr_tick_t interval);
 
 void twr_module_climate_set_update_interval_barometer(twr_tick_t interval);
 
+//! @brief Set measurement interval for all sensors measured together
+//!
+//! All sensors start conversion in one window and the results are read together when the slowest one is done.
+//! Update events of individual sensors are replaced by single @ref TWR_MODULE_CLIMATE_EVENT_UPDATE_ALL_SENSORS,
+//! error events are still reported for every sensor. Intervals of individual sensors are stopped.
+//! @param[in] interval Measurement interval, TWR_TICK_INFINITY stops synchronized mode
+
+void twr_module_climate_set_update_interval_synchronized(twr_tick_t interval);
+
 //! @brief Start measurement of all sensors manually
 //! @return true On success
 //! @return false When other measurement is in progress
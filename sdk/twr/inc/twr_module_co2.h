@@ -60,6 +60,16 @@ bool twr_module_co2_get_error(twr_lp8_error_t *error);
 
 void twr_module_co2_calibration(twr_lp8_calibration_t calibration);
 
+//! @brief Enable persistence of sensor state in key/value store (see twr_lp8_set_state_key), call right after init
+//! @param[in] key Key in key/value store
+
+void twr_module_co2_set_state_key(uint16_t key);
+
+//! @brief Keep capacitor charging between measurements (see twr_lp8_set_charge_hold)
+//! @param[in] hold Enable or disable charging between measurements
+
+void twr_module_co2_set_charge_hold(bool hold);
+
 //! @}
 
 #endif // _TWR_MODULE_CO2_H
@@ -76,6 +76,11 @@ bool twr_module_gps_init(void);
 
 void twr_module_gps_set_event_handler(twr_module_gps_event_handler_t event_handler, void *event_param);
 
+//! @brief Set output protocol of navigation module
+//! @param[in] protocol Output protocol
+
+void twr_module_gps_set_protocol(twr_sam_m8q_protocol_t protocol);
+
 //! @brief Start tracking
 
 void twr_module_gps_start(void);
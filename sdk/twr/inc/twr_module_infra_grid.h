@@ -4,6 +4,7 @@
 #include <twr_i2c.h>
 #include <twr_tca9534a.h>
 #include <twr_scheduler.h>
+#include <twr_exti.h>
 
 //! @addtogroup twr_module_infra_grid twr_module_infra_grid
 //! @brief Library to communicate with Infra Grid Module with Panasonic AMG8833 Grid-EYE sensor
@@ -17,7 +18,10 @@ typedef enum
     TWR_MODULE_INFRA_GRID_EVENT_ERROR = 0,
 
     //! @brief Update event
-    TWR_MODULE_INFRA_GRID_EVENT_UPDATE = 1
+    TWR_MODULE_INFRA_GRID_EVENT_UPDATE = 1,
+
+    //! @brief Alert event, follows update event when some pixel is in interrupt table
+    TWR_MODULE_INFRA_GRID_EVENT_ALERT = 2
 
 } twr_module_infra_grid_event_t;
 
@@ -73,6 +77,15 @@ struct twr_module_infra_grid_t
 
     bool _enable_sleep;
     bool _cmd_sleep;
+    bool _awake;
+
+    int16_t _thermistor;
+    uint8_t _interrupt_table[8];
+    bool _alert_active;
+    twr_exti_line_t _alert_line;
+    int16_t _alert_low;
+    int16_t _alert_high;
+    int16_t _alert_hysteresis;
 
 };
 
@@ -116,6 +129,52 @@ bool twr_module_infra_grid_read_values(twr_module_infra_grid_t *self);
 
 bool twr_module_infra_grid_get_temperatures_celsius(twr_module_infra_grid_t *self, float *values);
 
+//! @brief Get measured temperatures of pixels in raw format
+//! @param[in] self Instance
+//! @param[out] values Pointer to array of size 64 where temperatures in 0.25 degrees of Celsius will be stored
+//! @return true When values are valid
+//! @return false When values are invalid
+
+bool twr_module_infra_grid_get_temperatures_raw(twr_module_infra_grid_t *self, int16_t *values);
+
+//! @brief Get thermistor temperature read together with the last frame
+//! @param[in] self Instance
+//! @param[out] raw Pointer to variable where temperature in 0.0625 degrees of Celsius will be stored
+//! @return true When value is valid
+//! @return false When value is invalid
+
+bool twr_module_infra_grid_get_thermistor_raw(twr_module_infra_grid_t *self, int16_t *raw);
+
+//! @brief Enable wake-up by INT output when temperature of some pixel leaves the band
+//!
+//! Sensor is kept powered and running at 1 FPS, INT output reports pixels above high or below low threshold
+//! (absolute interrupt mode) and measurement is started by its falling edge, so MCU reads frames only when
+//! something happens. Pixel stays in interrupt table until its temperature returns into the band by hysteresis,
+//! during that time INT is asserted again with every frame. Update interval can be kept as a heartbeat.
+//! INT is open drain and active low, the line has to be configured as input with pull-up.
+//! @param[in] self Instance
+//! @param[in] line EXTI line connected to INT output
+//! @param[in] low Low threshold in 0.25 degrees of Celsius
+//! @param[in] high High threshold in 0.25 degrees of Celsius
+//! @param[in] hysteresis Hysteresis in 0.25 degrees of Celsius
+//! @return true On success
+//! @return false When thresholds are out of range of sensor or low is not below high
+
+bool twr_module_infra_grid_set_alert(twr_module_infra_grid_t *self, twr_exti_line_t line, int16_t low, int16_t high, int16_t hysteresis);
+
+//! @brief Disable wake-up by INT output, sensor is powered down between measurements again
+//! @param[in] self Instance
+
+void twr_module_infra_grid_clear_alert(twr_module_infra_grid_t *self);
+
+//! @brief Get pixels which were in interrupt table of the last frame
+//! @param[in] self Instance
+//! @param[out] mask Pointer to variable where mask will be stored, bit n stands for pixel n
+//! @return true When value is valid
+//! @return false When value is invalid
+
+bool twr_module_infra_grid_get_alert_pixels(twr_module_infra_grid_t *self, uint64_t *mask);
+
 //! @brief Read and return thermistor temperature sensor value
 //! @param[in] self Instance
 //! @return value in degreen of Celsius
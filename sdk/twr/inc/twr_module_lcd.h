@@ -7,6 +7,7 @@
 #include <twr_led.h>
 #include <twr_button.h>
 #include <twr_gfx.h>
+#include <twr_ls013b7dh03.h>
 
 //! @addtogroup twr_module_lcd twr_module_lcd
 //! @brief Driver for lcd
@@ -178,6 +179,13 @@ void twr_module_lcd_draw_image(int left, int top, const twr_image_t *img);
 
 bool twr_module_lcd_update(void);
 
+//! @brief Lcd enable double buffering, drawing of the next frame can start while update is transferred
+//! @param[in] buffer Buffer of TWR_LS013B7DH03_FRAMEBUFFER_SIZE bytes (NULL disables double buffering)
+//! @return true On success
+//! @return false When update is in progress
+
+bool twr_module_lcd_set_double_buffer(uint8_t *buffer);
+
 //! @brief Lcd set font
 //! @param[in] *font Font
 
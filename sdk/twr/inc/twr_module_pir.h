@@ -58,6 +58,12 @@ void twr_module_pir_set_event_handler(twr_module_pir_t *self, void (*event_handl
 //! @param[in] sensitivity Desired sensitivity
 
 void twr_module_pir_set_sensitivity(twr_module_pir_t *self, twr_module_pir_sensitivity_t sensitivity);
+
+//! @brief Wake up on motion event instead of checking sensor every 100 ms (see twr_pyq1648_set_wake_on_event)
+//! @param[in] self Instance
+
+void twr_module_pir_set_wake_on_event(twr_module_pir_t *self);
+
 //! @}
 
 #endif // _TWR_MODULE_PIR_H
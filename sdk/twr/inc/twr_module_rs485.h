@@ -95,6 +95,21 @@ bool twr_module_rs485_available(size_t *available);
 
 size_t twr_module_rs485_read(uint8_t *buffer, size_t length, twr_tick_t timeout);
 
+//! @brief Use IRQ output of UART bridge connected to EXTI line, so that reading does not poll the bridge and asynchronous
+//! reading and writing continue as soon as data come or space is free
+//! @param[in] line EXTI line connected to IRQ output
+//! @return true On success
+//! @return false On failure
+
+bool twr_module_rs485_set_irq(twr_exti_line_t line);
+
+//! @brief Get whether the bus has been silent for 4 character times since the last received byte still in FIFO
+//! @param[out] rx_timeout RX timeout pending
+//! @return true On success
+//! @return false On failure
+
+bool twr_module_rs485_get_rx_timeout(bool *rx_timeout);
+
 //! @brief Set baudrate
 //! @param[in] self Instance
 //! @param[in] baudrate
@@ -3,11 +3,30 @@
 
 #include <twr_td1207r.h>
 #include <twr_wssfm10r1at.h>
+#include <twr_payload.h>
 
 //! @addtogroup twr_module_sigfox twr_module_sigfox
 //! @brief Driver for HARDWARIO SigFox Module
 //! @{
 
+//! @brief Maximum number of fields of uplink schema
+
+#ifndef TWR_MODULE_SIGFOX_UPLINK_FIELDS_MAX
+#define TWR_MODULE_SIGFOX_UPLINK_FIELDS_MAX 16
+#endif
+
+//! @brief Default number of uplinks per day, SigFox allows 140 messages per day
+
+#ifndef TWR_MODULE_SIGFOX_UPLINK_BUDGET
+#define TWR_MODULE_SIGFOX_UPLINK_BUDGET 140
+#endif
+
+//! @brief Time in milliseconds for which values set at once are collected before uplink
+
+#ifndef TWR_MODULE_SIGFOX_UPLINK_MERGE_DELAY
+#define TWR_MODULE_SIGFOX_UPLINK_MERGE_DELAY 1000
+#endif
+
 //! @brief SigFox Module hardware revision
 
 typedef enum
@@ -58,6 +77,12 @@ struct twr_module_sigfox_t
         twr_td1207r_t td1207r;
         twr_wssfm10r1at_t wssfm10r1at;
     } _modem;
+    const twr_payload_schema_t *_uplink_schema;
+    float _uplink_value[TWR_MODULE_SIGFOX_UPLINK_FIELDS_MAX];
+    bool _uplink_pending;
+    twr_tick_t _uplink_interval;
+    twr_tick_t _uplink_tick_next;
+    twr_scheduler_task_id_t _uplink_task_id;
 };
 
 //! @endcond
@@ -90,6 +115,34 @@ bool twr_module_sigfox_is_ready(twr_module_sigfox_t *self);
 
 bool twr_module_sigfox_send_rf_frame(twr_module_sigfox_t *self, const void *buffer, size_t length);
 
+//! @brief Set schema of scheduled uplinks
+//!
+//! Values set by @ref twr_module_sigfox_set_uplink_value are packed by schema into one RF frame. Value set again
+//! before uplink replaces the previous one, values set within TWR_MODULE_SIGFOX_UPLINK_MERGE_DELAY share uplink
+//! and uplinks are spaced evenly to keep daily budget. Every uplink carries the latest value of every field, field
+//! which has not been set yet is sent as not available.
+//! @param[in] self Instance
+//! @param[in] schema Pointer to schema (has to stay valid), packed payload must fit into 12 bytes
+//! @return true On success
+//! @return false When schema has too many fields or its payload does not fit into RF frame
+
+bool twr_module_sigfox_set_uplink_schema(twr_module_sigfox_t *self, const twr_payload_schema_t *schema);
+
+//! @brief Set daily budget of scheduled uplinks
+//! @param[in] self Instance
+//! @param[in] budget Number of uplinks per day (default TWR_MODULE_SIGFOX_UPLINK_BUDGET)
+
+void twr_module_sigfox_set_uplink_budget(twr_module_sigfox_t *self, int budget);
+
+//! @brief Set value of uplink field and schedule uplink
+//! @param[in] self Instance
+//! @param[in] field Index of field in schema
+//! @param[in] value Value (NAN when not available)
+//! @return true On success
+//! @return false When schema is not set or field does not exist
+
+bool twr_module_sigfox_set_uplink_value(twr_module_sigfox_t *self, size_t field, float value);
+
 //! @brief Read device ID command
 //! @param[in] self Instance
 //! @return true If command was accepted for processing
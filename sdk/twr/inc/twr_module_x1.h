@@ -5,8 +5,24 @@
 
 //! @addtogroup twr_module_x1 twr_module_x1
 //! @brief Driver for X1 Module
+//!
+//! Every wake-up of DS2484 costs several I2C transactions, so 1-Wire bus lingers for TWR_MODULE_X1_ONEWIRE_LINGER
+//! after the last transaction. Measurements of drivers registered by @ref twr_module_x1_register_measurement are
+//! started together in measurement window, so their transactions follow each other and share wake-ups of the bus.
 //! @{
 
+//! @brief Time in ticks the 1-Wire bus stays awake after the last transaction
+
+#ifndef TWR_MODULE_X1_ONEWIRE_LINGER
+#define TWR_MODULE_X1_ONEWIRE_LINGER 20
+#endif
+
+//! @brief Maximum number of measurements started in window
+
+#ifndef TWR_MODULE_X1_MEASUREMENT_COUNT
+#define TWR_MODULE_X1_MEASUREMENT_COUNT 4
+#endif
+
 //! @brief Initialize X1 Module
 //! @return true On success
 //! @return false On Error
@@ -18,6 +34,19 @@ bool twr_module_x1_init(void);
 
 twr_onewire_t *twr_module_x1_get_onewire(void);
 
+//! @brief Register measurement started in every window, e.g. twr_ds18b20_measure of sensors on X1 bus
+//! @param[in] measure Function starting measurement of driver
+//! @param[in] param Parameter passed to function (driver instance)
+//! @return true On success
+//! @return false When TWR_MODULE_X1_MEASUREMENT_COUNT measurements are registered
+
+bool twr_module_x1_register_measurement(bool (*measure)(void *), void *param);
+
+//! @brief Set interval of measurement windows
+//! @param[in] interval Interval in ticks, TWR_TICK_INFINITY stops windows
+
+void twr_module_x1_set_update_interval(twr_tick_t interval);
+
 //! @}
 
 #endif // _TWR_MODULE_X1_H
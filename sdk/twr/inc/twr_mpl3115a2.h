@@ -3,11 +3,16 @@
 
 #include <twr_i2c.h>
 #include <twr_scheduler.h>
+#include <twr_exti.h>
 
 //! @addtogroup twr_mpl3115a2 twr_mpl3115a2
 //! @brief Driver for MPL3115A2 pressure/altitude sensor
 //! @{
 
+//! @brief Number of samples of FIFO
+
+#define TWR_MPL3115A2_FIFO_SIZE 32
+
 //! @brief Callback events
 
 typedef enum
@@ -16,10 +21,48 @@ typedef enum
     TWR_MPL3115A2_EVENT_ERROR = 0,
 
     //! @brief Update event
-    TWR_MPL3115A2_EVENT_UPDATE = 1
+    TWR_MPL3115A2_EVENT_UPDATE = 1,
+
+    //! @brief FIFO samples have been read
+    TWR_MPL3115A2_EVENT_FIFO = 2
 
 } twr_mpl3115a2_event_t;
 
+//! @brief Quantity sampled into FIFO
+
+typedef enum
+{
+    //! @brief Altitude in meters
+    TWR_MPL3115A2_FIFO_ALTITUDE = 0,
+
+    //! @brief Pressure in Pascal
+    TWR_MPL3115A2_FIFO_PRESSURE = 1
+
+} twr_mpl3115a2_fifo_mode_t;
+
+//! @brief Auto-acquisition period (power of two seconds)
+
+typedef enum
+{
+    TWR_MPL3115A2_PERIOD_1_S = 0,
+    TWR_MPL3115A2_PERIOD_2_S = 1,
+    TWR_MPL3115A2_PERIOD_4_S = 2,
+    TWR_MPL3115A2_PERIOD_8_S = 3,
+    TWR_MPL3115A2_PERIOD_16_S = 4,
+    TWR_MPL3115A2_PERIOD_32_S = 5,
+    TWR_MPL3115A2_PERIOD_64_S = 6,
+    TWR_MPL3115A2_PERIOD_128_S = 7,
+    TWR_MPL3115A2_PERIOD_256_S = 8,
+    TWR_MPL3115A2_PERIOD_512_S = 9,
+    TWR_MPL3115A2_PERIOD_1024_S = 10,
+    TWR_MPL3115A2_PERIOD_2048_S = 11,
+    TWR_MPL3115A2_PERIOD_4096_S = 12,
+    TWR_MPL3115A2_PERIOD_8192_S = 13,
+    TWR_MPL3115A2_PERIOD_16384_S = 14,
+    TWR_MPL3115A2_PERIOD_32768_S = 15
+
+} twr_mpl3115a2_period_t;
+
 //! @brief MPL3115A2 instance
 
 typedef struct twr_mpl3115a2_t twr_mpl3115a2_t;
@@ -34,7 +77,9 @@ typedef enum
     TWR_MPL3115A2_STATE_READ_ALTITUDE = 2,
     TWR_MPL3115A2_STATE_MEASURE_PRESSURE = 3,
     TWR_MPL3115A2_STATE_READ_PRESSURE = 4,
-    TWR_MPL3115A2_STATE_UPDATE = 5
+    TWR_MPL3115A2_STATE_UPDATE = 5,
+    TWR_MPL3115A2_STATE_FIFO_CONFIGURE = 6,
+    TWR_MPL3115A2_STATE_FIFO_READ = 7
 
 } twr_mpl3115a2_state_t;
 
@@ -62,6 +107,13 @@ struct twr_mpl3115a2_t
     uint8_t _reg_out_p_lsb_pressure;
     uint8_t _reg_out_t_msb_pressure;
     uint8_t _reg_out_t_lsb_pressure;
+    twr_mpl3115a2_fifo_mode_t _fifo_mode;
+    twr_mpl3115a2_period_t _fifo_period;
+    uint8_t _fifo_watermark;
+    bool _fifo_irq;
+    twr_exti_line_t _fifo_irq_line;
+    size_t _fifo_count;
+    uint8_t _fifo[TWR_MPL3115A2_FIFO_SIZE * 5];
 };
 
 //! @endcond
@@ -114,6 +166,37 @@ bool twr_mpl3115a2_get_altitude_meter(twr_mpl3115a2_t *self, float *meter);
 
 bool twr_mpl3115a2_get_pressure_pascal(twr_mpl3115a2_t *self, float *pascal);
 
+//! @brief Start auto-acquisition into FIFO, samples are read in one burst when watermark is reached
+//!
+//! Sensor samples on its own every period and FIFO keeps the newest 32 samples. FIFO is read by a timed wake-up
+//! after every watermark periods, or by watermark interrupt when INT1 pin is set (see twr_mpl3115a2_set_fifo_irq).
+//! One-shot measurements cannot be started meanwhile.
+//! @param[in] self Instance
+//! @param[in] mode Quantity sampled into FIFO
+//! @param[in] period Auto-acquisition period
+//! @param[in] watermark Number of samples read at once (1 to 32)
+
+void twr_mpl3115a2_fifo_start(twr_mpl3115a2_t *self, twr_mpl3115a2_fifo_mode_t mode, twr_mpl3115a2_period_t period, uint8_t watermark);
+
+//! @brief Stop auto-acquisition into FIFO and return to one-shot measurements
+//! @param[in] self Instance
+
+void twr_mpl3115a2_fifo_stop(twr_mpl3115a2_t *self);
+
+//! @brief Read FIFO on watermark interrupt of INT1 pin instead of timed wake-up, set before twr_mpl3115a2_fifo_start
+//! @param[in] self Instance
+//! @param[in] line EXTI line connected to INT1 pin
+
+void twr_mpl3115a2_set_fifo_irq(twr_mpl3115a2_t *self, twr_exti_line_t line);
+
+//! @brief Get samples of the last FIFO read, the oldest first (call on TWR_MPL3115A2_EVENT_FIFO)
+//! @param[in] self Instance
+//! @param[out] values Altitudes in meters or pressures in Pascal depending on FIFO mode
+//! @param[in] count Size of values array
+//! @return Number of samples stored into values array
+
+size_t twr_mpl3115a2_fifo_get(twr_mpl3115a2_t *self, float *values, size_t count);
+
 //! @}
 
 #endif // _TWR_MPL3115A2_H
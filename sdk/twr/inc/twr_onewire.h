@@ -2,6 +2,7 @@
 #define _TWR_ONEWIRE_H
 
 #include <twr_gpio.h>
+#include <twr_scheduler.h>
 
 //! @addtogroup twr_onewire twr_onewire
 //! @brief Driver for 1-Wire
@@ -26,6 +27,8 @@ typedef struct
     void (*write_byte)(void *ctx, uint8_t byte);
     uint8_t (*read_byte)(void *ctx);
     bool (*search_next)(void *ctx, twr_onewire_t *onewire, uint64_t *device_number);
+    void (*write)(void *ctx, const void *buffer, size_t length);
+    void (*read)(void *ctx, void *buffer, size_t length);
 
 } twr_onewire_driver_t;
 
@@ -40,6 +43,10 @@ struct twr_onewire_t
     void *_driver_ctx;
     const twr_onewire_driver_t *_driver;
     bool _auto_ds28e17_sleep_mode;
+    bool _enabled;
+    twr_tick_t _linger;
+    twr_scheduler_task_id_t _linger_task_id;
+    bool _linger_task_registered;
 };
 
 //! @endcond
@@ -162,6 +169,25 @@ void twr_onewire_search_start(twr_onewire_t *self, uint8_t family_code);
 
 bool twr_onewire_search_next(twr_onewire_t *self, uint64_t *device_number);
 
+//! @brief Verify presence of device with given number
+//!
+//! Runs single targeted search pass, which is much faster than searching the whole bus.
+//! @param[in] self Instance
+//! @param[in] device_number 64b device number
+//! @return true If device is present on the bus
+//! @return false If device is not present
+
+bool twr_onewire_verify(twr_onewire_t *self, uint64_t *device_number);
+
+//! @brief Keep driver enabled for a while after the last transaction
+//!
+//! Transactions of all drivers on the bus that follow each other within linger time share one enable of the driver,
+//! e.g. one wake-up of 1-Wire master behind I2C. DS28E17 sleep mode is then entered when the bus is disabled.
+//! @param[in] self Instance
+//! @param[in] linger Time in ticks, 0 disables driver right after each transaction (default)
+
+void twr_onewire_set_linger(twr_onewire_t *self, twr_tick_t linger);
+
 //! @brief Enable call sleep mode for all ds28e17 after transaction
 //! @param[in] on
 
@@ -2,13 +2,23 @@
 #define _TWR_ONEWIRE_RELAY_H
 
 #include <twr_onewire.h>
+#include <twr_tick.h>
 
 #define TWR_ONEWIRE_RELAY_FAMILY_CODE 0x29
 
 //! @addtogroup twr_onewire_relay twr_onewire_relay
 //! @brief Driver for HARDWARIO 1-wire relay, chipset: DS2408
+//!
+//! Several channels are switched by one 1-Wire write with @ref twr_onewire_relay_set_states. Ends of pulses of all
+//! relays are kept in one queue served by single scheduler task, ends due at the same time are written once per relay.
 //! @{
 
+//! @brief Number of pulses pending at once over all relays
+
+#ifndef TWR_ONEWIRE_RELAY_PULSE_COUNT
+#define TWR_ONEWIRE_RELAY_PULSE_COUNT 8
+#endif
+
 typedef enum
 {
     TWR_ONEWIRE_RELAY_CHANNEL_Q1 = 0,
@@ -50,6 +60,27 @@ bool twr_onewire_relay_init(twr_onewire_relay_t *self, twr_onewire_t *onewire, u
 
 bool twr_onewire_relay_set_state(twr_onewire_relay_t *self, twr_onewire_relay_channel_t relay_channel, bool state);
 
+//! @brief Set several channels by one write
+//! @param[in] self Instance
+//! @param[in] mask Channels to be set, bit per channel (bit 0 is Q1)
+//! @param[in] states Desired states of channels in mask, set bit switches channel on
+//! @return true On success
+//! @return false On failure
+
+bool twr_onewire_relay_set_states(twr_onewire_relay_t *self, uint8_t mask, uint8_t states);
+
+//! @brief Set channels for duration, then set them to the opposite state
+//!
+//! Pulse replaces pending pulse of the same channel.
+//! @param[in] self Instance
+//! @param[in] mask Channels to be pulsed, bit per channel (bit 0 is Q1)
+//! @param[in] states States of channels during pulse, set bit switches channel on
+//! @param[in] duration Pulse duration in ticks
+//! @return true On success
+//! @return false On failure or when TWR_ONEWIRE_RELAY_PULSE_COUNT pulses are pending
+
+bool twr_onewire_relay_pulse(twr_onewire_relay_t *self, uint8_t mask, uint8_t states, twr_tick_t duration);
+
 //! @brief Get current relay state
 //! @param[in] self Instance
 //! @param[in] channel
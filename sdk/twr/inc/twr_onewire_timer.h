@@ -0,0 +1,26 @@
+#ifndef _TWR_ONEWIRE_TIMER_H
+#define _TWR_ONEWIRE_TIMER_H
+
+#include <twr_onewire.h>
+#include <twr_gpio.h>
+
+//! @addtogroup twr_onewire twr_onewire_timer
+//! @brief Driver for 1-Wire with slots generated by timer
+//!
+//! Low pulses of reset and bit slots are generated by TIM2 channel 1 in PWM mode and fed by DMA on every update,
+//! the line level is sampled by input capture of the rising edge. Timing does not depend on CPU, so interrupts stay
+//! enabled during transfers. TIM2 and DMA channels for TIM2 update and capture/compare 2 are taken for the whole
+//! transaction, PWM on P0 to P3 and twr_ws2812b can not be used at the same time.
+//! @{
+
+//! @brief Initialize 1-Wire
+//! @param[in] onewire Instance 1-Wire
+//! @param[in] channel GPIO channel, only TWR_GPIO_P0 and TWR_GPIO_P5 are connected to TIM2 channel 1
+//! @return true On success
+//! @return false When GPIO channel can not be driven by timer
+
+bool twr_onewire_timer_init(twr_onewire_t *onewire, twr_gpio_channel_t channel);
+
+//! @}
+
+#endif // _TWR_ONEWIRE_TIMER_H
@@ -2,7 +2,8 @@
 #define _TWR_OPT3001_H
 
 #include <twr_i2c.h>
-#include <twr_scheduler.h>
+#include <twr_exti.h>
+#include <twr_sensor.h>
 
 //! @addtogroup twr_opt3001 twr_opt3001
 //! @brief Driver for OPT3001 ambient light sensor
@@ -26,30 +27,18 @@ typedef struct twr_opt3001_t twr_opt3001_t;
 
 //! @cond
 
-typedef enum
-{
-    TWR_OPT3001_STATE_ERROR = -1,
-    TWR_OPT3001_STATE_INITIALIZE = 0,
-    TWR_OPT3001_STATE_MEASURE = 1,
-    TWR_OPT3001_STATE_READ = 2,
-    TWR_OPT3001_STATE_UPDATE = 3
-
-} twr_opt3001_state_t;
-
 struct twr_opt3001_t
 {
     twr_i2c_channel_t _i2c_channel;
     uint8_t _i2c_address;
-    twr_scheduler_task_id_t _task_id_interval;
-    twr_scheduler_task_id_t _task_id_measure;
+    twr_sensor_t _sensor;
     void (*_event_handler)(twr_opt3001_t *, twr_opt3001_event_t, void *);
     void *_event_param;
-    bool _measurement_active;
-    twr_tick_t _update_interval;
-    twr_opt3001_state_t _state;
-    twr_tick_t _tick_ready;
     bool _illuminance_valid;
     uint16_t _reg_result;
+    bool _alert_active;
+    twr_exti_line_t _alert_line;
+    float _alert_delta;
 };
 
 //! @endcond
@@ -79,6 +68,25 @@ void twr_opt3001_set_event_handler(twr_opt3001_t *self, void (*event_handler)(tw
 
 void twr_opt3001_set_update_interval(twr_opt3001_t *self, twr_tick_t interval);
 
+//! @brief Enable wake-up by INT output when illuminance leaves the window around the last measured value
+//!
+//! Sensor is switched to continuous conversion with automatic full-scale range (800 ms) and INT in latched window
+//! mode. Every measurement, including the one triggered by INT, moves the window around its result, so with a long
+//! update interval the sensor is read only when light level changes. INT is open drain and active low, the line has
+//! to be configured as input with pull-up.
+//! @param[in] self Instance
+//! @param[in] line EXTI line connected to INT output
+//! @param[in] delta Half width of the window relative to the last value (e.g. 0.2 for 20 %)
+//! @return true On success
+//! @return false When delta is not positive
+
+bool twr_opt3001_set_alert(twr_opt3001_t *self, twr_exti_line_t line, float delta);
+
+//! @brief Disable wake-up by INT output
+//! @param[in] self Instance
+
+void twr_opt3001_clear_alert(twr_opt3001_t *self);
+
 //! @brief Start measurement manually
 //! @param[in] self Instance
 //! @return true On success
@@ -0,0 +1,80 @@
+#ifndef _TWR_PAYLOAD_H
+#define _TWR_PAYLOAD_H
+
+#include <twr_common.h>
+
+//! @addtogroup twr_payload twr_payload
+//! @brief Bit-packed binary payload described by schema of fields, e.g. for LoRaWAN uplinks
+//!
+//! Every field is quantized to integer code (value - minimum) / resolution, rounded and clamped to range, and packed
+//! MSB first with the smallest number of bits which holds all codes of range plus one. The all-ones code marks value
+//! which is not available (NAN). Payload length is given by schema only, so receiver decodes it with the same schema.
+//! For example temperature -40 to 85 with resolution 0.1 takes 11 bits and humidity 0 to 100 with resolution 0.5
+//! takes 8 bits, both together 3 bytes instead of 8 characters of hexadecimal string.
+//! @{
+
+//! @brief Maximum number of bits of one field
+
+#define TWR_PAYLOAD_FIELD_BITS_MAX 32
+
+//! @brief Field of payload
+
+typedef struct
+{
+    //! @brief Minimum value
+    float minimum;
+
+    //! @brief Maximum value
+    float maximum;
+
+    //! @brief Resolution of value (step between codes)
+    float resolution;
+
+} twr_payload_field_t;
+
+//! @brief Schema of payload
+
+typedef struct
+{
+    //! @brief Pointer to array of fields in order of packing
+    const twr_payload_field_t *field;
+
+    //! @brief Number of fields
+    size_t count;
+
+} twr_payload_schema_t;
+
+//! @brief Get number of bits of field
+//! @param[in] field Pointer to field
+//! @return Number of bits or 0 when range does not fit into TWR_PAYLOAD_FIELD_BITS_MAX bits
+
+int twr_payload_get_field_bits(const twr_payload_field_t *field);
+
+//! @brief Get length of payload
+//! @param[in] schema Pointer to schema
+//! @return Length of payload in bytes or 0 when schema has invalid field
+
+size_t twr_payload_get_length(const twr_payload_schema_t *schema);
+
+//! @brief Pack values to payload
+//! @param[in] schema Pointer to schema
+//! @param[in] value Pointer to array of values, one for every field (NAN when not available)
+//! @param[out] buffer Pointer to destination buffer
+//! @param[in] size Size of destination buffer
+//! @return Length of payload in bytes or 0 when payload does not fit into buffer
+
+size_t twr_payload_pack(const twr_payload_schema_t *schema, const float *value, uint8_t *buffer, size_t size);
+
+//! @brief Unpack values from payload
+//! @param[in] schema Pointer to schema
+//! @param[in] buffer Pointer to payload
+//! @param[in] length Length of payload
+//! @param[out] value Pointer to array of values, one for every field (NAN when not available)
+//! @return true On success
+//! @return false When payload is shorter than schema
+
+bool twr_payload_unpack(const twr_payload_schema_t *schema, const uint8_t *buffer, size_t length, float *value);
+
+//! @}
+
+#endif // _TWR_PAYLOAD_H
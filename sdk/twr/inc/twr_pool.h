@@ -0,0 +1,92 @@
+#ifndef _TWR_POOL_H
+#define _TWR_POOL_H
+
+#include <twr_common.h>
+
+//! @addtogroup twr_pool twr_pool
+//! @brief Pool of fixed-size buffers with reference counting
+//!
+//! Buffer is taken with reference count 1, every layer which keeps it (e.g. encoder, queue, radio) adds reference and
+//! releases it when done, so it is handed over without copying and returns to pool with the last release. Functions
+//! can be called from interrupt. Shared pool serves scratch buffers of SDK (formatting of twr_atci and twr_log), which
+//! are held only during a call, so a single block replaces a private buffer in every user.
+//! @{
+
+//! @brief Size of block of shared pool (has to hold TWR_LOG_BUFFER_SIZE)
+
+#ifndef TWR_POOL_SHARED_BLOCK_SIZE
+#define TWR_POOL_SHARED_BLOCK_SIZE 256
+#endif
+
+//! @brief Number of blocks of shared pool, raise when scratch users nest (e.g. logging from interrupt)
+
+#ifndef TWR_POOL_SHARED_BLOCKS
+#define TWR_POOL_SHARED_BLOCKS 1
+#endif
+
+//! @brief Maximum number of blocks of pool
+
+#define TWR_POOL_BLOCKS_MAX 32
+
+//! @brief Pool instance
+
+typedef struct
+{
+    //! @cond
+
+    uint8_t *_storage;
+    size_t _block_size;
+    size_t _count;
+    uint32_t _free;
+    uint8_t _references[TWR_POOL_BLOCKS_MAX];
+
+    //! @endcond
+
+} twr_pool_t;
+
+//! @brief Initialize pool
+//! @param[in] self Instance
+//! @param[in] storage Storage of blocks (count * block_size bytes, aligned to 4 bytes)
+//! @param[in] block_size Size of block in bytes (multiple of 4)
+//! @param[in] count Number of blocks (up to TWR_POOL_BLOCKS_MAX)
+
+void twr_pool_init(twr_pool_t *self, void *storage, size_t block_size, size_t count);
+
+//! @brief Take free buffer with reference count 1
+//! @param[in] self Instance
+//! @return Pointer to buffer or NULL when pool is exhausted
+
+void *twr_pool_alloc(twr_pool_t *self);
+
+//! @brief Add reference to buffer
+//! @param[in] self Instance
+//! @param[in] buffer Pointer to buffer taken from pool
+
+void twr_pool_ref(twr_pool_t *self, void *buffer);
+
+//! @brief Release reference to buffer, buffer returns to pool with the last one
+//! @param[in] self Instance
+//! @param[in] buffer Pointer to buffer taken from pool (can be NULL)
+
+void twr_pool_unref(twr_pool_t *self, void *buffer);
+
+//! @brief Get size of block
+//! @param[in] self Instance
+//! @return Size of block in bytes
+
+size_t twr_pool_get_block_size(twr_pool_t *self);
+
+//! @brief Get number of free blocks
+//! @param[in] self Instance
+//! @return Number of free blocks
+
+size_t twr_pool_get_free(twr_pool_t *self);
+
+//! @brief Get shared pool of TWR_POOL_SHARED_BLOCKS blocks of TWR_POOL_SHARED_BLOCK_SIZE bytes
+//! @return Instance
+
+twr_pool_t *twr_pool_get_shared(void);
+
+//! @}
+
+#endif // _TWR_POOL_H
@@ -56,6 +56,17 @@ void twr_pulse_counter_set_event_handler(twr_module_sensor_channel_t channel, vo
 
 void twr_pulse_counter_set_update_interval(twr_module_sensor_channel_t channel, twr_tick_t interval);
 
+//! @brief Set deferred reporting of pulses
+//!
+//! By default every pulse plans task which dispatches update event. In deferred mode interrupt only increments
+//! the counter and update event is dispatched by update interval task when the count has changed, so meters with
+//! high pulse rate do not run scheduler on every pulse (overflow is still reported immediately). Pins of Sensor
+//! Module channels can not be routed to LPTIM1 input, so pulses are still counted by EXTI interrupt.
+//! @param[in] channel Sensor Module channel pulse counter is connected to
+//! @param[in] deferred Deferred reporting enabled
+
+void twr_pulse_counter_set_deferred(twr_module_sensor_channel_t channel, bool deferred);
+
 //! @brief Set count
 //! @param[in] channel Sensor Module channel pulse counter is connected to
 //! @param[in] count Count to be set
@@ -3,6 +3,7 @@
 
 #include <twr_system.h>
 #include <twr_gpio.h>
+#include <twr_dma.h>
 #include <stm32l0xx.h>
 
 //! @addtogroup twr_pwm twr_pwm
@@ -65,6 +66,28 @@ void twr_pwm_set(twr_pwm_channel_t channel, uint16_t pwm_value);
 
 void twr_pwm_tim_configure(twr_pwm_tim_t tim, uint32_t resolution_us, uint32_t period_cycles);
 
+//! @brief Play sequence of duty values moved by timer DMA burst, one frame at every PWM period
+//!
+//! Channels of a frame change in lockstep and no task runs until the sequence is done. Frame holds duty values of
+//! consecutive compare registers from the first to the last channel, in order P0 P1 P2 P3 for TIM2 and P7 (unused
+//! compare register 2) P8 P6 for TIM3. TIM21 has no DMA request. Channels keep the last values when sequence is done.
+//! @param[in] first First channel of frame
+//! @param[in] last Last channel of frame on the same timer
+//! @param[in] sequence Frames of duty values, has to stay valid until done
+//! @param[in] count Number of frames
+//! @param[in] circular Repeat sequence until stopped
+//! @param[in] event_handler Function called from task when sequence is done (can be NULL)
+//! @param[in] event_param Optional event parameter (can be NULL)
+//! @return true On success
+//! @return false If channels cannot be used, sequence of the timer is playing or DMA channel is taken
+
+bool twr_pwm_burst_start(twr_pwm_channel_t first, twr_pwm_channel_t last, const uint16_t *sequence, size_t count, bool circular, void (*event_handler)(twr_pwm_tim_t, void *), void *event_param);
+
+//! @brief Stop sequence of duty values
+//! @param[in] tim Timer
+
+void twr_pwm_burst_stop(twr_pwm_tim_t tim);
+
 //! @}
 
 #endif // _TWR_PWM_H
@@ -4,6 +4,7 @@
 #include <twr_tick.h>
 #include <twr_gpio.h>
 #include <twr_scheduler.h>
+#include <twr_exti.h>
 
 //! @addtogroup twr_pyq1648 twr_pyq1648
 //! @brief Driver for PYQ1648 PIR sensor
@@ -67,6 +68,7 @@ struct twr_pyq1648_t
     twr_tick_t _aware_time;
     twr_tick_t _ignore_untill;
     twr_scheduler_task_id_t _task_id;
+    bool _wake_on_event;
 };
 
 //! @endcond
@@ -97,6 +99,15 @@ void twr_pyq1648_set_sensitivity(twr_pyq1648_t *self, twr_pyq1648_sensitivity_t
 
 void twr_pyq1648_set_blank_period(twr_pyq1648_t *self, twr_tick_t blank_period);
 
+//! @brief Wake up on rising edge of DL pin instead of checking it every 100 ms
+//!
+//! Blank period is handled by blind time of sensor in this mode (0.5 s to 8 s in steps of 0.5 s), so nothing runs
+//! between motion events. It cannot be switched back.
+//! @param[in] self Instance
+//! @param[in] line EXTI line of DL pin
+
+void twr_pyq1648_set_wake_on_event(twr_pyq1648_t *self, twr_exti_line_t line);
+
 //! @}
 
 #endif // _TWR_PYQ1648_H
@@ -5,8 +5,41 @@
 
 //! @addtogroup twr_queue twr_queue
 //! @brief Queue handling functions
+//!
+//! Messages of variable length are stored in circular buffer, each one is prefixed by one byte length (up to 127 bytes)
+//! or two bytes length (up to @ref TWR_QUEUE_MESSAGE_LENGTH_MAX bytes). Message is always kept contiguous, so it can be
+//! accessed in place, the space left at the end of buffer is skipped when message does not fit in.
 //! @{
 
+//! @brief Maximum length of one message
+
+#define TWR_QUEUE_MESSAGE_LENGTH_MAX 0x7fff
+
+//! @brief Track peak occupancy, dropped and put messages of every queue
+
+#ifndef TWR_QUEUE_STATS
+#define TWR_QUEUE_STATS 0
+#endif
+
+#if TWR_QUEUE_STATS
+
+//! @brief Queue statistics
+
+typedef struct
+{
+    //! @brief Highest number of buffer bytes used at once (including message lengths and skipped space)
+    size_t peak;
+
+    //! @brief Number of messages which did not fit in
+    uint32_t dropped;
+
+    //! @brief Number of messages put
+    uint32_t total;
+
+} twr_queue_stats_t;
+
+#endif
+
 //! @cond
 
 typedef struct
@@ -14,6 +47,14 @@ typedef struct
     void *_buffer;
     size_t _size;
     size_t _length;
+    size_t _head;
+    size_t _tail;
+    size_t _reserve_offset;
+    uint8_t _reserve_header;
+
+#if TWR_QUEUE_STATS
+    twr_queue_stats_t _stats;
+#endif
 
 } twr_queue_t;
 
@@ -44,6 +85,48 @@ bool twr_queue_put(twr_queue_t *queue, const void *buffer, size_t length);
 
 bool twr_queue_get(twr_queue_t *queue, void *buffer, size_t *length);
 
+//! @brief Reserve space at the end of queue to build message in place
+//! @param[in] queue Instance
+//! @param[in] length Maximum length of message
+//! @return Pointer where message is to be written
+//! @return NULL When there is no space left
+
+void *twr_queue_reserve(twr_queue_t *queue, size_t length);
+
+//! @brief Append message written in place after twr_queue_reserve
+//! @param[in] queue Instance
+//! @param[in] length Length of message, must not exceed the reserved length
+
+void twr_queue_commit(twr_queue_t *queue, size_t length);
+
+//! @brief Get the oldest message in place, it stays in queue until twr_queue_pop
+//! @param[in] queue Instance
+//! @param[out] length Length of message
+//! @return Pointer to message
+//! @return NULL When queue is empty
+
+void *twr_queue_peek(twr_queue_t *queue, size_t *length);
+
+//! @brief Remove the oldest message from queue
+//! @param[in] queue Instance
+
+void twr_queue_pop(twr_queue_t *queue);
+
+#if TWR_QUEUE_STATS
+
+//! @brief Get queue statistics
+//! @param[in] queue Instance
+//! @param[out] stats Statistics
+
+void twr_queue_get_stats(twr_queue_t *queue, twr_queue_stats_t *stats);
+
+//! @brief Clear queue statistics
+//! @param[in] queue Instance
+
+void twr_queue_reset_stats(twr_queue_t *queue);
+
+#endif
+
 //! @brief Clear queue
 //! @param[in] queue Instance
 
@@ -5,6 +5,7 @@
 #include <twr_button.h>
 #include <twr_led.h>
 #include <twr_spirit1.h>
+#include <twr_transport.h>
 
 //! @addtogroup twr_radio twr_radio
 //! @brief Radio implementation
@@ -14,12 +15,148 @@
 #define TWR_RADIO_MAX_DEVICES 4
 #endif
 
+//! @brief Size of hash index of peer devices, power of two greater than TWR_RADIO_MAX_DEVICES
+
+#ifndef TWR_RADIO_PEER_HASH_SIZE
+#define TWR_RADIO_PEER_HASH_SIZE \
+    (TWR_RADIO_MAX_DEVICES <= 4 ? 8 : TWR_RADIO_MAX_DEVICES <= 8 ? 16 : TWR_RADIO_MAX_DEVICES <= 16 ? 32 : \
+     TWR_RADIO_MAX_DEVICES <= 32 ? 64 : TWR_RADIO_MAX_DEVICES <= 64 ? 128 : TWR_RADIO_MAX_DEVICES <= 128 ? 256 : \
+     TWR_RADIO_MAX_DEVICES <= 256 ? 512 : TWR_RADIO_MAX_DEVICES <= 512 ? 1024 : 2048)
+#endif
+
+//! @brief Peer devices are stored in EEPROM in three copies (24 B per device), with 0 in one copy with check (8 B)
+//!
+//! Peer devices occupy EEPROM from its end, number of devices is stored in the last byte (last two bytes with
+//! TWR_RADIO_MAX_DEVICES over 255). Change of layout drops peer devices stored by firmware with the other layout.
+
+#ifndef TWR_RADIO_PEER_STORAGE_REDUNDANT
+#define TWR_RADIO_PEER_STORAGE_REDUNDANT 1
+#endif
+
+//! @brief Cache of radio ID (serial number of ATSHA204) in EEPROM
+//!
+//! Cached ID protected by CRC32 is used on boot when ATSHA204 responds, so serial number is not read. Cache takes
+//! 16 B of EEPROM right below the area reserved for TWR_RADIO_MAX_DEVICES peer devices.
+
+#ifndef TWR_RADIO_ID_CACHE
+#define TWR_RADIO_ID_CACHE 1
+#endif
+
 #ifndef TWR_RADIO_PUB_QUEUE_BUFFER_SIZE
 #define TWR_RADIO_PUB_QUEUE_BUFFER_SIZE 512
 #endif
 
+//! @brief Size of ring buffer of received messages waiting for decoding, gateway receiving bursts from many nodes may need more
+
 #ifndef TWR_RADIO_RX_QUEUE_BUFFER_SIZE
-#define TWR_RADIO_RX_QUEUE_BUFFER_SIZE 128
+#define TWR_RADIO_RX_QUEUE_BUFFER_SIZE 512
+#endif
+
+//! @brief Maximum number of received messages decoded in one run of decoding task, the rest is decoded in the next spin
+
+#ifndef TWR_RADIO_RX_BATCH
+#define TWR_RADIO_RX_BATCH 4
+#endif
+
+//! @brief RSSI in dBm above which channel is considered busy by listen before talk
+
+#ifndef TWR_RADIO_LBT_THRESHOLD
+#define TWR_RADIO_LBT_THRESHOLD -95
+#endif
+
+//! @brief Length of sliding window of duty cycle in milliseconds (EU 868 MHz band g1 limits 1 % in one hour)
+
+#ifndef TWR_RADIO_DUTY_CYCLE_WINDOW
+#define TWR_RADIO_DUTY_CYCLE_WINDOW 3600000
+#endif
+
+//! @brief Histogram of RSSI of received packets for every peer device
+
+#ifndef TWR_RADIO_RSSI_HISTOGRAM
+#define TWR_RADIO_RSSI_HISTOGRAM 0
+#endif
+
+//! @brief Number of bins of RSSI histogram, the first and the last one collect also values out of range
+
+#ifndef TWR_RADIO_RSSI_HISTOGRAM_BINS
+#define TWR_RADIO_RSSI_HISTOGRAM_BINS 8
+#endif
+
+//! @brief Lower bound of the first bin of RSSI histogram in dBm
+
+#ifndef TWR_RADIO_RSSI_HISTOGRAM_MIN
+#define TWR_RADIO_RSSI_HISTOGRAM_MIN -130
+#endif
+
+//! @brief Width of bin of RSSI histogram in dB
+
+#ifndef TWR_RADIO_RSSI_HISTOGRAM_STEP
+#define TWR_RADIO_RSSI_HISTOGRAM_STEP 10
+#endif
+
+//! @brief Compact encoding of publish messages negotiated on pairing (see @ref twr_radio_compact)
+
+#ifndef TWR_RADIO_COMPACT
+#define TWR_RADIO_COMPACT 0
+#endif
+
+//! @brief Synchronized wake of sleeping node negotiated on pairing
+//!
+//! Gateway holds messages for sleeping node and assigns RX slot in acknowledgment of packet from node, node wakes
+//! receiver only for the slot. Has to be enabled on gateway and node, see @ref twr_radio_set_rx_slot.
+
+#ifndef TWR_RADIO_RX_SLOT
+#define TWR_RADIO_RX_SLOT 0
+#endif
+
+//! @brief Length of RX slot in milliseconds, covers retransmissions of all messages held for node
+
+#ifndef TWR_RADIO_RX_SLOT_WINDOW
+#define TWR_RADIO_RX_SLOT_WINDOW 300
+#endif
+
+//! @brief Messages for sleeping node attached to acknowledgment, negotiated on pairing
+//!
+//! Gateway holds messages for sleeping node and attaches the oldest one which fits to acknowledgment of packet
+//! from node, so node gets it without extra RX window. Has to be enabled on gateway and node.
+
+#ifndef TWR_RADIO_ACK_DATA
+#define TWR_RADIO_ACK_DATA 0
+#endif
+
+//! @brief Dictionary of subtopics negotiated on pairing
+//!
+//! Node registers subtopics set by @ref twr_radio_set_topics with gateway after pairing, publish messages of
+//! twr_radio_pub_bool, int, uint32, float and string with registered subtopic carry its index instead of the string.
+//! Gateway keeps subtopics of TWR_RADIO_TOPICS_PEERS nodes and asks node to register again when index is unknown.
+//! Has to be enabled on gateway and node.
+
+#ifndef TWR_RADIO_TOPICS
+#define TWR_RADIO_TOPICS 0
+#endif
+
+//! @brief Maximum number of subtopics in dictionary (up to 32)
+
+#ifndef TWR_RADIO_TOPICS_MAX
+#define TWR_RADIO_TOPICS_MAX 8
+#endif
+
+//! @brief Size of subtopic kept by gateway including terminating zero, longer subtopics are sent as strings
+
+#ifndef TWR_RADIO_TOPIC_SIZE
+#define TWR_RADIO_TOPIC_SIZE 32
+#endif
+
+//! @brief Number of nodes with dictionary kept on gateway
+
+#ifndef TWR_RADIO_TOPICS_PEERS
+#define TWR_RADIO_TOPICS_PEERS TWR_RADIO_MAX_DEVICES
+#endif
+
+//! @brief Size of buffer on gateway for messages held for sleeping nodes (RX slot and data in acknowledgment)
+
+#ifndef TWR_RADIO_HOLD_QUEUE_BUFFER_SIZE
+#define TWR_RADIO_HOLD_QUEUE_BUFFER_SIZE 128
 #endif
 
 #define TWR_RADIO_ID_SIZE           6
@@ -100,6 +237,10 @@ typedef enum
     TWR_RADIO_HEADER_PUB_VALUE_INT   = 0x1e,
 
     TWR_RADIO_HEADER_SUB_REG         = 0x20,
+    TWR_RADIO_HEADER_PUB_BATCH       = 0x21,
+    TWR_RADIO_HEADER_PUB_COMPACT     = 0x22,
+    TWR_RADIO_HEADER_TOPIC_REG       = 0x23,
+    TWR_RADIO_HEADER_PUB_TOPIC_ID    = 0x24,
 
     TWR_RADIO_HEADER_ACK             = 0xaa,
 
@@ -134,9 +275,70 @@ typedef struct
     bool message_id_synced;
     twr_radio_mode_t mode;
     int rssi;
+    uint8_t ack_rate;
+    bool compact;
+    bool compact_reset;
+#if TWR_RADIO_TOPICS
+    bool topics;
+    bool topics_reset;
+#endif
+#if TWR_RADIO_RX_SLOT || TWR_RADIO_ACK_DATA
+    bool rx_slot;
+    bool ack_data;
+    uint8_t hold_pending;
+    twr_tick_t rx_slot_tick;
+#endif
+#if TWR_RADIO_RSSI_HISTOGRAM
+    uint16_t rssi_histogram[TWR_RADIO_RSSI_HISTOGRAM_BINS];
+#endif
 
 } twr_radio_peer_t;
 
+//! @brief Radio statistics since initialization
+
+typedef struct
+{
+    //! @brief Number of packets sent (without retransmissions)
+    uint32_t tx_packets;
+
+    //! @brief Number of retransmissions
+    uint32_t tx_retries;
+
+    //! @brief Number of packets acknowledged by peer
+    uint32_t tx_acked;
+
+    //! @brief Number of packets dropped after the last retransmission
+    uint32_t tx_dropped;
+
+    //! @brief Number of transmissions deferred by listen before talk
+    uint32_t lbt_deferred;
+
+    //! @brief Number of times drain of publish message queue was delayed by duty cycle limit
+    uint32_t duty_cycle_delayed;
+
+    //! @brief Number of received packets passed for decoding
+    uint32_t rx_packets;
+
+    //! @brief Number of received packets dropped because RX queue was full
+    uint32_t rx_dropped;
+
+    //! @brief Number of acknowledgments sent
+    uint32_t ack_sent;
+
+    //! @brief Time spent by transceiver in TX state (airtime)
+    twr_tick_t tx_time;
+
+    //! @brief Time spent by transceiver in RX state
+    twr_tick_t rx_time;
+
+    //! @brief Time spent by transceiver in sleep state
+    twr_tick_t sleep_time;
+
+    //! @brief Airtime in sliding window of TWR_RADIO_DUTY_CYCLE_WINDOW in 0.01 %
+    uint16_t duty_cycle;
+
+} twr_radio_stats_t;
+
 //! @brief Initialize radio
 //! @param[in] mode
 
@@ -176,6 +378,18 @@ bool twr_radio_is_peer_device(uint64_t id);
 
 bool twr_radio_pub_queue_put(const void *buffer, size_t length);
 
+//! @brief Reserve space in the publish message queue to encode message in place
+//! @param[in] length Maximum length of message
+//! @return Pointer where message is to be encoded
+//! @return NULL When queue is full
+
+void *twr_radio_pub_queue_reserve(size_t length);
+
+//! @brief Publish message encoded in place after twr_radio_pub_queue_reserve
+//! @param[in] length Length of message
+
+void twr_radio_pub_queue_commit(size_t length);
+
 //! @brief Clear the publish message queue
 
 void twr_radio_pub_queue_clear();
@@ -184,8 +398,68 @@ void twr_radio_set_subs(twr_radio_sub_t *subs, int length);
 
 bool twr_radio_send_sub_data(uint64_t *id, uint8_t order, void *payload, size_t size);
 
+#if TWR_RADIO_TOPICS
+
+//! @brief Set dictionary of subtopics registered with gateway after pairing, call before pairing request
+//! @param[in] topics Array of subtopics, index in array is ID of subtopic (has to stay valid)
+//! @param[in] length Number of subtopics (up to TWR_RADIO_TOPICS_MAX)
+
+void twr_radio_set_topics(const char * const *topics, int length);
+
+//! @brief Get ID of subtopic registered with gateway, pointers from dictionary are found without string compare
+//! @param[in] subtopic Subtopic
+//! @return ID of subtopic or -1 if subtopic is not registered
+
+int twr_radio_get_topic_id(const char *subtopic);
+
+//! @brief Get subtopic registered by peer device, unknown ID makes gateway ask node to register again
+//! @param[in] id Pointer to ID of peer device
+//! @param[in] topic_id ID of subtopic
+//! @return Subtopic or NULL if it is unknown
+
+const char *twr_radio_get_topic(uint64_t *id, uint8_t topic_id);
+
+#endif
+
 void twr_radio_set_rx_timeout_for_sleeping_node(twr_tick_t timeout);
 
+//! @brief Enable synchronized wake of sleeping node, call before pairing request (requires TWR_RADIO_RX_SLOT)
+//!
+//! When gateway agrees on pairing, node keeps receiver off after acknowledgment instead of RX timeout for sleeping
+//! node and wakes it only in RX slot assigned by gateway holding messages sent by @ref twr_radio_send_sub_data.
+//! @param[in] enable Enable synchronized wake (disabled by default)
+
+void twr_radio_set_rx_slot(bool enable);
+
+//! @brief Enable or disable batching of publish messages
+//!
+//! Publish messages waiting in queue are packed into one packet up to TWR_SPIRIT1_MAX_PACKET_SIZE, so they share
+//! one header, ACK and retransmissions. Payload of batch is sequence of records, every one is length (1 B) followed
+//! by the message. Receiver has to understand TWR_RADIO_HEADER_PUB_BATCH, gateway with older firmware drops it.
+//! @param[in] enable Enable batching (disabled by default)
+
+void twr_radio_set_pub_batching(bool enable);
+
+//! @brief Enable or disable listen before talk
+//!
+//! Before every transmission and retransmission receiver measures RSSI of channel, busy channel (above
+//! TWR_RADIO_LBT_THRESHOLD) defers transmission by random backoff.
+//! @param[in] enable Enable listen before talk (disabled by default)
+
+void twr_radio_set_listen_before_talk(bool enable);
+
+//! @brief Get radio statistics
+//! @param[out] stats Pointer to statistics
+
+void twr_radio_get_stats(twr_radio_stats_t *stats);
+
+//! @brief Set duty cycle limit, publish messages wait in queue while airtime in window would exceed it
+//!
+//! Acknowledgments, pairing and subscriptions are not delayed but count into airtime.
+//! @param[in] limit Limit in 0.01 % (100 for 1 %), 0 disables limit (default)
+
+void twr_radio_set_duty_cycle_limit(uint16_t limit);
+
 twr_radio_peer_t *twr_radio_get_peer_device(uint64_t id);
 
 uint8_t *twr_radio_id_to_buffer(uint64_t *id, uint8_t *buffer);
@@ -205,6 +479,13 @@ uint8_t *twr_radio_data_from_buffer(uint8_t *buffer, void *data, size_t length);
 
 void twr_radio_init_pairing_button();
 
+//! @brief Get transport driver, data are published as buffers of up to TWR_RADIO_MAX_BUFFER_SIZE - 1 bytes
+//!
+//! Transport is ready when node has paired gateway. Bytes which do not fit into publish queue are dropped.
+//! @return Transport driver
+
+const twr_transport_driver_t *twr_radio_get_transport_driver(void);
+
 //! @}
 
 #endif // _TWR_RADIO_H
@@ -0,0 +1,72 @@
+#ifndef _TWR_RADIO_COMPACT_H
+#define _TWR_RADIO_COMPACT_H
+
+#include <twr_radio.h>
+
+//! @addtogroup twr_radio_compact twr_radio_compact
+//! @brief Compact encoding of publish messages, used by @ref twr_radio when enabled by TWR_RADIO_COMPACT
+//!
+//! Node binds topic of message (header, channel or subtopic) to slot and sends only slot number followed by values
+//! as scaled integers in zigzag varints, either absolute or as delta against the previous value of slot. Values
+//! are rounded to resolution given by header (0.01 for temperature, humidity and illuminance, 0.1 for pressure,
+//! altitude and CO2, 0.001 for voltage, acceleration and float subtopics), messages which can not be represented
+//! go unchanged. Packet with TWR_RADIO_HEADER_PUB_COMPACT carries sequence of records:
+//!
+//! | 0x00 + slot | delta values |
+//! | 0x40 + slot | absolute values |
+//! | 0x80 + slot | key length (1 B) | key | absolute values |
+//! | 0xc0 | message length (1 B) | message |
+//!
+//! Node starts from empty slots after pairing, after failed transmission and on request of gateway, so delta
+//! always refers to the value acknowledged by gateway or sent earlier in the same packet.
+//! @{
+
+//! @brief Number of slots of node and of every peer device on gateway
+
+#ifndef TWR_RADIO_COMPACT_SLOTS
+#define TWR_RADIO_COMPACT_SLOTS 8
+#endif
+
+//! @brief Maximum size of key (header followed by channel or subtopic), messages with longer key go unchanged
+
+#ifndef TWR_RADIO_COMPACT_KEY_SIZE
+#define TWR_RADIO_COMPACT_KEY_SIZE 24
+#endif
+
+//! @brief Number of peer devices with slots kept on gateway
+
+#ifndef TWR_RADIO_COMPACT_PEERS
+#define TWR_RADIO_COMPACT_PEERS TWR_RADIO_MAX_DEVICES
+#endif
+
+//! @brief Encode publish message as compact record
+//! @param[in] message Pointer to message (header followed by payload)
+//! @param[in] length Length of message
+//! @param[out] buffer Pointer to destination buffer
+//! @param[in] size Size of destination buffer
+//! @param[in] commit Update slots, with false only length of record is computed
+//! @return Length of record or 0 if record does not fit into buffer
+
+size_t twr_radio_compact_encode(const uint8_t *message, size_t length, uint8_t *buffer, size_t size, bool commit);
+
+//! @brief Forget slots of node, following values are sent with key
+
+void twr_radio_compact_reset(void);
+
+//! @brief Decode compact records and pass expanded messages to twr_radio_pub_decode
+//! @param[in] id Pointer to ID of peer device
+//! @param[in] buffer Pointer to records
+//! @param[in] length Length of records
+//! @return true On success
+//! @return false When records can not be decoded, e.g. refer to slot lost by restart of gateway
+
+bool twr_radio_compact_decode(uint64_t *id, uint8_t *buffer, size_t length);
+
+//! @brief Forget slots kept on gateway for peer device
+//! @param[in] id Pointer to ID of peer device
+
+void twr_radio_compact_peer_reset(uint64_t *id);
+
+//! @}
+
+#endif // _TWR_RADIO_COMPACT_H
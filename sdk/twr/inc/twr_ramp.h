@@ -5,6 +5,9 @@
 
 //! @addtogroup twr_ramp twr_ramp
 //! @brief Ramping algorithm library (e.g. can be used for PWM up/down ramping for LED control, motor control, etc.)
+//!
+//! Slope is computed once by twr_ramp_start, so value is one multiply-add of elapsed ticks. Integer variant
+//! (twr_ramp_init_int and twr_ramp_get_int) keeps slope in Q16 and does not use float at all.
 //! @{
 
 //! @cond
@@ -18,6 +21,11 @@ typedef struct
     float _start;
     float _stop;
     float _now;
+    float _slope;
+
+    int32_t _start_int;
+    int32_t _stop_int;
+    int32_t _slope_q16;
 
     twr_tick_t _tick_start;
     twr_tick_t _tick_end;
@@ -34,6 +42,14 @@ typedef struct
 
 void twr_ramp_init(twr_ramp_t *self, float start, float stop, twr_tick_t duration);
 
+//! @brief Initialize ramp instance with integer points
+//! @param[in] self Instance
+//! @param[in] start Start point
+//! @param[in] stop Stop point (difference to start point must fit 16 bits, e.g. 0 to 65535)
+//! @param[in] duration Ramp duration in ticks
+
+void twr_ramp_init_int(twr_ramp_t *self, int32_t start, int32_t stop, twr_tick_t duration);
+
 //! @brief Start ramp sequence
 //! @param[in] self Instance
 
@@ -45,6 +61,21 @@ void twr_ramp_start(twr_ramp_t *self);
 
 float twr_ramp_get(twr_ramp_t *self);
 
+//! @brief Get current ramp value computed in fixed point
+//! @param[in] self Instance
+//! @return Ramp point rounded to integer
+
+int32_t twr_ramp_get_int(twr_ramp_t *self);
+
+//! @brief Compile ramp into sequence of values spread evenly from start to stop point, which plays without running any
+//!        task (see twr_pwm_burst_start, ramp duration is then given by number of values and PWM period)
+//! @param[in] self Instance
+//! @param[out] buffer Buffer of values, rounded and limited to range 0 to 65535
+//! @param[in] count Number of values
+//! @param[in] stride Distance between values in buffer (number of channels in frame)
+
+void twr_ramp_compile(twr_ramp_t *self, uint16_t *buffer, size_t count, size_t stride);
+
 //! @}
 
 #endif // _TWR_RAMP_H
@@ -7,8 +7,17 @@
 
 //! @addtogroup twr_rf_ook twr_rf_ook
 //! @brief Driver for ON-OFF-KEY modulation for 433 MHz Radio modules
+//!
+//! Besides bits clocked out by timer interrupt, frame can be encoded once to pattern of GPIO states which is played
+//! by timer triggered DMA, see @ref twr_rf_ook_pattern_play. CPU is then interrupted once per frame only.
 //! @{
 
+//! @brief Maximum length of pattern in bits (pattern takes 4 B of RAM per bit)
+
+#ifndef TWR_RF_OOK_PATTERN_LENGTH
+#define TWR_RF_OOK_PATTERN_LENGTH 256
+#endif
+
 //! @brief Initialize RF OOK library
 //! @param[in] gpio GPIO pin
 
@@ -35,6 +44,28 @@ bool twr_rf_ook_send(uint8_t *packet, uint8_t length);
 
 bool twr_rf_ook_send_hex_string(char *hex_string);
 
+//! @brief Encode data to pattern, pattern is kept for any number of twr_rf_ook_pattern_play calls
+//! @param[in] packet packet
+//! @param[in] length packet length in bytes
+//! @return true On success
+//! @return false When sending is in progress or packet does not fit TWR_RF_OOK_PATTERN_LENGTH
+
+bool twr_rf_ook_pattern_set(const uint8_t *packet, uint8_t length);
+
+//! @brief Encode data in hex string to pattern
+//! @param[in] hex_string hex string with data to send
+//! @return true On success
+//! @return false When sending is in progress or data do not fit TWR_RF_OOK_PATTERN_LENGTH
+
+bool twr_rf_ook_pattern_set_hex_string(const char *hex_string);
+
+//! @brief Send pattern repeatedly, bits are written to GPIO by DMA on timer update
+//! @param[in] repeat Number of frames sent back to back
+//! @return true On success
+//! @return false When sending is in progress, pattern is empty or DMA channel of TIM3 update is allocated
+
+bool twr_rf_ook_pattern_play(uint16_t repeat);
+
 //! @brief Data sending in progress
 
 bool twr_rf_ook_is_busy();
@@ -4,6 +4,7 @@
 #include <time.h>
 #include <stm32l0xx.h>
 #include "twr_common.h"
+#include "twr_tick.h"
 
 //! @addtogroup twr_rtc twr_rtc
 //! @brief Driver for real-time clock
@@ -14,6 +15,12 @@
 #define TWR_RTC_PREDIV_S 256
 #define TWR_RTC_PREDIV_A 128
 
+//! @brief Interval after which cached timestamp is synchronized from RTC again (in milliseconds)
+
+#ifndef TWR_RTC_SYNC_INTERVAL_MS
+#define TWR_RTC_SYNC_INTERVAL_MS (60 * 60 * 1000)
+#endif
+
 //! @brief Initialize real-time clock
 
 extern int _twr_rtc_writable_semaphore;
@@ -81,6 +88,22 @@ void twr_rtc_get_datetime(struct tm *tm);
  */
 void twr_rtc_get_timestamp(struct timespec *tv);
 
+//! @brief Synchronize cached timestamp from RTC (waits for shadow registers)
+//!
+//! Called by @ref twr_rtc_set_datetime and by @ref twr_rtc_get_timestamp_cached on first use and after
+//! @ref TWR_RTC_SYNC_INTERVAL_MS, call it explicitly only when RTC has been changed by other means.
+
+void twr_rtc_sync(void);
+
+//! @brief Get current UNIX time from cached epoch and tick offset
+//!
+//! Timestamp synchronized from RTC is advanced by ticks elapsed since, so no RTC register is read and no calendar
+//! math is done on most calls. Ticks are derived from RTC wake-up timer (including time spent in tickless idle), so
+//! they do not drift against RTC. Resolution is one millisecond. Not to be called from interrupt.
+//! @param[out] tv Timestamp
+
+void twr_rtc_get_timestamp_cached(struct timespec *tv);
+
 /**
  * Set date and time in RTC
  *
@@ -26,6 +26,18 @@ typedef enum
 
 } twr_sam_m8q_event_t;
 
+//! @brief Output protocol of navigation module
+
+typedef enum
+{
+    //! @brief NMEA sentences RMC, GGA and PUBX POSITION parsed as text (default)
+    TWR_SAM_M8Q_PROTOCOL_NMEA = 0,
+
+    //! @brief UBX NAV-PVT binary message sent every navigation solution, decoded to integers without parsing
+    TWR_SAM_M8Q_PROTOCOL_UBX = 1
+
+} twr_sam_m8q_protocol_t;
+
 //! @brief SAM-M8Q instance
 
 typedef struct twr_sam_m8q_t twr_sam_m8q_t;
@@ -144,6 +156,17 @@ struct twr_sam_m8q_t
     char _line_buffer[128];
     size_t _line_length;
     bool _line_clipped;
+    bool _line_skipped;
+    twr_sam_m8q_protocol_t _protocol;
+    struct
+    {
+        size_t position;
+        size_t length;
+        uint8_t message_class;
+        uint8_t message_id;
+        uint8_t ck_a;
+        uint8_t ck_b;
+    } _ubx;
     struct
     {
         bool valid;
@@ -178,6 +201,25 @@ struct twr_sam_m8q_t
         float course;
         int satellites;
     } _pubx;
+    struct
+    {
+        bool valid;
+        uint16_t year;
+        uint8_t month;
+        uint8_t day;
+        uint8_t hours;
+        uint8_t minutes;
+        uint8_t seconds;
+        uint8_t validity;
+        uint8_t fix_type;
+        uint8_t flags;
+        uint8_t satellites;
+        int32_t longitude;
+        int32_t latitude;
+        int32_t altitude;
+        uint32_t h_accuracy;
+        uint32_t v_accuracy;
+    } _pvt;
 };
 
 //! @endcond
@@ -197,6 +239,12 @@ void twr_sam_m8q_init(twr_sam_m8q_t *self, twr_i2c_channel_t channel, uint8_t i2
 
 void twr_sam_m8q_set_event_handler(twr_sam_m8q_t *self, twr_sam_m8q_event_handler_t event_handler, void *event_param);
 
+//! @brief Set output protocol, module is configured again on the next received sentence or message
+//! @param[in] self Instance
+//! @param[in] protocol Output protocol
+
+void twr_sam_m8q_set_protocol(twr_sam_m8q_t *self, twr_sam_m8q_protocol_t protocol);
+
 //! @brief Start navigation module
 //! @param[in] self Instance
 
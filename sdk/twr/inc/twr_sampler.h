@@ -0,0 +1,73 @@
+#ifndef _TWR_SAMPLER_H
+#define _TWR_SAMPLER_H
+
+#include <twr_tick.h>
+
+//! @addtogroup twr_sampler twr_sampler
+//! @brief Adaptive update interval of sensor driven by rate of change of measured value
+//!
+//! Every new value is fed to sampler. When value changes by threshold (usually publish difference) or more since the
+//! previous sample, interval drops to minimum so that the change is followed closely. While value changes by less
+//! than quarter of threshold, interval doubles up to maximum. Interval is applied by update interval setter of driver,
+//! e.g. (twr_sampler_set_interval_t) twr_tmp112_set_update_interval.
+//! @{
+
+//! @brief Update interval setter of sensor driver
+
+typedef void (*twr_sampler_set_interval_t)(void *sensor, twr_tick_t interval);
+
+//! @cond
+
+typedef struct
+{
+    twr_sampler_set_interval_t _set_interval;
+    void *_sensor;
+    twr_tick_t _interval_min;
+    twr_tick_t _interval_max;
+    twr_tick_t _interval;
+    float _threshold;
+    float _value;
+    bool _valid;
+
+} twr_sampler_t;
+
+//! @endcond
+
+//! @brief Initialize sampler and set update interval of sensor to minimum
+//! @param[in] self Instance
+//! @param[in] set_interval Update interval setter of sensor driver
+//! @param[in] sensor Sensor instance passed to setter
+//! @param[in] interval_min Minimum update interval
+//! @param[in] interval_max Maximum update interval
+//! @param[in] threshold Change of value between samples which is considered fast
+
+void twr_sampler_init(twr_sampler_t *self, twr_sampler_set_interval_t set_interval, void *sensor, twr_tick_t interval_min, twr_tick_t interval_max, float threshold);
+
+//! @brief Set bounds of update interval, current interval is limited to them
+//! @param[in] self Instance
+//! @param[in] interval_min Minimum update interval
+//! @param[in] interval_max Maximum update interval
+
+void twr_sampler_set_bounds(twr_sampler_t *self, twr_tick_t interval_min, twr_tick_t interval_max);
+
+//! @brief Set change of value between samples which is considered fast
+//! @param[in] self Instance
+//! @param[in] threshold Threshold
+
+void twr_sampler_set_threshold(twr_sampler_t *self, float threshold);
+
+//! @brief Feed new value (call from update event of sensor) and adapt update interval
+//! @param[in] self Instance
+//! @param[in] value Measured value
+
+void twr_sampler_feed(twr_sampler_t *self, float value);
+
+//! @brief Get current update interval
+//! @param[in] self Instance
+//! @return Update interval
+
+twr_tick_t twr_sampler_get_interval(twr_sampler_t *self);
+
+//! @}
+
+#endif // _TWR_SAMPLER_H
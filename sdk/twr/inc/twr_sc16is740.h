@@ -2,6 +2,7 @@
 #define _TWR_SC16IS740_H
 
 #include <twr_i2c.h>
+#include <twr_exti.h>
 #include <twr_tick.h>
 
 //! @addtogroup twr_sc16is740 twr_sc16is740
@@ -29,16 +30,45 @@ typedef enum
 
 } twr_sc16is740_baudrate_t;
 
+//! @brief RX FIFO trigger levels
+
+typedef enum
+{
+    TWR_SC16IS740_RX_TRIGGER_8 = 0x00,
+    TWR_SC16IS740_RX_TRIGGER_16 = 0x40,
+    TWR_SC16IS740_RX_TRIGGER_56 = 0x80,
+    TWR_SC16IS740_RX_TRIGGER_60 = 0xc0
+
+} twr_sc16is740_rx_trigger_t;
+
+//! @brief Interrupt events
+
+typedef enum
+{
+    //! @brief RX FIFO reached trigger level or received data wait for 4 character times
+    TWR_SC16IS740_EVENT_RX = 0,
+
+    //! @brief TX FIFO has space after write has not fit into it
+    TWR_SC16IS740_EVENT_TX = 1
+
+} twr_sc16is740_event_t;
+
 //! @brief SC16IS740 instance
 
+typedef struct twr_sc16is740_t twr_sc16is740_t;
+
 //! @cond
 
-typedef struct
+struct twr_sc16is740_t
 {
     twr_i2c_channel_t _i2c_channel;
     uint8_t _i2c_address;
-
-} twr_sc16is740_t;
+    size_t _tx_space;
+    bool _irq;
+    bool _rx_pending;
+    void (*_event_handler)(twr_sc16is740_t *, twr_sc16is740_event_t, void *);
+    void *_event_param;
+};
 
 //! @endcond
 
@@ -92,6 +122,35 @@ bool twr_sc16is740_available(twr_sc16is740_t *self, size_t *available);
 
 size_t twr_sc16is740_read(twr_sc16is740_t *self, uint8_t *buffer, size_t length, twr_tick_t timeout);
 
+//! @brief Set RX FIFO trigger level of interrupt (8 by default)
+//! @param[in] self Instance
+//! @param[in] rx_trigger Trigger level
+//! @return true On success
+//! @return false On failure
+
+bool twr_sc16is740_set_rx_trigger(twr_sc16is740_t *self, twr_sc16is740_rx_trigger_t rx_trigger);
+
+//! @brief Handle interrupts signalled by IRQ output connected to EXTI line
+//!
+//! Read does not access the bridge until RX event comes, write which has not fit into TX FIFO enables TX event.
+//! Events are handled in task context, so that handler can read and write.
+//! @param[in] self Instance
+//! @param[in] line EXTI line connected to IRQ output
+//! @param[in] event_handler Function address (can be NULL)
+//! @param[in] event_param Optional event parameter (can be NULL)
+//! @return true On success
+//! @return false On failure
+
+bool twr_sc16is740_set_irq(twr_sc16is740_t *self, twr_exti_line_t line, void (*event_handler)(twr_sc16is740_t *, twr_sc16is740_event_t, void *), void *event_param);
+
+//! @brief Get RX timeout interrupt, pending while received data stay in FIFO with no character for 4 character times
+//! @param[in] self Instance
+//! @param[out] rx_timeout RX timeout pending (requires RHR interrupt enabled in IER)
+//! @return true On success
+//! @return false On failure
+
+bool twr_sc16is740_get_rx_timeout(twr_sc16is740_t *self, bool *rx_timeout);
+
 //! @brief Set baudrate
 //! @param[in] self Instance
 //! @param[in] baudrate
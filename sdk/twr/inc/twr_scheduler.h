@@ -7,7 +7,7 @@
 //! @brief Task scheduler
 //! @{
 
-//! @brief Maximum number of tasks
+//! @brief Maximum number of tasks including static tasks (checked against static tasks by linker)
 
 #ifndef TWR_SCHEDULER_MAX_TASKS
 #define TWR_SCHEDULER_MAX_TASKS 32
@@ -17,10 +17,142 @@
 #define TWR_SCHEDULER_INTERVAL_MS 10
 #endif
 
+//! @brief Keep planned tasks in a min-heap ordered by execution tick instead of scanning all slots on every spin
+//!
+//! Due tasks are found and planned in O(log n), every task still runs at most once per spin.
+
+#ifndef TWR_SCHEDULER_HEAP
+#define TWR_SCHEDULER_HEAP 0
+#endif
+
+//! @brief Stop periodic tick while idle and wake up on the earliest planned task instead
+//!
+//! Elapsed time is measured by RTC calendar with 1/256 s resolution, the part of interval elapsed before entering idle is lost.
+
+#ifndef TWR_SCHEDULER_TICKLESS
+#define TWR_SCHEDULER_TICKLESS 0
+#endif
+
+//! @brief Enter standby mode woken by RTC alarm while idle and the earliest planned task is far enough
+//!
+//! Program restarts from reset on wake-up with tick restored (see twr_system_enter_standby_alarm), so application has to
+//! initialize itself again and plan its tasks by absolute tick. Standby is not entered while sleep is disabled.
+
+#ifndef TWR_SCHEDULER_STANDBY
+#define TWR_SCHEDULER_STANDBY 0
+#endif
+
+//! @brief Minimum time to the earliest planned task for entering standby mode (in milliseconds)
+
+#ifndef TWR_SCHEDULER_STANDBY_THRESHOLD_MS
+#define TWR_SCHEDULER_STANDBY_THRESHOLD_MS (60 * 1000)
+#endif
+
+//! @brief Record run count, execution time, lateness and stack use (with TWR_STACK_PAINT) of every task
+//!
+//! Execution time is measured by twr_timer in microseconds (Cortex-M0+ has no DWT cycle counter), tasks running longer than
+//! TWR_SCHEDULER_PROFILE_TIMER_LIMIT_MS are measured by tick with millisecond resolution instead.
+
+#ifndef TWR_SCHEDULER_PROFILE
+#define TWR_SCHEDULER_PROFILE 0
+#endif
+
+//! @brief Refresh watchdog after every complete spin and check execution time of tasks against their budgets
+//!
+//! Watchdog has to be initialized by application (see twr_watchdog_init). Task exceeding its budget (see
+//! twr_scheduler_set_budget) is logged as error, which ends in RAM log with TWR_LOG_RAM. Task running when watchdog
+//! resets MCU is kept in RAM surviving reset and logged as error by twr_scheduler_run after reset. Execution time is
+//! measured by twr_hrtick when it is running, by tick with millisecond resolution otherwise.
+
+#ifndef TWR_SCHEDULER_WATCHDOG
+#define TWR_SCHEDULER_WATCHDOG 0
+#endif
+
+//! @brief Longest tickless idle with watchdog, so that spin refreshes it in time (in milliseconds)
+
+#ifndef TWR_SCHEDULER_WATCHDOG_IDLE_MS
+#define TWR_SCHEDULER_WATCHDOG_IDLE_MS 1000
+#endif
+
+#if TWR_SCHEDULER_WATCHDOG && TWR_SCHEDULER_STANDBY
+#error "TWR_SCHEDULER_STANDBY cannot be combined with TWR_SCHEDULER_WATCHDOG, watchdog keeps running in standby mode"
+#endif
+
 //! @brief Task ID assigned by scheduler
 
 typedef size_t twr_scheduler_task_id_t;
 
+//! @brief Task priority
+
+typedef enum
+{
+    //! @brief Tasks run in order of their IDs (default)
+    TWR_SCHEDULER_PRIORITY_NORMAL = 0,
+
+    //! @brief Tasks run before tasks of normal priority and are checked again after each of them
+    TWR_SCHEDULER_PRIORITY_HIGH = 1
+
+} twr_scheduler_priority_t;
+
+//! @brief Descriptor of static task
+//!
+//! Descriptors defined by @ref TWR_SCHEDULER_TASK_STATIC are collected by linker into one table and registered
+//! by @ref twr_scheduler_init under IDs equal to their indexes, not planned. Static tasks always exist, they
+//! cannot be unregistered and their number is known at build time (see twr_scheduler_get_static_count), so only
+//! tasks registered at runtime have to be counted on top of it in @ref TWR_SCHEDULER_MAX_TASKS.
+
+typedef struct
+{
+    //! @brief Task function
+    void (*task)(void *);
+
+    //! @brief Parameter passed to task function
+    void *param;
+
+} twr_scheduler_task_static_t;
+
+//! @brief Define static task, the descriptor is linked in only when referenced by @ref twr_scheduler_get_static_id
+//! @param[in] name Name of descriptor
+//! @param[in] task Task function (declared before)
+//! @param[in] param Parameter passed to task function
+
+#define TWR_SCHEDULER_TASK_STATIC(name, task, param) \
+    static const twr_scheduler_task_static_t name __attribute__ ((section(".twr_scheduler_task"), aligned(4))) = { task, param }
+
+#if TWR_SCHEDULER_PROFILE
+
+#define TWR_SCHEDULER_PROFILE_TIMER_LIMIT_MS 50
+
+//! @brief AT command printing profiling table
+
+#define TWR_SCHEDULER_PROFILE_ATCI_COMMAND {"$SCHEDPROF", twr_scheduler_profile_atci_action, NULL, NULL, NULL, "Print scheduler task profiling table"}
+
+//! @brief Profiling record of task
+
+typedef struct
+{
+    //! @brief Number of task runs
+    uint32_t count;
+
+    //! @brief Total execution time in microseconds
+    uint64_t time_total;
+
+    //! @brief Longest execution time in microseconds
+    uint32_t time_max;
+
+    //! @brief Total time in milliseconds the runs started after their planned tick
+    twr_tick_t late_total;
+
+    //! @brief Longest time in milliseconds a run started after its planned tick
+    twr_tick_t late_max;
+
+    //! @brief Deepest stack use of a run in bytes including interrupts taken meanwhile (0 without TWR_STACK_PAINT)
+    uint32_t stack_max;
+
+} twr_scheduler_profile_t;
+
+#endif
+
 //! @brief Initialize task scheduler
 
 void twr_scheduler_init(void);
@@ -37,7 +169,37 @@ void twr_scheduler_run(void);
 
 twr_scheduler_task_id_t twr_scheduler_register(void (*task)(void *), void *param, twr_tick_t tick);
 
-//! @brief Unregister specified task
+//! @brief Set priority of task (task gets normal priority when registered)
+//!
+//! Due task of high priority waits at most for one task of normal priority, so it is meant for short latency-critical
+//! tasks like radio and protocol handling. Every task still runs at most once per spin.
+//! @param[in] task_id Task ID
+//! @param[in] priority Priority
+
+void twr_scheduler_set_priority(twr_scheduler_task_id_t task_id, twr_scheduler_priority_t priority);
+
+#if TWR_SCHEDULER_WATCHDOG
+
+//! @brief Set execution time budget of task (task has no budget when registered)
+//! @param[in] task_id Task ID
+//! @param[in] budget Longest execution time of one run in microseconds (0 for no budget)
+
+void twr_scheduler_set_budget(twr_scheduler_task_id_t task_id, uint32_t budget);
+
+#endif
+
+//! @brief Get task ID of static task
+//! @param[in] descriptor Descriptor defined by @ref TWR_SCHEDULER_TASK_STATIC
+//! @return Task ID
+
+twr_scheduler_task_id_t twr_scheduler_get_static_id(const twr_scheduler_task_static_t *descriptor);
+
+//! @brief Get number of static tasks
+//! @return Number of static tasks
+
+size_t twr_scheduler_get_static_count(void);
+
+//! @brief Unregister specified task (static task cannot be unregistered)
 //! @param[in] task_id Task ID to be unregistered
 
 void twr_scheduler_unregister(twr_scheduler_task_id_t task_id);
@@ -52,6 +214,11 @@ twr_scheduler_task_id_t twr_scheduler_get_current_task_id(void);
 
 twr_tick_t twr_scheduler_get_spin_tick(void);
 
+//! @brief Get the earliest tick at which any task is planned
+//! @return Tick of the earliest planned task or TWR_TICK_INFINITY if none is planned
+
+twr_tick_t twr_scheduler_get_next_tick(void);
+
 //! @brief Disable sleep mode, implemented as semaphore
 
 void twr_scheduler_disable_sleep(void);
@@ -83,6 +250,14 @@ void twr_scheduler_plan_relative(twr_scheduler_task_id_t task_id, twr_tick_t tic
 
 void twr_scheduler_plan_from_now(twr_scheduler_task_id_t task_id, twr_tick_t tick);
 
+//! @brief Signal specified task to be run in the next spin, safe to call from interrupt
+//!
+//! Signals are kept in a pending bitmask, which is collected before due tasks are looked up, so the call is constant
+//! time and several signals before the next spin run the task once.
+//! @param[in] task_id Task ID to be signalled
+
+void twr_scheduler_signal(twr_scheduler_task_id_t task_id);
+
 //! @brief Schedule current task for immediate execution
 
 void twr_scheduler_plan_current_now(void);
@@ -102,6 +277,30 @@ void twr_scheduler_plan_current_relative(twr_tick_t tick);
 
 void twr_scheduler_plan_current_from_now(twr_tick_t tick);
 
+#if TWR_SCHEDULER_PROFILE
+
+//! @brief Get profiling record of task
+//! @param[in] task_id Task ID
+//! @param[out] profile Profiling record
+//! @return true On success
+//! @return false When no task is registered under task ID
+
+bool twr_scheduler_get_profile(twr_scheduler_task_id_t task_id, twr_scheduler_profile_t *profile);
+
+//! @brief Clear profiling records of all tasks
+
+void twr_scheduler_profile_reset(void);
+
+//! @brief Print profiling table through twr_log
+
+void twr_scheduler_profile_log(void);
+
+//! @brief Print profiling table as AT command response, use in TWR_SCHEDULER_PROFILE_ATCI_COMMAND
+
+bool twr_scheduler_profile_atci_action(void);
+
+#endif
+
 //! @}
 
 #endif // _TWR_SCHEDULER_H
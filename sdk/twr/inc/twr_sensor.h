@@ -0,0 +1,144 @@
+#ifndef _TWR_SENSOR_H
+#define _TWR_SENSOR_H
+
+#include <twr_scheduler.h>
+
+//! @addtogroup twr_sensor twr_sensor
+//! @brief Shared sampling engine for sensors with initialize, trigger, wait and read cycle
+//!
+//! All registered sensors are driven by a single scheduler task. Steps which become due within
+//! @ref TWR_SENSOR_GROUP_WINDOW of each other are executed in one pass, so bus activity of several sensors
+//! is grouped and the MCU wakes up less often. Steps are only ever postponed, never run ahead of their time.
+//! @{
+
+//! @brief Maximum time in milliseconds a due step can be postponed to be executed together with later ones
+
+#ifndef TWR_SENSOR_GROUP_WINDOW
+#define TWR_SENSOR_GROUP_WINDOW 10
+#endif
+
+//! @brief Sensor events
+
+typedef enum
+{
+    //! @brief Error event
+    TWR_SENSOR_EVENT_ERROR = 0,
+
+    //! @brief Update event
+    TWR_SENSOR_EVENT_UPDATE = 1
+
+} twr_sensor_event_t;
+
+//! @brief Sensor descriptor, usually constant in flash and shared by all instances of a driver
+
+typedef struct
+{
+    //! @brief Write configuration to the sensor, called after start and after every error
+    bool (*initialize)(void *param);
+
+    //! @brief Time in milliseconds after initialization before the first conversion can be triggered
+    twr_tick_t initialization_time;
+
+    //! @brief Start conversion
+    bool (*trigger)(void *param);
+
+    //! @brief Time in milliseconds between trigger and read
+    twr_tick_t conversion_time;
+
+    //! @brief Read result of conversion
+    bool (*read)(void *param);
+
+    //! @brief Report result of the measurement cycle
+    void (*event)(void *param, twr_sensor_event_t event);
+
+} twr_sensor_descriptor_t;
+
+//! @brief Sensor instance
+
+typedef struct twr_sensor_t twr_sensor_t;
+
+//! @cond
+
+typedef enum
+{
+    TWR_SENSOR_STATE_ERROR = -1,
+    TWR_SENSOR_STATE_INITIALIZE = 0,
+    TWR_SENSOR_STATE_MEASURE = 1,
+    TWR_SENSOR_STATE_READ = 2,
+    TWR_SENSOR_STATE_UPDATE = 3
+
+} twr_sensor_state_t;
+
+struct twr_sensor_t
+{
+    const twr_sensor_descriptor_t *_descriptor;
+    void *_param;
+    twr_sensor_state_t _state;
+    bool _measurement_active;
+    volatile bool _signal;
+    twr_tick_t _update_interval;
+    twr_tick_t _conversion_time;
+    twr_tick_t _tick_interval;
+    twr_tick_t _tick_ready;
+    twr_tick_t _tick_action;
+    twr_tick_t _tick_hold;
+    twr_sensor_t *_next;
+};
+
+//! @endcond
+
+//! @brief Register sensor to the sampling engine
+//! @param[in] self Instance
+//! @param[in] descriptor Sensor descriptor
+//! @param[in] param Parameter passed to descriptor functions
+//! @param[in] delay_run Delay in milliseconds before the sensor is initialized
+
+void twr_sensor_init(twr_sensor_t *self, const twr_sensor_descriptor_t *descriptor, void *param, twr_tick_t delay_run);
+
+//! @brief Unregister sensor from the sampling engine
+//! @param[in] self Instance
+
+void twr_sensor_unregister(twr_sensor_t *self);
+
+//! @brief Set measurement interval
+//! @param[in] self Instance
+//! @param[in] interval Measurement interval
+
+void twr_sensor_set_update_interval(twr_sensor_t *self, twr_tick_t interval);
+
+//! @brief Override conversion time of the descriptor
+//!
+//! Zero conversion time skips the trigger and reads the sensor right away, e.g. in continuous conversion mode.
+//! @param[in] self Instance
+//! @param[in] conversion_time Conversion time in milliseconds
+
+void twr_sensor_set_conversion_time(twr_sensor_t *self, twr_tick_t conversion_time);
+
+//! @brief Write configuration again before the next measurement
+//! @param[in] self Instance
+
+void twr_sensor_reinitialize(twr_sensor_t *self);
+
+//! @brief Postpone reading of the next result at least until given tick
+//!
+//! Allows to read several sensors with different conversion times in one pass, hold is dropped when measurement ends.
+//! @param[in] self Instance
+//! @param[in] tick Absolute tick
+
+void twr_sensor_hold_read(twr_sensor_t *self, twr_tick_t tick);
+
+//! @brief Start measurement manually
+//! @param[in] self Instance
+//! @return true On success
+//! @return false When other measurement is in progress
+
+bool twr_sensor_measure(twr_sensor_t *self);
+
+//! @brief Request measurement, safe to call from interrupt
+//! @param[in] self Instance
+
+void twr_sensor_signal(twr_sensor_t *self);
+
+//! @}
+
+#endif // _TWR_SENSOR_H
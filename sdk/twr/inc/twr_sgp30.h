@@ -8,6 +8,18 @@
 //! @brief Driver for SGP30 VOC gas sensor
 //! @{
 
+//! @brief Interval of storing baseline in key/value store (in milliseconds)
+
+#ifndef TWR_SGP30_BASELINE_INTERVAL
+#define TWR_SGP30_BASELINE_INTERVAL (60 * 60 * 1000)
+#endif
+
+//! @brief Maximum age of stored baseline to be restored on initialization (in seconds)
+
+#ifndef TWR_SGP30_BASELINE_MAX_AGE
+#define TWR_SGP30_BASELINE_MAX_AGE (7 * 24 * 60 * 60)
+#endif
+
 //! @brief Callback events
 
 typedef enum
@@ -35,7 +47,10 @@ typedef enum
     TWR_SGP30_STATE_INIT_AIR_QUALITY = 3,
     TWR_SGP30_STATE_SET_HUMIDITY = 4,
     TWR_SGP30_STATE_MEASURE_AIR_QUALITY = 5,
-    TWR_SGP30_STATE_READ_AIR_QUALITY = 6
+    TWR_SGP30_STATE_READ_AIR_QUALITY = 6,
+    TWR_SGP30_STATE_SET_BASELINE = 7,
+    TWR_SGP30_STATE_GET_BASELINE = 8,
+    TWR_SGP30_STATE_READ_BASELINE = 9
 
 } twr_sgp30_state_t;
 
@@ -56,6 +71,11 @@ struct twr_sgp30_t
     uint16_t _co2eq;
     uint16_t _tvoc;
     uint16_t _ah_scaled;
+    bool _baseline_enabled;
+    uint16_t _baseline_key;
+    twr_tick_t _tick_baseline;
+    bool (*_compensation_source)(void *, float *, float *);
+    void *_compensation_param;
 };
 
 //! @endcond
@@ -116,6 +136,23 @@ bool twr_sgp30_get_tvoc_ppb(twr_sgp30_t *self, uint16_t *ppb);
 
 float twr_sgp30_set_compensation(twr_sgp30_t *self, float *t_celsius, float *rh_percentage);
 
+//! @brief Set source of compensation, it is asked for temperature and humidity before every measurement
+//! @param[in] self Instance
+//! @param[in] source Function filling temperature in degrees of celsius and relative humidity in percentage, returning false when they are not available (NULL to disable)
+//! @param[in] param Optional parameter passed to source (can be NULL)
+
+void twr_sgp30_set_compensation_source(twr_sgp30_t *self, bool (*source)(void *, float *, float *), void *param);
+
+//! @brief Enable persistence of baseline in key/value store (see twr_kv), store has to be initialized by application
+//!
+//! Baseline is stored every @ref TWR_SGP30_BASELINE_INTERVAL together with RTC timestamp, the first one 12 hours after
+//! start when no baseline has been restored. Baseline not older than @ref TWR_SGP30_BASELINE_MAX_AGE is restored on
+//! initialization, so the sensor does not have to go through its 12 hour warm-up after reset. Call right after init.
+//! @param[in] self Instance
+//! @param[in] key Key in key/value store
+
+void twr_sgp30_set_baseline_key(twr_sgp30_t *self, uint16_t key);
+
 //! @}
 
 #endif // _TWR_SGP30_H
@@ -6,8 +6,18 @@
 
 //! @addtogroup twr_sgpc3 twr_sgpc3
 //! @brief Driver for SGPC3 VOC gas sensor
+//!
+//! Sensor is sampled in ultra-low power mode (every 30 s) by default. With baseline key set, learned baseline is
+//! saved by @ref twr_kv every TWR_SGPC3_BASELINE_SAVE_INTERVAL and restored on initialization, so that sensor skips
+//! preheating and re-learning after reset.
 //! @{
 
+//! @brief Interval of baseline saving
+
+#ifndef TWR_SGPC3_BASELINE_SAVE_INTERVAL
+#define TWR_SGPC3_BASELINE_SAVE_INTERVAL (60 * 60 * 1000)
+#endif
+
 //! @brief Callback events
 
 typedef enum
@@ -20,6 +30,18 @@ typedef enum
 
 } twr_sgpc3_event_t;
 
+//! @brief Power modes
+
+typedef enum
+{
+    //! @brief Ultra-low power mode (sampling every 30 s)
+    TWR_SGPC3_POWER_MODE_ULTRA_LOW = 0,
+
+    //! @brief Low power mode (sampling every 2 s)
+    TWR_SGPC3_POWER_MODE_LOW = 1
+
+} twr_sgpc3_power_mode_t;
+
 //! @brief SGPC3 instance
 
 typedef struct twr_sgpc3_t twr_sgpc3_t;
@@ -34,9 +56,12 @@ typedef enum
     TWR_SGPC3_STATE_READ_FEATURE_SET = 2,
     TWR_SGPC3_STATE_SET_POWER_MODE = 3,
     TWR_SGPC3_STATE_INIT_AIR_QUALITY = 4,
-    TWR_SGPC3_STATE_SET_HUMIDITY = 5,
-    TWR_SGPC3_STATE_MEASURE_AIR_QUALITY = 6,
-    TWR_SGPC3_STATE_READ_AIR_QUALITY = 7
+    TWR_SGPC3_STATE_SET_BASELINE = 5,
+    TWR_SGPC3_STATE_SET_HUMIDITY = 6,
+    TWR_SGPC3_STATE_MEASURE_AIR_QUALITY = 7,
+    TWR_SGPC3_STATE_READ_AIR_QUALITY = 8,
+    TWR_SGPC3_STATE_GET_BASELINE = 9,
+    TWR_SGPC3_STATE_READ_BASELINE = 10
 
 } twr_sgpc3_state_t;
 
@@ -52,10 +77,18 @@ struct twr_sgpc3_t
     twr_sgpc3_state_t _state;
     twr_tick_t _tick_ready;
     twr_tick_t _tick_last_measurement;
+    twr_tick_t _tick_baseline_save;
     bool _hit_error;
     bool _measurement_valid;
     uint16_t _tvoc;
     uint16_t _ah_scaled;
+    twr_sgpc3_power_mode_t _power_mode;
+    bool _baseline_key_enabled;
+    uint16_t _baseline_key;
+    bool _baseline_valid;
+    uint16_t _baseline;
+    bool (*_compensation_source)(void *, float *, float *);
+    void *_compensation_param;
 };
 
 //! @endcond
@@ -92,6 +125,18 @@ void twr_sgpc3_set_update_interval(twr_sgpc3_t *self, twr_tick_t interval);
 
 bool twr_sgpc3_measure(twr_sgpc3_t *self);
 
+//! @brief Set power mode, sensor is initialized again when mode changes
+//! @param[in] self Instance
+//! @param[in] mode Power mode
+
+void twr_sgpc3_set_power_mode(twr_sgpc3_t *self, twr_sgpc3_power_mode_t mode);
+
+//! @brief Set key of baseline stored by twr_kv (twr_kv has to be initialized), stored baseline is restored
+//! @param[in] self Instance
+//! @param[in] key Key
+
+void twr_sgpc3_set_baseline_key(twr_sgpc3_t *self, uint16_t key);
+
 //! @brief Get measured TVOC in ppb (parts per billion)
 //! @param[in] self Instance
 //! @param[out] ppb Pointer to variable where result will be stored
@@ -108,6 +153,13 @@ bool twr_sgpc3_get_tvoc_ppb(twr_sgpc3_t *self, uint16_t *ppb);
 
 float twr_sgpc3_set_compensation(twr_sgpc3_t *self, float *t_celsius, float *rh_percentage);
 
+//! @brief Set source of sensor compensation queried before every measurement
+//! @param[in] self Instance
+//! @param[in] source Function filling temperature in degrees of celsius and relative humidity in percentage, returns false when values are not available (can be NULL)
+//! @param[in] param Optional parameter of source (can be NULL)
+
+void twr_sgpc3_set_compensation_source(twr_sgpc3_t *self, bool (*source)(void *, float *, float *), void *param);
+
 //! @}
 
 #endif // _TWR_SGPC3_H
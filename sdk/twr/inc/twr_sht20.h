@@ -2,7 +2,7 @@
 #define _TWR_SHT20_H
 
 #include <twr_i2c.h>
-#include <twr_scheduler.h>
+#include <twr_coroutine.h>
 
 //! @addtogroup twr_sht20 twr_sht20
 //! @brief Driver for SHT20 humidity sensor
@@ -26,18 +26,6 @@ typedef struct twr_sht20_t twr_sht20_t;
 
 //! @cond
 
-typedef enum
-{
-    TWR_SHT20_STATE_ERROR = -1,
-    TWR_SHT20_STATE_INITIALIZE = 0,
-    TWR_SHT20_STATE_MEASURE_RH = 1,
-    TWR_SHT20_STATE_READ_RH = 2,
-    TWR_SHT20_STATE_MEASURE_T = 3,
-    TWR_SHT20_STATE_READ_T = 4,
-    TWR_SHT20_STATE_UPDATE = 5
-
-} twr_sht20_state_t;
-
 struct twr_sht20_t
 {
     twr_i2c_channel_t _i2c_channel;
@@ -48,12 +36,14 @@ struct twr_sht20_t
     void *_event_param;
     bool _measurement_active;
     twr_tick_t _update_interval;
-    twr_sht20_state_t _state;
+    twr_coroutine_t _coroutine;
     twr_tick_t _tick_ready;
     bool _humidity_valid;
     bool _temperature_valid;
     uint16_t _reg_humidity;
     uint16_t _reg_temperature;
+    twr_i2c_async_t _transaction;
+    uint8_t _buffer[2];
 };
 
 //! @endcond
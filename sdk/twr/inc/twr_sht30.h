@@ -2,7 +2,7 @@
 #define _TWR_SHT30_H
 
 #include <twr_i2c.h>
-#include <twr_scheduler.h>
+#include <twr_sensor.h>
 
 //! @addtogroup twr_sht30 twr_sht30
 //! @brief Driver for SHT30 humidity sensor
@@ -23,38 +23,69 @@ typedef enum
 
 } twr_sht30_event_t;
 
-//! @brief SHT30 instance
+//! @brief Measurement mode
 
-typedef struct twr_sht30_t twr_sht30_t;
+typedef enum
+{
+    //! @brief Single-shot measurement on every update, sensor is idle in between (default)
+    TWR_SHT30_MODE_SINGLE_SHOT = 0,
 
-//! @cond
+    //! @brief Periodic measurement at 0.5 measurements per second
+    TWR_SHT30_MODE_PERIODIC_0_5_MPS = 1,
+
+    //! @brief Periodic measurement at 1 measurement per second
+    TWR_SHT30_MODE_PERIODIC_1_MPS = 2,
+
+    //! @brief Periodic measurement at 2 measurements per second
+    TWR_SHT30_MODE_PERIODIC_2_MPS = 3,
+
+    //! @brief Periodic measurement at 4 measurements per second
+    TWR_SHT30_MODE_PERIODIC_4_MPS = 4,
+
+    //! @brief Periodic measurement at 10 measurements per second
+    TWR_SHT30_MODE_PERIODIC_10_MPS = 5,
+
+    //! @brief Periodic measurement at 4 measurements per second with accelerated response time (repeatability is not used)
+    TWR_SHT30_MODE_ART = 6
+
+} twr_sht30_mode_t;
+
+//! @brief Repeatability of measurement, higher repeatability means lower noise but longer conversion and higher current
 
 typedef enum
 {
-    TWR_SHT30_STATE_ERROR = -1,
-    TWR_SHT30_STATE_INITIALIZE = 0,
-    TWR_SHT30_STATE_MEASURE = 1,
-    TWR_SHT30_STATE_READ = 2,
-    TWR_SHT30_STATE_UPDATE = 3
+    //! @brief Low repeatability
+    TWR_SHT30_REPEATABILITY_LOW = 0,
+
+    //! @brief Medium repeatability (default)
+    TWR_SHT30_REPEATABILITY_MEDIUM = 1,
 
-} twr_sht30_state_t;
+    //! @brief High repeatability
+    TWR_SHT30_REPEATABILITY_HIGH = 2
+
+} twr_sht30_repeatability_t;
+
+//! @brief SHT30 instance
+
+typedef struct twr_sht30_t twr_sht30_t;
+
+//! @cond
 
 struct twr_sht30_t
 {
     twr_i2c_channel_t _i2c_channel;
     uint8_t _i2c_address;
-    twr_scheduler_task_id_t _task_id_interval;
-    twr_scheduler_task_id_t _task_id_measure;
+    twr_sensor_t _sensor;
     void (*_event_handler)(twr_sht30_t *, twr_sht30_event_t, void *);
     void *_event_param;
-    bool _measurement_active;
-    twr_tick_t _update_interval;
-    twr_sht30_state_t _state;
-    twr_tick_t _tick_ready;
     bool _humidity_valid;
     bool _temperature_valid;
     uint16_t _reg_humidity;
     uint16_t _reg_temperature;
+    twr_sht30_mode_t _mode;
+    twr_sht30_repeatability_t _repeatability;
+    bool _periodic;
+    twr_tick_t _tick_fetch;
 };
 
 //! @endcond
@@ -84,6 +115,21 @@ void twr_sht30_set_event_handler(twr_sht30_t *self, void (*event_handler)(twr_sh
 
 void twr_sht30_set_update_interval(twr_sht30_t *self, twr_tick_t interval);
 
+//! @brief Set measurement mode
+//!
+//! In periodic mode the sensor measures on its own and update only fetches the last result. Update interval should not
+//! be shorter than period of measurements, fetch without new result reports the previous one.
+//! @param[in] self Instance
+//! @param[in] mode Measurement mode
+
+void twr_sht30_set_mode(twr_sht30_t *self, twr_sht30_mode_t mode);
+
+//! @brief Set repeatability of measurement
+//! @param[in] self Instance
+//! @param[in] repeatability Repeatability
+
+void twr_sht30_set_repeatability(twr_sht30_t *self, twr_sht30_repeatability_t repeatability);
+
 //! @brief Start measurement manually
 //! @param[in] self Instance
 //! @return true On success
@@ -152,6 +152,7 @@ struct twr_soil_sensor_sensor_t
     int16_t _temperature_raw;
     bool _cap_valid;
     uint16_t _cap_raw;
+    bool _eeprom_loaded;
     twr_soil_sensor_eeprom_t _eeprom;
 };
 
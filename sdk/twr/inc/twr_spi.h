@@ -60,10 +60,53 @@ typedef enum
 typedef enum
 {
     //! @brief SPI event is completed
-    TWR_SPI_EVENT_DONE = 1
+    TWR_SPI_EVENT_DONE = 1,
+
+    //! @brief SPI event is error (chip select could not be set)
+    TWR_SPI_EVENT_ERROR = 2
 
 } twr_spi_event_t;
 
+//! @brief SPI queued transaction
+//!
+//! Transaction and its source buffer have to stay valid until event handler is called.
+
+typedef struct twr_spi_transaction_t twr_spi_transaction_t;
+
+struct twr_spi_transaction_t
+{
+    //! @brief Pointer to source buffer
+    const void *source;
+
+    //! @brief Number of bytes to be transferred
+    size_t length;
+
+    //! @brief SPI communication speed of transaction
+    twr_spi_speed_t speed;
+
+    //! @brief SPI mode of operation of transaction
+    twr_spi_mode_t mode;
+
+    //! @brief Chip select function (can be NULL)
+    //!
+    //! When NULL, CS pin (TWR_GPIO_P15) is driven low by driver, so transaction can be chained directly from
+    //! DMA interrupt. Otherwise function is called with true before and false after transfer from scheduler task.
+    bool (*cs_set)(bool active, void *event_param);
+
+    //! @brief Callback function called from scheduler task when transaction is finished (can be NULL)
+    void (*event_handler)(twr_spi_event_t event, void *event_param);
+
+    //! @brief Optional event parameter (can be NULL)
+    void *event_param;
+
+    //! @cond
+
+    twr_spi_transaction_t *_next;
+    bool _error;
+
+    //! @endcond
+};
+
 //! @brief Initialize SPI channel
 //! @param[in] speed SPI communication speed
 //! @param[in] mode SPI mode of operation
@@ -124,6 +167,22 @@ bool twr_spi_transfer(const void *source, void *destination, size_t length);
 
 bool twr_spi_async_transfer(const void *source, void *destination, size_t length, void (*event_handler)(twr_spi_event_t event, void *event_param), void (*event_param));
 
+//! @brief Submit transaction to SPI queue
+//!
+//! Transactions are transmitted by DMA one after another in order of submission, each with its own speed, mode and
+//! chip select. Blocking and async transfers are refused while queue is active.
+//! @param[in] transaction Pointer to transaction (transmit only)
+//! @return true On success
+//! @return false If SPI is not initialized or transaction is empty
+
+bool twr_spi_submit(twr_spi_transaction_t *transaction);
+
+//! @brief Check if SPI transaction queue is empty
+//! @return true If no transaction is queued or in progress
+//! @return false Otherwise
+
+bool twr_spi_queue_is_empty(void);
+
 //! @}
 
 #endif // _TWR_SPI_H
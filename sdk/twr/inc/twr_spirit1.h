@@ -11,8 +11,36 @@
 
 #define TWR_SPIRIT1_MAX_PACKET_SIZE 64
 
+// Shorter transfers are polled, DMA setup costs more than a few bytes
+#ifndef TWR_SPIRIT1_DMA_THRESHOLD
+#define TWR_SPIRIT1_DMA_THRESHOLD 8
+#endif
+
 //! @endcond
 
+//! @brief Keep shadow copy of configuration registers, so that their reads and writes of unchanged values skip SPI
+//!
+//! Registers 0x00 to 0x6F and IRQ mask are cached, status registers, IRQ status and FIFO are always transferred.
+
+#ifndef TWR_SPIRIT1_SHADOW
+#define TWR_SPIRIT1_SHADOW 1
+#endif
+
+//! @brief PHY profiles, both ends of link have to use the same profile
+
+typedef enum
+{
+    //! @brief 19.2 kbps, 20 kHz deviation, 100 kHz channel filter (default)
+    TWR_SPIRIT1_PROFILE_19200 = 0,
+
+    //! @brief 38.4 kbps, 20 kHz deviation, 100 kHz channel filter
+    TWR_SPIRIT1_PROFILE_38400 = 1,
+
+    //! @brief 100 kbps, 50 kHz deviation, 250 kHz channel filter, meant for mains-powered nodes
+    TWR_SPIRIT1_PROFILE_100000 = 2
+
+} twr_spirit1_profile_t;
+
 //! @brief Callback events
 
 typedef enum
@@ -28,12 +56,40 @@ typedef enum
 
 } twr_spirit1_event_t;
 
+//! @brief Statistics since initialization
+
+typedef struct
+{
+    //! @brief Time spent in TX state (airtime)
+    twr_tick_t tx_time;
+
+    //! @brief Time spent in RX state
+    twr_tick_t rx_time;
+
+    //! @brief Time spent in sleep (standby) state
+    twr_tick_t sleep_time;
+
+    //! @brief Number of transmitted packets
+    uint32_t tx_count;
+
+    //! @brief Number of received packets
+    uint32_t rx_count;
+
+} twr_spirit1_stats_t;
+
 //! @brief Initialize
 //! @return true On success
 //! @return false On failure
 
 bool twr_spirit1_init(void);
 
+//! @brief Set PHY profile, can be called before initialization or while in sleep state
+//! @param[in] profile PHY profile
+//! @return true On success
+//! @return false When radio is in TX or RX state
+
+bool twr_spirit1_set_profile(twr_spirit1_profile_t profile);
+
 //! @brief Deitialize
 //! @return true On success
 //! @return false On failure
@@ -76,6 +132,18 @@ size_t twr_spirit1_get_rx_length(void);
 
 int twr_spirit1_get_rx_rssi(void);
 
+//! @brief Get current RSSI of channel, used for listen before talk
+//! @param[out] rssi RSSI in dBm
+//! @return true On success
+//! @return false When receiver is not running
+
+bool twr_spirit1_get_rssi(int *rssi);
+
+//! @brief Get statistics, time of current state is included up to now
+//! @param[out] stats Pointer to statistics
+
+void twr_spirit1_get_stats(twr_spirit1_stats_t *stats);
+
 //! @brief Set TX timeout
 //! @param[in] timeout Maximum timeout for receiving
 
@@ -38,10 +38,24 @@ typedef enum
     TWR_SPS30_STATE_READ_DATAREADY_FLAG = 6,
     TWR_SPS30_STATE_GET_MEASUREMENT_DATA = 7,
     TWR_SPS30_STATE_READ_MEASUREMENT_DATA = 8,
-    TWR_SPS30_STATE_STOP_MEASUREMENT = 9
+    TWR_SPS30_STATE_STOP_MEASUREMENT = 9,
+    TWR_SPS30_STATE_WAKE_UP = 10,
+    TWR_SPS30_STATE_SLEEP = 11
 
 } twr_sps30_state_t;
 
+//! @brief Output format of measured values
+
+typedef enum
+{
+    //! @brief Big-endian IEEE754 float values (default)
+    TWR_SPS30_OUTPUT_FORMAT_FLOAT = 0,
+
+    //! @brief Unsigned 16-bit integer values, half of transfer and no float conversion (resolution of 1 unit)
+    TWR_SPS30_OUTPUT_FORMAT_INTEGER = 1
+
+} twr_sps30_output_format_t;
+
 //! @brief Mass concentration structure
 
 typedef struct
@@ -92,9 +106,14 @@ struct twr_sps30_t
     twr_tick_t _update_interval;
     twr_sps30_state_t _state;
     bool _measurement_valid;
-    twr_sps30_mass_concentration_t _mass_concentration;
-    twr_sps30_number_concentration_t _number_concentration;
-    float _typical_particle_size;
+    twr_sps30_output_format_t _output_format;
+    bool _sleep;
+    union
+    {
+        float real[10];
+        uint16_t integer[10];
+
+    } _value;
     twr_tick_t _startup_time;
     twr_tick_t _start_time;
 };
@@ -121,6 +140,18 @@ void twr_sps30_set_event_handler(twr_sps30_t *self, void (*event_handler)(twr_sp
 
 void twr_sps30_set_startup_time(twr_sps30_t *self, twr_tick_t startup_time);
 
+//! @brief Set output format of measured values, applied from the next measurement
+//! @param[in] self Instance
+//! @param[in] output_format Output format
+
+void twr_sps30_set_output_format(twr_sps30_t *self, twr_sps30_output_format_t output_format);
+
+//! @brief Enable sleep mode between measurements (requires firmware 2.0 or newer)
+//! @param[in] self Instance
+//! @param[in] sleep Sleep mode enabled
+
+void twr_sps30_set_sleep(twr_sps30_t *self, bool sleep);
+
 //! @brief Set measurement interval
 //! @param[in] self Instance
 //! @param[in] interval Measurement interval
@@ -158,6 +189,17 @@ bool twr_sps30_get_number_concentration(twr_sps30_t *self, twr_sps30_number_conc
 
 bool twr_sps30_get_typical_particle_size(twr_sps30_t *self, float *typical_particle_size);
 
+//! @brief Get measured values in integer output format without conversion
+//!
+//! Values are in order mass concentration PM1.0, PM2.5, PM4.0, PM10 in μg/m3, number concentration PM0.5, PM1.0,
+//! PM2.5, PM4.0, PM10 in #/cm3 and typical particle size in nm.
+//! @param[in] self Instance
+//! @param[out] values Array of values
+//! @return true When values are valid
+//! @return false When values are invalid or output format is not integer
+
+bool twr_sps30_get_values_integer(twr_sps30_t *self, uint16_t values[10]);
+
 //! @}
 
 #endif // _TWR_SPS30_H
@@ -12,6 +12,10 @@
 #define TWR_SSD1306_ADDRESS_I2C_ADDRESS_DEFAULT 0x3C
 #define TWR_SSD1306_ADDRESS_I2C_ADDRESS_ALTERNATE 0x3D
 
+//! @brief Maximum number of pages (8 rows each) tracked for partial update
+
+#define TWR_SSD1306_PAGES_MAX 8
+
 #define TWR_SSD1306_FRAMEBUFFER(NAME, WIDTH, HEIGHT) \
     uint8_t NAME##_buffer[WIDTH * HEIGHT / 8]; \
     twr_ssd1306_framebuffer_t NAME = { \
@@ -40,6 +44,15 @@ typedef struct
     uint8_t _i2c_address;
     const twr_ssd1306_framebuffer_t *_framebuffer;
     bool _initialized;
+    uint8_t _dirty_first[TWR_SSD1306_PAGES_MAX];
+    uint8_t _dirty_last[TWR_SSD1306_PAGES_MAX];
+    int _async_page;
+    uint8_t _async_first;
+    uint8_t _async_last;
+    bool _async_error;
+    uint8_t _async_command[6];
+    twr_i2c_async_t _async_command_transaction;
+    twr_i2c_async_t _async_data_transaction;
 
 } twr_ssd1306_t;
 
@@ -85,6 +98,10 @@ void twr_ssd1306_draw_pixel(twr_ssd1306_t *self, int x, int y, uint32_t color);
 uint32_t twr_ssd1306_get_pixel(twr_ssd1306_t *self, int x, int y);
 
 //! @brief Lcd update, send data
+//!
+//! Only column ranges of pages changed since the last update are sent, each page as one window. Pages are sent by
+//! asynchronous I2C transactions one after another, so the call does not block the bus and pages changed meanwhile are
+//! sent by the same sequence. Blocking transfers are used when asynchronous transactions are not available on the channel.
 //! @param[in] self Instance
 //! @return true On success
 //! @return false On failure
@@ -0,0 +1,78 @@
+#ifndef _TWR_STACK_H
+#define _TWR_STACK_H
+
+#include <twr_common.h>
+
+//! @addtogroup twr_stack twr_stack
+//! @brief Usage and overflow guard of main stack
+//!
+//! Tasks, event handlers and interrupts share main stack which grows from the end of RAM down to the end of heap.
+//! With @ref TWR_STACK_PAINT startup code fills its free part with pattern, so the deepest use is found as the lowest
+//! overwritten word and scheduler checks guard at the bottom on every spin (TWR_ERROR_STACK_OVERFLOW when damaged).
+//! @{
+
+//! @brief Paint free stack at startup and check guard on every spin of scheduler
+
+#ifndef TWR_STACK_PAINT
+#define TWR_STACK_PAINT 0
+#endif
+
+//! @brief Pattern of free stack
+
+#define TWR_STACK_PATTERN 0xa5a5a5a5
+
+//! @brief Size of guard at the bottom of stack in bytes
+
+#ifndef TWR_STACK_GUARD_SIZE
+#define TWR_STACK_GUARD_SIZE 32
+#endif
+
+//! @brief AT command printing stack size, current use and high watermark
+
+#define TWR_STACK_ATCI_COMMAND {"$STACK", twr_stack_atci_action, NULL, NULL, NULL, "Print stack usage"}
+
+#if TWR_STACK_PAINT
+
+//! @brief Paint free stack below stack pointer (called by startup code before initialization of system)
+
+void twr_stack_paint(void);
+
+#endif
+
+//! @brief Get size of stack region from the end of heap to the end of RAM
+//! @return Size in bytes
+
+size_t twr_stack_get_size(void);
+
+//! @brief Get current use of stack
+//! @return Number of bytes above stack pointer
+
+size_t twr_stack_get_used(void);
+
+//! @brief Get the deepest use of stack since startup
+//! @return Number of bytes, 0 without @ref TWR_STACK_PAINT
+
+size_t twr_stack_get_high_watermark(void);
+
+//! @brief Check guard at the bottom of stack
+//! @return true When guard is intact or without @ref TWR_STACK_PAINT
+//! @return false When stack has overflown into guard
+
+bool twr_stack_check_guard(void);
+
+//! @brief Measure stack used below caller since previous measurement and paint it again
+//!
+//! Used by scheduler profiling for stack use of every task (including interrupts taken meanwhile). Scan ends on
+//! 32 bytes of pattern, so buffer on stack left unwritten over that length hides use beyond it.
+//! @return Number of bytes below stack pointer of caller, 0 without @ref TWR_STACK_PAINT
+
+size_t twr_stack_measure(void);
+
+//! @brief AT command action printing stack usage
+//! @return true Always
+
+bool twr_stack_atci_action(void);
+
+//! @}
+
+#endif // _TWR_STACK_H
@@ -3,21 +3,204 @@
 
 #include <stm32l0xx.h>
 #include <twr_common.h>
+#include <twr_trace.h>
 
 typedef enum
 {
     TWR_SYSTEM_CLOCK_MSI = 0,
     TWR_SYSTEM_CLOCK_HSI = 1,
-    TWR_SYSTEM_CLOCK_PLL = 2
+    TWR_SYSTEM_CLOCK_PLL = 2,
+    TWR_SYSTEM_CLOCK_MSI_FAST = 3
 
 } twr_system_clock_t;
 
+//! @brief Frequency of MSI in default range
+
+#define TWR_SYSTEM_CLOCK_FREQUENCY_MSI 2097000
+
+//! @brief Frequency of MSI in fast range, kept in stop mode
+
+#define TWR_SYSTEM_CLOCK_FREQUENCY_MSI_FAST 4194000
+
+//! @brief Frequency of HSI16
+
+#define TWR_SYSTEM_CLOCK_FREQUENCY_HSI 16000000
+
+//! @brief Frequency of PLL
+
+#define TWR_SYSTEM_CLOCK_FREQUENCY_PLL 32000000
+
+//! @brief Defer lowering of system clock after release until scheduler goes idle
+//!
+//! Drivers releasing and requesting clock within one scheduler spin (e.g. sequence of I2C transfers) then share one
+//! transition up and down instead of locking PLL for every job.
+
+#ifndef TWR_SYSTEM_CLOCK_DEFER
+#define TWR_SYSTEM_CLOCK_DEFER 1
+#endif
+
+//! @brief Count time spent in every clock and power state
+//!
+//! Run and sleep time is measured by SysTick with microsecond resolution, stop time by tick. Time above MSI is also
+//! attributed to the code which raised the clock to its current level, identified by return address of the request
+//! (map it to function by addr2line).
+
+#ifndef TWR_SYSTEM_RESIDENCY
+#define TWR_SYSTEM_RESIDENCY 0
+#endif
+
+//! @brief Number of code addresses to which time above MSI is attributed
+
+#ifndef TWR_SYSTEM_RESIDENCY_OWNERS
+#define TWR_SYSTEM_RESIDENCY_OWNERS 8
+#endif
+
+//! @brief Wake profile, regulator in low-power mode during stop (the lowest stop current)
+
+#define TWR_SYSTEM_WAKE_PROFILE_LOW_POWER 0
+
+//! @brief Wake profile, main regulator kept during stop and stop entered and left by code in RAM
+//!
+//! Wake-up does not wait for regulator mode change and the code following WFI does not wait for flash to wake up,
+//! interrupt is taken once it has finished. Stop current rises by the quiescent current of main regulator.
+
+#define TWR_SYSTEM_WAKE_PROFILE_FAST 1
+
+//! @brief Wake profile (both keep ultra-low-power mode with fast wake-up and MSI as wake-up clock)
+
+#ifndef TWR_SYSTEM_WAKE_PROFILE
+#define TWR_SYSTEM_WAKE_PROFILE TWR_SYSTEM_WAKE_PROFILE_LOW_POWER
+#endif
+
+//! @brief Measure wake latency, time from restart of the core clock after stop until the code following WFI runs
+//!
+//! Measured by SysTick, which does not run in stop mode (implies stop entered by code in RAM).
+
+#ifndef TWR_SYSTEM_WAKE_STATS
+#define TWR_SYSTEM_WAKE_STATS 0
+#endif
+
+//! @brief Wake latency statistics
+
+typedef struct
+{
+    //! @brief Number of wake-ups from stop mode
+    uint32_t count;
+
+    //! @brief Total latency in nanoseconds
+    uint64_t latency_total;
+
+    //! @brief Maximum latency in nanoseconds
+    uint32_t latency_max;
+
+} twr_system_wake_stats_t;
+
+//! @brief Clock and power state
+
+typedef enum
+{
+    //! @brief Running from MSI in default range
+    TWR_SYSTEM_STATE_MSI = 0,
+
+    //! @brief Running from MSI in fast range
+    TWR_SYSTEM_STATE_MSI_FAST = 1,
+
+    //! @brief Running from HSI16
+    TWR_SYSTEM_STATE_HSI = 2,
+
+    //! @brief Running from PLL
+    TWR_SYSTEM_STATE_PLL = 3,
+
+    //! @brief Sleep mode (core halted, clock running, including interrupt handlers woken from it)
+    TWR_SYSTEM_STATE_SLEEP = 4,
+
+    //! @brief Stop mode
+    TWR_SYSTEM_STATE_STOP = 5
+
+} twr_system_state_t;
+
+//! @brief Number of clock and power states
+
+#define TWR_SYSTEM_STATE_COUNT 6
+
+//! @brief Residency counters
+
+typedef struct
+{
+    //! @brief Time spent in every state in microseconds
+    uint64_t time[TWR_SYSTEM_STATE_COUNT];
+
+    //! @brief Number of clock transitions
+    uint32_t transitions;
+
+    //! @brief Time above MSI by code which raised the clock
+    struct
+    {
+        //! @brief Return address of request (0 for unused entry and for all code beyond table size)
+        uintptr_t caller;
+
+        //! @brief Number of times the clock was raised
+        uint32_t count;
+
+        //! @brief Time in microseconds
+        uint64_t time;
+
+    } owner[TWR_SYSTEM_RESIDENCY_OWNERS];
+
+} twr_system_residency_t;
+
+#if TWR_SYSTEM_RESIDENCY
+
+//! @brief AT command printing residency counters
+
+#define TWR_SYSTEM_RESIDENCY_ATCI_COMMAND {"$RESIDENCY", twr_system_residency_atci_action, NULL, NULL, NULL, "Print time spent in clock and power states"}
+
+void twr_system_residency_sleep_enter(void);
+
+void twr_system_residency_sleep_exit(void);
+
+#endif
+
+//! @brief Enter sleep or stop mode by code in RAM (used by twr_system_sleep in fast wake profile)
+
+void twr_system_sleep_ram(void);
+
 void twr_system_init(void);
 
 static inline void twr_system_sleep(void)
 {
+#if TWR_SYSTEM_RESIDENCY
+    twr_system_residency_sleep_enter();
+#endif
+
+#if TWR_TRACE
+    twr_trace_sleep_enter();
+#endif
+
+#if TWR_SYSTEM_WAKE_PROFILE == TWR_SYSTEM_WAKE_PROFILE_FAST || TWR_SYSTEM_WAKE_STATS
+
+    twr_system_sleep_ram();
+
+#if TWR_SYSTEM_RESIDENCY
+    twr_system_residency_sleep_exit();
+#endif
+
+#if TWR_TRACE
+    twr_trace_sleep_exit();
+#endif
+
+#else
+
     __WFI();
 
+#if TWR_SYSTEM_RESIDENCY
+    twr_system_residency_sleep_exit();
+#endif
+
+#if TWR_TRACE
+    twr_trace_sleep_exit();
+#endif
+
     // TODO: Is there a better way to determine whether the RTC RSF bit needs to
     // be cleared?
 
@@ -40,10 +223,29 @@ static inline void twr_system_sleep(void)
         RTC->ISR &= ~RTC_ISR_RSF;
         RTC->WPR = 0xff;
     }
+
+#endif
 }
 
 twr_system_clock_t twr_system_clock_get(void);
 
+//! @brief Request minimum system clock frequency
+//!
+//! Governor runs the slowest clock which satisfies all requests (MSI, MSI fast range, HSI16 or PLL) and sets voltage
+//! range and flash latency for it. Clock is raised immediately, stop mode is disabled while HSI16 or PLL runs.
+//! @param[in] frequency Minimum frequency in Hz (exact frequency of level for drivers which derive timing from it)
+
+void twr_system_clock_request(uint32_t frequency);
+
+//! @brief Release request made by @ref twr_system_clock_request
+//! @param[in] frequency Frequency in Hz given to the request
+
+void twr_system_clock_release(uint32_t frequency);
+
+//! @brief Lower system clock according to remaining requests, called by scheduler before going idle
+
+void twr_system_clock_commit(void);
+
 void twr_system_hsi16_enable(void);
 
 void twr_system_hsi16_disable(void);
@@ -56,10 +258,79 @@ void twr_system_deep_sleep_disable(void);
 
 void twr_system_deep_sleep_enable(void);
 
+//! @brief Enter standby mode with RTC and wake-up sources disabled (left by reset only)
+
 void twr_system_enter_standby_mode(void);
 
+//! @brief Number of backup registers available to application, they keep their value in standby mode
+
+#define TWR_SYSTEM_BACKUP_COUNT 2
+
+//! @brief Enter standby mode and wake up by RTC alarm after timeout
+//!
+//! RAM content is lost and wake-up starts program from reset. Tick is kept in backup registers and continues after
+//! wake-up, so tasks planned by absolute tick stay in time. Other state to be resumed has to be kept by application
+//! in backup registers (see @ref twr_system_backup_write) or EEPROM. Alarm has resolution of one second and timeout
+//! is limited to 24 hours. Function does not return.
+//! @param[in] timeout Timeout in milliseconds (rounded up to seconds)
+
+void twr_system_enter_standby_alarm(uint32_t timeout);
+
+//! @brief Check if program has been started by wake-up from @ref twr_system_enter_standby_alarm
+//! @return true When woken up from standby mode by RTC alarm
+
+bool twr_system_is_standby_wakeup(void);
+
+//! @brief Write backup register
+//! @param[in] index Index of register (less than @ref TWR_SYSTEM_BACKUP_COUNT)
+//! @param[in] value Value to be written
+
+void twr_system_backup_write(size_t index, uint32_t value);
+
+//! @brief Read backup register
+//! @param[in] index Index of register (less than @ref TWR_SYSTEM_BACKUP_COUNT)
+//! @return Value of register (zero for invalid index)
+
+uint32_t twr_system_backup_read(size_t index);
+
+//! @brief Stop periodic tick and program RTC wake-up timer to expire after timeout (in milliseconds, up to about 32 s)
+//! @return true if tickless idle has been entered
+
+bool twr_system_tickless_enter(uint32_t timeout);
+
+//! @brief Leave tickless idle, advance tick counter by elapsed time and restore periodic tick (safe to call from interrupt)
+
+void twr_system_tickless_exit(void);
+
 uint32_t twr_system_get_clock(void);
 
+//! @brief Get residency counters, updated up to now
+//! @param[out] residency Pointer to destination structure (zeroed without TWR_SYSTEM_RESIDENCY)
+
+void twr_system_get_residency(twr_system_residency_t *residency);
+
+//! @brief Clear residency counters
+
+void twr_system_residency_reset(void);
+
+#if TWR_SYSTEM_RESIDENCY
+
+//! @brief Print residency counters as AT command response, use in TWR_SYSTEM_RESIDENCY_ATCI_COMMAND
+//! @return true Always
+
+bool twr_system_residency_atci_action(void);
+
+#endif
+
+//! @brief Get wake latency statistics
+//! @param[out] stats Pointer to destination structure (zeroed without TWR_SYSTEM_WAKE_STATS)
+
+void twr_system_get_wake_stats(twr_system_wake_stats_t *stats);
+
+//! @brief Clear wake latency statistics
+
+void twr_system_wake_stats_reset(void);
+
 void twr_system_reset(void);
 
 bool twr_system_get_vbus_sense(void);
@@ -15,7 +15,10 @@ typedef enum
     TWR_TAG_BAROMETER_EVENT_ERROR = TWR_MPL3115A2_EVENT_ERROR,
 
     //! @brief Update event
-    TWR_TAG_BAROMETER_EVENT_UPDATE = TWR_MPL3115A2_EVENT_UPDATE
+    TWR_TAG_BAROMETER_EVENT_UPDATE = TWR_MPL3115A2_EVENT_UPDATE,
+
+    //! @brief FIFO samples have been read
+    TWR_TAG_BAROMETER_EVENT_FIFO = TWR_MPL3115A2_EVENT_FIFO
 
 } twr_tag_barometer_event_t;
 
@@ -65,6 +68,27 @@ bool twr_tag_barometer_get_altitude_meter(twr_tag_barometer_t *self, float *mete
 
 bool twr_tag_barometer_get_pressure_pascal(twr_tag_barometer_t *self, float *pascal);
 
+//! @brief Start logging into FIFO of sensor (see twr_mpl3115a2_fifo_start)
+//! @param[in] self Instance
+//! @param[in] mode Quantity sampled into FIFO
+//! @param[in] period Auto-acquisition period
+//! @param[in] watermark Number of samples read at once (1 to 32)
+
+void twr_tag_barometer_fifo_start(twr_tag_barometer_t *self, twr_mpl3115a2_fifo_mode_t mode, twr_mpl3115a2_period_t period, uint8_t watermark);
+
+//! @brief Stop logging into FIFO of sensor
+//! @param[in] self Instance
+
+void twr_tag_barometer_fifo_stop(twr_tag_barometer_t *self);
+
+//! @brief Get samples of the last FIFO read, the oldest first
+//! @param[in] self Instance
+//! @param[out] values Altitudes in meters or pressures in Pascal depending on FIFO mode
+//! @param[in] count Size of values array
+//! @return Number of samples stored into values array
+
+size_t twr_tag_barometer_fifo_get(twr_tag_barometer_t *self, float *values, size_t count);
+
 //! @}
 
 #endif // _TWR_TAG_BAROMETER_H
@@ -55,6 +55,20 @@ void twr_tag_lux_meter_set_event_handler(twr_tag_lux_meter_t *self, void (*event
 
 void twr_tag_lux_meter_set_update_interval(twr_tag_lux_meter_t *self, twr_tick_t interval);
 
+//! @brief Enable wake-up by INT output when illuminance leaves the window around the last measured value (see twr_opt3001_set_alert)
+//! @param[in] self Instance
+//! @param[in] line EXTI line connected to INT output
+//! @param[in] delta Half width of the window relative to the last value (e.g. 0.2 for 20 %)
+//! @return true On success
+//! @return false When delta is not positive
+
+bool twr_tag_lux_meter_set_alert(twr_tag_lux_meter_t *self, twr_exti_line_t line, float delta);
+
+//! @brief Disable wake-up by INT output
+//! @param[in] self Instance
+
+void twr_tag_lux_meter_clear_alert(twr_tag_lux_meter_t *self);
+
 //! @brief Start measurement manually
 //! @param[in] self Instance
 //! @return true On success
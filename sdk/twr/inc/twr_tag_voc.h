@@ -73,6 +73,19 @@ bool twr_tag_voc_get_tvoc_ppb(twr_tag_voc_t *self, uint16_t *ppb);
 
 float twr_tag_voc_set_compensation(twr_tag_voc_t *self, float *t_celsius, float *rh_percentage);
 
+//! @brief Set source of compensation (see twr_sgp30_set_compensation_source)
+//! @param[in] self Instance
+//! @param[in] source Function filling temperature in degrees of celsius and relative humidity in percentage, returning false when they are not available (NULL to disable)
+//! @param[in] param Optional parameter passed to source (can be NULL)
+
+void twr_tag_voc_set_compensation_source(twr_tag_voc_t *self, bool (*source)(void *, float *, float *), void *param);
+
+//! @brief Enable persistence of baseline in key/value store (see twr_sgp30_set_baseline_key)
+//! @param[in] self Instance
+//! @param[in] key Key in key/value store
+
+void twr_tag_voc_set_baseline_key(twr_tag_voc_t *self, uint16_t key);
+
 //! @}
 
 #endif // _TWR_TAG_VOC_H
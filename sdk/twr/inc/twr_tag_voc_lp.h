@@ -2,6 +2,7 @@
 #define _TWR_TAG_VOC_LP_H
 
 #include <twr_sgpc3.h>
+#include <twr_tag_humidity.h>
 
 //! @addtogroup twr_tag_voc_lp twr_tag_voc_lp
 //! @brief Driver for HARDWARIO VOC-LP Module
@@ -49,6 +50,18 @@ void twr_tag_voc_lp_set_update_interval(twr_tag_voc_lp_t *self, twr_tick_t inter
 
 bool twr_tag_voc_lp_measure(twr_tag_voc_lp_t *self);
 
+//! @brief Set power mode, ultra-low power mode (sampling every 30 s) is default
+//! @param[in] self Instance
+//! @param[in] mode Power mode
+
+void twr_tag_voc_lp_set_power_mode(twr_tag_voc_lp_t *self, twr_sgpc3_power_mode_t mode);
+
+//! @brief Set key of baseline stored by twr_kv (twr_kv has to be initialized), stored baseline is restored
+//! @param[in] self Instance
+//! @param[in] key Key
+
+void twr_tag_voc_lp_set_baseline_key(twr_tag_voc_lp_t *self, uint16_t key);
+
 //! @brief Get measured TVOC in ppb (parts per billion)
 //! @param[in] self Instance
 //! @param[out] ppb Pointer to variable where result will be stored
@@ -65,6 +78,12 @@ bool twr_tag_voc_lp_get_tvoc_ppb(twr_tag_voc_lp_t *self, uint16_t *ppb);
 
 float twr_tag_voc_lp_set_compensation(twr_tag_voc_lp_t *self, float *t_celsius, float *rh_percentage);
 
+//! @brief Set humidity tag whose last measured values compensate every measurement
+//! @param[in] self Instance
+//! @param[in] tag_humidity Humidity tag instance, e.g. HTS221 or SHT30 on the same bus (can be NULL)
+
+void twr_tag_voc_lp_set_humidity_tag(twr_tag_voc_lp_t *self, twr_tag_humidity_t *tag_humidity);
+
 //! @}
 
 #endif // _TWR_TAG_VOC_LP_H
@@ -3,6 +3,7 @@
 
 #include <twr_i2c.h>
 #include <twr_tick.h>
+#include <twr_scheduler.h>
 
 #define TWR_TCA9534A_PIN_STATE_LOW   0
 #define TWR_TCA9534A_PIN_STATE_HIGH  1
@@ -35,6 +36,12 @@ typedef enum
 
 } twr_tca9534a_pin_direction_t;
 
+//! @brief Maximum number of instances with deferred writes pending at once
+
+#ifndef TWR_TCA9534A_DEFERRED_MAX
+#define TWR_TCA9534A_DEFERRED_MAX 4
+#endif
+
 //! @brief Pin state
 
 //! @brief TCA9534A instance
@@ -45,6 +52,8 @@ typedef struct
     uint8_t _i2c_address;
     uint8_t _direction;
     uint8_t _output_port;
+    bool _output_dirty;
+    bool _output_pending;
 
 } twr_tca9534a_t;
 
@@ -63,7 +72,7 @@ bool twr_tca9534a_init(twr_tca9534a_t *self, twr_i2c_channel_t i2c_channel, uint
 
 bool twr_tca9534a_read_port(twr_tca9534a_t *self, uint8_t *state);
 
-//! @brief Write state to all pins
+//! @brief Write state to all pins, state equal to the one written before is not written again
 //! @param[in] self Instance
 //! @param[in] state Desired state of all pins
 //! @return true On success
@@ -71,6 +80,22 @@ bool twr_tca9534a_read_port(twr_tca9534a_t *self, uint8_t *state);
 
 bool twr_tca9534a_write_port(twr_tca9534a_t *self, uint8_t state);
 
+//! @brief Write state to pins selected by mask in one transaction
+//! @param[in] self Instance
+//! @param[in] mask Mask of pins to be written
+//! @param[in] state Desired state of pins selected by mask
+//! @return true On success
+//! @return false On failure
+
+bool twr_tca9534a_write_port_masked(twr_tca9534a_t *self, uint8_t mask, uint8_t state);
+
+//! @brief Flush output shadow to expander if there are deferred writes or the last write failed
+//! @param[in] self Instance
+//! @return true On success
+//! @return false On failure
+
+bool twr_tca9534a_flush(twr_tca9534a_t *self);
+
 //! @brief Read pin state
 //! @param[in] self Instance
 //! @param[in] pin Pin name
@@ -89,6 +114,16 @@ bool twr_tca9534a_read_pin(twr_tca9534a_t *self, twr_tca9534a_pin_t pin, int *st
 
 bool twr_tca9534a_write_pin(twr_tca9534a_t *self, twr_tca9534a_pin_t pin, int state);
 
+//! @brief Write pin state deferred, changes of pins within one scheduler pass are flushed by single write
+//!
+//! Output shadow is updated at once and flushed by scheduler task. Any immediate write flushes deferred changes as
+//! well. Failure of flush is reported only by @ref twr_tca9534a_flush, the next write retries it.
+//! @param[in] self Instance
+//! @param[in] pin Pin name
+//! @param[in] state Desired state of pin
+
+void twr_tca9534a_write_pin_deferred(twr_tca9534a_t *self, twr_tca9534a_pin_t pin, int state);
+
 //! @brief Get direction of all pins
 //! @param[in] self Instance
 //! @param[out] direction Pointer to variable where direction of all pins will be stored
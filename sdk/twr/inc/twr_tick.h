@@ -20,11 +20,22 @@ typedef uint64_t twr_tick_t;
 
 twr_tick_t twr_tick_get(void);
 
-//! @brief Delay execution for specified amount of ticks
+//! @brief Get lower 32 bits of absolute timestamp, cheaper for measuring short intervals
+//! @return Timestamp in milliseconds, wraps around after about 49.7 days (compute differences in uint32_t)
+
+uint32_t twr_tick_get_32(void);
+
+//! @brief Delay execution for specified amount of ticks, core sleeps between ticks
+//!
+//! Other tasks do not run meanwhile, task which can give way should return and plan itself by
+//! twr_scheduler_plan_current_from_now instead. Interrupts have to be enabled.
 //! @param[in] delay Number of ticks to wait
 
 void twr_tick_wait(twr_tick_t delay);
 
+//! @brief Advance timestamp, must not be preempted by code reading timestamp (call from interrupt or with interrupts disabled)
+//! @param[in] delta Number of ticks to add
+
 void twr_tick_increment_irq(twr_tick_t delta);
 
 //! @}
@@ -8,7 +8,13 @@
 //! @brief Driver for timer
 //! @{
 
-extern const uint16_t _twr_timer_prescaler_lut[3];
+//! @brief Minimum delay of @ref twr_timer_delay (in microseconds) for which core sleeps instead of spinning
+
+#ifndef TWR_TIMER_DELAY_SLEEP_US
+#define TWR_TIMER_DELAY_SLEEP_US 50
+#endif
+
+extern const uint16_t _twr_timer_prescaler_lut[4];
 
 //! @brief Initialize timer
 
@@ -23,8 +29,8 @@ void twr_timer_start(void);
 
 uint16_t twr_timer_get_microseconds(void);
 
-//! @brief Relative delay
-//! @param[in] tick tick to delay in us
+//! @brief Relative delay, longer delays sleep until compare interrupt of the timer instead of spinning
+//! @param[in] microseconds Time to delay in us
 
 void twr_timer_delay(uint16_t microseconds);
 
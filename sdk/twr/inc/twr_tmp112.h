@@ -2,7 +2,8 @@
 #define _TWR_TMP112_H
 
 #include <twr_i2c.h>
-#include <twr_scheduler.h>
+#include <twr_exti.h>
+#include <twr_sensor.h>
 
 //! @addtogroup twr_tmp112 twr_tmp112
 //! @brief Driver for TMP112 temperature sensor
@@ -20,36 +21,46 @@ typedef enum
 
 } twr_tmp112_event_t;
 
+//! @brief Conversion mode
+
+typedef enum
+{
+    //! @brief One-shot conversion on every measurement, sensor is shut down in between (default)
+    TWR_TMP112_CONVERSION_ONE_SHOT = 0,
+
+    //! @brief Continuous conversion at 0.25 Hz
+    TWR_TMP112_CONVERSION_0_25_HZ = 1,
+
+    //! @brief Continuous conversion at 1 Hz
+    TWR_TMP112_CONVERSION_1_HZ = 2,
+
+    //! @brief Continuous conversion at 4 Hz
+    TWR_TMP112_CONVERSION_4_HZ = 3,
+
+    //! @brief Continuous conversion at 8 Hz
+    TWR_TMP112_CONVERSION_8_HZ = 4
+
+} twr_tmp112_conversion_t;
+
 //! @brief TMP112 instance
 
 typedef struct twr_tmp112_t twr_tmp112_t;
 
 //! @cond
 
-typedef enum
-{
-    TWR_TMP112_STATE_ERROR = -1,
-    TWR_TMP112_STATE_INITIALIZE = 0,
-    TWR_TMP112_STATE_MEASURE = 1,
-    TWR_TMP112_STATE_READ = 2,
-    TWR_TMP112_STATE_UPDATE = 3
-
-} twr_tmp112_state_t;
-
 struct twr_tmp112_t
 {
     twr_i2c_channel_t _i2c_channel;
     uint8_t _i2c_address;
-    twr_scheduler_task_id_t _task_id_interval;
-    twr_scheduler_task_id_t _task_id_measure;
+    twr_sensor_t _sensor;
     void (*_event_handler)(twr_tmp112_t *, twr_tmp112_event_t, void *);
     void *_event_param;
-    bool _measurement_active;
-    twr_tick_t _update_interval;
-    twr_tmp112_state_t _state;
-    twr_tick_t _tick_ready;
     bool _temperature_valid;
     uint16_t _reg_temperature;
+    twr_tmp112_conversion_t _conversion;
+    bool _alert_active;
+    twr_exti_line_t _alert_line;
+    int16_t _alert_delta;
 };
 
 //! @endcond
@@ -80,6 +91,34 @@ void twr_tmp112_set_event_handler(twr_tmp112_t *self, void (*event_handler)(twr_
 
 void twr_tmp112_set_update_interval(twr_tmp112_t *self, twr_tick_t interval);
 
+//! @brief Set conversion mode
+//!
+//! In continuous mode the sensor keeps converting on its own and measurement only reads the last result.
+//! @param[in] self Instance
+//! @param[in] conversion Conversion mode
+
+void twr_tmp112_set_conversion(twr_tmp112_t *self, twr_tmp112_conversion_t conversion);
+
+//! @brief Enable wake-up by ALERT output when temperature leaves the band around the last measured value
+//!
+//! Sensor is switched to continuous conversion (0.25 Hz unless other rate has been set) and ALERT in interrupt mode.
+//! Every measurement, including the one triggered by ALERT, moves the thresholds around its result. TMP112 alternates
+//! between the high and the low threshold in interrupt mode, so after a rise it watches the fall and vice versa,
+//! keep a long update interval as a heartbeat when monotonic drift must be tracked too.
+//! ALERT is open drain and active low, the line has to be configured as input with pull-up.
+//! @param[in] self Instance
+//! @param[in] line EXTI line connected to ALERT output
+//! @param[in] delta Half width of the band in degrees of Celsius
+//! @return true On success
+//! @return false When delta is not positive
+
+bool twr_tmp112_set_alert(twr_tmp112_t *self, twr_exti_line_t line, float delta);
+
+//! @brief Disable wake-up by ALERT output
+//! @param[in] self Instance
+
+void twr_tmp112_clear_alert(twr_tmp112_t *self);
+
 //! @brief Start measurement manually
 //! @param[in] self Instance
 //! @return true On success
@@ -0,0 +1,190 @@
+#ifndef _TWR_TRACE_H
+#define _TWR_TRACE_H
+
+#include <twr_common.h>
+#include <twr_transport.h>
+
+//! @addtogroup twr_trace twr_trace
+//! @brief Binary trace of scheduler tasks, interrupts, sleep and driver states in RAM ring
+//!
+//! Records are timestamped in microseconds by SysTick, time spent in stop mode is added from tick on wake up.
+//! When ring is full the oldest records are overwritten. Ring can be streamed over transport (UART, USB CDC) in
+//! packets (multi-byte values little endian):
+//!
+//! | 0x5a | count (1 B) | records (count * 8 B) | CRC-16/CCITT-FALSE of count and records (2 B) |
+//!
+//! Record consists of timestamp (4 B), event (1 B), ID (1 B) and argument (2 B). Host tool
+//! sdk/tools/twr_trace_decode.py converts stream to timeline in Trace Event Format (chrome://tracing, Perfetto).
+//! Hooks compile to nothing without @ref TWR_TRACE.
+//! @{
+
+//! @brief Record trace
+
+#ifndef TWR_TRACE
+#define TWR_TRACE 0
+#endif
+
+//! @brief Number of records in ring (power of 2)
+
+#ifndef TWR_TRACE_SIZE
+#define TWR_TRACE_SIZE 256
+#endif
+
+//! @brief Maximum number of records in one packet of stream
+
+#ifndef TWR_TRACE_STREAM_RECORDS
+#define TWR_TRACE_STREAM_RECORDS 16
+#endif
+
+//! @brief Interval between packets of stream
+
+#ifndef TWR_TRACE_STREAM_INTERVAL_MS
+#define TWR_TRACE_STREAM_INTERVAL_MS 100
+#endif
+
+//! @brief Trace event
+
+typedef enum
+{
+    //! @brief Scheduler task started (ID is task ID)
+    TWR_TRACE_EVENT_TASK_START = 0,
+
+    //! @brief Scheduler task finished (ID is task ID)
+    TWR_TRACE_EVENT_TASK_END = 1,
+
+    //! @brief Interrupt handler entered (ID is IRQ number)
+    TWR_TRACE_EVENT_ISR_ENTER = 2,
+
+    //! @brief Interrupt handler left (ID is IRQ number)
+    TWR_TRACE_EVENT_ISR_EXIT = 3,
+
+    //! @brief Driver state (ID is driver, argument is state)
+    TWR_TRACE_EVENT_STATE = 4,
+
+    //! @brief Core entered sleep (ID is 1 for stop mode)
+    TWR_TRACE_EVENT_SLEEP = 5,
+
+    //! @brief Core woke up
+    TWR_TRACE_EVENT_WAKE = 6,
+
+    //! @brief Records overwritten before streamed (argument is count, saturated)
+    TWR_TRACE_EVENT_LOST = 7,
+
+    //! @brief Application event (ID and argument are defined by application)
+    TWR_TRACE_EVENT_USER = 8
+
+} twr_trace_event_t;
+
+//! @brief Driver of state records
+
+typedef enum
+{
+    //! @brief Driver twr_lis2dh12
+    TWR_TRACE_DRIVER_LIS2DH12 = 0,
+
+    //! @brief Driver twr_spirit1
+    TWR_TRACE_DRIVER_SPIRIT1 = 1,
+
+    //! @brief Driver twr_cmwx1zzabz
+    TWR_TRACE_DRIVER_CMWX1ZZABZ = 2
+
+} twr_trace_driver_t;
+
+//! @brief Trace record
+
+typedef struct
+{
+    //! @brief Timestamp in microseconds
+    uint32_t timestamp;
+
+    //! @brief Event
+    uint8_t event;
+
+    //! @brief ID of task, IRQ or driver
+    uint8_t id;
+
+    //! @brief Argument
+    uint16_t arg;
+
+} twr_trace_record_t;
+
+#if TWR_TRACE
+
+//! @brief Record start of scheduler task
+//! @param[in] task_id Task ID
+
+#define twr_trace_task_start(task_id) twr_trace_record(TWR_TRACE_EVENT_TASK_START, (task_id), 0)
+
+//! @brief Record end of scheduler task
+//! @param[in] task_id Task ID
+
+#define twr_trace_task_end(task_id) twr_trace_record(TWR_TRACE_EVENT_TASK_END, (task_id), 0)
+
+//! @brief Record entry of interrupt handler
+//! @param[in] irqn IRQ number
+
+#define twr_trace_isr_enter(irqn) twr_trace_record(TWR_TRACE_EVENT_ISR_ENTER, (irqn), 0)
+
+//! @brief Record exit of interrupt handler
+//! @param[in] irqn IRQ number
+
+#define twr_trace_isr_exit(irqn) twr_trace_record(TWR_TRACE_EVENT_ISR_EXIT, (irqn), 0)
+
+//! @brief Record state of driver
+//! @param[in] driver Driver
+//! @param[in] state State
+
+#define twr_trace_state(driver, state) twr_trace_record(TWR_TRACE_EVENT_STATE, (driver), (state))
+
+//! @brief Record application event
+//! @param[in] id ID
+//! @param[in] arg Argument
+
+#define twr_trace_user(id, arg) twr_trace_record(TWR_TRACE_EVENT_USER, (id), (arg))
+
+//! @brief Add record to ring (callable from interrupt)
+//! @param[in] event Event
+//! @param[in] id ID of task, IRQ or driver
+//! @param[in] arg Argument
+
+void twr_trace_record(twr_trace_event_t event, uint8_t id, uint16_t arg);
+
+//! @brief Start streaming of ring over transport
+//! @param[in] transport Pointer to initialized transport, NULL to stop streaming
+
+void twr_trace_set_transport(twr_transport_t *transport);
+
+//! @brief Read records from ring, the oldest first (records are removed)
+//! @param[out] records Pointer to destination array
+//! @param[in] count Size of destination array in records
+//! @return Number of records read
+
+size_t twr_trace_read(twr_trace_record_t *records, size_t count);
+
+//! @brief Get number of records overwritten before they were read since initialization
+//! @return Number of records
+
+uint32_t twr_trace_get_lost(void);
+
+//! @brief Record entering sleep (called by twr_system_sleep)
+
+void twr_trace_sleep_enter(void);
+
+//! @brief Record wake up and add time spent in stop mode to timestamps (called by twr_system_sleep)
+
+void twr_trace_sleep_exit(void);
+
+#else
+
+#define twr_trace_task_start(task_id) do { } while (0)
+#define twr_trace_task_end(task_id) do { } while (0)
+#define twr_trace_isr_enter(irqn) do { } while (0)
+#define twr_trace_isr_exit(irqn) do { } while (0)
+#define twr_trace_state(driver, state) do { } while (0)
+#define twr_trace_user(id, arg) do { } while (0)
+
+#endif
+
+//! @}
+
+#endif // _TWR_TRACE_H
@@ -0,0 +1,107 @@
+#ifndef _TWR_TRANSPORT_H
+#define _TWR_TRANSPORT_H
+
+#include <twr_common.h>
+
+//! @addtogroup twr_transport twr_transport
+//! @brief Byte stream sink with the same interface for UART, USB CDC, radio or several of them at once
+//!
+//! Drivers are provided by @ref twr_uart_get_transport_driver, @ref twr_usb_cdc_get_transport_driver and
+//! @ref twr_radio_get_transport_driver. Fan-out transport writes to every member which is ready.
+//! @{
+
+//! @brief Maximum number of members of fan-out transport
+
+#ifndef TWR_TRANSPORT_FANOUT_MAX
+#define TWR_TRANSPORT_FANOUT_MAX 3
+#endif
+
+//! @brief Segment of data for vectored write
+
+typedef struct
+{
+    //! @brief Pointer to segment data
+    const void *buffer;
+
+    //! @brief Number of bytes in segment
+    size_t length;
+
+} twr_transport_segment_t;
+
+//! @brief Transport instance
+
+typedef struct twr_transport_t twr_transport_t;
+
+//! @brief Transport driver interface
+
+typedef struct
+{
+    //! @brief Callback for writing segments as one unit, returns number of bytes written
+    size_t (*writev)(twr_transport_t *self, const twr_transport_segment_t *segments, size_t count);
+
+    //! @brief Optional callback for starting transmission of buffered data
+    bool (*flush)(twr_transport_t *self);
+
+    //! @brief Optional callback for checking whether data can be delivered
+    bool (*ready)(twr_transport_t *self);
+
+} twr_transport_driver_t;
+
+//! @cond
+
+struct twr_transport_t
+{
+    const twr_transport_driver_t *_driver;
+    int _channel;
+    twr_transport_t *_member[TWR_TRANSPORT_FANOUT_MAX];
+    size_t _member_count;
+};
+
+//! @endcond
+
+//! @brief Initialize transport
+//! @param[in] self Instance
+//! @param[in] driver Transport driver
+//! @param[in] channel Channel of driver, e.g. UART channel
+
+void twr_transport_init(twr_transport_t *self, const twr_transport_driver_t *driver, int channel);
+
+//! @brief Initialize fan-out transport
+//! @param[in] self Instance
+//! @param[in] member Array of initialized transports
+//! @param[in] count Number of transports (up to TWR_TRANSPORT_FANOUT_MAX)
+
+void twr_transport_init_fanout(twr_transport_t *self, twr_transport_t **member, size_t count);
+
+//! @brief Write buffer
+//! @param[in] self Instance
+//! @param[in] buffer Pointer to source buffer
+//! @param[in] length Number of bytes to be written
+//! @return Number of bytes written
+
+size_t twr_transport_write(twr_transport_t *self, const void *buffer, size_t length);
+
+//! @brief Write segments as one unit, fan-out returns the largest number of bytes written by its members
+//! @param[in] self Instance
+//! @param[in] segments Array of segments
+//! @param[in] count Number of segments
+//! @return Number of bytes written
+
+size_t twr_transport_writev(twr_transport_t *self, const twr_transport_segment_t *segments, size_t count);
+
+//! @brief Start transmission of buffered data
+//! @param[in] self Instance
+//! @return true On success
+//! @return false On failure
+
+bool twr_transport_flush(twr_transport_t *self);
+
+//! @brief Check whether data can be delivered, fan-out is ready when any of its members is
+//! @param[in] self Instance
+//! @return true When ready
+
+bool twr_transport_is_ready(twr_transport_t *self);
+
+//! @}
+
+#endif // _TWR_TRANSPORT_H
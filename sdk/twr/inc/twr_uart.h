@@ -3,6 +3,7 @@
 
 #include <twr_tick.h>
 #include <twr_fifo.h>
+#include <twr_transport.h>
 
 //! @addtogroup twr_uart twr_uart
 //! @brief Driver for UART (universal asynchronous receiver/transmitter)
@@ -43,10 +44,28 @@ typedef enum
     TWR_UART_BAUDRATE_115200 = 4,
 
     //! @brief UART baudrat 921600 bps
-    TWR_UART_BAUDRATE_921600 = 5
+    TWR_UART_BAUDRATE_921600 = 5,
+
+    //! @brief UART baudrat 230400 bps
+    TWR_UART_BAUDRATE_230400 = 6,
+
+    //! @brief UART baudrat 460800 bps
+    TWR_UART_BAUDRATE_460800 = 7
 
 } twr_uart_baudrate_t;
 
+//! @brief Highest baudrate at which UART1 runs on low-power LPUART1 clocked from HSI16 instead of USART2 clocked from PLL
+
+#ifndef TWR_UART_LPUART1_MAX_BAUDRATE
+#define TWR_UART_LPUART1_MAX_BAUDRATE 9600
+#endif
+
+//! @brief Maximum accepted baudrate error in per mille
+
+#ifndef TWR_UART_BAUDRATE_TOLERANCE
+#define TWR_UART_BAUDRATE_TOLERANCE 20
+#endif
+
 //! @brief UART setting
 
 //! @cond
@@ -62,6 +81,8 @@ typedef enum
 #define _TWR_UART_SETTING_STOP_BIT_2   0x02
 #define _TWR_UART_SETTING_STOP_BIT_15  0x03
 
+#define _TWR_UART_SETTING_FLOW_CONTROL 0x01 << 8
+
 //! @endcond
 
 typedef enum
@@ -118,7 +139,13 @@ typedef enum
     TWR_UART_SETTING_7E1_5 = _TWR_UART_SETTING_DATA_BITS_7 | _TWR_UART_SETTING_PARITY_EVEN | _TWR_UART_SETTING_STOP_BIT_15,
 
     //! @brief 7O1_5: 7 data bits, odd parity bit, 1.5 stop bit
-    TWR_UART_SETTING_7O1_5 = _TWR_UART_SETTING_DATA_BITS_7 | _TWR_UART_SETTING_PARITY_NONE | _TWR_UART_SETTING_STOP_BIT_15
+    TWR_UART_SETTING_7O1_5 = _TWR_UART_SETTING_DATA_BITS_7 | _TWR_UART_SETTING_PARITY_NONE | _TWR_UART_SETTING_STOP_BIT_15,
+
+    //! @brief Flag enabling hardware RTS/CTS flow control, to be combined with one of the settings above
+    //!
+    //! Available on TWR_UART_UART1 only, CTS is on TWR_GPIO_P0 and RTS on TWR_GPIO_P1 (TWR_GPIO_P7 and TWR_GPIO_P6
+    //! when LPUART1 is used), so it can not be used together with TWR_UART_UART0.
+    TWR_UART_SETTING_FLOW_CONTROL = _TWR_UART_SETTING_FLOW_CONTROL
 
 } twr_uart_setting_t;
 
@@ -133,16 +160,36 @@ typedef enum
     TWR_UART_EVENT_ASYNC_READ_DATA = 1,
 
     //! @brief Event is timeout
-    TWR_UART_EVENT_ASYNC_READ_TIMEOUT = 2
+    TWR_UART_EVENT_ASYNC_READ_TIMEOUT = 2,
+
+    //! @brief Event is overrun of read FIFO, the oldest unread data have been lost (DMA reception only)
+    TWR_UART_EVENT_ASYNC_READ_OVERRUN = 3
 
 } twr_uart_event_t;
 
+//! @brief Segment of data for vectored write
+
+typedef twr_transport_segment_t twr_uart_segment_t;
+
 //! @brief Initialize UART channel
 //! @param[in] channel UART channel
-//! @param[in] config UART configuration
+//! @param[in] baudrate UART baudrate
+//! @param[in] setting UART setting
 
 void twr_uart_init(twr_uart_channel_t channel, twr_uart_baudrate_t baudrate, twr_uart_setting_t setting);
 
+//! @brief Initialize UART channel with arbitrary baudrate
+//!
+//! Baud rate register is computed from the peripheral clock (PLL 32 MHz, or HSI16 for LPUART1), oversampling by 8 is
+//! used when oversampling by 16 either can not reach the baudrate or misses it by more than TWR_UART_BAUDRATE_TOLERANCE.
+//! @param[in] channel UART channel
+//! @param[in] baudrate UART baudrate in bps
+//! @param[in] setting UART setting
+//! @return true On success
+//! @return false When baudrate can not be set within tolerance or flow control is not available on channel
+
+bool twr_uart_init_baudrate(twr_uart_channel_t channel, uint32_t baudrate, twr_uart_setting_t setting);
+
 //! @brief Deinitialize UART channel
 //! @param[in] channel UART channel
 
@@ -156,6 +203,33 @@ void twr_uart_deinit(twr_uart_channel_t channel);
 
 size_t twr_uart_write(twr_uart_channel_t channel, const void *buffer, size_t length);
 
+//! @brief Write segments of data to UART channel as one transmission (blocking call)
+//! @param[in] channel UART channel
+//! @param[in] segments Array of segments
+//! @param[in] count Number of segments
+//! @return Number of bytes written
+
+size_t twr_uart_writev(twr_uart_channel_t channel, const twr_uart_segment_t *segments, size_t count);
+
+//! @brief Set clock linger time
+//!
+//! After a write the peripheral clock (PLL, or HSI16 for LPUART1) is kept running for the linger time, so writes
+//! following each other shortly do not pay the clock start up again. Zero (default) releases the clock immediately.
+//! @param[in] channel UART channel
+//! @param[in] linger Linger time in ticks
+
+void twr_uart_set_clock_linger(twr_uart_channel_t channel, twr_tick_t linger);
+
+//! @brief Begin batch of writes, peripheral clock is kept running until twr_uart_write_end
+//! @param[in] channel UART channel
+
+void twr_uart_write_begin(twr_uart_channel_t channel);
+
+//! @brief End batch of writes started by twr_uart_write_begin
+//! @param[in] channel UART channel
+
+void twr_uart_write_end(twr_uart_channel_t channel);
+
 //! @brief Read data from UART channel (blocking call)
 //! @param[in] channel UART channel
 //! @param[in] buffer Pointer to destination buffer
@@ -179,6 +253,16 @@ void twr_uart_set_event_handler(twr_uart_channel_t channel, void (*event_handler
 
 void twr_uart_set_async_fifo(twr_uart_channel_t channel, twr_fifo_t *write_fifo, twr_fifo_t *read_fifo);
 
+//! @brief Enable or disable DMA for async transmission
+//!
+//! Data added by @ref twr_uart_async_write are moved from the write FIFO to the transmitter by DMA, the core only
+//! wakes up once per contiguous block and may sleep meanwhile. UART0 and UART1 share DMA channel 7 (only one of them
+//! transmits by DMA at a time, the other falls back to interrupts), UART2 uses DMA channel 4 shared with DAC channel 2.
+//! @param[in] channel UART channel
+//! @param[in] enable Enable DMA for async transmission
+
+void twr_uart_set_async_write_dma(twr_uart_channel_t channel, bool enable);
+
 //! @brief Add data to be transmited in async mode
 //! @param[in] channel UART channel
 //! @param[in] buffer Pointer to buffer
@@ -188,6 +272,12 @@ void twr_uart_set_async_fifo(twr_uart_channel_t channel, twr_fifo_t *write_fifo,
 size_t twr_uart_async_write(twr_uart_channel_t channel, const void *buffer, size_t length);
 
 //! @brief Start async reading
+//!
+//! Received data land in the read FIFO by circular DMA and @ref TWR_UART_EVENT_ASYNC_READ_DATA is raised once per burst
+//! (on idle line) or per half of the FIFO. When data are not read before DMA wraps over them,
+//! @ref TWR_UART_EVENT_ASYNC_READ_OVERRUN is raised and the FIFO keeps the newest received bytes. UART2 uses DMA
+//! channel 3, UART0 and UART1 share DMA channel 6 (the one started later falls back to interrupts), UART1 at 9600 baud
+//! or lower always receives by interrupts to be able to wake up from stop mode.
 //! @param[in] channel UART channel
 //! @param[in] timeout Maximum timeout in ms
 //! @return true On success
@@ -210,6 +300,13 @@ bool twr_uart_async_read_cancel(twr_uart_channel_t channel);
 
 size_t twr_uart_async_read(twr_uart_channel_t channel, void *buffer, size_t length);
 
+//! @brief Get transport driver, channel of transport is UART channel (has to be initialized by caller)
+//!
+//! Writes are blocking, transport is ready when channel is initialized and no async write is in progress.
+//! @return Transport driver
+
+const twr_transport_driver_t *twr_uart_get_transport_driver(void);
+
 //! @}
 
 #endif // _TWR_UART_H
@@ -2,6 +2,7 @@
 #define _TWR_USB_CDC_H
 
 #include <twr_common.h>
+#include <twr_transport.h>
 
 //! @addtogroup twr_usb_cdc twr_usb_cdc
 //! @brief USB CDC communication library
@@ -26,6 +27,13 @@ bool twr_usb_cdc_write(const void *buffer, size_t length);
 
 size_t twr_usb_cdc_read(void *buffer, size_t length);
 
+//! @brief Get transport driver, segments are written only when all of them fit into transmit buffer
+//!
+//! Transport is ready when device is configured by host.
+//! @return Transport driver
+
+const twr_transport_driver_t *twr_usb_cdc_get_transport_driver(void);
+
 //! @}
 
 #endif // _TWR_USB_CDC_H
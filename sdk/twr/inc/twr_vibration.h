@@ -0,0 +1,105 @@
+#ifndef _TWR_VIBRATION_H
+#define _TWR_VIBRATION_H
+
+#include <twr_lis2dh12.h>
+
+//! @addtogroup twr_vibration twr_vibration
+//! @brief Integer vibration feature extraction from blocks of accelerometer samples
+//!
+//! Samples (e.g. FIFO blocks of @ref twr_lis2dh12) are collected into blocks of TWR_VIBRATION_BLOCK_SIZE samples.
+//! For every block, static component is removed from each axis and RMS and peak-to-peak value are computed. Axis with
+//! the highest RMS is dominant, its zero crossings are counted and dominant frequency with its amplitude is found by
+//! fixed-point radix-2 FFT (Q15, scaled by half in every stage so that it does not overflow). Everything is computed in
+//! integers, features are in raw units of samples.
+//! @{
+
+//! @brief Number of samples in block, power of two from 8 to 256
+
+#ifndef TWR_VIBRATION_BLOCK_SIZE
+#define TWR_VIBRATION_BLOCK_SIZE 64
+#endif
+
+//! @brief Callback events
+
+typedef enum
+{
+    //! @brief Features of block are computed
+    TWR_VIBRATION_EVENT_UPDATE = 0
+
+} twr_vibration_event_t;
+
+//! @brief Features of block
+
+typedef struct
+{
+    //! @brief RMS of each axis without static component
+    uint16_t rms[3];
+
+    //! @brief Peak-to-peak value of each axis
+    uint16_t peak_to_peak[3];
+
+    //! @brief Dominant axis (0 = X, 1 = Y, 2 = Z)
+    uint8_t axis;
+
+    //! @brief Number of zero crossings of dominant axis in block
+    uint16_t zero_crossings;
+
+    //! @brief Dominant frequency of dominant axis in tenths of Hz
+    uint16_t frequency;
+
+    //! @brief Amplitude of dominant frequency
+    uint16_t amplitude;
+
+} twr_vibration_features_t;
+
+//! @brief Instance
+
+typedef struct twr_vibration_t twr_vibration_t;
+
+//! @cond
+
+struct twr_vibration_t
+{
+    uint16_t _sample_rate;
+    int16_t _buffer[3][TWR_VIBRATION_BLOCK_SIZE];
+    int16_t _imaginary[TWR_VIBRATION_BLOCK_SIZE];
+    size_t _count;
+    bool _valid;
+    twr_vibration_features_t _features;
+    void (*_event_handler)(twr_vibration_t *, twr_vibration_event_t, void *);
+    void *_event_param;
+};
+
+//! @endcond
+
+//! @brief Initialize instance
+//! @param[in] self Instance
+//! @param[in] sample_rate Sample rate in Hz
+
+void twr_vibration_init(twr_vibration_t *self, uint16_t sample_rate);
+
+//! @brief Set callback function
+//! @param[in] self Instance
+//! @param[in] event_handler Function address
+//! @param[in] event_param Optional event parameter (can be NULL)
+
+void twr_vibration_set_event_handler(twr_vibration_t *self, void (*event_handler)(twr_vibration_t *, twr_vibration_event_t, void *), void *event_param);
+
+//! @brief Feed samples, features are computed and update event is raised whenever block is complete
+//! @param[in] self Instance
+//! @param[in] samples Raw samples (see twr_lis2dh12_get_fifo_result_raw)
+//! @param[in] count Number of samples
+
+void twr_vibration_feed_raw(twr_vibration_t *self, const twr_lis2dh12_result_raw_t *samples, size_t count);
+
+//! @brief Get features of the last complete block
+//! @param[in] self Instance
+//! @param[out] features Features
+//! @return true When features are available
+//! @return false When no block has been completed yet
+
+bool twr_vibration_get_features(twr_vibration_t *self, twr_vibration_features_t *features);
+
+//! @}
+
+#endif // _TWR_VIBRATION_H
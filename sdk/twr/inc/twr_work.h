@@ -0,0 +1,34 @@
+#ifndef _TWR_WORK_H
+#define _TWR_WORK_H
+
+#include <twr_common.h>
+
+//! @addtogroup twr_work twr_work
+//! @brief Deferred work queue for handing work from interrupts over to scheduler
+//!
+//! Items of function and parameter are queued in order and executed by single static scheduler task, so drivers do
+//! not need task of their own and back-to-back events are not merged.
+//! @{
+
+//! @brief Number of items queue can hold (power of two)
+
+#ifndef TWR_WORK_QUEUE_SIZE
+#define TWR_WORK_QUEUE_SIZE 16
+#endif
+
+//! @brief Post work item, can be called from interrupt
+//! @param[in] function Function to be called from scheduler task
+//! @param[in] param Parameter passed to function
+//! @return true On success
+//! @return false When queue is full (item is dropped and counted)
+
+bool twr_work_post(void (*function)(void *), void *param);
+
+//! @brief Get number of items dropped because queue was full
+//! @return Number of dropped items
+
+uint32_t twr_work_get_dropped(void);
+
+//! @}
+
+#endif // _TWR_WORK_H
@@ -7,6 +7,31 @@
 //! @brief Driver for led strip ws2812b
 //! @{
 
+//! @brief Streaming mode, pixels are kept as bytes and expanded into pulses from DMA interrupt during transfer
+//!
+//! Led strip buffer then takes count * type bytes instead of count * type * 8 bytes, expanded pulses take
+//! constant 2 * 8 * TWR_WS2812B_STREAM_CHUNK bytes.
+
+#ifndef TWR_WS2812B_STREAM
+#define TWR_WS2812B_STREAM 0
+#endif
+
+//! @brief Number of pixel bytes expanded at once in streaming mode, one chunk is sent in 10 us per byte
+
+#ifndef TWR_WS2812B_STREAM_CHUNK
+#define TWR_WS2812B_STREAM_CHUNK 8
+#endif
+
+//! @brief Length of led strip buffer in 32-bit words
+//! @param[in] count Number of pixels
+//! @param[in] type Led strip type (number of bytes per pixel)
+
+#if TWR_WS2812B_STREAM
+#define TWR_WS2812B_BUFFER_LENGTH(count, type) (((count) * (type) + 3) / 4)
+#else
+#define TWR_WS2812B_BUFFER_LENGTH(count, type) ((count) * (type) * 2)
+#endif
+
 //! @cond
 
 typedef enum
@@ -27,6 +52,8 @@ void twr_ws2812b_set_pixel_from_rgb_swap_rg(int position, uint8_t red, uint8_t g
 
 void twr_ws2812b_set_pixel_from_uint32_swap_rg(int position, uint32_t color);
 
+void twr_ws2812b_set_lut(const uint8_t *lut);
+
 bool twr_ws2812b_write(void);
 
 bool twr_ws2812b_is_ready(void);
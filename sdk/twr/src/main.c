@@ -1,3 +1,5 @@
+#define TWR_LOG_MODULE TWR_LOG_MODULE_SYSTEM
+
 #include <twr_scheduler.h>
 #include <twr_system.h>
 #include <twr_error.h>
@@ -94,6 +96,11 @@ __attribute__((weak)) void application_error(twr_error_t code)
                     twr_log_error("TWR_ERROR_INVALID_PARAMETER");
                     break;
                 }
+                case TWR_ERROR_STACK_OVERFLOW:
+                {
+                    twr_log_error("TWR_ERROR_STACK_OVERFLOW");
+                    break;
+                }
                 default:
                 {
                     break;
@@ -3,6 +3,8 @@
 #include <twr_irq.h>
 #include <stm32l083xx.h>
 #include <twr_sleep.h>
+#include <twr_dma.h>
+#include <twr_data_stream.h>
 
 #include <twr_system.h>
 
@@ -11,12 +13,16 @@
 #define TWR_ADC_CHANNEL_INTERNAL_REFERENCE 7
 #define TWR_ADC_CHANNEL_NONE ((twr_adc_channel_t) (-1))
 #define TWR_ADC_CHANNEL_COUNT ((twr_adc_channel_t) 8)
+#define TWR_ADC_STREAM_TIMER_CLOCK 32000000
+#define TWR_ADC_STREAM_SAMPLE_RATE_MIN 16
+#define TWR_ADC_STREAM_SAMPLE_RATE_MAX 1000000
 
 typedef enum
 {
     TWR_ADC_STATE_CALIBRATION_BY_INTERNAL_REFERENCE_BEGIN,
     TWR_ADC_STATE_CALIBRATION_BY_INTERNAL_REFERENCE_END,
-    TWR_ADC_STATE_MEASURE_INPUT
+    TWR_ADC_STATE_MEASURE_INPUT,
+    TWR_ADC_STATE_SCAN
 
 } twr_adc_state_t;
 
@@ -38,14 +44,47 @@ static struct
     twr_adc_channel_t channel_in_progress;
     uint16_t vrefint;
     float real_vdda_voltage;
+    bool vdda_valid;
+    twr_tick_t vdda_tick;
+    float vdda_temperature;
+    float temperature;
     twr_adc_state_t state;
     twr_scheduler_task_id_t task_id;
     twr_adc_channel_config_t channel_table[8];
+    bool dma_allocated;
+    twr_dma_channel_t dma_channel;
+    twr_dma_channel_config_t dma_config;
+
+    struct
+    {
+        void (*event_handler)(twr_adc_event_t, void *);
+        void *event_param;
+        bool pending;
+        bool in_progress;
+        uint8_t channel_mask;
+        uint8_t channel_mask_in_progress;
+        twr_adc_oversampling_t oversampling;
+        uint16_t buffer[8];
+
+    } scan;
+
+    struct
+    {
+        bool active;
+        twr_adc_channel_t channel;
+        uint16_t *buffer;
+        size_t length;
+        void (*block_handler)(const uint16_t *, size_t, void *);
+        void *block_param;
+
+    } stream;
 }
 _twr_adc =
 {
     .initialized = false,
     .channel_in_progress = TWR_ADC_CHANNEL_NONE,
+    .vdda_temperature = NAN,
+    .temperature = NAN,
     .channel_table =
     {
         [TWR_ADC_CHANNEL_A0].chselr = ADC_CHSELR_CHSEL0,
@@ -61,8 +100,27 @@ _twr_adc =
 
 static void _twr_adc_task(void *param);
 
+TWR_SCHEDULER_TASK_STATIC(_twr_adc_task_static, _twr_adc_task, NULL);
+
 static inline bool _twr_adc_get_pending(twr_adc_channel_t *next ,twr_adc_channel_t start);
 
+static void _twr_adc_scan_start(void);
+
+static void _twr_adc_scan_done(void);
+
+static void _twr_adc_start_pending(twr_adc_channel_t start);
+
+static bool _twr_adc_dma_allocate(void);
+
+static void _twr_adc_stream_dma_handler(twr_dma_channel_t channel, twr_dma_event_t event, void *param);
+
+static void _twr_adc_vdda_update(uint16_t vrefint_data);
+
+static inline bool _twr_adc_is_busy(void)
+{
+    return _twr_adc.channel_in_progress != TWR_ADC_CHANNEL_NONE || _twr_adc.scan.in_progress || _twr_adc.stream.active;
+}
+
 void twr_adc_init()
 {
     if (_twr_adc.initialized != true)
@@ -92,7 +150,7 @@ void twr_adc_init()
 
         _twr_adc.initialized = true;
 
-        _twr_adc.task_id = twr_scheduler_register(_twr_adc_task, NULL, TWR_TICK_INFINITY);
+        _twr_adc.task_id = twr_scheduler_get_static_id(&_twr_adc_task_static);
 
         twr_adc_calibration();
     }
@@ -172,13 +230,13 @@ static uint16_t _twr_adc_get_measured_value(twr_adc_channel_t channel)
 
 bool twr_adc_is_ready()
 {
-    return _twr_adc.channel_in_progress == TWR_ADC_CHANNEL_NONE;
+    return !_twr_adc_is_busy();
 }
 
 bool twr_adc_get_value(twr_adc_channel_t channel, uint16_t *result)
 {
     // If ongoing conversion...
-    if (_twr_adc.channel_in_progress != TWR_ADC_CHANNEL_NONE)
+    if (_twr_adc_is_busy())
     {
         return false;
     }
@@ -234,7 +292,7 @@ bool twr_adc_set_event_handler(twr_adc_channel_t channel, void (*event_handler)(
 bool twr_adc_async_measure(twr_adc_channel_t channel)
 {
     // If another conversion is ongoing...
-    if (_twr_adc.channel_in_progress != TWR_ADC_CHANNEL_NONE)
+    if (_twr_adc_is_busy())
     {
         _twr_adc.channel_table[channel].pending = true;
 
@@ -244,6 +302,31 @@ bool twr_adc_async_measure(twr_adc_channel_t channel)
     _twr_adc.channel_in_progress = channel;
     _twr_adc.channel_table[channel].pending = false;
 
+    // Reuse recent VDDA and measure input right away
+    if (_twr_adc.vdda_valid && twr_tick_get() < _twr_adc.vdda_tick + TWR_ADC_VDDA_CACHE_TIME)
+    {
+        _twr_adc.state = TWR_ADC_STATE_MEASURE_INPUT;
+
+        _twr_adc_configure_oversampling(_twr_adc.channel_table[channel].oversampling);
+        _twr_adc_configure_resolution(_twr_adc.channel_table[channel].resolution);
+
+        // Set ADC channel
+        ADC1->CHSELR = _twr_adc.channel_table[channel].chselr;
+
+        // Clear end of conversion interrupt
+        ADC1->ISR = ADC_ISR_EOC;
+
+        // Enable end of conversion interrupt
+        ADC1->IER = ADC_IER_EOCIE;
+
+        // Begin adc input channel measurement
+        ADC1->CR |= ADC_CR_ADSTART;
+
+        twr_sleep_disable(); // enable in _twr_adc_task
+
+        return true;
+    }
+
     // Skip cal and measure VREF + channel
     //------------------------------------
     _twr_adc.state = TWR_ADC_STATE_CALIBRATION_BY_INTERNAL_REFERENCE_END;
@@ -283,6 +366,205 @@ bool twr_adc_async_get_voltage(twr_adc_channel_t channel, float *result)
     return true;
 }
 
+void twr_adc_scan_set_event_handler(void (*event_handler)(twr_adc_event_t, void *), void *event_param)
+{
+    _twr_adc.scan.event_handler = event_handler;
+    _twr_adc.scan.event_param = event_param;
+}
+
+bool twr_adc_scan_measure(uint8_t channel_mask, twr_adc_oversampling_t oversampling)
+{
+    channel_mask &= (1 << TWR_ADC_CHANNEL_INTERNAL_REFERENCE) - 1;
+
+    if (channel_mask == 0)
+    {
+        return false;
+    }
+
+    if (!_twr_adc_dma_allocate())
+    {
+        return false;
+    }
+
+    twr_irq_disable();
+
+    // Requests made while ADC is busy are joined into one sequence
+    if (_twr_adc.scan.pending)
+    {
+        channel_mask |= _twr_adc.scan.channel_mask;
+    }
+
+    _twr_adc.scan.channel_mask = channel_mask;
+    _twr_adc.scan.oversampling = oversampling;
+    _twr_adc.scan.pending = true;
+
+    if (!_twr_adc_is_busy())
+    {
+        _twr_adc_scan_start();
+    }
+
+    twr_irq_enable();
+
+    return true;
+}
+
+bool twr_adc_stream_start(twr_adc_channel_t channel, uint32_t sample_rate, uint16_t *buffer, size_t length, void (*block_handler)(const uint16_t *, size_t, void *), void *block_param)
+{
+    if (length < 2 || (length % 2) != 0 || block_handler == NULL)
+    {
+        return false;
+    }
+
+    if (sample_rate < TWR_ADC_STREAM_SAMPLE_RATE_MIN || sample_rate > TWR_ADC_STREAM_SAMPLE_RATE_MAX)
+    {
+        return false;
+    }
+
+    if (_twr_adc_is_busy())
+    {
+        return false;
+    }
+
+    if (!_twr_adc_dma_allocate())
+    {
+        return false;
+    }
+
+    _twr_adc.stream.active = true;
+    _twr_adc.stream.channel = channel;
+    _twr_adc.stream.buffer = buffer;
+    _twr_adc.stream.length = length;
+    _twr_adc.stream.block_handler = block_handler;
+    _twr_adc.stream.block_param = block_param;
+
+    twr_system_pll_enable();
+
+    twr_sleep_disable(); // enable in twr_adc_stream_stop
+
+    _twr_adc_configure_oversampling(_twr_adc.channel_table[channel].oversampling);
+    _twr_adc_configure_resolution(TWR_ADC_RESOLUTION_12_BIT);
+
+    // Set ADC channel
+    ADC1->CHSELR = _twr_adc.channel_table[channel].chselr;
+
+    _twr_adc.dma_config.mode = TWR_DMA_MODE_CIRCULAR;
+    _twr_adc.dma_config.address_memory = buffer;
+    _twr_adc.dma_config.length = length;
+
+    twr_dma_set_event_handler(_twr_adc.dma_channel, _twr_adc_stream_dma_handler, NULL);
+    twr_dma_channel_config(_twr_adc.dma_channel, &_twr_adc.dma_config);
+    twr_dma_channel_run(_twr_adc.dma_channel);
+
+    // Conversion on rising edge of timer 6 TRGO, DMA requests in circular mode
+    ADC1->CFGR1 &= ~(ADC_CFGR1_EXTEN_Msk | ADC_CFGR1_EXTSEL_Msk);
+    ADC1->CFGR1 |= ADC_CFGR1_EXTEN_0 | ADC_CFGR1_DMACFG | ADC_CFGR1_DMAEN;
+
+    // Clear all interrupts
+    ADC1->ISR = 0xffff;
+
+    // Disable all ADC interrupts
+    ADC1->IER = 0;
+
+    // Wait for triggers
+    ADC1->CR |= ADC_CR_ADSTART;
+
+    // Enable time-base timer clock
+    RCC->APB1ENR |= RCC_APB1ENR_TIM6EN;
+
+    // Errata workaround
+    RCC->APB1ENR;
+
+    // Period is counted by PLL clock with the smallest prescaler which fits it into 16 bit counter
+    uint32_t period = (TWR_ADC_STREAM_TIMER_CLOCK + sample_rate / 2) / sample_rate;
+    uint32_t prescaler = (period - 1) / 0x10000 + 1;
+
+    TIM6->PSC = prescaler - 1;
+
+    TIM6->ARR = (period + prescaler / 2) / prescaler - 1;
+
+    // Enable update event generation
+    TIM6->EGR = TIM_EGR_UG;
+
+    // Set the update event as a trigger output (TRGO)
+    TIM6->CR2 = TIM_CR2_MMS_1;
+
+    // Start timer
+    TIM6->CR1 |= TIM_CR1_CEN;
+
+    return true;
+}
+
+void twr_adc_stream_stop(void)
+{
+    if (!_twr_adc.stream.active)
+    {
+        return;
+    }
+
+    // Stop timer
+    TIM6->CR1 &= ~TIM_CR1_CEN;
+
+    // Disable time-base timer clock
+    RCC->APB1ENR &= ~RCC_APB1ENR_TIM6EN;
+
+    // Stop waiting for triggers
+    if ((ADC1->CR & ADC_CR_ADSTART) != 0)
+    {
+        ADC1->CR |= ADC_CR_ADSTP;
+
+        while ((ADC1->CR & ADC_CR_ADSTP) != 0)
+        {
+            continue;
+        }
+    }
+
+    ADC1->CFGR1 &= ~(ADC_CFGR1_EXTEN_Msk | ADC_CFGR1_DMACFG | ADC_CFGR1_DMAEN);
+
+    twr_dma_channel_stop(_twr_adc.dma_channel);
+
+    twr_dma_set_event_handler(_twr_adc.dma_channel, NULL, NULL);
+
+    _twr_adc.stream.active = false;
+
+    twr_system_pll_disable();
+
+    twr_sleep_enable();
+
+    twr_irq_disable();
+
+    _twr_adc_start_pending(TWR_ADC_CHANNEL_INTERNAL_REFERENCE);
+
+    twr_irq_enable();
+}
+
+void twr_adc_stream_feed_data_stream(const uint16_t *block, size_t count, void *param)
+{
+    twr_data_stream_t *data_stream = (twr_data_stream_t *) param;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (twr_data_stream_get_type(data_stream) == TWR_DATA_STREAM_TYPE_FLOAT)
+        {
+            float voltage = (block[i] * _twr_adc.real_vdda_voltage) / 4096.f;
+
+            twr_data_stream_feed(data_stream, &voltage);
+        }
+        else if (twr_data_stream_get_type(data_stream) == TWR_DATA_STREAM_TYPE_INT)
+        {
+            int value = block[i];
+
+            twr_data_stream_feed(data_stream, &value);
+        }
+        else
+        {
+            // 12 bit sample always fits in int16_t
+            int16_t value = block[i];
+
+            twr_data_stream_feed(data_stream, &value);
+        }
+    }
+}
+
 bool twr_adc_get_vdda_voltage(float *vdda_voltage)
 {
     if (_twr_adc.real_vdda_voltage == 0.f)
@@ -297,13 +579,37 @@ bool twr_adc_get_vdda_voltage(float *vdda_voltage)
     }
 }
 
+void twr_adc_vdda_invalidate(void)
+{
+    _twr_adc.vdda_valid = false;
+}
+
+void twr_adc_vdda_set_temperature(float temperature)
+{
+    if (isnan(temperature))
+    {
+        return;
+    }
+
+    _twr_adc.temperature = temperature;
+
+    if (isnan(_twr_adc.vdda_temperature))
+    {
+        _twr_adc.vdda_temperature = temperature;
+    }
+    else if (fabsf(temperature - _twr_adc.vdda_temperature) > TWR_ADC_VDDA_CACHE_TEMPERATURE)
+    {
+        _twr_adc.vdda_valid = false;
+    }
+}
+
 void ADC1_COMP_IRQHandler(void)
 {
     // Get real VDDA and begin analog channel measurement
     if (_twr_adc.state == TWR_ADC_STATE_CALIBRATION_BY_INTERNAL_REFERENCE_END)
     {
         // Compute actual VDDA
-        _twr_adc.real_vdda_voltage = 3.f * ((float) _twr_adc.vrefint / (float) ADC1->DR);
+        _twr_adc_vdda_update(ADC1->DR);
 
         _twr_adc_configure_oversampling(_twr_adc.channel_table[_twr_adc.channel_in_progress].oversampling);
         _twr_adc_configure_resolution(_twr_adc.channel_table[_twr_adc.channel_in_progress].resolution);
@@ -338,11 +644,27 @@ void ADC1_COMP_IRQHandler(void)
         ADC1->IER = 0;
 
     }
+
+    // Whole sequence is done, results are moved by DMA
+    else if (_twr_adc.state == TWR_ADC_STATE_SCAN)
+    {
+        // Disable internal reference
+        ADC->CCR &= ~ADC_CCR_VREFEN;
+
+        // Clear all interrupts
+        ADC1->ISR = 0xffff;
+
+        // Disable all ADC interrupts
+        ADC1->IER = 0;
+
+        // Plan ADC task
+        twr_scheduler_plan_now(_twr_adc.task_id);
+    }
 }
 
 bool twr_adc_calibration(void)
 {
-    if (_twr_adc.channel_in_progress != TWR_ADC_CHANNEL_NONE)
+    if (_twr_adc_is_busy())
     {
         return false;
     }
@@ -377,7 +699,7 @@ bool twr_adc_calibration(void)
     }
 
     // Compute actual VDDA
-    _twr_adc.real_vdda_voltage = 3.f * ((float) _twr_adc.vrefint / (float) ADC1->DR);
+    _twr_adc_vdda_update(ADC1->DR);
 
     // Disable internal reference
     ADC->CCR &= ~ADC_CCR_VREFEN;
@@ -391,9 +713,15 @@ static void _twr_adc_task(void *param)
 
     twr_sleep_enable();
 
+    if (_twr_adc.state == TWR_ADC_STATE_SCAN)
+    {
+        _twr_adc_scan_done();
+
+        return;
+    }
+
     twr_adc_channel_config_t *adc = &_twr_adc.channel_table[_twr_adc.channel_in_progress];
     twr_adc_channel_t pending_result_channel;
-    twr_adc_channel_t next;
 
     // Update pending channel result
     pending_result_channel = _twr_adc.channel_in_progress;
@@ -405,10 +733,7 @@ static void _twr_adc_task(void *param)
     twr_irq_disable();
 
     // Get pending
-    if (_twr_adc_get_pending(&next, pending_result_channel) == true)
-    {
-        twr_adc_async_measure(next);
-    }
+    _twr_adc_start_pending(pending_result_channel);
 
     // Enable interrupts
     twr_irq_enable();
@@ -446,3 +771,171 @@ static inline bool _twr_adc_get_pending(twr_adc_channel_t *next ,twr_adc_channel
 
     return false;
 }
+
+static void _twr_adc_scan_start(void)
+{
+    uint32_t chselr = _twr_adc.channel_table[TWR_ADC_CHANNEL_INTERNAL_REFERENCE].chselr;
+    size_t length = 1;
+
+    for (int i = TWR_ADC_CHANNEL_A0; i < TWR_ADC_CHANNEL_INTERNAL_REFERENCE; i++)
+    {
+        if ((_twr_adc.scan.channel_mask & (1 << i)) != 0)
+        {
+            chselr |= _twr_adc.channel_table[i].chselr;
+            length++;
+        }
+    }
+
+    _twr_adc.scan.channel_mask_in_progress = _twr_adc.scan.channel_mask;
+    _twr_adc.scan.pending = false;
+    _twr_adc.scan.in_progress = true;
+
+    _twr_adc.state = TWR_ADC_STATE_SCAN;
+
+    // Enable internal reference to ADC peripheral, it is converted last as it has the highest channel number
+    ADC->CCR |= ADC_CCR_VREFEN;
+
+    _twr_adc_configure_oversampling(_twr_adc.scan.oversampling);
+    _twr_adc_configure_resolution(TWR_ADC_RESOLUTION_12_BIT);
+
+    // Set ADC channels
+    ADC1->CHSELR = chselr;
+
+    _twr_adc.dma_config.mode = TWR_DMA_MODE_STANDARD;
+    _twr_adc.dma_config.address_memory = _twr_adc.scan.buffer;
+    _twr_adc.dma_config.length = length;
+
+    twr_dma_set_event_handler(_twr_adc.dma_channel, NULL, NULL);
+    twr_dma_channel_config(_twr_adc.dma_channel, &_twr_adc.dma_config);
+    twr_dma_channel_run(_twr_adc.dma_channel);
+
+    // Enable DMA requests in one shot mode
+    ADC1->CFGR1 |= ADC_CFGR1_DMAEN;
+
+    // Clear end of conversion and end of sequence interrupts
+    ADC1->ISR = ADC_ISR_EOC | ADC_ISR_EOS | ADC_ISR_OVR;
+
+    // Enable end of sequence interrupt
+    ADC1->IER = ADC_IER_EOSIE;
+
+    // Begin sequence
+    ADC1->CR |= ADC_CR_ADSTART;
+
+    twr_sleep_disable(); // enable in _twr_adc_task
+}
+
+static void _twr_adc_scan_done(void)
+{
+    int index = 0;
+
+    ADC1->CFGR1 &= ~ADC_CFGR1_DMAEN;
+
+    twr_dma_channel_stop(_twr_adc.dma_channel);
+
+    for (int i = TWR_ADC_CHANNEL_A0; i < TWR_ADC_CHANNEL_INTERNAL_REFERENCE; i++)
+    {
+        if ((_twr_adc.scan.channel_mask_in_progress & (1 << i)) != 0)
+        {
+            // Left align 12 bit result like single conversions do
+            _twr_adc.channel_table[i].value = _twr_adc.scan.buffer[index++] << 4;
+        }
+    }
+
+    // Compute actual VDDA
+    _twr_adc_vdda_update(_twr_adc.scan.buffer[index]);
+
+    // Release ADC for further conversion
+    _twr_adc.scan.in_progress = false;
+
+    twr_irq_disable();
+
+    _twr_adc_start_pending(TWR_ADC_CHANNEL_INTERNAL_REFERENCE);
+
+    twr_irq_enable();
+
+    if (_twr_adc.scan.event_handler != NULL)
+    {
+        _twr_adc.scan.event_handler(TWR_ADC_EVENT_DONE, _twr_adc.scan.event_param);
+    }
+}
+
+static void _twr_adc_start_pending(twr_adc_channel_t start)
+{
+    twr_adc_channel_t next;
+
+    // Scan has precedence as it serves several channels at once
+    if (_twr_adc.scan.pending)
+    {
+        _twr_adc_scan_start();
+    }
+    else if (_twr_adc_get_pending(&next, start) == true)
+    {
+        twr_adc_async_measure(next);
+    }
+}
+
+static bool _twr_adc_dma_allocate(void)
+{
+    if (_twr_adc.dma_allocated)
+    {
+        return true;
+    }
+
+    twr_dma_init();
+
+    if (!twr_dma_channel_allocate(TWR_DMA_LINE_ADC, &_twr_adc.dma_channel, &_twr_adc.dma_config.request))
+    {
+        return false;
+    }
+
+    _twr_adc.dma_config.direction = TWR_DMA_DIRECTION_TO_RAM;
+    _twr_adc.dma_config.data_size_memory = TWR_DMA_SIZE_2;
+    _twr_adc.dma_config.data_size_peripheral = TWR_DMA_SIZE_2;
+    _twr_adc.dma_config.address_peripheral = (void *) &ADC1->DR;
+    _twr_adc.dma_config.priority = TWR_DMA_PRIORITY_HIGH;
+
+    _twr_adc.dma_allocated = true;
+
+    return true;
+}
+
+static void _twr_adc_stream_dma_handler(twr_dma_channel_t channel, twr_dma_event_t event, void *param)
+{
+    (void) channel;
+    (void) param;
+
+    // Event can be delivered after the stream was stopped
+    if (!_twr_adc.stream.active)
+    {
+        return;
+    }
+
+    size_t half = _twr_adc.stream.length / 2;
+
+    if (event == TWR_DMA_EVENT_HALF_DONE)
+    {
+        _twr_adc.stream.block_handler(_twr_adc.stream.buffer, half, _twr_adc.stream.block_param);
+    }
+    else if (event == TWR_DMA_EVENT_DONE)
+    {
+        _twr_adc.stream.block_handler(_twr_adc.stream.buffer + half, half, _twr_adc.stream.block_param);
+    }
+    else
+    {
+        twr_adc_stream_stop();
+    }
+}
+
+static void _twr_adc_vdda_update(uint16_t vrefint_data)
+{
+    if (vrefint_data == 0)
+    {
+        return;
+    }
+
+    _twr_adc.real_vdda_voltage = 3.f * ((float) _twr_adc.vrefint / (float) vrefint_data);
+
+    _twr_adc.vdda_valid = true;
+    _twr_adc.vdda_tick = twr_tick_get();
+    _twr_adc.vdda_temperature = _twr_adc.temperature;
+}
@@ -1,13 +1,27 @@
 #include <twr_aes.h>
 #include <twr_system.h>
 #include <twr_tick.h>
+#include <twr_dma.h>
 #include <stm32l0xx.h>
 
 #define _TWR_AES_DATATYPE AES_CR_DATATYPE_1
 
+static struct
+{
+    bool busy;
+    twr_dma_channel_t channel_in;
+    twr_dma_channel_t channel_out;
+    void (*event_handler)(twr_aes_event_t, void *);
+    void *event_param;
+
+} _twr_aes;
+
 static void _twr_aes_set_key(const twr_aes_key_t key);
 static void _twr_aes_set_iv(const twr_aes_iv_t iv);
 static bool _twr_aes_process(void *buffer_out, const void *buffer_in, size_t length);
+static bool _twr_aes_process_async(uint32_t cr, void *buffer_out, const void *buffer_in, size_t length, const twr_aes_key_t key, const twr_aes_iv_t iv, void (*event_handler)(twr_aes_event_t, void *), void *event_param);
+static void _twr_aes_dma_event_handler(twr_dma_channel_t channel, twr_dma_event_t event, void *event_param);
+static void _twr_aes_finish(twr_aes_event_t event);
 
 void twr_aes_init(void)
 {
@@ -18,7 +32,12 @@ void twr_aes_init(void)
 
 bool twr_aes_key_derivation(twr_aes_key_t decryption_key, const twr_aes_key_t key)
 {
-    twr_system_pll_enable();
+    if (_twr_aes.busy)
+    {
+        return false;
+    }
+
+    twr_system_clock_request(TWR_SYSTEM_CLOCK_FREQUENCY_MSI_FAST);
 
     AES->CR = AES_CR_MODE_0;
 
@@ -32,7 +51,7 @@ bool twr_aes_key_derivation(twr_aes_key_t decryption_key, const twr_aes_key_t ke
     {
         if (timeout < twr_tick_get())
         {
-            twr_system_pll_disable();
+            twr_system_clock_release(TWR_SYSTEM_CLOCK_FREQUENCY_MSI_FAST);
             return false;
         }
     }
@@ -44,14 +63,14 @@ bool twr_aes_key_derivation(twr_aes_key_t decryption_key, const twr_aes_key_t ke
 
     AES->CR |= AES_CR_CCFC;
 
-    twr_system_pll_disable();
+    twr_system_clock_release(TWR_SYSTEM_CLOCK_FREQUENCY_MSI_FAST);
 
     return true;
 }
 
 bool twr_aes_ecb_encrypt(void *buffer_out, const void *buffer_in, const size_t length, const twr_aes_key_t key)
 {
-    if ((length % 16) != 0)
+    if ((length % 16) != 0 || _twr_aes.busy)
     {
         return false;
     }
@@ -65,7 +84,7 @@ bool twr_aes_ecb_encrypt(void *buffer_out, const void *buffer_in, const size_t l
 
 bool twr_aes_ecb_decrypt(void *buffer_out, const void *buffer_in, size_t length, twr_aes_key_t key)
 {
-    if ((length % 16) != 0)
+    if ((length % 16) != 0 || _twr_aes.busy)
     {
         return false;
     }
@@ -79,7 +98,7 @@ bool twr_aes_ecb_decrypt(void *buffer_out, const void *buffer_in, size_t length,
 
 bool twr_aes_ctwr_encrypt(void *buffer_out, const void *buffer_in, size_t length, twr_aes_key_t key, twr_aes_iv_t iv)
 {
-    if ((length % 16) != 0)
+    if ((length % 16) != 0 || _twr_aes.busy)
     {
         return false;
     }
@@ -95,7 +114,7 @@ bool twr_aes_ctwr_encrypt(void *buffer_out, const void *buffer_in, size_t length
 
 bool twr_aes_ctwr_decrypt(void *buffer_out, const void *buffer_in, size_t length, twr_aes_key_t key, twr_aes_iv_t iv)
 {
-    if ((length % 16) != 0)
+    if ((length % 16) != 0 || _twr_aes.busy)
     {
         return false;
     }
@@ -109,6 +128,31 @@ bool twr_aes_ctwr_decrypt(void *buffer_out, const void *buffer_in, size_t length
     return _twr_aes_process(buffer_out, buffer_in, length);
 }
 
+bool twr_aes_ecb_encrypt_async(void *buffer_out, const void *buffer_in, size_t length, const twr_aes_key_t key, void (*event_handler)(twr_aes_event_t, void *), void *event_param)
+{
+    return _twr_aes_process_async(_TWR_AES_DATATYPE, buffer_out, buffer_in, length, key, NULL, event_handler, event_param);
+}
+
+bool twr_aes_ecb_decrypt_async(void *buffer_out, const void *buffer_in, size_t length, const twr_aes_key_t key, void (*event_handler)(twr_aes_event_t, void *), void *event_param)
+{
+    return _twr_aes_process_async(_TWR_AES_DATATYPE | AES_CR_MODE_1, buffer_out, buffer_in, length, key, NULL, event_handler, event_param);
+}
+
+bool twr_aes_ctwr_encrypt_async(void *buffer_out, const void *buffer_in, size_t length, const twr_aes_key_t key, const twr_aes_iv_t iv, void (*event_handler)(twr_aes_event_t, void *), void *event_param)
+{
+    return _twr_aes_process_async(AES_CR_CHMOD_0 | _TWR_AES_DATATYPE, buffer_out, buffer_in, length, key, iv, event_handler, event_param);
+}
+
+bool twr_aes_ctwr_decrypt_async(void *buffer_out, const void *buffer_in, size_t length, const twr_aes_key_t key, const twr_aes_iv_t iv, void (*event_handler)(twr_aes_event_t, void *), void *event_param)
+{
+    return _twr_aes_process_async(AES_CR_CHMOD_0 | _TWR_AES_DATATYPE | AES_CR_MODE_1, buffer_out, buffer_in, length, key, iv, event_handler, event_param);
+}
+
+bool twr_aes_is_busy(void)
+{
+    return _twr_aes.busy;
+}
+
 void twr_aes_key_from_uint8(twr_aes_key_t key, const uint8_t *buffer)
 {
     uint8_t *tmp = (uint8_t *) key;
@@ -152,7 +196,7 @@ static bool _twr_aes_process(void *buffer_out, const void *buffer_in, size_t len
     uint32_t *inputaddr = (uint32_t *) buffer_in;
     uint32_t *outputaddr = (uint32_t *) buffer_out;
 
-    twr_system_pll_enable();
+    twr_system_clock_request(TWR_SYSTEM_CLOCK_FREQUENCY_MSI_FAST);
 
     bool inputaddr_aligned = ((uint32_t) inputaddr & (uint32_t) 0x00000003U) == 0U;
     bool outputaddr_aligned = ((uint32_t) outputaddr & (uint32_t) 0x00000003U) == 0U;
@@ -184,7 +228,7 @@ static bool _twr_aes_process(void *buffer_out, const void *buffer_in, size_t len
         {
             if (timeout < twr_tick_get())
             {
-                twr_system_pll_disable();
+                twr_system_clock_release(TWR_SYSTEM_CLOCK_FREQUENCY_MSI_FAST);
                 return false;
             }
         }
@@ -205,7 +249,122 @@ static bool _twr_aes_process(void *buffer_out, const void *buffer_in, size_t len
 
     AES->CR &= ~AES_CR_EN;
 
-    twr_system_pll_disable();
+    twr_system_clock_release(TWR_SYSTEM_CLOCK_FREQUENCY_MSI_FAST);
 
     return true;
 }
+
+static bool _twr_aes_process_async(uint32_t cr, void *buffer_out, const void *buffer_in, size_t length, const twr_aes_key_t key, const twr_aes_iv_t iv, void (*event_handler)(twr_aes_event_t, void *), void *event_param)
+{
+    if (_twr_aes.busy || length == 0 || (length % 16) != 0 || length / 4 > 0xffff ||
+        ((((uint32_t) buffer_out) | ((uint32_t) buffer_in)) & 3) != 0)
+    {
+        return false;
+    }
+
+    twr_dma_init();
+
+    twr_dma_request_t request;
+
+    if (!twr_dma_channel_allocate(TWR_DMA_LINE_AES_IN, &_twr_aes.channel_in, &request))
+    {
+        return false;
+    }
+
+    if (!twr_dma_channel_allocate(TWR_DMA_LINE_AES_OUT, &_twr_aes.channel_out, NULL))
+    {
+        twr_dma_channel_release(_twr_aes.channel_in);
+
+        return false;
+    }
+
+    _twr_aes.busy = true;
+    _twr_aes.event_handler = event_handler;
+    _twr_aes.event_param = event_param;
+
+    twr_system_clock_request(TWR_SYSTEM_CLOCK_FREQUENCY_MSI_FAST);
+
+    // Core can sleep during the operation, but DMA does not run in stop mode
+    twr_system_deep_sleep_disable();
+
+    AES->CR = cr;
+
+    _twr_aes_set_key(key);
+
+    if (iv != NULL)
+    {
+        _twr_aes_set_iv(iv);
+    }
+
+    twr_dma_channel_config_t config =
+    {
+        .request = request,
+        .direction = TWR_DMA_DIRECTION_TO_PERIPHERAL,
+        .data_size_memory = TWR_DMA_SIZE_4,
+        .data_size_peripheral = TWR_DMA_SIZE_4,
+        .length = length / 4,
+        .mode = TWR_DMA_MODE_STANDARD,
+        .address_memory = (void *) buffer_in,
+        .address_peripheral = (void *) &AES->DINR,
+        .priority = TWR_DMA_PRIORITY_MEDIUM
+    };
+
+    twr_dma_channel_config(_twr_aes.channel_in, &config);
+
+    config.direction = TWR_DMA_DIRECTION_TO_RAM;
+    config.address_memory = buffer_out;
+    config.address_peripheral = (void *) &AES->DOUTR;
+    config.priority = TWR_DMA_PRIORITY_HIGH;
+
+    twr_dma_channel_config(_twr_aes.channel_out, &config);
+
+    twr_dma_set_event_handler(_twr_aes.channel_in, _twr_aes_dma_event_handler, NULL);
+    twr_dma_set_event_handler(_twr_aes.channel_out, _twr_aes_dma_event_handler, NULL);
+
+    twr_dma_channel_run(_twr_aes.channel_out);
+    twr_dma_channel_run(_twr_aes.channel_in);
+
+    // Peripheral requests input block right after enable
+    AES->CR |= AES_CR_DMAINEN | AES_CR_DMAOUTEN | AES_CR_EN;
+
+    return true;
+}
+
+static void _twr_aes_dma_event_handler(twr_dma_channel_t channel, twr_dma_event_t event, void *event_param)
+{
+    (void) event_param;
+
+    if (!_twr_aes.busy)
+    {
+        return;
+    }
+
+    if (event == TWR_DMA_EVENT_ERROR)
+    {
+        _twr_aes_finish(TWR_AES_EVENT_ERROR);
+    }
+    else if (event == TWR_DMA_EVENT_DONE && channel == _twr_aes.channel_out)
+    {
+        // Output transfer ends with the last block
+        _twr_aes_finish(TWR_AES_EVENT_DONE);
+    }
+}
+
+static void _twr_aes_finish(twr_aes_event_t event)
+{
+    AES->CR &= ~(AES_CR_DMAINEN | AES_CR_DMAOUTEN | AES_CR_EN);
+
+    twr_dma_channel_release(_twr_aes.channel_in);
+    twr_dma_channel_release(_twr_aes.channel_out);
+
+    twr_system_deep_sleep_enable();
+
+    twr_system_clock_release(TWR_SYSTEM_CLOCK_FREQUENCY_MSI_FAST);
+
+    _twr_aes.busy = false;
+
+    if (_twr_aes.event_handler != NULL)
+    {
+        _twr_aes.event_handler(event, _twr_aes.event_param);
+    }
+}
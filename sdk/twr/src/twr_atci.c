@@ -1,16 +1,36 @@
 #include <twr_atci.h>
 #include <twr_scheduler.h>
 #include <twr_system.h>
-
+#include <twr_crc.h>
+#include <twr_fmt.h>
+#include <twr_pool.h>
+
+#define _TWR_ATCI_BINARY_STATE_START 0
+#define _TWR_ATCI_BINARY_STATE_LENGTH 1
+#define _TWR_ATCI_BINARY_STATE_DATA 2
+#define _TWR_ATCI_BINARY_STATE_CRC 3
+
+static size_t _twr_atci_write(const void *buffer, size_t length);
+static void _twr_atci_receive(void);
+static void _twr_atci_rx_task(void *param);
 static void _twr_atci_uart_event_handler(twr_uart_channel_t channel, twr_uart_event_t event, void  *event_param);
 static void _twr_atci_uart_active_test(void);
 static void _twr_atci_uart_active_test_task(void  *param);
+static const twr_atci_command_t *_twr_atci_find_command(const char *name, size_t length);
+static int _twr_atci_compare(const char *name, size_t length, const char *command);
+static void _twr_atci_binary_process(uint8_t byte);
+static void _twr_atci_binary_finish(bool ok);
+static void _twr_atci_binary_task(void *param);
 
 static struct
 {
     const twr_atci_command_t *commands;
     size_t commands_length;
-    char tx_buffer[256];
+#if TWR_ATCI_INDEX_SIZE > 0
+    // Commands sorted by name, first of duplicates wins like in linear lookup
+    uint8_t index[TWR_ATCI_INDEX_SIZE];
+    bool indexed;
+#endif
     char rx_buffer[256];
     size_t rx_length;
     bool rx_error;
@@ -18,10 +38,33 @@ static struct
     twr_fifo_t read_fifo;
     twr_scheduler_task_id_t vbus_sense_test_task_id;
     bool ready;
+    twr_transport_t *transport;
+    size_t (*transport_read)(void *buffer, size_t length);
+    twr_tick_t poll_interval;
+    twr_scheduler_task_id_t rx_task_id;
+    uint8_t chunk[16];
+    size_t chunk_length;
+    size_t chunk_offset;
+    bool pending;
     bool (*uart_active_callback)(void);
     twr_tick_t scan_interval;
     bool write_response;
 
+    struct
+    {
+        bool active;
+        uint8_t *buffer;
+        size_t size;
+        size_t length;
+        size_t offset;
+        int state;
+        uint32_t crc;
+        bool (*handler)(const void *, size_t, void *);
+        void *param;
+        twr_scheduler_task_id_t task_id;
+
+    } binary;
+
 } _twr_atci;
 
 void twr_atci_init(const twr_atci_command_t *commands, int length)
@@ -32,6 +75,28 @@ void twr_atci_init(const twr_atci_command_t *commands, int length)
 
     _twr_atci.commands_length = length;
 
+#if TWR_ATCI_INDEX_SIZE > 0
+    if (length <= TWR_ATCI_INDEX_SIZE && length <= 256)
+    {
+        // Stable insertion sort, runs once for table in flash
+        for (int i = 0; i < length; i++)
+        {
+            int j = i;
+
+            while (j > 0 && strcmp(commands[_twr_atci.index[j - 1]].command, commands[i].command) > 0)
+            {
+                _twr_atci.index[j] = _twr_atci.index[j - 1];
+
+                j--;
+            }
+
+            _twr_atci.index[j] = i;
+        }
+
+        _twr_atci.indexed = true;
+    }
+#endif
+
     _twr_atci.rx_length = 0;
 
     _twr_atci.rx_error = false;
@@ -40,23 +105,102 @@ void twr_atci_init(const twr_atci_command_t *commands, int length)
 
     twr_fifo_init(&_twr_atci.read_fifo, _twr_atci.read_fifo_buffer, sizeof(_twr_atci.read_fifo_buffer));
 
+    twr_fifo_set_spsc(&_twr_atci.read_fifo, true);
+
+    _twr_atci.binary.task_id = twr_scheduler_register(_twr_atci_binary_task, NULL, TWR_TICK_INFINITY);
+
+    _twr_atci.rx_task_id = twr_scheduler_register(_twr_atci_rx_task, NULL, TWR_TICK_INFINITY);
+
+    _twr_atci.poll_interval = TWR_ATCI_POLL_INTERVAL;
+
     twr_atci_set_uart_active_callback(twr_system_get_vbus_sense, 200);
 }
 
+void twr_atci_set_transport(twr_transport_t *transport, size_t (*read)(void *buffer, size_t length))
+{
+    if (_twr_atci.vbus_sense_test_task_id)
+    {
+        twr_scheduler_unregister(_twr_atci.vbus_sense_test_task_id);
+
+        _twr_atci.vbus_sense_test_task_id = 0;
+    }
+
+    if (_twr_atci.ready)
+    {
+        twr_uart_deinit(TWR_ATCI_UART);
+    }
+
+    _twr_atci.transport = transport;
+
+    _twr_atci.transport_read = read;
+
+    _twr_atci.ready = true;
+
+    twr_scheduler_plan_now(_twr_atci.rx_task_id);
+}
+
+void twr_atci_set_poll_interval(twr_tick_t interval)
+{
+    _twr_atci.poll_interval = interval;
+
+    twr_scheduler_plan_now(_twr_atci.rx_task_id);
+}
+
+void twr_atci_receive(void)
+{
+    twr_scheduler_plan_now(_twr_atci.rx_task_id);
+}
+
+bool twr_atci_pending(void)
+{
+    _twr_atci.write_response = false;
+
+    _twr_atci.pending = true;
+
+    return true;
+}
+
+void twr_atci_complete(bool ok)
+{
+    if (!_twr_atci.pending)
+    {
+        return;
+    }
+
+    _twr_atci.pending = false;
+
+    if (ok)
+    {
+        twr_atci_write_ok();
+    }
+    else
+    {
+        twr_atci_write_error();
+    }
+
+    // Lines received meanwhile are waiting in input
+    twr_scheduler_plan_now(_twr_atci.rx_task_id);
+}
+
+bool twr_atci_is_pending(void)
+{
+    return _twr_atci.pending;
+}
+
 size_t twr_atci_print(const char *message)
 {
-    return twr_uart_write(TWR_ATCI_UART, message, strlen(message));
+    return _twr_atci_write(message, strlen(message));
 }
 
 size_t twr_atci_println(const char *message)
 {
-    size_t len = twr_uart_write(TWR_ATCI_UART, message, strlen(message));
-    return twr_uart_write(TWR_ATCI_UART, "\r\n", 2) + len;
+    size_t len = _twr_atci_write(message, strlen(message));
+    return _twr_atci_write("\r\n", 2) + len;
 }
 
-static size_t _twr_atci_printf(const char *format, va_list ap, size_t maxlen)
+static size_t _twr_atci_printf(char *buffer, const char *format, va_list ap, size_t maxlen)
 {
-    size_t length = vsnprintf(_twr_atci.tx_buffer, maxlen, format, ap);
+    size_t length = twr_fmt_vsnprintf(buffer, maxlen, format, ap);
 
     if (length > maxlen) {
         length = maxlen;
@@ -72,13 +216,25 @@ size_t twr_atci_printf(const char *format, ...)
         return 0;
     }
 
+    // Output is formatted in scratch buffer of shared pool
+    char *buffer = twr_pool_alloc(twr_pool_get_shared());
+
+    if (buffer == NULL)
+    {
+        return 0;
+    }
+
     va_list ap;
 
     va_start(ap, format);
-    size_t length = _twr_atci_printf(format, ap, sizeof(_twr_atci.tx_buffer));
+    size_t length = _twr_atci_printf(buffer, format, ap, TWR_POOL_SHARED_BLOCK_SIZE);
     va_end(ap);
 
-    return twr_uart_write(TWR_ATCI_UART, _twr_atci.tx_buffer, length);
+    length = _twr_atci_write(buffer, length);
+
+    twr_pool_unref(twr_pool_get_shared(), buffer);
+
+    return length;
 }
 
 size_t twr_atci_printfln(const char *format, ...)
@@ -88,16 +244,27 @@ size_t twr_atci_printfln(const char *format, ...)
         return 0;
     }
 
+    char *buffer = twr_pool_alloc(twr_pool_get_shared());
+
+    if (buffer == NULL)
+    {
+        return 0;
+    }
+
     va_list ap;
 
     va_start(ap, format);
-    size_t length = _twr_atci_printf(format, ap, sizeof(_twr_atci.tx_buffer) - 2);
+    size_t length = _twr_atci_printf(buffer, format, ap, TWR_POOL_SHARED_BLOCK_SIZE - 2);
     va_end(ap);
 
-    _twr_atci.tx_buffer[length++] = '\r';
-    _twr_atci.tx_buffer[length++] = '\n';
+    buffer[length++] = '\r';
+    buffer[length++] = '\n';
+
+    length = _twr_atci_write(buffer, length);
 
-    return twr_uart_write(TWR_ATCI_UART, _twr_atci.tx_buffer, length);
+    twr_pool_unref(twr_pool_get_shared(), buffer);
+
+    return length;
 }
 
 size_t twr_atci_print_buffer_as_hex(const void *buffer, size_t length)
@@ -107,8 +274,16 @@ size_t twr_atci_print_buffer_as_hex(const void *buffer, size_t length)
         return 0;
     }
 
+    char *hex = twr_pool_alloc(twr_pool_get_shared());
+
+    if (hex == NULL)
+    {
+        return 0;
+    }
+
     char byte;
     size_t on_write = 0;
+    size_t written = 0;
 
     for (size_t i = 0; i < length; i++)
     {
@@ -117,11 +292,68 @@ size_t twr_atci_print_buffer_as_hex(const void *buffer, size_t length)
         char upper = (byte >> 4) & 0xf;
         char lower = byte & 0x0f;
 
-        _twr_atci.tx_buffer[on_write++] = upper < 10 ? upper + '0' : upper - 10 + 'A';
-        _twr_atci.tx_buffer[on_write++] = lower < 10 ? lower + '0' : lower - 10 + 'A';
+        hex[on_write++] = upper < 10 ? upper + '0' : upper - 10 + 'A';
+        hex[on_write++] = lower < 10 ? lower + '0' : lower - 10 + 'A';
+
+        // Long buffer is written in parts of block size
+        if (on_write == TWR_POOL_SHARED_BLOCK_SIZE)
+        {
+            written += _twr_atci_write(hex, on_write);
+
+            on_write = 0;
+        }
     }
 
-    return twr_uart_write(TWR_ATCI_UART, _twr_atci.tx_buffer, on_write);
+    written += _twr_atci_write(hex, on_write);
+
+    twr_pool_unref(twr_pool_get_shared(), hex);
+
+    return written;
+}
+
+size_t twr_atci_binary_send(const void *buffer, size_t length)
+{
+    if (!_twr_atci.ready || length > 0xffff)
+    {
+        return 0;
+    }
+
+    uint32_t crc = twr_crc32(buffer, length);
+
+    uint8_t header[3] = { TWR_ATCI_BINARY_START, length, length >> 8 };
+    uint8_t trailer[4] = { crc, crc >> 8, crc >> 16, crc >> 24 };
+
+    if (_twr_atci.transport != NULL)
+    {
+        twr_transport_segment_t segments[] = { { header, sizeof(header) }, { buffer, length }, { trailer, sizeof(trailer) } };
+
+        return twr_transport_writev(_twr_atci.transport, segments, 3);
+    }
+
+    size_t on_write = _twr_atci_write(header, sizeof(header));
+
+    on_write += _twr_atci_write(buffer, length);
+
+    return on_write + _twr_atci_write(trailer, sizeof(trailer));
+}
+
+bool twr_atci_binary_receive(void *buffer, size_t size, bool (*handler)(const void *buffer, size_t length, void *param), void *param)
+{
+    if (_twr_atci.binary.active)
+    {
+        return false;
+    }
+
+    _twr_atci.binary.buffer = buffer;
+    _twr_atci.binary.size = size;
+    _twr_atci.binary.handler = handler;
+    _twr_atci.binary.param = param;
+    _twr_atci.binary.state = _TWR_ATCI_BINARY_STATE_START;
+    _twr_atci.binary.active = true;
+
+    twr_scheduler_plan_relative(_twr_atci.binary.task_id, TWR_ATCI_BINARY_TIMEOUT);
+
+    return true;
 }
 
 bool twr_atci_skip_response(void)
@@ -133,12 +365,12 @@ bool twr_atci_skip_response(void)
 
 void twr_atci_write_ok(void)
 {
-    twr_uart_write(TWR_ATCI_UART, "OK\r\n", 4);
+    _twr_atci_write("OK\r\n", 4);
 }
 
 void twr_atci_write_error(void)
 {
-    twr_uart_write(TWR_ATCI_UART, "ERROR\r\n", 7);
+    _twr_atci_write("ERROR\r\n", 7);
 }
 
 bool twr_atci_clac_action(void)
@@ -177,26 +409,17 @@ static bool _twr_atci_process_line(void)
 
     size_t length = _twr_atci.rx_length - 2;
 
-    size_t command_len;
+    size_t command_len = 0;
 
-    const twr_atci_command_t *command;
-
-    for (size_t i = 0; i < _twr_atci.commands_length; i++)
+    while (command_len < length && line[command_len] != '=' && line[command_len] != '?')
     {
-        command = _twr_atci.commands + i;
-
-        command_len = strlen(command->command);
-
-        if (length < command_len)
-        {
-            continue;
-        }
+        command_len++;
+    }
 
-        if (strncmp(line, command->command, command_len) != 0)
-        {
-            continue;
-        }
+    const twr_atci_command_t *command = _twr_atci_find_command(line, command_len);
 
+    if (command != NULL)
+    {
         if (command_len == length)
         {
             if (command->action != NULL)
@@ -232,20 +455,74 @@ static bool _twr_atci_process_line(void)
                 return command->read();
             }
         }
-        else
+    }
+
+    return false;
+}
+
+static const twr_atci_command_t *_twr_atci_find_command(const char *name, size_t length)
+{
+#if TWR_ATCI_INDEX_SIZE > 0
+    if (_twr_atci.indexed)
+    {
+        size_t low = 0;
+        size_t high = _twr_atci.commands_length;
+
+        // Lower bound, so the first of equal names is found
+        while (low < high)
         {
-            return false;
+            size_t middle = (low + high) / 2;
+
+            if (_twr_atci_compare(name, length, _twr_atci.commands[_twr_atci.index[middle]].command) > 0)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+
+        if (low < _twr_atci.commands_length && _twr_atci_compare(name, length, _twr_atci.commands[_twr_atci.index[low]].command) == 0)
+        {
+            return _twr_atci.commands + _twr_atci.index[low];
         }
 
-        break;
+        return NULL;
     }
+#endif
 
-    return false;
+    for (size_t i = 0; i < _twr_atci.commands_length; i++)
+    {
+        if (_twr_atci_compare(name, length, _twr_atci.commands[i].command) == 0)
+        {
+            return _twr_atci.commands + i;
+        }
+    }
+
+    return NULL;
+}
+
+static int _twr_atci_compare(const char *name, size_t length, const char *command)
+{
+    int result = strncmp(name, command, length);
+
+    if (result != 0)
+    {
+        return result;
+    }
+
+    // Name is equal to prefix of command, shorter one goes first
+    return command[length] == '\0' ? 0 : -1;
 }
 
 static void _twr_atci_process_character(char character)
 {
-    if (character == '\n')
+    if (_twr_atci.binary.active)
+    {
+        _twr_atci_binary_process(character);
+    }
+    else if (character == '\n')
     {
         if (!_twr_atci.rx_error && _twr_atci.rx_length > 0)
         {
@@ -294,6 +571,66 @@ static void _twr_atci_process_character(char character)
     }
 }
 
+static size_t _twr_atci_write(const void *buffer, size_t length)
+{
+    if (_twr_atci.transport != NULL)
+    {
+        return twr_transport_write(_twr_atci.transport, buffer, length);
+    }
+
+    return twr_uart_write(TWR_ATCI_UART, buffer, length);
+}
+
+static void _twr_atci_receive(void)
+{
+    // Input is not consumed while response of command is pending, the rest of chunk is kept for later
+    while (!_twr_atci.pending)
+    {
+        if (_twr_atci.chunk_offset == _twr_atci.chunk_length)
+        {
+            _twr_atci.chunk_offset = 0;
+
+            if (_twr_atci.transport != NULL)
+            {
+                _twr_atci.chunk_length = _twr_atci.transport_read(_twr_atci.chunk, sizeof(_twr_atci.chunk));
+            }
+            else
+            {
+                _twr_atci.chunk_length = twr_uart_async_read(TWR_ATCI_UART, _twr_atci.chunk, sizeof(_twr_atci.chunk));
+            }
+
+            if (_twr_atci.chunk_length == 0)
+            {
+                break;
+            }
+        }
+
+        _twr_atci_process_character((char) _twr_atci.chunk[_twr_atci.chunk_offset++]);
+
+        // Timeout is counted from the last received chunk
+        if (_twr_atci.binary.active && (_twr_atci.chunk_offset == _twr_atci.chunk_length))
+        {
+            twr_scheduler_plan_relative(_twr_atci.binary.task_id, TWR_ATCI_BINARY_TIMEOUT);
+        }
+    }
+}
+
+static void _twr_atci_rx_task(void *param)
+{
+    (void) param;
+
+    if (_twr_atci.transport != NULL || _twr_atci.ready)
+    {
+        _twr_atci_receive();
+    }
+
+    // Transport has no receive event, so it is polled
+    if (_twr_atci.transport != NULL && _twr_atci.poll_interval != TWR_TICK_INFINITY)
+    {
+        twr_scheduler_plan_current_relative(_twr_atci.poll_interval);
+    }
+}
+
 static void _twr_atci_uart_event_handler(twr_uart_channel_t channel, twr_uart_event_t event, void  *event_param)
 {
     (void) channel;
@@ -301,22 +638,103 @@ static void _twr_atci_uart_event_handler(twr_uart_channel_t channel, twr_uart_ev
 
     if (event == TWR_UART_EVENT_ASYNC_READ_DATA)
     {
-        while (true)
+        _twr_atci_receive();
+    }
+}
+
+static void _twr_atci_binary_process(uint8_t byte)
+{
+    switch (_twr_atci.binary.state)
+    {
+        case _TWR_ATCI_BINARY_STATE_START:
         {
-            static uint8_t buffer[16];
+            if (byte == TWR_ATCI_BINARY_START)
+            {
+                _twr_atci.binary.length = 0;
+                _twr_atci.binary.offset = 0;
+                _twr_atci.binary.state = _TWR_ATCI_BINARY_STATE_LENGTH;
+            }
 
-            size_t length = twr_uart_async_read(TWR_ATCI_UART, buffer, sizeof(buffer));
+            break;
+        }
+        case _TWR_ATCI_BINARY_STATE_LENGTH:
+        {
+            _twr_atci.binary.length |= (size_t) byte << (8 * _twr_atci.binary.offset);
 
-            if (length == 0)
+            if (++_twr_atci.binary.offset == 2)
             {
-                break;
+                _twr_atci.binary.offset = 0;
+                _twr_atci.binary.crc = 0;
+                _twr_atci.binary.state = _twr_atci.binary.length != 0 ? _TWR_ATCI_BINARY_STATE_DATA : _TWR_ATCI_BINARY_STATE_CRC;
             }
 
-            for (size_t i = 0; i < length; i++)
+            break;
+        }
+        case _TWR_ATCI_BINARY_STATE_DATA:
+        {
+            // Data which does not fit are consumed anyway, so the rest of frame is not parsed as commands
+            if (_twr_atci.binary.offset < _twr_atci.binary.size)
             {
-                _twr_atci_process_character((char) buffer[i]);
+                _twr_atci.binary.buffer[_twr_atci.binary.offset] = byte;
             }
+
+            if (++_twr_atci.binary.offset == _twr_atci.binary.length)
+            {
+                _twr_atci.binary.offset = 0;
+                _twr_atci.binary.state = _TWR_ATCI_BINARY_STATE_CRC;
+            }
+
+            break;
         }
+        case _TWR_ATCI_BINARY_STATE_CRC:
+        {
+            _twr_atci.binary.crc |= (uint32_t) byte << (8 * _twr_atci.binary.offset);
+
+            if (++_twr_atci.binary.offset == 4)
+            {
+                bool ok = _twr_atci.binary.length <= _twr_atci.binary.size &&
+                          _twr_atci.binary.crc == twr_crc32(_twr_atci.binary.buffer, _twr_atci.binary.length);
+
+                _twr_atci_binary_finish(ok);
+            }
+
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+static void _twr_atci_binary_finish(bool ok)
+{
+    _twr_atci.binary.active = false;
+
+    twr_scheduler_plan_absolute(_twr_atci.binary.task_id, TWR_TICK_INFINITY);
+
+    if (ok && _twr_atci.binary.handler != NULL)
+    {
+        ok = _twr_atci.binary.handler(_twr_atci.binary.buffer, _twr_atci.binary.length, _twr_atci.binary.param);
+    }
+
+    if (ok)
+    {
+        twr_atci_write_ok();
+    }
+    else
+    {
+        twr_atci_write_error();
+    }
+}
+
+static void _twr_atci_binary_task(void *param)
+{
+    (void) param;
+
+    if (_twr_atci.binary.active)
+    {
+        _twr_atci_binary_finish(false);
     }
 }
 
@@ -488,6 +906,11 @@ void twr_atci_set_uart_active_callback(bool(*callback)(void), twr_tick_t scan_in
 
 static void _twr_atci_uart_active_test(void)
 {
+    if (_twr_atci.transport != NULL)
+    {
+        return;
+    }
+
     if ((_twr_atci.uart_active_callback == NULL) || _twr_atci.uart_active_callback())
     {
         if (!_twr_atci.ready)
@@ -502,7 +925,7 @@ static void _twr_atci_uart_active_test(void)
 
             _twr_atci.ready = true;
 
-            twr_uart_write(TWR_ATCI_UART, "\r\n", 2);
+            _twr_atci_write("\r\n", 2);
         }
     }
     else
@@ -85,6 +85,16 @@ bool twr_atsha204_get_serial_number(twr_atsha204_t *self, void *destination, siz
     return true;
 }
 
+bool twr_atsha204_is_present(twr_atsha204_t *self)
+{
+    if (!twr_atsha204_is_ready(self))
+    {
+        return false;
+    }
+
+    return _twr_atsha204_wakeup(self);
+}
+
 static void _twr_atsha204_task(void *param)
 {
     twr_atsha204_t *self = param;
@@ -2,6 +2,16 @@
 
 const char twr_b64_alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
+// Values of characters from '+' to 'z', 0xff stands for invalid character
+static const uint8_t _twr_base64_table['z' - '+' + 1] =
+{
+    0x3e, 0xff, 0xff, 0xff, 0x3f, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23,
+    0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33
+};
+
 static uint8_t twr_base64_lookup(char c);
 
 bool twr_base64_encode(char *output, size_t *output_length, uint8_t *input, size_t input_length)
@@ -145,6 +155,136 @@ bool twr_base64_decode(uint8_t *output, size_t *output_length, char *input, size
     return true;
 }
 
+void twr_base64_init(twr_base64_t *self)
+{
+    memset(self, 0, sizeof(*self));
+}
+
+size_t twr_base64_encode_update(twr_base64_t *self, char *output, size_t *output_length, const uint8_t *input, size_t input_length)
+{
+    size_t encode_length = 0;
+    size_t i;
+
+    for (i = 0; i < input_length; i++)
+    {
+        // Byte completing the group needs room for all four characters
+        if (self->_count == 2 && encode_length + 4 > *output_length)
+        {
+            break;
+        }
+
+        self->_bits = self->_bits << 8 | input[i];
+
+        if (++self->_count == 3)
+        {
+            output[encode_length++] = twr_b64_alphabet[(self->_bits >> 18) & 0x3f];
+            output[encode_length++] = twr_b64_alphabet[(self->_bits >> 12) & 0x3f];
+            output[encode_length++] = twr_b64_alphabet[(self->_bits >> 6) & 0x3f];
+            output[encode_length++] = twr_b64_alphabet[self->_bits & 0x3f];
+
+            self->_bits = 0;
+            self->_count = 0;
+        }
+    }
+
+    *output_length = encode_length;
+
+    return i;
+}
+
+bool twr_base64_encode_final(twr_base64_t *self, char *output, size_t *output_length)
+{
+    if (self->_count == 0)
+    {
+        *output_length = 0;
+
+        return true;
+    }
+
+    if (*output_length < 4)
+    {
+        return false;
+    }
+
+    uint32_t bits = self->_bits << (3 - self->_count) * 8;
+
+    output[0] = twr_b64_alphabet[(bits >> 18) & 0x3f];
+    output[1] = twr_b64_alphabet[(bits >> 12) & 0x3f];
+    output[2] = self->_count == 2 ? twr_b64_alphabet[(bits >> 6) & 0x3f] : '=';
+    output[3] = '=';
+
+    *output_length = 4;
+
+    twr_base64_init(self);
+
+    return true;
+}
+
+size_t twr_base64_decode_update(twr_base64_t *self, uint8_t *output, size_t *output_length, const char *input, size_t input_length)
+{
+    size_t decode_length = 0;
+    size_t i;
+
+    for (i = 0; i < input_length; i++)
+    {
+        char c = input[i];
+
+        if (self->_end || c == '=')
+        {
+            self->_end = true;
+
+            continue;
+        }
+
+        if (c == '\r' || c == '\n' || c == ' ' || c == '\t')
+        {
+            continue;
+        }
+
+        uint8_t value = twr_base64_lookup(c);
+
+        if (value == 0xff)
+        {
+            self->_error = true;
+
+            break;
+        }
+
+        // Character completing byte needs room for it
+        if (self->_count >= 2 && decode_length == *output_length)
+        {
+            break;
+        }
+
+        self->_bits = self->_bits << 6 | value;
+        self->_count += 6;
+        self->_quantum = (self->_quantum + 1) & 3;
+
+        if (self->_count >= 8)
+        {
+            self->_count -= 8;
+
+            output[decode_length++] = self->_bits >> self->_count;
+
+            self->_bits &= (1 << self->_count) - 1;
+        }
+    }
+
+    *output_length = decode_length;
+
+    return i;
+}
+
+bool twr_base64_decode_final(twr_base64_t *self)
+{
+    // Single character of group does not carry whole byte
+    bool valid = !self->_error && self->_quantum != 1;
+
+    twr_base64_init(self);
+
+    return valid;
+}
+
 size_t twr_base64_calculate_encode_length(size_t length)
 {
     size_t n = (int) length;
@@ -166,25 +306,10 @@ size_t twr_base64_calculate_decode_length(char *input, size_t length)
 
 static uint8_t twr_base64_lookup(char c)
 {
-    if (c >= 'A' && c <= 'Z')
-    {
-        return (uint8_t) (c - 'A');
-    }
-    if (c >= 'a' && c <= 'z')
-    {
-        return (uint8_t) (c - 71);
-    }
-    if (c >= '0' && c <= '9')
+    if (c < '+' || c > 'z')
     {
-        return (uint8_t) (c + 4);
+        return 0xff;
     }
-    if (c == '+')
-    {
-        return 62;
-    }
-    if (c == '/')
-    {
-        return 63;
-    }
-    return (uint8_t) -1;
+
+    return _twr_base64_table[c - '+'];
 }
@@ -0,0 +1,191 @@
+#include <twr_boot.h>
+#include <twr_timer.h>
+#include <twr_log.h>
+
+#define _TWR_BOOT_TIMER_LIMIT_MS 50
+
+typedef struct
+{
+    const char *name;
+    void (*step)(void *);
+    void *param;
+    int after;
+    twr_tick_t delay;
+    bool done;
+    twr_tick_t tick_ready;
+    twr_tick_t tick_start;
+    twr_tick_t tick_end;
+    uint32_t duration;
+
+} _twr_boot_step_t;
+
+static struct
+{
+    _twr_boot_step_t step[TWR_BOOT_STEPS_MAX];
+    int count;
+    twr_scheduler_task_id_t task_id;
+    bool task_registered;
+
+} _twr_boot;
+
+static void _twr_boot_task(void *param);
+static void _twr_boot_run(_twr_boot_step_t *step);
+
+int twr_boot_register(const char *name, void (*step)(void *), void *param, int after, twr_tick_t delay)
+{
+    if ((_twr_boot.count == TWR_BOOT_STEPS_MAX) || (after >= _twr_boot.count))
+    {
+        return TWR_BOOT_STEP_NONE;
+    }
+
+    int id = _twr_boot.count++;
+
+    _twr_boot_step_t *s = &_twr_boot.step[id];
+
+    memset(s, 0, sizeof(*s));
+
+    s->name = name;
+    s->step = step;
+    s->param = param;
+    s->after = after;
+    s->delay = delay;
+    s->tick_ready = twr_tick_get() + delay;
+
+    if (!_twr_boot.task_registered)
+    {
+        twr_timer_init();
+
+        _twr_boot.task_id = twr_scheduler_register(_twr_boot_task, NULL, 0);
+
+        _twr_boot.task_registered = true;
+    }
+    else
+    {
+        twr_scheduler_plan_now(_twr_boot.task_id);
+    }
+
+    return id;
+}
+
+bool twr_boot_is_done(void)
+{
+    for (int i = 0; i < _twr_boot.count; i++)
+    {
+        if (!_twr_boot.step[i].done)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool twr_boot_get_timing(int id, twr_boot_timing_t *timing)
+{
+    if ((id < 0) || (id >= _twr_boot.count))
+    {
+        return false;
+    }
+
+    timing->name = _twr_boot.step[id].name;
+    timing->tick_start = _twr_boot.step[id].tick_start;
+    timing->duration = _twr_boot.step[id].duration;
+
+    return true;
+}
+
+void twr_boot_log(void)
+{
+    twr_tick_t tick_end = 0;
+
+    for (int i = 0; i < _twr_boot.count; i++)
+    {
+        _twr_boot_step_t *s = &_twr_boot.step[i];
+
+        if (s->done)
+        {
+            twr_log_info("twr_boot: %s at %lu ms took %lu us", s->name, (unsigned long) s->tick_start, (unsigned long) s->duration);
+
+            if (tick_end < s->tick_end)
+            {
+                tick_end = s->tick_end;
+            }
+        }
+        else
+        {
+            twr_log_info("twr_boot: %s waiting", s->name);
+        }
+    }
+
+    twr_log_info("twr_boot: done at %lu ms", (unsigned long) tick_end);
+}
+
+static void _twr_boot_task(void *param)
+{
+    (void) param;
+
+    twr_tick_t tick_next = TWR_TICK_INFINITY;
+
+    // Finished step may release its successors right away, so the pool is passed until nothing is ready
+    for (bool progress = true; progress; )
+    {
+        progress = false;
+
+        twr_tick_t tick_now = twr_tick_get();
+
+        tick_next = TWR_TICK_INFINITY;
+
+        for (int i = 0; i < _twr_boot.count; i++)
+        {
+            _twr_boot_step_t *s = &_twr_boot.step[i];
+
+            if (s->done || ((s->after != TWR_BOOT_STEP_NONE) && !_twr_boot.step[s->after].done))
+            {
+                continue;
+            }
+
+            if (s->after != TWR_BOOT_STEP_NONE)
+            {
+                s->tick_ready = _twr_boot.step[s->after].tick_end + s->delay;
+            }
+
+            if (s->tick_ready <= tick_now)
+            {
+                _twr_boot_run(s);
+
+                progress = true;
+            }
+            else if (tick_next > s->tick_ready)
+            {
+                tick_next = s->tick_ready;
+            }
+        }
+    }
+
+    twr_scheduler_plan_current_absolute(tick_next);
+}
+
+static void _twr_boot_run(_twr_boot_step_t *step)
+{
+    step->tick_start = twr_tick_get();
+
+    twr_timer_start();
+
+    uint16_t microseconds = twr_timer_get_microseconds();
+
+    step->step(step->param);
+
+    // Timer counter is 16-bit only, so long steps are taken from tick
+    step->duration = (uint16_t) (twr_timer_get_microseconds() - microseconds);
+
+    twr_timer_stop();
+
+    step->tick_end = twr_tick_get();
+
+    if (step->tick_end - step->tick_start >= _TWR_BOOT_TIMER_LIMIT_MS)
+    {
+        step->duration = (step->tick_end - step->tick_start) * 1000;
+    }
+
+    step->done = true;
+}
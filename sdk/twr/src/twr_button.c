@@ -1,4 +1,5 @@
 #include <twr_button.h>
+#include <twr_latency.h>
 
 #define _TWR_BUTTON_SCAN_INTERVAL 20
 #define _TWR_BUTTON_DEBOUNCE_TIME 50
@@ -7,6 +8,14 @@
 
 static void _twr_button_task(void *param);
 
+static int _twr_button_get_input(twr_button_t *self);
+
+static bool _twr_button_update(twr_button_t *self, int pin_state, twr_tick_t tick_now);
+
+static void _twr_button_group_task(void *param);
+
+static void _twr_button_exti_handler(twr_exti_line_t line, void *param);
+
 static void _twr_button_gpio_init(twr_button_t *self);
 
 static int _twr_button_gpio_get_input(twr_button_t *self);
@@ -63,12 +72,70 @@ void twr_button_init_virtual(twr_button_t *self, int channel, const twr_button_d
     self->_task_id = twr_scheduler_register(_twr_button_task, self, TWR_TICK_INFINITY);
 }
 
+bool twr_button_set_interrupt(twr_button_t *self, bool enable)
+{
+    static const twr_exti_line_t lut[] =
+    {
+        TWR_EXTI_LINE_P0,
+        TWR_EXTI_LINE_P1,
+        TWR_EXTI_LINE_P2,
+        TWR_EXTI_LINE_P3,
+        TWR_EXTI_LINE_P4,
+        TWR_EXTI_LINE_P5,
+        TWR_EXTI_LINE_P6,
+        TWR_EXTI_LINE_P7,
+        TWR_EXTI_LINE_P8,
+        TWR_EXTI_LINE_P9,
+        TWR_EXTI_LINE_P10,
+        TWR_EXTI_LINE_P11,
+        TWR_EXTI_LINE_P12,
+        TWR_EXTI_LINE_P13,
+        TWR_EXTI_LINE_P14,
+        TWR_EXTI_LINE_P15,
+        TWR_EXTI_LINE_P16,
+        TWR_EXTI_LINE_P17,
+        TWR_EXTI_LINE_PH1,
+        TWR_EXTI_LINE_BUTTON,
+        TWR_EXTI_LINE_PC13
+    };
+
+    if ((self->_driver != &_twr_button_driver_gpio) || ((size_t) self->_channel.gpio >= sizeof(lut) / sizeof(lut[0])))
+    {
+        return false;
+    }
+
+    if (enable == self->_interrupt)
+    {
+        return true;
+    }
+
+    self->_interrupt = enable;
+
+    if (enable)
+    {
+        twr_exti_register(lut[self->_channel.gpio], TWR_EXTI_EDGE_RISING_AND_FALLING, _twr_button_exti_handler, self);
+    }
+    else
+    {
+        twr_exti_unregister(lut[self->_channel.gpio]);
+    }
+
+    // Task settles the state and decides whether to scan
+    if (self->_event_handler != NULL)
+    {
+        twr_scheduler_plan_now(self->_task_id);
+    }
+
+    return true;
+}
+
 void twr_button_set_event_handler(twr_button_t *self, void (*event_handler)(twr_button_t *, twr_button_event_t, void *), void *event_param)
 {
     self->_event_handler = event_handler;
     self->_event_param = event_param;
 
-    if (event_handler == NULL)
+    // Task of group keeps scanning other buttons
+    if ((event_handler == NULL) && (self->_group == NULL))
     {
         self->_tick_debounce = TWR_TICK_INFINITY;
 
@@ -100,23 +167,125 @@ void twr_button_set_hold_time(twr_button_t *self, twr_tick_t hold_time)
     self->_hold_time = hold_time;
 }
 
+void twr_button_group_init(twr_button_group_t *self)
+{
+    memset(self, 0, sizeof(*self));
+
+    self->_scan_interval = _TWR_BUTTON_SCAN_INTERVAL;
+
+    self->_task_id = twr_scheduler_register(_twr_button_group_task, self, TWR_TICK_INFINITY);
+}
+
+bool twr_button_group_add(twr_button_group_t *self, twr_button_t *button)
+{
+    if ((self->_count == TWR_BUTTON_GROUP_SIZE) || (button->_group != NULL))
+    {
+        return false;
+    }
+
+    // Own task of button is replaced by the one of group, EXTI handler of button signals it from now
+    twr_scheduler_unregister(button->_task_id);
+
+    button->_group = self;
+    button->_task_id = self->_task_id;
+
+    self->_button[self->_count++] = button;
+
+    twr_scheduler_plan_now(self->_task_id);
+
+    return true;
+}
+
+void twr_button_group_set_scan_interval(twr_button_group_t *self, twr_tick_t scan_interval)
+{
+    self->_scan_interval = scan_interval;
+}
+
 static void _twr_button_task(void *param)
 {
     twr_button_t *self = param;
 
+    if (_twr_button_update(self, _twr_button_get_input(self), twr_scheduler_get_spin_tick()))
+    {
+        twr_scheduler_plan_current_absolute(TWR_TICK_INFINITY);
+
+        return;
+    }
+
+    twr_scheduler_plan_current_relative(self->_scan_interval);
+}
+
+static void _twr_button_group_task(void *param)
+{
+    twr_button_group_t *self = param;
+
     twr_tick_t tick_now = twr_scheduler_get_spin_tick();
 
-    int pin_state;
+    const twr_button_driver_t *driver[TWR_BUTTON_GROUP_SIZE];
+    uint32_t mask[TWR_BUTTON_GROUP_SIZE];
+    int driver_count = 0;
 
-    if (self->_driver->get_input != NULL)
+    bool dormant = true;
+
+    for (int i = 0; i < self->_count; i++)
+    {
+        twr_button_t *button = self->_button[i];
+
+        int pin_state;
+
+        if (button->_driver->get_input_mask != NULL)
+        {
+            int j = 0;
+
+            while ((j < driver_count) && (driver[j] != button->_driver))
+            {
+                j++;
+            }
+
+            // Driver is read for the first button using it
+            if (j == driver_count)
+            {
+                driver[j] = button->_driver;
+                mask[j] = button->_driver->get_input_mask(button);
+
+                driver_count++;
+            }
+
+            pin_state = (mask[j] >> button->_channel.virtual) & 1;
+        }
+        else
+        {
+            pin_state = _twr_button_get_input(button);
+        }
+
+        if (!_twr_button_update(button, pin_state, tick_now))
+        {
+            dormant = false;
+        }
+    }
+
+    if (dormant)
     {
-        pin_state = self->_driver->get_input(self);
+        twr_scheduler_plan_current_absolute(TWR_TICK_INFINITY);
+
+        return;
     }
-    else
+
+    twr_scheduler_plan_current_relative(self->_scan_interval);
+}
+
+static int _twr_button_get_input(twr_button_t *self)
+{
+    if (self->_driver->get_input != NULL)
     {
-        pin_state = self->_idle_state;
+        return self->_driver->get_input(self);
     }
 
+    return self->_idle_state;
+}
+
+static bool _twr_button_update(twr_button_t *self, int pin_state, twr_tick_t tick_now)
+{
     if (self->_idle_state)
     {
         pin_state = pin_state == 0 ? 1 : 0;
@@ -127,6 +296,9 @@ static void _twr_button_task(void *param)
         if (self->_tick_debounce == TWR_TICK_INFINITY)
         {
             self->_tick_debounce = tick_now + self->_debounce_time;
+
+            // Change found by scan, edge interrupt has stamped it already
+            twr_latency_source(TWR_LATENCY_PROBE_BUTTON);
         }
 
         if (tick_now >= self->_tick_debounce)
@@ -182,7 +354,19 @@ static void _twr_button_task(void *param)
         }
     }
 
-    twr_scheduler_plan_current_relative(self->_scan_interval);
+    // Input is stable and nothing is timed, next change comes with edge
+    return self->_interrupt && (self->_tick_debounce == TWR_TICK_INFINITY) && ((self->_state == 0) || self->_hold_signalized);
+}
+
+static void _twr_button_exti_handler(twr_exti_line_t line, void *param)
+{
+    (void) line;
+
+    twr_button_t *self = param;
+
+    twr_latency_source(TWR_LATENCY_PROBE_BUTTON);
+
+    twr_scheduler_signal(self->_task_id);
 }
 
 static void _twr_button_gpio_init(twr_button_t *self)
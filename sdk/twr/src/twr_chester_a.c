@@ -1,3 +1,5 @@
+#define TWR_LOG_MODULE TWR_LOG_MODULE_TOWER
+
 #include <twr_chester_a.h>
 #include <twr_log.h>
 
@@ -42,35 +44,23 @@ bool twr_chester_a_relay_set_state(twr_chester_a_t *self, twr_chester_a_relay_t
         return false;
     }
 
-    uint8_t port = self->tca9534a._output_port;
+    uint8_t mask;
 
     switch (relay)
     {
         case TWR_CHESTER_A_RELAY_1:
         {
-            if (state) {
-                port |= RELAY_1_MASK;
-            } else {
-                port &= ~RELAY_1_MASK;
-            }
+            mask = RELAY_1_MASK;
             break;
         }
         case TWR_CHESTER_A_RELAY_2:
         {
-            if (state) {
-                port |= RELAY_2_MASK;
-            } else {
-                port &= ~RELAY_2_MASK;
-            }
+            mask = RELAY_2_MASK;
             break;
         }
         case TWR_CHESTER_A_RELAY_BOTH:
         {
-            if (state) {
-                port |= RELAY_1_MASK | RELAY_2_MASK;
-            } else {
-                port &= ~(RELAY_1_MASK | RELAY_2_MASK);
-            }
+            mask = RELAY_1_MASK | RELAY_2_MASK;
             break;
         }
         default:
@@ -80,7 +70,7 @@ bool twr_chester_a_relay_set_state(twr_chester_a_t *self, twr_chester_a_relay_t
         }
     }
 
-    if (!twr_tca9534a_write_port(&self->tca9534a, port)) {
+    if (!twr_tca9534a_write_port_masked(&self->tca9534a, mask, state ? mask : 0)) {
         self->is_tca9534a_initialized = false;
         twr_log_error("CHESTER A: Expander write_port");
         return false;
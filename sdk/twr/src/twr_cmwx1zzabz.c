@@ -1,6 +1,11 @@
+#define TWR_LOG_MODULE TWR_LOG_MODULE_LORA
+
 #include <twr_cmwx1zzabz.h>
 #include <twr_log.h>
 #include <twr_timer.h>
+#include <twr_fmt.h>
+#include <twr_trace.h>
+#include <strings.h>
 
 /*
 
@@ -14,18 +19,9 @@ Supported Murata firmware versions
 
 #define TWR_CMWX1ZZABZ_DELAY_RUN 100
 #define TWR_CMWX1ZZABZ_DELAY_INITIALIZATION_RESET_H 100
-#define TWR_CMWX1ZZABZ_DELAY_INITIALIZATION_AT_COMMAND 100 // ! when using longer AT responses
-#define TWR_CMWX1ZZABZ_DELAY_CONFIG_SAVE 100
 #define TWR_CMWX1ZZABZ_DELAY_INITIALIZATION_REBOOT 500
 #define TWR_CMWX1ZZABZ_DELAY_INITIALIZATION_AT_RESPONSE 100
 #define TWR_CMWX1ZZABZ_DELAY_SEND_MESSAGE_RESPONSE 1500
-#define TWR_CMWX1ZZABZ_DELAY_JOIN_RESPONSE 500 //8000
-#define TWR_CMWX1ZZABZ_DELAY_LINK_CHECK_RESPONSE 4000
-#define TWR_CMWX1ZZABZ_DELAY_CUSTOM_COMMAND_RESPONSE 100
-
-#define TWR_CMWX1ZZABZ_TIMEOUT_CUSTOM_COMMAND_RESPONSE 500
-#define TWR_CMWX1ZZABZ_TIMEOUT_LNCHECK 20000
-#define TWR_CMWX1ZZABZ_TIMEOUT_JOIN 120000
 
 // Apply changes to the factory configuration
 const char *_init_commands[] =
@@ -60,6 +56,14 @@ static void _twr_cmwx1zzabz_task(void *param);
 
 static bool _twr_cmwx1zzabz_read_response(twr_cmwx1zzabz_t *self);
 
+static bool _twr_cmwx1zzabz_is_timeout(twr_cmwx1zzabz_t *self, twr_tick_t timeout);
+
+static bool _twr_cmwx1zzabz_is_cached(twr_cmwx1zzabz_t *self, twr_cmwx1zzabz_config_index_t config_index);
+
+static bool _twr_cmwx1zzabz_config_read(twr_cmwx1zzabz_t *self, twr_cmwx1zzabz_config_index_t config_index, bool equal);
+
+static bool _twr_cmwx1zzabz_is_rx2_equal(twr_cmwx1zzabz_t *self, const char *value);
+
 static void _twr_cmwx1zzabz_save_config(twr_cmwx1zzabz_t *self, twr_cmwx1zzabz_config_index_t config_index);
 
 static void _uart_event_handler(twr_uart_channel_t channel, twr_uart_event_t event, void *param);
@@ -110,10 +114,57 @@ static void _uart_event_handler(twr_uart_channel_t channel, twr_uart_event_t eve
     (void) channel;
     twr_cmwx1zzabz_t *self = (twr_cmwx1zzabz_t*)param;
 
-    if (event == TWR_UART_EVENT_ASYNC_READ_DATA && self->_state == TWR_CMWX1ZZABZ_STATE_IDLE)
+    if (event != TWR_UART_EVENT_ASYNC_READ_DATA)
     {
-        twr_scheduler_plan_relative(self->_task_id, 100);
-        self->_state = TWR_CMWX1ZZABZ_STATE_RECEIVE;
+        return;
+    }
+
+    switch (self->_state)
+    {
+        case TWR_CMWX1ZZABZ_STATE_IDLE:
+        {
+            twr_scheduler_plan_relative(self->_task_id, 100);
+            self->_state = TWR_CMWX1ZZABZ_STATE_RECEIVE;
+            break;
+        }
+        case TWR_CMWX1ZZABZ_STATE_INITIALIZE_COMMAND_RESPONSE:
+        {
+            // Modem is booting after reboot command, response is read after delay
+            if (strcmp(self->_command, "AT+REBOOT\r") != 0)
+            {
+                twr_scheduler_plan_now(self->_task_id);
+            }
+            break;
+        }
+        // Response is matched as soon as it arrives instead of after fixed delay
+        case TWR_CMWX1ZZABZ_STATE_CONFIG_SAVE_RESPONSE:
+        case TWR_CMWX1ZZABZ_STATE_JOIN_RESPONSE:
+        case TWR_CMWX1ZZABZ_STATE_CUSTOM_COMMAND_RESPONSE:
+        case TWR_CMWX1ZZABZ_STATE_LINK_CHECK_RESPONSE:
+        {
+            twr_scheduler_plan_now(self->_task_id);
+            break;
+        }
+        case TWR_CMWX1ZZABZ_STATE_READY:
+        case TWR_CMWX1ZZABZ_STATE_ERROR:
+        case TWR_CMWX1ZZABZ_STATE_INITIALIZE:
+        case TWR_CMWX1ZZABZ_STATE_INITIALIZE_AT_RESPONSE:
+        case TWR_CMWX1ZZABZ_STATE_INITIALIZE_COMMAND_SEND:
+        case TWR_CMWX1ZZABZ_STATE_CONFIG_SAVE_SEND:
+        case TWR_CMWX1ZZABZ_STATE_SEND_MESSAGE_COMMAND:
+        case TWR_CMWX1ZZABZ_STATE_SEND_MESSAGE_CONFIRMED_COMMAND:
+        case TWR_CMWX1ZZABZ_STATE_SEND_MESSAGE_RESPONSE:
+        case TWR_CMWX1ZZABZ_STATE_JOIN_SEND:
+        case TWR_CMWX1ZZABZ_STATE_CUSTOM_COMMAND_SEND:
+        case TWR_CMWX1ZZABZ_STATE_LINK_CHECK_SEND:
+        case TWR_CMWX1ZZABZ_STATE_LINK_CHECK_RESPONSE_ANS:
+        case TWR_CMWX1ZZABZ_STATE_RECEIVE:
+        case TWR_CMWX1ZZABZ_STATE_RECOVER_BAUDRATE_UART:
+        case TWR_CMWX1ZZABZ_STATE_RECOVER_BAUDRATE_REBOOT:
+        default:
+        {
+            break;
+        }
     }
 }
 
@@ -169,6 +220,20 @@ bool twr_cmwx1zzabz_send_message_confirmed(twr_cmwx1zzabz_t *self, const void *b
     return true;
 }
 
+bool twr_cmwx1zzabz_send_payload(twr_cmwx1zzabz_t *self, const twr_payload_schema_t *schema, const float *value, bool confirmed)
+{
+    uint8_t buffer[TWR_CMWX1ZZABZ_TX_MAX_PACKET_SIZE];
+
+    size_t length = twr_payload_pack(schema, value, buffer, sizeof(buffer));
+
+    if (confirmed)
+    {
+        return twr_cmwx1zzabz_send_message_confirmed(self, buffer, length);
+    }
+
+    return twr_cmwx1zzabz_send_message(self, buffer, length);
+}
+
 void twr_cmwx1zzabz_set_debug(twr_cmwx1zzabz_t *self, bool debug)
 {
     self->_debug = debug;
@@ -204,6 +269,8 @@ static void _twr_cmwx1zzabz_task(void *param)
 
     while (true)
     {
+        twr_trace_state(TWR_TRACE_DRIVER_CMWX1ZZABZ, self->_state);
+
         switch (self->_state)
         {
             case TWR_CMWX1ZZABZ_STATE_READY:
@@ -345,6 +412,7 @@ static void _twr_cmwx1zzabz_task(void *param)
             {
                 self->_state = TWR_CMWX1ZZABZ_STATE_ERROR;
                 self->_init_command_index = 0;
+                self->_config_cached = false;
 
                 twr_fifo_purge(&self->_rx_fifo);
                 twr_fifo_purge(&self->_tx_fifo);
@@ -475,7 +543,7 @@ static void _twr_cmwx1zzabz_task(void *param)
                 }
                 else
                 {
-                    twr_scheduler_plan_current_from_now(TWR_CMWX1ZZABZ_DELAY_INITIALIZATION_AT_COMMAND);
+                    twr_scheduler_plan_current_from_now(TWR_CMWX1ZZABZ_TIMEOUT_COMMAND_RESPONSE);
                 }
 
                 return;
@@ -484,10 +552,10 @@ static void _twr_cmwx1zzabz_task(void *param)
             {
                 if (!_twr_cmwx1zzabz_read_response(self))
                 {
-                    twr_scheduler_plan_current_from_now(20);
-                    if (twr_tick_get() > (self->_timeout + TWR_CMWX1ZZABZ_TIMEOUT_CUSTOM_COMMAND_RESPONSE))
+                    if (_twr_cmwx1zzabz_is_timeout(self, TWR_CMWX1ZZABZ_TIMEOUT_COMMAND_RESPONSE))
                     {
                         self->_state = TWR_CMWX1ZZABZ_STATE_ERROR;
+                        continue;
                     }
                     return;
                 }
@@ -505,7 +573,7 @@ static void _twr_cmwx1zzabz_task(void *param)
                 if (strcmp(last_command, "AT+DEVADDR?\r") == 0 && response_valid)
                 {
                     // Check if user did not filled this structure to save configuration, oterwise it would be overwritten
-                    if ((self->_save_config_mask & 1 << TWR_CMWX1ZZABZ_CONFIG_INDEX_DEVADDR) == 0)
+                    if (_twr_cmwx1zzabz_config_read(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_DEVADDR, strncasecmp(self->_config.devaddr, response_string_value, 8) == 0))
                     {
                         memcpy(self->_config.devaddr, response_string_value, 8);
                         self->_config.devaddr[8] = '\0';
@@ -514,7 +582,7 @@ static void _twr_cmwx1zzabz_task(void *param)
                 }
                 else if (strcmp(last_command, "AT+DEVEUI?\r") == 0 && response_valid)
                 {
-                    if ((self->_save_config_mask & 1 << TWR_CMWX1ZZABZ_CONFIG_INDEX_DEVEUI) == 0)
+                    if (_twr_cmwx1zzabz_config_read(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_DEVEUI, strncasecmp(self->_config.deveui, response_string_value, 16) == 0))
                     {
                         memcpy(self->_config.deveui, response_string_value, 16);
                         self->_config.deveui[16] = '\0';
@@ -523,7 +591,7 @@ static void _twr_cmwx1zzabz_task(void *param)
                 }
                 else if (strcmp(last_command, "AT+APPEUI?\r") == 0 && response_valid)
                 {
-                    if ((self->_save_config_mask & 1 << TWR_CMWX1ZZABZ_CONFIG_INDEX_APPEUI) == 0)
+                    if (_twr_cmwx1zzabz_config_read(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_APPEUI, strncasecmp(self->_config.appeui, response_string_value, 16) == 0))
                     {
                         memcpy(self->_config.appeui, response_string_value, 16);
                         self->_config.appeui[16] = '\0';
@@ -532,7 +600,7 @@ static void _twr_cmwx1zzabz_task(void *param)
                 }
                 else if (strcmp(last_command, "AT+NWKSKEY?\r") == 0 && response_valid)
                 {
-                    if ((self->_save_config_mask & 1 << TWR_CMWX1ZZABZ_CONFIG_INDEX_NWKSKEY) == 0)
+                    if (_twr_cmwx1zzabz_config_read(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_NWKSKEY, strncasecmp(self->_config.nwkskey, response_string_value, 32) == 0))
                     {
                         memcpy(self->_config.nwkskey, response_string_value, 32);
                         self->_config.nwkskey[32] = '\0';
@@ -541,7 +609,7 @@ static void _twr_cmwx1zzabz_task(void *param)
                 }
                 else if (strcmp(last_command, "AT+APPSKEY?\r") == 0 && response_valid)
                 {
-                    if ((self->_save_config_mask & 1 << TWR_CMWX1ZZABZ_CONFIG_INDEX_APPSKEY) == 0)
+                    if (_twr_cmwx1zzabz_config_read(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_APPSKEY, strncasecmp(self->_config.appskey, response_string_value, 32) == 0))
                     {
                         memcpy(self->_config.appskey, response_string_value, 32);
                         self->_config.appskey[32] = '\0';
@@ -550,7 +618,7 @@ static void _twr_cmwx1zzabz_task(void *param)
                 }
                 else if (strcmp(last_command, "AT+APPKEY?\r") == 0 && response_valid)
                 {
-                    if ((self->_save_config_mask & 1 << TWR_CMWX1ZZABZ_CONFIG_INDEX_APPKEY) == 0)
+                    if (_twr_cmwx1zzabz_config_read(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_APPKEY, strncasecmp(self->_config.appkey, response_string_value, 32) == 0))
                     {
                         memcpy(self->_config.appkey, response_string_value, 32);
                         self->_config.appkey[32] = '\0';
@@ -559,7 +627,7 @@ static void _twr_cmwx1zzabz_task(void *param)
                 }
                 else if (strcmp(last_command, "AT+BAND?\r") == 0 && response_valid)
                 {
-                    if ((self->_save_config_mask & 1 << TWR_CMWX1ZZABZ_CONFIG_INDEX_BAND) == 0)
+                    if (_twr_cmwx1zzabz_config_read(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_BAND, (int) self->_config.band == response_string_value[0] - '0'))
                     {
                         self->_config.band = response_string_value[0] - '0';
                     }
@@ -567,7 +635,7 @@ static void _twr_cmwx1zzabz_task(void *param)
                 }
                 else if (strcmp(last_command, "AT+MODE?\r") == 0 && response_valid)
                 {
-                    if ((self->_save_config_mask & 1 << TWR_CMWX1ZZABZ_CONFIG_INDEX_MODE) == 0)
+                    if (_twr_cmwx1zzabz_config_read(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_MODE, (int) self->_config.mode == response_string_value[0] - '0'))
                     {
                         self->_config.mode = response_string_value[0] - '0';
                     }
@@ -575,7 +643,7 @@ static void _twr_cmwx1zzabz_task(void *param)
                 }
                 else if (strcmp(last_command, "AT+CLASS?\r") == 0 && response_valid)
                 {
-                    if ((self->_save_config_mask & 1 << TWR_CMWX1ZZABZ_CONFIG_INDEX_CLASS) == 0)
+                    if (_twr_cmwx1zzabz_config_read(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_CLASS, (int) self->_config.class == response_string_value[0] - '0'))
                     {
                         self->_config.class = response_string_value[0] - '0';
                     }
@@ -583,7 +651,7 @@ static void _twr_cmwx1zzabz_task(void *param)
                 }
                 else if (strcmp(last_command, "AT+RX2?\r") == 0 && response_valid)
                 {
-                    if ((self->_save_config_mask & 1 << TWR_CMWX1ZZABZ_CONFIG_INDEX_RX2) == 0)
+                    if (_twr_cmwx1zzabz_config_read(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_RX2, _twr_cmwx1zzabz_is_rx2_equal(self, response_string_value)))
                     {
                         self->_config.rx2_frequency = atoi(response_string_value);
 
@@ -599,7 +667,7 @@ static void _twr_cmwx1zzabz_task(void *param)
                 }
                 else if (strcmp(last_command, "AT+NWK?\r") == 0 && response_valid)
                 {
-                    if ((self->_save_config_mask & 1 << TWR_CMWX1ZZABZ_CONFIG_INDEX_NWK) == 0)
+                    if (_twr_cmwx1zzabz_config_read(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_NWK, self->_config.nwk_public == response_string_value[0] - '0'))
                     {
                         self->_config.nwk_public = response_string_value[0] - '0';
                     }
@@ -607,7 +675,7 @@ static void _twr_cmwx1zzabz_task(void *param)
                 }
                 else if (strcmp(last_command, "AT+ADR?\r") == 0 && response_valid)
                 {
-                    if ((self->_save_config_mask & 1 << TWR_CMWX1ZZABZ_CONFIG_INDEX_ADAPTIVE_DATARATE) == 0)
+                    if (_twr_cmwx1zzabz_config_read(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_ADAPTIVE_DATARATE, self->_config.adaptive_datarate == (response_string_value[0] == '1')))
                     {
                         self->_config.adaptive_datarate = response_string_value[0] == '1';
                     }
@@ -615,7 +683,7 @@ static void _twr_cmwx1zzabz_task(void *param)
                 }
                 else if (strcmp(last_command, "AT+DR?\r") == 0 && response_valid)
                 {
-                    if ((self->_save_config_mask & 1 << TWR_CMWX1ZZABZ_CONFIG_INDEX_DATARATE) == 0)
+                    if (_twr_cmwx1zzabz_config_read(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_DATARATE, self->_config.datarate == atoi(response_string_value)))
                     {
                         self->_config.datarate = atoi(response_string_value);
                     }
@@ -623,7 +691,7 @@ static void _twr_cmwx1zzabz_task(void *param)
                 }
                 else if (strcmp(last_command, "AT+REP?\r") == 0 && response_valid)
                 {
-                    if ((self->_save_config_mask & 1 << TWR_CMWX1ZZABZ_CONFIG_INDEX_REP) == 0)
+                    if (_twr_cmwx1zzabz_config_read(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_REP, self->_config.repetition_unconfirmed == atoi(response_string_value)))
                     {
                         self->_config.repetition_unconfirmed = atoi(response_string_value);
                     }
@@ -631,7 +699,7 @@ static void _twr_cmwx1zzabz_task(void *param)
                 }
                 else if (strcmp(last_command, "AT+RTYNUM?\r") == 0 && response_valid)
                 {
-                    if ((self->_save_config_mask & 1 << TWR_CMWX1ZZABZ_CONFIG_INDEX_RTYNUM) == 0)
+                    if (_twr_cmwx1zzabz_config_read(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_RTYNUM, self->_config.repetition_confirmed == atoi(response_string_value)))
                     {
                         self->_config.repetition_confirmed = atoi(response_string_value);
                     }
@@ -690,6 +758,9 @@ static void _twr_cmwx1zzabz_task(void *param)
 
                 if (_init_commands[self->_init_command_index] == NULL)
                 {
+                    // Configuration matches modem from now on, setting of the same value sends no command
+                    self->_config_cached = true;
+
                     // If configuration was changed and flag set, save them
                     if (self->_save_config_mask)
                     {
@@ -713,11 +784,11 @@ static void _twr_cmwx1zzabz_task(void *param)
             {
                 if (self->_state == TWR_CMWX1ZZABZ_STATE_SEND_MESSAGE_CONFIRMED_COMMAND)
                 {
-                    snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+PCTX %d,%d\r", self->_tx_port, self->_message_length);
+                    twr_fmt_snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+PCTX %d,%d\r", self->_tx_port, (int) self->_message_length);
                 }
                 else
                 {
-                    snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+PUTX %d,%d\r", self->_tx_port, self->_message_length);
+                    twr_fmt_snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+PUTX %d,%d\r", self->_tx_port, (int) self->_message_length);
                 }
 
                 self->_state = TWR_CMWX1ZZABZ_STATE_ERROR;
@@ -806,77 +877,77 @@ static void _twr_cmwx1zzabz_task(void *param)
                 {
                     case TWR_CMWX1ZZABZ_CONFIG_INDEX_DEVADDR:
                     {
-                        snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+DEVADDR=%s\r", self->_config.devaddr);
+                        twr_fmt_snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+DEVADDR=%s\r", self->_config.devaddr);
                         break;
                     }
                     case TWR_CMWX1ZZABZ_CONFIG_INDEX_DEVEUI:
                     {
-                        snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+DEVEUI=%s\r", self->_config.deveui);
+                        twr_fmt_snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+DEVEUI=%s\r", self->_config.deveui);
                         break;
                     }
                     case TWR_CMWX1ZZABZ_CONFIG_INDEX_APPEUI:
                     {
-                        snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+APPEUI=%s\r", self->_config.appeui);
+                        twr_fmt_snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+APPEUI=%s\r", self->_config.appeui);
                         break;
                     }
                     case TWR_CMWX1ZZABZ_CONFIG_INDEX_NWKSKEY:
                     {
-                        snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+NWKSKEY=%s\r", self->_config.nwkskey);
+                        twr_fmt_snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+NWKSKEY=%s\r", self->_config.nwkskey);
                         break;
                     }
                     case TWR_CMWX1ZZABZ_CONFIG_INDEX_APPSKEY:
                     {
-                        snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+APPSKEY=%s\r", self->_config.appskey);
+                        twr_fmt_snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+APPSKEY=%s\r", self->_config.appskey);
                         break;
                     }
                     case TWR_CMWX1ZZABZ_CONFIG_INDEX_APPKEY:
                     {
-                        snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+APPKEY=%s\r", self->_config.appkey);
+                        twr_fmt_snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+APPKEY=%s\r", self->_config.appkey);
                         break;
                     }
                     case TWR_CMWX1ZZABZ_CONFIG_INDEX_BAND:
                     {
-                        snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+BAND=%d\r", self->_config.band);
+                        twr_fmt_snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+BAND=%d\r", self->_config.band);
                         break;
                     }
                     case TWR_CMWX1ZZABZ_CONFIG_INDEX_MODE:
                     {
-                        snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+MODE=%d\r", self->_config.mode);
+                        twr_fmt_snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+MODE=%d\r", self->_config.mode);
                         break;
                     }
                     case TWR_CMWX1ZZABZ_CONFIG_INDEX_CLASS:
                     {
-                        snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+CLASS=%d\r", self->_config.class);
+                        twr_fmt_snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+CLASS=%d\r", self->_config.class);
                         break;
                     }
                     case TWR_CMWX1ZZABZ_CONFIG_INDEX_RX2:
                     {
-                        snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+RX2=%d,%d\r", (int) self->_config.rx2_frequency, self->_config.rx2_datarate);
+                        twr_fmt_snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+RX2=%d,%d\r", (int) self->_config.rx2_frequency, self->_config.rx2_datarate);
                         break;
                     }
                     case TWR_CMWX1ZZABZ_CONFIG_INDEX_NWK:
                     {
-                        snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+NWK=%d\r", (int) self->_config.nwk_public);
+                        twr_fmt_snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+NWK=%d\r", (int) self->_config.nwk_public);
                         break;
                     }
                     case TWR_CMWX1ZZABZ_CONFIG_INDEX_ADAPTIVE_DATARATE:
                     {
-                        snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+ADR=%d\r", self->_config.adaptive_datarate ? 1 : 0);
+                        twr_fmt_snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+ADR=%d\r", self->_config.adaptive_datarate ? 1 : 0);
                         break;
                     }
                     case TWR_CMWX1ZZABZ_CONFIG_INDEX_DATARATE:
                     {
-                        snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+DR=%d\r", (int) self->_config.datarate);
+                        twr_fmt_snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+DR=%d\r", (int) self->_config.datarate);
                         break;
                     }
                     case TWR_CMWX1ZZABZ_CONFIG_INDEX_REP:
                     {
-                        snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+REP=%d\r", (int) self->_config.repetition_unconfirmed);
+                        twr_fmt_snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+REP=%d\r", (int) self->_config.repetition_unconfirmed);
                         break;
                     }
                     case TWR_CMWX1ZZABZ_CONFIG_INDEX_RTYNUM:
                     {
-                        snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+RTYNUM=%d\r", (int) self->_config.repetition_confirmed);
+                        twr_fmt_snprintf(self->_command, TWR_CMWX1ZZABZ_TX_FIFO_BUFFER_SIZE, "AT+RTYNUM=%d\r", (int) self->_config.repetition_confirmed);
                         break;
                     }
 
@@ -894,19 +965,25 @@ static void _twr_cmwx1zzabz_task(void *param)
                 }
 
                 self->_state = TWR_CMWX1ZZABZ_STATE_CONFIG_SAVE_RESPONSE;
-                twr_scheduler_plan_current_from_now(TWR_CMWX1ZZABZ_DELAY_CONFIG_SAVE);
+                self->_timeout = twr_tick_get();
+                twr_scheduler_plan_current_from_now(TWR_CMWX1ZZABZ_TIMEOUT_COMMAND_RESPONSE);
                 return;
             }
 
             case TWR_CMWX1ZZABZ_STATE_CONFIG_SAVE_RESPONSE:
             {
-                self->_state = TWR_CMWX1ZZABZ_STATE_ERROR;
-
                 if (!_twr_cmwx1zzabz_read_response(self))
                 {
-                    continue;
+                    if (_twr_cmwx1zzabz_is_timeout(self, TWR_CMWX1ZZABZ_TIMEOUT_COMMAND_RESPONSE))
+                    {
+                        self->_state = TWR_CMWX1ZZABZ_STATE_ERROR;
+                        continue;
+                    }
+                    return;
                 }
 
+                self->_state = TWR_CMWX1ZZABZ_STATE_ERROR;
+
                 // Jump to error state when response is not OK
                 if (memcmp(self->_response, "+OK", 3) != 0)
                 {
@@ -941,7 +1018,7 @@ static void _twr_cmwx1zzabz_task(void *param)
 
                 self->_state = TWR_CMWX1ZZABZ_STATE_JOIN_RESPONSE;
                 self->_timeout = twr_tick_get();
-                twr_scheduler_plan_current_from_now(TWR_CMWX1ZZABZ_DELAY_JOIN_RESPONSE);
+                twr_scheduler_plan_current_from_now(TWR_CMWX1ZZABZ_TIMEOUT_JOIN);
                 return;
             }
 
@@ -951,10 +1028,10 @@ static void _twr_cmwx1zzabz_task(void *param)
 
                 if (!_twr_cmwx1zzabz_read_response(self))
                 {
-                    twr_scheduler_plan_current_from_now(50);
-                    if (twr_tick_get() > (self->_timeout + TWR_CMWX1ZZABZ_TIMEOUT_JOIN))
+                    if (_twr_cmwx1zzabz_is_timeout(self, TWR_CMWX1ZZABZ_TIMEOUT_JOIN))
                     {
                         self->_state = TWR_CMWX1ZZABZ_STATE_ERROR;
+                        continue;
                     }
                     return;
                 }
@@ -1016,7 +1093,7 @@ static void _twr_cmwx1zzabz_task(void *param)
 
                 self->_state = TWR_CMWX1ZZABZ_STATE_LINK_CHECK_RESPONSE;
                 self->_timeout = twr_tick_get();
-                twr_scheduler_plan_current_from_now(TWR_CMWX1ZZABZ_DELAY_LINK_CHECK_RESPONSE);
+                twr_scheduler_plan_current_from_now(TWR_CMWX1ZZABZ_TIMEOUT_LNCHECK);
                 return;
             }
 
@@ -1024,10 +1101,10 @@ static void _twr_cmwx1zzabz_task(void *param)
             {
                 if (!_twr_cmwx1zzabz_read_response(self))
                 {
-                    twr_scheduler_plan_current_from_now(10);
-                    if (twr_tick_get() > (self->_timeout + TWR_CMWX1ZZABZ_TIMEOUT_LNCHECK))
+                    if (_twr_cmwx1zzabz_is_timeout(self, TWR_CMWX1ZZABZ_TIMEOUT_LNCHECK))
                     {
                         self->_state = TWR_CMWX1ZZABZ_STATE_ERROR;
+                        continue;
                     }
                     return;
                 }
@@ -1125,7 +1202,7 @@ static void _twr_cmwx1zzabz_task(void *param)
 
                 self->_state = TWR_CMWX1ZZABZ_STATE_CUSTOM_COMMAND_RESPONSE;
                 self->_timeout = twr_tick_get();
-                twr_scheduler_plan_current_from_now(TWR_CMWX1ZZABZ_DELAY_CUSTOM_COMMAND_RESPONSE);
+                twr_scheduler_plan_current_from_now(TWR_CMWX1ZZABZ_TIMEOUT_COMMAND_RESPONSE);
                 return;
             }
 
@@ -1133,8 +1210,7 @@ static void _twr_cmwx1zzabz_task(void *param)
             {
                 if (!_twr_cmwx1zzabz_read_response(self))
                 {
-                    twr_scheduler_plan_current_from_now(50);
-                    if (twr_tick_get() > (self->_timeout + TWR_CMWX1ZZABZ_TIMEOUT_CUSTOM_COMMAND_RESPONSE))
+                    if (_twr_cmwx1zzabz_is_timeout(self, TWR_CMWX1ZZABZ_TIMEOUT_COMMAND_RESPONSE))
                     {
                         self->_custom_command = false;
                         self->_state = TWR_CMWX1ZZABZ_STATE_ERROR;
@@ -1143,7 +1219,9 @@ static void _twr_cmwx1zzabz_task(void *param)
                         {
                             twr_scheduler_plan_current_from_now(1000);
                             self->_state = TWR_CMWX1ZZABZ_STATE_INITIALIZE;
+                            return;
                         }
+                        continue;
                     }
                     return;
                 }
@@ -1241,6 +1319,11 @@ uint8_t twr_cmwx1zzabz_get_port(twr_cmwx1zzabz_t *self)
 
 void twr_cmwx1zzabz_set_devaddr(twr_cmwx1zzabz_t *self, char *devaddr)
 {
+    if (_twr_cmwx1zzabz_is_cached(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_DEVADDR) && strncasecmp(self->_config.devaddr, devaddr, 8 + 1) == 0)
+    {
+        return;
+    }
+
     strncpy(self->_config.devaddr, devaddr, 8+1);
 
     _twr_cmwx1zzabz_save_config(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_DEVADDR);
@@ -1253,6 +1336,11 @@ void twr_cmwx1zzabz_get_devaddr(twr_cmwx1zzabz_t *self, char *devaddr)
 
 void twr_cmwx1zzabz_set_deveui(twr_cmwx1zzabz_t *self, char *deveui)
 {
+    if (_twr_cmwx1zzabz_is_cached(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_DEVEUI) && strncasecmp(self->_config.deveui, deveui, 16 + 1) == 0)
+    {
+        return;
+    }
+
     strncpy(self->_config.deveui, deveui, 16+1);
 
     _twr_cmwx1zzabz_save_config(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_DEVEUI);
@@ -1265,6 +1353,11 @@ void twr_cmwx1zzabz_get_deveui(twr_cmwx1zzabz_t *self, char *deveui)
 
 void twr_cmwx1zzabz_set_appeui(twr_cmwx1zzabz_t *self, char *appeui)
 {
+    if (_twr_cmwx1zzabz_is_cached(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_APPEUI) && strncasecmp(self->_config.appeui, appeui, 16 + 1) == 0)
+    {
+        return;
+    }
+
     strncpy(self->_config.appeui, appeui, 16+1);
 
     _twr_cmwx1zzabz_save_config(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_APPEUI);
@@ -1277,6 +1370,11 @@ void twr_cmwx1zzabz_get_appeui(twr_cmwx1zzabz_t *self, char *appeui)
 
 void twr_cmwx1zzabz_set_nwkskey(twr_cmwx1zzabz_t *self, char *nwkskey)
 {
+    if (_twr_cmwx1zzabz_is_cached(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_NWKSKEY) && strncasecmp(self->_config.nwkskey, nwkskey, 32) == 0)
+    {
+        return;
+    }
+
     strncpy(self->_config.nwkskey, nwkskey, 32);
 
     _twr_cmwx1zzabz_save_config(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_NWKSKEY);
@@ -1289,6 +1387,11 @@ void twr_cmwx1zzabz_get_nwkskey(twr_cmwx1zzabz_t *self, char *nwkskey)
 
 void twr_cmwx1zzabz_set_appskey(twr_cmwx1zzabz_t *self, char *appskey)
 {
+    if (_twr_cmwx1zzabz_is_cached(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_APPSKEY) && strncasecmp(self->_config.appskey, appskey, 32) == 0)
+    {
+        return;
+    }
+
     strncpy(self->_config.appskey, appskey, 32);
 
     _twr_cmwx1zzabz_save_config(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_APPSKEY);
@@ -1301,6 +1404,11 @@ void twr_cmwx1zzabz_get_appskey(twr_cmwx1zzabz_t *self, char *appskey)
 
 void twr_cmwx1zzabz_set_appkey(twr_cmwx1zzabz_t *self, char *appkey)
 {
+    if (_twr_cmwx1zzabz_is_cached(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_APPKEY) && strncasecmp(self->_config.appkey, appkey, 32 + 1) == 0)
+    {
+        return;
+    }
+
     strncpy(self->_config.appkey, appkey, 32+1);
 
     _twr_cmwx1zzabz_save_config(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_APPKEY);
@@ -1313,6 +1421,11 @@ void twr_cmwx1zzabz_get_appkey(twr_cmwx1zzabz_t *self, char *appkey)
 
 void twr_cmwx1zzabz_set_band(twr_cmwx1zzabz_t *self, twr_cmwx1zzabz_config_band_t band)
 {
+    if (_twr_cmwx1zzabz_is_cached(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_BAND) && self->_config.band == band)
+    {
+        return;
+    }
+
     self->_config.band = band;
 
     _twr_cmwx1zzabz_save_config(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_BAND);
@@ -1325,6 +1438,11 @@ twr_cmwx1zzabz_config_band_t twr_cmwx1zzabz_get_band(twr_cmwx1zzabz_t *self)
 
 void twr_cmwx1zzabz_set_mode(twr_cmwx1zzabz_t *self, twr_cmwx1zzabz_config_mode_t mode)
 {
+    if (_twr_cmwx1zzabz_is_cached(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_MODE) && self->_config.mode == mode)
+    {
+        return;
+    }
+
     self->_config.mode = mode;
 
     _twr_cmwx1zzabz_save_config(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_MODE);
@@ -1337,6 +1455,11 @@ twr_cmwx1zzabz_config_mode_t twr_cmwx1zzabz_get_mode(twr_cmwx1zzabz_t *self)
 
 void twr_cmwx1zzabz_set_class(twr_cmwx1zzabz_t *self, twr_cmwx1zzabz_config_class_t class)
 {
+    if (_twr_cmwx1zzabz_is_cached(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_CLASS) && self->_config.class == class)
+    {
+        return;
+    }
+
     self->_config.class = class;
 
     _twr_cmwx1zzabz_save_config(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_CLASS);
@@ -1371,6 +1494,11 @@ uint32_t twr_cmwx1zzabz_get_received_message_data(twr_cmwx1zzabz_t *self, uint8_
 
 void twr_cmwx1zzabz_set_rx2(twr_cmwx1zzabz_t *self, uint32_t frequency, uint8_t datarate)
 {
+    if (_twr_cmwx1zzabz_is_cached(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_RX2) && self->_config.rx2_frequency == frequency && self->_config.rx2_datarate == datarate)
+    {
+        return;
+    }
+
     self->_config.rx2_frequency = frequency;
 
     self->_config.rx2_datarate = datarate;
@@ -1386,6 +1514,11 @@ void twr_cmwx1zzabz_get_rx2(twr_cmwx1zzabz_t *self, uint32_t *frequency, uint8_t
 
 void twr_cmwx1zzabz_set_nwk_public(twr_cmwx1zzabz_t *self, uint8_t public)
 {
+    if (_twr_cmwx1zzabz_is_cached(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_NWK) && self->_config.nwk_public == public)
+    {
+        return;
+    }
+
     self->_config.nwk_public = public;
 
     _twr_cmwx1zzabz_save_config(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_NWK);
@@ -1398,6 +1531,11 @@ uint8_t twr_cmwx1zzabz_get_nwk_public(twr_cmwx1zzabz_t *self)
 
 void twr_cmwx1zzabz_set_adaptive_datarate(twr_cmwx1zzabz_t *self, bool enable)
 {
+    if (_twr_cmwx1zzabz_is_cached(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_ADAPTIVE_DATARATE) && self->_config.adaptive_datarate == enable)
+    {
+        return;
+    }
+
     self->_config.adaptive_datarate = enable;
 
     _twr_cmwx1zzabz_save_config(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_ADAPTIVE_DATARATE);
@@ -1410,6 +1548,11 @@ bool twr_cmwx1zzabz_get_adaptive_datarate(twr_cmwx1zzabz_t *self)
 
 void twr_cmwx1zzabz_set_datarate(twr_cmwx1zzabz_t *self, uint8_t datarate)
 {
+    if (_twr_cmwx1zzabz_is_cached(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_DATARATE) && self->_config.datarate == datarate)
+    {
+        return;
+    }
+
     self->_config.datarate = datarate;
 
     _twr_cmwx1zzabz_save_config(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_DATARATE);
@@ -1422,6 +1565,11 @@ uint8_t twr_cmwx1zzabz_get_datarate(twr_cmwx1zzabz_t *self)
 
 void twr_cmwx1zzabz_set_repeat_unconfirmed(twr_cmwx1zzabz_t *self, uint8_t repeat)
 {
+    if (_twr_cmwx1zzabz_is_cached(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_REP) && self->_config.repetition_unconfirmed == repeat)
+    {
+        return;
+    }
+
     self->_config.repetition_unconfirmed = repeat;
 
     _twr_cmwx1zzabz_save_config(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_REP);
@@ -1434,6 +1582,11 @@ uint8_t twr_cmwx1zzabz_get_repeat_unconfirmed(twr_cmwx1zzabz_t *self)
 
 void twr_cmwx1zzabz_set_repeat_confirmed(twr_cmwx1zzabz_t *self, uint8_t repeat)
 {
+    if (_twr_cmwx1zzabz_is_cached(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_RTYNUM) && self->_config.repetition_confirmed == repeat)
+    {
+        return;
+    }
+
     self->_config.repetition_confirmed = repeat;
 
     _twr_cmwx1zzabz_save_config(self, TWR_CMWX1ZZABZ_CONFIG_INDEX_RTYNUM);
@@ -1462,7 +1615,7 @@ bool twr_cmwx1zzabz_custom_at(twr_cmwx1zzabz_t *self, char *at_command)
     }
 
     self->_custom_command = true;
-    snprintf(self->_custom_command_buf, sizeof(self->_custom_command_buf), "%s\r", at_command);
+    twr_fmt_snprintf(self->_custom_command_buf, sizeof(self->_custom_command_buf), "%s\r", at_command);
 
     twr_scheduler_plan_now(self->_task_id);
 
@@ -1614,3 +1767,51 @@ static void _twr_cmwx1zzabz_save_config(twr_cmwx1zzabz_t *self, twr_cmwx1zzabz_c
         twr_scheduler_plan_now(self->_task_id);
     }
 }
+
+static bool _twr_cmwx1zzabz_is_timeout(twr_cmwx1zzabz_t *self, twr_tick_t timeout)
+{
+    twr_tick_t deadline = self->_timeout + timeout;
+
+    if (twr_tick_get() >= deadline)
+    {
+        return true;
+    }
+
+    // Task is planned earlier by UART event when rest of response arrives
+    twr_scheduler_plan_current_absolute(deadline);
+
+    return false;
+}
+
+static bool _twr_cmwx1zzabz_is_cached(twr_cmwx1zzabz_t *self, twr_cmwx1zzabz_config_index_t config_index)
+{
+    return self->_config_cached && (self->_save_config_mask & 1 << config_index) == 0;
+}
+
+static bool _twr_cmwx1zzabz_config_read(twr_cmwx1zzabz_t *self, twr_cmwx1zzabz_config_index_t config_index, bool equal)
+{
+    if ((self->_save_config_mask & 1 << config_index) == 0)
+    {
+        return true;
+    }
+
+    // Modem holds the value to be saved already
+    if (equal)
+    {
+        self->_save_config_mask &= ~(1 << config_index);
+    }
+
+    return false;
+}
+
+static bool _twr_cmwx1zzabz_is_rx2_equal(twr_cmwx1zzabz_t *self, const char *value)
+{
+    char *comma_search = strchr(value, ',');
+
+    if (!comma_search)
+    {
+        return false;
+    }
+
+    return self->_config.rx2_frequency == (uint32_t) atoi(value) && self->_config.rx2_datarate == atoi(++comma_search);
+}
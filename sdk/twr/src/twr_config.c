@@ -1,6 +1,7 @@
 
 #include <twr_config.h>
 #include <twr_sha256.h>
+#include <twr_crc.h>
 #include <twr_eeprom.h>
 
 #define _CONFIG_SIZEOF_HEADER sizeof(config_header_t)
@@ -9,12 +10,20 @@
 #define _CONFIG_ADDRESS_HEADER 0
 #define _CONFIG_ADDRESS_CONFIG (_CONFIG_ADDRESS_HEADER + _CONFIG_SIZEOF_HEADER)
 
+#define _CONFIG_SIZEOF_SLOT (3 * (_CONFIG_SIZEOF_HEADER + _twr_config.size))
+
+#define _CONFIG_READ_BLOCK_WORDS 16
+
 typedef struct
 {
     uint32_t signature;
     void *config;
     size_t size;
     void *init_config;
+    uint32_t offset;
+    uint8_t sequence;
+    uint8_t hash[6];
+    bool valid;
 
 } twr_config_t;
 
@@ -33,6 +42,8 @@ typedef struct
 
 #pragma pack(pop)
 
+static void _config_hash(uint8_t *hash);
+static bool _config_load_slot(config_header_t *header);
 static void _config_eeprom_read(uint32_t address, void *buffer, size_t length);
 static void _config_eeprom_write(uint32_t address, const void *buffer, size_t length);
 
@@ -65,81 +76,183 @@ void twr_config_reset(void)
 
 bool twr_config_load(void)
 {
-    config_header_t header;
+    int slot = -1;
 
-    _config_eeprom_read(_CONFIG_ADDRESS_HEADER, &header, _CONFIG_SIZEOF_HEADER);
+    _twr_config.valid = false;
 
-    if (header.signature != _twr_config.signature ||
-        header.length != _twr_config.size)
+    for (int i = 0; i < TWR_CONFIG_SLOTS; i++)
     {
-        return false;
-    }
+        config_header_t header;
 
-    _config_eeprom_read(_CONFIG_ADDRESS_CONFIG, _twr_config.config, _twr_config.size);
+        _twr_config.offset = i * _CONFIG_SIZEOF_SLOT;
 
-    static twr_sha256_t sha256;
-    static uint8_t hash[32];
+        if (!_config_load_slot(&header))
+        {
+            continue;
+        }
 
-    twr_sha256_init(&sha256);
-    twr_sha256_update(&sha256, _twr_config.config, _twr_config.size);
-    twr_sha256_final(&sha256, hash, false);
+        // Sequence number wraps around, slots in rotation differ less than half of its range
+        if ((slot < 0) || ((int8_t) (header.version - _twr_config.sequence) > 0))
+        {
+            slot = i;
 
-    if (memcmp(header.hash, hash, sizeof(header.hash)) != 0)
+            _twr_config.sequence = header.version;
+        }
+    }
+
+    if (slot < 0)
     {
+        _twr_config.offset = 0;
+
         return false;
     }
 
+    _twr_config.offset = slot * _CONFIG_SIZEOF_SLOT;
+
+    // Configuration buffer holds content of the last slot read
+    if (slot != TWR_CONFIG_SLOTS - 1)
+    {
+        config_header_t header;
+
+        if (!_config_load_slot(&header))
+        {
+            return false;
+        }
+    }
+
+    _twr_config.valid = true;
+
     return true;
 }
 
 bool twr_config_save(void)
 {
-    static twr_sha256_t sha256;
-    static uint8_t hash[32];
+    uint8_t hash[sizeof(_twr_config.hash)];
 
-    twr_sha256_init(&sha256);
-    twr_sha256_update(&sha256, _twr_config.config, _twr_config.size);
-    twr_sha256_final(&sha256, hash, false);
+    _config_hash(hash);
+
+#if TWR_CONFIG_SLOTS > 1
+    // Unchanged configuration does not cost another slot
+    if (_twr_config.valid && (memcmp(_twr_config.hash, hash, sizeof(_twr_config.hash)) == 0))
+    {
+        return true;
+    }
+
+    if (_twr_config.valid)
+    {
+        _twr_config.offset = (_twr_config.offset + _CONFIG_SIZEOF_SLOT) % (TWR_CONFIG_SLOTS * _CONFIG_SIZEOF_SLOT);
+    }
+#endif
 
     config_header_t header;
 
     header.signature = _twr_config.signature;
+    header.version = ++_twr_config.sequence;
     header.length = _twr_config.size;
 
     memcpy(header.hash, hash, sizeof(header.hash));
 
+    // Words which did not change are not programmed by twr_eeprom_write
     _config_eeprom_write(_CONFIG_ADDRESS_HEADER, &header, _CONFIG_SIZEOF_HEADER);
     _config_eeprom_write(_CONFIG_ADDRESS_CONFIG, _twr_config.config, _twr_config.size);
 
+    memcpy(_twr_config.hash, hash, sizeof(_twr_config.hash));
+
+    _twr_config.valid = true;
+
     return true;
 }
 
+static bool _config_load_slot(config_header_t *header)
+{
+    _config_eeprom_read(_CONFIG_ADDRESS_HEADER, header, _CONFIG_SIZEOF_HEADER);
+
+    if (header->signature != _twr_config.signature ||
+        header->length != _twr_config.size)
+    {
+        return false;
+    }
+
+    _config_eeprom_read(_CONFIG_ADDRESS_CONFIG, _twr_config.config, _twr_config.size);
+
+    uint8_t hash[sizeof(_twr_config.hash)];
+
+    _config_hash(hash);
+
+    if (memcmp(header->hash, hash, sizeof(header->hash)) != 0)
+    {
+        return false;
+    }
+
+    memcpy(_twr_config.hash, hash, sizeof(_twr_config.hash));
+
+    return true;
+}
+
+static void _config_hash(uint8_t *hash)
+{
+#if TWR_CONFIG_INTEGRITY == TWR_CONFIG_INTEGRITY_CRC32
+    uint32_t crc = twr_crc32(_twr_config.config, _twr_config.size);
+
+    // Remaining bytes of header field mark slot checked by CRC32
+    hash[0] = crc;
+    hash[1] = crc >> 8;
+    hash[2] = crc >> 16;
+    hash[3] = crc >> 24;
+    hash[4] = 'C';
+    hash[5] = '3';
+#else
+    static twr_sha256_t sha256;
+    static uint8_t digest[32];
+
+    twr_sha256_init(&sha256);
+    twr_sha256_update(&sha256, _twr_config.config, _twr_config.size);
+    twr_sha256_final(&sha256, digest, false);
+
+    memcpy(hash, digest, sizeof(_twr_config.hash));
+#endif
+}
+
 static void _config_eeprom_read(uint32_t address, void *buffer, size_t length)
 {
     uint8_t *p = buffer;
 
-    for (size_t i = 0; i < length; i++)
-    {
-        uint8_t a, b, c;
+    uint32_t offset_bank_a = _twr_config.offset;
+    uint32_t offset_bank_b = offset_bank_a + _CONFIG_SIZEOF_HEADER + _twr_config.size;
+    uint32_t offset_bank_c = offset_bank_b + _CONFIG_SIZEOF_HEADER + _twr_config.size;
 
-        uint32_t offset_bank_a = 0;
-        uint32_t offset_bank_b = offset_bank_a + _CONFIG_SIZEOF_HEADER + _twr_config.size;
-        uint32_t offset_bank_c = offset_bank_b + _CONFIG_SIZEOF_HEADER + _twr_config.size;
+    // Banks are read by blocks and voted word by word
+    uint32_t a[_CONFIG_READ_BLOCK_WORDS];
+    uint32_t b[_CONFIG_READ_BLOCK_WORDS];
+    uint32_t c[_CONFIG_READ_BLOCK_WORDS];
+
+    while (length > 0)
+    {
+        size_t block = length < sizeof(a) ? length : sizeof(a);
 
-        if (!twr_eeprom_read(offset_bank_a + address + i, &a, 1) ||
-            !twr_eeprom_read(offset_bank_b + address + i, &b, 1) ||
-            !twr_eeprom_read(offset_bank_c + address + i, &c, 1))
+        if (!twr_eeprom_read(offset_bank_a + address, a, block) ||
+            !twr_eeprom_read(offset_bank_b + address, b, block) ||
+            !twr_eeprom_read(offset_bank_c + address, c, block))
         {
             //app_error(APP_ERROR);
         }
 
-        *p++ = (a & b) | (a & c) | (b & c);
+        for (size_t i = 0; i < (block + 3) / 4; i++)
+        {
+            a[i] = (a[i] & b[i]) | (a[i] & c[i]) | (b[i] & c[i]);
+        }
+
+        memcpy(p, a, block);
+
+        p += block;
+        address += block;
+        length -= block;
     }
 }
 
 static void _config_eeprom_write(uint32_t address, const void *buffer, size_t length)
 {
-    uint32_t offset_bank_a = 0;
+    uint32_t offset_bank_a = _twr_config.offset;
     uint32_t offset_bank_b = offset_bank_a + _CONFIG_SIZEOF_HEADER + _twr_config.size;
     uint32_t offset_bank_c = offset_bank_b + _CONFIG_SIZEOF_HEADER + _twr_config.size;
 
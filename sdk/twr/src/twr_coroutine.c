@@ -0,0 +1,55 @@
+#include <twr_coroutine.h>
+
+static void _twr_coroutine_i2c_event_handler(twr_i2c_channel_t channel, twr_i2c_event_t event, void *event_param);
+
+bool _twr_coroutine_i2c_submit(twr_coroutine_t *co, twr_i2c_channel_t channel, twr_i2c_async_t *transaction)
+{
+    co->_pending = true;
+    co->_result = false;
+    co->_task_id = twr_scheduler_get_current_task_id();
+
+    transaction->event_handler = _twr_coroutine_i2c_event_handler;
+    transaction->event_param = co;
+
+    if (channel != TWR_I2C_I2C_1W)
+    {
+        if (twr_i2c_async_submit(channel, transaction))
+        {
+            return true;
+        }
+
+        co->_pending = false;
+
+        return false;
+    }
+
+    co->_pending = false;
+
+    // Channel without asynchronous transactions is transferred blocking
+    if (transaction->type == TWR_I2C_ASYNC_WRITE || transaction->type == TWR_I2C_ASYNC_READ)
+    {
+        twr_i2c_transfer_t transfer = { transaction->device_address, transaction->buffer, transaction->length };
+
+        co->_result = transaction->type == TWR_I2C_ASYNC_WRITE ? twr_i2c_write(channel, &transfer) : twr_i2c_read(channel, &transfer);
+    }
+    else
+    {
+        twr_i2c_memory_transfer_t transfer = { transaction->device_address, transaction->memory_address, transaction->buffer, transaction->length };
+
+        co->_result = transaction->type == TWR_I2C_ASYNC_MEMORY_WRITE ? twr_i2c_memory_write(channel, &transfer) : twr_i2c_memory_read(channel, &transfer);
+    }
+
+    return false;
+}
+
+static void _twr_coroutine_i2c_event_handler(twr_i2c_channel_t channel, twr_i2c_event_t event, void *event_param)
+{
+    (void) channel;
+
+    twr_coroutine_t *co = event_param;
+
+    co->_pending = false;
+    co->_result = event == TWR_I2C_EVENT_ASYNC_DONE;
+
+    twr_scheduler_plan_now(co->_task_id);
+}
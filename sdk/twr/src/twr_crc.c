@@ -1,20 +1,201 @@
 #include <twr_crc.h>
+#include <stm32l0xx.h>
+
+#if TWR_CRC_HARDWARE
+
+static void _twr_crc_begin(uint32_t polysize, uint32_t polynomial, uint32_t initialization, uint32_t reverse);
+static void _twr_crc_feed(const void *buffer, size_t length);
+static inline void _twr_crc_end(void);
 
 uint8_t twr_crc8(const uint8_t polynomial, const void *buffer, size_t length, const uint8_t initialization)
 {
+    _twr_crc_begin(CRC_CR_POLYSIZE_1, polynomial, initialization, 0);
+
+    _twr_crc_feed(buffer, length);
+
+    uint8_t crc = CRC->DR;
+
+    _twr_crc_end();
+
+    return crc;
+}
+
+uint16_t twr_crc16(const uint16_t polynomial, const void *buffer, size_t length, const uint16_t initialization)
+{
+    _twr_crc_begin(CRC_CR_POLYSIZE_0, polynomial, initialization, 0);
+
+    _twr_crc_feed(buffer, length);
+
+    uint16_t crc = CRC->DR;
+
+    _twr_crc_end();
+
+    return crc;
+}
+
+uint32_t twr_crc32(const void *buffer, size_t length)
+{
+    // Input reversed by byte and output reversed gives the reflected algorithm
+    _twr_crc_begin(0, 0x04c11db7, 0xffffffff, CRC_CR_REV_IN_0 | CRC_CR_REV_OUT);
+
+    _twr_crc_feed(buffer, length);
+
+    uint32_t crc = CRC->DR ^ 0xffffffff;
+
+    _twr_crc_end();
+
+    return crc;
+}
+
+uint16_t twr_crc16_modbus(const void *buffer, size_t length)
+{
+    _twr_crc_begin(CRC_CR_POLYSIZE_0, 0x8005, 0xffff, CRC_CR_REV_IN_0 | CRC_CR_REV_OUT);
+
+    _twr_crc_feed(buffer, length);
+
+    uint16_t crc = CRC->DR;
+
+    _twr_crc_end();
+
+    return crc;
+}
+
+static void _twr_crc_begin(uint32_t polysize, uint32_t polynomial, uint32_t initialization, uint32_t reverse)
+{
+    // Enable CRC clock
+    RCC->AHBENR |= RCC_AHBENR_CRCEN;
+
+    // Errata workaround
+    RCC->AHBENR;
+
+    CRC->POL = polynomial;
+    CRC->INIT = initialization;
+
+    // Reset loads initialization value
+    CRC->CR = polysize | reverse | CRC_CR_RESET;
+}
+
+static void _twr_crc_feed(const void *buffer, size_t length)
+{
+    const uint8_t *p = buffer;
+
+    while (length--)
+    {
+        *(__IO uint8_t *) &CRC->DR = *p++;
+    }
+}
+
+static inline void _twr_crc_end(void)
+{
+    // Disable CRC clock
+    RCC->AHBENR &= ~RCC_AHBENR_CRCEN;
+}
+
+#else
+
+// Remainders of every nibble for reflected CRC32 polynomial 0xedb88320
+static const uint32_t _twr_crc32_table[16] =
+{
+    0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+    0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c
+};
+
+// Remainders of every nibble for reflected CRC16 polynomial 0xa001
+static const uint16_t _twr_crc16_modbus_table[16] =
+{
+    0x0000, 0xcc01, 0xd801, 0x1400, 0xf001, 0x3c00, 0x2800, 0xe401,
+    0xa001, 0x6c00, 0x7800, 0xb401, 0x5000, 0x9c01, 0x8801, 0x4400
+};
+
+uint8_t twr_crc8(const uint8_t polynomial, const void *buffer, size_t length, const uint8_t initialization)
+{
+    uint8_t table[16];
     uint8_t crc = initialization;
-    uint8_t *_buffer = (uint8_t *) buffer;
+    const uint8_t *_buffer = buffer;
+
+    // Remainders of every high nibble, cheaper than shifting bit by bit for more than a few bytes
+    for (int i = 0; i < 16; i++)
+    {
+        uint8_t remainder = i << 4;
+
+        for (int j = 0; j < 4; j++)
+        {
+            remainder = (remainder & 0x80) ? (remainder << 1) ^ polynomial : (remainder << 1);
+        }
+
+        table[i] = remainder;
+    }
 
     while (length--)
     {
         crc ^= *_buffer++;
 
-        for ( int i = 8; i; --i )
+        crc = (crc << 4) ^ table[crc >> 4];
+        crc = (crc << 4) ^ table[crc >> 4];
+    }
+
+    return crc;
+}
+
+uint16_t twr_crc16(const uint16_t polynomial, const void *buffer, size_t length, const uint16_t initialization)
+{
+    uint16_t table[16];
+    uint16_t crc = initialization;
+    const uint8_t *_buffer = buffer;
+
+    for (int i = 0; i < 16; i++)
+    {
+        uint16_t remainder = i << 12;
+
+        for (int j = 0; j < 4; j++)
         {
-            crc = ( crc & 0x80 )
-            ? (crc << 1) ^ polynomial
-            : (crc << 1);
+            remainder = (remainder & 0x8000) ? (remainder << 1) ^ polynomial : (remainder << 1);
         }
+
+        table[i] = remainder;
+    }
+
+    while (length--)
+    {
+        crc ^= *_buffer++ << 8;
+
+        crc = (crc << 4) ^ table[crc >> 12];
+        crc = (crc << 4) ^ table[crc >> 12];
     }
+
     return crc;
 }
+
+uint32_t twr_crc32(const void *buffer, size_t length)
+{
+    uint32_t crc = 0xffffffff;
+    const uint8_t *_buffer = buffer;
+
+    while (length--)
+    {
+        crc ^= *_buffer++;
+
+        crc = (crc >> 4) ^ _twr_crc32_table[crc & 0x0f];
+        crc = (crc >> 4) ^ _twr_crc32_table[crc & 0x0f];
+    }
+
+    return crc ^ 0xffffffff;
+}
+
+uint16_t twr_crc16_modbus(const void *buffer, size_t length)
+{
+    uint16_t crc = 0xffff;
+    const uint8_t *_buffer = buffer;
+
+    while (length--)
+    {
+        crc ^= *_buffer++;
+
+        crc = (crc >> 4) ^ _twr_crc16_modbus_table[crc & 0x0f];
+        crc = (crc >> 4) ^ _twr_crc16_modbus_table[crc & 0x0f];
+    }
+
+    return crc;
+}
+
+#endif
@@ -4,6 +4,10 @@
 #define _TWR_CY8CMBR3102_SCAN_INTERVAL 100
 #define _TWR_CY8CMBR3102_SCAN_INTERVAL_IS_TOUCH 1000
 
+// BUTTON_STAT, LATCHED_BUTTON_STAT, PROX_STAT and LATCHED_PROX_STAT follow each other
+#define _TWR_CY8CMBR3102_REG_BUTTON_STAT 0xaa
+#define _TWR_CY8CMBR3102_STATUS_LENGTH 6
+
 static const uint8_t _twr_cy8cmbr3102_default_setting[] = {
     0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x32, 0x7F, 0x00, 0x00,
@@ -24,6 +28,7 @@ static const uint8_t _twr_cy8cmbr3102_default_setting[] = {
 };
 
 static void _twr_cy8cmbr3102_task(void *param);
+static void _twr_cy8cmbr3102_exti_handler(twr_exti_line_t line, void *param);
 
 bool twr_cy8cmbr3102_init(twr_cy8cmbr3102_t *self, twr_i2c_channel_t i2c_channel, uint8_t i2c_address)
 {
@@ -54,6 +59,47 @@ void twr_cy8cmbr3102_set_scan_interval(twr_cy8cmbr3102_t *self, twr_tick_t scan_
     twr_scheduler_plan_absolute(self->_task_id_task, _TWR_CY8CMBR3102_START_INTERVAL < twr_tick_get() ? _TWR_CY8CMBR3102_START_INTERVAL: 0);
 }
 
+void twr_cy8cmbr3102_set_wake_on_event(twr_cy8cmbr3102_t *self, twr_exti_line_t line)
+{
+    if (self->_wake_on_event)
+    {
+        return;
+    }
+
+    self->_wake_on_event = true;
+
+    // Callback plans task only in read state
+    twr_exti_register_deferred(line, TWR_EXTI_EDGE_FALLING, _twr_cy8cmbr3102_exti_handler, self);
+}
+
+bool twr_cy8cmbr3102_read_status(twr_cy8cmbr3102_t *self, twr_cy8cmbr3102_status_t *status)
+{
+    uint8_t buffer[_TWR_CY8CMBR3102_STATUS_LENGTH];
+
+    twr_i2c_memory_transfer_t transfer;
+    transfer.device_address = self->_i2c_address;
+    transfer.memory_address = _TWR_CY8CMBR3102_REG_BUTTON_STAT;
+    transfer.buffer = buffer;
+    transfer.length = sizeof(buffer);
+
+    if (!twr_i2c_memory_read(self->_i2c_channel, &transfer))
+    {
+        return false;
+    }
+
+    status->button = buffer[0] | buffer[1] << 8;
+    status->latched_button = buffer[2] | buffer[3] << 8;
+    status->proximity = buffer[4];
+    status->latched_proximity = buffer[5];
+
+    return true;
+}
+
+void twr_cy8cmbr3102_get_status(twr_cy8cmbr3102_t *self, twr_cy8cmbr3102_status_t *status)
+{
+    *status = self->_status;
+}
+
 bool twr_cy8cmbr3102_get_proximity(twr_cy8cmbr3102_t *self, uint16_t value)
 {
     return twr_i2c_memory_read_16b(self->_i2c_channel, self->_i2c_address, 0xba, &value);
@@ -156,6 +202,38 @@ static void _twr_cy8cmbr3102_task(void *param)
         }
         case TWR_CY8CMBR3102_STATE_READ:
         {
+            if (self->_wake_on_event)
+            {
+                if (!twr_cy8cmbr3102_read_status(self, &self->_status))
+                {
+                    if (self->_error_cnt++ < 2)
+                    {
+                        twr_scheduler_plan_current_from_now(5);
+
+                        return;
+                    }
+
+                    self->_error_cnt = 0;
+
+                    self->_state = TWR_CY8CMBR3102_STATE_ERROR;
+
+                    goto start;
+                }
+
+                self->_error_cnt = 0;
+
+                // Touch released before this read is kept by latched status
+                if (((self->_status.proximity | self->_status.latched_proximity) & 0x01) != 0)
+                {
+                    if (self->_event_handler != NULL)
+                    {
+                        self->_event_handler(self, TWR_CY8CMBR3102_EVENT_TOUCH, self->_event_param);
+                    }
+                }
+
+                return;
+            }
+
             bool is_touch;
 
             if (!twr_cy8cmbr3102_is_touch(self, &is_touch))
@@ -199,3 +277,15 @@ static void _twr_cy8cmbr3102_task(void *param)
     }
 }
 
+static void _twr_cy8cmbr3102_exti_handler(twr_exti_line_t line, void *param)
+{
+    (void) line;
+
+    twr_cy8cmbr3102_t *self = param;
+
+    if (self->_state == TWR_CY8CMBR3102_STATE_READ)
+    {
+        twr_scheduler_plan_now(self->_task_id_task);
+    }
+}
+
@@ -6,6 +6,11 @@
 // Approximate voltage to code constant
 #define _TWR_DAC_VOLTAGE_TO_CODE_CONSTANT 19961
 
+// Clock of time-base timer with PLL enabled
+#define _TWR_DAC_TIMER_CLOCK 32000000UL
+
+#define _TWR_DAC_SAMPLE_RATE_MAX 1000000UL
+
 typedef struct
 {
     bool is_initialized;
@@ -20,11 +25,12 @@ typedef struct
 
     } dac_register;
 
+    bool dma_allocated;
     twr_dma_channel_t dma_channel;
     twr_dma_channel_config_t dma_config;
 
     TIM_TypeDef *tim;
-    twr_dac_sample_rate_t sample_rate;
+    uint32_t period;
 
 } twr_dac_channel_setup_t;
 
@@ -82,6 +88,13 @@ void twr_dac_deinit(twr_dac_channel_t channel)
         twr_dac_async_stop(channel);
     }
 
+    if (_twr_dac.channel[channel].dma_allocated)
+    {
+        twr_dma_channel_release(_twr_dac.channel[channel].dma_channel);
+
+        _twr_dac.channel[channel].dma_allocated = false;
+    }
+
     if (channel == TWR_DAC_DAC0)
     {
         // Disable DAC channel 0
@@ -149,6 +162,19 @@ bool twr_dac_async_config(twr_dac_channel_t channel, twr_dac_config_t *config)
 
     twr_dma_channel_config_t *dac_dma_config = &_twr_dac.channel[channel].dma_config;
 
+    // Each DAC channel has a single DMA channel, report conflict with other DMA users
+    if (!_twr_dac.channel[channel].dma_allocated)
+    {
+        twr_dma_line_t line = channel == TWR_DAC_DAC0 ? TWR_DMA_LINE_DAC1 : TWR_DMA_LINE_DAC2;
+
+        if (!twr_dma_channel_allocate(line, &_twr_dac.channel[channel].dma_channel, &dac_dma_config->request))
+        {
+            return false;
+        }
+
+        _twr_dac.channel[channel].dma_allocated = true;
+    }
+
     // Set peripheral address according to data size
     if (config->data_size == TWR_DAC_DATA_SIZE_8)
     {
@@ -183,7 +209,19 @@ bool twr_dac_async_config(twr_dac_channel_t channel, twr_dac_config_t *config)
 
     dac_dma_config->address_memory = config->buffer;
 
-    _twr_dac.channel[channel].sample_rate = config->sample_rate;
+    _twr_dac.channel[channel].period = _TWR_DAC_TIMER_CLOCK / (config->sample_rate == TWR_DAC_SAMPLE_RATE_16K ? 16000 : 8000);
+
+    return true;
+}
+
+bool twr_dac_async_set_sample_rate(twr_dac_channel_t channel, uint32_t sample_rate)
+{
+    if (_twr_dac.channel[channel].is_in_progress || sample_rate == 0 || sample_rate > _TWR_DAC_SAMPLE_RATE_MAX)
+    {
+        return false;
+    }
+
+    _twr_dac.channel[channel].period = (_TWR_DAC_TIMER_CLOCK + sample_rate / 2) / sample_rate;
 
     return true;
 }
@@ -192,7 +230,7 @@ bool twr_dac_async_run(twr_dac_channel_t channel)
 {
     twr_dac_channel_setup_t *dac_channel_setup = &_twr_dac.channel[channel];
 
-    if (dac_channel_setup->is_in_progress)
+    if (dac_channel_setup->is_in_progress || !dac_channel_setup->dma_allocated)
     {
         return false;
     }
@@ -214,7 +252,7 @@ bool twr_dac_async_run(twr_dac_channel_t channel)
         DAC->CR &= ~(DAC_CR_TSEL2_Msk);
 
         // DMA transfer with timer 7 TRGO event as a trigger
-        DAC->CR |= DAC_CR_DMAEN2 | DAC_CR_TEN2 | DAC_CR_TSEL2_0 | DAC_CR_TSEL2_2 | DAC_CR_WAVE1_0;
+        DAC->CR |= DAC_CR_DMAEN2 | DAC_CR_TEN2 | DAC_CR_TSEL2_0 | DAC_CR_TSEL2_2;
 
         // Enable time-base timer clock
         RCC->APB1ENR |= RCC_APB1ENR_TIM7EN;
@@ -225,18 +263,12 @@ bool twr_dac_async_run(twr_dac_channel_t channel)
 
     TIM_TypeDef *tim = _twr_dac.channel[channel].tim;
 
-    // Set prescaler - Tout 0.5us
-    tim->PSC = 16 - 1;
+    // Split period into the smallest prescaler and 16-bit auto-reload register
+    uint32_t prescaler = (dac_channel_setup->period - 1) / 0x10000;
 
-    // Configure auto-reload register according to desired sample rate (125us or 62.5us)
-    if (dac_channel_setup->sample_rate == TWR_DAC_SAMPLE_RATE_8K)
-    {
-        tim->ARR = 250 - 1;
-    }
-    else if (dac_channel_setup->sample_rate == TWR_DAC_SAMPLE_RATE_16K)
-    {
-        tim->ARR = 125 - 1;
-    }
+    tim->PSC = prescaler;
+
+    tim->ARR = dac_channel_setup->period / (prescaler + 1) - 1;
 
     // Enable update event generation
     tim->EGR = TIM_EGR_UG;
@@ -340,17 +372,14 @@ static const twr_dac_channel_setup_t _twr_dac_channel_0_setup_default =
         .u16 = (void *)&DAC->DHR12L1
     },
 
-    .dma_channel = TWR_DMA_CHANNEL_2,
-
     .dma_config =
     {
-        .request = TWR_DMA_REQUEST_9,
         .direction = TWR_DMA_DIRECTION_TO_PERIPHERAL,
         .data_size_peripheral = TWR_DMA_SIZE_2,
         .priority = TWR_DMA_PRIORITY_LOW
     },
     .tim = TIM6,
-    .sample_rate = TWR_DAC_SAMPLE_RATE_8K
+    .period = _TWR_DAC_TIMER_CLOCK / 8000
 };
 
 static const twr_dac_channel_setup_t _twr_dac_channel_1_setup_default =
@@ -366,13 +395,12 @@ static const twr_dac_channel_setup_t _twr_dac_channel_1_setup_default =
         .u16 = (void *)&DAC->DHR12L2
     },
 
-    .dma_channel = TWR_DMA_CHANNEL_4,
+    .dma_config =
     {
-        .request = TWR_DMA_REQUEST_15,
         .direction = TWR_DMA_DIRECTION_TO_PERIPHERAL,
         .data_size_peripheral = TWR_DMA_SIZE_2,
         .priority = TWR_DMA_PRIORITY_LOW
     },
     .tim = TIM7,
-    .sample_rate = TWR_DAC_SAMPLE_RATE_8K
+    .period = _TWR_DAC_TIMER_CLOCK / 8000
 };
@@ -0,0 +1,187 @@
+#include <twr_data_pipeline.h>
+
+static void _twr_data_pipeline_init(twr_data_pipeline_t *self, twr_data_pipeline_type_t type);
+static void _twr_data_pipeline_output(twr_data_pipeline_t *self, float value);
+
+void twr_data_pipeline_init_ewma(twr_data_pipeline_t *self, float alpha)
+{
+    _twr_data_pipeline_init(self, TWR_DATA_PIPELINE_TYPE_EWMA);
+
+    self->_alpha = alpha;
+}
+
+void twr_data_pipeline_init_decimate(twr_data_pipeline_t *self, int factor)
+{
+    _twr_data_pipeline_init(self, TWR_DATA_PIPELINE_TYPE_DECIMATE);
+
+    self->_factor = factor > 0 ? factor : 1;
+}
+
+void twr_data_pipeline_init_delta(twr_data_pipeline_t *self, float threshold, twr_tick_t interval)
+{
+    _twr_data_pipeline_init(self, TWR_DATA_PIPELINE_TYPE_DELTA);
+
+    self->_threshold = threshold;
+    self->_interval = interval;
+}
+
+void twr_data_pipeline_set_event_handler(twr_data_pipeline_t *self, void (*event_handler)(twr_data_pipeline_t *, float, void *), void *event_param)
+{
+    self->_event_handler = event_handler;
+    self->_event_param = event_param;
+}
+
+void twr_data_pipeline_set_next(twr_data_pipeline_t *self, twr_data_pipeline_t *next)
+{
+    self->_next = next;
+}
+
+void twr_data_pipeline_feed(twr_data_pipeline_t *self, float value)
+{
+    if (isnan(value) || isinf(value))
+    {
+        twr_data_pipeline_reset(self);
+
+        return;
+    }
+
+    switch (self->_type)
+    {
+        case TWR_DATA_PIPELINE_TYPE_EWMA:
+        {
+            if (isnan(self->_value))
+            {
+                _twr_data_pipeline_output(self, value);
+            }
+            else
+            {
+                _twr_data_pipeline_output(self, self->_value + self->_alpha * (value - self->_value));
+            }
+
+            break;
+        }
+        case TWR_DATA_PIPELINE_TYPE_DECIMATE:
+        {
+            if (++self->_counter >= self->_factor)
+            {
+                self->_counter = 0;
+
+                _twr_data_pipeline_output(self, value);
+            }
+
+            break;
+        }
+        case TWR_DATA_PIPELINE_TYPE_DELTA:
+        {
+            twr_tick_t now = twr_tick_get();
+
+            if (isnan(self->_value) || fabsf(value - self->_value) >= self->_threshold || now >= self->_tick_timeout)
+            {
+                self->_tick_timeout = self->_interval == TWR_TICK_INFINITY ? TWR_TICK_INFINITY : now + self->_interval;
+
+                _twr_data_pipeline_output(self, value);
+            }
+
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+bool twr_data_pipeline_feed_stream(twr_data_pipeline_t *self, twr_data_stream_t *stream)
+{
+    float value;
+
+    switch (twr_data_stream_get_type(stream))
+    {
+        case TWR_DATA_STREAM_TYPE_FLOAT:
+        {
+            if (!twr_data_stream_get_last(stream, &value))
+            {
+                return false;
+            }
+
+            break;
+        }
+        case TWR_DATA_STREAM_TYPE_INT:
+        {
+            int sample;
+
+            if (!twr_data_stream_get_last(stream, &sample))
+            {
+                return false;
+            }
+
+            value = sample;
+
+            break;
+        }
+        case TWR_DATA_STREAM_TYPE_INT16:
+        case TWR_DATA_STREAM_TYPE_FIXED:
+        {
+            int16_t sample;
+
+            if (!twr_data_stream_get_last(stream, &sample))
+            {
+                return false;
+            }
+
+            value = TWR_DATA_STREAM_FIXED_TO_FLOAT(sample, twr_data_stream_get_fraction_bits(stream));
+
+            break;
+        }
+        default:
+        {
+            return false;
+        }
+    }
+
+    twr_data_pipeline_feed(self, value);
+
+    return true;
+}
+
+bool twr_data_pipeline_get_value(twr_data_pipeline_t *self, float *value)
+{
+    *value = self->_value;
+
+    return !isnan(self->_value);
+}
+
+void twr_data_pipeline_reset(twr_data_pipeline_t *self)
+{
+    while (self != NULL)
+    {
+        self->_value = NAN;
+        self->_counter = 0;
+        self->_tick_timeout = 0;
+
+        self = self->_next;
+    }
+}
+
+static void _twr_data_pipeline_init(twr_data_pipeline_t *self, twr_data_pipeline_type_t type)
+{
+    memset(self, 0, sizeof(*self));
+
+    self->_type = type;
+    self->_value = NAN;
+}
+
+static void _twr_data_pipeline_output(twr_data_pipeline_t *self, float value)
+{
+    self->_value = value;
+
+    if (self->_event_handler != NULL)
+    {
+        self->_event_handler(self, value, self->_event_param);
+    }
+
+    if (self->_next != NULL)
+    {
+        twr_data_pipeline_feed(self->_next, value);
+    }
+}
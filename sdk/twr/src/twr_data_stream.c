@@ -1,7 +1,14 @@
 #include <twr_data_stream.h>
 
-static int _twr_data_stream_compare_float(const void * a, const void * b);
-static int _twr_data_stream_compare_int(const void * a, const void * b);
+static float _twr_data_stream_select_float(float *buffer, int length, int k);
+static int _twr_data_stream_select_int(int *buffer, int length, int k);
+static float _twr_data_stream_rank_float(const float *buffer, int length, int k);
+static int _twr_data_stream_rank_int(const int *buffer, int length, int k);
+static int16_t _twr_data_stream_select_int16(int16_t *buffer, int length, int k);
+static int16_t _twr_data_stream_rank_int16(const int16_t *buffer, int length, int k);
+static int _twr_data_stream_compare_position(twr_data_stream_t *self, int a, int b);
+static void _twr_data_stream_window_evict(twr_data_stream_t *self, int position);
+static void _twr_data_stream_window_push(twr_data_stream_t *self, int position);
 //
 void twr_data_stream_init(twr_data_stream_t *self, int min_number_of_samples, twr_data_stream_buffer_t *buffer)
 {
@@ -20,29 +27,90 @@ void twr_data_stream_feed(twr_data_stream_t *self, void *data)
         return;
     }
 
-    if (++self->_feed_head == self->_buffer->number_of_samples)
+    if (self->_buffer->type == TWR_DATA_STREAM_TYPE_FLOAT && (isnan(*(float *) data) || isinf(*(float *) data)))
+    {
+        twr_data_stream_reset(self);
+
+        return;
+    }
+
+    int number_of_samples = self->_buffer->number_of_samples;
+
+    if (++self->_feed_head == number_of_samples)
     {
        self->_feed_head = 0;
     }
 
+    // Oldest sample is overwritten once the buffer is full
+    bool evict = self->_counter >= number_of_samples;
+
+    if (evict)
+    {
+        _twr_data_stream_window_evict(self, self->_feed_head);
+    }
+
     switch (self->_buffer->type)
     {
         case TWR_DATA_STREAM_TYPE_FLOAT:
         {
-            if (isnan(*(float *) data) || isinf(*(float *) data))
-            {
-                twr_data_stream_reset(self);
+            float *feed = (float *) self->_buffer->feed + self->_feed_head;
 
-                return;
+            if (evict)
+            {
+                self->_sum_float -= *feed;
             }
 
-            *((float *) self->_buffer->feed + self->_feed_head) = *(float *) data;
+            *feed = *(float *) data;
+
+            // Rounding errors of running sum are dropped by summing the buffer again once per its length
+            if (++self->_sum_feeds >= number_of_samples)
+            {
+                int length = evict ? number_of_samples : self->_counter + 1;
+
+                self->_sum_float = 0;
+
+                for (int i = 0; i < length; i++)
+                {
+                    self->_sum_float += ((float *) self->_buffer->feed)[i];
+                }
+
+                self->_sum_feeds = 0;
+            }
+            else
+            {
+                self->_sum_float += *feed;
+            }
 
             break;
         }
         case TWR_DATA_STREAM_TYPE_INT:
         {
-            *((int *) self->_buffer->feed + self->_feed_head) = *(int *) data;
+            int *feed = (int *) self->_buffer->feed + self->_feed_head;
+
+            if (evict)
+            {
+                self->_sum_int -= *feed;
+            }
+
+            *feed = *(int *) data;
+
+            self->_sum_int += *feed;
+
+            break;
+        }
+        case TWR_DATA_STREAM_TYPE_INT16:
+        case TWR_DATA_STREAM_TYPE_FIXED:
+        {
+            int16_t *feed = (int16_t *) self->_buffer->feed + self->_feed_head;
+
+            if (evict)
+            {
+                self->_sum_int -= *feed;
+            }
+
+            *feed = *(int16_t *) data;
+
+            self->_sum_int += *feed;
 
             break;
         }
@@ -53,12 +121,21 @@ void twr_data_stream_feed(twr_data_stream_t *self, void *data)
     }
 
     self->_counter++;
+
+    _twr_data_stream_window_push(self, self->_feed_head);
 }
 
 void twr_data_stream_reset(twr_data_stream_t *self)
 {
     self->_counter = 0;
     self->_feed_head = self->_buffer->number_of_samples - 1;
+    self->_sum_int = 0;
+    self->_sum_float = 0;
+    self->_sum_feeds = 0;
+    self->_min_head = 0;
+    self->_min_count = 0;
+    self->_max_head = 0;
+    self->_max_count = 0;
 }
 
 int twr_data_stream_get_counter(twr_data_stream_t *self)
@@ -81,6 +158,11 @@ int twr_data_stream_get_number_of_samples(twr_data_stream_t *self)
     return self->_buffer->number_of_samples;
 }
 
+int twr_data_stream_get_fraction_bits(twr_data_stream_t *self)
+{
+    return self->_buffer->type == TWR_DATA_STREAM_TYPE_FIXED ? self->_buffer->fraction_bits : 0;
+}
+
 bool twr_data_stream_get_average(twr_data_stream_t *self, void *result)
 {
     if (self->_counter < self->_min_number_of_samples)
@@ -94,29 +176,19 @@ bool twr_data_stream_get_average(twr_data_stream_t *self, void *result)
     {
         case TWR_DATA_STREAM_TYPE_FLOAT:
         {
-            float sum = 0;
-            float *buffer = (float *) self->_buffer->feed;
-
-
-            for (int i = 0; i < length; i ++)
-            {
-                sum += buffer[i];
-            }
-
-            *(float *) result = sum / length;
+            *(float *) result = self->_sum_float / length;
             break;
         }
         case TWR_DATA_STREAM_TYPE_INT:
         {
-            int64_t sum = 0;
-            int *buffer = (int *) self->_buffer->feed;
-
-            for (int i = 0; i < length; i ++)
-            {
-                sum += buffer[i];
-            }
-
-            *(int *) result = sum / length;
+            *(int *) result = self->_sum_int / length;
+            break;
+        }
+        case TWR_DATA_STREAM_TYPE_INT16:
+        case TWR_DATA_STREAM_TYPE_FIXED:
+        {
+            // Sum of 16 bit samples always fits in 32 bits, so 64 bit division is not needed
+            *(int16_t *) result = (int32_t) self->_sum_int / length;
             break;
         }
         default:
@@ -141,35 +213,122 @@ bool twr_data_stream_get_median(twr_data_stream_t *self, void *result)
     {
         case TWR_DATA_STREAM_TYPE_FLOAT:
         {
-            memcpy(self->_buffer->sort, self->_buffer->feed, length * sizeof(float));
-            qsort(self->_buffer->sort, length, sizeof(float), _twr_data_stream_compare_float);
+            float upper;
+            float lower;
+
+            if (self->_buffer->sort != NULL)
+            {
+                float *buffer = (float *) self->_buffer->sort;
+
+                memcpy(buffer, self->_buffer->feed, length * sizeof(float));
+
+                upper = _twr_data_stream_select_float(buffer, length, length / 2);
 
-            float *buffer = (float *) self->_buffer->sort;
+                // Selection leaves only smaller or equal values in front of the upper middle
+                lower = buffer[0];
+
+                for (int i = 1; i < length / 2; i++)
+                {
+                    if (buffer[i] > lower)
+                    {
+                        lower = buffer[i];
+                    }
+                }
+            }
+            else
+            {
+                upper = _twr_data_stream_rank_float(self->_buffer->feed, length, length / 2);
+                lower = length % 2 == 0 ? _twr_data_stream_rank_float(self->_buffer->feed, length, length / 2 - 1) : upper;
+            }
 
             if (length % 2 == 0)
             {
-                *(float *) result = (buffer[(length - 2) / 2] + buffer[length / 2]) / 2;
+                *(float *) result = (lower + upper) / 2;
             }
             else
             {
-                *(float *) result = buffer[(length - 1) / 2];
+                *(float *) result = upper;
             }
             break;
         }
         case TWR_DATA_STREAM_TYPE_INT:
         {
-            memcpy(self->_buffer->sort, self->_buffer->feed, length * sizeof(int));
-            qsort(self->_buffer->sort, length, sizeof(int), _twr_data_stream_compare_int);
+            int upper;
+            int lower;
+
+            if (self->_buffer->sort != NULL)
+            {
+                int *buffer = (int *) self->_buffer->sort;
+
+                memcpy(buffer, self->_buffer->feed, length * sizeof(int));
+
+                upper = _twr_data_stream_select_int(buffer, length, length / 2);
+
+                // Selection leaves only smaller or equal values in front of the upper middle
+                lower = buffer[0];
 
-            int *buffer = (int *) self->_buffer->sort;
+                for (int i = 1; i < length / 2; i++)
+                {
+                    if (buffer[i] > lower)
+                    {
+                        lower = buffer[i];
+                    }
+                }
+            }
+            else
+            {
+                upper = _twr_data_stream_rank_int(self->_buffer->feed, length, length / 2);
+                lower = length % 2 == 0 ? _twr_data_stream_rank_int(self->_buffer->feed, length, length / 2 - 1) : upper;
+            }
 
             if (length % 2 == 0)
             {
-                *(int *) result = (buffer[(length - 2) / 2] + buffer[length / 2]) / 2;
+                *(int *) result = (lower + upper) / 2;
             }
             else
             {
-                *(int *) result = buffer[(length - 1) / 2];
+                *(int *) result = upper;
+            }
+            break;
+        }
+        case TWR_DATA_STREAM_TYPE_INT16:
+        case TWR_DATA_STREAM_TYPE_FIXED:
+        {
+            int16_t upper;
+            int16_t lower;
+
+            if (self->_buffer->sort != NULL)
+            {
+                int16_t *buffer = (int16_t *) self->_buffer->sort;
+
+                memcpy(buffer, self->_buffer->feed, length * sizeof(int16_t));
+
+                upper = _twr_data_stream_select_int16(buffer, length, length / 2);
+
+                // Selection leaves only smaller or equal values in front of the upper middle
+                lower = buffer[0];
+
+                for (int i = 1; i < length / 2; i++)
+                {
+                    if (buffer[i] > lower)
+                    {
+                        lower = buffer[i];
+                    }
+                }
+            }
+            else
+            {
+                upper = _twr_data_stream_rank_int16(self->_buffer->feed, length, length / 2);
+                lower = length % 2 == 0 ? _twr_data_stream_rank_int16(self->_buffer->feed, length, length / 2 - 1) : upper;
+            }
+
+            if (length % 2 == 0)
+            {
+                *(int16_t *) result = (lower + upper) / 2;
+            }
+            else
+            {
+                *(int16_t *) result = upper;
             }
             break;
         }
@@ -208,6 +367,12 @@ bool twr_data_stream_get_first(twr_data_stream_t *self, void *result)
             *(int *) result = *((int *) self->_buffer->feed + position);
             break;
         }
+        case TWR_DATA_STREAM_TYPE_INT16:
+        case TWR_DATA_STREAM_TYPE_FIXED:
+        {
+            *(int16_t *) result = *((int16_t *) self->_buffer->feed + position);
+            break;
+        }
         default:
         {
             return false;
@@ -236,6 +401,12 @@ bool twr_data_stream_get_last(twr_data_stream_t *self, void *result)
             *(int *) result = *((int *) self->_buffer->feed + self->_feed_head);
             break;
         }
+        case TWR_DATA_STREAM_TYPE_INT16:
+        case TWR_DATA_STREAM_TYPE_FIXED:
+        {
+            *(int16_t *) result = *((int16_t *) self->_buffer->feed + self->_feed_head);
+            break;
+        }
         default:
         {
             return false;
@@ -292,6 +463,12 @@ bool twr_data_stream_get_nth(twr_data_stream_t *self, int n, void *result)
             *(int *) result = *((int *) self->_buffer->feed + position);
             break;
         }
+        case TWR_DATA_STREAM_TYPE_INT16:
+        case TWR_DATA_STREAM_TYPE_FIXED:
+        {
+            *(int16_t *) result = *((int16_t *) self->_buffer->feed + position);
+            break;
+        }
         default:
         {
             return false;
@@ -308,6 +485,26 @@ bool twr_data_stream_get_max(twr_data_stream_t *self, void *result)
         return false;
     }
 
+    if (self->_buffer->window != NULL && self->_max_count != 0)
+    {
+        int position = self->_buffer->window[self->_max_head + self->_buffer->number_of_samples];
+
+        if (self->_buffer->type == TWR_DATA_STREAM_TYPE_FLOAT)
+        {
+            *(float *) result = ((float *) self->_buffer->feed)[position];
+        }
+        else if (self->_buffer->type == TWR_DATA_STREAM_TYPE_INT)
+        {
+            *(int *) result = ((int *) self->_buffer->feed)[position];
+        }
+        else
+        {
+            *(int16_t *) result = ((int16_t *) self->_buffer->feed)[position];
+        }
+
+        return true;
+    }
+
     int length = twr_data_stream_get_length(self);
 
     switch (self->_buffer->type)
@@ -348,6 +545,25 @@ bool twr_data_stream_get_max(twr_data_stream_t *self, void *result)
 
             break;
         }
+        case TWR_DATA_STREAM_TYPE_INT16:
+        case TWR_DATA_STREAM_TYPE_FIXED:
+        {
+            int16_t *buffer = (int16_t *) self->_buffer->feed;
+
+            int16_t max = buffer[0];
+
+            for (int i = 1; i < length; i ++)
+            {
+                if (buffer[i] > max)
+                {
+                    max = buffer[i];
+                }
+            }
+
+            *(int16_t *) result = max;
+
+            break;
+        }
         default:
         {
             return false;
@@ -364,6 +580,26 @@ bool twr_data_stream_get_min(twr_data_stream_t *self, void *result)
         return false;
     }
 
+    if (self->_buffer->window != NULL && self->_min_count != 0)
+    {
+        int position = self->_buffer->window[self->_min_head];
+
+        if (self->_buffer->type == TWR_DATA_STREAM_TYPE_FLOAT)
+        {
+            *(float *) result = ((float *) self->_buffer->feed)[position];
+        }
+        else if (self->_buffer->type == TWR_DATA_STREAM_TYPE_INT)
+        {
+            *(int *) result = ((int *) self->_buffer->feed)[position];
+        }
+        else
+        {
+            *(int16_t *) result = ((int16_t *) self->_buffer->feed)[position];
+        }
+
+        return true;
+    }
+
     int length = twr_data_stream_get_length(self);
 
     switch (self->_buffer->type)
@@ -404,6 +640,25 @@ bool twr_data_stream_get_min(twr_data_stream_t *self, void *result)
 
             break;
         }
+        case TWR_DATA_STREAM_TYPE_INT16:
+        case TWR_DATA_STREAM_TYPE_FIXED:
+        {
+            int16_t *buffer = (int16_t *) self->_buffer->feed;
+
+            int16_t min = buffer[0];
+
+            for (int i = 1; i < length; i ++)
+            {
+                if (buffer[i] < min)
+                {
+                    min = buffer[i];
+                }
+            }
+
+            *(int16_t *) result = min;
+
+            break;
+        }
         default:
         {
             return false;
@@ -413,12 +668,325 @@ bool twr_data_stream_get_min(twr_data_stream_t *self, void *result)
     return true;
 }
 
-static int _twr_data_stream_compare_float(const void *a, const void *b)
+// Wirth's selection, values in front of k are smaller or equal, values behind are greater or equal
+static float _twr_data_stream_select_float(float *buffer, int length, int k)
 {
-    return *(float *) a - *(float *) b;
+    int left = 0;
+    int right = length - 1;
+
+    while (left < right)
+    {
+        float pivot = buffer[k];
+        int i = left;
+        int j = right;
+
+        do
+        {
+            while (buffer[i] < pivot)
+            {
+                i++;
+            }
+
+            while (pivot < buffer[j])
+            {
+                j--;
+            }
+
+            if (i <= j)
+            {
+                float swap = buffer[i];
+                buffer[i] = buffer[j];
+                buffer[j] = swap;
+                i++;
+                j--;
+            }
+        }
+        while (i <= j);
+
+        if (j < k)
+        {
+            left = i;
+        }
+
+        if (k < i)
+        {
+            right = j;
+        }
+    }
+
+    return buffer[k];
+}
+
+static int _twr_data_stream_select_int(int *buffer, int length, int k)
+{
+    int left = 0;
+    int right = length - 1;
+
+    while (left < right)
+    {
+        int pivot = buffer[k];
+        int i = left;
+        int j = right;
+
+        do
+        {
+            while (buffer[i] < pivot)
+            {
+                i++;
+            }
+
+            while (pivot < buffer[j])
+            {
+                j--;
+            }
+
+            if (i <= j)
+            {
+                int swap = buffer[i];
+                buffer[i] = buffer[j];
+                buffer[j] = swap;
+                i++;
+                j--;
+            }
+        }
+        while (i <= j);
+
+        if (j < k)
+        {
+            left = i;
+        }
+
+        if (k < i)
+        {
+            right = j;
+        }
+    }
+
+    return buffer[k];
+}
+
+// Selection without a copy when there is no sort buffer, quadratic in length
+static float _twr_data_stream_rank_float(const float *buffer, int length, int k)
+{
+    for (int i = 0; i < length; i++)
+    {
+        int less = 0;
+        int equal = 0;
+
+        for (int j = 0; j < length; j++)
+        {
+            if (buffer[j] < buffer[i])
+            {
+                less++;
+            }
+            else if (buffer[j] == buffer[i])
+            {
+                equal++;
+            }
+        }
+
+        if (less <= k && k < less + equal)
+        {
+            return buffer[i];
+        }
+    }
+
+    return buffer[0];
+}
+
+static int _twr_data_stream_rank_int(const int *buffer, int length, int k)
+{
+    for (int i = 0; i < length; i++)
+    {
+        int less = 0;
+        int equal = 0;
+
+        for (int j = 0; j < length; j++)
+        {
+            if (buffer[j] < buffer[i])
+            {
+                less++;
+            }
+            else if (buffer[j] == buffer[i])
+            {
+                equal++;
+            }
+        }
+
+        if (less <= k && k < less + equal)
+        {
+            return buffer[i];
+        }
+    }
+
+    return buffer[0];
+}
+
+static int16_t _twr_data_stream_select_int16(int16_t *buffer, int length, int k)
+{
+    int left = 0;
+    int right = length - 1;
+
+    while (left < right)
+    {
+        int16_t pivot = buffer[k];
+        int i = left;
+        int j = right;
+
+        do
+        {
+            while (buffer[i] < pivot)
+            {
+                i++;
+            }
+
+            while (pivot < buffer[j])
+            {
+                j--;
+            }
+
+            if (i <= j)
+            {
+                int16_t swap = buffer[i];
+                buffer[i] = buffer[j];
+                buffer[j] = swap;
+                i++;
+                j--;
+            }
+        }
+        while (i <= j);
+
+        if (j < k)
+        {
+            left = i;
+        }
+
+        if (k < i)
+        {
+            right = j;
+        }
+    }
+
+    return buffer[k];
 }
 
-static int _twr_data_stream_compare_int(const void *a, const void *b)
+static int16_t _twr_data_stream_rank_int16(const int16_t *buffer, int length, int k)
 {
-    return *(int *) a - *(int *) b;
+    for (int i = 0; i < length; i++)
+    {
+        int less = 0;
+        int equal = 0;
+
+        for (int j = 0; j < length; j++)
+        {
+            if (buffer[j] < buffer[i])
+            {
+                less++;
+            }
+            else if (buffer[j] == buffer[i])
+            {
+                equal++;
+            }
+        }
+
+        if (less <= k && k < less + equal)
+        {
+            return buffer[i];
+        }
+    }
+
+    return buffer[0];
+}
+
+static int _twr_data_stream_compare_position(twr_data_stream_t *self, int a, int b)
+{
+    if (self->_buffer->type == TWR_DATA_STREAM_TYPE_FLOAT)
+    {
+        float value_a = ((float *) self->_buffer->feed)[a];
+        float value_b = ((float *) self->_buffer->feed)[b];
+
+        return (value_a > value_b) - (value_a < value_b);
+    }
+    else if (self->_buffer->type == TWR_DATA_STREAM_TYPE_INT)
+    {
+        int value_a = ((int *) self->_buffer->feed)[a];
+        int value_b = ((int *) self->_buffer->feed)[b];
+
+        return (value_a > value_b) - (value_a < value_b);
+    }
+    else
+    {
+        return ((int16_t *) self->_buffer->feed)[a] - ((int16_t *) self->_buffer->feed)[b];
+    }
+}
+
+static void _twr_data_stream_window_evict(twr_data_stream_t *self, int position)
+{
+    uint16_t *window = self->_buffer->window;
+    int number_of_samples = self->_buffer->number_of_samples;
+
+    if (window == NULL)
+    {
+        return;
+    }
+
+    // Only the oldest position can leave, it is at the front of queue unless dropped earlier
+    if (self->_min_count != 0 && window[self->_min_head] == position)
+    {
+        self->_min_head = (self->_min_head + 1) % number_of_samples;
+        self->_min_count--;
+    }
+
+    window += number_of_samples;
+
+    if (self->_max_count != 0 && window[self->_max_head] == position)
+    {
+        self->_max_head = (self->_max_head + 1) % number_of_samples;
+        self->_max_count--;
+    }
+}
+
+static void _twr_data_stream_window_push(twr_data_stream_t *self, int position)
+{
+    uint16_t *window = self->_buffer->window;
+    int number_of_samples = self->_buffer->number_of_samples;
+
+    if (window == NULL)
+    {
+        return;
+    }
+
+    // Minimum queue holds increasing values from the oldest sample, samples not smaller than the new one can never be minimum again
+    while (self->_min_count != 0)
+    {
+        int back = window[(self->_min_head + self->_min_count - 1) % number_of_samples];
+
+        if (_twr_data_stream_compare_position(self, back, position) < 0)
+        {
+            break;
+        }
+
+        self->_min_count--;
+    }
+
+    window[(self->_min_head + self->_min_count) % number_of_samples] = position;
+    self->_min_count++;
+
+    window += number_of_samples;
+
+    // Maximum queue holds decreasing values from the oldest sample
+    while (self->_max_count != 0)
+    {
+        int back = window[(self->_max_head + self->_max_count - 1) % number_of_samples];
+
+        if (_twr_data_stream_compare_position(self, back, position) > 0)
+        {
+            break;
+        }
+
+        self->_max_count--;
+    }
+
+    window[(self->_max_head + self->_max_count) % number_of_samples] = position;
+    self->_max_count++;
 }
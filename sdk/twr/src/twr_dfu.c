@@ -1,5 +1,58 @@
+#include <twr_dfu.h>
+#include <twr_crc.h>
+#include <twr_kv.h>
+#include <twr_irq.h>
 #include <stm32l0xx.h>
 
+#define _TWR_DFU_PAGE_SIZE 128
+#define _TWR_DFU_MAGIC 0x55464457
+#define _TWR_DFU_OP_DATA 0x00
+#define _TWR_DFU_OP_COPY 0x01
+#define _TWR_DFU_OP_NONE 0xff
+#define _TWR_DFU_FLASH_ERRORS (FLASH_SR_WRPERR | FLASH_SR_PGAERR | FLASH_SR_SIZERR | FLASH_SR_OPTVERR | \
+                               FLASH_SR_RDERR | FLASH_SR_NOTZEROERR | FLASH_SR_FWWERR)
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t image_size;
+    uint32_t image_crc;
+    uint32_t output;
+    uint16_t next_block;
+    uint16_t remaining;
+    uint8_t mode;
+    uint8_t op;
+    uint8_t header_length;
+    uint8_t header[5];
+    bool verified;
+
+} _twr_dfu_state_t;
+
+static struct
+{
+    bool state_enabled;
+    uint16_t state_key;
+    bool running;
+    _twr_dfu_state_t state;
+    uint8_t page[_TWR_DFU_PAGE_SIZE];
+
+} _twr_dfu;
+
+// Symbols of linker script, initialized data are the last part of image
+extern uint32_t _sidata;
+extern uint32_t _sdata;
+extern uint32_t _edata;
+
+static uint32_t _twr_dfu_get_firmware_size(void);
+static bool _twr_dfu_output(const uint8_t *buffer, size_t length);
+static bool _twr_dfu_decode(const uint8_t *buffer, size_t length);
+static bool _twr_dfu_flush(void);
+static bool _twr_dfu_save(void);
+static bool _twr_dfu_flash_page(uint32_t address, const uint8_t *buffer, size_t length);
+static void _twr_dfu_flash_unlock(void);
+static void _twr_dfu_flash_lock(void);
+static void _twr_dfu_copy(uint32_t size);
+
 void twr_dfu_jump(void)
 {
     // Set magic code, the rest is in the system_stm32l0xx.c file
@@ -8,3 +61,464 @@ void twr_dfu_jump(void)
     // Reset the processor
     NVIC_SystemReset();
 }
+
+void twr_dfu_set_state_key(uint16_t key)
+{
+    _twr_dfu.state_enabled = true;
+
+    _twr_dfu.state_key = key;
+}
+
+bool twr_dfu_begin(twr_dfu_mode_t mode, uint32_t image_size, uint32_t image_crc)
+{
+    _twr_dfu.running = false;
+
+    if ((image_size == 0) || (image_size > TWR_DFU_STAGING_SIZE) || (image_size > TWR_DFU_STAGING_ADDRESS - FLASH_BASE))
+    {
+        return false;
+    }
+
+    if (_twr_dfu_get_firmware_size() > TWR_DFU_STAGING_ADDRESS - FLASH_BASE)
+    {
+        return false;
+    }
+
+    _twr_dfu_state_t state;
+    size_t length = sizeof(state);
+
+    // Transfer of the same image continues from the last checkpoint
+    if (_twr_dfu.state_enabled && twr_kv_get(_twr_dfu.state_key, &state, &length) && (length == sizeof(state)) &&
+        (state.magic == _TWR_DFU_MAGIC) && (state.image_size == image_size) && (state.image_crc == image_crc) &&
+        (state.mode == mode) && !state.verified)
+    {
+        _twr_dfu.state = state;
+
+        size_t fill = state.output % _TWR_DFU_PAGE_SIZE;
+
+        memset(_twr_dfu.page, 0, sizeof(_twr_dfu.page));
+
+        // Part of page written at checkpoint is erased and written again when page is complete
+        memcpy(_twr_dfu.page, (void *) (TWR_DFU_STAGING_ADDRESS + state.output - fill), fill);
+
+        _twr_dfu.running = true;
+
+        return true;
+    }
+
+    memset(&_twr_dfu.state, 0, sizeof(_twr_dfu.state));
+    memset(_twr_dfu.page, 0, sizeof(_twr_dfu.page));
+
+    _twr_dfu.state.magic = _TWR_DFU_MAGIC;
+    _twr_dfu.state.image_size = image_size;
+    _twr_dfu.state.image_crc = image_crc;
+    _twr_dfu.state.mode = mode;
+    _twr_dfu.state.op = _TWR_DFU_OP_NONE;
+
+    _twr_dfu.running = true;
+
+    return _twr_dfu_save();
+}
+
+uint16_t twr_dfu_get_next_block(void)
+{
+    return _twr_dfu.state.next_block;
+}
+
+twr_dfu_result_t twr_dfu_write_block(uint16_t index, const void *buffer, size_t length, uint16_t crc)
+{
+    if (!_twr_dfu.running)
+    {
+        return TWR_DFU_RESULT_ERROR;
+    }
+
+    if (index < _twr_dfu.state.next_block)
+    {
+        return TWR_DFU_RESULT_DUPLICATE;
+    }
+
+    if (index > _twr_dfu.state.next_block)
+    {
+        return TWR_DFU_RESULT_OUT_OF_ORDER;
+    }
+
+    if ((length == 0) || (length > TWR_DFU_BLOCK_SIZE) || (twr_crc16(0x1021, buffer, length, 0xffff) != crc))
+    {
+        return TWR_DFU_RESULT_CRC;
+    }
+
+    bool success;
+
+    if (_twr_dfu.state.mode == TWR_DFU_MODE_DELTA)
+    {
+        success = _twr_dfu_decode(buffer, length);
+    }
+    else
+    {
+        success = _twr_dfu_output(buffer, length);
+    }
+
+    if (!success)
+    {
+        twr_dfu_abort();
+
+        return TWR_DFU_RESULT_ERROR;
+    }
+
+    _twr_dfu.state.next_block++;
+
+    if (_twr_dfu.state_enabled && (_twr_dfu.state.next_block % TWR_DFU_CHECKPOINT_BLOCKS == 0))
+    {
+        if (!_twr_dfu_flush() || !_twr_dfu_save())
+        {
+            twr_dfu_abort();
+
+            return TWR_DFU_RESULT_ERROR;
+        }
+    }
+
+    return TWR_DFU_RESULT_OK;
+}
+
+bool twr_dfu_finish(void)
+{
+    if (!_twr_dfu.running)
+    {
+        return false;
+    }
+
+    if ((_twr_dfu.state.output != _twr_dfu.state.image_size) || (_twr_dfu.state.op != _TWR_DFU_OP_NONE))
+    {
+        return false;
+    }
+
+    if (!_twr_dfu_flush())
+    {
+        return false;
+    }
+
+    if (twr_crc32((void *) TWR_DFU_STAGING_ADDRESS, _twr_dfu.state.image_size) != _twr_dfu.state.image_crc)
+    {
+        return false;
+    }
+
+    _twr_dfu.state.verified = true;
+
+    _twr_dfu.running = false;
+
+    return _twr_dfu_save();
+}
+
+bool twr_dfu_install(void)
+{
+    _twr_dfu_state_t state = _twr_dfu.state;
+    size_t length = sizeof(state);
+
+    // Image verified before reset is installed as well
+    if (!state.verified && (!_twr_dfu.state_enabled || !twr_kv_get(_twr_dfu.state_key, &state, &length) ||
+        (length != sizeof(state)) || (state.magic != _TWR_DFU_MAGIC)))
+    {
+        return false;
+    }
+
+    if (!state.verified || (state.image_size > TWR_DFU_STAGING_ADDRESS - FLASH_BASE))
+    {
+        return false;
+    }
+
+    if (twr_crc32((void *) TWR_DFU_STAGING_ADDRESS, state.image_size) != state.image_crc)
+    {
+        return false;
+    }
+
+    if (_twr_dfu.state_enabled)
+    {
+        twr_kv_delete(_twr_dfu.state_key);
+    }
+
+    __disable_irq();
+
+    _twr_dfu_flash_unlock();
+
+    _twr_dfu_copy(state.image_size);
+
+    return true;
+}
+
+void twr_dfu_abort(void)
+{
+    _twr_dfu.running = false;
+
+    memset(&_twr_dfu.state, 0, sizeof(_twr_dfu.state));
+
+    if (_twr_dfu.state_enabled)
+    {
+        twr_kv_delete(_twr_dfu.state_key);
+    }
+}
+
+static uint32_t _twr_dfu_get_firmware_size(void)
+{
+    return (uint32_t) &_sidata - FLASH_BASE + ((uint32_t) &_edata - (uint32_t) &_sdata);
+}
+
+static bool _twr_dfu_output(const uint8_t *buffer, size_t length)
+{
+    if (_twr_dfu.state.output + length > _twr_dfu.state.image_size)
+    {
+        return false;
+    }
+
+    while (length > 0)
+    {
+        size_t offset = _twr_dfu.state.output % _TWR_DFU_PAGE_SIZE;
+        size_t n = _TWR_DFU_PAGE_SIZE - offset;
+
+        if (n > length)
+        {
+            n = length;
+        }
+
+        memcpy(_twr_dfu.page + offset, buffer, n);
+
+        _twr_dfu.state.output += n;
+
+        buffer += n;
+        length -= n;
+
+        if (_twr_dfu.state.output % _TWR_DFU_PAGE_SIZE == 0)
+        {
+            if (!_twr_dfu_flash_page(TWR_DFU_STAGING_ADDRESS + _twr_dfu.state.output - _TWR_DFU_PAGE_SIZE, _twr_dfu.page, _TWR_DFU_PAGE_SIZE))
+            {
+                return false;
+            }
+
+            memset(_twr_dfu.page, 0, sizeof(_twr_dfu.page));
+        }
+    }
+
+    return true;
+}
+
+static bool _twr_dfu_decode(const uint8_t *buffer, size_t length)
+{
+    _twr_dfu_state_t *state = &_twr_dfu.state;
+
+    // Commands may be split between blocks, so decoder keeps its state
+    while (length > 0)
+    {
+        if (state->op == _TWR_DFU_OP_NONE)
+        {
+            state->op = *buffer++;
+
+            length--;
+
+            state->header_length = 0;
+
+            if ((state->op != _TWR_DFU_OP_DATA) && (state->op != _TWR_DFU_OP_COPY))
+            {
+                return false;
+            }
+
+            continue;
+        }
+
+        size_t header_size = state->op == _TWR_DFU_OP_DATA ? 2 : 5;
+
+        if (state->header_length < header_size)
+        {
+            state->header[state->header_length++] = *buffer++;
+
+            length--;
+
+            if (state->header_length < header_size)
+            {
+                continue;
+            }
+
+            if (state->op == _TWR_DFU_OP_COPY)
+            {
+                uint32_t source = state->header[0] | (state->header[1] << 8) | ((uint32_t) state->header[2] << 16);
+                uint16_t count = state->header[3] | (state->header[4] << 8);
+
+                if (source + count > _twr_dfu_get_firmware_size())
+                {
+                    return false;
+                }
+
+                if (!_twr_dfu_output((uint8_t *) FLASH_BASE + source, count))
+                {
+                    return false;
+                }
+
+                state->op = _TWR_DFU_OP_NONE;
+            }
+            else
+            {
+                state->remaining = state->header[0] | (state->header[1] << 8);
+
+                if (state->remaining == 0)
+                {
+                    state->op = _TWR_DFU_OP_NONE;
+                }
+            }
+
+            continue;
+        }
+
+        size_t n = state->remaining < length ? state->remaining : length;
+
+        if (!_twr_dfu_output(buffer, n))
+        {
+            return false;
+        }
+
+        buffer += n;
+        length -= n;
+
+        state->remaining -= n;
+
+        if (state->remaining == 0)
+        {
+            state->op = _TWR_DFU_OP_NONE;
+        }
+    }
+
+    return true;
+}
+
+static bool _twr_dfu_flush(void)
+{
+    size_t fill = _twr_dfu.state.output % _TWR_DFU_PAGE_SIZE;
+
+    if (fill == 0)
+    {
+        return true;
+    }
+
+    return _twr_dfu_flash_page(TWR_DFU_STAGING_ADDRESS + _twr_dfu.state.output - fill, _twr_dfu.page, fill);
+}
+
+static bool _twr_dfu_save(void)
+{
+    if (!_twr_dfu.state_enabled)
+    {
+        return true;
+    }
+
+    return twr_kv_set(_twr_dfu.state_key, &_twr_dfu.state, sizeof(_twr_dfu.state));
+}
+
+static bool _twr_dfu_flash_page(uint32_t address, const uint8_t *buffer, size_t length)
+{
+    _twr_dfu_flash_unlock();
+
+    FLASH->SR = _TWR_DFU_FLASH_ERRORS;
+
+    // Erased flash reads as zero
+    FLASH->PECR |= FLASH_PECR_ERASE | FLASH_PECR_PROG;
+
+    *((volatile uint32_t *) address) = 0;
+
+    while ((FLASH->SR & FLASH_SR_BSY) != 0)
+    {
+        continue;
+    }
+
+    FLASH->PECR &= ~(FLASH_PECR_ERASE | FLASH_PECR_PROG);
+
+    for (size_t i = 0; (i < length) && ((FLASH->SR & _TWR_DFU_FLASH_ERRORS) == 0); i += 4)
+    {
+        uint32_t word;
+
+        memcpy(&word, buffer + i, sizeof(word));
+
+        if (word != 0)
+        {
+            *((volatile uint32_t *) (address + i)) = word;
+
+            while ((FLASH->SR & FLASH_SR_BSY) != 0)
+            {
+                continue;
+            }
+        }
+    }
+
+    bool success = (FLASH->SR & _TWR_DFU_FLASH_ERRORS) == 0;
+
+    _twr_dfu_flash_lock();
+
+    return success && (memcmp((void *) address, buffer, length) == 0);
+}
+
+static void _twr_dfu_flash_unlock(void)
+{
+    twr_irq_disable();
+
+    // Unlock FLASH_PECR register
+    if ((FLASH->PECR & FLASH_PECR_PELOCK) != 0)
+    {
+        FLASH->PEKEYR = FLASH_PEKEY1;
+        FLASH->PEKEYR = FLASH_PEKEY2;
+    }
+
+    // Unlock program memory
+    if ((FLASH->PECR & FLASH_PECR_PRGLOCK) != 0)
+    {
+        FLASH->PRGKEYR = FLASH_PRGKEY1;
+        FLASH->PRGKEYR = FLASH_PRGKEY2;
+    }
+
+    twr_irq_enable();
+}
+
+static void _twr_dfu_flash_lock(void)
+{
+    twr_irq_disable();
+
+    // Lock program memory and FLASH_PECR register
+    FLASH->PECR |= FLASH_PECR_PRGLOCK | FLASH_PECR_PELOCK;
+
+    twr_irq_enable();
+}
+
+// Runs from RAM as the whole firmware is rewritten, it must not call any function in flash
+__attribute__ ((section(".ramfunc"), noinline)) static void _twr_dfu_copy(uint32_t size)
+{
+    for (uint32_t offset = 0; offset < size; offset += _TWR_DFU_PAGE_SIZE)
+    {
+        volatile uint32_t *target = (volatile uint32_t *) (FLASH_BASE + offset);
+        volatile uint32_t *source = (volatile uint32_t *) (TWR_DFU_STAGING_ADDRESS + offset);
+
+        FLASH->PECR |= FLASH_PECR_ERASE | FLASH_PECR_PROG;
+
+        *target = 0;
+
+        while ((FLASH->SR & FLASH_SR_BSY) != 0)
+        {
+            continue;
+        }
+
+        FLASH->PECR &= ~(FLASH_PECR_ERASE | FLASH_PECR_PROG);
+
+        for (uint32_t i = 0; i < _TWR_DFU_PAGE_SIZE / 4; i++)
+        {
+            if (source[i] != 0)
+            {
+                target[i] = source[i];
+
+                while ((FLASH->SR & FLASH_SR_BSY) != 0)
+                {
+                    continue;
+                }
+            }
+        }
+    }
+
+    // Reset the processor
+    SCB->AIRCR = (0x5fa << SCB_AIRCR_VECTKEY_Pos) | SCB_AIRCR_SYSRESETREQ_Msk;
+
+    for (;;)
+    {
+        continue;
+    }
+}
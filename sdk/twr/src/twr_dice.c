@@ -1,6 +1,7 @@
 #include <twr_dice.h>
 
 #define _TWR_DICE_THRESHOLD 0.4f
+#define _TWR_DICE_RAW_ONE_G 16000
 
 const int8_t _twr_dice_vectors[][3] =
 {
@@ -14,6 +15,12 @@ const int8_t _twr_dice_vectors[][3] =
     [TWR_DICE_FACE_6] = { 0, 0, -1 }
 };
 
+static void _twr_dice_feed(twr_dice_t *self, twr_dice_face_t face);
+
+static void _twr_dice_check(twr_dice_t *self);
+
+static void _twr_dice_task(void *param);
+
 void twr_dice_init(twr_dice_t *self, twr_dice_face_t start)
 {
     memset(self, 0, sizeof(*self));
@@ -21,11 +28,52 @@ void twr_dice_init(twr_dice_t *self, twr_dice_face_t start)
     self->_face = start;
 
     self->_threshold = _TWR_DICE_THRESHOLD;
+
+    self->_dwell_samples = 1;
+
+    twr_dice_set_raw_one_g(self, _TWR_DICE_RAW_ONE_G);
 }
 
 void twr_dice_set_threshold(twr_dice_t *self, float threshold)
 {
     self->_threshold = threshold;
+
+    self->_raw_threshold = (int32_t) (threshold * self->_raw_one_g);
+}
+
+void twr_dice_set_hysteresis(twr_dice_t *self, float hysteresis)
+{
+    self->_hysteresis = hysteresis;
+
+    self->_raw_hysteresis = (int32_t) (hysteresis * self->_raw_one_g);
+}
+
+void twr_dice_set_dwell(twr_dice_t *self, uint8_t samples, twr_tick_t time)
+{
+    self->_dwell_samples = samples == 0 ? 1 : samples;
+    self->_dwell_time = time;
+
+    if (time != 0 && !self->_task_registered)
+    {
+        self->_task_id = twr_scheduler_register(_twr_dice_task, self, TWR_TICK_INFINITY);
+
+        self->_task_registered = true;
+    }
+}
+
+void twr_dice_set_event_handler(twr_dice_t *self, void (*event_handler)(twr_dice_t *, twr_dice_event_t, void *), void *event_param)
+{
+    self->_event_handler = event_handler;
+    self->_event_param = event_param;
+}
+
+void twr_dice_set_raw_one_g(twr_dice_t *self, int16_t one_g)
+{
+    self->_raw_one_g = one_g;
+
+    self->_raw_threshold = (int32_t) (self->_threshold * one_g);
+
+    self->_raw_hysteresis = (int32_t) (self->_hysteresis * one_g);
 }
 
 void twr_dice_feed_vectors(twr_dice_t *self, float x_axis, float y_axis, float z_axis)
@@ -34,25 +82,30 @@ void twr_dice_feed_vectors(twr_dice_t *self, float x_axis, float y_axis, float z
     int8_t vector_y = _twr_dice_vectors[self->_face][1];
     int8_t vector_z = _twr_dice_vectors[self->_face][2];
 
+    // Known face is left only beyond hysteresis band
+    float threshold = self->_face != TWR_DICE_FACE_UNKNOWN ? self->_threshold + self->_hysteresis : self->_threshold;
+
+    twr_dice_face_t face = self->_face;
+
     bool update = false;
 
-    if ((vector_x == 0 && (x_axis < -self->_threshold || x_axis > self->_threshold)) ||
-        (vector_x == 1 && (x_axis < 1.f - self->_threshold)) ||
-        (vector_x == -1 && (x_axis > -1.f + self->_threshold)))
+    if ((vector_x == 0 && (x_axis < -threshold || x_axis > threshold)) ||
+        (vector_x == 1 && (x_axis < 1.f - threshold)) ||
+        (vector_x == -1 && (x_axis > -1.f + threshold)))
     {
         update = true;
     }
 
-    if ((vector_y == 0 && (y_axis < -self->_threshold || y_axis > self->_threshold)) ||
-        (vector_y == 1 && (y_axis < 1.f - self->_threshold)) ||
-        (vector_y == -1 && (y_axis > -1.f + self->_threshold)))
+    if ((vector_y == 0 && (y_axis < -threshold || y_axis > threshold)) ||
+        (vector_y == 1 && (y_axis < 1.f - threshold)) ||
+        (vector_y == -1 && (y_axis > -1.f + threshold)))
     {
         update = true;
     }
 
-    if ((vector_z == 0 && (z_axis < -self->_threshold || z_axis > self->_threshold)) ||
-        (vector_z == 1 && (z_axis < 1.f - self->_threshold)) ||
-        (vector_z == -1 && (z_axis > -1.f + self->_threshold)))
+    if ((vector_z == 0 && (z_axis < -threshold || z_axis > threshold)) ||
+        (vector_z == 1 && (z_axis < 1.f - threshold)) ||
+        (vector_z == -1 && (z_axis > -1.f + threshold)))
     {
         update = true;
     }
@@ -73,13 +126,139 @@ void twr_dice_feed_vectors(twr_dice_t *self, float x_axis, float y_axis, float z
                 delta_y < 1.f - self->_threshold &&
                 delta_z < 1.f - self->_threshold)
             {
-                self->_face = i;
+                face = i;
+            }
+        }
+    }
+
+    _twr_dice_feed(self, face);
+}
+
+void twr_dice_feed_raw(twr_dice_t *self, int16_t x_axis, int16_t y_axis, int16_t z_axis)
+{
+    const int32_t axis[3] = { x_axis, y_axis, z_axis };
+    const int32_t one_g = self->_raw_one_g;
+    const int32_t threshold = self->_raw_threshold;
+
+    // Known face is left only beyond hysteresis band
+    const int32_t leave = self->_face != TWR_DICE_FACE_UNKNOWN ? threshold + self->_raw_hysteresis : threshold;
+
+    twr_dice_face_t face = self->_face;
+
+    bool update = false;
+
+    for (size_t j = 0; j < 3; j++)
+    {
+        int8_t vector = _twr_dice_vectors[self->_face][j];
+
+        if ((vector == 0 && (axis[j] < -leave || axis[j] > leave)) ||
+            (vector == 1 && (axis[j] < one_g - leave)) ||
+            (vector == -1 && (axis[j] > -one_g + leave)))
+        {
+            update = true;
+        }
+    }
+
+    if (update)
+    {
+        for (size_t i = 1; i <= 6; i++)
+        {
+            bool match = true;
+
+            for (size_t j = 0; j < 3; j++)
+            {
+                int32_t delta = _twr_dice_vectors[i][j] * one_g - axis[j];
+
+                if (delta < 0) { delta = -delta; }
+
+                if (delta >= one_g - threshold)
+                {
+                    match = false;
+                }
+            }
+
+            if (match)
+            {
+                face = i;
             }
         }
     }
+
+    _twr_dice_feed(self, face);
+}
+
+void twr_dice_feed_face(twr_dice_t *self, twr_dice_face_t face)
+{
+    if (face != TWR_DICE_FACE_UNKNOWN)
+    {
+        _twr_dice_feed(self, face);
+    }
 }
 
 twr_dice_face_t twr_dice_get_face(twr_dice_t *self)
 {
     return self->_face;
 }
+
+static void _twr_dice_feed(twr_dice_t *self, twr_dice_face_t face)
+{
+    if (face == self->_face)
+    {
+        // Back to current face, drop candidate
+        self->_candidate = TWR_DICE_FACE_UNKNOWN;
+        self->_candidate_count = 0;
+
+        return;
+    }
+
+    if (face != self->_candidate)
+    {
+        self->_candidate = face;
+        self->_candidate_count = 0;
+        self->_candidate_tick = twr_tick_get();
+    }
+
+    if (self->_candidate_count < UINT8_MAX)
+    {
+        self->_candidate_count++;
+    }
+
+    _twr_dice_check(self);
+}
+
+static void _twr_dice_check(twr_dice_t *self)
+{
+    if (self->_candidate == TWR_DICE_FACE_UNKNOWN || self->_candidate_count < self->_dwell_samples)
+    {
+        return;
+    }
+
+    twr_tick_t tick_accept = self->_candidate_tick + self->_dwell_time;
+
+    if (twr_tick_get() < tick_accept)
+    {
+        if (self->_task_registered)
+        {
+            twr_scheduler_plan_absolute(self->_task_id, tick_accept);
+        }
+
+        return;
+    }
+
+    self->_face = self->_candidate;
+
+    self->_candidate = TWR_DICE_FACE_UNKNOWN;
+    self->_candidate_count = 0;
+
+    if (self->_event_handler != NULL)
+    {
+        self->_event_handler(self, TWR_DICE_EVENT_FACE_CHANGE, self->_event_param);
+    }
+}
+
+static void _twr_dice_task(void *param)
+{
+    twr_dice_t *self = param;
+
+    _twr_dice_check(self);
+}
@@ -1,7 +1,9 @@
 #include <twr_dma.h>
 #include <twr_irq.h>
 #include <twr_scheduler.h>
-#include <twr_fifo.h>
+#include <twr_work.h>
+#include <twr_system.h>
+#include <twr_trace.h>
 #include <stm32l0xx.h>
 
 #define _TWR_DMA_CHECK_IRQ_OF_CHANNEL_(__CHANNEL) \
@@ -10,6 +12,7 @@
         if ((DMA1->ISR & DMA_ISR_TEIF##__CHANNEL) != 0) \
         { \
             _twr_dma_irq_handler(TWR_DMA_CHANNEL_##__CHANNEL, TWR_DMA_EVENT_ERROR); \
+            DMA1->IFCR |= DMA_IFCR_CTEIF##__CHANNEL; \
         } \
         else if ((DMA1->ISR & DMA_ISR_HTIF##__CHANNEL) != 0) \
         { \
@@ -25,12 +28,36 @@
 
 typedef struct
 {
-    uint8_t channel : 4;
-    uint8_t event : 4;
+    twr_dma_channel_t channel;
+    twr_dma_channel_t alternative;
+    twr_dma_request_t request;
 
-} twr_dma_pending_event_t;
+} twr_dma_line_map_t;
 
-static twr_dma_pending_event_t _twr_dma_pending_event_buffer[2 * 7 * sizeof(twr_dma_pending_event_t)];
+// Channel and request selection from reference manual, channel without alternative repeats itself
+static const twr_dma_line_map_t _twr_dma_line_map[] =
+{
+    [TWR_DMA_LINE_ADC]        = { TWR_DMA_CHANNEL_1, TWR_DMA_CHANNEL_2, TWR_DMA_REQUEST_0 },
+    [TWR_DMA_LINE_SPI1_RX]    = { TWR_DMA_CHANNEL_2, TWR_DMA_CHANNEL_2, TWR_DMA_REQUEST_1 },
+    [TWR_DMA_LINE_SPI1_TX]    = { TWR_DMA_CHANNEL_3, TWR_DMA_CHANNEL_3, TWR_DMA_REQUEST_1 },
+    [TWR_DMA_LINE_SPI2_RX]    = { TWR_DMA_CHANNEL_4, TWR_DMA_CHANNEL_6, TWR_DMA_REQUEST_2 },
+    [TWR_DMA_LINE_SPI2_TX]    = { TWR_DMA_CHANNEL_5, TWR_DMA_CHANNEL_7, TWR_DMA_REQUEST_2 },
+    [TWR_DMA_LINE_USART1_RX]  = { TWR_DMA_CHANNEL_3, TWR_DMA_CHANNEL_5, TWR_DMA_REQUEST_3 },
+    [TWR_DMA_LINE_USART1_TX]  = { TWR_DMA_CHANNEL_4, TWR_DMA_CHANNEL_2, TWR_DMA_REQUEST_3 },
+    [TWR_DMA_LINE_USART2_RX]  = { TWR_DMA_CHANNEL_6, TWR_DMA_CHANNEL_5, TWR_DMA_REQUEST_4 },
+    [TWR_DMA_LINE_USART2_TX]  = { TWR_DMA_CHANNEL_7, TWR_DMA_CHANNEL_4, TWR_DMA_REQUEST_4 },
+    [TWR_DMA_LINE_USART4_RX]  = { TWR_DMA_CHANNEL_6, TWR_DMA_CHANNEL_2, TWR_DMA_REQUEST_12 },
+    [TWR_DMA_LINE_USART4_TX]  = { TWR_DMA_CHANNEL_7, TWR_DMA_CHANNEL_3, TWR_DMA_REQUEST_12 },
+    [TWR_DMA_LINE_LPUART1_RX] = { TWR_DMA_CHANNEL_6, TWR_DMA_CHANNEL_3, TWR_DMA_REQUEST_5 },
+    [TWR_DMA_LINE_LPUART1_TX] = { TWR_DMA_CHANNEL_7, TWR_DMA_CHANNEL_2, TWR_DMA_REQUEST_5 },
+    [TWR_DMA_LINE_TIM2_UP]    = { TWR_DMA_CHANNEL_2, TWR_DMA_CHANNEL_2, TWR_DMA_REQUEST_8 },
+    [TWR_DMA_LINE_DAC1]       = { TWR_DMA_CHANNEL_2, TWR_DMA_CHANNEL_2, TWR_DMA_REQUEST_9 },
+    [TWR_DMA_LINE_DAC2]       = { TWR_DMA_CHANNEL_4, TWR_DMA_CHANNEL_4, TWR_DMA_REQUEST_15 },
+    [TWR_DMA_LINE_TIM2_CH2]   = { TWR_DMA_CHANNEL_3, TWR_DMA_CHANNEL_7, TWR_DMA_REQUEST_8 },
+    [TWR_DMA_LINE_AES_IN]     = { TWR_DMA_CHANNEL_5, TWR_DMA_CHANNEL_1, TWR_DMA_REQUEST_11 },
+    [TWR_DMA_LINE_AES_OUT]    = { TWR_DMA_CHANNEL_3, TWR_DMA_CHANNEL_2, TWR_DMA_REQUEST_11 },
+    [TWR_DMA_LINE_TIM3_UP]    = { TWR_DMA_CHANNEL_3, TWR_DMA_CHANNEL_3, TWR_DMA_REQUEST_10 }
+};
 
 static struct
 {
@@ -41,15 +68,25 @@ static struct
         DMA_Channel_TypeDef *instance;
         void (*event_handler)(twr_dma_channel_t, twr_dma_event_t, void *);
         void *event_param;
+        void (*irq_handler)(twr_dma_channel_t, twr_dma_event_t, void *);
+        void *irq_param;
 
     } channel[7];
 
-    twr_fifo_t fifo_pending;
-    twr_scheduler_task_id_t task_id;
+    uint8_t allocated;
+
+    struct
+    {
+        void (*event_handler)(twr_dma_event_t, void *);
+        void *event_param;
+
+    } memcpy[7];
 
 } _twr_dma;
 
-static void _twr_dma_task(void *param);
+static void _twr_dma_event_work(void *param);
+
+static void _twr_dma_memcpy_event_handler(twr_dma_channel_t channel, twr_dma_event_t event, void *event_param);
 
 static void _twr_dma_irq_handler(twr_dma_channel_t channel, twr_dma_event_t event);
 
@@ -69,10 +106,6 @@ void twr_dma_init(void)
     _twr_dma.channel[TWR_DMA_CHANNEL_6].instance = DMA1_Channel6;
     _twr_dma.channel[TWR_DMA_CHANNEL_7].instance = DMA1_Channel7;
 
-    twr_fifo_init(&_twr_dma.fifo_pending, _twr_dma_pending_event_buffer, sizeof(_twr_dma_pending_event_buffer));
-
-    _twr_dma.task_id = twr_scheduler_register(_twr_dma_task, NULL, TWR_TICK_INFINITY);
-
     // Enable DMA1
     RCC->AHBENR |= RCC_AHBENR_DMA1EN;
 
@@ -92,13 +125,77 @@ void twr_dma_init(void)
     NVIC_EnableIRQ(DMA1_Channel4_5_6_7_IRQn);
 }
 
+bool twr_dma_channel_allocate(twr_dma_line_t line, twr_dma_channel_t *channel, twr_dma_request_t *request)
+{
+    const twr_dma_line_map_t *map = &_twr_dma_line_map[line];
+
+    twr_dma_channel_t candidate;
+
+    uint32_t primask = twr_irq_save();
+
+    if ((_twr_dma.allocated & (1 << map->channel)) == 0)
+    {
+        candidate = map->channel;
+    }
+    else if ((_twr_dma.allocated & (1 << map->alternative)) == 0)
+    {
+        candidate = map->alternative;
+    }
+    else
+    {
+        twr_irq_restore(primask);
+
+        return false;
+    }
+
+    _twr_dma.allocated |= 1 << candidate;
+
+    twr_irq_restore(primask);
+
+    *channel = candidate;
+
+    if (request != NULL)
+    {
+        *request = map->request;
+    }
+
+    return true;
+}
+
+void twr_dma_channel_release(twr_dma_channel_t channel)
+{
+    uint32_t primask = twr_irq_save();
+
+    if (_twr_dma.channel[channel].instance != NULL)
+    {
+        twr_dma_channel_stop(channel);
+
+        // Clear all flags of channel, so next owner does not get stale events
+        DMA1->IFCR = DMA_IFCR_CGIF1 << (channel * 4);
+    }
+
+    _twr_dma.channel[channel].event_handler = NULL;
+    _twr_dma.channel[channel].event_param = NULL;
+    _twr_dma.channel[channel].irq_handler = NULL;
+    _twr_dma.channel[channel].irq_param = NULL;
+
+    _twr_dma.allocated &= ~(1 << channel);
+
+    twr_irq_restore(primask);
+}
+
+bool twr_dma_channel_is_allocated(twr_dma_channel_t channel)
+{
+    return (_twr_dma.allocated & (1 << channel)) != 0;
+}
+
 void twr_dma_channel_config(twr_dma_channel_t channel, twr_dma_channel_config_t *config)
 {
     DMA_Channel_TypeDef *dma_channel = _twr_dma.channel[channel].instance;
 
     uint32_t dma_cselr_pos = channel * 4;
 
-    twr_irq_disable();
+    uint32_t primask = twr_irq_save();
 
     // Set DMA direction
     if (config->direction == TWR_DMA_DIRECTION_TO_PERIPHERAL)
@@ -167,7 +264,7 @@ void twr_dma_channel_config(twr_dma_channel_t channel, twr_dma_channel_config_t
     // Enable the transfer complete, half-complete and error interrupts
     dma_channel->CCR |= DMA_CCR_TCIE | DMA_CCR_HTIE | DMA_CCR_TEIE;
 
-    twr_irq_enable();
+    twr_irq_restore(primask);
 }
 
 void twr_dma_set_event_handler(twr_dma_channel_t channel, void (*event_handler)(twr_dma_channel_t, twr_dma_event_t, void *), void *event_param)
@@ -176,6 +273,16 @@ void twr_dma_set_event_handler(twr_dma_channel_t channel, void (*event_handler)(
     _twr_dma.channel[channel].event_param = event_param;
 }
 
+void twr_dma_set_irq_handler(twr_dma_channel_t channel, void (*irq_handler)(twr_dma_channel_t, twr_dma_event_t, void *), void *irq_param)
+{
+    uint32_t primask = twr_irq_save();
+
+    _twr_dma.channel[channel].irq_handler = irq_handler;
+    _twr_dma.channel[channel].irq_param = irq_param;
+
+    twr_irq_restore(primask);
+}
+
 void twr_dma_channel_run(twr_dma_channel_t channel)
 {
     _twr_dma.channel[channel].instance->CCR |= DMA_CCR_EN;
@@ -191,49 +298,144 @@ size_t twr_dma_channel_get_length(twr_dma_channel_t channel)
     return (size_t) _twr_dma.channel[channel].instance->CNDTR;
 }
 
-void _twr_dma_task(void *param)
+bool twr_dma_memcpy_async(void *destination, const void *source, size_t length, void (*event_handler)(twr_dma_event_t, void *), void *event_param)
 {
-    (void) param;
+    bool word = (((uint32_t) destination | (uint32_t) source | length) & 3) == 0;
 
-    twr_dma_pending_event_t pending_event;
+    size_t count = word ? length / 4 : length;
 
-    while (twr_fifo_read(&_twr_dma.fifo_pending, &pending_event, sizeof(twr_dma_pending_event_t)) != 0)
+    if (count == 0 || count > 0xffff)
     {
-        if (_twr_dma.channel[pending_event.channel].event_handler != NULL)
+        return false;
+    }
+
+    // Memory to memory transfer does not use request line, any channel will do
+    uint8_t candidate;
+
+    uint32_t primask = twr_irq_save();
+
+    for (candidate = TWR_DMA_CHANNEL_1; candidate <= TWR_DMA_CHANNEL_7; candidate++)
+    {
+        if ((_twr_dma.allocated & (1 << candidate)) == 0)
         {
-            _twr_dma.channel[pending_event.channel].event_handler(pending_event.channel, pending_event.event, _twr_dma.channel[pending_event.channel].event_param);
+            break;
         }
     }
+
+    if (candidate > TWR_DMA_CHANNEL_7)
+    {
+        twr_irq_restore(primask);
+
+        return false;
+    }
+
+    _twr_dma.allocated |= 1 << candidate;
+
+    twr_irq_restore(primask);
+
+    twr_dma_channel_t channel = (twr_dma_channel_t) candidate;
+
+    twr_dma_init();
+
+    _twr_dma.memcpy[channel].event_handler = event_handler;
+    _twr_dma.memcpy[channel].event_param = event_param;
+
+    twr_dma_set_event_handler(channel, _twr_dma_memcpy_event_handler, NULL);
+
+    DMA_Channel_TypeDef *dma_channel = _twr_dma.channel[channel].instance;
+
+    // Core can sleep during the copy, but DMA does not run in stop mode
+    twr_system_deep_sleep_disable();
+
+    // Source is taken as peripheral side, both sides increment
+    dma_channel->CCR = DMA_CCR_MEM2MEM | DMA_CCR_MINC | DMA_CCR_PINC | DMA_CCR_TCIE | DMA_CCR_TEIE |
+            (word ? DMA_CCR_MSIZE_1 | DMA_CCR_PSIZE_1 : 0);
+
+    dma_channel->CNDTR = count;
+    dma_channel->CPAR = (uint32_t) source;
+    dma_channel->CMAR = (uint32_t) destination;
+
+    DMA1->IFCR = DMA_IFCR_CGIF1 << (channel * 4);
+
+    dma_channel->CCR |= DMA_CCR_EN;
+
+    return true;
 }
 
-void _twr_dma_irq_handler(twr_dma_channel_t channel, twr_dma_event_t event)
+static void _twr_dma_memcpy_event_handler(twr_dma_channel_t channel, twr_dma_event_t event, void *event_param)
+{
+    (void) event_param;
+
+    void (*event_handler)(twr_dma_event_t, void *) = _twr_dma.memcpy[channel].event_handler;
+    void *memcpy_event_param = _twr_dma.memcpy[channel].event_param;
+
+    twr_dma_channel_release(channel);
+
+    twr_system_deep_sleep_enable();
+
+    if (event_handler != NULL)
+    {
+        event_handler(event, memcpy_event_param);
+    }
+}
+
+static void _twr_dma_event_work(void *param)
+{
+    // Channel and event are packed into parameter of work item
+    twr_dma_channel_t channel = (twr_dma_channel_t) ((uintptr_t) param >> 8);
+    twr_dma_event_t event = (twr_dma_event_t) ((uintptr_t) param & 0xff);
+
+    if (_twr_dma.channel[channel].event_handler != NULL)
+    {
+        _twr_dma.channel[channel].event_handler(channel, event, _twr_dma.channel[channel].event_param);
+    }
+}
+
+TWR_RAMFUNC void _twr_dma_irq_handler(twr_dma_channel_t channel, twr_dma_event_t event)
 {
     if (event == TWR_DMA_EVENT_DONE && !(_twr_dma.channel[channel].instance->CCR & DMA_CCR_CIRC))
     {
         twr_dma_channel_stop(channel);
     }
 
-    twr_dma_pending_event_t pending_event = { channel, event };
+    if (_twr_dma.channel[channel].irq_handler != NULL)
+    {
+        _twr_dma.channel[channel].irq_handler(channel, event, _twr_dma.channel[channel].irq_param);
+    }
 
-    twr_fifo_irq_write(&_twr_dma.fifo_pending, &pending_event, sizeof(twr_dma_pending_event_t));
+    // Nothing to defer without event handler
+    if (_twr_dma.channel[channel].event_handler == NULL)
+    {
+        return;
+    }
 
-    twr_scheduler_plan_now(_twr_dma.task_id);
+    twr_work_post(_twr_dma_event_work, (void *) (((uintptr_t) channel << 8) | event));
 }
 
-void DMA1_Channel1_IRQHandler(void)
+TWR_RAMFUNC void DMA1_Channel1_IRQHandler(void)
 {
+    twr_trace_isr_enter(DMA1_Channel1_IRQn);
+
     _TWR_DMA_CHECK_IRQ_OF_CHANNEL_(1);
+
+    twr_trace_isr_exit(DMA1_Channel1_IRQn);
 }
 
-void DMA1_Channel2_3_IRQHandler(void)
+TWR_RAMFUNC void DMA1_Channel2_3_IRQHandler(void)
 {
+    twr_trace_isr_enter(DMA1_Channel2_3_IRQn);
+
     _TWR_DMA_CHECK_IRQ_OF_CHANNEL_(2);
 
     _TWR_DMA_CHECK_IRQ_OF_CHANNEL_(3);
+
+    twr_trace_isr_exit(DMA1_Channel2_3_IRQn);
 }
 
-void DMA1_Channel4_5_6_7_IRQHandler(void)
+TWR_RAMFUNC void DMA1_Channel4_5_6_7_IRQHandler(void)
 {
+    twr_trace_isr_enter(DMA1_Channel4_5_6_7_IRQn);
+
     _TWR_DMA_CHECK_IRQ_OF_CHANNEL_(4);
 
     _TWR_DMA_CHECK_IRQ_OF_CHANNEL_(5);
@@ -241,4 +443,6 @@ void DMA1_Channel4_5_6_7_IRQHandler(void)
     _TWR_DMA_CHECK_IRQ_OF_CHANNEL_(6);
 
     _TWR_DMA_CHECK_IRQ_OF_CHANNEL_(7);
+
+    twr_trace_isr_exit(DMA1_Channel4_5_6_7_IRQn);
 }
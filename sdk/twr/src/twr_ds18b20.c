@@ -1,9 +1,12 @@
+#define TWR_LOG_MODULE TWR_LOG_MODULE_SENSOR
+
 #include <twr_ds18b20.h>
 #include <twr_onewire.h>
 #include <twr_gpio.h>
 #include <twr_i2c.h>
 #include <twr_module_sensor.h>
 #include <twr_log.h>
+#include <twr_eeprom.h>
 
 #define _TWR_DS18B20_SCRATCHPAD_SIZE 9
 #define _TWR_DS18B20_DELAY_RUN 5000
@@ -16,6 +19,9 @@ static twr_tick_t _twr_ds18b20_lut_delay[] = {
     [TWR_DS18B20_RESOLUTION_BITS_12] = 760
 };
 
+// DS18S20 converts always with 9 bit resolution in 750 ms
+#define _TWR_DS18B20_DELAY_DS18S20 760
+
 static void _twr_ds18b20_task_interval(void *param);
 
 static void _twr_ds18b20_task_measure(void *param);
@@ -131,7 +137,9 @@ void twr_ds18b20_rescan(twr_ds18b20_t *self)
     }
 
     self->_measurement_active = true;
-    
+
+    self->_rom_cache_stale = true;
+
     self->_state = self->_sensor_found = 0;
 
     self->_state = TWR_DS18B20_STATE_PREINITIALIZE;
@@ -139,6 +147,12 @@ void twr_ds18b20_rescan(twr_ds18b20_t *self)
     twr_scheduler_plan_absolute(self->_task_id_measure, _TWR_DS18B20_DELAY_RUN);
 }
 
+void twr_ds18b20_set_rom_cache(twr_ds18b20_t *self, uint32_t eeprom_address)
+{
+    self->_rom_cache = true;
+    self->_rom_cache_address = eeprom_address;
+}
+
 void twr_ds18b20_set_power_dynamic(twr_ds18b20_t *self, bool on)
 {
     self->_power_dynamic = on;
@@ -246,6 +260,106 @@ static bool _twr_ds18b20_power_down(twr_ds18b20_t *self)
     return true;
 }
 
+static twr_tick_t _twr_ds18b20_conversion_time(twr_ds18b20_t *self)
+{
+    twr_tick_t delay = _twr_ds18b20_lut_delay[self->_resolution];
+
+    // Conversion is started on all sensors at once, result is read after the slowest one
+    for (int i = 0; i < self->_sensor_found; i++)
+    {
+        if ((self->_sensor[i]._device_address & 0xff) == 0x10)
+        {
+            return delay > _TWR_DS18B20_DELAY_DS18S20 ? delay : _TWR_DS18B20_DELAY_DS18S20;
+        }
+    }
+
+    return delay;
+}
+
+static uint8_t _twr_ds18b20_rom_cache_crc(twr_ds18b20_t *self, int count)
+{
+    uint8_t crc = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        crc = twr_onewire_crc8(&self->_sensor[i]._device_address, sizeof(uint64_t), crc);
+    }
+
+    return crc;
+}
+
+static bool _twr_ds18b20_rom_cache_load(twr_ds18b20_t *self)
+{
+    if (!self->_rom_cache || self->_rom_cache_stale)
+    {
+        return false;
+    }
+
+    uint8_t header[2];
+
+    if (!twr_eeprom_read(self->_rom_cache_address, header, sizeof(header)))
+    {
+        return false;
+    }
+
+    if (header[0] == 0 || header[0] > self->_sensor_count)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < header[0]; i++)
+    {
+        if (!twr_eeprom_read(self->_rom_cache_address + 2 + i * sizeof(uint64_t), &self->_sensor[i]._device_address, sizeof(uint64_t)))
+        {
+            return false;
+        }
+    }
+
+    if (_twr_ds18b20_rom_cache_crc(self, header[0]) != header[1])
+    {
+        return false;
+    }
+
+    for (int i = 0; i < header[0]; i++)
+    {
+        if (!twr_onewire_verify(self->_onewire, &self->_sensor[i]._device_address))
+        {
+            #ifdef TWR_DS18B20_LOG
+            twr_log_debug("twr_ds18b20: Cached 0x%08llx missing", self->_sensor[i]._device_address);
+            #endif
+
+            return false;
+        }
+
+        self->_sensor[i]._temperature_valid = false;
+    }
+
+    self->_sensor_found = header[0];
+
+    return true;
+}
+
+static void _twr_ds18b20_rom_cache_store(twr_ds18b20_t *self)
+{
+    uint8_t header[2] = { self->_sensor_found, _twr_ds18b20_rom_cache_crc(self, self->_sensor_found) };
+    uint8_t stored[2];
+
+    self->_rom_cache_stale = false;
+
+    // Same set of sensors is found after most errors, spare the EEPROM
+    if (twr_eeprom_read(self->_rom_cache_address, stored, sizeof(stored)) && memcmp(header, stored, sizeof(header)) == 0)
+    {
+        return;
+    }
+
+    for (int i = 0; i < self->_sensor_found; i++)
+    {
+        twr_eeprom_write(self->_rom_cache_address + 2 + i * sizeof(uint64_t), &self->_sensor[i]._device_address, sizeof(uint64_t));
+    }
+
+    twr_eeprom_write(self->_rom_cache_address, header, sizeof(header));
+}
+
 static bool _twr_ds18b20_is_scratchpad_valid(uint8_t *scratchpad)
 {
     #ifdef TWR_DS18B20_STRICT_VALIDATION
@@ -330,23 +444,31 @@ static void _twr_ds18b20_task_measure(void *param)
             uint64_t _device_address = 0;
             self->_sensor_found = 0;
 
-            twr_onewire_search_start(self->_onewire, 0);
-            while ((self->_sensor_found < self->_sensor_count) && twr_onewire_search_next(self->_onewire, &_device_address))
+            if (!_twr_ds18b20_rom_cache_load(self))
             {
-                self->_sensor[self->_sensor_found]._device_address = _device_address;
-                self->_sensor[self->_sensor_found]._temperature_valid = false;
+                twr_onewire_search_start(self->_onewire, 0);
+                while ((self->_sensor_found < self->_sensor_count) && twr_onewire_search_next(self->_onewire, &_device_address))
+                {
+                    self->_sensor[self->_sensor_found]._device_address = _device_address;
+                    self->_sensor[self->_sensor_found]._temperature_valid = false;
 
-                _device_address++;
-                self->_sensor_found++;
+                    _device_address++;
+                    self->_sensor_found++;
 
-                #ifdef TWR_DS18B20_LOG
-                twr_log_debug("twr_ds18b20: Found 0x%08llx", _device_address);
-                #endif
-            }
+                    #ifdef TWR_DS18B20_LOG
+                    twr_log_debug("twr_ds18b20: Found 0x%08llx", _device_address);
+                    #endif
+                }
 
-            if (self->_sensor_found == 0)
-            {
-                goto start;
+                if (self->_sensor_found == 0)
+                {
+                    goto start;
+                }
+
+                if (self->_rom_cache)
+                {
+                    _twr_ds18b20_rom_cache_store(self);
+                }
             }
 
             twr_onewire_transaction_start(self->_onewire);
@@ -439,7 +561,7 @@ static void _twr_ds18b20_task_measure(void *param)
 
             self->_state = TWR_DS18B20_STATE_READ;
 
-            twr_scheduler_plan_current_from_now(_twr_ds18b20_lut_delay[self->_resolution]);
+            twr_scheduler_plan_current_from_now(_twr_ds18b20_conversion_time(self));
 
             return;
         }
@@ -1,3 +1,5 @@
+#define TWR_LOG_MODULE TWR_LOG_MODULE_ONEWIRE
+
 #include <twr_ds2484.h>
 #include <twr_i2c.h>
 #include <twr_gpio.h>
@@ -31,11 +33,22 @@
 
 #define _TWR_DS2484_CFG_DEFAULT (_TWR_DS2484_CFG_APU)
 
+// Duration of 1-Wire reset and time slot in microseconds at standard and overdrive speed
+#define _TWR_DS2484_RESET_US_STANDARD 1148
+#define _TWR_DS2484_RESET_US_OVERDRIVE 146
+#define _TWR_DS2484_SLOT_US_STANDARD 69
+#define _TWR_DS2484_SLOT_US_OVERDRIVE 10
+
+// Interval of status polling after expected duration elapsed
+#define _TWR_DS2484_POLL_US 20
+#define _TWR_DS2484_POLL_LIMIT 1000
+
 static bool _twr_ds2484_i2c_read_byte(twr_ds2484_t *self, uint8_t *b);
 static bool _twr_ds2484_i2c_write_byte(twr_ds2484_t *self, const uint8_t b);
 static bool _twr_ds2484_device_reset(twr_ds2484_t *self);
 static bool _twr_ds2484_write_config(twr_ds2484_t *self, const uint8_t cfg);
 static bool _twr_ds2484_set_reed_pointer(twr_ds2484_t *self, uint8_t srp);
+static void _twr_ds2484_set_busy(twr_ds2484_t *self, int slots);
 
 bool twr_ds2484_init(twr_ds2484_t *self, twr_i2c_channel_t i2c_channel)
 {
@@ -75,7 +88,9 @@ void twr_ds2484_enable(twr_ds2484_t *self)
         return;
     }
 
-    if (!_twr_ds2484_write_config(self, _TWR_DS2484_CFG_DEFAULT))
+    self->_busy = false;
+
+    if (!_twr_ds2484_write_config(self, _TWR_DS2484_CFG_DEFAULT | (self->_speed == TWR_DS2484_SPEED_OVERDRIVE ? _TWR_DS2484_CFG_1WS : 0)))
     {
         twr_log_error("TWR_DS2484: set config");
 
@@ -113,6 +128,8 @@ bool twr_ds2484_reset(twr_ds2484_t *self)
 
     self->_srp = _TWR_DS2484_REG_ST;
 
+    _twr_ds2484_set_busy(self, -1);
+
     if (!twr_ds2484_busy_wait(self))
     {
         return false;
@@ -122,6 +139,23 @@ bool twr_ds2484_reset(twr_ds2484_t *self)
     return (self->_status & TWR_DS2484_STATUS_PPD) != 0;
 }
 
+bool twr_ds2484_set_speed(twr_ds2484_t *self, twr_ds2484_speed_t speed)
+{
+    self->_speed = speed;
+
+    if (!self->_ready)
+    {
+        return true;
+    }
+
+    if (!twr_ds2484_busy_wait(self))
+    {
+        return false;
+    }
+
+    return _twr_ds2484_write_config(self, _TWR_DS2484_CFG_DEFAULT | (speed == TWR_DS2484_SPEED_OVERDRIVE ? _TWR_DS2484_CFG_1WS : 0));
+}
+
 bool twr_ds2484_busy_wait(twr_ds2484_t *self)
 {
     if (!self->_ready)
@@ -129,14 +163,20 @@ bool twr_ds2484_busy_wait(twr_ds2484_t *self)
         return false;
     }
 
-    int limit = 100;
+    // Status is known since the last command has been seen done
+    if (!self->_busy)
+    {
+        return true;
+    }
+
+    twr_delay_us(self->_busy_us);
 
     if (!_twr_ds2484_set_reed_pointer(self, _TWR_DS2484_REG_ST))
     {
         return false;
     }
 
-    while(limit--)
+    for (int i = 0; i < _TWR_DS2484_POLL_LIMIT; i++)
     {
         if (!_twr_ds2484_i2c_read_byte(self, &self->_status))
         {
@@ -145,10 +185,12 @@ bool twr_ds2484_busy_wait(twr_ds2484_t *self)
 
         if ((self->_status & TWR_DS2484_STATUS_1WB) == 0)
         {
+            self->_busy = false;
+
             return true;
         }
 
-        twr_delay_us(1000);
+        twr_delay_us(_TWR_DS2484_POLL_US);
     }
 
     return false;
@@ -168,6 +210,8 @@ bool twr_ds2484_write_byte(twr_ds2484_t *self, const uint8_t byte)
 
     self->_srp = _TWR_DS2484_REG_ST;
 
+    _twr_ds2484_set_busy(self, 8);
+
     return true;
 }
 
@@ -185,20 +229,21 @@ bool twr_ds2484_read_byte(twr_ds2484_t *self, uint8_t *byte)
 
     self->_srp = _TWR_DS2484_REG_ST;
 
+    _twr_ds2484_set_busy(self, 8);
+
     if (!twr_ds2484_busy_wait(self))
     {
         return false;
     }
 
-    if (!_twr_ds2484_set_reed_pointer(self, _TWR_DS2484_REG_DATA))
+    // Set read pointer and read data register in one transaction with repeated start
+    if (!twr_i2c_memory_read_8b(self->_i2c_channel, _TWR_DS2484_I2C_ADDRESS,
+            TWR_I2C_MEMORY_ADDRESS_16_BIT | _TWR_DS2484_CMD_SRP << 8 | _TWR_DS2484_REG_DATA, byte))
     {
         return false;
     }
 
-    if (!_twr_ds2484_i2c_read_byte(self, byte))
-    {
-        return false;
-    }
+    self->_srp = _TWR_DS2484_REG_DATA;
 
     return true;
 }
@@ -210,24 +255,22 @@ bool twr_ds2484_read_bit(twr_ds2484_t *self, uint8_t *bit)
         return false;
     }
 
-    if (!_twr_ds2484_i2c_write_byte(self, _TWR_DS2484_CMD_1WSB))
+    // Writing 1 bit generates read time slot
+    if (!twr_i2c_memory_write_8b(self->_i2c_channel, _TWR_DS2484_I2C_ADDRESS, _TWR_DS2484_CMD_1WSB, 0x80))
     {
         return false;
     }
 
     self->_srp = _TWR_DS2484_REG_ST;
 
-    if (!twr_ds2484_busy_wait(self))
-    {
-        return false;
-    }
+    _twr_ds2484_set_busy(self, 1);
 
-    if (!_twr_ds2484_i2c_read_byte(self, bit))
+    if (!twr_ds2484_busy_wait(self))
     {
         return false;
     }
 
-    *bit = *bit & 0x80 ? 1 : 0;
+    *bit = self->_status & TWR_DS2484_STATUS_SBR ? 1 : 0;
 
     return true;
 }
@@ -246,6 +289,34 @@ bool twr_ds2484_triplet(twr_ds2484_t *self, const uint8_t direction)
 
     self->_srp = _TWR_DS2484_REG_ST;
 
+    _twr_ds2484_set_busy(self, 3);
+
+    return true;
+}
+
+bool twr_ds2484_write(twr_ds2484_t *self, const void *buffer, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        if (!twr_ds2484_write_byte(self, ((const uint8_t *) buffer)[i]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool twr_ds2484_read(twr_ds2484_t *self, void *buffer, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        if (!twr_ds2484_read_byte(self, &((uint8_t *) buffer)[i]))
+        {
+            return false;
+        }
+    }
+
     return true;
 }
 
@@ -297,6 +368,8 @@ static bool _twr_ds2484_device_reset(twr_ds2484_t *self)
 
     self->_srp = _TWR_DS2484_REG_ST;
 
+    self->_busy = false;
+
     twr_delay_us(1000);
 
     return true;
@@ -340,3 +413,20 @@ static bool _twr_ds2484_set_reed_pointer(twr_ds2484_t *self, uint8_t srp)
     }
     return true;
 }
+
+static void _twr_ds2484_set_busy(twr_ds2484_t *self, int slots)
+{
+    bool overdrive = self->_speed == TWR_DS2484_SPEED_OVERDRIVE;
+
+    self->_busy = true;
+
+    // Negative number of slots stands for reset
+    if (slots < 0)
+    {
+        self->_busy_us = overdrive ? _TWR_DS2484_RESET_US_OVERDRIVE : _TWR_DS2484_RESET_US_STANDARD;
+    }
+    else
+    {
+        self->_busy_us = slots * (overdrive ? _TWR_DS2484_SLOT_US_OVERDRIVE : _TWR_DS2484_SLOT_US_STANDARD);
+    }
+}
@@ -2,14 +2,18 @@
 #include <twr_tick.h>
 #include <twr_log.h>
 
-static const twr_gpio_channel_t _twr_ds28e17_set_speed_lut[2] =
+static const twr_gpio_channel_t _twr_ds28e17_set_speed_lut[3] =
 {
         [TWR_I2C_SPEED_100_KHZ] = 0x00,
-        [TWR_I2C_SPEED_400_KHZ] = 0x01
+        [TWR_I2C_SPEED_400_KHZ] = 0x01,
+        [TWR_I2C_SPEED_1_MHZ] = 0x02 // DS28E17 maximum is 900 kHz
 };
 
 static bool _twr_ds28e17_write(twr_ds28e17_t *self, uint8_t *head, size_t head_length, void *buffer, size_t length);
 static bool _twr_ds28e17_read(twr_ds28e17_t *self, uint8_t *head, size_t head_length, void *buffer, size_t length);
+static bool _twr_ds28e17_command(twr_ds28e17_t *self, bool resume, uint8_t *head, size_t head_length, const void *write_buffer, size_t write_length, void *read_buffer, size_t read_length);
+static size_t _twr_ds28e17_memory_write_head(const twr_i2c_memory_transfer_t *transfer, uint8_t *head);
+static size_t _twr_ds28e17_memory_read_head(const twr_i2c_memory_transfer_t *transfer, uint8_t *head);
 
 void twr_ds28e17_init(twr_ds28e17_t *self, twr_onewire_t *onewire, uint64_t device_number)
 {
@@ -81,104 +85,114 @@ bool twr_ds28e17_read(twr_ds28e17_t *self, const twr_i2c_transfer_t *transfer)
 
 bool twr_ds28e17_memory_write(twr_ds28e17_t *self, const twr_i2c_memory_transfer_t *transfer)
 {
-    size_t head_length;
     uint8_t head[5];
 
-    head[0] = 0x4B;
-    head[1] = transfer->device_address << 1;
-
-    if ((transfer->memory_address & TWR_I2C_MEMORY_ADDRESS_16_BIT) != 0)
-    {
-        head_length = 5;
-        head[2] = (uint8_t) transfer->length + 2;
-        head[3] = transfer->memory_address >> 8;
-        head[4] = transfer->memory_address;
-    }
-    else
-    {
-        head_length = 4;
-        head[2] = (uint8_t) transfer->length + 1;
-        head[3] = (uint8_t) transfer->memory_address;
-    }
+    size_t head_length = _twr_ds28e17_memory_write_head(transfer, head);
 
     return _twr_ds28e17_write(self, head, head_length, transfer->buffer, transfer->length);
 }
 
 bool twr_ds28e17_memory_read(twr_ds28e17_t *self, const twr_i2c_memory_transfer_t *transfer)
 {
-    size_t head_length;
     uint8_t head[6];
 
-    head[0] = 0x2D;
-    head[1] = transfer->device_address << 1;
-
-    if ((transfer->memory_address & TWR_I2C_MEMORY_ADDRESS_16_BIT) != 0)
-    {
-        head_length = 6;
-        head[2] = 2;
-        head[3] = transfer->memory_address >> 8;
-        head[4] = transfer->memory_address;
-        head[5] = transfer->length;
-    }
-    else
-    {
-        head_length = 5;
-        head[2] = 1;
-        head[3] = transfer->memory_address;
-        head[4] = transfer->length;
-    }
+    size_t head_length = _twr_ds28e17_memory_read_head(transfer, head);
 
     return _twr_ds28e17_read(self, head, head_length, transfer->buffer, transfer->length);
 }
 
-static bool _twr_ds28e17_write(twr_ds28e17_t *self, uint8_t *head, size_t head_length, void *buffer, size_t length)
+size_t twr_ds28e17_memory_batch(twr_ds28e17_t *self, twr_i2c_batch_t *batch, size_t count)
 {
+    size_t done = 0;
+
     twr_onewire_transaction_start(self->_onewire);
 
+    // Wake up from sleep mode
     twr_onewire_reset(self->_onewire);
 
-    if (!twr_onewire_reset(self->_onewire))
+    for (size_t i = 0; i < count; i++)
     {
-        twr_onewire_transaction_stop(self->_onewire);
+        // ROM is matched by the first command only, the following ones resume it
+        bool resume = (i != 0) && (self->_device_number != TWR_ONEWIRE_DEVICE_NUMBER_SKIP_ROM);
 
-        return false;
-    }
+        uint8_t head[6];
 
-    uint16_t crc16 = twr_onewire_crc16(head, head_length, 0x00);
+        size_t head_length;
 
-    crc16 = twr_onewire_crc16(buffer, length, crc16);
+        if (batch[i].write)
+        {
+            head_length = _twr_ds28e17_memory_write_head(&batch[i].transfer, head);
 
-    twr_onewire_select(self->_onewire, &self->_device_number);
+            batch[i].success = _twr_ds28e17_command(self, resume, head, head_length, batch[i].transfer.buffer, batch[i].transfer.length, NULL, 0);
+        }
+        else
+        {
+            head_length = _twr_ds28e17_memory_read_head(&batch[i].transfer, head);
 
-    twr_onewire_write(self->_onewire, head, head_length);
+            batch[i].success = _twr_ds28e17_command(self, resume, head, head_length, NULL, 0, batch[i].transfer.buffer, batch[i].transfer.length);
+        }
 
-    twr_onewire_write(self->_onewire, buffer, length);
+        done += batch[i].success ? 1 : 0;
+    }
 
-    crc16 = ~crc16;
+    twr_onewire_transaction_stop(self->_onewire);
 
-    twr_onewire_write(self->_onewire, &crc16, sizeof(crc16));
+    return done;
+}
 
-    twr_tick_t timeout = twr_tick_get() + 50;
+static size_t _twr_ds28e17_memory_write_head(const twr_i2c_memory_transfer_t *transfer, uint8_t *head)
+{
+    head[0] = 0x4B;
+    head[1] = transfer->device_address << 1;
 
-    while (twr_onewire_read_bit(self->_onewire) != 0)
+    if ((transfer->memory_address & TWR_I2C_MEMORY_ADDRESS_16_BIT) != 0)
     {
-        if (timeout < twr_tick_get())
-        {
-            twr_onewire_transaction_stop(self->_onewire);
+        head[2] = (uint8_t) transfer->length + 2;
+        head[3] = transfer->memory_address >> 8;
+        head[4] = transfer->memory_address;
 
-            return false;
-        }
+        return 5;
+    }
 
-        continue;
+    head[2] = (uint8_t) transfer->length + 1;
+    head[3] = (uint8_t) transfer->memory_address;
+
+    return 4;
+}
+
+static size_t _twr_ds28e17_memory_read_head(const twr_i2c_memory_transfer_t *transfer, uint8_t *head)
+{
+    head[0] = 0x2D;
+    head[1] = transfer->device_address << 1;
+
+    if ((transfer->memory_address & TWR_I2C_MEMORY_ADDRESS_16_BIT) != 0)
+    {
+        head[2] = 2;
+        head[3] = transfer->memory_address >> 8;
+        head[4] = transfer->memory_address;
+        head[5] = transfer->length;
+
+        return 6;
     }
 
-    uint8_t status = twr_onewire_read_byte(self->_onewire);
+    head[2] = 1;
+    head[3] = transfer->memory_address;
+    head[4] = transfer->length;
 
-    uint8_t write_status = twr_onewire_read_byte(self->_onewire);
+    return 5;
+}
+
+static bool _twr_ds28e17_write(twr_ds28e17_t *self, uint8_t *head, size_t head_length, void *buffer, size_t length)
+{
+    twr_onewire_transaction_start(self->_onewire);
+
+    twr_onewire_reset(self->_onewire);
+
+    bool success = _twr_ds28e17_command(self, false, head, head_length, buffer, length, NULL, 0);
 
     twr_onewire_transaction_stop(self->_onewire);
 
-    return (status == 0x00) && (write_status == 0x00);
+    return success;
 }
 
 static bool _twr_ds28e17_read(twr_ds28e17_t *self, uint8_t *head, size_t head_length, void *buffer, size_t length)
@@ -187,19 +201,38 @@ static bool _twr_ds28e17_read(twr_ds28e17_t *self, uint8_t *head, size_t head_le
 
     twr_onewire_reset(self->_onewire);
 
+    bool success = _twr_ds28e17_command(self, false, head, head_length, NULL, 0, buffer, length);
+
+    twr_onewire_transaction_stop(self->_onewire);
+
+    return success;
+}
+
+static bool _twr_ds28e17_command(twr_ds28e17_t *self, bool resume, uint8_t *head, size_t head_length, const void *write_buffer, size_t write_length, void *read_buffer, size_t read_length)
+{
     if (!twr_onewire_reset(self->_onewire))
     {
-        twr_onewire_transaction_stop(self->_onewire);
-
         return false;
     }
 
     uint16_t crc16 = twr_onewire_crc16(head, head_length, 0x00);
 
-    twr_onewire_select(self->_onewire, &self->_device_number);
+    crc16 = twr_onewire_crc16(write_buffer, write_length, crc16);
+
+    if (resume)
+    {
+        // Resume command selects the device matched last
+        twr_onewire_write_byte(self->_onewire, 0xA5);
+    }
+    else
+    {
+        twr_onewire_select(self->_onewire, &self->_device_number);
+    }
 
     twr_onewire_write(self->_onewire, head, head_length);
 
+    twr_onewire_write(self->_onewire, write_buffer, write_length);
+
     crc16 = ~crc16;
 
     twr_onewire_write(self->_onewire, &crc16, sizeof(crc16));
@@ -210,8 +243,6 @@ static bool _twr_ds28e17_read(twr_ds28e17_t *self, uint8_t *head, size_t head_le
     {
         if (timeout < twr_tick_get())
         {
-            twr_onewire_transaction_stop(self->_onewire);
-
             return false;
         }
 
@@ -220,18 +251,15 @@ static bool _twr_ds28e17_read(twr_ds28e17_t *self, uint8_t *head, size_t head_le
 
     uint8_t status = twr_onewire_read_byte(self->_onewire);
 
+    // Read Data command has no write status
     uint8_t write_status = head[0] == 0x87 ? 0 : twr_onewire_read_byte(self->_onewire);
 
     if ((status != 0x00) || (write_status != 0x00))
     {
-        twr_onewire_transaction_stop(self->_onewire);
-
         return false;
     }
 
-    twr_onewire_read(self->_onewire, buffer, length);
-
-    twr_onewire_transaction_stop(self->_onewire);
+    twr_onewire_read(self->_onewire, read_buffer, read_length);
 
     return true;
 }
@@ -9,14 +9,23 @@
 #define _TWR_EEPROM_END  DATA_EEPROM_BANK2_END
 #define _TWR_EEPROM_IS_BUSY() ((FLASH->SR & FLASH_SR_BSY) != 0UL)
 
-static struct
+typedef struct
 {
-    bool running;
     uint32_t address;
     uint8_t *buffer;
     size_t length;
     void (*event_handler)(twr_eepromc_event_t, void *);
     void *event_param;
+    bool superseded;
+
+} _twr_eeprom_request_t;
+
+static struct
+{
+    bool running;
+    _twr_eeprom_request_t queue[TWR_EEPROM_ASYNC_QUEUE_LENGTH];
+    int head;
+    int count;
     size_t i;
     twr_scheduler_task_id_t task_id;
 
@@ -69,33 +78,56 @@ bool twr_eeprom_write(uint32_t address, const void *buffer, size_t length)
 
 bool twr_eeprom_async_write(uint32_t address, const void *buffer, size_t length, void (*event_handler)(twr_eepromc_event_t, void *), void *event_param)
 {
-    if (_twr_eeprom.running)
+    if (_twr_eeprom.count == TWR_EEPROM_ASYNC_QUEUE_LENGTH)
     {
         return false;
     }
 
-    _twr_eeprom.address = address += _TWR_EEPROM_BASE;
+    // Add EEPROM base offset to address
+    address += _TWR_EEPROM_BASE;
 
     // If user attempts to write outside EEPROM area...
-    if ((_twr_eeprom.address + length) > (_TWR_EEPROM_END + 1))
+    if ((address + length) > (_TWR_EEPROM_END + 1))
     {
         // Indicate failure
         return false;
     }
 
-    _twr_eeprom.buffer = (uint8_t *) buffer;
+    // Waiting writes covered by the new one would be overwritten anyway, the one in progress is finished
+    for (int i = 1; i < _twr_eeprom.count; i++)
+    {
+        _twr_eeprom_request_t *request = &_twr_eeprom.queue[(_twr_eeprom.head + i) % TWR_EEPROM_ASYNC_QUEUE_LENGTH];
 
-    _twr_eeprom.length = length;
+        if ((request->address >= address) && (request->address + request->length <= address + length))
+        {
+            request->superseded = true;
+        }
+    }
 
-    _twr_eeprom.event_handler = event_handler;
+    _twr_eeprom_request_t *request = &_twr_eeprom.queue[(_twr_eeprom.head + _twr_eeprom.count) % TWR_EEPROM_ASYNC_QUEUE_LENGTH];
 
-    _twr_eeprom.event_param = event_param;
+    request->address = address;
 
-    _twr_eeprom.i = 0;
+    request->buffer = (uint8_t *) buffer;
+
+    request->length = length;
+
+    request->event_handler = event_handler;
+
+    request->event_param = event_param;
+
+    request->superseded = false;
+
+    _twr_eeprom.count++;
+
+    if (!_twr_eeprom.running)
+    {
+        _twr_eeprom.i = 0;
 
-    _twr_eeprom.task_id = twr_scheduler_register(_twr_eeprom_async_write_task, NULL, 0);
+        _twr_eeprom.task_id = twr_scheduler_register(_twr_eeprom_async_write_task, NULL, 0);
 
-    _twr_eeprom.running = true;
+        _twr_eeprom.running = true;
+    }
 
     return true;
 }
@@ -108,6 +140,8 @@ void twr_eeprom_async_cancel(void)
 
         _twr_eeprom.running = false;
     }
+
+    _twr_eeprom.count = 0;
 }
 
 bool twr_eeprom_read(uint32_t address, void *buffer, size_t length)
@@ -258,41 +292,62 @@ static void _twr_eeprom_async_write_task(void *param)
         return;
     }
 
-    _twr_eeprom_unlock();
+    _twr_eeprom_request_t *request = &_twr_eeprom.queue[_twr_eeprom.head];
 
-    while(_twr_eeprom.i < _twr_eeprom.length)
+    if (!request->superseded)
     {
-        if(_twr_eeprom_write(_twr_eeprom.address, &_twr_eeprom.i, _twr_eeprom.buffer, _twr_eeprom.length))
+        _twr_eeprom_unlock();
+
+        while (_twr_eeprom.i < request->length)
         {
-            break;
+            if (_twr_eeprom_write(request->address, &_twr_eeprom.i, request->buffer, request->length))
+            {
+                break;
+            }
         }
-    };
 
-    _twr_eeprom_lock();
+        _twr_eeprom_lock();
 
-    if(_twr_eeprom.i < _twr_eeprom.length)
-    {
-        twr_scheduler_plan_current_now();
+        if (_twr_eeprom.i < request->length)
+        {
+            twr_scheduler_plan_current_now();
 
-        return;
+            return;
+        }
     }
 
-    _twr_eeprom.running = false;
+    // Request leaves queue before handler which may queue another one
+    _twr_eeprom_request_t done = *request;
+
+    _twr_eeprom.head = (_twr_eeprom.head + 1) % TWR_EEPROM_ASYNC_QUEUE_LENGTH;
+
+    _twr_eeprom.count--;
 
-    twr_scheduler_unregister(_twr_eeprom.task_id);
+    _twr_eeprom.i = 0;
+
+    if (_twr_eeprom.count == 0)
+    {
+        _twr_eeprom.running = false;
+
+        twr_scheduler_unregister(_twr_eeprom.task_id);
+    }
+    else
+    {
+        twr_scheduler_plan_current_now();
+    }
 
-    if (memcmp(_twr_eeprom.buffer, (void *) _twr_eeprom.address, _twr_eeprom.length) != 0UL)
+    if (!done.superseded && (memcmp(done.buffer, (void *) done.address, done.length) != 0UL))
     {
-        if (_twr_eeprom.event_handler != NULL)
+        if (done.event_handler != NULL)
         {
-            _twr_eeprom.event_handler(TWR_EEPROM_EVENT_ASYNC_WRITE_ERROR, _twr_eeprom.event_param);
+            done.event_handler(TWR_EEPROM_EVENT_ASYNC_WRITE_ERROR, done.event_param);
         }
     }
     else
     {
-        if (_twr_eeprom.event_handler != NULL)
+        if (done.event_handler != NULL)
         {
-            _twr_eeprom.event_handler(TWR_EEPROM_EVENT_ASYNC_WRITE_DONE, _twr_eeprom.event_param);
+            done.event_handler(TWR_EEPROM_EVENT_ASYNC_WRITE_DONE, done.event_param);
         }
     }
 }
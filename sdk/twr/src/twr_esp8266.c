@@ -1,5 +1,6 @@
 #include <twr_esp8266.h>
 #include <twr_rtc.h>
+#include <twr_fmt.h>
 
 #define _TWR_ESP8266_DELAY_INITIALIZATION_AT_COMMAND 100
 #define _TWR_ESP8266_DELAY_SEND_RESPONSE 100
@@ -72,6 +73,11 @@ static void _uart_event_handler(twr_uart_channel_t channel, twr_uart_event_t eve
         twr_scheduler_plan_relative(self->_task_id, 100);
         self->_state = TWR_ESP8266_STATE_RECEIVE;
     }
+    else if (event == TWR_UART_EVENT_ASYNC_READ_DATA && self->_state == TWR_ESP8266_STATE_SOCKET_RECEIVE)
+    {
+        // Rest of message arrived
+        twr_scheduler_plan_now(self->_task_id);
+    }
 }
 
 void _twr_esp8266_enable(twr_esp8266_t *self)
@@ -194,7 +200,7 @@ bool twr_esp8266_socket_connect(twr_esp8266_t *self, const char *type, const cha
     }
 
     static char buffer[TWR_ESP8266_TX_MAX_PACKET_SIZE];
-    sprintf(buffer, "\"%s\",\"%s\",%d", type, host, port);
+    twr_fmt_snprintf(buffer, sizeof(buffer), "\"%s\",\"%s\",%d", type, host, port);
 
     self->_message_length = strlen(buffer);
 
@@ -230,6 +236,7 @@ bool twr_esp8266_send_data(twr_esp8266_t *self, const void *buffer, size_t lengt
     }
 
     self->_message_length = length;
+    self->_tx_segment_count = 0;
 
     memcpy(self->_message_buffer, buffer, self->_message_length);
 
@@ -240,6 +247,37 @@ bool twr_esp8266_send_data(twr_esp8266_t *self, const void *buffer, size_t lengt
     return true;
 }
 
+bool twr_esp8266_send_datav(twr_esp8266_t *self, const twr_transport_segment_t *segments, size_t count)
+{
+    size_t length = 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        length += segments[i].length;
+    }
+
+    if (!twr_esp8266_is_ready(self) || length == 0 || length > TWR_ESP8266_TX_MAX_PACKET_SIZE)
+    {
+        return false;
+    }
+
+    self->_message_length = length;
+    self->_tx_segment = segments;
+    self->_tx_segment_count = count;
+
+    self->_state = TWR_ESP8266_STATE_SOCKET_SEND_COMMAND;
+
+    twr_scheduler_plan_now(self->_task_id);
+
+    return true;
+}
+
+void twr_esp8266_set_receive_handler(twr_esp8266_t *self, twr_esp8266_receive_handler_t *handler, void *param)
+{
+    self->_receive_handler = handler;
+    self->_receive_param = param;
+}
+
 static void _twr_esp8266_task(void *param)
 {
     twr_esp8266_t *self = param;
@@ -293,11 +331,10 @@ static void _twr_esp8266_task(void *param)
                         length_text[colon_search - comma_search] = '\0';
                         self->_message_length = atoi(length_text);
 
-                        self->_message_part_length = (strlen(self->_response) - 1) - (colon_search - self->_response);
-                        colon_search++;
-                        memcpy(self->_message_buffer, colon_search, self->_message_part_length);
+                        // Line ends with colon, whole message is left in RX ring
+                        self->_message_part_length = 0;
 
-                        if (self->_message_length > sizeof(self->_message_buffer))
+                        if (self->_receive_handler == NULL && self->_message_length > sizeof(self->_message_buffer))
                         {
                             self->_message_length = sizeof(self->_message_buffer);
                         }
@@ -397,7 +434,7 @@ static void _twr_esp8266_task(void *param)
 
                 if (self->_state == TWR_ESP8266_STATE_WIFI_CONNECT_COMMAND)
                 {
-                    sprintf(self->_command, "AT+CWJAP_CUR=\"%s\",\"%s\"\r\n", self->_config.ssid, self->_config.password);
+                    twr_fmt_snprintf(self->_command, sizeof(self->_command), "AT+CWJAP_CUR=\"%s\",\"%s\"\r\n", self->_config.ssid, self->_config.password);
                     response_state = TWR_ESP8266_STATE_WIFI_CONNECT_RESPONSE;
                 }
                 else if (self->_state == TWR_ESP8266_STATE_AP_AVAILABILITY_OPT_COMMAND)
@@ -414,7 +451,7 @@ static void _twr_esp8266_task(void *param)
                 }
                 else if (self->_state == TWR_ESP8266_STATE_SNTP_CONFIG_COMMAND)
                 {
-                    sprintf(self->_command, "AT+CIPSNTPCFG=%u,%d,\"%s\",\"%s\",\"%s\"\r\n",
+                    twr_fmt_snprintf(self->_command, sizeof(self->_command), "AT+CIPSNTPCFG=%u,%d,\"%s\",\"%s\",\"%s\"\r\n",
                         self->_config.sntp_enabled,
                         self->_config.sntp_timezone,
                         self->_config.sntp_server1,
@@ -434,7 +471,7 @@ static void _twr_esp8266_task(void *param)
                 }
                 else
                 {
-                    sprintf(self->_command, "AT+CIPSEND=%d\r\n", self->_message_length);
+                    twr_fmt_snprintf(self->_command, sizeof(self->_command), "AT+CIPSEND=%d\r\n", (int) self->_message_length);
                     response_state = TWR_ESP8266_STATE_SOCKET_SEND_DATA;
                 }
 
@@ -472,7 +509,26 @@ static void _twr_esp8266_task(void *param)
             {
                 self->_state = TWR_ESP8266_STATE_ERROR;
 
-                if (twr_uart_async_write(self->_uart_channel, self->_message_buffer, self->_message_length) != self->_message_length)
+                if (self->_tx_segment_count != 0)
+                {
+                    size_t i;
+
+                    for (i = 0; i < self->_tx_segment_count; i++)
+                    {
+                        if (twr_uart_async_write(self->_uart_channel, self->_tx_segment[i].buffer, self->_tx_segment[i].length) != self->_tx_segment[i].length)
+                        {
+                            break;
+                        }
+                    }
+
+                    self->_tx_segment_count = 0;
+
+                    if (i != self->_tx_segment_count)
+                    {
+                        continue;
+                    }
+                }
+                else if (twr_uart_async_write(self->_uart_channel, self->_message_buffer, self->_message_length) != self->_message_length)
                 {
                     continue;
                 }
@@ -695,7 +751,8 @@ static void _twr_esp8266_task(void *param)
             {
                 if (!_twr_esp8266_read_socket_data(self))
                 {
-                    continue;
+                    // Task is planned by UART event when rest of message arrives
+                    return;
                 }
 
                 self->_state = TWR_ESP8266_STATE_READY;
@@ -759,7 +816,7 @@ static void _twr_esp8266_task(void *param)
                 else
                 {
                     char text[76];
-                    sprintf(text, "+CWLAP:(\"%s\",", self->_config.ssid);
+                    twr_fmt_snprintf(text, sizeof(text), "+CWLAP:(\"%s\",", self->_config.ssid);
                     size_t text_len = strlen(text);
                     if (strncmp(self->_response, text, text_len) == 0)
                     {
@@ -838,6 +895,14 @@ static bool _twr_esp8266_read_response(twr_esp8266_t *self)
             break;
         }
 
+        // Message of +IPD follows colon, it may contain line endings and is read separately
+        if (rx_character == ':' && length > 4 && memcmp(self->_response, "+IPD", 4) == 0)
+        {
+            self->_response[length] = '\0';
+
+            break;
+        }
+
         if (length == sizeof(self->_response) - 1)
         {
             return false;
@@ -849,21 +914,44 @@ static bool _twr_esp8266_read_response(twr_esp8266_t *self)
 
 static bool _twr_esp8266_read_socket_data(twr_esp8266_t *self)
 {
-    while (true)
+    if (self->_receive_handler != NULL)
     {
-        char rx_character;
-
-        if (twr_uart_async_read(self->_uart_channel, &rx_character, 1) == 0)
+        while (self->_message_part_length < self->_message_length)
         {
-            return false;
+            const void *data;
+
+            size_t length = twr_fifo_peek(&self->_rx_fifo, &data);
+
+            if (length == 0)
+            {
+                return false;
+            }
+
+            if (length > self->_message_length - self->_message_part_length)
+            {
+                length = self->_message_length - self->_message_part_length;
+            }
+
+            self->_receive_handler(self, data, length, self->_receive_param);
+
+            twr_fifo_consume(&self->_rx_fifo, length);
+
+            self->_message_part_length += length;
         }
 
-        self->_message_buffer[self->_message_part_length++] = rx_character;
+        return true;
+    }
+
+    while (self->_message_part_length < self->_message_length)
+    {
+        size_t length = twr_uart_async_read(self->_uart_channel, &self->_message_buffer[self->_message_part_length], self->_message_length - self->_message_part_length);
 
-        if (self->_message_part_length == self->_message_length)
+        if (length == 0)
         {
-            break;
+            return false;
         }
+
+        self->_message_part_length += length;
     }
 
     return true;
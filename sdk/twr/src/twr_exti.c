@@ -1,5 +1,7 @@
 #include <twr_exti.h>
 #include <twr_irq.h>
+#include <twr_scheduler.h>
+#include <twr_trace.h>
 #include <stm32l0xx.h>
 
 static bool _twr_exti_initialized = false;
@@ -12,9 +14,41 @@ static struct
 
 } _twr_exti[16];
 
-static inline void _twr_exti_irq_handler(void);
+// Lines with callbacks run by task, and those of them waiting for it
+static volatile uint16_t _twr_exti_deferred;
+static volatile uint16_t _twr_exti_deferred_pending;
+
+static twr_scheduler_task_id_t _twr_exti_task_id;
+
+static const uint8_t _twr_exti_debruijn[32] =
+{
+    0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+    31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9
+};
+
+static inline void _twr_exti_irq_handler(uint16_t group);
+
+static void _twr_exti_dispatch(uint32_t pending);
+
+static void _twr_exti_task(void *param);
+
+TWR_SCHEDULER_TASK_STATIC(_twr_exti_task_static, _twr_exti_task, NULL);
+
+static void _twr_exti_register(twr_exti_line_t line, twr_exti_edge_t edge, void (*callback)(twr_exti_line_t, void *), void *param, bool deferred);
 
 void twr_exti_register(twr_exti_line_t line, twr_exti_edge_t edge, void (*callback)(twr_exti_line_t, void *), void *param)
+{
+    _twr_exti_register(line, edge, callback, param, false);
+}
+
+void twr_exti_register_deferred(twr_exti_line_t line, twr_exti_edge_t edge, void (*callback)(twr_exti_line_t, void *), void *param)
+{
+    _twr_exti_task_id = twr_scheduler_get_static_id(&_twr_exti_task_static);
+
+    _twr_exti_register(line, edge, callback, param, true);
+}
+
+static void _twr_exti_register(twr_exti_line_t line, twr_exti_edge_t edge, void (*callback)(twr_exti_line_t, void *), void *param, bool deferred)
 {
     // Extract port number
     uint8_t port = ((uint8_t) line >> 4) & 7;
@@ -26,7 +60,7 @@ void twr_exti_register(twr_exti_line_t line, twr_exti_edge_t edge, void (*callba
     uint16_t mask = 1 << pin;
 
     // Disable interrupts
-    twr_irq_disable();
+    uint32_t primask = twr_irq_save();
 
     // Store line identifier
     _twr_exti[pin].line = line;
@@ -37,6 +71,15 @@ void twr_exti_register(twr_exti_line_t line, twr_exti_edge_t edge, void (*callba
     // Store callback parameter
     _twr_exti[pin].param = param;
 
+    if (deferred)
+    {
+        _twr_exti_deferred |= mask;
+    }
+    else
+    {
+        _twr_exti_deferred &= ~mask;
+    }
+
     // If this is the first call...
     if (!_twr_exti_initialized)
     {
@@ -84,7 +127,7 @@ void twr_exti_register(twr_exti_line_t line, twr_exti_edge_t edge, void (*callba
     EXTI->IMR |= mask;
 
     // Enable interrupts
-    twr_irq_enable();
+    twr_irq_restore(primask);
 }
 
 void twr_exti_unregister(twr_exti_line_t line)
@@ -96,7 +139,7 @@ void twr_exti_unregister(twr_exti_line_t line)
     uint16_t mask = 1 << pin;
 
     // Disable interrupts
-    twr_irq_disable();
+    uint32_t primask = twr_irq_save();
 
     // If line identifier matches record...
     if (line == _twr_exti[pin].line)
@@ -106,44 +149,93 @@ void twr_exti_unregister(twr_exti_line_t line)
 
         // Clear pending interrupt
         EXTI->PR = mask;
+
+        // Drop callback waiting for task
+        _twr_exti_deferred_pending &= ~mask;
     }
 
     // Enable interrupts
-    twr_irq_enable();
+    twr_irq_restore(primask);
 }
 
-static inline void _twr_exti_irq_handler(void)
+static inline void _twr_exti_irq_handler(uint16_t group)
 {
-    // Determine source of interrupt and call appropriate callback
-    if ((EXTI->PR & 0x0001) != 0) { EXTI->PR = 0x0001; _twr_exti[0].callback(_twr_exti[0].line, _twr_exti[0].param); return; }
-    if ((EXTI->PR & 0x0002) != 0) { EXTI->PR = 0x0002; _twr_exti[1].callback(_twr_exti[1].line, _twr_exti[1].param); return; }
-    if ((EXTI->PR & 0x0004) != 0) { EXTI->PR = 0x0004; _twr_exti[2].callback(_twr_exti[2].line, _twr_exti[2].param); return; }
-    if ((EXTI->PR & 0x0008) != 0) { EXTI->PR = 0x0008; _twr_exti[3].callback(_twr_exti[3].line, _twr_exti[3].param); return; }
-    if ((EXTI->PR & 0x0010) != 0) { EXTI->PR = 0x0010; _twr_exti[4].callback(_twr_exti[4].line, _twr_exti[4].param); return; }
-    if ((EXTI->PR & 0x0020) != 0) { EXTI->PR = 0x0020; _twr_exti[5].callback(_twr_exti[5].line, _twr_exti[5].param); return; }
-    if ((EXTI->PR & 0x0040) != 0) { EXTI->PR = 0x0040; _twr_exti[6].callback(_twr_exti[6].line, _twr_exti[6].param); return; }
-    if ((EXTI->PR & 0x0080) != 0) { EXTI->PR = 0x0080; _twr_exti[7].callback(_twr_exti[7].line, _twr_exti[7].param); return; }
-    if ((EXTI->PR & 0x0100) != 0) { EXTI->PR = 0x0100; _twr_exti[8].callback(_twr_exti[8].line, _twr_exti[8].param); return; }
-    if ((EXTI->PR & 0x0200) != 0) { EXTI->PR = 0x0200; _twr_exti[9].callback(_twr_exti[9].line, _twr_exti[9].param); return; }
-    if ((EXTI->PR & 0x0400) != 0) { EXTI->PR = 0x0400; _twr_exti[10].callback(_twr_exti[10].line, _twr_exti[10].param); return; }
-    if ((EXTI->PR & 0x0800) != 0) { EXTI->PR = 0x0800; _twr_exti[11].callback(_twr_exti[11].line, _twr_exti[11].param); return; }
-    if ((EXTI->PR & 0x1000) != 0) { EXTI->PR = 0x1000; _twr_exti[12].callback(_twr_exti[12].line, _twr_exti[12].param); return; }
-    if ((EXTI->PR & 0x2000) != 0) { EXTI->PR = 0x2000; _twr_exti[13].callback(_twr_exti[13].line, _twr_exti[13].param); return; }
-    if ((EXTI->PR & 0x4000) != 0) { EXTI->PR = 0x4000; _twr_exti[14].callback(_twr_exti[14].line, _twr_exti[14].param); return; }
-    if ((EXTI->PR & 0x8000) != 0) { EXTI->PR = 0x8000; _twr_exti[15].callback(_twr_exti[15].line, _twr_exti[15].param); return; }
+    // Take pending lines of this vector only, the other vectors see theirs
+    uint32_t pending = EXTI->PR & EXTI->IMR & group;
+
+    // Clear pending flags before callbacks, so edges arriving meanwhile are not lost
+    EXTI->PR = pending;
+
+    uint16_t deferred = pending & _twr_exti_deferred;
+
+    if (deferred != 0)
+    {
+        _twr_exti_deferred_pending |= deferred;
+
+        twr_scheduler_signal(_twr_exti_task_id);
+
+        pending &= ~deferred;
+    }
+
+    _twr_exti_dispatch(pending);
 }
 
-void EXTI0_1_IRQHandler(void)
+TWR_RAMFUNC static void _twr_exti_dispatch(uint32_t pending)
 {
-    _twr_exti_irq_handler();
+    while (pending != 0)
+    {
+        uint32_t lowest = pending & -pending;
+
+        pending &= ~lowest;
+
+        // Index of the lowest line by de Bruijn sequence, Cortex-M0+ has no count-trailing-zeros instruction
+        uint8_t pin = _twr_exti_debruijn[(lowest * 0x077cb531) >> 27];
+
+        if (_twr_exti[pin].callback != NULL)
+        {
+            _twr_exti[pin].callback(_twr_exti[pin].line, _twr_exti[pin].param);
+        }
+    }
 }
 
-void EXTI2_3_IRQHandler(void)
+static void _twr_exti_task(void *param)
 {
-    _twr_exti_irq_handler();
+    (void) param;
+
+    uint32_t primask = twr_irq_save();
+
+    uint16_t pending = _twr_exti_deferred_pending;
+
+    _twr_exti_deferred_pending = 0;
+
+    twr_irq_restore(primask);
+
+    _twr_exti_dispatch(pending);
 }
 
-void EXTI4_15_IRQHandler(void)
+TWR_RAMFUNC void EXTI0_1_IRQHandler(void)
 {
-    _twr_exti_irq_handler();
+    twr_trace_isr_enter(EXTI0_1_IRQn);
+
+    _twr_exti_irq_handler(0x0003);
+
+    twr_trace_isr_exit(EXTI0_1_IRQn);
+}
+
+TWR_RAMFUNC void EXTI2_3_IRQHandler(void)
+{
+    twr_trace_isr_enter(EXTI2_3_IRQn);
+
+    _twr_exti_irq_handler(0x000c);
+
+    twr_trace_isr_exit(EXTI2_3_IRQn);
+}
+
+TWR_RAMFUNC void EXTI4_15_IRQHandler(void)
+{
+    twr_trace_isr_enter(EXTI4_15_IRQn);
+
+    _twr_exti_irq_handler(0xfff0);
+
+    twr_trace_isr_exit(EXTI4_15_IRQn);
 }
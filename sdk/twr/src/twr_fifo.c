@@ -1,5 +1,12 @@
 #include <twr_fifo.h>
 #include <twr_irq.h>
+#include <stm32l0xx.h>
+
+static inline uint32_t _twr_fifo_lock(twr_fifo_t *fifo);
+
+static inline void _twr_fifo_unlock(twr_fifo_t *fifo, uint32_t primask);
+
+static inline void _twr_fifo_stats_update(twr_fifo_t *fifo, size_t head, size_t tail, size_t requested, size_t written);
 
 void twr_fifo_init(twr_fifo_t *fifo, void *buffer, size_t size)
 {
@@ -7,6 +14,16 @@ void twr_fifo_init(twr_fifo_t *fifo, void *buffer, size_t size)
     fifo->size = size;
     fifo->head = 0;
     fifo->tail = 0;
+    fifo->spsc = false;
+
+#if TWR_FIFO_STATS
+    memset(&fifo->stats, 0, sizeof(fifo->stats));
+#endif
+}
+
+void twr_fifo_set_spsc(twr_fifo_t *fifo, bool spsc)
+{
+    fifo->spsc = spsc;
 }
 
 void twr_fifo_purge(twr_fifo_t *fifo)
@@ -15,156 +32,301 @@ void twr_fifo_purge(twr_fifo_t *fifo)
     fifo->tail = 0;
 }
 
+static size_t _twr_fifo_copy_in(twr_fifo_t *fifo, size_t head, size_t tail, const void *buffer, size_t length);
+
+static size_t _twr_fifo_copy_out(twr_fifo_t *fifo, size_t head, size_t tail, void *buffer, size_t length);
+
 size_t twr_fifo_write(twr_fifo_t *fifo, const void *buffer, size_t length)
 {
-    // Disable interrupts
-    twr_irq_disable();
+    uint32_t primask = _twr_fifo_lock(fifo);
 
-    // For each byte in buffer...
-    for (size_t i = 0; i < length; i++)
+    size_t head = fifo->head;
+    size_t tail = fifo->tail;
+
+    _twr_fifo_unlock(fifo, primask);
+
+    // Data are copied with interrupts enabled, consumer does not see them until head is moved
+    size_t count = _twr_fifo_copy_in(fifo, head, tail, buffer, length);
+
+    head += count;
+
+    if (head >= fifo->size)
     {
-        if ((fifo->head + 1) == fifo->tail)
-        {
-            // Enable interrupts
-            twr_irq_enable();
+        head -= fifo->size;
+    }
 
-            // Return number of bytes written
-            return i;
-        }
+    primask = _twr_fifo_lock(fifo);
 
-        if (((fifo->head + 1) == fifo->size) && (fifo->tail == 0))
-        {
-            // Enable interrupts
-            twr_irq_enable();
+    fifo->head = head;
 
-            // Return number of bytes written
-            return i;
-        }
+    _twr_fifo_unlock(fifo, primask);
 
-        *((uint8_t *) fifo->buffer + fifo->head) = *(uint8_t *) buffer;
+    // Return number of bytes written
+    return count;
+}
 
-        buffer = (uint8_t *) buffer + 1;
+size_t twr_fifo_read(twr_fifo_t *fifo, void *buffer, size_t length)
+{
+    uint32_t primask = _twr_fifo_lock(fifo);
+
+    size_t head = fifo->head;
+    size_t tail = fifo->tail;
+
+    _twr_fifo_unlock(fifo, primask);
+
+    // Data are copied with interrupts enabled, producer does not reuse the space until tail is moved
+    size_t count = _twr_fifo_copy_out(fifo, head, tail, buffer, length);
 
-        fifo->head++;
+    tail += count;
 
-        if (fifo->head == fifo->size)
-        {
-            fifo->head = 0;
-        }
+    if (tail >= fifo->size)
+    {
+        tail -= fifo->size;
     }
 
-    // Enable interrupts
-    twr_irq_enable();
+    primask = _twr_fifo_lock(fifo);
+
+    fifo->tail = tail;
+
+    _twr_fifo_unlock(fifo, primask);
+
+    // Return number of bytes read
+    return count;
+}
+
+TWR_RAMFUNC size_t twr_fifo_irq_write(twr_fifo_t *fifo, const void *buffer, size_t length)
+{
+    size_t count = _twr_fifo_copy_in(fifo, fifo->head, fifo->tail, buffer, length);
+
+    size_t head = fifo->head + count;
+
+    if (head >= fifo->size)
+    {
+        head -= fifo->size;
+    }
+
+    // Data must be in place before consumer sees the head
+    __DMB();
+
+    fifo->head = head;
 
     // Return number of bytes written
-    return length;
+    return count;
 }
 
-size_t twr_fifo_read(twr_fifo_t *fifo, void *buffer, size_t length)
+size_t twr_fifo_irq_read(twr_fifo_t *fifo, void *buffer, size_t length)
 {
-    // Disable interrupts
-    twr_irq_disable();
+    size_t count = _twr_fifo_copy_out(fifo, fifo->head, fifo->tail, buffer, length);
+
+    size_t tail = fifo->tail + count;
 
-    // For desired number of bytes...
-    for (size_t i = 0; i < length; i++)
+    if (tail >= fifo->size)
     {
-        if (fifo->tail != fifo->head)
-        {
-            *(uint8_t *) buffer = *((uint8_t *) fifo->buffer + fifo->tail);
-
-            buffer = (uint8_t *) buffer + 1;
-
-            fifo->tail++;
-
-            if (fifo->tail == fifo->size)
-            {
-                fifo->tail = 0;
-            }
-        }
-        else
-        {
-            // Enable interrupts
-            twr_irq_enable();
-
-            // Return number of bytes read
-            return i;
-        }
+        tail -= fifo->size;
     }
 
-    // Enable interrupts
-    twr_irq_enable();
+    fifo->tail = tail;
 
     // Return number of bytes read
-    return length;
+    return count;
 }
 
-size_t twr_fifo_irq_write(twr_fifo_t *fifo, const void *buffer, size_t length)
+size_t twr_fifo_reserve(twr_fifo_t *fifo, void **buffer)
 {
-    for (size_t i = 0; i < length; i++)
-    {
-        if ((fifo->head + 1) == fifo->tail)
-        {
-            // Return number of bytes written
-            return i;
-        }
+    uint32_t primask = _twr_fifo_lock(fifo);
 
-        if (((fifo->head + 1) == fifo->size) && (fifo->tail == 0))
-        {
-            // Return number of bytes written
-            return i;
-        }
+    size_t head = fifo->head;
+    size_t tail = fifo->tail;
 
-        *((uint8_t *) fifo->buffer + fifo->head) = *(uint8_t *) buffer;
+    _twr_fifo_unlock(fifo, primask);
 
-        buffer = (uint8_t *) buffer + 1;
+    *buffer = (uint8_t *) fifo->buffer + head;
 
-        fifo->head++;
+    // Space up to the end of buffer, or up to one byte before tail
+    if (tail > head)
+    {
+        return tail - head - 1;
+    }
+
+    return tail == 0 ? fifo->size - head - 1 : fifo->size - head;
+}
 
-        if (fifo->head == fifo->size)
-        {
-            fifo->head = 0;
-        }
+void twr_fifo_commit(twr_fifo_t *fifo, size_t length)
+{
+    _twr_fifo_stats_update(fifo, fifo->head, fifo->tail, length, length);
+
+    size_t head = fifo->head + length;
+
+    if (head >= fifo->size)
+    {
+        head -= fifo->size;
     }
 
-    // Return number of bytes written
-    return length;
+    uint32_t primask = _twr_fifo_lock(fifo);
+
+    fifo->head = head;
+
+    _twr_fifo_unlock(fifo, primask);
 }
 
-size_t twr_fifo_irq_read(twr_fifo_t *fifo, void *buffer, size_t length)
+size_t twr_fifo_peek(twr_fifo_t *fifo, const void **buffer)
+{
+    uint32_t primask = _twr_fifo_lock(fifo);
+
+    size_t head = fifo->head;
+    size_t tail = fifo->tail;
+
+    _twr_fifo_unlock(fifo, primask);
+
+    *buffer = (uint8_t *) fifo->buffer + tail;
+
+    // Data up to head or the end of buffer
+    return head >= tail ? head - tail : fifo->size - tail;
+}
+
+void twr_fifo_consume(twr_fifo_t *fifo, size_t length)
 {
-    for (size_t i = 0; i < length; i++)
+    size_t tail = fifo->tail + length;
+
+    if (tail >= fifo->size)
     {
-        if (fifo->tail != fifo->head)
-        {
-            *(uint8_t *) buffer = *((uint8_t *) fifo->buffer + fifo->tail);
-
-            buffer = (uint8_t *) buffer + 1;
-
-            fifo->tail++;
-
-            if (fifo->tail == fifo->size)
-            {
-                fifo->tail = 0;
-            }
-        }
-        else
-        {
-            // Return number of bytes read
-            return i;
-        }
+        tail -= fifo->size;
     }
 
-    // Return number of bytes read
-    return length;
+    uint32_t primask = _twr_fifo_lock(fifo);
+
+    fifo->tail = tail;
+
+    _twr_fifo_unlock(fifo, primask);
+}
+
+#if TWR_FIFO_STATS
+
+void twr_fifo_get_stats(twr_fifo_t *fifo, twr_fifo_stats_t *stats)
+{
+    uint32_t primask = twr_irq_save();
+
+    *stats = fifo->stats;
+
+    twr_irq_restore(primask);
+}
+
+void twr_fifo_reset_stats(twr_fifo_t *fifo)
+{
+    uint32_t primask = twr_irq_save();
+
+    memset(&fifo->stats, 0, sizeof(fifo->stats));
+
+    twr_irq_restore(primask);
 }
 
+#endif
+
 bool twr_fifo_is_empty(twr_fifo_t *fifo)
 {
-    twr_irq_disable();
+    uint32_t primask = _twr_fifo_lock(fifo);
 
 	bool result = fifo->tail == fifo->head;
 
-	twr_irq_enable();
+	_twr_fifo_unlock(fifo, primask);
 
 	return result;
 }
+
+static inline uint32_t _twr_fifo_lock(twr_fifo_t *fifo)
+{
+    if (fifo->spsc)
+    {
+        // Index of the other side is published only after its data, so ordering is enough
+        __DMB();
+
+        return 0;
+    }
+
+    return twr_irq_save();
+}
+
+static inline void _twr_fifo_unlock(twr_fifo_t *fifo, uint32_t primask)
+{
+    if (fifo->spsc)
+    {
+        __DMB();
+    }
+    else
+    {
+        twr_irq_restore(primask);
+    }
+}
+
+static inline void _twr_fifo_stats_update(twr_fifo_t *fifo, size_t head, size_t tail, size_t requested, size_t written)
+{
+#if TWR_FIFO_STATS
+    size_t occupancy = (head >= tail ? head - tail : fifo->size - tail + head) + written;
+
+    if (fifo->stats.peak < occupancy)
+    {
+        fifo->stats.peak = occupancy;
+    }
+
+    fifo->stats.dropped += requested - written;
+
+    fifo->stats.total += written;
+#else
+    (void) fifo;
+    (void) head;
+    (void) tail;
+    (void) requested;
+    (void) written;
+#endif
+}
+
+static size_t _twr_fifo_copy_in(twr_fifo_t *fifo, size_t head, size_t tail, const void *buffer, size_t length)
+{
+    // One byte is always kept free to tell full FIFO from empty one
+    size_t space = tail > head ? tail - head - 1 : fifo->size - head + tail - 1;
+
+    _twr_fifo_stats_update(fifo, head, tail, length, length > space ? space : length);
+
+    if (length > space)
+    {
+        length = space;
+    }
+
+    // Free space wraps around the end of buffer at most once
+    size_t chunk = fifo->size - head;
+
+    if (chunk > length)
+    {
+        chunk = length;
+    }
+
+    memcpy((uint8_t *) fifo->buffer + head, buffer, chunk);
+
+    memcpy(fifo->buffer, (const uint8_t *) buffer + chunk, length - chunk);
+
+    return length;
+}
+
+static size_t _twr_fifo_copy_out(twr_fifo_t *fifo, size_t head, size_t tail, void *buffer, size_t length)
+{
+    size_t available = head >= tail ? head - tail : fifo->size - tail + head;
+
+    if (length > available)
+    {
+        length = available;
+    }
+
+    // Stored data wrap around the end of buffer at most once
+    size_t chunk = fifo->size - tail;
+
+    if (chunk > length)
+    {
+        chunk = length;
+    }
+
+    memcpy(buffer, (uint8_t *) fifo->buffer + tail, chunk);
+
+    memcpy((uint8_t *) buffer + chunk, fifo->buffer, length - chunk);
+
+    return length;
+}
@@ -1,14 +1,17 @@
 #include <twr_flood_detector.h>
 
 #define _TWR_FLOOD_DETECTOR_DELAY_RUN 50
+#define _TWR_FLOOD_DETECTOR_DEBOUNCE 50
 
 static void _twr_flood_task_interval(void *param);
 
 static void _twr_flood_task_measure(void *param);
 
+static void _twr_flood_exti_handler(twr_exti_line_t line, void *param);
+
 void twr_flood_detector_init(twr_flood_detector_t *self, twr_flood_detector_type_t type)
 {
-	memset(self, 0, sizeof(&self));
+	memset(self, 0, sizeof(*self));
 	self->_type = type;
 	self->_task_id_interval = twr_scheduler_register(_twr_flood_task_interval, self, TWR_TICK_INFINITY);
 	self->_task_id_measure = twr_scheduler_register(_twr_flood_task_measure, self, _TWR_FLOOD_DETECTOR_DELAY_RUN);
@@ -53,6 +56,30 @@ bool twr_flood_detector_is_alarm(twr_flood_detector_t *self)
 	return self->_alarm;
 }
 
+void twr_flood_detector_set_wake_on_event(twr_flood_detector_t *self, bool enable)
+{
+    self->_wake_on_event = enable;
+
+    if (enable)
+    {
+        twr_scheduler_plan_absolute(self->_task_id_interval, TWR_TICK_INFINITY);
+    }
+    else
+    {
+        if (self->_exti_registered)
+        {
+            twr_exti_unregister(self->_type == TWR_FLOOD_DETECTOR_TYPE_LD_81_SENSOR_MODULE_CHANNEL_A ? TWR_EXTI_LINE_P4 : TWR_EXTI_LINE_P5);
+
+            self->_exti_registered = false;
+        }
+
+        twr_flood_detector_set_update_interval(self, self->_update_interval);
+    }
+
+    // Measurement enables or releases pull-up and registers EXTI
+    twr_flood_detector_measure(self);
+}
+
 static void _twr_flood_task_interval(void *param)
 {
 	twr_flood_detector_t *self = (twr_flood_detector_t *) param;
@@ -166,6 +193,11 @@ start:
 				{
 					self->_alarm = twr_gpio_get_input(TWR_GPIO_P4) == 1;
 
+					if (self->_wake_on_event)
+					{
+						break;
+					}
+
 					if (!twr_module_sensor_set_pull(TWR_MODULE_SENSOR_CHANNEL_A, TWR_MODULE_SENSOR_PULL_NONE))
 					{
 						goto start;
@@ -176,6 +208,11 @@ start:
 				{
 					self->_alarm = twr_gpio_get_input(TWR_GPIO_P5) == 1;
 
+					if (self->_wake_on_event)
+					{
+						break;
+					}
+
 					if (!twr_module_sensor_set_pull(TWR_MODULE_SENSOR_CHANNEL_B, TWR_MODULE_SENSOR_PULL_NONE))
 					{
 						goto start;
@@ -189,6 +226,14 @@ start:
 			}
 			self->_measurement_active = false;
 
+			if (self->_wake_on_event && !self->_exti_registered)
+			{
+				twr_exti_register_deferred(self->_type == TWR_FLOOD_DETECTOR_TYPE_LD_81_SENSOR_MODULE_CHANNEL_A ? TWR_EXTI_LINE_P4 : TWR_EXTI_LINE_P5,
+						TWR_EXTI_EDGE_RISING_AND_FALLING, _twr_flood_exti_handler, self);
+
+				self->_exti_registered = true;
+			}
+
 			if (self->_event_handler != NULL)
 			{
 				self->_event_handler(self, TWR_FLOOD_DETECTOR_EVENT_UPDATE, self->_event_param);
@@ -201,3 +246,25 @@ start:
 			break;
 	}
 }
+
+static void _twr_flood_exti_handler(twr_exti_line_t line, void *param)
+{
+    (void) line;
+
+    twr_flood_detector_t *self = (twr_flood_detector_t *) param;
+
+    if (self->_measurement_active)
+    {
+        // Measurement in progress is delayed, so that it reads settled output
+        if (self->_state == TWR_FLOOD_DETECTOR_STATE_MEASURE)
+        {
+            twr_scheduler_plan_from_now(self->_task_id_measure, _TWR_FLOOD_DETECTOR_DEBOUNCE);
+        }
+
+        return;
+    }
+
+    self->_measurement_active = true;
+
+    twr_scheduler_plan_from_now(self->_task_id_measure, _TWR_FLOOD_DETECTOR_DEBOUNCE);
+}
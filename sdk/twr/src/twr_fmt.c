@@ -0,0 +1,600 @@
+#include <twr_fmt.h>
+
+#define _TWR_FMT_FLAG_LEFT 0x01
+#define _TWR_FMT_FLAG_ZERO 0x02
+#define _TWR_FMT_FLAG_PLUS 0x04
+#define _TWR_FMT_FLAG_SPACE 0x08
+#define _TWR_FMT_FLAG_ALT 0x10
+
+#define _TWR_FMT_PRECISION_MAX 9
+#define _TWR_FMT_PRECISION_DEFAULT 6
+
+typedef enum
+{
+    _TWR_FMT_LENGTH_INT = 0,
+    _TWR_FMT_LENGTH_CHAR = 1,
+    _TWR_FMT_LENGTH_SHORT = 2,
+    _TWR_FMT_LENGTH_LONG = 3,
+    _TWR_FMT_LENGTH_LONG_LONG = 4,
+    _TWR_FMT_LENGTH_SIZE = 5,
+    _TWR_FMT_LENGTH_PTRDIFF = 6
+
+} _twr_fmt_length_t;
+
+typedef struct
+{
+    char *buffer;
+    size_t size;
+    size_t length;
+
+} _twr_fmt_output_t;
+
+static const uint32_t _twr_fmt_pow10[_TWR_FMT_PRECISION_MAX + 1] =
+{
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+static void _twr_fmt_putc(_twr_fmt_output_t *output, char c);
+static void _twr_fmt_pad(_twr_fmt_output_t *output, char c, int count);
+static void _twr_fmt_field(_twr_fmt_output_t *output, char sign, const char *prefix, int zeros, const char *body, int length, int flags, int width);
+static int _twr_fmt_digits(char *body, uint64_t value, unsigned int base, bool upper);
+static void _twr_fmt_integer(_twr_fmt_output_t *output, uint64_t value, bool negative, unsigned int base, bool upper, int flags, int width, int precision);
+static void _twr_fmt_float(_twr_fmt_output_t *output, double value, int flags, int width, int precision);
+static int64_t _twr_fmt_get_signed(va_list *ap, _twr_fmt_length_t length);
+static uint64_t _twr_fmt_get_unsigned(va_list *ap, _twr_fmt_length_t length);
+
+int twr_fmt_snprintf(char *buffer, size_t size, const char *format, ...)
+{
+    va_list ap;
+
+    va_start(ap, format);
+
+    int length = twr_fmt_vsnprintf(buffer, size, format, ap);
+
+    va_end(ap);
+
+    return length;
+}
+
+int twr_fmt_vsnprintf(char *buffer, size_t size, const char *format, va_list ap)
+{
+    _twr_fmt_output_t output = { buffer, size, 0 };
+
+    va_list args;
+
+    // Copy can be passed by pointer whatever type of va_list is
+    va_copy(args, ap);
+
+    while (*format != '\0')
+    {
+        if (*format != '%')
+        {
+            _twr_fmt_putc(&output, *format++);
+
+            continue;
+        }
+
+        const char *conversion = format++;
+
+        int flags = 0;
+
+        for (;; format++)
+        {
+            if (*format == '-') flags |= _TWR_FMT_FLAG_LEFT;
+            else if (*format == '0') flags |= _TWR_FMT_FLAG_ZERO;
+            else if (*format == '+') flags |= _TWR_FMT_FLAG_PLUS;
+            else if (*format == ' ') flags |= _TWR_FMT_FLAG_SPACE;
+            else if (*format == '#') flags |= _TWR_FMT_FLAG_ALT;
+            else break;
+        }
+
+        int width = 0;
+
+        if (*format == '*')
+        {
+            width = va_arg(args, int);
+
+            if (width < 0)
+            {
+                flags |= _TWR_FMT_FLAG_LEFT;
+                width = -width;
+            }
+
+            format++;
+        }
+        else
+        {
+            while (*format >= '0' && *format <= '9')
+            {
+                width = width * 10 + *format++ - '0';
+            }
+        }
+
+        int precision = -1;
+
+        if (*format == '.')
+        {
+            format++;
+
+            precision = 0;
+
+            if (*format == '*')
+            {
+                precision = va_arg(args, int);
+
+                format++;
+            }
+            else
+            {
+                while (*format >= '0' && *format <= '9')
+                {
+                    precision = precision * 10 + *format++ - '0';
+                }
+            }
+        }
+
+        _twr_fmt_length_t length = _TWR_FMT_LENGTH_INT;
+
+        if (*format == 'h')
+        {
+            length = format[1] == 'h' ? _TWR_FMT_LENGTH_CHAR : _TWR_FMT_LENGTH_SHORT;
+            format += length == _TWR_FMT_LENGTH_CHAR ? 2 : 1;
+        }
+        else if (*format == 'l')
+        {
+            length = format[1] == 'l' ? _TWR_FMT_LENGTH_LONG_LONG : _TWR_FMT_LENGTH_LONG;
+            format += length == _TWR_FMT_LENGTH_LONG_LONG ? 2 : 1;
+        }
+        else if (*format == 'j')
+        {
+            length = _TWR_FMT_LENGTH_LONG_LONG;
+            format++;
+        }
+        else if (*format == 'z')
+        {
+            length = _TWR_FMT_LENGTH_SIZE;
+            format++;
+        }
+        else if (*format == 't')
+        {
+            length = _TWR_FMT_LENGTH_PTRDIFF;
+            format++;
+        }
+
+        switch (*format)
+        {
+            case 'd':
+            case 'i':
+            {
+                int64_t value = _twr_fmt_get_signed(&args, length);
+
+                _twr_fmt_integer(&output, value < 0 ? -(uint64_t) value : (uint64_t) value, value < 0, 10, false, flags, width, precision);
+
+                break;
+            }
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+            {
+                unsigned int base = *format == 'u' ? 10 : *format == 'o' ? 8 : 16;
+
+                _twr_fmt_integer(&output, _twr_fmt_get_unsigned(&args, length), false, base, *format == 'X', flags & ~(_TWR_FMT_FLAG_PLUS | _TWR_FMT_FLAG_SPACE), width, precision);
+
+                break;
+            }
+            case 'p':
+            {
+                _twr_fmt_integer(&output, (uintptr_t) va_arg(args, void *), false, 16, false, _TWR_FMT_FLAG_ALT | (flags & _TWR_FMT_FLAG_LEFT), width, -1);
+
+                break;
+            }
+            case 'c':
+            {
+                char c = (char) va_arg(args, int);
+
+                _twr_fmt_field(&output, 0, NULL, 0, &c, 1, flags & _TWR_FMT_FLAG_LEFT, width);
+
+                break;
+            }
+            case 's':
+            {
+                const char *s = va_arg(args, const char *);
+
+                if (s == NULL)
+                {
+                    s = "(null)";
+                }
+
+                int n = 0;
+
+                while (s[n] != '\0' && (precision < 0 || n < precision))
+                {
+                    n++;
+                }
+
+                _twr_fmt_field(&output, 0, NULL, 0, s, n, flags & _TWR_FMT_FLAG_LEFT, width);
+
+                break;
+            }
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            {
+                _twr_fmt_float(&output, va_arg(args, double), flags, width, precision);
+
+                break;
+            }
+            case '%':
+            {
+                _twr_fmt_putc(&output, '%');
+
+                break;
+            }
+            default:
+            {
+                // Unknown conversion is copied as it is
+                while (conversion != format && *conversion != '\0')
+                {
+                    _twr_fmt_putc(&output, *conversion++);
+                }
+
+                continue;
+            }
+        }
+
+        format++;
+    }
+
+    va_end(args);
+
+    if (size > 0)
+    {
+        buffer[output.length < size ? output.length : size - 1] = '\0';
+    }
+
+    return (int) output.length;
+}
+
+int twr_fmt_fixed(char *buffer, size_t size, int32_t value, int scale, int digits)
+{
+    _twr_fmt_output_t output = { buffer, size, 0 };
+
+    if (scale < 0 || scale > _TWR_FMT_PRECISION_MAX || digits < 0 || digits > _TWR_FMT_PRECISION_MAX)
+    {
+        if (size > 0)
+        {
+            buffer[0] = '\0';
+        }
+
+        return 0;
+    }
+
+    bool negative = value < 0;
+
+    uint64_t magnitude = negative ? -(int64_t) value : value;
+
+    if (digits < scale)
+    {
+        uint32_t divisor = _twr_fmt_pow10[scale - digits];
+
+        magnitude = (magnitude + divisor / 2) / divisor;
+    }
+    else
+    {
+        magnitude *= _twr_fmt_pow10[digits - scale];
+    }
+
+    char body[24];
+
+    int length = _twr_fmt_digits(body, magnitude / _twr_fmt_pow10[digits], 10, false);
+
+    if (digits > 0)
+    {
+        uint32_t fraction = magnitude % _twr_fmt_pow10[digits];
+
+        body[length++] = '.';
+
+        for (int i = digits - 1; i >= 0; i--)
+        {
+            body[length++] = '0' + fraction / _twr_fmt_pow10[i] % 10;
+        }
+    }
+
+    // Rounding to zero keeps no sign
+    _twr_fmt_field(&output, negative && magnitude != 0 ? '-' : 0, NULL, 0, body, length, 0, 0);
+
+    if (size > 0)
+    {
+        buffer[output.length < size ? output.length : size - 1] = '\0';
+    }
+
+    return (int) output.length;
+}
+
+static void _twr_fmt_putc(_twr_fmt_output_t *output, char c)
+{
+    if (output->length + 1 < output->size)
+    {
+        output->buffer[output->length] = c;
+    }
+
+    output->length++;
+}
+
+static void _twr_fmt_pad(_twr_fmt_output_t *output, char c, int count)
+{
+    while (count-- > 0)
+    {
+        _twr_fmt_putc(output, c);
+    }
+}
+
+static void _twr_fmt_field(_twr_fmt_output_t *output, char sign, const char *prefix, int zeros, const char *body, int length, int flags, int width)
+{
+    int prefix_length = prefix != NULL ? strlen(prefix) : 0;
+
+    int padding = width - length - zeros - prefix_length - (sign != 0 ? 1 : 0);
+
+    if (padding < 0)
+    {
+        padding = 0;
+    }
+
+    // Zero padding goes between sign and digits
+    if ((flags & (_TWR_FMT_FLAG_ZERO | _TWR_FMT_FLAG_LEFT)) == _TWR_FMT_FLAG_ZERO)
+    {
+        zeros += padding;
+        padding = 0;
+    }
+
+    if ((flags & _TWR_FMT_FLAG_LEFT) == 0)
+    {
+        _twr_fmt_pad(output, ' ', padding);
+    }
+
+    if (sign != 0)
+    {
+        _twr_fmt_putc(output, sign);
+    }
+
+    for (int i = 0; i < prefix_length; i++)
+    {
+        _twr_fmt_putc(output, prefix[i]);
+    }
+
+    _twr_fmt_pad(output, '0', zeros);
+
+    for (int i = 0; i < length; i++)
+    {
+        _twr_fmt_putc(output, body[i]);
+    }
+
+    if ((flags & _TWR_FMT_FLAG_LEFT) != 0)
+    {
+        _twr_fmt_pad(output, ' ', padding);
+    }
+}
+
+static int _twr_fmt_digits(char *body, uint64_t value, unsigned int base, bool upper)
+{
+    const char *alphabet = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+
+    char digits[22];
+
+    int n = 0;
+
+    // 64-bit division is library call on Cortex-M0+, it is used only for values which need it
+    while (value > UINT32_MAX)
+    {
+        digits[n++] = alphabet[value % base];
+        value /= base;
+    }
+
+    uint32_t value32 = value;
+
+    do
+    {
+        digits[n++] = alphabet[value32 % base];
+        value32 /= base;
+    }
+    while (value32 != 0);
+
+    for (int i = 0; i < n; i++)
+    {
+        body[i] = digits[n - 1 - i];
+    }
+
+    return n;
+}
+
+static void _twr_fmt_integer(_twr_fmt_output_t *output, uint64_t value, bool negative, unsigned int base, bool upper, int flags, int width, int precision)
+{
+    char body[22];
+
+    int length = 0;
+
+    if (precision != 0 || value != 0)
+    {
+        length = _twr_fmt_digits(body, value, base, upper);
+    }
+
+    int zeros = precision > length ? precision - length : 0;
+
+    const char *prefix = NULL;
+
+    if ((flags & _TWR_FMT_FLAG_ALT) != 0)
+    {
+        if (base == 16 && value != 0)
+        {
+            prefix = upper ? "0X" : "0x";
+        }
+        else if (base == 8 && zeros == 0 && (length == 0 || body[0] != '0'))
+        {
+            prefix = "0";
+        }
+    }
+
+    // Precision disables zero padding of width
+    if (precision >= 0)
+    {
+        flags &= ~_TWR_FMT_FLAG_ZERO;
+    }
+
+    char sign = negative ? '-' : (flags & _TWR_FMT_FLAG_PLUS) != 0 ? '+' : (flags & _TWR_FMT_FLAG_SPACE) != 0 ? ' ' : 0;
+
+    _twr_fmt_field(output, sign, prefix, zeros, body, length, flags, width);
+}
+
+static void _twr_fmt_float(_twr_fmt_output_t *output, double value, int flags, int width, int precision)
+{
+    char sign = signbit(value) ? '-' : (flags & _TWR_FMT_FLAG_PLUS) != 0 ? '+' : (flags & _TWR_FMT_FLAG_SPACE) != 0 ? ' ' : 0;
+
+    value = fabs(value);
+
+    if (precision < 0)
+    {
+        precision = _TWR_FMT_PRECISION_DEFAULT;
+    }
+
+    int extra = 0;
+
+    if (precision > _TWR_FMT_PRECISION_MAX)
+    {
+        extra = precision - _TWR_FMT_PRECISION_MAX;
+        precision = _TWR_FMT_PRECISION_MAX;
+    }
+
+    double scaled = value * _twr_fmt_pow10[precision] + 0.5;
+
+    // Value has to fit 64-bit integer after scaling, digits of large values beyond precision of double become zeros
+    while (precision > 0 && scaled >= 18446744073709551615.0)
+    {
+        precision--;
+        extra++;
+
+        scaled = value * _twr_fmt_pow10[precision] + 0.5;
+    }
+
+    if (isnan(value) || !(scaled < 18446744073709551615.0))
+    {
+        _twr_fmt_field(output, isnan(value) ? 0 : sign, NULL, 0, isnan(value) ? "nan" : "inf", 3, flags & _TWR_FMT_FLAG_LEFT, width);
+
+        return;
+    }
+
+    uint64_t integer = (uint64_t) scaled;
+
+    char body[22 + 1 + _TWR_FMT_PRECISION_MAX];
+
+    int length = _twr_fmt_digits(body, integer / _twr_fmt_pow10[precision], 10, false);
+
+    if (precision > 0 || extra > 0 || (flags & _TWR_FMT_FLAG_ALT) != 0)
+    {
+        uint32_t fraction = integer % _twr_fmt_pow10[precision];
+
+        body[length++] = '.';
+
+        for (int i = precision - 1; i >= 0; i--)
+        {
+            body[length++] = '0' + fraction / _twr_fmt_pow10[i] % 10;
+        }
+    }
+
+    if (extra == 0)
+    {
+        _twr_fmt_field(output, sign, NULL, 0, body, length, flags, width);
+
+        return;
+    }
+
+    // Digits beyond precision limit are printed as zeros, padding of width goes after them
+    int padding = width - length - extra - (sign != 0 ? 1 : 0);
+
+    if ((flags & _TWR_FMT_FLAG_LEFT) != 0)
+    {
+        _twr_fmt_field(output, sign, NULL, 0, body, length, 0, 0);
+        _twr_fmt_pad(output, '0', extra);
+        _twr_fmt_pad(output, ' ', padding);
+    }
+    else
+    {
+        _twr_fmt_field(output, sign, NULL, 0, body, length, flags, width - extra);
+        _twr_fmt_pad(output, '0', extra);
+    }
+}
+
+static int64_t _twr_fmt_get_signed(va_list *ap, _twr_fmt_length_t length)
+{
+    switch (length)
+    {
+        case _TWR_FMT_LENGTH_CHAR:
+        {
+            return (signed char) va_arg(*ap, int);
+        }
+        case _TWR_FMT_LENGTH_SHORT:
+        {
+            return (short) va_arg(*ap, int);
+        }
+        case _TWR_FMT_LENGTH_LONG:
+        {
+            return va_arg(*ap, long);
+        }
+        case _TWR_FMT_LENGTH_LONG_LONG:
+        {
+            return va_arg(*ap, long long);
+        }
+        case _TWR_FMT_LENGTH_SIZE:
+        {
+            return (int64_t) va_arg(*ap, size_t);
+        }
+        case _TWR_FMT_LENGTH_PTRDIFF:
+        {
+            return va_arg(*ap, ptrdiff_t);
+        }
+        case _TWR_FMT_LENGTH_INT:
+        default:
+        {
+            return va_arg(*ap, int);
+        }
+    }
+}
+
+static uint64_t _twr_fmt_get_unsigned(va_list *ap, _twr_fmt_length_t length)
+{
+    switch (length)
+    {
+        case _TWR_FMT_LENGTH_CHAR:
+        {
+            return (unsigned char) va_arg(*ap, unsigned int);
+        }
+        case _TWR_FMT_LENGTH_SHORT:
+        {
+            return (unsigned short) va_arg(*ap, unsigned int);
+        }
+        case _TWR_FMT_LENGTH_LONG:
+        {
+            return va_arg(*ap, unsigned long);
+        }
+        case _TWR_FMT_LENGTH_LONG_LONG:
+        {
+            return va_arg(*ap, unsigned long long);
+        }
+        case _TWR_FMT_LENGTH_SIZE:
+        {
+            return va_arg(*ap, size_t);
+        }
+        case _TWR_FMT_LENGTH_PTRDIFF:
+        {
+            return (uint64_t) va_arg(*ap, ptrdiff_t);
+        }
+        case _TWR_FMT_LENGTH_INT:
+        default:
+        {
+            return va_arg(*ap, unsigned int);
+        }
+    }
+}
@@ -14,7 +14,7 @@
 *
 * preset name: HARDWARIO LCD Module
 * data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
+* RLE compression enabled: no, converted by sdk/tools/font_rle.py
 * conversion type: Monochrome, Diffuse Dither 128
 * bits per pixel: 1
 *
@@ -31,1983 +31,774 @@
 
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x20[11] = {
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0
+static const uint8_t image_data_twr_font_ubuntu_11_0x20[1] = {
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_11_0x20 = { image_data_twr_font_ubuntu_11_0x20,
-    2, 11/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_11_0x20 = { image_data_twr_font_ubuntu_11_0x20, 2, 11, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x21[11] = {
-    0xc0,
-    0xc0,
-    0x80,
-    0x80,
-    0x80,
-    0x80,
-    0xc0,
-    0x80,
-    0xc0,
-    0xc0,
-    0xc0
+static const uint8_t image_data_twr_font_ubuntu_11_0x21[6] = {
+    0x51, 0x11, 0x11, 0x11, 0x31, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_11_0x21 = { image_data_twr_font_ubuntu_11_0x21,
-    2, 11/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_11_0x21 = { image_data_twr_font_ubuntu_11_0x21, 2, 11, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x22[11] = {
-    0xe0,
-    0xe0,
-    0x80,
-    0x80,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0
+static const uint8_t image_data_twr_font_ubuntu_11_0x22[3] = {
+    0x72, 0x12, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_11_0x22 = { image_data_twr_font_ubuntu_11_0x22,
-    3, 11/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_11_0x22 = { image_data_twr_font_ubuntu_11_0x22, 3, 11, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x23[11] = {
-    0xf8,
-    0xf8,
-    0xb0,
-    0x00,
-    0xb0,
-    0x68,
-    0x00,
-    0x68,
-    0xf8,
-    0xf8,
-    0xf8
+static const uint8_t image_data_twr_font_ubuntu_11_0x23[8] = {
+    0xb1, 0x26, 0x11, 0x22, 0x21, 0x16, 0x21, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_11_0x23 = { image_data_twr_font_ubuntu_11_0x23,
-    5, 11/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_11_0x23 = { image_data_twr_font_ubuntu_11_0x23, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x24[11] = {
-    0xf8,
-    0xf8,
-    0xe8,
-    0xc0,
-    0xb8,
-    0xc8,
-    0xf0,
-    0x88,
-    0xe8,
-    0xf8,
-    0xf8
+static const uint8_t image_data_twr_font_ubuntu_11_0x24[8] = {
+    0xd1, 0x33, 0x11, 0x52, 0x51, 0x13, 0x41, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_11_0x24 = { image_data_twr_font_ubuntu_11_0x24,
-    5, 11/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_11_0x24 = { image_data_twr_font_ubuntu_11_0x24, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_11_0x25[11] = {
-    0xfe,
-    0xfe,
-    0xda,
-    0xa6,
-    0xd6,
-    0xea,
-    0xe4,
-    0xda,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x25 = { image_data_twr_font_ubuntu_11_0x25,
-    7, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x26[11] = {
-    0xf8,
-    0xf8,
-    0xd8,
-    0xa8,
-    0x98,
-    0x90,
-    0xa0,
-    0xc0,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x26 = { image_data_twr_font_ubuntu_11_0x26,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x27[11] = {
-    0xc0,
-    0xc0,
-    0x80,
-    0x80,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x27 = { image_data_twr_font_ubuntu_11_0x27,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x28[11] = {
-    0xe0,
-    0xe0,
-    0xc0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xc0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x28 = { image_data_twr_font_ubuntu_11_0x28,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x29[11] = {
-    0xe0,
-    0xe0,
-    0x60,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0x60,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x29 = { image_data_twr_font_ubuntu_11_0x29,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x2a[11] = {
-    0xf0,
-    0xf0,
-    0xd0,
-    0x80,
-    0xa0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x2a = { image_data_twr_font_ubuntu_11_0x2a,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x2b[11] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xd8,
-    0xd8,
-    0x00,
-    0xd8,
-    0xd8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x2b = { image_data_twr_font_ubuntu_11_0x2b,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x2c[11] = {
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0x80,
-    0x40,
-    0xc0,
-    0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x2c = { image_data_twr_font_ubuntu_11_0x2c,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x2d[11] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0x80,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x2d = { image_data_twr_font_ubuntu_11_0x2d,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x2e[11] = {
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0x80,
-    0xc0,
-    0xc0,
-    0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x2e = { image_data_twr_font_ubuntu_11_0x2e,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x2f[11] = {
-    0xe0,
-    0xe0,
-    0xc0,
-    0xc0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0x60,
-    0x60,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x2f = { image_data_twr_font_ubuntu_11_0x2f,
-    3, 11/*, 8*/};
+    0xfe, 0xfe, 0xda, 0xa6, 0xd6, 0xea, 0xe4, 0xda, 0xfe, 0xfe, 0xfe
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x25 = { image_data_twr_font_ubuntu_11_0x25, 7, 11, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x26[10] = {
+    0xc1, 0x31, 0x11, 0x22, 0x32, 0x11, 0x11, 0x12, 0x23, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x26 = { image_data_twr_font_ubuntu_11_0x26, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x27[3] = {
+    0x51, 0x11, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x27 = { image_data_twr_font_ubuntu_11_0x27, 2, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x28[8] = {
+    0x81, 0x11, 0x21, 0x21, 0x21, 0x21, 0x31, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x28 = { image_data_twr_font_ubuntu_11_0x28, 3, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x29[8] = {
+    0x61, 0x31, 0x21, 0x21, 0x21, 0x21, 0x11, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x29 = { image_data_twr_font_ubuntu_11_0x29, 3, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x2a[5] = {
+    0xa1, 0x23, 0x11, 0x11, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x2a = { image_data_twr_font_ubuntu_11_0x2a, 4, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x2b[7] = {
+    0xf0, 0x21, 0x41, 0x25, 0x21, 0x41, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x2b = { image_data_twr_font_ubuntu_11_0x2b, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x2c[2] = {
+    0xf2, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x2c = { image_data_twr_font_ubuntu_11_0x2c, 2, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x2d[3] = {
+    0xf0, 0x12, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x2d = { image_data_twr_font_ubuntu_11_0x2d, 3, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x2e[2] = {
+    0xf1, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x2e = { image_data_twr_font_ubuntu_11_0x2e, 2, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x2f[8] = {
+    0x81, 0x21, 0x11, 0x21, 0x21, 0x11, 0x21, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x2f = { image_data_twr_font_ubuntu_11_0x2f, 3, 11, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_11_0x30[11] = {
-    0xf8,
-    0xf8,
-    0xc8,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xc8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x30 = { image_data_twr_font_ubuntu_11_0x30,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x31[11] = {
-    0xf8,
-    0xf8,
-    0xe8,
-    0xc8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x31 = { image_data_twr_font_ubuntu_11_0x31,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x32[11] = {
-    0xf8,
-    0xf8,
-    0xc8,
-    0xb0,
-    0xf0,
-    0xe8,
-    0xd8,
-    0x80,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x32 = { image_data_twr_font_ubuntu_11_0x32,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x33[11] = {
-    0xf8,
-    0xf8,
-    0x88,
-    0xf0,
-    0xc8,
-    0xf0,
-    0xf0,
-    0x88,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x33 = { image_data_twr_font_ubuntu_11_0x33,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x34[11] = {
-    0xf8,
-    0xf8,
-    0xe8,
-    0xc8,
-    0xa8,
-    0x80,
-    0xe8,
-    0xe8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x34 = { image_data_twr_font_ubuntu_11_0x34,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x35[11] = {
-    0xf8,
-    0xf8,
-    0xc0,
-    0xd8,
-    0xc8,
-    0xf0,
-    0xf0,
-    0x88,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x35 = { image_data_twr_font_ubuntu_11_0x35,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x36[11] = {
-    0xf8,
-    0xf8,
-    0xe0,
-    0xd8,
-    0x88,
-    0xb0,
-    0xb0,
-    0xc8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x36 = { image_data_twr_font_ubuntu_11_0x36,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x37[11] = {
-    0xf8,
-    0xf8,
-    0x88,
-    0xe8,
-    0xe8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x37 = { image_data_twr_font_ubuntu_11_0x37,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x38[11] = {
-    0xf8,
-    0xf8,
-    0xc8,
-    0xb0,
-    0xc8,
-    0xb0,
-    0xb0,
-    0xc8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x38 = { image_data_twr_font_ubuntu_11_0x38,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x39[11] = {
-    0xf8,
-    0xf8,
-    0xc8,
-    0xb0,
-    0xb0,
-    0xc0,
-    0xe8,
-    0x98,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x39 = { image_data_twr_font_ubuntu_11_0x39,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x3a[11] = {
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0x80,
-    0xc0,
-    0xc0,
-    0x80,
-    0xc0,
-    0xc0,
-    0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x3a = { image_data_twr_font_ubuntu_11_0x3a,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x3b[11] = {
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0x80,
-    0xc0,
-    0xc0,
-    0x80,
-    0x40,
-    0xc0,
-    0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x3b = { image_data_twr_font_ubuntu_11_0x3b,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x3c[11] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0x88,
-    0x78,
-    0x88,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x3c = { image_data_twr_font_ubuntu_11_0x3c,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x3d[11] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0x80,
-    0xf8,
-    0x80,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x3d = { image_data_twr_font_ubuntu_11_0x3d,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x3e[11] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0x98,
-    0xe8,
-    0x98,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x3e = { image_data_twr_font_ubuntu_11_0x3e,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x3f[11] = {
-    0xe0,
-    0xe0,
-    0x80,
-    0xc0,
-    0xc0,
-    0xa0,
-    0xe0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x3f = { image_data_twr_font_ubuntu_11_0x3f,
-    3, 11/*, 8*/};
+    0xf8, 0xf8, 0xc8, 0xb0, 0xb0, 0xb0, 0xb0, 0xc8, 0xf8, 0xf8, 0xf8
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x30 = { image_data_twr_font_ubuntu_11_0x30, 5, 11, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x31[7] = {
+    0xd1, 0x32, 0x41, 0x41, 0x41, 0x41, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x31 = { image_data_twr_font_ubuntu_11_0x31, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x32[8] = {
+    0xc2, 0x21, 0x21, 0x41, 0x31, 0x31, 0x34, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x32 = { image_data_twr_font_ubuntu_11_0x32, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x33[7] = {
+    0xb3, 0x51, 0x22, 0x51, 0x41, 0x13, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x33 = { image_data_twr_font_ubuntu_11_0x33, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x34[8] = {
+    0xd1, 0x32, 0x21, 0x11, 0x24, 0x31, 0x41, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x34 = { image_data_twr_font_ubuntu_11_0x34, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x35[7] = {
+    0xc3, 0x21, 0x42, 0x51, 0x41, 0x13, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x35 = { image_data_twr_font_ubuntu_11_0x35, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x36[9] = {
+    0xd2, 0x21, 0x33, 0x21, 0x21, 0x11, 0x21, 0x22, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x36 = { image_data_twr_font_ubuntu_11_0x36, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x37[7] = {
+    0xb3, 0x41, 0x41, 0x31, 0x41, 0x41, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x37 = { image_data_twr_font_ubuntu_11_0x37, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x38[10] = {
+    0xc2, 0x21, 0x21, 0x22, 0x21, 0x21, 0x11, 0x21, 0x22, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x38 = { image_data_twr_font_ubuntu_11_0x38, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x39[9] = {
+    0xc2, 0x21, 0x21, 0x11, 0x21, 0x23, 0x31, 0x22, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x39 = { image_data_twr_font_ubuntu_11_0x39, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x3a[3] = {
+    0x91, 0x51, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x3a = { image_data_twr_font_ubuntu_11_0x3a, 2, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x3b[3] = {
+    0x91, 0x52, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x3b = { image_data_twr_font_ubuntu_11_0x3b, 2, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x3c[5] = {
+    0xf0, 0x63, 0x11, 0x53, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x3c = { image_data_twr_font_ubuntu_11_0x3c, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x3d[4] = {
+    0xf0, 0x64, 0x64, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x3d = { image_data_twr_font_ubuntu_11_0x3d, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x3e[5] = {
+    0xf0, 0x62, 0x51, 0x22, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x3e = { image_data_twr_font_ubuntu_11_0x3e, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x3f[6] = {
+    0x72, 0x21, 0x21, 0x11, 0x51, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x3f = { image_data_twr_font_ubuntu_11_0x3f, 3, 11, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_11_0x40[11] = {
-    0xff,
-    0xff,
-    0xe3,
-    0xdd,
-    0xb2,
-    0xaa,
-    0xaa,
-    0xa5,
-    0xdf,
-    0xe3,
-    0xff
+    0xff, 0xff, 0xe3, 0xdd, 0xb2, 0xaa, 0xaa, 0xa5, 0xdf, 0xe3, 0xff
 };
-static const twr_font_image_t twr_font_ubuntu_11_0x40 = { image_data_twr_font_ubuntu_11_0x40,
-    8, 11/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_11_0x40 = { image_data_twr_font_ubuntu_11_0x40, 8, 11, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_11_0x41[11] = {
-    0xfc,
-    0xfc,
-    0xec,
-    0xd4,
-    0xd4,
-    0xd4,
-    0x80,
-    0xb8,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x41 = { image_data_twr_font_ubuntu_11_0x41,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x42[11] = {
-    0xf8,
-    0xf8,
-    0x88,
-    0xb0,
-    0x88,
-    0xb0,
-    0xb0,
-    0x88,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x42 = { image_data_twr_font_ubuntu_11_0x42,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x43[11] = {
-    0xf8,
-    0xf8,
-    0xc0,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xc0,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x43 = { image_data_twr_font_ubuntu_11_0x43,
-    5, 11/*, 8*/};
+    0xfc, 0xfc, 0xec, 0xd4, 0xd4, 0xd4, 0x80, 0xb8, 0xfc, 0xfc, 0xfc
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x41 = { image_data_twr_font_ubuntu_11_0x41, 6, 11, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x42[10] = {
+    0xb3, 0x21, 0x21, 0x13, 0x21, 0x21, 0x11, 0x21, 0x13, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x42 = { image_data_twr_font_ubuntu_11_0x42, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x43[7] = {
+    0xc3, 0x11, 0x41, 0x41, 0x41, 0x53, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x43 = { image_data_twr_font_ubuntu_11_0x43, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_11_0x44[11] = {
-    0xfc,
-    0xfc,
-    0x84,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0x84,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x44 = { image_data_twr_font_ubuntu_11_0x44,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x45[11] = {
-    0xf8,
-    0xf8,
-    0x80,
-    0xb8,
-    0x88,
-    0xb8,
-    0xb8,
-    0x80,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x45 = { image_data_twr_font_ubuntu_11_0x45,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x46[11] = {
-    0xf0,
-    0xf0,
-    0x80,
-    0xb0,
-    0x90,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x46 = { image_data_twr_font_ubuntu_11_0x46,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x47[11] = {
-    0xf8,
-    0xf8,
-    0xc0,
-    0xb8,
-    0xb8,
-    0xb0,
-    0xb0,
-    0xc0,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x47 = { image_data_twr_font_ubuntu_11_0x47,
-    5, 11/*, 8*/};
+    0xfc, 0xfc, 0x84, 0xb8, 0xb8, 0xb8, 0xb8, 0x84, 0xfc, 0xfc, 0xfc
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x44 = { image_data_twr_font_ubuntu_11_0x44, 6, 11, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x45[7] = {
+    0xb4, 0x11, 0x43, 0x21, 0x41, 0x44, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x45 = { image_data_twr_font_ubuntu_11_0x45, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x46[7] = {
+    0x93, 0x11, 0x32, 0x21, 0x31, 0x31, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x46 = { image_data_twr_font_ubuntu_11_0x46, 4, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x47[9] = {
+    0xc3, 0x11, 0x41, 0x41, 0x21, 0x11, 0x21, 0x23, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x47 = { image_data_twr_font_ubuntu_11_0x47, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_11_0x48[11] = {
-    0xfc,
-    0xfc,
-    0xb8,
-    0xb8,
-    0x80,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x48 = { image_data_twr_font_ubuntu_11_0x48,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x49[11] = {
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x49 = { image_data_twr_font_ubuntu_11_0x49,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x4a[11] = {
-    0xf0,
-    0xf0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0x90,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x4a = { image_data_twr_font_ubuntu_11_0x4a,
-    4, 11/*, 8*/};
+    0xfc, 0xfc, 0xb8, 0xb8, 0x80, 0xb8, 0xb8, 0xb8, 0xfc, 0xfc, 0xfc
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x48 = { image_data_twr_font_ubuntu_11_0x48, 6, 11, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x49[7] = {
+    0x71, 0x21, 0x21, 0x21, 0x21, 0x21, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x49 = { image_data_twr_font_ubuntu_11_0x49, 3, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x4a[7] = {
+    0xb1, 0x31, 0x31, 0x31, 0x31, 0x12, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x4a = { image_data_twr_font_ubuntu_11_0x4a, 4, 11, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_11_0x4b[11] = {
-    0xf8,
-    0xf8,
-    0xb0,
-    0xa8,
-    0x98,
-    0x98,
-    0xa8,
-    0xb0,
-    0xf8,
-    0xf8,
-    0xf8
+    0xf8, 0xf8, 0xb0, 0xa8, 0x98, 0x98, 0xa8, 0xb0, 0xf8, 0xf8, 0xf8
 };
-static const twr_font_image_t twr_font_ubuntu_11_0x4b = { image_data_twr_font_ubuntu_11_0x4b,
-    5, 11/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_11_0x4b = { image_data_twr_font_ubuntu_11_0x4b, 5, 11, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x4c[11] = {
-    0xf0,
-    0xf0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0x80,
-    0xf0,
-    0xf0,
-    0xf0
+static const uint8_t image_data_twr_font_ubuntu_11_0x4c[7] = {
+    0x91, 0x31, 0x31, 0x31, 0x31, 0x33, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_11_0x4c = { image_data_twr_font_ubuntu_11_0x4c,
-    4, 11/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_11_0x4c = { image_data_twr_font_ubuntu_11_0x4c, 4, 11, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_11_0x4d[11] = {
-    0xfc,
-    0xfc,
-    0xb8,
-    0x90,
-    0x90,
-    0xa8,
-    0xa8,
-    0xb8,
-    0xfc,
-    0xfc,
-    0xfc
+    0xfc, 0xfc, 0xb8, 0x90, 0x90, 0xa8, 0xa8, 0xb8, 0xfc, 0xfc, 0xfc
 };
-static const twr_font_image_t twr_font_ubuntu_11_0x4d = { image_data_twr_font_ubuntu_11_0x4d,
-    6, 11/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_11_0x4d = { image_data_twr_font_ubuntu_11_0x4d, 6, 11, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x4e[11] = {
-    0xf8,
-    0xf8,
-    0x88,
-    0x88,
-    0x88,
-    0x88,
-    0x88,
-    0xa8,
-    0xf8,
-    0xf8,
-    0xf8
+static const uint8_t image_data_twr_font_ubuntu_11_0x4e[8] = {
+    0xb3, 0x23, 0x23, 0x23, 0x23, 0x21, 0x11, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_11_0x4e = { image_data_twr_font_ubuntu_11_0x4e,
-    5, 11/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_11_0x4e = { image_data_twr_font_ubuntu_11_0x4e, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_11_0x4f[11] = {
-    0xfc,
-    0xfc,
-    0xc4,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xc4,
-    0xfc,
-    0xfc,
-    0xfc
+    0xfc, 0xfc, 0xc4, 0xb8, 0xb8, 0xb8, 0xb8, 0xc4, 0xfc, 0xfc, 0xfc
 };
-static const twr_font_image_t twr_font_ubuntu_11_0x4f = { image_data_twr_font_ubuntu_11_0x4f,
-    6, 11/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_11_0x4f = { image_data_twr_font_ubuntu_11_0x4f, 6, 11, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x50[11] = {
-    0xf8,
-    0xf8,
-    0x88,
-    0xb0,
-    0xb0,
-    0x88,
-    0xb8,
-    0xb8,
-    0xf8,
-    0xf8,
-    0xf8
+static const uint8_t image_data_twr_font_ubuntu_11_0x50[9] = {
+    0xb3, 0x21, 0x21, 0x11, 0x21, 0x13, 0x21, 0x41, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_11_0x50 = { image_data_twr_font_ubuntu_11_0x50,
-    5, 11/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_11_0x50 = { image_data_twr_font_ubuntu_11_0x50, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_11_0x51[11] = {
-    0xfc,
-    0xfc,
-    0xc4,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xc4,
-    0xec,
-    0xf4,
-    0xfc
+    0xfc, 0xfc, 0xc4, 0xb8, 0xb8, 0xb8, 0xb8, 0xc4, 0xec, 0xf4, 0xfc
 };
-static const twr_font_image_t twr_font_ubuntu_11_0x51 = { image_data_twr_font_ubuntu_11_0x51,
-    6, 11/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_11_0x51 = { image_data_twr_font_ubuntu_11_0x51, 6, 11, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_11_0x52[11] = {
-    0xf8,
-    0xf8,
-    0x88,
-    0xb0,
-    0xb0,
-    0x88,
-    0xa8,
-    0xb0,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x52 = { image_data_twr_font_ubuntu_11_0x52,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x53[11] = {
-    0xf0,
-    0xf0,
-    0xc0,
-    0xb0,
-    0xb0,
-    0xc0,
-    0xe0,
-    0x90,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x53 = { image_data_twr_font_ubuntu_11_0x53,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x54[11] = {
-    0xf0,
-    0xf0,
-    0x80,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x54 = { image_data_twr_font_ubuntu_11_0x54,
-    4, 11/*, 8*/};
+    0xf8, 0xf8, 0x88, 0xb0, 0xb0, 0x88, 0xa8, 0xb0, 0xf8, 0xf8, 0xf8
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x52 = { image_data_twr_font_ubuntu_11_0x52, 5, 11, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x53[7] = {
+    0xa2, 0x11, 0x31, 0x42, 0x31, 0x12, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x53 = { image_data_twr_font_ubuntu_11_0x53, 4, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x54[7] = {
+    0x93, 0x21, 0x31, 0x31, 0x31, 0x31, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x54 = { image_data_twr_font_ubuntu_11_0x54, 4, 11, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_11_0x55[11] = {
-    0xfc,
-    0xfc,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xc4,
-    0xfc,
-    0xfc,
-    0xfc
+    0xfc, 0xfc, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xc4, 0xfc, 0xfc, 0xfc
 };
-static const twr_font_image_t twr_font_ubuntu_11_0x55 = { image_data_twr_font_ubuntu_11_0x55,
-    6, 11/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_11_0x55 = { image_data_twr_font_ubuntu_11_0x55, 6, 11, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_11_0x56[11] = {
-    0xfc,
-    0xfc,
-    0xb8,
-    0xb8,
-    0xd4,
-    0xd4,
-    0xd4,
-    0xec,
-    0xfc,
-    0xfc,
-    0xfc
+    0xfc, 0xfc, 0xb8, 0xb8, 0xd4, 0xd4, 0xd4, 0xec, 0xfc, 0xfc, 0xfc
 };
-static const twr_font_image_t twr_font_ubuntu_11_0x56 = { image_data_twr_font_ubuntu_11_0x56,
-    6, 11/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_11_0x56 = { image_data_twr_font_ubuntu_11_0x56, 6, 11, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_11_0x57[11] = {
-    0xff,
-    0xff,
-    0xbe,
-    0xb6,
-    0xaa,
-    0xaa,
-    0xaa,
-    0xdd,
-    0xff,
-    0xff,
-    0xff
+    0xff, 0xff, 0xbe, 0xb6, 0xaa, 0xaa, 0xaa, 0xdd, 0xff, 0xff, 0xff
 };
-static const twr_font_image_t twr_font_ubuntu_11_0x57 = { image_data_twr_font_ubuntu_11_0x57,
-    8, 11/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_11_0x57 = { image_data_twr_font_ubuntu_11_0x57, 8, 11, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_11_0x58[11] = {
-    0xfc,
-    0xfc,
-    0xb8,
-    0xd4,
-    0xec,
-    0xec,
-    0xd4,
-    0xb8,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x58 = { image_data_twr_font_ubuntu_11_0x58,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x59[11] = {
-    0xfc,
-    0xfc,
-    0xb8,
-    0xd4,
-    0xd4,
-    0xec,
-    0xec,
-    0xec,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x59 = { image_data_twr_font_ubuntu_11_0x59,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x5a[11] = {
-    0xf8,
-    0xf8,
-    0x80,
-    0xf0,
-    0xe8,
-    0xd8,
-    0xb8,
-    0x80,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x5a = { image_data_twr_font_ubuntu_11_0x5a,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x5b[11] = {
-    0xe0,
-    0xe0,
-    0x80,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0x80,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x5b = { image_data_twr_font_ubuntu_11_0x5b,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x5c[11] = {
-    0xe0,
-    0xe0,
-    0x60,
-    0x60,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xc0,
-    0xc0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x5c = { image_data_twr_font_ubuntu_11_0x5c,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x5d[11] = {
-    0xe0,
-    0xe0,
-    0x20,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0x20,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x5d = { image_data_twr_font_ubuntu_11_0x5d,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x5e[11] = {
-    0xf8,
-    0xf8,
-    0xd8,
-    0xa8,
-    0xa8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x5e = { image_data_twr_font_ubuntu_11_0x5e,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x5f[11] = {
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0x00,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x5f = { image_data_twr_font_ubuntu_11_0x5f,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x60[11] = {
-    0xe0,
-    0xa0,
-    0xc0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x60 = { image_data_twr_font_ubuntu_11_0x60,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x61[11] = {
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0x90,
-    0xe0,
-    0xc0,
-    0x80,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x61 = { image_data_twr_font_ubuntu_11_0x61,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x62[11] = {
-    0xf8,
-    0xf8,
-    0xb8,
-    0xb8,
-    0x88,
-    0xb0,
-    0xb0,
-    0x88,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x62 = { image_data_twr_font_ubuntu_11_0x62,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x63[11] = {
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xc0,
-    0xb0,
-    0xb0,
-    0xc0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x63 = { image_data_twr_font_ubuntu_11_0x63,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x64[11] = {
-    0xf8,
-    0xf8,
-    0xf0,
-    0xf0,
-    0xc0,
-    0xb0,
-    0xb0,
-    0xc0,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x64 = { image_data_twr_font_ubuntu_11_0x64,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x65[11] = {
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0x80,
-    0x80,
-    0xb0,
-    0xc0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x65 = { image_data_twr_font_ubuntu_11_0x65,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x66[11] = {
-    0xe0,
-    0xe0,
-    0xc0,
-    0xa0,
-    0x80,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x66 = { image_data_twr_font_ubuntu_11_0x66,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x67[11] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xc0,
-    0xb0,
-    0xc0,
-    0xf0,
-    0x88,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x67 = { image_data_twr_font_ubuntu_11_0x67,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x68[11] = {
-    0xf8,
-    0xf8,
-    0xb8,
-    0xb8,
-    0x88,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x68 = { image_data_twr_font_ubuntu_11_0x68,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x69[11] = {
-    0xc0,
-    0xc0,
-    0x80,
-    0xc0,
-    0x80,
-    0x80,
-    0x80,
-    0x80,
-    0xc0,
-    0xc0,
-    0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x69 = { image_data_twr_font_ubuntu_11_0x69,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x6a[11] = {
-    0xc0,
-    0xc0,
-    0x80,
-    0xc0,
-    0x80,
-    0x80,
-    0x80,
-    0x80,
-    0x40,
-    0xc0,
-    0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x6a = { image_data_twr_font_ubuntu_11_0x6a,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x6b[11] = {
-    0xf0,
-    0xf0,
-    0xb0,
-    0xb0,
-    0xa0,
-    0x90,
-    0x90,
-    0xa0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x6b = { image_data_twr_font_ubuntu_11_0x6b,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x6c[11] = {
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xc0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x6c = { image_data_twr_font_ubuntu_11_0x6c,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x6d[22] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0x89, 0x80,
-    0xb6, 0x80,
-    0xb6, 0x80,
-    0xb6, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x6d = { image_data_twr_font_ubuntu_11_0x6d,
-    9, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x6e[11] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0x88,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x6e = { image_data_twr_font_ubuntu_11_0x6e,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x6f[11] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xc8,
-    0xb0,
-    0xb0,
-    0xc8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x6f = { image_data_twr_font_ubuntu_11_0x6f,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x70[11] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0x88,
-    0xb0,
-    0xb0,
-    0x88,
-    0xb8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x70 = { image_data_twr_font_ubuntu_11_0x70,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x71[11] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xc0,
-    0xb0,
-    0xb0,
-    0xc0,
-    0xf0,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x71 = { image_data_twr_font_ubuntu_11_0x71,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x72[11] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0x80,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x72 = { image_data_twr_font_ubuntu_11_0x72,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x73[11] = {
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xc0,
-    0xb0,
-    0xc0,
-    0x90,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x73 = { image_data_twr_font_ubuntu_11_0x73,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x74[11] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0x80,
-    0xa0,
-    0xa0,
-    0xc0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x74 = { image_data_twr_font_ubuntu_11_0x74,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x75[11] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xc0,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x75 = { image_data_twr_font_ubuntu_11_0x75,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x76[11] = {
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xa0,
-    0xa0,
-    0xd0,
-    0xd0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x76 = { image_data_twr_font_ubuntu_11_0x76,
-    4, 11/*, 8*/};
+    0xfc, 0xfc, 0xb8, 0xd4, 0xec, 0xec, 0xd4, 0xb8, 0xfc, 0xfc, 0xfc
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x58 = { image_data_twr_font_ubuntu_11_0x58, 6, 11, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x59[10] = {
+    0xd1, 0x31, 0x21, 0x11, 0x31, 0x11, 0x41, 0x51, 0x51, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x59 = { image_data_twr_font_ubuntu_11_0x59, 6, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x5a[7] = {
+    0xb4, 0x41, 0x31, 0x31, 0x31, 0x44, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x5a = { image_data_twr_font_ubuntu_11_0x5a, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x5b[8] = {
+    0x72, 0x11, 0x21, 0x21, 0x21, 0x21, 0x22, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x5b = { image_data_twr_font_ubuntu_11_0x5b, 3, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x5c[8] = {
+    0x61, 0x21, 0x31, 0x21, 0x21, 0x31, 0x21, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x5c = { image_data_twr_font_ubuntu_11_0x5c, 3, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x5d[8] = {
+    0x62, 0x21, 0x21, 0x21, 0x21, 0x21, 0x12, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x5d = { image_data_twr_font_ubuntu_11_0x5d, 3, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x5e[6] = {
+    0xc1, 0x31, 0x11, 0x21, 0x11, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x5e = { image_data_twr_font_ubuntu_11_0x5e, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x5f[4] = {
+    0xf0, 0xf0, 0x24, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x5f = { image_data_twr_font_ubuntu_11_0x5f, 4, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x60[3] = {
+    0x41, 0x31, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x60 = { image_data_twr_font_ubuntu_11_0x60, 3, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x61[6] = {
+    0xf0, 0x22, 0x41, 0x22, 0x13, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x61 = { image_data_twr_font_ubuntu_11_0x61, 4, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x62[9] = {
+    0xb1, 0x41, 0x43, 0x21, 0x21, 0x11, 0x21, 0x13, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x62 = { image_data_twr_font_ubuntu_11_0x62, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x63[6] = {
+    0xf0, 0x32, 0x11, 0x31, 0x42, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x63 = { image_data_twr_font_ubuntu_11_0x63, 4, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x64[9] = {
+    0xe1, 0x41, 0x23, 0x11, 0x21, 0x11, 0x21, 0x23, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x64 = { image_data_twr_font_ubuntu_11_0x64, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x65[6] = {
+    0xf0, 0x23, 0x13, 0x11, 0x42, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x65 = { image_data_twr_font_ubuntu_11_0x65, 4, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x66[7] = {
+    0x81, 0x11, 0x22, 0x11, 0x21, 0x21, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x66 = { image_data_twr_font_ubuntu_11_0x66, 3, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x67[8] = {
+    0xf0, 0x73, 0x11, 0x21, 0x23, 0x41, 0x13, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x67 = { image_data_twr_font_ubuntu_11_0x67, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x68[10] = {
+    0xb1, 0x41, 0x43, 0x21, 0x21, 0x11, 0x21, 0x11, 0x21, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x68 = { image_data_twr_font_ubuntu_11_0x68, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x69[6] = {
+    0x51, 0x31, 0x11, 0x11, 0x11, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x69 = { image_data_twr_font_ubuntu_11_0x69, 2, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x6a[6] = {
+    0x51, 0x31, 0x11, 0x11, 0x12, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x6a = { image_data_twr_font_ubuntu_11_0x6a, 2, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x6b[9] = {
+    0x91, 0x31, 0x31, 0x11, 0x12, 0x22, 0x21, 0x11, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x6b = { image_data_twr_font_ubuntu_11_0x6b, 4, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x6c[7] = {
+    0x71, 0x21, 0x21, 0x21, 0x21, 0x31, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x6c = { image_data_twr_font_ubuntu_11_0x6c, 3, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x6d[14] = {
+    0xf0, 0xf0, 0x73, 0x12, 0x31, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+    0x21, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x6d = { image_data_twr_font_ubuntu_11_0x6d, 9, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x6e[9] = {
+    0xf0, 0x63, 0x21, 0x21, 0x11, 0x21, 0x11, 0x21, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x6e = { image_data_twr_font_ubuntu_11_0x6e, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x6f[8] = {
+    0xf0, 0x72, 0x21, 0x21, 0x11, 0x21, 0x22, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x6f = { image_data_twr_font_ubuntu_11_0x6f, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x70[9] = {
+    0xf0, 0x63, 0x21, 0x21, 0x11, 0x21, 0x13, 0x21, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x70 = { image_data_twr_font_ubuntu_11_0x70, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x71[9] = {
+    0xf0, 0x73, 0x11, 0x21, 0x11, 0x21, 0x23, 0x41, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x71 = { image_data_twr_font_ubuntu_11_0x71, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x72[5] = {
+    0xd2, 0x11, 0x21, 0x21, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x72 = { image_data_twr_font_ubuntu_11_0x72, 3, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x73[6] = {
+    0xf0, 0x32, 0x11, 0x42, 0x12, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x73 = { image_data_twr_font_ubuntu_11_0x73, 4, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x74[6] = {
+    0xa1, 0x22, 0x11, 0x21, 0x31, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x74 = { image_data_twr_font_ubuntu_11_0x74, 3, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x75[9] = {
+    0xf0, 0x61, 0x21, 0x11, 0x21, 0x11, 0x21, 0x23, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x75 = { image_data_twr_font_ubuntu_11_0x75, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x76[8] = {
+    0xf0, 0x21, 0x11, 0x11, 0x11, 0x21, 0x31, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x76 = { image_data_twr_font_ubuntu_11_0x76, 4, 11, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_11_0x77[11] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xa8,
-    0xa8,
-    0xa8,
-    0xd4,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x77 = { image_data_twr_font_ubuntu_11_0x77,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x78[11] = {
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xa0,
-    0xd0,
-    0xd0,
-    0xa0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x78 = { image_data_twr_font_ubuntu_11_0x78,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x79[11] = {
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xa0,
-    0xa0,
-    0xd0,
-    0xd0,
-    0xb0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x79 = { image_data_twr_font_ubuntu_11_0x79,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x7a[11] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0x80,
-    0xc0,
-    0xa0,
-    0x80,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x7a = { image_data_twr_font_ubuntu_11_0x7a,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x7b[11] = {
-    0xe0,
-    0xe0,
-    0xc0,
-    0xa0,
-    0xa0,
-    0x60,
-    0xa0,
-    0xa0,
-    0xc0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x7b = { image_data_twr_font_ubuntu_11_0x7b,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x7c[11] = {
-    0xc0,
-    0xc0,
-    0x80,
-    0x80,
-    0x80,
-    0x80,
-    0x80,
-    0x80,
-    0x80,
-    0xc0,
-    0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x7c = { image_data_twr_font_ubuntu_11_0x7c,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x7d[11] = {
-    0xe0,
-    0xe0,
-    0x60,
-    0xa0,
-    0xa0,
-    0xc0,
-    0xa0,
-    0xa0,
-    0x60,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x7d = { image_data_twr_font_ubuntu_11_0x7d,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x7e[11] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xa8,
-    0x58,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x7e = { image_data_twr_font_ubuntu_11_0x7e,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xb0[11] = {
-    0xe0,
-    0x80,
-    0x80,
-    0x80,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xb0 = { image_data_twr_font_ubuntu_11_0xb0,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xb9[11] = {
-    0xf0,
-    0xa0,
-    0xd0,
-    0xf0,
-    0xc0,
-    0xb0,
-    0xc0,
-    0x90,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xb9 = { image_data_twr_font_ubuntu_11_0xb9,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xbb[11] = {
-    0xf0,
-    0xe0,
-    0xe0,
-    0xb0,
-    0x90,
-    0xb0,
-    0xb0,
-    0xd0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xbb = { image_data_twr_font_ubuntu_11_0xbb,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xbe[11] = {
-    0xe0,
-    0x40,
-    0xa0,
-    0xe0,
-    0x80,
-    0xc0,
-    0xa0,
-    0x80,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xbe = { image_data_twr_font_ubuntu_11_0xbe,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xe1[11] = {
-    0xf0,
-    0xe0,
-    0xd0,
-    0xf0,
-    0x90,
-    0xe0,
-    0xc0,
-    0x80,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xe1 = { image_data_twr_font_ubuntu_11_0xe1,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xe8[11] = {
-    0xf0,
-    0xa0,
-    0xd0,
-    0xf0,
-    0xc0,
-    0xb0,
-    0xb0,
-    0xc0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xe8 = { image_data_twr_font_ubuntu_11_0xe8,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xe9[11] = {
-    0xf0,
-    0xe0,
-    0xd0,
-    0xf0,
-    0x80,
-    0x80,
-    0xb0,
-    0xc0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xe9 = { image_data_twr_font_ubuntu_11_0xe9,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xec[11] = {
-    0xa0,
-    0xd0,
-    0xf0,
-    0xf0,
-    0x80,
-    0x80,
-    0xb0,
-    0xc0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xec = { image_data_twr_font_ubuntu_11_0xec,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xed[11] = {
-    0xe0,
-    0xc0,
-    0xa0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xed = { image_data_twr_font_ubuntu_11_0xed,
-    3, 11/*, 8*/};
+    0xfc, 0xfc, 0xfc, 0xfc, 0xa8, 0xa8, 0xa8, 0xd4, 0xfc, 0xfc, 0xfc
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x77 = { image_data_twr_font_ubuntu_11_0x77, 6, 11, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x78[8] = {
+    0xf0, 0x21, 0x11, 0x21, 0x31, 0x21, 0x11, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x78 = { image_data_twr_font_ubuntu_11_0x78, 4, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x79[9] = {
+    0xf0, 0x21, 0x11, 0x11, 0x11, 0x21, 0x31, 0x21, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x79 = { image_data_twr_font_ubuntu_11_0x79, 4, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x7a[5] = {
+    0xd2, 0x21, 0x11, 0x22, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x7a = { image_data_twr_font_ubuntu_11_0x7a, 3, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x7b[8] = {
+    0x81, 0x11, 0x21, 0x11, 0x31, 0x21, 0x31, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x7b = { image_data_twr_font_ubuntu_11_0x7b, 3, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x7c[8] = {
+    0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x7c = { image_data_twr_font_ubuntu_11_0x7c, 2, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x7d[8] = {
+    0x61, 0x31, 0x21, 0x31, 0x11, 0x21, 0x11, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x7d = { image_data_twr_font_ubuntu_11_0x7d, 3, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0x7e[6] = {
+    0xf0, 0xb1, 0x11, 0x11, 0x11, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0x7e = { image_data_twr_font_ubuntu_11_0x7e, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0xb0[4] = {
+    0x42, 0x12, 0x12, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0xb0 = { image_data_twr_font_ubuntu_11_0xb0, 3, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0xb9[8] = {
+    0x51, 0x11, 0x21, 0x72, 0x11, 0x42, 0x12, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0xb9 = { image_data_twr_font_ubuntu_11_0xb9, 4, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0xbb[8] = {
+    0x71, 0x31, 0x11, 0x32, 0x21, 0x31, 0x41, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0xbb = { image_data_twr_font_ubuntu_11_0xbb, 4, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0xbe[8] = {
+    0x31, 0x11, 0x11, 0x52, 0x21, 0x11, 0x22, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0xbe = { image_data_twr_font_ubuntu_11_0xbe, 3, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0xe1[7] = {
+    0x71, 0x21, 0x62, 0x41, 0x22, 0x13, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0xe1 = { image_data_twr_font_ubuntu_11_0xe1, 4, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0xe8[8] = {
+    0x51, 0x11, 0x21, 0x72, 0x11, 0x31, 0x42, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0xe8 = { image_data_twr_font_ubuntu_11_0xe8, 4, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0xe9[7] = {
+    0x71, 0x21, 0x63, 0x13, 0x11, 0x42, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0xe9 = { image_data_twr_font_ubuntu_11_0xe9, 4, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0xec[8] = {
+    0x11, 0x11, 0x21, 0xa3, 0x13, 0x11, 0x42, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0xec = { image_data_twr_font_ubuntu_11_0xec, 4, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0xed[7] = {
+    0x51, 0x11, 0x51, 0x21, 0x21, 0x21, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0xed = { image_data_twr_font_ubuntu_11_0xed, 3, 11, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_11_0xef[11] = {
-    0xfe,
-    0xfe,
-    0xf4,
-    0xf4,
-    0xc6,
-    0xb6,
-    0xb6,
-    0xc6,
-    0xfe,
-    0xfe,
-    0xfe
+    0xfe, 0xfe, 0xf4, 0xf4, 0xc6, 0xb6, 0xb6, 0xc6, 0xfe, 0xfe, 0xfe
 };
-static const twr_font_image_t twr_font_ubuntu_11_0xef = { image_data_twr_font_ubuntu_11_0xef,
-    7, 11/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_11_0xef = { image_data_twr_font_ubuntu_11_0xef, 7, 11, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_11_0xf2[11] = {
-    0xf8,
-    0xd0,
-    0xe8,
-    0xf8,
-    0x88,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xf8,
-    0xf8,
-    0xf8
+    0xf8, 0xd0, 0xe8, 0xf8, 0x88, 0xb0, 0xb0, 0xb0, 0xf8, 0xf8, 0xf8
 };
-static const twr_font_image_t twr_font_ubuntu_11_0xf2 = { image_data_twr_font_ubuntu_11_0xf2,
-    5, 11/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_11_0xf2 = { image_data_twr_font_ubuntu_11_0xf2, 5, 11, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xf8[11] = {
-    0xf0,
-    0xa0,
-    0xd0,
-    0xf0,
-    0x90,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xf0,
-    0xf0,
-    0xf0
+static const uint8_t image_data_twr_font_ubuntu_11_0xf8[8] = {
+    0x51, 0x11, 0x21, 0x62, 0x21, 0x31, 0x31, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_11_0xf8 = { image_data_twr_font_ubuntu_11_0xf8,
-    4, 11/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_11_0xf8 = { image_data_twr_font_ubuntu_11_0xf8, 4, 11, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_11_0xf9[11] = {
-    0xe8,
-    0xd0,
-    0xe8,
-    0xf8,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xc0,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xf9 = { image_data_twr_font_ubuntu_11_0xf9,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xfa[11] = {
-    0xf8,
-    0xe8,
-    0xd8,
-    0xf8,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xc0,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xfa = { image_data_twr_font_ubuntu_11_0xfa,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xfd[11] = {
-    0xf0,
-    0xe0,
-    0xd0,
-    0xf0,
-    0xa0,
-    0xa0,
-    0xd0,
-    0xd0,
-    0xb0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xfd = { image_data_twr_font_ubuntu_11_0xfd,
-    4, 11/*, 8*/};
+    0xe8, 0xd0, 0xe8, 0xf8, 0xb0, 0xb0, 0xb0, 0xc0, 0xf8, 0xf8, 0xf8
+};
+static const twr_font_image_t twr_font_ubuntu_11_0xf9 = { image_data_twr_font_ubuntu_11_0xf9, 5, 11, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0xfa[10] = {
+    0x81, 0x31, 0x81, 0x21, 0x11, 0x21, 0x11, 0x21, 0x23, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0xfa = { image_data_twr_font_ubuntu_11_0xfa, 5, 11, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_11_0xfd[10] = {
+    0x71, 0x21, 0x61, 0x11, 0x11, 0x11, 0x21, 0x31, 0x21, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_11_0xfd = { image_data_twr_font_ubuntu_11_0xfd, 4, 11, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 
@@ -14,7 +14,7 @@
 *
 * preset name: HARDWARIO $1 Module
 * data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
+* RLE compression enabled: no, converted by sdk/tools/font_rle.py
 * conversion type: Monochrome, Diffuse Dither 128
 * bits per pixel: 1
 *
@@ -31,2203 +31,819 @@
 
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x20[13] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x20 = { image_data_twr_font_ubuntu_13_0x20,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x21[13] = {
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x21 = { image_data_twr_font_ubuntu_13_0x21,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x22[13] = {
-    0xf8,
-    0xa8,
-    0xa8,
-    0xa8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8
+static const uint8_t image_data_twr_font_ubuntu_13_0x20[1] = {
+    0x00
+};
+static const twr_font_image_t twr_font_ubuntu_13_0x20 = { image_data_twr_font_ubuntu_13_0x20, 3, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x21[8] = {
+    0x71, 0x21, 0x21, 0x21, 0x21, 0x51, 0x21, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x22 = { image_data_twr_font_ubuntu_13_0x22,
-    5, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x21 = { image_data_twr_font_ubuntu_13_0x21, 3, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x22[7] = {
+    0x61, 0x11, 0x21, 0x11, 0x21, 0x11, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_13_0x22 = { image_data_twr_font_ubuntu_13_0x22, 5, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x23[13] = {
-    0xff,
-    0xff,
-    0xeb,
-    0xeb,
-    0x81,
-    0xeb,
-    0xd7,
-    0x81,
-    0xd7,
-    0xd7,
-    0xff,
-    0xff,
+    0xff, 0xff, 0xeb, 0xeb, 0x81, 0xeb, 0xd7, 0x81, 0xd7, 0xd7, 0xff, 0xff,
     0xff
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x23 = { image_data_twr_font_ubuntu_13_0x23,
-    8, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x23 = { image_data_twr_font_ubuntu_13_0x23, 8, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x24[13] = {
-    0xee,
-    0xee,
-    0xc2,
-    0xbe,
-    0xbe,
-    0xce,
-    0xf6,
-    0xfa,
-    0xfa,
-    0x86,
-    0xee,
-    0xee,
+    0xee, 0xee, 0xc2, 0xbe, 0xbe, 0xce, 0xf6, 0xfa, 0xfa, 0x86, 0xee, 0xee,
     0xfe
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x24 = { image_data_twr_font_ubuntu_13_0x24,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x24 = { image_data_twr_font_ubuntu_13_0x24, 7, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x25[26] = {
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xce, 0xc0,
-    0xb5, 0xc0,
-    0xb3, 0xc0,
-    0xcb, 0xc0,
-    0xf4, 0xc0,
-    0xf3, 0x40,
-    0xeb, 0x40,
-    0xdc, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
+static const uint8_t image_data_twr_font_ubuntu_13_0x25[20] = {
+    0xf0, 0x72, 0x31, 0x31, 0x21, 0x11, 0x41, 0x22, 0x62, 0x11, 0x81, 0x12,
+    0x62, 0x21, 0x41, 0x11, 0x21, 0x31, 0x32, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x25 = { image_data_twr_font_ubuntu_13_0x25,
-    10, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x25 = { image_data_twr_font_ubuntu_13_0x25, 10, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x26[13] = {
-    0xff,
-    0xff,
-    0xe7,
-    0xdb,
-    0xdb,
-    0xe7,
-    0xd5,
-    0xb9,
-    0xb9,
-    0xc5,
-    0xff,
-    0xff,
+    0xff, 0xff, 0xe7, 0xdb, 0xdb, 0xe7, 0xd5, 0xb9, 0xb9, 0xc5, 0xff, 0xff,
     0xff
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x26 = { image_data_twr_font_ubuntu_13_0x26,
-    8, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x27[13] = {
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x27 = { image_data_twr_font_ubuntu_13_0x27,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x28[13] = {
-    0xf0,
-    0xe0,
-    0xd0,
-    0xd0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xd0,
-    0xd0,
-    0xe0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x28 = { image_data_twr_font_ubuntu_13_0x28,
-    4, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x29[13] = {
-    0xf0,
-    0x70,
-    0xb0,
-    0xb0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xb0,
-    0xb0,
-    0x70,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x29 = { image_data_twr_font_ubuntu_13_0x29,
-    4, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x2a[13] = {
-    0xfc,
-    0xfc,
-    0xec,
-    0xa8,
-    0xc4,
-    0xd4,
-    0xd4,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc
+static const twr_font_image_t twr_font_ubuntu_13_0x26 = { image_data_twr_font_ubuntu_13_0x26, 8, 13, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x27[4] = {
+    0x41, 0x21, 0x21, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x2a = { image_data_twr_font_ubuntu_13_0x2a,
-    6, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x27 = { image_data_twr_font_ubuntu_13_0x27, 3, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x2b[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xee,
-    0xee,
-    0x82,
-    0xee,
-    0xee,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
+static const uint8_t image_data_twr_font_ubuntu_13_0x28[12] = {
+    0x71, 0x21, 0x31, 0x21, 0x31, 0x31, 0x31, 0x31, 0x41, 0x31, 0x41, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x2b = { image_data_twr_font_ubuntu_13_0x2b,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x2c[13] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0x60,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x2c = { image_data_twr_font_ubuntu_13_0x2c,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x2d[13] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0x88,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8
+static const twr_font_image_t twr_font_ubuntu_13_0x28 = { image_data_twr_font_ubuntu_13_0x28, 4, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x29[12] = {
+    0x41, 0x41, 0x31, 0x41, 0x31, 0x31, 0x31, 0x31, 0x21, 0x31, 0x21, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x2d = { image_data_twr_font_ubuntu_13_0x2d,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x2e[13] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x2e = { image_data_twr_font_ubuntu_13_0x2e,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x2f[13] = {
-    0xf8,
-    0xf0,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0x78,
-    0xf8
+static const twr_font_image_t twr_font_ubuntu_13_0x29 = { image_data_twr_font_ubuntu_13_0x29, 4, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x2a[10] = {
+    0xf1, 0x31, 0x11, 0x11, 0x23, 0x31, 0x11, 0x31, 0x11, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x2f = { image_data_twr_font_ubuntu_13_0x2f,
-    5, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x2a = { image_data_twr_font_ubuntu_13_0x2a, 6, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x2b[8] = {
+    0xf0, 0xf0, 0x11, 0x61, 0x45, 0x41, 0x61, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_13_0x2b = { image_data_twr_font_ubuntu_13_0x2b, 7, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x2c[6] = {
+    0xf0, 0xa1, 0x21, 0x21, 0x11, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_13_0x2c = { image_data_twr_font_ubuntu_13_0x2c, 3, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x2d[4] = {
+    0xf0, 0xf0, 0x13, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_13_0x2d = { image_data_twr_font_ubuntu_13_0x2d, 5, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x2e[4] = {
+    0xf0, 0xa1, 0x21, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_13_0x2e = { image_data_twr_font_ubuntu_13_0x2e, 3, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x2f[12] = {
+    0x91, 0x31, 0x41, 0x41, 0x31, 0x41, 0x41, 0x31, 0x41, 0x41, 0x31, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_13_0x2f = { image_data_twr_font_ubuntu_13_0x2f, 5, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x30[13] = {
-    0xfe,
-    0xfe,
-    0xc6,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xc6,
-    0xfe,
-    0xfe,
+    0xfe, 0xfe, 0xc6, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xc6, 0xfe, 0xfe,
     0xfe
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x30 = { image_data_twr_font_ubuntu_13_0x30,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x30 = { image_data_twr_font_ubuntu_13_0x30, 7, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x31[13] = {
-    0xfe,
-    0xfe,
-    0xee,
-    0xce,
-    0xae,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xfe,
-    0xfe,
-    0xfe
+static const uint8_t image_data_twr_font_ubuntu_13_0x31[11] = {
+    0xf0, 0x21, 0x52, 0x41, 0x11, 0x61, 0x61, 0x61, 0x61, 0x61, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x31 = { image_data_twr_font_ubuntu_13_0x31,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x31 = { image_data_twr_font_ubuntu_13_0x31, 7, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x32[13] = {
-    0xfe,
-    0xfe,
-    0xc6,
-    0xba,
-    0xfa,
-    0xf6,
-    0xee,
-    0xde,
-    0xbe,
-    0x82,
-    0xfe,
-    0xfe,
-    0xfe
+static const uint8_t image_data_twr_font_ubuntu_13_0x32[11] = {
+    0xf0, 0x13, 0x31, 0x31, 0x61, 0x51, 0x51, 0x51, 0x51, 0x65, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x32 = { image_data_twr_font_ubuntu_13_0x32,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x32 = { image_data_twr_font_ubuntu_13_0x32, 7, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x33[13] = {
-    0xfe,
-    0xfe,
-    0x86,
-    0xfa,
-    0xfa,
-    0xc6,
-    0xfa,
-    0xfa,
-    0xfa,
-    0x86,
-    0xfe,
-    0xfe,
-    0xfe
+static const uint8_t image_data_twr_font_ubuntu_13_0x33[9] = {
+    0xf4, 0x71, 0x61, 0x33, 0x71, 0x61, 0x61, 0x24, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x33 = { image_data_twr_font_ubuntu_13_0x33,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x33 = { image_data_twr_font_ubuntu_13_0x33, 7, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x34[13] = {
-    0xfe,
-    0xfe,
-    0xf6,
-    0xe6,
-    0xd6,
-    0xd6,
-    0xb6,
-    0x82,
-    0xf6,
-    0xf6,
-    0xfe,
-    0xfe,
+    0xfe, 0xfe, 0xf6, 0xe6, 0xd6, 0xd6, 0xb6, 0x82, 0xf6, 0xf6, 0xfe, 0xfe,
     0xfe
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x34 = { image_data_twr_font_ubuntu_13_0x34,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x34 = { image_data_twr_font_ubuntu_13_0x34, 7, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x35[13] = {
-    0xfe,
-    0xfe,
-    0xc2,
-    0xde,
-    0xde,
-    0xc6,
-    0xfa,
-    0xfa,
-    0xfa,
-    0x86,
-    0xfe,
-    0xfe,
-    0xfe
+static const uint8_t image_data_twr_font_ubuntu_13_0x35[10] = {
+    0xf0, 0x14, 0x31, 0x61, 0x63, 0x71, 0x61, 0x61, 0x24, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x35 = { image_data_twr_font_ubuntu_13_0x35,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x35 = { image_data_twr_font_ubuntu_13_0x35, 7, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x36[13] = {
-    0xfe,
-    0xfe,
-    0xe6,
-    0xde,
-    0xbe,
-    0x86,
-    0xba,
-    0xba,
-    0xba,
-    0xc6,
-    0xfe,
-    0xfe,
+    0xfe, 0xfe, 0xe6, 0xde, 0xbe, 0x86, 0xba, 0xba, 0xba, 0xc6, 0xfe, 0xfe,
     0xfe
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x36 = { image_data_twr_font_ubuntu_13_0x36,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x36 = { image_data_twr_font_ubuntu_13_0x36, 7, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x37[13] = {
-    0xfe,
-    0xfe,
-    0x82,
-    0xfa,
-    0xf6,
-    0xee,
-    0xee,
-    0xee,
-    0xde,
-    0xde,
-    0xfe,
-    0xfe,
-    0xfe
+static const uint8_t image_data_twr_font_ubuntu_13_0x37[9] = {
+    0xf5, 0x61, 0x51, 0x51, 0x61, 0x61, 0x51, 0x61, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x37 = { image_data_twr_font_ubuntu_13_0x37,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x37 = { image_data_twr_font_ubuntu_13_0x37, 7, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x38[13] = {
-    0xfe,
-    0xfe,
-    0xc6,
-    0xba,
-    0xba,
-    0xc6,
-    0xba,
-    0xba,
-    0xba,
-    0xc6,
-    0xfe,
-    0xfe,
+    0xfe, 0xfe, 0xc6, 0xba, 0xba, 0xc6, 0xba, 0xba, 0xba, 0xc6, 0xfe, 0xfe,
     0xfe
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x38 = { image_data_twr_font_ubuntu_13_0x38,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x38 = { image_data_twr_font_ubuntu_13_0x38, 7, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x39[13] = {
-    0xfe,
-    0xfe,
-    0xc6,
-    0xba,
-    0xba,
-    0xba,
-    0xc2,
-    0xfa,
-    0xf6,
-    0xce,
-    0xfe,
-    0xfe,
+    0xfe, 0xfe, 0xc6, 0xba, 0xba, 0xba, 0xc2, 0xfa, 0xf6, 0xce, 0xfe, 0xfe,
     0xfe
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x39 = { image_data_twr_font_ubuntu_13_0x39,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x3a[13] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x3a = { image_data_twr_font_ubuntu_13_0x3a,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x3b[13] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0x60,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x3b = { image_data_twr_font_ubuntu_13_0x3b,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x3c[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfa,
-    0xc6,
-    0xbe,
-    0xc6,
-    0xfa,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
+static const twr_font_image_t twr_font_ubuntu_13_0x39 = { image_data_twr_font_ubuntu_13_0x39, 7, 13, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x3a[5] = {
+    0xa1, 0x21, 0xb1, 0x21, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x3c = { image_data_twr_font_ubuntu_13_0x3c,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x3a = { image_data_twr_font_ubuntu_13_0x3a, 3, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x3d[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0x82,
-    0xfe,
-    0x82,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
+static const uint8_t image_data_twr_font_ubuntu_13_0x3b[7] = {
+    0xa1, 0x21, 0xb1, 0x21, 0x21, 0x11, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x3d = { image_data_twr_font_ubuntu_13_0x3d,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x3b = { image_data_twr_font_ubuntu_13_0x3b, 3, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x3e[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xbe,
-    0xc6,
-    0xfa,
-    0xc6,
-    0xbe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
+static const uint8_t image_data_twr_font_ubuntu_13_0x3c[8] = {
+    0xf0, 0xf0, 0x31, 0x33, 0x31, 0x73, 0x71, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x3e = { image_data_twr_font_ubuntu_13_0x3e,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x3c = { image_data_twr_font_ubuntu_13_0x3c, 7, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x3f[13] = {
-    0xf8,
-    0xf8,
-    0x88,
-    0xf0,
-    0xf0,
-    0xe8,
-    0xd8,
-    0xf8,
-    0xd8,
-    0xd8,
-    0xf8,
-    0xf8,
-    0xf8
+static const uint8_t image_data_twr_font_ubuntu_13_0x3d[5] = {
+    0xf0, 0xf0, 0xd5, 0x95, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x3f = { image_data_twr_font_ubuntu_13_0x3f,
-    5, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x3d = { image_data_twr_font_ubuntu_13_0x3d, 7, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x40[26] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xe0, 0xe0,
-    0xdf, 0x60,
-    0xb1, 0xa0,
-    0xad, 0xa0,
-    0xad, 0xa0,
-    0xad, 0xa0,
-    0xb2, 0x60,
-    0xdf, 0xe0,
-    0xe1, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
+static const uint8_t image_data_twr_font_ubuntu_13_0x3e[7] = {
+    0xf0, 0xe1, 0x73, 0x71, 0x33, 0x31, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_13_0x3e = { image_data_twr_font_ubuntu_13_0x3e, 7, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x3f[8] = {
+    0xb3, 0x51, 0x41, 0x31, 0x31, 0x91, 0x41, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x40 = { image_data_twr_font_ubuntu_13_0x40,
-    11, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x3f = { image_data_twr_font_ubuntu_13_0x3f, 5, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x40[25] = {
+    0xf0, 0xa5, 0x51, 0x51, 0x31, 0x23, 0x21, 0x21, 0x11, 0x21, 0x21, 0x21,
+    0x11, 0x21, 0x21, 0x21, 0x11, 0x21, 0x21, 0x21, 0x22, 0x12, 0x41, 0xb4,
+    0x00
+};
+static const twr_font_image_t twr_font_ubuntu_13_0x40 = { image_data_twr_font_ubuntu_13_0x40, 11, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x41[13] = {
-    0xfe,
-    0xfe,
-    0xee,
-    0xd6,
-    0xd6,
-    0xd6,
-    0xba,
-    0x82,
-    0xba,
-    0x7c,
-    0xfe,
-    0xfe,
+    0xfe, 0xfe, 0xee, 0xd6, 0xd6, 0xd6, 0xba, 0x82, 0xba, 0x7c, 0xfe, 0xfe,
     0xfe
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x41 = { image_data_twr_font_ubuntu_13_0x41,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x41 = { image_data_twr_font_ubuntu_13_0x41, 7, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x42[13] = {
-    0xff,
-    0xff,
-    0x83,
-    0xbd,
-    0xbd,
-    0x83,
-    0xbd,
-    0xbd,
-    0xbd,
-    0x83,
-    0xff,
-    0xff,
+    0xff, 0xff, 0x83, 0xbd, 0xbd, 0x83, 0xbd, 0xbd, 0xbd, 0x83, 0xff, 0xff,
     0xff
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x42 = { image_data_twr_font_ubuntu_13_0x42,
-    8, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x42 = { image_data_twr_font_ubuntu_13_0x42, 8, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x43[13] = {
-    0xff,
-    0xff,
-    0xe1,
-    0xdf,
-    0xbf,
-    0xbf,
-    0xbf,
-    0xbf,
-    0xdf,
-    0xe1,
-    0xff,
-    0xff,
-    0xff
+static const uint8_t image_data_twr_font_ubuntu_13_0x43[10] = {
+    0xf0, 0x44, 0x31, 0x61, 0x71, 0x71, 0x71, 0x81, 0x84, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x43 = { image_data_twr_font_ubuntu_13_0x43,
-    8, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x44[26] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0x83, 0x80,
-    0xbd, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xbd, 0x80,
-    0x83, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x44 = { image_data_twr_font_ubuntu_13_0x44,
-    9, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x45[13] = {
-    0xfe,
-    0xfe,
-    0x82,
-    0xbe,
-    0xbe,
-    0x86,
-    0xbe,
-    0xbe,
-    0xbe,
-    0x82,
-    0xfe,
-    0xfe,
-    0xfe
+static const twr_font_image_t twr_font_ubuntu_13_0x43 = { image_data_twr_font_ubuntu_13_0x43, 8, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x44[16] = {
+    0xf0, 0x45, 0x41, 0x41, 0x31, 0x51, 0x21, 0x51, 0x21, 0x51, 0x21, 0x51,
+    0x21, 0x41, 0x35, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x45 = { image_data_twr_font_ubuntu_13_0x45,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x44 = { image_data_twr_font_ubuntu_13_0x44, 9, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x46[13] = {
-    0xfc,
-    0xfc,
-    0x80,
-    0xbc,
-    0xbc,
-    0x84,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xfc,
-    0xfc,
-    0xfc
+static const uint8_t image_data_twr_font_ubuntu_13_0x45[9] = {
+    0xf5, 0x21, 0x61, 0x64, 0x31, 0x61, 0x61, 0x65, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x46 = { image_data_twr_font_ubuntu_13_0x46,
-    6, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x45 = { image_data_twr_font_ubuntu_13_0x45, 7, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x46[9] = {
+    0xd5, 0x11, 0x51, 0x54, 0x21, 0x51, 0x51, 0x51, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_13_0x46 = { image_data_twr_font_ubuntu_13_0x46, 6, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x47[13] = {
-    0xff,
-    0xff,
-    0xe1,
-    0xdf,
-    0xbf,
-    0xbf,
-    0xbd,
-    0xbd,
-    0xdd,
-    0xe1,
-    0xff,
-    0xff,
+    0xff, 0xff, 0xe1, 0xdf, 0xbf, 0xbf, 0xbd, 0xbd, 0xdd, 0xe1, 0xff, 0xff,
     0xff
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x47 = { image_data_twr_font_ubuntu_13_0x47,
-    8, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x47 = { image_data_twr_font_ubuntu_13_0x47, 8, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x48[13] = {
-    0xff,
-    0xff,
-    0xbd,
-    0xbd,
-    0xbd,
-    0x81,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xff,
-    0xff,
+    0xff, 0xff, 0xbd, 0xbd, 0xbd, 0x81, 0xbd, 0xbd, 0xbd, 0xbd, 0xff, 0xff,
     0xff
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x48 = { image_data_twr_font_ubuntu_13_0x48,
-    8, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x49[13] = {
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x49 = { image_data_twr_font_ubuntu_13_0x49,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x4a[13] = {
-    0xfc,
-    0xfc,
-    0xf4,
-    0xf4,
-    0xf4,
-    0xf4,
-    0xf4,
-    0xf4,
-    0x74,
-    0x8c,
-    0xfc,
-    0xfc,
-    0xfc
+static const twr_font_image_t twr_font_ubuntu_13_0x48 = { image_data_twr_font_ubuntu_13_0x48, 8, 13, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x49[9] = {
+    0x71, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_13_0x49 = { image_data_twr_font_ubuntu_13_0x49, 3, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x4a[11] = {
+    0xf0, 0x11, 0x51, 0x51, 0x51, 0x51, 0x51, 0x11, 0x31, 0x23, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x4a = { image_data_twr_font_ubuntu_13_0x4a,
-    6, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x4a = { image_data_twr_font_ubuntu_13_0x4a, 6, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x4b[13] = {
-    0xff,
-    0xff,
-    0xbd,
-    0xbb,
-    0xb7,
-    0xaf,
-    0x9f,
-    0xa7,
-    0xbb,
-    0xbd,
-    0xff,
-    0xff,
+    0xff, 0xff, 0xbd, 0xbb, 0xb7, 0xaf, 0x9f, 0xa7, 0xbb, 0xbd, 0xff, 0xff,
     0xff
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x4b = { image_data_twr_font_ubuntu_13_0x4b,
-    8, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x4b = { image_data_twr_font_ubuntu_13_0x4b, 8, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x4c[13] = {
-    0xfc,
-    0xfc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0x80,
-    0xfc,
-    0xfc,
-    0xfc
+static const uint8_t image_data_twr_font_ubuntu_13_0x4c[9] = {
+    0xd1, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x55, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x4c = { image_data_twr_font_ubuntu_13_0x4c,
-    6, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x4c = { image_data_twr_font_ubuntu_13_0x4c, 6, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x4d[26] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xbf, 0xa0,
-    0x9f, 0x20,
-    0xae, 0xa0,
-    0xae, 0xa0,
-    0xb5, 0xa0,
-    0xb5, 0xa0,
-    0xbb, 0xa0,
-    0xbf, 0xa0,
-    0xff, 0xe0,
-    0xff, 0xe0,
+    0xff, 0xe0, 0xff, 0xe0, 0xbf, 0xa0, 0x9f, 0x20, 0xae, 0xa0, 0xae, 0xa0,
+    0xb5, 0xa0, 0xb5, 0xa0, 0xbb, 0xa0, 0xbf, 0xa0, 0xff, 0xe0, 0xff, 0xe0,
     0xff, 0xe0
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x4d = { image_data_twr_font_ubuntu_13_0x4d,
-    11, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x4e[26] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xbe, 0x80,
-    0x9e, 0x80,
-    0xae, 0x80,
-    0xb6, 0x80,
-    0xba, 0x80,
-    0xba, 0x80,
-    0xbc, 0x80,
-    0xbe, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x4e = { image_data_twr_font_ubuntu_13_0x4e,
-    9, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x4f[26] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xdd, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xdd, 0x80,
-    0xe3, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x4f = { image_data_twr_font_ubuntu_13_0x4f,
-    9, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x50[13] = {
-    0xfe,
-    0xfe,
-    0x82,
-    0xbc,
-    0xbc,
-    0xbc,
-    0x82,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xfe,
-    0xfe,
-    0xfe
+static const twr_font_image_t twr_font_ubuntu_13_0x4d = { image_data_twr_font_ubuntu_13_0x4d, 11, 13, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x4e[22] = {
+    0xf0, 0x41, 0x51, 0x22, 0x41, 0x21, 0x11, 0x31, 0x21, 0x21, 0x21, 0x21,
+    0x31, 0x11, 0x21, 0x31, 0x11, 0x21, 0x42, 0x21, 0x51, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x50 = { image_data_twr_font_ubuntu_13_0x50,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x4e = { image_data_twr_font_ubuntu_13_0x4e, 9, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x51[26] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xdd, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xdd, 0x80,
-    0xe3, 0x80,
-    0xf7, 0x80,
-    0xf9, 0x80,
-    0xff, 0x80
+static const uint8_t image_data_twr_font_ubuntu_13_0x4f[16] = {
+    0xf0, 0x63, 0x51, 0x31, 0x31, 0x51, 0x21, 0x51, 0x21, 0x51, 0x21, 0x51,
+    0x31, 0x31, 0x53, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x51 = { image_data_twr_font_ubuntu_13_0x51,
-    9, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x4f = { image_data_twr_font_ubuntu_13_0x4f, 9, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x50[12] = {
+    0xf5, 0x21, 0x41, 0x11, 0x41, 0x11, 0x41, 0x15, 0x21, 0x61, 0x61, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_13_0x50 = { image_data_twr_font_ubuntu_13_0x50, 7, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x51[18] = {
+    0xf0, 0x63, 0x51, 0x31, 0x31, 0x51, 0x21, 0x51, 0x21, 0x51, 0x21, 0x51,
+    0x31, 0x31, 0x53, 0x71, 0x92, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_13_0x51 = { image_data_twr_font_ubuntu_13_0x51, 9, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x52[13] = {
-    0xff,
-    0xff,
-    0x83,
-    0xbd,
-    0xbd,
-    0xbd,
-    0x83,
-    0xbb,
-    0xbd,
-    0xbe,
-    0xff,
-    0xff,
+    0xff, 0xff, 0x83, 0xbd, 0xbd, 0xbd, 0x83, 0xbb, 0xbd, 0xbe, 0xff, 0xff,
     0xff
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x52 = { image_data_twr_font_ubuntu_13_0x52,
-    8, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x52 = { image_data_twr_font_ubuntu_13_0x52, 8, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x53[13] = {
-    0xfc,
-    0xfc,
-    0xc4,
-    0xbc,
-    0xbc,
-    0xcc,
-    0xf4,
-    0xf4,
-    0xf4,
-    0x8c,
-    0xfc,
-    0xfc,
-    0xfc
+static const uint8_t image_data_twr_font_ubuntu_13_0x53[9] = {
+    0xe3, 0x21, 0x51, 0x62, 0x61, 0x51, 0x51, 0x23, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x53 = { image_data_twr_font_ubuntu_13_0x53,
-    6, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x53 = { image_data_twr_font_ubuntu_13_0x53, 6, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x54[13] = {
-    0xfe,
-    0xfe,
-    0x00,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xfe,
-    0xfe,
-    0xfe
+static const uint8_t image_data_twr_font_ubuntu_13_0x54[9] = {
+    0xe7, 0x31, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x54 = { image_data_twr_font_ubuntu_13_0x54,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x54 = { image_data_twr_font_ubuntu_13_0x54, 7, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x55[13] = {
-    0xff,
-    0xff,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc3,
-    0xff,
-    0xff,
+    0xff, 0xff, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xc3, 0xff, 0xff,
     0xff
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x55 = { image_data_twr_font_ubuntu_13_0x55,
-    8, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x55 = { image_data_twr_font_ubuntu_13_0x55, 8, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x56[13] = {
-    0xfe,
-    0xfe,
-    0x7c,
-    0x7c,
-    0xba,
-    0xba,
-    0xd6,
-    0xd6,
-    0xd6,
-    0xee,
-    0xfe,
-    0xfe,
+    0xfe, 0xfe, 0x7c, 0x7c, 0xba, 0xba, 0xd6, 0xd6, 0xd6, 0xee, 0xfe, 0xfe,
     0xfe
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x56 = { image_data_twr_font_ubuntu_13_0x56,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x56 = { image_data_twr_font_ubuntu_13_0x56, 7, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x57[26] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0x7f, 0xc0,
-    0x7b, 0xc0,
-    0x7b, 0xc0,
-    0xb5, 0xa0,
-    0xb5, 0xa0,
-    0xae, 0xa0,
-    0xae, 0xa0,
-    0xdf, 0x60,
-    0xff, 0xe0,
-    0xff, 0xe0,
+    0xff, 0xe0, 0xff, 0xe0, 0x7f, 0xc0, 0x7b, 0xc0, 0x7b, 0xc0, 0xb5, 0xa0,
+    0xb5, 0xa0, 0xae, 0xa0, 0xae, 0xa0, 0xdf, 0x60, 0xff, 0xe0, 0xff, 0xe0,
     0xff, 0xe0
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x57 = { image_data_twr_font_ubuntu_13_0x57,
-    11, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x57 = { image_data_twr_font_ubuntu_13_0x57, 11, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x58[13] = {
-    0xfe,
-    0xfe,
-    0x7c,
-    0xba,
-    0xd6,
-    0xee,
-    0xee,
-    0xd6,
-    0xba,
-    0x7c,
-    0xfe,
-    0xfe,
+    0xfe, 0xfe, 0x7c, 0xba, 0xd6, 0xee, 0xee, 0xd6, 0xba, 0x7c, 0xfe, 0xfe,
     0xfe
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x58 = { image_data_twr_font_ubuntu_13_0x58,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x58 = { image_data_twr_font_ubuntu_13_0x58, 7, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x59[13] = {
-    0xfe,
-    0xfe,
-    0x7c,
-    0xba,
-    0xba,
-    0xd6,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xfe,
-    0xfe,
+    0xfe, 0xfe, 0x7c, 0xba, 0xba, 0xd6, 0xee, 0xee, 0xee, 0xee, 0xfe, 0xfe,
     0xfe
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x59 = { image_data_twr_font_ubuntu_13_0x59,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x59 = { image_data_twr_font_ubuntu_13_0x59, 7, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x5a[13] = {
-    0xfe,
-    0xfe,
-    0x82,
-    0xfa,
-    0xf6,
-    0xee,
-    0xde,
-    0xde,
-    0xbe,
-    0x82,
-    0xfe,
-    0xfe,
-    0xfe
+static const uint8_t image_data_twr_font_ubuntu_13_0x5a[9] = {
+    0xf5, 0x61, 0x51, 0x51, 0x51, 0x61, 0x51, 0x65, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x5a = { image_data_twr_font_ubuntu_13_0x5a,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x5b[13] = {
-    0xf0,
-    0x80,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0x80,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x5b = { image_data_twr_font_ubuntu_13_0x5b,
-    4, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x5c[13] = {
-    0xf8,
-    0x78,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xf0,
-    0xf8
+static const twr_font_image_t twr_font_ubuntu_13_0x5a = { image_data_twr_font_ubuntu_13_0x5a, 7, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x5b[12] = {
+    0x53, 0x11, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x5c = { image_data_twr_font_ubuntu_13_0x5c,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x5d[13] = {
-    0xf0,
-    0x10,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0x10,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x5d = { image_data_twr_font_ubuntu_13_0x5d,
-    4, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x5e[13] = {
-    0xfe,
-    0xfe,
-    0xee,
-    0xd6,
-    0xd6,
-    0xd6,
-    0xba,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
+static const twr_font_image_t twr_font_ubuntu_13_0x5b = { image_data_twr_font_ubuntu_13_0x5b, 4, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x5c[12] = {
+    0x51, 0x51, 0x41, 0x41, 0x51, 0x41, 0x41, 0x51, 0x41, 0x41, 0x51, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x5e = { image_data_twr_font_ubuntu_13_0x5e,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x5c = { image_data_twr_font_ubuntu_13_0x5c, 5, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x5f[13] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0x00,
-    0xfc
+static const uint8_t image_data_twr_font_ubuntu_13_0x5d[12] = {
+    0x43, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x13, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x5f = { image_data_twr_font_ubuntu_13_0x5f,
-    6, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x5d = { image_data_twr_font_ubuntu_13_0x5d, 4, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x60[13] = {
-    0xf8,
-    0xb8,
-    0xd8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8
+static const uint8_t image_data_twr_font_ubuntu_13_0x5e[11] = {
+    0xf0, 0x21, 0x51, 0x11, 0x41, 0x11, 0x41, 0x11, 0x31, 0x31, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x60 = { image_data_twr_font_ubuntu_13_0x60,
-    5, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x5e = { image_data_twr_font_ubuntu_13_0x5e, 7, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x61[13] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0x8c,
-    0xf4,
-    0xc4,
-    0xb4,
-    0xb4,
-    0xc4,
-    0xfc,
-    0xfc,
-    0xfc
+static const uint8_t image_data_twr_font_ubuntu_13_0x5f[6] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0x66, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x61 = { image_data_twr_font_ubuntu_13_0x61,
-    6, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x5f = { image_data_twr_font_ubuntu_13_0x5f, 6, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x60[3] = {
+    0x61, 0x51, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_13_0x60 = { image_data_twr_font_ubuntu_13_0x60, 5, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x61[10] = {
+    0xf0, 0xa3, 0x61, 0x33, 0x21, 0x21, 0x21, 0x21, 0x33, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_13_0x61 = { image_data_twr_font_ubuntu_13_0x61, 6, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x62[13] = {
-    0xfe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0x86,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0x86,
-    0xfe,
-    0xfe,
+    0xfe, 0xbe, 0xbe, 0xbe, 0x86, 0xba, 0xba, 0xba, 0xba, 0x86, 0xfe, 0xfe,
     0xfe
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x62 = { image_data_twr_font_ubuntu_13_0x62,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x62 = { image_data_twr_font_ubuntu_13_0x62, 7, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x63[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc2,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xc2,
-    0xfe,
-    0xfe,
-    0xfe
+static const uint8_t image_data_twr_font_ubuntu_13_0x63[8] = {
+    0xf0, 0xf4, 0x21, 0x61, 0x61, 0x61, 0x74, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x63 = { image_data_twr_font_ubuntu_13_0x63,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x63 = { image_data_twr_font_ubuntu_13_0x63, 7, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x64[13] = {
-    0xfe,
-    0xfa,
-    0xfa,
-    0xfa,
-    0xc2,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xc2,
-    0xfe,
-    0xfe,
+    0xfe, 0xfa, 0xfa, 0xfa, 0xc2, 0xba, 0xba, 0xba, 0xba, 0xc2, 0xfe, 0xfe,
     0xfe
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x64 = { image_data_twr_font_ubuntu_13_0x64,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x64 = { image_data_twr_font_ubuntu_13_0x64, 7, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x65[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc6,
-    0xba,
-    0x82,
-    0xbe,
-    0xbe,
-    0xc2,
-    0xfe,
-    0xfe,
-    0xfe
+static const uint8_t image_data_twr_font_ubuntu_13_0x65[9] = {
+    0xf0, 0xf3, 0x31, 0x31, 0x25, 0x21, 0x61, 0x74, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x65 = { image_data_twr_font_ubuntu_13_0x65,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x65 = { image_data_twr_font_ubuntu_13_0x65, 7, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x66[13] = {
-    0xf8,
-    0xc0,
-    0xb8,
-    0xb8,
-    0x80,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xf8,
-    0xf8,
-    0xf8
+static const uint8_t image_data_twr_font_ubuntu_13_0x66[10] = {
+    0x73, 0x11, 0x41, 0x44, 0x11, 0x41, 0x41, 0x41, 0x41, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x66 = { image_data_twr_font_ubuntu_13_0x66,
-    5, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x66 = { image_data_twr_font_ubuntu_13_0x66, 5, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x67[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc2,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xc2,
-    0xfa,
-    0x86,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xc2, 0xba, 0xba, 0xba, 0xba, 0xc2, 0xfa, 0x86,
     0xfe
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x67 = { image_data_twr_font_ubuntu_13_0x67,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x67 = { image_data_twr_font_ubuntu_13_0x67, 7, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x68[13] = {
-    0xfe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0x86,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xfe,
-    0xfe,
+    0xfe, 0xbe, 0xbe, 0xbe, 0x86, 0xba, 0xba, 0xba, 0xba, 0xba, 0xfe, 0xfe,
     0xfe
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x68 = { image_data_twr_font_ubuntu_13_0x68,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x68 = { image_data_twr_font_ubuntu_13_0x68, 7, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x69[13] = {
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
+static const uint8_t image_data_twr_font_ubuntu_13_0x69[9] = {
+    0x41, 0x21, 0x51, 0x21, 0x21, 0x21, 0x21, 0x21, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x69 = { image_data_twr_font_ubuntu_13_0x69,
-    3, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x69 = { image_data_twr_font_ubuntu_13_0x69, 3, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x6a[13] = {
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0x60,
-    0xe0
+static const uint8_t image_data_twr_font_ubuntu_13_0x6a[11] = {
+    0x41, 0x21, 0x51, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x11, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x6a = { image_data_twr_font_ubuntu_13_0x6a,
-    3, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x6a = { image_data_twr_font_ubuntu_13_0x6a, 3, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x6b[13] = {
-    0xfc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xb4,
-    0xac,
-    0x9c,
-    0xac,
-    0xb4,
-    0xb8,
-    0xfc,
-    0xfc,
+    0xfc, 0xbc, 0xbc, 0xbc, 0xb4, 0xac, 0x9c, 0xac, 0xb4, 0xb8, 0xfc, 0xfc,
     0xfc
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x6b = { image_data_twr_font_ubuntu_13_0x6b,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x6c[13] = {
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xc0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x6c = { image_data_twr_font_ubuntu_13_0x6c,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x6d[26] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0x84, 0x60,
-    0xbb, 0xa0,
-    0xbb, 0xa0,
-    0xbb, 0xa0,
-    0xbb, 0xa0,
-    0xbb, 0xa0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_13_0x6b = { image_data_twr_font_ubuntu_13_0x6b, 6, 13, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x6c[10] = {
+    0x41, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x31, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_13_0x6c = { image_data_twr_font_ubuntu_13_0x6c, 3, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x6d[20] = {
+    0xf0, 0xf0, 0xf4, 0x13, 0x31, 0x31, 0x31, 0x21, 0x31, 0x31, 0x21, 0x31,
+    0x31, 0x21, 0x31, 0x31, 0x21, 0x31, 0x31, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x6d = { image_data_twr_font_ubuntu_13_0x6d,
-    11, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x6d = { image_data_twr_font_ubuntu_13_0x6d, 11, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x6e[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0x86,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xfe,
-    0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0x86, 0xba, 0xba, 0xba, 0xba, 0xba, 0xfe, 0xfe,
     0xfe
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x6e = { image_data_twr_font_ubuntu_13_0x6e,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x6e = { image_data_twr_font_ubuntu_13_0x6e, 7, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x6f[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc6,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xc6,
-    0xfe,
-    0xfe,
-    0xfe
+static const uint8_t image_data_twr_font_ubuntu_13_0x6f[12] = {
+    0xf0, 0xf3, 0x31, 0x31, 0x21, 0x31, 0x21, 0x31, 0x21, 0x31, 0x33, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x6f = { image_data_twr_font_ubuntu_13_0x6f,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x6f = { image_data_twr_font_ubuntu_13_0x6f, 7, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x70[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0x86,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0x86,
-    0xbe,
-    0xbe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0x86, 0xba, 0xba, 0xba, 0xba, 0x86, 0xbe, 0xbe,
     0xfe
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x70 = { image_data_twr_font_ubuntu_13_0x70,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x70 = { image_data_twr_font_ubuntu_13_0x70, 7, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x71[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc2,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xc2,
-    0xfa,
-    0xfa,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xc2, 0xba, 0xba, 0xba, 0xba, 0xc2, 0xfa, 0xfa,
     0xfe
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x71 = { image_data_twr_font_ubuntu_13_0x71,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x71 = { image_data_twr_font_ubuntu_13_0x71, 7, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x72[13] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0x80,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xf8,
-    0xf8,
-    0xf8
+static const uint8_t image_data_twr_font_ubuntu_13_0x72[8] = {
+    0xf0, 0x64, 0x11, 0x41, 0x41, 0x41, 0x41, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x72 = { image_data_twr_font_ubuntu_13_0x72,
-    5, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x72 = { image_data_twr_font_ubuntu_13_0x72, 5, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x73[13] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xc4,
-    0xbc,
-    0x9c,
-    0xe4,
-    0xf4,
-    0x8c,
-    0xfc,
-    0xfc,
-    0xfc
+static const uint8_t image_data_twr_font_ubuntu_13_0x73[8] = {
+    0xf0, 0xb3, 0x21, 0x52, 0x62, 0x51, 0x23, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x73 = { image_data_twr_font_ubuntu_13_0x73,
-    6, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x73 = { image_data_twr_font_ubuntu_13_0x73, 6, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x74[13] = {
-    0xfc,
-    0xfc,
-    0xbc,
-    0xbc,
-    0x84,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xc4,
-    0xfc,
-    0xfc,
-    0xfc
+static const uint8_t image_data_twr_font_ubuntu_13_0x74[9] = {
+    0xd1, 0x51, 0x54, 0x21, 0x51, 0x51, 0x51, 0x63, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x74 = { image_data_twr_font_ubuntu_13_0x74,
-    6, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x74 = { image_data_twr_font_ubuntu_13_0x74, 6, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x75[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xc2,
-    0xfe,
-    0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xba, 0xba, 0xba, 0xba, 0xba, 0xc2, 0xfe, 0xfe,
     0xfe
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x75 = { image_data_twr_font_ubuntu_13_0x75,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x75 = { image_data_twr_font_ubuntu_13_0x75, 7, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x76[13] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0x70,
-    0x70,
-    0xa8,
-    0xa8,
-    0xa8,
-    0xd8,
-    0xf8,
-    0xf8,
-    0xf8
+static const uint8_t image_data_twr_font_ubuntu_13_0x76[12] = {
+    0xf0, 0x51, 0x32, 0x31, 0x11, 0x11, 0x21, 0x11, 0x21, 0x11, 0x31, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x76 = { image_data_twr_font_ubuntu_13_0x76,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x77[26] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0x77, 0x00,
-    0x77, 0x00,
-    0xaa, 0x80,
-    0xaa, 0x80,
-    0xaa, 0x80,
-    0xdd, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x77 = { image_data_twr_font_ubuntu_13_0x77,
-    9, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x78[13] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0x78,
-    0xb4,
-    0xcc,
-    0xcc,
-    0xb4,
-    0x78,
-    0xfc,
-    0xfc,
-    0xfc
+static const twr_font_image_t twr_font_ubuntu_13_0x76 = { image_data_twr_font_ubuntu_13_0x76, 5, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x77[22] = {
+    0xf0, 0xf0, 0x61, 0x31, 0x32, 0x31, 0x31, 0x11, 0x11, 0x11, 0x11, 0x21,
+    0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x11, 0x31, 0x31, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_13_0x77 = { image_data_twr_font_ubuntu_13_0x77, 9, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x78[12] = {
+    0xf0, 0x91, 0x41, 0x11, 0x21, 0x32, 0x42, 0x31, 0x21, 0x11, 0x41, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x78 = { image_data_twr_font_ubuntu_13_0x78,
-    6, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x78 = { image_data_twr_font_ubuntu_13_0x78, 6, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0x79[13] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0x70,
-    0x70,
-    0xa8,
-    0xa8,
-    0xa8,
-    0xd8,
-    0xd8,
-    0x38,
+    0xf8, 0xf8, 0xf8, 0xf8, 0x70, 0x70, 0xa8, 0xa8, 0xa8, 0xd8, 0xd8, 0x38,
     0xf8
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x79 = { image_data_twr_font_ubuntu_13_0x79,
-    5, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x79 = { image_data_twr_font_ubuntu_13_0x79, 5, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x7a[13] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0x84,
-    0xf4,
-    0xec,
-    0xdc,
-    0xbc,
-    0x84,
-    0xfc,
-    0xfc,
-    0xfc
+static const uint8_t image_data_twr_font_ubuntu_13_0x7a[8] = {
+    0xf0, 0xa4, 0x51, 0x41, 0x41, 0x41, 0x54, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x7a = { image_data_twr_font_ubuntu_13_0x7a,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x7b[13] = {
-    0xf0,
-    0xe0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xb0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xe0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x7b = { image_data_twr_font_ubuntu_13_0x7b,
-    4, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x7c[13] = {
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x7c = { image_data_twr_font_ubuntu_13_0x7c,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x7d[13] = {
-    0xf0,
-    0x70,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xd0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0x70,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x7d = { image_data_twr_font_ubuntu_13_0x7d,
-    4, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x7e[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xcc,
-    0xb2,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
+static const twr_font_image_t twr_font_ubuntu_13_0x7a = { image_data_twr_font_ubuntu_13_0x7a, 6, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x7b[12] = {
+    0x71, 0x21, 0x31, 0x31, 0x31, 0x21, 0x41, 0x31, 0x31, 0x31, 0x41, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0x7e = { image_data_twr_font_ubuntu_13_0x7e,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xb0[13] = {
-    0xd0,
-    0xa0,
-    0xa0,
-    0xd0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0xb0 = { image_data_twr_font_ubuntu_13_0xb0,
-    4, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xb9[13] = {
-    0xfc,
-    0xd4,
-    0xec,
-    0xfc,
-    0xc4,
-    0xbc,
-    0x9c,
-    0xe4,
-    0xf4,
-    0x8c,
-    0xfc,
-    0xfc,
-    0xfc
+static const twr_font_image_t twr_font_ubuntu_13_0x7b = { image_data_twr_font_ubuntu_13_0x7b, 4, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0x7c[12] = {
+    0x41, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0xb9 = { image_data_twr_font_ubuntu_13_0xb9,
-    6, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x7c = { image_data_twr_font_ubuntu_13_0x7c, 3, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xbb[13] = {
-    0xfc,
-    0xec,
-    0xac,
-    0xbc,
-    0x84,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xc4,
-    0xfc,
-    0xfc,
-    0xfc
+static const uint8_t image_data_twr_font_ubuntu_13_0x7d[12] = {
+    0x41, 0x41, 0x31, 0x31, 0x31, 0x41, 0x21, 0x31, 0x31, 0x31, 0x21, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0xbb = { image_data_twr_font_ubuntu_13_0xbb,
-    6, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x7d = { image_data_twr_font_ubuntu_13_0x7d, 4, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xbe[13] = {
-    0xfc,
-    0xac,
-    0xdc,
-    0xfc,
-    0x84,
-    0xf4,
-    0xec,
-    0xdc,
-    0xbc,
-    0x84,
-    0xfc,
-    0xfc,
-    0xfc
+static const uint8_t image_data_twr_font_ubuntu_13_0x7e[7] = {
+    0xf0, 0xf0, 0x72, 0x21, 0x11, 0x22, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0xbe = { image_data_twr_font_ubuntu_13_0xbe,
-    6, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0x7e = { image_data_twr_font_ubuntu_13_0x7e, 7, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xe1[13] = {
-    0xfc,
-    0xf4,
-    0xec,
-    0xfc,
-    0x8c,
-    0xf4,
-    0xc4,
-    0xb4,
-    0xb4,
-    0xc4,
-    0xfc,
-    0xfc,
-    0xfc
+static const uint8_t image_data_twr_font_ubuntu_13_0xb0[7] = {
+    0x21, 0x21, 0x11, 0x11, 0x11, 0x21, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0xe1 = { image_data_twr_font_ubuntu_13_0xe1,
-    6, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0xb0 = { image_data_twr_font_ubuntu_13_0xb0, 4, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xe8[13] = {
-    0xfe,
-    0xd6,
-    0xee,
-    0xfe,
-    0xc2,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xc2,
-    0xfe,
-    0xfe,
-    0xfe
+static const uint8_t image_data_twr_font_ubuntu_13_0xb9[10] = {
+    0x81, 0x11, 0x41, 0xa3, 0x21, 0x52, 0x62, 0x51, 0x23, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0xe8 = { image_data_twr_font_ubuntu_13_0xe8,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0xb9 = { image_data_twr_font_ubuntu_13_0xb9, 6, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xe9[13] = {
-    0xfe,
-    0xf6,
-    0xee,
-    0xfe,
-    0xc6,
-    0xba,
-    0x82,
-    0xbe,
-    0xbe,
-    0xc2,
-    0xfe,
-    0xfe,
-    0xfe
+static const uint8_t image_data_twr_font_ubuntu_13_0xbb[11] = {
+    0x91, 0x31, 0x11, 0x31, 0x54, 0x21, 0x51, 0x51, 0x51, 0x63, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0xe9 = { image_data_twr_font_ubuntu_13_0xe9,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0xbb = { image_data_twr_font_ubuntu_13_0xbb, 6, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xec[13] = {
-    0xd6,
-    0xee,
-    0xfe,
-    0xfe,
-    0xc6,
-    0xba,
-    0x82,
-    0xbe,
-    0xbe,
-    0xc2,
-    0xfe,
-    0xfe,
-    0xfe
+static const uint8_t image_data_twr_font_ubuntu_13_0xbe[10] = {
+    0x71, 0x11, 0x41, 0xa4, 0x51, 0x41, 0x41, 0x41, 0x54, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0xec = { image_data_twr_font_ubuntu_13_0xec,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0xbe = { image_data_twr_font_ubuntu_13_0xbe, 6, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xed[13] = {
-    0xe0,
-    0xc0,
-    0xa0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
+static const uint8_t image_data_twr_font_ubuntu_13_0xe1[11] = {
+    0xa1, 0x41, 0x93, 0x61, 0x33, 0x21, 0x21, 0x21, 0x21, 0x33, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0xed = { image_data_twr_font_ubuntu_13_0xed,
-    3, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0xe1 = { image_data_twr_font_ubuntu_13_0xe1, 6, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0xe8[10] = {
+    0x91, 0x11, 0x51, 0xc4, 0x21, 0x61, 0x61, 0x61, 0x74, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_13_0xe8 = { image_data_twr_font_ubuntu_13_0xe8, 7, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0xe9[10] = {
+    0xb1, 0x51, 0xc3, 0x31, 0x31, 0x25, 0x21, 0x61, 0x74, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_13_0xe9 = { image_data_twr_font_ubuntu_13_0xe9, 7, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0xec[12] = {
+    0x21, 0x11, 0x51, 0xf0, 0x43, 0x31, 0x31, 0x25, 0x21, 0x61, 0x74, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_13_0xec = { image_data_twr_font_ubuntu_13_0xec, 7, 13, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_13_0xed[9] = {
+    0x51, 0x11, 0x51, 0x21, 0x21, 0x21, 0x21, 0x21, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_13_0xed = { image_data_twr_font_ubuntu_13_0xed, 3, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0xef[13] = {
-    0xff,
-    0xfa,
-    0xfa,
-    0xfa,
-    0xc3,
-    0xbb,
-    0xbb,
-    0xbb,
-    0xbb,
-    0xc3,
-    0xff,
-    0xff,
+    0xff, 0xfa, 0xfa, 0xfa, 0xc3, 0xbb, 0xbb, 0xbb, 0xbb, 0xc3, 0xff, 0xff,
     0xff
 };
-static const twr_font_image_t twr_font_ubuntu_13_0xef = { image_data_twr_font_ubuntu_13_0xef,
-    8, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0xef = { image_data_twr_font_ubuntu_13_0xef, 8, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0xf2[13] = {
-    0xfe,
-    0xd6,
-    0xee,
-    0xfe,
-    0x86,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xfe,
-    0xfe,
+    0xfe, 0xd6, 0xee, 0xfe, 0x86, 0xba, 0xba, 0xba, 0xba, 0xba, 0xfe, 0xfe,
     0xfe
 };
-static const twr_font_image_t twr_font_ubuntu_13_0xf2 = { image_data_twr_font_ubuntu_13_0xf2,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0xf2 = { image_data_twr_font_ubuntu_13_0xf2, 7, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xf8[13] = {
-    0xf8,
-    0xd0,
-    0xe8,
-    0xf8,
-    0x80,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xf8,
-    0xf8,
-    0xf8
+static const uint8_t image_data_twr_font_ubuntu_13_0xf8[10] = {
+    0x71, 0x11, 0x31, 0x74, 0x11, 0x41, 0x41, 0x41, 0x41, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_13_0xf8 = { image_data_twr_font_ubuntu_13_0xf8,
-    5, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0xf8 = { image_data_twr_font_ubuntu_13_0xf8, 5, 13, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0xf9[13] = {
-    0xee,
-    0xd6,
-    0xee,
-    0xfe,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xc2,
-    0xfe,
-    0xfe,
+    0xee, 0xd6, 0xee, 0xfe, 0xba, 0xba, 0xba, 0xba, 0xba, 0xc2, 0xfe, 0xfe,
     0xfe
 };
-static const twr_font_image_t twr_font_ubuntu_13_0xf9 = { image_data_twr_font_ubuntu_13_0xf9,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0xf9 = { image_data_twr_font_ubuntu_13_0xf9, 7, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0xfa[13] = {
-    0xfe,
-    0xf6,
-    0xee,
-    0xfe,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xc2,
-    0xfe,
-    0xfe,
+    0xfe, 0xf6, 0xee, 0xfe, 0xba, 0xba, 0xba, 0xba, 0xba, 0xc2, 0xfe, 0xfe,
     0xfe
 };
-static const twr_font_image_t twr_font_ubuntu_13_0xfa = { image_data_twr_font_ubuntu_13_0xfa,
-    7, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0xfa = { image_data_twr_font_ubuntu_13_0xfa, 7, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_13_0xfd[13] = {
-    0xf8,
-    0xe8,
-    0xd8,
-    0xf8,
-    0x70,
-    0x70,
-    0xa8,
-    0xa8,
-    0xa8,
-    0xd8,
-    0xd8,
-    0x38,
+    0xf8, 0xe8, 0xd8, 0xf8, 0x70, 0x70, 0xa8, 0xa8, 0xa8, 0xd8, 0xd8, 0x38,
     0xf8
 };
-static const twr_font_image_t twr_font_ubuntu_13_0xfd = { image_data_twr_font_ubuntu_13_0xfd,
-    5, 13/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_13_0xfd = { image_data_twr_font_ubuntu_13_0xfd, 5, 13, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 
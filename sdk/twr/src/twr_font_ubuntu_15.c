@@ -14,7 +14,7 @@
 *
 * preset name: HARDWARIO LCD Module
 * data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
+* RLE compression enabled: no, converted by sdk/tools/font_rle.py
 * conversion type: Monochrome, Diffuse Dither 128
 * bits per pixel: 1
 *
@@ -31,2423 +31,849 @@
 
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x20[15] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x20 = { image_data_twr_font_ubuntu_15_0x20,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x21[15] = {
-    0xf0,
-    0xf0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xf0,
-    0xb0,
-    0xb0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x21 = { image_data_twr_font_ubuntu_15_0x21,
-    4, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x22[15] = {
-    0xfc,
-    0xac,
-    0xac,
-    0xac,
-    0xac,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x22 = { image_data_twr_font_ubuntu_15_0x22,
-    6, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x23[30] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xf5, 0x80,
-    0xf5, 0x80,
-    0xed, 0x80,
-    0x80, 0x80,
-    0xeb, 0x80,
-    0xeb, 0x80,
-    0x80, 0x80,
-    0xdb, 0x80,
-    0xd7, 0x80,
-    0xd7, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x23 = { image_data_twr_font_ubuntu_15_0x23,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x24[15] = {
-    0xff,
-    0xef,
-    0xef,
-    0xc3,
-    0xbf,
-    0xbf,
-    0xdf,
-    0xe7,
-    0xfb,
-    0xfd,
-    0xfd,
-    0x83,
-    0xef,
-    0xef,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x24 = { image_data_twr_font_ubuntu_15_0x24,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x25[30] = {
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xcf, 0x70,
-    0xb6, 0xf0,
-    0xb6, 0xf0,
-    0xb5, 0xf0,
-    0xcd, 0xf0,
-    0xfb, 0x30,
-    0xfa, 0xd0,
-    0xf6, 0xd0,
-    0xf6, 0xd0,
-    0xef, 0x30,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x25 = { image_data_twr_font_ubuntu_15_0x25,
-    12, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x26[30] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe7, 0x80,
-    0xdb, 0x80,
-    0xdb, 0x80,
-    0xd7, 0x80,
-    0xef, 0x80,
-    0xd6, 0x80,
-    0xba, 0x80,
-    0xbd, 0x80,
-    0xba, 0x80,
-    0xc7, 0x00,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x26 = { image_data_twr_font_ubuntu_15_0x26,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x27[15] = {
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x27 = { image_data_twr_font_ubuntu_15_0x27,
-    3, 15/*, 8*/};
+static const uint8_t image_data_twr_font_ubuntu_15_0x20[1] = {
+    0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x20 = { image_data_twr_font_ubuntu_15_0x20, 3, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x21[10] = {
+    0x91, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x71, 0x31, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x21 = { image_data_twr_font_ubuntu_15_0x21, 4, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x22[9] = {
+    0x71, 0x11, 0x31, 0x11, 0x31, 0x11, 0x31, 0x11, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x22 = { image_data_twr_font_ubuntu_15_0x22, 6, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x23[20] = {
+    0xf0, 0x71, 0x11, 0x61, 0x11, 0x51, 0x21, 0x37, 0x41, 0x11, 0x61, 0x11,
+    0x47, 0x31, 0x21, 0x51, 0x11, 0x61, 0x11, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x23 = { image_data_twr_font_ubuntu_15_0x23, 9, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x24[14] = {
+    0xb1, 0x71, 0x64, 0x31, 0x71, 0x81, 0x82, 0x81, 0x81, 0x71, 0x25, 0x51,
+    0x71, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x24 = { image_data_twr_font_ubuntu_15_0x24, 8, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x25[28] = {
+    0xf0, 0xb2, 0x41, 0x41, 0x21, 0x21, 0x51, 0x21, 0x21, 0x51, 0x21, 0x11,
+    0x72, 0x21, 0xa1, 0x22, 0x71, 0x11, 0x21, 0x51, 0x21, 0x21, 0x51, 0x21,
+    0x21, 0x41, 0x42, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x25 = { image_data_twr_font_ubuntu_15_0x25, 12, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x26[23] = {
+    0xf0, 0x62, 0x61, 0x21, 0x51, 0x21, 0x51, 0x11, 0x71, 0x71, 0x11, 0x21,
+    0x21, 0x31, 0x11, 0x21, 0x41, 0x31, 0x31, 0x11, 0x33, 0x31, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x26 = { image_data_twr_font_ubuntu_15_0x26, 9, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x27[5] = {
+    0x41, 0x21, 0x21, 0x21, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x27 = { image_data_twr_font_ubuntu_15_0x27, 3, 15, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x28[15] = {
-    0xf8,
-    0xe8,
-    0xd8,
-    0xd8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xd8,
-    0xd8,
-    0xe8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x28 = { image_data_twr_font_ubuntu_15_0x28,
-    5, 15/*, 8*/};
+    0xf8, 0xe8, 0xd8, 0xd8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8,
+    0xd8, 0xd8, 0xe8
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x28 = { image_data_twr_font_ubuntu_15_0x28, 5, 15, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x29[15] = {
-    0xf8,
-    0xb8,
-    0xd8,
-    0xd8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xd8,
-    0xd8,
-    0xb8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x29 = { image_data_twr_font_ubuntu_15_0x29,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x2a[15] = {
-    0xfe,
-    0xfe,
-    0xee,
-    0xaa,
-    0xc6,
-    0xd6,
-    0xba,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x2a = { image_data_twr_font_ubuntu_15_0x2a,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x2b[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xef,
-    0xef,
-    0xef,
-    0x01,
-    0xef,
-    0xef,
-    0xef,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x2b = { image_data_twr_font_ubuntu_15_0x2b,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x2c[15] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0x60,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x2c = { image_data_twr_font_ubuntu_15_0x2c,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x2d[15] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0x88,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x2d = { image_data_twr_font_ubuntu_15_0x2d,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x2e[15] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x2e = { image_data_twr_font_ubuntu_15_0x2e,
-    3, 15/*, 8*/};
+    0xf8, 0xb8, 0xd8, 0xd8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8,
+    0xd8, 0xd8, 0xb8
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x29 = { image_data_twr_font_ubuntu_15_0x29, 5, 15, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x2a[11] = {
+    0xf0, 0x21, 0x41, 0x11, 0x11, 0x33, 0x41, 0x11, 0x31, 0x31, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x2a = { image_data_twr_font_ubuntu_15_0x2a, 7, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x2b[10] = {
+    0xf0, 0xf0, 0xd1, 0x71, 0x71, 0x47, 0x41, 0x71, 0x71, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x2b = { image_data_twr_font_ubuntu_15_0x2b, 8, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x2c[7] = {
+    0xf0, 0xf0, 0x11, 0x21, 0x21, 0x11, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x2c = { image_data_twr_font_ubuntu_15_0x2c, 3, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x2d[4] = {
+    0xf0, 0xf0, 0x63, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x2d = { image_data_twr_font_ubuntu_15_0x2d, 5, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x2e[5] = {
+    0xf0, 0xf0, 0x11, 0x21, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x2e = { image_data_twr_font_ubuntu_15_0x2e, 3, 15, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x2f[15] = {
-    0xfc,
-    0xf8,
-    0xf4,
-    0xf4,
-    0xf4,
-    0xec,
-    0xec,
-    0xec,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0x7c
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x2f = { image_data_twr_font_ubuntu_15_0x2f,
-    6, 15/*, 8*/};
+    0xfc, 0xf8, 0xf4, 0xf4, 0xf4, 0xec, 0xec, 0xec, 0xdc, 0xdc, 0xdc, 0xbc,
+    0xbc, 0xbc, 0x7c
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x2f = { image_data_twr_font_ubuntu_15_0x2f, 6, 15, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x30[15] = {
-    0xff,
-    0xff,
-    0xc3,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc3,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x30 = { image_data_twr_font_ubuntu_15_0x30,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x31[15] = {
-    0xff,
-    0xff,
-    0xf7,
-    0xe7,
-    0xd7,
-    0xb7,
-    0xf7,
-    0xf7,
-    0xf7,
-    0xf7,
-    0xf7,
-    0xf7,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x31 = { image_data_twr_font_ubuntu_15_0x31,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x32[15] = {
-    0xff,
-    0xff,
-    0xc3,
-    0xbd,
-    0xfd,
-    0xfd,
-    0xfb,
-    0xf7,
-    0xef,
-    0xdf,
-    0xbf,
-    0x81,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x32 = { image_data_twr_font_ubuntu_15_0x32,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x33[15] = {
-    0xff,
-    0xff,
-    0x83,
-    0xfd,
-    0xfd,
-    0xfd,
-    0xe3,
-    0xfd,
-    0xfd,
-    0xfd,
-    0xfd,
-    0x83,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x33 = { image_data_twr_font_ubuntu_15_0x33,
-    8, 15/*, 8*/};
+    0xff, 0xff, 0xc3, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xc3,
+    0xff, 0xff, 0xff
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x30 = { image_data_twr_font_ubuntu_15_0x30, 8, 15, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x31[14] = {
+    0xf0, 0x51, 0x62, 0x51, 0x11, 0x41, 0x21, 0x71, 0x71, 0x71, 0x71, 0x71,
+    0x71, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x31 = { image_data_twr_font_ubuntu_15_0x31, 8, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x32[13] = {
+    0xf0, 0x34, 0x31, 0x41, 0x71, 0x71, 0x61, 0x61, 0x61, 0x61, 0x61, 0x76,
+    0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x32 = { image_data_twr_font_ubuntu_15_0x32, 8, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x33[12] = {
+    0xf0, 0x25, 0x81, 0x71, 0x71, 0x43, 0x81, 0x71, 0x71, 0x71, 0x25, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x33 = { image_data_twr_font_ubuntu_15_0x33, 8, 15, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x34[15] = {
-    0xff,
-    0xff,
-    0xfb,
-    0xf3,
-    0xeb,
-    0xdb,
-    0xdb,
-    0xbb,
-    0x81,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x34 = { image_data_twr_font_ubuntu_15_0x34,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x35[15] = {
-    0xff,
-    0xff,
-    0xc1,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xc3,
-    0xfd,
-    0xfd,
-    0xfd,
-    0xfd,
-    0x83,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x35 = { image_data_twr_font_ubuntu_15_0x35,
-    8, 15/*, 8*/};
+    0xff, 0xff, 0xfb, 0xf3, 0xeb, 0xdb, 0xdb, 0xbb, 0x81, 0xfb, 0xfb, 0xfb,
+    0xff, 0xff, 0xff
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x34 = { image_data_twr_font_ubuntu_15_0x34, 8, 15, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x35[12] = {
+    0xf0, 0x35, 0x31, 0x71, 0x71, 0x74, 0x81, 0x71, 0x71, 0x71, 0x25, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x35 = { image_data_twr_font_ubuntu_15_0x35, 8, 15, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x36[15] = {
-    0xff,
-    0xff,
-    0xf3,
-    0xef,
-    0xdf,
-    0xbf,
-    0x83,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc3,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x36 = { image_data_twr_font_ubuntu_15_0x36,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x37[15] = {
-    0xff,
-    0xff,
-    0x81,
-    0xfd,
-    0xfb,
-    0xf7,
-    0xf7,
-    0xef,
-    0xef,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x37 = { image_data_twr_font_ubuntu_15_0x37,
-    8, 15/*, 8*/};
+    0xff, 0xff, 0xf3, 0xef, 0xdf, 0xbf, 0x83, 0xbd, 0xbd, 0xbd, 0xbd, 0xc3,
+    0xff, 0xff, 0xff
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x36 = { image_data_twr_font_ubuntu_15_0x36, 8, 15, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x37[12] = {
+    0xf0, 0x26, 0x71, 0x61, 0x61, 0x71, 0x61, 0x71, 0x61, 0x71, 0x71, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x37 = { image_data_twr_font_ubuntu_15_0x37, 8, 15, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x38[15] = {
-    0xff,
-    0xff,
-    0xc3,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc3,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc3,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x38 = { image_data_twr_font_ubuntu_15_0x38,
-    8, 15/*, 8*/};
+    0xff, 0xff, 0xc3, 0xbd, 0xbd, 0xbd, 0xc3, 0xbd, 0xbd, 0xbd, 0xbd, 0xc3,
+    0xff, 0xff, 0xff
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x38 = { image_data_twr_font_ubuntu_15_0x38, 8, 15, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x39[15] = {
-    0xff,
-    0xff,
-    0xc3,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc1,
-    0xfd,
-    0xfb,
-    0xf7,
-    0xcf,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x39 = { image_data_twr_font_ubuntu_15_0x39,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x3a[15] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x3a = { image_data_twr_font_ubuntu_15_0x3a,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x3b[15] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0x60,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x3b = { image_data_twr_font_ubuntu_15_0x3b,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x3c[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xfd,
-    0xf3,
-    0xcf,
-    0xbf,
-    0xcf,
-    0xf3,
-    0xfd,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x3c = { image_data_twr_font_ubuntu_15_0x3c,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x3d[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x81,
-    0xff,
-    0xff,
-    0x81,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x3d = { image_data_twr_font_ubuntu_15_0x3d,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x3e[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xbf,
-    0xcf,
-    0xf3,
-    0xfd,
-    0xf3,
-    0xcf,
-    0xbf,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x3e = { image_data_twr_font_ubuntu_15_0x3e,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x3f[15] = {
-    0xfc,
-    0xfc,
-    0x84,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xe4,
-    0xdc,
-    0xdc,
-    0xfc,
-    0xdc,
-    0xdc,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x3f = { image_data_twr_font_ubuntu_15_0x3f,
-    6, 15/*, 8*/};
+    0xff, 0xff, 0xc3, 0xbd, 0xbd, 0xbd, 0xbd, 0xc1, 0xfd, 0xfb, 0xf7, 0xcf,
+    0xff, 0xff, 0xff
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x39 = { image_data_twr_font_ubuntu_15_0x39, 8, 15, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x3a[5] = {
+    0xd1, 0x21, 0xe1, 0x21, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x3a = { image_data_twr_font_ubuntu_15_0x3a, 3, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x3b[7] = {
+    0xd1, 0x21, 0xe1, 0x21, 0x21, 0x11, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x3b = { image_data_twr_font_ubuntu_15_0x3b, 3, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x3c[11] = {
+    0xf0, 0xf0, 0xf0, 0x11, 0x52, 0x42, 0x51, 0x82, 0x82, 0x81, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x3c = { image_data_twr_font_ubuntu_15_0x3c, 8, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x3d[7] = {
+    0xf0, 0xf0, 0xf0, 0x46, 0xf0, 0x36, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x3d = { image_data_twr_font_ubuntu_15_0x3d, 8, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x3e[10] = {
+    0xf0, 0xf0, 0xb1, 0x82, 0x82, 0x81, 0x52, 0x42, 0x51, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x3e = { image_data_twr_font_ubuntu_15_0x3e, 8, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x3f[10] = {
+    0xd4, 0x61, 0x51, 0x51, 0x32, 0x31, 0x51, 0xb1, 0x51, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x3f = { image_data_twr_font_ubuntu_15_0x3f, 6, 15, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x40[30] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xf0, 0x78,
-    0xef, 0xb8,
-    0xdf, 0xd8,
-    0xb8, 0x68,
-    0xb7, 0x68,
-    0xb7, 0x68,
-    0xb7, 0x68,
-    0xb7, 0x68,
-    0xb8, 0x98,
-    0xdf, 0xf8,
-    0xef, 0xf8,
-    0xf0, 0x78,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x40 = { image_data_twr_font_ubuntu_15_0x40,
-    13, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x41[30] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xf7, 0x80,
-    0xeb, 0x80,
-    0xeb, 0x80,
-    0xeb, 0x80,
-    0xdd, 0x80,
-    0xdd, 0x80,
-    0x80, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0x7f, 0x00,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x41 = { image_data_twr_font_ubuntu_15_0x41,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x42[30] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0x83, 0x80,
-    0xbd, 0x80,
-    0xbe, 0x80,
-    0xbd, 0x80,
-    0x83, 0x80,
-    0xbd, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xbd, 0x80,
-    0x83, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x42 = { image_data_twr_font_ubuntu_15_0x42,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x43[30] = {
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xe0, 0xc0,
-    0xdf, 0x40,
-    0xbf, 0xc0,
-    0xbf, 0xc0,
-    0xbf, 0xc0,
-    0xbf, 0xc0,
-    0xbf, 0xc0,
-    0xbf, 0xc0,
-    0xdf, 0x40,
-    0xe0, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x43 = { image_data_twr_font_ubuntu_15_0x43,
-    10, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x44[30] = {
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0x83, 0xc0,
-    0xbd, 0xc0,
-    0xbe, 0xc0,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbe, 0xc0,
-    0xbd, 0xc0,
-    0x83, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x44 = { image_data_twr_font_ubuntu_15_0x44,
-    10, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x45[15] = {
-    0xff,
-    0xff,
-    0x81,
-    0xbf,
-    0xbf,
-    0xbf,
-    0x83,
-    0xbf,
-    0xbf,
-    0xbf,
-    0xbf,
-    0x81,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x45 = { image_data_twr_font_ubuntu_15_0x45,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x46[15] = {
-    0xff,
-    0xff,
-    0x80,
-    0xbf,
-    0xbf,
-    0xbf,
-    0x81,
-    0xbf,
-    0xbf,
-    0xbf,
-    0xbf,
-    0xbf,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x46 = { image_data_twr_font_ubuntu_15_0x46,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x47[30] = {
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xe0, 0xc0,
-    0xdf, 0x40,
-    0xbf, 0xc0,
-    0xbf, 0xc0,
-    0xbf, 0xc0,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xdf, 0x40,
-    0xe0, 0x40,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x47 = { image_data_twr_font_ubuntu_15_0x47,
-    10, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x48[30] = {
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0x80, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x48 = { image_data_twr_font_ubuntu_15_0x48,
-    10, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x49[15] = {
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x49 = { image_data_twr_font_ubuntu_15_0x49,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x4a[15] = {
-    0xfe,
-    0xfe,
-    0xfa,
-    0xfa,
-    0xfa,
-    0xfa,
-    0xfa,
-    0xfa,
-    0xfa,
-    0xfa,
-    0x7a,
-    0x86,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x4a = { image_data_twr_font_ubuntu_15_0x4a,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x4b[30] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xbd, 0x80,
-    0xbb, 0x80,
-    0xb7, 0x80,
-    0xaf, 0x80,
-    0x9f, 0x80,
-    0xaf, 0x80,
-    0xb7, 0x80,
-    0xbb, 0x80,
-    0xbd, 0x80,
-    0xbe, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x4b = { image_data_twr_font_ubuntu_15_0x4b,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x4c[15] = {
-    0xfe,
-    0xfe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0x80,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x4c = { image_data_twr_font_ubuntu_15_0x4c,
-    7, 15/*, 8*/};
+    0xff, 0xf8, 0xff, 0xf8, 0xf0, 0x78, 0xef, 0xb8, 0xdf, 0xd8, 0xb8, 0x68,
+    0xb7, 0x68, 0xb7, 0x68, 0xb7, 0x68, 0xb7, 0x68, 0xb8, 0x98, 0xdf, 0xf8,
+    0xef, 0xf8, 0xf0, 0x78, 0xff, 0xf8
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x40 = { image_data_twr_font_ubuntu_15_0x40, 13, 15, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x41[20] = {
+    0xf0, 0x71, 0x71, 0x11, 0x61, 0x11, 0x61, 0x11, 0x51, 0x31, 0x41, 0x31,
+    0x37, 0x21, 0x51, 0x21, 0x51, 0x11, 0x71, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x41 = { image_data_twr_font_ubuntu_15_0x41, 9, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x42[19] = {
+    0xf0, 0x45, 0x41, 0x41, 0x31, 0x51, 0x21, 0x41, 0x35, 0x41, 0x41, 0x31,
+    0x51, 0x21, 0x51, 0x21, 0x41, 0x35, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x42 = { image_data_twr_font_ubuntu_15_0x42, 9, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x43[14] = {
+    0xf0, 0x85, 0x41, 0x51, 0x21, 0x91, 0x91, 0x91, 0x91, 0x91, 0xa1, 0x51,
+    0x45, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x43 = { image_data_twr_font_ubuntu_15_0x43, 10, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x44[20] = {
+    0xf0, 0x65, 0x51, 0x41, 0x41, 0x51, 0x31, 0x61, 0x21, 0x61, 0x21, 0x61,
+    0x21, 0x61, 0x21, 0x51, 0x31, 0x41, 0x45, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x44 = { image_data_twr_font_ubuntu_15_0x44, 10, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x45[12] = {
+    0xf0, 0x26, 0x21, 0x71, 0x71, 0x75, 0x31, 0x71, 0x71, 0x71, 0x76, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x45 = { image_data_twr_font_ubuntu_15_0x45, 8, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x46[12] = {
+    0xf0, 0x27, 0x11, 0x71, 0x71, 0x76, 0x21, 0x71, 0x71, 0x71, 0x71, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x46 = { image_data_twr_font_ubuntu_15_0x46, 8, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x47[17] = {
+    0xf0, 0x85, 0x41, 0x51, 0x21, 0x91, 0x91, 0x91, 0x61, 0x21, 0x61, 0x21,
+    0x61, 0x31, 0x51, 0x46, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x47 = { image_data_twr_font_ubuntu_15_0x47, 10, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x48[21] = {
+    0xf0, 0x61, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x28, 0x21, 0x61,
+    0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x48 = { image_data_twr_font_ubuntu_15_0x48, 10, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x49[11] = {
+    0x71, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x49 = { image_data_twr_font_ubuntu_15_0x49, 3, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x4a[13] = {
+    0xf0, 0x41, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x11, 0x41, 0x24,
+    0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x4a = { image_data_twr_font_ubuntu_15_0x4a, 7, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x4b[21] = {
+    0xf0, 0x41, 0x41, 0x31, 0x31, 0x41, 0x21, 0x51, 0x11, 0x62, 0x71, 0x11,
+    0x61, 0x21, 0x51, 0x31, 0x41, 0x41, 0x31, 0x51, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x4b = { image_data_twr_font_ubuntu_15_0x4b, 9, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x4c[11] = {
+    0xf1, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x66, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x4c = { image_data_twr_font_ubuntu_15_0x4c, 7, 15, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x4d[30] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xdf, 0xd8,
-    0xcf, 0x98,
-    0xcf, 0x98,
-    0xd7, 0x58,
-    0xd7, 0x58,
-    0xba, 0xe8,
-    0xba, 0xe8,
-    0xba, 0xe8,
-    0xbd, 0xe8,
-    0xbf, 0xe8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x4d = { image_data_twr_font_ubuntu_15_0x4d,
-    13, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x4e[30] = {
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xbf, 0x40,
-    0x9f, 0x40,
-    0xaf, 0x40,
-    0xb7, 0x40,
-    0xb7, 0x40,
-    0xbb, 0x40,
-    0xbd, 0x40,
-    0xbd, 0x40,
-    0xbe, 0x40,
-    0xbf, 0x40,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x4e = { image_data_twr_font_ubuntu_15_0x4e,
-    10, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x4f[30] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xe0, 0xe0,
-    0xdf, 0x60,
-    0xbf, 0xa0,
-    0xbf, 0xa0,
-    0xbf, 0xa0,
-    0xbf, 0xa0,
-    0xbf, 0xa0,
-    0xbf, 0xa0,
-    0xdf, 0x60,
-    0xe0, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x4f = { image_data_twr_font_ubuntu_15_0x4f,
-    11, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x50[30] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0x81, 0x80,
-    0xbe, 0x80,
-    0xbf, 0x00,
-    0xbf, 0x00,
-    0xbe, 0x80,
-    0x81, 0x80,
-    0xbf, 0x80,
-    0xbf, 0x80,
-    0xbf, 0x80,
-    0xbf, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x50 = { image_data_twr_font_ubuntu_15_0x50,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x51[30] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xe0, 0xe0,
-    0xdf, 0x60,
-    0xbf, 0xa0,
-    0xbf, 0xa0,
-    0xbf, 0xa0,
-    0xbf, 0xa0,
-    0xbf, 0xa0,
-    0xbf, 0xa0,
-    0xdf, 0x60,
-    0xe0, 0xe0,
-    0xfb, 0xe0,
-    0xfd, 0xe0,
-    0xfe, 0x60
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x51 = { image_data_twr_font_ubuntu_15_0x51,
-    11, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x52[30] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0x83, 0x80,
-    0xbd, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xbd, 0x80,
-    0x83, 0x80,
-    0xbb, 0x80,
-    0xbd, 0x80,
-    0xbe, 0x80,
-    0xbf, 0x00,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x52 = { image_data_twr_font_ubuntu_15_0x52,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x53[15] = {
-    0xfe,
-    0xfe,
-    0xc2,
-    0xba,
-    0xbe,
-    0xbe,
-    0xde,
-    0xe6,
-    0xfa,
-    0xfa,
-    0xba,
-    0x86,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x53 = { image_data_twr_font_ubuntu_15_0x53,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x54[15] = {
-    0xfe,
-    0xfe,
-    0x00,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x54 = { image_data_twr_font_ubuntu_15_0x54,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x55[30] = {
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xde, 0xc0,
-    0xe1, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x55 = { image_data_twr_font_ubuntu_15_0x55,
-    10, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x56[30] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0x7f, 0x00,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xdd, 0x80,
-    0xdd, 0x80,
-    0xdd, 0x80,
-    0xeb, 0x80,
-    0xeb, 0x80,
-    0xf7, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x56 = { image_data_twr_font_ubuntu_15_0x56,
-    9, 15/*, 8*/};
+    0xff, 0xf8, 0xff, 0xf8, 0xdf, 0xd8, 0xcf, 0x98, 0xcf, 0x98, 0xd7, 0x58,
+    0xd7, 0x58, 0xba, 0xe8, 0xba, 0xe8, 0xba, 0xe8, 0xbd, 0xe8, 0xbf, 0xe8,
+    0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x4d = { image_data_twr_font_ubuntu_15_0x4d, 13, 15, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x4e[28] = {
+    0xf0, 0x61, 0x61, 0x22, 0x51, 0x21, 0x11, 0x41, 0x21, 0x21, 0x31, 0x21,
+    0x21, 0x31, 0x21, 0x31, 0x21, 0x21, 0x41, 0x11, 0x21, 0x41, 0x11, 0x21,
+    0x52, 0x21, 0x61, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x4e = { image_data_twr_font_ubuntu_15_0x4e, 10, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x4f[20] = {
+    0xf0, 0xa5, 0x51, 0x51, 0x31, 0x71, 0x21, 0x71, 0x21, 0x71, 0x21, 0x71,
+    0x21, 0x71, 0x21, 0x71, 0x31, 0x51, 0x55, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x4f = { image_data_twr_font_ubuntu_15_0x4f, 11, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x50[16] = {
+    0xf0, 0x46, 0x31, 0x51, 0x21, 0x61, 0x11, 0x61, 0x11, 0x51, 0x26, 0x31,
+    0x81, 0x81, 0x81, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x50 = { image_data_twr_font_ubuntu_15_0x50, 9, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x51[23] = {
+    0xf0, 0xa5, 0x51, 0x51, 0x31, 0x71, 0x21, 0x71, 0x21, 0x71, 0x21, 0x71,
+    0x21, 0x71, 0x21, 0x71, 0x31, 0x51, 0x55, 0x81, 0xb1, 0xb2, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x51 = { image_data_twr_font_ubuntu_15_0x51, 11, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x52[20] = {
+    0xf0, 0x45, 0x41, 0x41, 0x31, 0x51, 0x21, 0x51, 0x21, 0x41, 0x35, 0x41,
+    0x31, 0x41, 0x41, 0x31, 0x51, 0x21, 0x61, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x52 = { image_data_twr_font_ubuntu_15_0x52, 9, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x53[14] = {
+    0xf0, 0x14, 0x21, 0x31, 0x21, 0x61, 0x71, 0x72, 0x71, 0x61, 0x21, 0x31,
+    0x24, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x53 = { image_data_twr_font_ubuntu_15_0x53, 7, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x54[11] = {
+    0xe7, 0x31, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x54 = { image_data_twr_font_ubuntu_15_0x54, 7, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x55[21] = {
+    0xf0, 0x61, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21, 0x61, 0x21,
+    0x61, 0x21, 0x61, 0x21, 0x61, 0x31, 0x41, 0x54, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x55 = { image_data_twr_font_ubuntu_15_0x55, 10, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x56[21] = {
+    0xf0, 0x31, 0x71, 0x11, 0x51, 0x21, 0x51, 0x21, 0x51, 0x31, 0x31, 0x41,
+    0x31, 0x41, 0x31, 0x51, 0x11, 0x61, 0x11, 0x71, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x56 = { image_data_twr_font_ubuntu_15_0x56, 9, 15, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x57[30] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0x7f, 0xf0,
-    0x7d, 0xf0,
-    0xbd, 0xe8,
-    0xba, 0xe8,
-    0xba, 0xe8,
-    0xba, 0xe8,
-    0xd7, 0x58,
-    0xd7, 0x58,
-    0xd7, 0x58,
-    0xef, 0xb8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x57 = { image_data_twr_font_ubuntu_15_0x57,
-    13, 15/*, 8*/};
+    0xff, 0xf8, 0xff, 0xf8, 0x7f, 0xf0, 0x7d, 0xf0, 0xbd, 0xe8, 0xba, 0xe8,
+    0xba, 0xe8, 0xba, 0xe8, 0xd7, 0x58, 0xd7, 0x58, 0xd7, 0x58, 0xef, 0xb8,
+    0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x57 = { image_data_twr_font_ubuntu_15_0x57, 13, 15, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x58[15] = {
-    0xff,
-    0xff,
-    0x7e,
-    0xbd,
-    0xdb,
-    0xdb,
-    0xe7,
-    0xe7,
-    0xdb,
-    0xdb,
-    0xbd,
-    0x7e,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x58 = { image_data_twr_font_ubuntu_15_0x58,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x59[30] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0x7f, 0x00,
-    0xbe, 0x80,
-    0xdd, 0x80,
-    0xdd, 0x80,
-    0xeb, 0x80,
-    0xf7, 0x80,
-    0xf7, 0x80,
-    0xf7, 0x80,
-    0xf7, 0x80,
-    0xf7, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x59 = { image_data_twr_font_ubuntu_15_0x59,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x5a[15] = {
-    0xff,
-    0xff,
-    0x81,
-    0xfd,
-    0xfb,
-    0xf7,
-    0xf7,
-    0xef,
-    0xdf,
-    0xdf,
-    0xbf,
-    0x81,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x5a = { image_data_twr_font_ubuntu_15_0x5a,
-    8, 15/*, 8*/};
+    0xff, 0xff, 0x7e, 0xbd, 0xdb, 0xdb, 0xe7, 0xe7, 0xdb, 0xdb, 0xbd, 0x7e,
+    0xff, 0xff, 0xff
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x58 = { image_data_twr_font_ubuntu_15_0x58, 8, 15, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x59[17] = {
+    0xf0, 0x31, 0x71, 0x11, 0x51, 0x31, 0x31, 0x41, 0x31, 0x51, 0x11, 0x71,
+    0x81, 0x81, 0x81, 0x81, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x59 = { image_data_twr_font_ubuntu_15_0x59, 9, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x5a[12] = {
+    0xf0, 0x26, 0x71, 0x61, 0x61, 0x71, 0x61, 0x61, 0x71, 0x61, 0x76, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x5a = { image_data_twr_font_ubuntu_15_0x5a, 8, 15, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x5b[15] = {
-    0xf8,
-    0x80,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x5b = { image_data_twr_font_ubuntu_15_0x5b,
-    5, 15/*, 8*/};
+    0xf8, 0x80, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8,
+    0xb8, 0xb8, 0x80
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x5b = { image_data_twr_font_ubuntu_15_0x5b, 5, 15, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x5c[15] = {
-    0xfc,
-    0x7c,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xec,
-    0xec,
-    0xec,
-    0xf4,
-    0xf4,
-    0xf4,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x5c = { image_data_twr_font_ubuntu_15_0x5c,
-    6, 15/*, 8*/};
+    0xfc, 0x7c, 0xbc, 0xbc, 0xbc, 0xdc, 0xdc, 0xdc, 0xec, 0xec, 0xec, 0xf4,
+    0xf4, 0xf4, 0xf8
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x5c = { image_data_twr_font_ubuntu_15_0x5c, 6, 15, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x5d[15] = {
-    0xf8,
-    0x08,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0x08
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x5d = { image_data_twr_font_ubuntu_15_0x5d,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x5e[15] = {
-    0xff,
-    0xff,
-    0xef,
-    0xd7,
-    0xbb,
-    0xbb,
-    0x7d,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x5e = { image_data_twr_font_ubuntu_15_0x5e,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x5f[15] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0x00
+    0xf8, 0x08, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8,
+    0xe8, 0xe8, 0x08
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x5d = { image_data_twr_font_ubuntu_15_0x5d, 5, 15, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x5e[11] = {
+    0xf0, 0x41, 0x61, 0x11, 0x41, 0x31, 0x31, 0x31, 0x21, 0x51, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_15_0x5f = { image_data_twr_font_ubuntu_15_0x5f,
-    7, 15/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_15_0x5e = { image_data_twr_font_ubuntu_15_0x5e, 8, 15, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x60[15] = {
-    0xf8,
-    0xb8,
-    0xd8,
-    0xe8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8
+static const uint8_t image_data_twr_font_ubuntu_15_0x5f[8] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x87, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_15_0x60 = { image_data_twr_font_ubuntu_15_0x60,
-    5, 15/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_15_0x5f = { image_data_twr_font_ubuntu_15_0x5f, 7, 15, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x61[15] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc6,
-    0xfa,
-    0xfa,
-    0xc2,
-    0xba,
-    0xba,
-    0xc2,
-    0xfe,
-    0xfe,
-    0xfe
+static const uint8_t image_data_twr_font_ubuntu_15_0x60[4] = {
+    0x61, 0x51, 0x51, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_15_0x61 = { image_data_twr_font_ubuntu_15_0x61,
-    7, 15/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_15_0x60 = { image_data_twr_font_ubuntu_15_0x60, 5, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x61[12] = {
+    0xf0, 0xf0, 0x73, 0x71, 0x61, 0x34, 0x21, 0x31, 0x21, 0x31, 0x34, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x61 = { image_data_twr_font_ubuntu_15_0x61, 7, 15, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x62[15] = {
-    0xff,
-    0xbf,
-    0xbf,
-    0xbf,
-    0xbf,
-    0x83,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0x83,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x62 = { image_data_twr_font_ubuntu_15_0x62,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x63[15] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc2,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xc2,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x63 = { image_data_twr_font_ubuntu_15_0x63,
-    7, 15/*, 8*/};
+    0xff, 0xbf, 0xbf, 0xbf, 0xbf, 0x83, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0x83,
+    0xff, 0xff, 0xff
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x62 = { image_data_twr_font_ubuntu_15_0x62, 8, 15, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x63[10] = {
+    0xf0, 0xf0, 0x74, 0x21, 0x61, 0x61, 0x61, 0x61, 0x74, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x63 = { image_data_twr_font_ubuntu_15_0x63, 7, 15, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x64[15] = {
-    0xff,
-    0xfd,
-    0xfd,
-    0xfd,
-    0xfd,
-    0xc1,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc1,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x64 = { image_data_twr_font_ubuntu_15_0x64,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x65[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xc3,
-    0xbd,
-    0xbd,
-    0x81,
-    0xbf,
-    0xbf,
-    0xc1,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x65 = { image_data_twr_font_ubuntu_15_0x65,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x66[15] = {
-    0xf8,
-    0xc0,
-    0xb8,
-    0xb8,
-    0xb8,
-    0x80,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x66 = { image_data_twr_font_ubuntu_15_0x66,
-    5, 15/*, 8*/};
+    0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0xc1, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xc1,
+    0xff, 0xff, 0xff
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x64 = { image_data_twr_font_ubuntu_15_0x64, 8, 15, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x65[12] = {
+    0xf0, 0xf0, 0xc4, 0x31, 0x41, 0x21, 0x41, 0x26, 0x21, 0x71, 0x85, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x65 = { image_data_twr_font_ubuntu_15_0x65, 8, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x66[12] = {
+    0x73, 0x11, 0x41, 0x41, 0x44, 0x11, 0x41, 0x41, 0x41, 0x41, 0x41, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x66 = { image_data_twr_font_ubuntu_15_0x66, 5, 15, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x67[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xc1,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc1,
-    0xfd,
-    0xfd,
-    0x83
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x67 = { image_data_twr_font_ubuntu_15_0x67,
-    8, 15/*, 8*/};
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xc1,
+    0xfd, 0xfd, 0x83
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x67 = { image_data_twr_font_ubuntu_15_0x67, 8, 15, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x68[15] = {
-    0xff,
-    0xbf,
-    0xbf,
-    0xbf,
-    0xbf,
-    0x83,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x68 = { image_data_twr_font_ubuntu_15_0x68,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x69[15] = {
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x69 = { image_data_twr_font_ubuntu_15_0x69,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x6a[15] = {
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0x60
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x6a = { image_data_twr_font_ubuntu_15_0x6a,
-    3, 15/*, 8*/};
+    0xff, 0xbf, 0xbf, 0xbf, 0xbf, 0x83, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd,
+    0xff, 0xff, 0xff
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x68 = { image_data_twr_font_ubuntu_15_0x68, 8, 15, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x69[10] = {
+    0x71, 0x21, 0x51, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x69 = { image_data_twr_font_ubuntu_15_0x69, 3, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x6a[13] = {
+    0x71, 0x21, 0x51, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x11,
+    0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x6a = { image_data_twr_font_ubuntu_15_0x6a, 3, 15, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x6b[15] = {
-    0xfe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xba,
-    0xb6,
-    0xae,
-    0x9e,
-    0xae,
-    0xb6,
-    0xba,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x6b = { image_data_twr_font_ubuntu_15_0x6b,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x6c[15] = {
-    0xf0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xc0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x6c = { image_data_twr_font_ubuntu_15_0x6c,
-    4, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x6d[30] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0x82, 0x18,
-    0xbd, 0xe8,
-    0xbd, 0xe8,
-    0xbd, 0xe8,
-    0xbd, 0xe8,
-    0xbd, 0xe8,
-    0xbd, 0xe8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x6d = { image_data_twr_font_ubuntu_15_0x6d,
-    13, 15/*, 8*/};
+    0xfe, 0xbe, 0xbe, 0xbe, 0xbe, 0xba, 0xb6, 0xae, 0x9e, 0xae, 0xb6, 0xba,
+    0xfe, 0xfe, 0xfe
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x6b = { image_data_twr_font_ubuntu_15_0x6b, 7, 15, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x6c[12] = {
+    0x51, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x42, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x6c = { image_data_twr_font_ubuntu_15_0x6c, 4, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x6d[25] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0x65, 0x14, 0x31, 0x41, 0x41, 0x21, 0x41, 0x41,
+    0x21, 0x41, 0x41, 0x21, 0x41, 0x41, 0x21, 0x41, 0x41, 0x21, 0x41, 0x41,
+    0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x6d = { image_data_twr_font_ubuntu_15_0x6d, 13, 15, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x6e[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x83,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x6e = { image_data_twr_font_ubuntu_15_0x6e,
-    8, 15/*, 8*/};
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd,
+    0xff, 0xff, 0xff
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x6e = { image_data_twr_font_ubuntu_15_0x6e, 8, 15, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x6f[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xc3,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc3,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x6f = { image_data_twr_font_ubuntu_15_0x6f,
-    8, 15/*, 8*/};
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xc3,
+    0xff, 0xff, 0xff
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x6f = { image_data_twr_font_ubuntu_15_0x6f, 8, 15, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x70[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x83,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0x83,
-    0xbf,
-    0xbf,
-    0xbf
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x70 = { image_data_twr_font_ubuntu_15_0x70,
-    8, 15/*, 8*/};
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0x83,
+    0xbf, 0xbf, 0xbf
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x70 = { image_data_twr_font_ubuntu_15_0x70, 8, 15, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x71[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xc1,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc1,
-    0xfd,
-    0xfd,
-    0xfd
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x71 = { image_data_twr_font_ubuntu_15_0x71,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x72[15] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0x80,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x72 = { image_data_twr_font_ubuntu_15_0x72,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x73[15] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xc4,
-    0xbc,
-    0xbc,
-    0xcc,
-    0xf4,
-    0xf4,
-    0x8c,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x73 = { image_data_twr_font_ubuntu_15_0x73,
-    6, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x74[15] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xbc,
-    0xbc,
-    0x84,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xc4,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x74 = { image_data_twr_font_ubuntu_15_0x74,
-    6, 15/*, 8*/};
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xc1,
+    0xfd, 0xfd, 0xfd
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x71 = { image_data_twr_font_ubuntu_15_0x71, 8, 15, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x72[9] = {
+    0xf0, 0xb4, 0x11, 0x41, 0x41, 0x41, 0x41, 0x41, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x72 = { image_data_twr_font_ubuntu_15_0x72, 5, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x73[10] = {
+    0xf0, 0xf0, 0x23, 0x21, 0x51, 0x62, 0x61, 0x51, 0x23, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x73 = { image_data_twr_font_ubuntu_15_0x73, 6, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x74[11] = {
+    0xf0, 0x41, 0x51, 0x54, 0x21, 0x51, 0x51, 0x51, 0x51, 0x63, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x74 = { image_data_twr_font_ubuntu_15_0x74, 6, 15, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x75[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc1,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x75 = { image_data_twr_font_ubuntu_15_0x75,
-    8, 15/*, 8*/};
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xc1,
+    0xff, 0xff, 0xff
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x75 = { image_data_twr_font_ubuntu_15_0x75, 8, 15, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x76[15] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0x7c,
-    0xba,
-    0xba,
-    0xba,
-    0xd6,
-    0xd6,
-    0xee,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x76 = { image_data_twr_font_ubuntu_15_0x76,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x77[30] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0x77, 0x00,
-    0x77, 0x00,
-    0xaa, 0x80,
-    0xaa, 0x80,
-    0xaa, 0x80,
-    0xdd, 0x80,
-    0xdd, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x77 = { image_data_twr_font_ubuntu_15_0x77,
-    9, 15/*, 8*/};
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x7c, 0xba, 0xba, 0xba, 0xd6, 0xd6, 0xee,
+    0xfe, 0xfe, 0xfe
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x76 = { image_data_twr_font_ubuntu_15_0x76, 7, 15, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x77[24] = {
+    0xf0, 0xf0, 0xf1, 0x31, 0x32, 0x31, 0x31, 0x11, 0x11, 0x11, 0x11, 0x21,
+    0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x11, 0x31, 0x31, 0x41, 0x31, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x77 = { image_data_twr_font_ubuntu_15_0x77, 9, 15, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x78[15] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0x7c,
-    0xba,
-    0xd6,
-    0xee,
-    0xd6,
-    0xba,
-    0x7c,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x78 = { image_data_twr_font_ubuntu_15_0x78,
-    7, 15/*, 8*/};
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x7c, 0xba, 0xd6, 0xee, 0xd6, 0xba, 0x7c,
+    0xfe, 0xfe, 0xfe
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x78 = { image_data_twr_font_ubuntu_15_0x78, 7, 15, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x79[15] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0x7c,
-    0xba,
-    0xba,
-    0xba,
-    0xd6,
-    0xd6,
-    0xee,
-    0xee,
-    0xde,
-    0x3e
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x79 = { image_data_twr_font_ubuntu_15_0x79,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x7a[15] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0x82,
-    0xfa,
-    0xf6,
-    0xee,
-    0xde,
-    0xbe,
-    0x82,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x7a = { image_data_twr_font_ubuntu_15_0x7a,
-    7, 15/*, 8*/};
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x7c, 0xba, 0xba, 0xba, 0xd6, 0xd6, 0xee,
+    0xee, 0xde, 0x3e
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x79 = { image_data_twr_font_ubuntu_15_0x79, 7, 15, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x7a[10] = {
+    0xf0, 0xf0, 0x65, 0x61, 0x51, 0x51, 0x51, 0x51, 0x65, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x7a = { image_data_twr_font_ubuntu_15_0x7a, 7, 15, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x7b[15] = {
-    0xf8,
-    0xe8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xb8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xe8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x7b = { image_data_twr_font_ubuntu_15_0x7b,
-    5, 15/*, 8*/};
+    0xf8, 0xe8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xb8, 0xd8, 0xd8, 0xd8, 0xd8,
+    0xd8, 0xd8, 0xe8
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x7b = { image_data_twr_font_ubuntu_15_0x7b, 5, 15, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x7c[15] = {
-    0xf0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x7c = { image_data_twr_font_ubuntu_15_0x7c,
-    4, 15/*, 8*/};
+    0xf0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x7c = { image_data_twr_font_ubuntu_15_0x7c, 4, 15, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0x7d[15] = {
-    0xf8,
-    0xb8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xe8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xb8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x7d = { image_data_twr_font_ubuntu_15_0x7d,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x7e[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xcd,
-    0xb3,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x7e = { image_data_twr_font_ubuntu_15_0x7e,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xb0[15] = {
-    0xf8,
-    0xc8,
-    0xb0,
-    0xb0,
-    0xc8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xb0 = { image_data_twr_font_ubuntu_15_0xb0,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xb9[15] = {
-    0xfc,
-    0xb8,
-    0xd4,
-    0xec,
-    0xfc,
-    0xc4,
-    0xbc,
-    0xbc,
-    0xcc,
-    0xf4,
-    0xf4,
-    0x8c,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xb9 = { image_data_twr_font_ubuntu_15_0xb9,
-    6, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xbb[15] = {
-    0xfc,
-    0xec,
-    0xec,
-    0xac,
-    0xbc,
-    0x84,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xc4,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xbb = { image_data_twr_font_ubuntu_15_0xbb,
-    6, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xbe[15] = {
-    0xfe,
-    0xba,
-    0xd6,
-    0xee,
-    0xfe,
-    0x82,
-    0xfa,
-    0xf6,
-    0xee,
-    0xde,
-    0xbe,
-    0x82,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xbe = { image_data_twr_font_ubuntu_15_0xbe,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xe1[15] = {
-    0xfe,
-    0xfa,
-    0xf6,
-    0xee,
-    0xfe,
-    0xc6,
-    0xfa,
-    0xfa,
-    0xc2,
-    0xba,
-    0xba,
-    0xc2,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xe1 = { image_data_twr_font_ubuntu_15_0xe1,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xe8[15] = {
-    0xfe,
-    0xba,
-    0xd6,
-    0xee,
-    0xfe,
-    0xc2,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xc2,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xe8 = { image_data_twr_font_ubuntu_15_0xe8,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xe9[15] = {
-    0xff,
-    0xfb,
-    0xf7,
-    0xef,
-    0xff,
-    0xc3,
-    0xbd,
-    0xbd,
-    0x81,
-    0xbf,
-    0xbf,
-    0xc1,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xe9 = { image_data_twr_font_ubuntu_15_0xe9,
-    8, 15/*, 8*/};
+    0xf8, 0xb8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xe8, 0xd8, 0xd8, 0xd8, 0xd8,
+    0xd8, 0xd8, 0xb8
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x7d = { image_data_twr_font_ubuntu_15_0x7d, 5, 15, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0x7e[8] = {
+    0xf0, 0xf0, 0xf0, 0xd2, 0x21, 0x21, 0x22, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0x7e = { image_data_twr_font_ubuntu_15_0x7e, 8, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0xb0[7] = {
+    0x72, 0x21, 0x21, 0x11, 0x21, 0x22, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0xb0 = { image_data_twr_font_ubuntu_15_0xb0, 5, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0xb9[13] = {
+    0x71, 0x31, 0x21, 0x11, 0x41, 0xa3, 0x21, 0x51, 0x62, 0x61, 0x51, 0x23,
+    0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0xb9 = { image_data_twr_font_ubuntu_15_0xb9, 6, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0xbb[13] = {
+    0x91, 0x51, 0x31, 0x11, 0x31, 0x54, 0x21, 0x51, 0x51, 0x51, 0x51, 0x63,
+    0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0xbb = { image_data_twr_font_ubuntu_15_0xbb, 6, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0xbe[13] = {
+    0x81, 0x31, 0x31, 0x11, 0x51, 0xb5, 0x61, 0x51, 0x51, 0x51, 0x51, 0x65,
+    0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0xbe = { image_data_twr_font_ubuntu_15_0xbe, 7, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0xe1[13] = {
+    0xc1, 0x51, 0x51, 0xc3, 0x71, 0x61, 0x34, 0x21, 0x31, 0x21, 0x31, 0x34,
+    0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0xe1 = { image_data_twr_font_ubuntu_15_0xe1, 7, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0xe8[13] = {
+    0x81, 0x31, 0x31, 0x11, 0x51, 0xc4, 0x21, 0x61, 0x61, 0x61, 0x61, 0x74,
+    0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0xe8 = { image_data_twr_font_ubuntu_15_0xe8, 7, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0xe9[13] = {
+    0xd1, 0x61, 0x61, 0xe4, 0x31, 0x41, 0x21, 0x41, 0x26, 0x21, 0x71, 0x85,
+    0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0xe9 = { image_data_twr_font_ubuntu_15_0xe9, 8, 15, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0xec[15] = {
-    0xdd,
-    0xeb,
-    0xf7,
-    0xff,
-    0xff,
-    0xc3,
-    0xbd,
-    0xbd,
-    0x81,
-    0xbf,
-    0xbf,
-    0xc1,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xec = { image_data_twr_font_ubuntu_15_0xec,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xed[15] = {
-    0xe0,
-    0xc0,
-    0xa0,
-    0x60,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xed = { image_data_twr_font_ubuntu_15_0xed,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xef[30] = {
-    0xff, 0x80,
-    0xfd, 0x00,
-    0xfd, 0x00,
-    0xfd, 0x00,
-    0xfd, 0x80,
-    0xc1, 0x80,
-    0xbd, 0x80,
-    0xbd, 0x80,
-    0xbd, 0x80,
-    0xbd, 0x80,
-    0xbd, 0x80,
-    0xc1, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xef = { image_data_twr_font_ubuntu_15_0xef,
-    9, 15/*, 8*/};
+    0xdd, 0xeb, 0xf7, 0xff, 0xff, 0xc3, 0xbd, 0xbd, 0x81, 0xbf, 0xbf, 0xc1,
+    0xff, 0xff, 0xff
+};
+static const twr_font_image_t twr_font_ubuntu_15_0xec = { image_data_twr_font_ubuntu_15_0xec, 8, 15, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0xed[11] = {
+    0x51, 0x11, 0x11, 0x61, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0xed = { image_data_twr_font_ubuntu_15_0xed, 3, 15, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0xef[20] = {
+    0xf1, 0x11, 0x61, 0x11, 0x61, 0x11, 0x61, 0x45, 0x31, 0x41, 0x31, 0x41,
+    0x31, 0x41, 0x31, 0x41, 0x31, 0x41, 0x45, 0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0xef = { image_data_twr_font_ubuntu_15_0xef, 9, 15, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0xf2[15] = {
-    0xff,
-    0xdd,
-    0xeb,
-    0xf7,
-    0xff,
-    0x83,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xf2 = { image_data_twr_font_ubuntu_15_0xf2,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xf8[15] = {
-    0xfc,
-    0xb8,
-    0xd4,
-    0xec,
-    0xfc,
-    0x84,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xf8 = { image_data_twr_font_ubuntu_15_0xf8,
-    6, 15/*, 8*/};
+    0xff, 0xdd, 0xeb, 0xf7, 0xff, 0x83, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd,
+    0xff, 0xff, 0xff
+};
+static const twr_font_image_t twr_font_ubuntu_15_0xf2 = { image_data_twr_font_ubuntu_15_0xf2, 8, 15, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_15_0xf8[13] = {
+    0x71, 0x31, 0x21, 0x11, 0x41, 0x94, 0x21, 0x51, 0x51, 0x51, 0x51, 0x51,
+    0x00
+};
+static const twr_font_image_t twr_font_ubuntu_15_0xf8 = { image_data_twr_font_ubuntu_15_0xf8, 6, 15, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0xf9[15] = {
-    0xff,
-    0xf7,
-    0xeb,
-    0xf7,
-    0xff,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc1,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xf9 = { image_data_twr_font_ubuntu_15_0xf9,
-    8, 15/*, 8*/};
+    0xff, 0xf7, 0xeb, 0xf7, 0xff, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xc1,
+    0xff, 0xff, 0xff
+};
+static const twr_font_image_t twr_font_ubuntu_15_0xf9 = { image_data_twr_font_ubuntu_15_0xf9, 8, 15, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0xfa[15] = {
-    0xff,
-    0xfb,
-    0xf7,
-    0xef,
-    0xff,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc1,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xfa = { image_data_twr_font_ubuntu_15_0xfa,
-    8, 15/*, 8*/};
+    0xff, 0xfb, 0xf7, 0xef, 0xff, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xc1,
+    0xff, 0xff, 0xff
+};
+static const twr_font_image_t twr_font_ubuntu_15_0xfa = { image_data_twr_font_ubuntu_15_0xfa, 8, 15, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_15_0xfd[15] = {
-    0xfe,
-    0xfa,
-    0xf6,
-    0xee,
-    0xfe,
-    0x7c,
-    0xba,
-    0xba,
-    0xba,
-    0xd6,
-    0xd6,
-    0xee,
-    0xee,
-    0xde,
-    0x3e
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xfd = { image_data_twr_font_ubuntu_15_0xfd,
-    7, 15/*, 8*/};
+    0xfe, 0xfa, 0xf6, 0xee, 0xfe, 0x7c, 0xba, 0xba, 0xba, 0xd6, 0xd6, 0xee,
+    0xee, 0xde, 0x3e
+};
+static const twr_font_image_t twr_font_ubuntu_15_0xfd = { image_data_twr_font_ubuntu_15_0xfd, 7, 15, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 
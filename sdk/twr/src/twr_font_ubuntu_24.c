@@ -14,7 +14,7 @@
 *
 * preset name: HARDWARIO LCD Module
 * data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
+* RLE compression enabled: no, converted by sdk/tools/font_rle.py
 * conversion type: Monochrome, Diffuse Dither 128
 * bits per pixel: 1
 *
@@ -31,3413 +31,938 @@
 
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x20[24] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc
+static const uint8_t image_data_twr_font_ubuntu_24_0x20[1] = {
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x20 = { image_data_twr_font_ubuntu_24_0x20,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x21[24] = {
-    0xfe,
-    0xfe,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xfe,
-    0xfe,
-    0xce,
-    0xce,
-    0xce,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
+static const twr_font_image_t twr_font_ubuntu_24_0x20 = { image_data_twr_font_ubuntu_24_0x20, 6, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x21[18] = {
+    0xf0, 0x12, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+    0x52, 0xf0, 0x42, 0x52, 0x52, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x21 = { image_data_twr_font_ubuntu_24_0x21,
-    7, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x22[48] = {
-    0xcc, 0xc0,
-    0xcc, 0xc0,
-    0xcc, 0xc0,
-    0xcc, 0xc0,
-    0xcc, 0xc0,
-    0xcc, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_24_0x21 = { image_data_twr_font_ubuntu_24_0x21, 7, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x22[13] = {
+    0x22, 0x22, 0x42, 0x22, 0x42, 0x22, 0x42, 0x22, 0x42, 0x22, 0x42, 0x22,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x22 = { image_data_twr_font_ubuntu_24_0x22,
-    10, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x23[48] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xf9, 0xf3,
-    0xf9, 0xf3,
-    0xf9, 0xf3,
-    0xf3, 0xe7,
-    0x80, 0x01,
-    0x80, 0x01,
-    0xf3, 0xe7,
-    0xf3, 0xe7,
-    0xe3, 0xc7,
-    0xe7, 0xcf,
-    0xe7, 0xcf,
-    0x80, 0x01,
-    0x80, 0x01,
-    0xe7, 0xcf,
-    0xcf, 0x9f,
-    0xcf, 0x9f,
-    0xcf, 0x9f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_24_0x22 = { image_data_twr_font_ubuntu_24_0x22, 10, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x23[33] = {
+    0xf0, 0xf0, 0x72, 0x52, 0x72, 0x52, 0x72, 0x52, 0x62, 0x52, 0x4e, 0x2e,
+    0x52, 0x52, 0x72, 0x52, 0x63, 0x43, 0x62, 0x52, 0x72, 0x52, 0x5e, 0x2e,
+    0x42, 0x52, 0x62, 0x52, 0x72, 0x52, 0x72, 0x52, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x23 = { image_data_twr_font_ubuntu_24_0x23,
-    16, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x24[48] = {
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xf0, 0x1c,
-    0xc0, 0x1c,
-    0x8f, 0xdc,
-    0x9f, 0xfc,
-    0x9f, 0xfc,
-    0x8f, 0xfc,
-    0xc3, 0xfc,
-    0xf0, 0xfc,
-    0xfc, 0x3c,
-    0xff, 0x1c,
-    0xff, 0x8c,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0x9f, 0x8c,
-    0x80, 0x1c,
-    0xc0, 0x3c,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x23 = { image_data_twr_font_ubuntu_24_0x23, 16, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x24[25] = {
+    0x62, 0xc2, 0xc2, 0xa7, 0x59, 0x43, 0x61, 0x42, 0xc2, 0xc3, 0xc4, 0xc4,
+    0xc4, 0xc3, 0xc3, 0xc2, 0xc2, 0x32, 0x63, 0x3a, 0x58, 0xa2, 0xc2, 0xc2,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x24 = { image_data_twr_font_ubuntu_24_0x24,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x25[72] = {
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xe1, 0xfe, 0x78,
-    0xc0, 0xfc, 0xf8,
-    0x8c, 0x79, 0xf8,
-    0x9e, 0x79, 0xf8,
-    0x9e, 0x73, 0xf8,
-    0x9e, 0x67, 0xf8,
-    0x9e, 0x67, 0xf8,
-    0x8c, 0x4c, 0x38,
-    0xc0, 0x88, 0x18,
-    0xe1, 0x91, 0x88,
-    0xff, 0x33, 0xc8,
-    0xff, 0x33, 0xc8,
-    0xfe, 0x73, 0xc8,
-    0xfc, 0xf3, 0xc8,
-    0xfc, 0xf1, 0x88,
-    0xf9, 0xf8, 0x18,
-    0xf3, 0xfc, 0x38,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_24_0x24 = { image_data_twr_font_ubuntu_24_0x24, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x25[52] = {
+    0xf0, 0xf0, 0xf4, 0x82, 0x66, 0x62, 0x63, 0x23, 0x42, 0x72, 0x42, 0x42,
+    0x72, 0x42, 0x32, 0x82, 0x42, 0x22, 0x92, 0x42, 0x22, 0x93, 0x23, 0x12,
+    0x24, 0x56, 0x13, 0x16, 0x54, 0x22, 0x13, 0x23, 0x92, 0x22, 0x42, 0x92,
+    0x22, 0x42, 0x82, 0x32, 0x42, 0x72, 0x42, 0x42, 0x72, 0x43, 0x23, 0x62,
+    0x66, 0x62, 0x84, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x25 = { image_data_twr_font_ubuntu_24_0x25,
-    21, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x26[48] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xf8, 0x7f,
-    0xf0, 0x3f,
-    0xe3, 0x1f,
-    0xe7, 0x9f,
-    0xe7, 0x9f,
-    0xe7, 0x9f,
-    0xf3, 0x3f,
-    0xf0, 0x7f,
-    0xf0, 0xff,
-    0xc0, 0x79,
-    0xce, 0x39,
-    0x9f, 0x33,
-    0x9f, 0x97,
-    0x9f, 0xc7,
-    0x8f, 0xc7,
-    0xc0, 0x13,
-    0xf0, 0x39,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_24_0x25 = { image_data_twr_font_ubuntu_24_0x25, 21, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x26[36] = {
+    0xf0, 0xf0, 0x74, 0xb6, 0x93, 0x23, 0x82, 0x42, 0x82, 0x42, 0x82, 0x42,
+    0x92, 0x22, 0xa5, 0xb4, 0xa7, 0x42, 0x32, 0x33, 0x32, 0x22, 0x52, 0x22,
+    0x32, 0x62, 0x11, 0x42, 0x73, 0x43, 0x63, 0x59, 0x12, 0x66, 0x32, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x26 = { image_data_twr_font_ubuntu_24_0x26,
-    16, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x27[24] = {
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x26 = { image_data_twr_font_ubuntu_24_0x26, 16, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x27[7] = {
+    0x22, 0x42, 0x42, 0x42, 0x42, 0x42, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x27 = { image_data_twr_font_ubuntu_24_0x27,
-    6, 24/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_24_0x27 = { image_data_twr_font_ubuntu_24_0x27, 6, 24, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_24_0x28[24] = {
-    0xfd,
-    0xf9,
-    0xf3,
-    0xf3,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xf3,
-    0xf3,
-    0xf9,
-    0xfd,
-    0xff
+    0xfd, 0xf9, 0xf3, 0xf3, 0xe7, 0xe7, 0xe7, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf,
+    0xcf, 0xcf, 0xcf, 0xcf, 0xe7, 0xe7, 0xe7, 0xf3, 0xf3, 0xf9, 0xfd, 0xff
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x28 = { image_data_twr_font_ubuntu_24_0x28,
-    8, 24/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_24_0x28 = { image_data_twr_font_ubuntu_24_0x28, 8, 24, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_24_0x29[24] = {
-    0xbf,
-    0x9f,
-    0xcf,
-    0xcf,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xcf,
-    0xcf,
-    0x9f,
-    0xbf,
-    0xff
+    0xbf, 0x9f, 0xcf, 0xcf, 0xe7, 0xe7, 0xe7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
+    0xf3, 0xf3, 0xf3, 0xf3, 0xe7, 0xe7, 0xe7, 0xcf, 0xcf, 0x9f, 0xbf, 0xff
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x29 = { image_data_twr_font_ubuntu_24_0x29,
-    8, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x2a[48] = {
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xf8, 0xf0,
-    0xf8, 0xf0,
-    0xc8, 0x90,
-    0xc4, 0x10,
-    0xf0, 0x70,
-    0xfa, 0xf0,
-    0xf2, 0x70,
-    0xe2, 0x30,
-    0xf7, 0x70,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
+static const twr_font_image_t twr_font_ubuntu_24_0x29 = { image_data_twr_font_ubuntu_24_0x29, 8, 24, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x2a[18] = {
+    0xf0, 0xe3, 0x93, 0x62, 0x13, 0x12, 0x33, 0x15, 0x55, 0x81, 0x11, 0x82,
+    0x12, 0x63, 0x13, 0x61, 0x31, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x2a = { image_data_twr_font_ubuntu_24_0x2a,
-    12, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x2b[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0x80, 0x04,
-    0x80, 0x04,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x2a = { image_data_twr_font_ubuntu_24_0x2a, 12, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x2b[18] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xc2, 0xc2, 0xc2, 0xc2, 0x7c, 0x2c,
+    0x72, 0xc2, 0xc2, 0xc2, 0xc2, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x2b = { image_data_twr_font_ubuntu_24_0x2b,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x2c[24] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xdc,
-    0x9c,
-    0x9c,
-    0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x2b = { image_data_twr_font_ubuntu_24_0x2b, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x2c[14] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x82, 0x42, 0x42, 0x42, 0x41, 0x42,
+    0x42, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x2c = { image_data_twr_font_ubuntu_24_0x2c,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x2d[24] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x81,
-    0x81,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff
+static const twr_font_image_t twr_font_ubuntu_24_0x2c = { image_data_twr_font_ubuntu_24_0x2c, 6, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x2d[8] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe6, 0x26, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x2d = { image_data_twr_font_ubuntu_24_0x2d,
-    8, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x2e[24] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0x8c,
-    0x8c,
-    0x8c,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x2d = { image_data_twr_font_ubuntu_24_0x2d, 8, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x2e[10] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x73, 0x33, 0x33, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x2e = { image_data_twr_font_ubuntu_24_0x2e,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x2f[48] = {
-    0xff, 0x00,
-    0xfe, 0x40,
-    0xfe, 0x40,
-    0xfe, 0x40,
-    0xfc, 0xc0,
-    0xfc, 0xc0,
-    0xf9, 0xc0,
-    0xf9, 0xc0,
-    0xf9, 0xc0,
-    0xf3, 0xc0,
-    0xf3, 0xc0,
-    0xe3, 0xc0,
-    0xe7, 0xc0,
-    0xe7, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0x9f, 0xc0,
-    0x9f, 0xc0,
-    0x3f, 0xc0,
-    0x3f, 0xc0,
-    0x3f, 0xc0,
-    0x7f, 0xc0,
-    0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_24_0x2e = { image_data_twr_font_ubuntu_24_0x2e, 6, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x2f[24] = {
+    0x82, 0x72, 0x82, 0x82, 0x72, 0x82, 0x72, 0x82, 0x82, 0x72, 0x82, 0x73,
+    0x72, 0x82, 0x72, 0x82, 0x82, 0x72, 0x82, 0x72, 0x82, 0x82, 0x81, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x2f = { image_data_twr_font_ubuntu_24_0x2f,
-    10, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x30[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xf8, 0x7c,
-    0xe0, 0x1c,
-    0xc7, 0x8c,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xc7, 0x8c,
-    0xe0, 0x1c,
-    0xf8, 0x7c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x2f = { image_data_twr_font_ubuntu_24_0x2f, 10, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x30[33] = {
+    0xf0, 0xf0, 0x34, 0x88, 0x53, 0x43, 0x42, 0x62, 0x42, 0x62, 0x32, 0x82,
+    0x22, 0x82, 0x22, 0x82, 0x22, 0x82, 0x22, 0x82, 0x22, 0x82, 0x22, 0x82,
+    0x32, 0x62, 0x42, 0x62, 0x43, 0x43, 0x58, 0x84, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x30 = { image_data_twr_font_ubuntu_24_0x30,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x31[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xfe, 0x7c,
-    0xfc, 0x7c,
-    0xf0, 0x7c,
-    0xe2, 0x7c,
-    0xe6, 0x7c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x30 = { image_data_twr_font_ubuntu_24_0x30, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x31[22] = {
+    0xf0, 0xf0, 0x52, 0xb3, 0x95, 0x83, 0x12, 0x82, 0x22, 0xc2, 0xc2, 0xc2,
+    0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x31 = { image_data_twr_font_ubuntu_24_0x31,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x32[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xf0, 0x3c,
-    0xe0, 0x1c,
-    0xc7, 0x8c,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0x9c,
-    0xff, 0x1c,
-    0xfe, 0x3c,
-    0xfc, 0x7c,
-    0xf8, 0xfc,
-    0xf1, 0xfc,
-    0xf3, 0xfc,
-    0xe7, 0xfc,
-    0xcf, 0xfc,
-    0xc0, 0x04,
-    0xc0, 0x04,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x31 = { image_data_twr_font_ubuntu_24_0x31, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x32[21] = {
+    0xf0, 0xf0, 0x26, 0x78, 0x53, 0x43, 0xc2, 0xc2, 0xc2, 0xb2, 0xb3, 0xa3,
+    0xa3, 0xa3, 0xa3, 0xb2, 0xb2, 0xb2, 0xcb, 0x3b, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x32 = { image_data_twr_font_ubuntu_24_0x32,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x33[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xe0, 0xfc,
-    0x80, 0x3c,
-    0xdf, 0x1c,
-    0xff, 0x9c,
-    0xff, 0x9c,
-    0xff, 0x9c,
-    0xff, 0x3c,
-    0xf0, 0x3c,
-    0xf0, 0x3c,
-    0xff, 0x1c,
-    0xff, 0x8c,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xbf, 0x1c,
-    0x80, 0x1c,
-    0xc0, 0x7c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x32 = { image_data_twr_font_ubuntu_24_0x32, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x33[22] = {
+    0xf0, 0xf0, 0x15, 0x79, 0x61, 0x53, 0xc2, 0xc2, 0xc2, 0xb2, 0x86, 0x86,
+    0xc3, 0xc3, 0xc2, 0xc2, 0xc2, 0x31, 0x63, 0x4a, 0x57, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x33 = { image_data_twr_font_ubuntu_24_0x33,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x34[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0x1c,
-    0xff, 0x1c,
-    0xfe, 0x1c,
-    0xfc, 0x1c,
-    0xf8, 0x9c,
-    0xf1, 0x9c,
-    0xf3, 0x9c,
-    0xe7, 0x9c,
-    0xc7, 0x9c,
-    0xcf, 0x9c,
-    0x9f, 0x9c,
-    0x80, 0x04,
-    0x80, 0x04,
-    0xff, 0x9c,
-    0xff, 0x9c,
-    0xff, 0x9c,
-    0xff, 0x9c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x33 = { image_data_twr_font_ubuntu_24_0x33, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x34[27] = {
+    0xf0, 0xf0, 0x63, 0xb3, 0xa4, 0x95, 0x83, 0x12, 0x73, 0x22, 0x72, 0x32,
+    0x62, 0x42, 0x53, 0x42, 0x52, 0x52, 0x42, 0x62, 0x4c, 0x2c, 0xa2, 0xc2,
+    0xc2, 0xc2, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x34 = { image_data_twr_font_ubuntu_24_0x34,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x35[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xf0, 0x1c,
-    0xf0, 0x1c,
-    0xf3, 0xfc,
-    0xf3, 0xfc,
-    0xf3, 0xfc,
-    0xf3, 0xfc,
-    0xe0, 0xfc,
-    0xe0, 0x3c,
-    0xfe, 0x1c,
-    0xff, 0x8c,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xdf, 0x9c,
-    0xc0, 0x1c,
-    0xe0, 0x7c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x34 = { image_data_twr_font_ubuntu_24_0x34, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x35[21] = {
+    0xf0, 0xf0, 0x27, 0x77, 0x72, 0xc2, 0xc2, 0xc2, 0xb5, 0x97, 0xb4, 0xc3,
+    0xc2, 0xc2, 0xc2, 0xc2, 0x41, 0x62, 0x59, 0x66, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x35 = { image_data_twr_font_ubuntu_24_0x35,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x36[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0x0c,
-    0xfc, 0x0c,
-    0xf8, 0xfc,
-    0xf3, 0xfc,
-    0xe7, 0xfc,
-    0xe7, 0xfc,
-    0xc8, 0x3c,
-    0xc0, 0x0c,
-    0xcf, 0xcc,
-    0xcf, 0xe4,
-    0xcf, 0xe4,
-    0xcf, 0xe4,
-    0xcf, 0xe4,
-    0xe7, 0xc4,
-    0xe3, 0x8c,
-    0xf0, 0x1c,
-    0xf8, 0x3c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x35 = { image_data_twr_font_ubuntu_24_0x35, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x36[28] = {
+    0xf0, 0xf0, 0x64, 0x86, 0x73, 0xa2, 0xb2, 0xc2, 0xb2, 0x15, 0x6a, 0x42,
+    0x62, 0x42, 0x72, 0x32, 0x72, 0x32, 0x72, 0x32, 0x72, 0x42, 0x53, 0x43,
+    0x33, 0x67, 0x85, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x36 = { image_data_twr_font_ubuntu_24_0x36,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x37[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0x80, 0x0c,
-    0x80, 0x0c,
-    0xff, 0xcc,
-    0xff, 0x9c,
-    0xff, 0x3c,
-    0xff, 0x3c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xf9, 0xfc,
-    0xf9, 0xfc,
-    0xf9, 0xfc,
-    0xf9, 0xfc,
-    0xf3, 0xfc,
-    0xf3, 0xfc,
-    0xf3, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x36 = { image_data_twr_font_ubuntu_24_0x36, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x37[19] = {
+    0xf0, 0xeb, 0x3b, 0xc2, 0xb2, 0xb2, 0xc2, 0xb2, 0xc2, 0xb2, 0xc2, 0xb2,
+    0xc2, 0xc2, 0xc2, 0xb2, 0xc2, 0xc2, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x37 = { image_data_twr_font_ubuntu_24_0x37,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x38[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xf0, 0x3c,
-    0xc0, 0x0c,
-    0xcf, 0xcc,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0xc7, 0xcc,
-    0xc1, 0x1c,
-    0xf0, 0x3c,
-    0xe6, 0x0c,
-    0xcf, 0x8c,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0x8f, 0xc4,
-    0xc0, 0x0c,
-    0xf0, 0x3c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x37 = { image_data_twr_font_ubuntu_24_0x37, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x38[32] = {
+    0xf0, 0xf0, 0x26, 0x6a, 0x42, 0x62, 0x32, 0x82, 0x22, 0x82, 0x22, 0x82,
+    0x33, 0x52, 0x45, 0x13, 0x76, 0x72, 0x25, 0x42, 0x53, 0x32, 0x82, 0x22,
+    0x82, 0x22, 0x82, 0x23, 0x63, 0x3a, 0x66, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x38 = { image_data_twr_font_ubuntu_24_0x38,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x39[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xf0, 0x7c,
-    0xc0, 0x3c,
-    0xcf, 0x1c,
-    0x9f, 0x9c,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0xcf, 0xcc,
-    0xc0, 0x0c,
-    0xf0, 0x4c,
-    0xff, 0x8c,
-    0xff, 0x9c,
-    0xff, 0x1c,
-    0xfe, 0x3c,
-    0xfc, 0x7c,
-    0xc0, 0xfc,
-    0xc3, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x38 = { image_data_twr_font_ubuntu_24_0x38, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x39[27] = {
+    0xf0, 0xf0, 0x25, 0x78, 0x62, 0x43, 0x42, 0x62, 0x42, 0x72, 0x32, 0x72,
+    0x32, 0x72, 0x42, 0x62, 0x4a, 0x65, 0x12, 0xb3, 0xb2, 0xb3, 0xa3, 0xa3,
+    0x76, 0x84, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x39 = { image_data_twr_font_ubuntu_24_0x39,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x3a[24] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0x8c,
-    0x8c,
-    0x8c,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0x8c,
-    0x8c,
-    0x8c,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x39 = { image_data_twr_font_ubuntu_24_0x39, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x3a[11] = {
+    0xf0, 0xf0, 0x73, 0x33, 0x33, 0xf0, 0xf0, 0xf3, 0x33, 0x33, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x3a = { image_data_twr_font_ubuntu_24_0x3a,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x3b[24] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0x8c,
-    0x8c,
-    0x8c,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xdc,
-    0x9c,
-    0x9c,
-    0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x3a = { image_data_twr_font_ubuntu_24_0x3a, 6, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x3b[16] = {
+    0xf0, 0xf0, 0x73, 0x33, 0x33, 0xf0, 0xf0, 0xf0, 0x12, 0x42, 0x42, 0x42,
+    0x41, 0x42, 0x42, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x3b = { image_data_twr_font_ubuntu_24_0x3b,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x3c[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xec,
-    0xff, 0x84,
-    0xfc, 0x1c,
-    0xf0, 0x7c,
-    0xc3, 0xfc,
-    0xcf, 0xfc,
-    0xc3, 0xfc,
-    0xf0, 0x7c,
-    0xfc, 0x1c,
-    0xff, 0x84,
-    0xff, 0xec,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x3b = { image_data_twr_font_ubuntu_24_0x3b, 6, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x3c[18] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x51, 0xb4, 0x75, 0x75, 0x74, 0xa2,
+    0xc4, 0xc5, 0xb5, 0xc4, 0xc1, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x3c = { image_data_twr_font_ubuntu_24_0x3c,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x3d[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xc0, 0x04,
-    0xc0, 0x04,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xc0, 0x04,
-    0xc0, 0x04,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x3c = { image_data_twr_font_ubuntu_24_0x3c, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x3d[14] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x9b, 0x3b, 0xf0, 0xf0, 0xfb,
+    0x3b, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x3d = { image_data_twr_font_ubuntu_24_0x3d,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x3e[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xdf, 0xfc,
-    0x87, 0xfc,
-    0xe0, 0xfc,
-    0xf8, 0x3c,
-    0xff, 0x0c,
-    0xff, 0xcc,
-    0xff, 0x0c,
-    0xf8, 0x3c,
-    0xe0, 0xfc,
-    0x87, 0xfc,
-    0xdf, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x3d = { image_data_twr_font_ubuntu_24_0x3d, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x3e[17] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xb1, 0xc4, 0xc5, 0xb5, 0xc4, 0xc2, 0xa4,
+    0x75, 0x75, 0x74, 0xb1, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x3e = { image_data_twr_font_ubuntu_24_0x3e,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x3f[48] = {
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xc1, 0xc0,
-    0x80, 0xc0,
-    0xfc, 0x40,
-    0xfe, 0x40,
-    0xfe, 0x40,
-    0xfe, 0x40,
-    0xfc, 0xc0,
-    0xf9, 0xc0,
-    0xf3, 0xc0,
-    0xe3, 0xc0,
-    0xe7, 0xc0,
-    0xe7, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xe7, 0xc0,
-    0xe7, 0xc0,
-    0xe7, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_24_0x3e = { image_data_twr_font_ubuntu_24_0x3e, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x3f[18] = {
+    0xf0, 0x75, 0x47, 0x83, 0x82, 0x82, 0x82, 0x72, 0x72, 0x72, 0x73, 0x72,
+    0x82, 0xf0, 0xd2, 0x82, 0x82, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x3f = { image_data_twr_font_ubuntu_24_0x3f,
-    10, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x40[72] = {
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0x01, 0xfe,
-    0xfc, 0x00, 0x7e,
-    0xf8, 0x7e, 0x3e,
-    0xf1, 0xff, 0x1e,
-    0xe3, 0xff, 0x8e,
-    0xe7, 0xc0, 0xce,
-    0xe7, 0x00, 0xe6,
-    0xcf, 0x3c, 0xe6,
-    0xce, 0x3c, 0xe6,
-    0xce, 0x7c, 0xe6,
-    0xce, 0x7c, 0xe6,
-    0xce, 0x7c, 0xe6,
-    0xce, 0x7c, 0xc6,
-    0xcf, 0x3c, 0xce,
-    0xe7, 0x00, 0x0e,
-    0xe7, 0xc2, 0x1e,
-    0xe3, 0xff, 0xfe,
-    0xf1, 0xff, 0xfe,
-    0xf8, 0x7f, 0xfe,
-    0xfc, 0x00, 0xfe,
-    0xff, 0x80, 0xfe,
-    0xff, 0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_24_0x3f = { image_data_twr_font_ubuntu_24_0x3f, 10, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x40[60] = {
+    0xf0, 0xf0, 0xf0, 0x97, 0xeb, 0xb4, 0x63, 0x93, 0x93, 0x73, 0xb3, 0x62,
+    0x56, 0x22, 0x62, 0x38, 0x32, 0x42, 0x42, 0x42, 0x32, 0x42, 0x33, 0x42,
+    0x32, 0x42, 0x32, 0x52, 0x32, 0x42, 0x32, 0x52, 0x32, 0x42, 0x32, 0x52,
+    0x32, 0x42, 0x32, 0x52, 0x23, 0x42, 0x42, 0x42, 0x22, 0x62, 0x3c, 0x62,
+    0x54, 0x14, 0x73, 0xf0, 0x63, 0xf0, 0x64, 0xf0, 0x5a, 0xf0, 0x17, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x40 = { image_data_twr_font_ubuntu_24_0x40,
-    23, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x41[48] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xf9, 0x3e,
-    0xf9, 0x3e,
-    0xf1, 0x1e,
-    0xf3, 0x9e,
-    0xf3, 0x9e,
-    0xe7, 0xce,
-    0xe7, 0xce,
-    0xc7, 0xce,
-    0xc0, 0x06,
-    0xc0, 0x06,
-    0x9f, 0xf2,
-    0x9f, 0xf2,
-    0x9f, 0xf2,
-    0x3f, 0xf8,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_24_0x40 = { image_data_twr_font_ubuntu_24_0x40, 23, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x41[32] = {
+    0xf0, 0xf0, 0x63, 0xc3, 0xc3, 0xb2, 0x12, 0xa2, 0x12, 0x93, 0x13, 0x82,
+    0x32, 0x82, 0x32, 0x72, 0x52, 0x62, 0x52, 0x53, 0x52, 0x5b, 0x4b, 0x32,
+    0x92, 0x22, 0x92, 0x22, 0x92, 0x12, 0xb2, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x41 = { image_data_twr_font_ubuntu_24_0x41,
-    15, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x42[48] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xc0, 0x3e,
-    0xc0, 0x0e,
-    0xcf, 0xc6,
-    0xcf, 0xe6,
-    0xcf, 0xe6,
-    0xcf, 0xe6,
-    0xcf, 0xce,
-    0xc0, 0x1e,
-    0xc0, 0x0e,
-    0xcf, 0xc6,
-    0xcf, 0xf2,
-    0xcf, 0xf2,
-    0xcf, 0xf2,
-    0xcf, 0xf2,
-    0xcf, 0xc6,
-    0xc0, 0x0e,
-    0xc0, 0x1e,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_24_0x41 = { image_data_twr_font_ubuntu_24_0x41, 15, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x42[31] = {
+    0xf0, 0xf0, 0x28, 0x7a, 0x52, 0x63, 0x42, 0x72, 0x42, 0x72, 0x42, 0x72,
+    0x42, 0x62, 0x59, 0x6a, 0x52, 0x63, 0x42, 0x82, 0x32, 0x82, 0x32, 0x82,
+    0x32, 0x82, 0x32, 0x63, 0x4a, 0x59, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x42 = { image_data_twr_font_ubuntu_24_0x42,
-    15, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x43[48] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xfc, 0x06,
-    0xf0, 0x02,
-    0xe3, 0xf2,
-    0xc7, 0xfe,
-    0xcf, 0xfe,
-    0x8f, 0xfe,
-    0x9f, 0xfe,
-    0x9f, 0xfe,
-    0x9f, 0xfe,
-    0x9f, 0xfe,
-    0x9f, 0xfe,
-    0x9f, 0xfe,
-    0xcf, 0xfe,
-    0xc7, 0xfe,
-    0xe3, 0xf2,
-    0xf0, 0x02,
-    0xfc, 0x06,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_24_0x42 = { image_data_twr_font_ubuntu_24_0x42, 15, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x43[22] = {
+    0xf0, 0xf0, 0x67, 0x6a, 0x43, 0x62, 0x33, 0xc2, 0xc3, 0xc2, 0xd2, 0xd2,
+    0xd2, 0xd2, 0xd2, 0xe2, 0xd3, 0xd3, 0x62, 0x5a, 0x77, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x43 = { image_data_twr_font_ubuntu_24_0x43,
-    15, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x44[72] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xc0, 0x3f, 0x80,
-    0xc0, 0x07, 0x80,
-    0xcf, 0xc3, 0x80,
-    0xcf, 0xf1, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf8, 0x80,
-    0xcf, 0xfc, 0x80,
-    0xcf, 0xfc, 0x80,
-    0xcf, 0xfc, 0x80,
-    0xcf, 0xfc, 0x80,
-    0xcf, 0xfc, 0x80,
-    0xcf, 0xf8, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf1, 0x80,
-    0xcf, 0xc3, 0x80,
-    0xc0, 0x07, 0x80,
-    0xc0, 0x3f, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_24_0x43 = { image_data_twr_font_ubuntu_24_0x43, 15, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x44[33] = {
+    0xf0, 0xf0, 0x68, 0x9b, 0x62, 0x64, 0x52, 0x83, 0x42, 0x92, 0x42, 0x93,
+    0x32, 0xa2, 0x32, 0xa2, 0x32, 0xa2, 0x32, 0xa2, 0x32, 0xa2, 0x32, 0x93,
+    0x32, 0x92, 0x42, 0x83, 0x42, 0x64, 0x5b, 0x68, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x44 = { image_data_twr_font_ubuntu_24_0x44,
-    17, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x45[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xc0, 0x0c,
-    0xc0, 0x0c,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xc0, 0x0c,
-    0xc0, 0x0c,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xc0, 0x04,
-    0xc0, 0x04,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x44 = { image_data_twr_font_ubuntu_24_0x44, 17, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x45[19] = {
+    0xf0, 0xfa, 0x4a, 0x42, 0xc2, 0xc2, 0xc2, 0xc2, 0xca, 0x4a, 0x42, 0xc2,
+    0xc2, 0xc2, 0xc2, 0xc2, 0xcb, 0x3b, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x45 = { image_data_twr_font_ubuntu_24_0x45,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x46[48] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xc0, 0x08,
-    0xc0, 0x08,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xc0, 0x18,
-    0xc0, 0x18,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_24_0x45 = { image_data_twr_font_ubuntu_24_0x45, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x46[19] = {
+    0xf0, 0xda, 0x3a, 0x32, 0xb2, 0xb2, 0xb2, 0xb2, 0xb9, 0x49, 0x42, 0xb2,
+    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x46 = { image_data_twr_font_ubuntu_24_0x46,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x47[48] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xfc, 0x07,
-    0xf0, 0x03,
-    0xe3, 0xf7,
-    0xc7, 0xff,
-    0xcf, 0xff,
-    0x8f, 0xff,
-    0x9f, 0xff,
-    0x9f, 0xff,
-    0x9f, 0xff,
-    0x9f, 0xf3,
-    0x9f, 0xf3,
-    0x9f, 0xf3,
-    0xcf, 0xf3,
-    0xc7, 0xf3,
-    0xe3, 0xf3,
-    0xf0, 0x03,
-    0xfc, 0x07,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_24_0x46 = { image_data_twr_font_ubuntu_24_0x46, 13, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x47[27] = {
+    0xf0, 0xf0, 0x87, 0x7a, 0x53, 0x61, 0x53, 0xd2, 0xd3, 0xd2, 0xe2, 0xe2,
+    0xe2, 0x92, 0x32, 0x92, 0x32, 0x92, 0x42, 0x82, 0x43, 0x72, 0x53, 0x62,
+    0x6a, 0x87, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x47 = { image_data_twr_font_ubuntu_24_0x47,
-    16, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x48[72] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xc0, 0x01, 0x80,
-    0xc0, 0x01, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_24_0x47 = { image_data_twr_font_ubuntu_24_0x47, 16, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x48[35] = {
+    0xf0, 0xf0, 0x62, 0x92, 0x42, 0x92, 0x42, 0x92, 0x42, 0x92, 0x42, 0x92,
+    0x42, 0x92, 0x42, 0x92, 0x4d, 0x4d, 0x42, 0x92, 0x42, 0x92, 0x42, 0x92,
+    0x42, 0x92, 0x42, 0x92, 0x42, 0x92, 0x42, 0x92, 0x42, 0x92, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x48 = { image_data_twr_font_ubuntu_24_0x48,
-    17, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x49[24] = {
-    0xfc,
-    0xfc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x48 = { image_data_twr_font_ubuntu_24_0x48, 17, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x49[18] = {
+    0xe2, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x49 = { image_data_twr_font_ubuntu_24_0x49,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x4a[48] = {
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xbe, 0x70,
-    0x00, 0x70,
-    0xc1, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
+static const twr_font_image_t twr_font_ubuntu_24_0x49 = { image_data_twr_font_ubuntu_24_0x49, 6, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x4a[21] = {
+    0xf0, 0xf0, 0x22, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2,
+    0xa2, 0xa2, 0xa2, 0xa2, 0x31, 0x52, 0x39, 0x55, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x4a = { image_data_twr_font_ubuntu_24_0x4a,
-    12, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x4b[48] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xcf, 0xe6,
-    0xcf, 0xce,
-    0xcf, 0x9e,
-    0xcf, 0x3e,
-    0xce, 0x7e,
-    0xcc, 0xfe,
-    0xc9, 0xfe,
-    0xc3, 0xfe,
-    0xc1, 0xfe,
-    0xc8, 0x7e,
-    0xcc, 0x3e,
-    0xce, 0x1e,
-    0xcf, 0x0e,
-    0xcf, 0x86,
-    0xcf, 0xc6,
-    0xcf, 0xe2,
-    0xcf, 0xf0,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_24_0x4a = { image_data_twr_font_ubuntu_24_0x4a, 12, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x4b[35] = {
+    0xf0, 0xf0, 0x22, 0x72, 0x42, 0x62, 0x52, 0x52, 0x62, 0x42, 0x72, 0x32,
+    0x82, 0x22, 0x92, 0x12, 0xa4, 0xb5, 0xa2, 0x14, 0x82, 0x24, 0x72, 0x34,
+    0x62, 0x44, 0x52, 0x54, 0x42, 0x63, 0x42, 0x73, 0x32, 0x83, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x4b = { image_data_twr_font_ubuntu_24_0x4b,
-    15, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x4c[48] = {
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xc0, 0x00,
-    0xc0, 0x00,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
+static const twr_font_image_t twr_font_ubuntu_24_0x4b = { image_data_twr_font_ubuntu_24_0x4b, 15, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x4c[19] = {
+    0xf0, 0xb2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2,
+    0xa2, 0xa2, 0xa2, 0xa2, 0xaa, 0x2a, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x4c = { image_data_twr_font_ubuntu_24_0x4c,
-    12, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x4d[72] = {
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc3, 0xfc, 0x30,
-    0xcb, 0xfd, 0x30,
-    0xc9, 0xf9, 0x30,
-    0xcd, 0xfb, 0x30,
-    0x9c, 0xf3, 0x90,
-    0x9e, 0xf7, 0x90,
-    0x9e, 0x67, 0x90,
-    0x9e, 0x67, 0x90,
-    0x9f, 0x6f, 0x90,
-    0x9f, 0x0f, 0x90,
-    0x9f, 0x0f, 0x90,
-    0x9f, 0x9f, 0x90,
-    0x9f, 0xff, 0x90,
-    0x9f, 0xff, 0x90,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0
+static const twr_font_image_t twr_font_ubuntu_24_0x4c = { image_data_twr_font_ubuntu_24_0x4c, 12, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x4d[56] = {
+    0xf0, 0xf0, 0xc2, 0xc2, 0x43, 0xa3, 0x43, 0xa3, 0x44, 0x84, 0x42, 0x11,
+    0x81, 0x12, 0x42, 0x12, 0x62, 0x12, 0x42, 0x21, 0x61, 0x22, 0x32, 0x32,
+    0x42, 0x32, 0x22, 0x41, 0x41, 0x42, 0x22, 0x42, 0x22, 0x42, 0x22, 0x42,
+    0x22, 0x42, 0x22, 0x51, 0x21, 0x52, 0x22, 0x54, 0x52, 0x22, 0x54, 0x52,
+    0x22, 0x62, 0x62, 0x22, 0xe2, 0x22, 0xe2, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x4d = { image_data_twr_font_ubuntu_24_0x4d,
-    20, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x4e[72] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xc7, 0xf9, 0x80,
-    0xc3, 0xf9, 0x80,
-    0xc1, 0xf9, 0x80,
-    0xc9, 0xf9, 0x80,
-    0xcc, 0xf9, 0x80,
-    0xcc, 0x79, 0x80,
-    0xce, 0x39, 0x80,
-    0xcf, 0x39, 0x80,
-    0xcf, 0x99, 0x80,
-    0xcf, 0x89, 0x80,
-    0xcf, 0xc9, 0x80,
-    0xcf, 0xe1, 0x80,
-    0xcf, 0xf1, 0x80,
-    0xcf, 0xf1, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xfd, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_24_0x4d = { image_data_twr_font_ubuntu_24_0x4d, 20, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x4e[45] = {
+    0xf0, 0xf0, 0x62, 0x92, 0x43, 0x82, 0x44, 0x72, 0x45, 0x62, 0x42, 0x12,
+    0x62, 0x42, 0x22, 0x52, 0x42, 0x23, 0x42, 0x42, 0x33, 0x32, 0x42, 0x42,
+    0x32, 0x42, 0x52, 0x22, 0x42, 0x53, 0x12, 0x42, 0x62, 0x12, 0x42, 0x74,
+    0x42, 0x83, 0x42, 0x83, 0x42, 0x92, 0x42, 0xa1, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x4e = { image_data_twr_font_ubuntu_24_0x4e,
-    17, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x4f[72] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xfc, 0x0f, 0xc0,
-    0xf0, 0x03, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xcf, 0xfc, 0xc0,
-    0x8f, 0xfc, 0x40,
-    0x9f, 0xfe, 0x40,
-    0x9f, 0xfe, 0x40,
-    0x9f, 0xfe, 0x40,
-    0x9f, 0xfe, 0x40,
-    0x9f, 0xfe, 0x40,
-    0x8f, 0xfc, 0x40,
-    0xcf, 0xfc, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xf0, 0x03, 0xc0,
-    0xfc, 0x0f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_24_0x4e = { image_data_twr_font_ubuntu_24_0x4e, 17, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x4f[33] = {
+    0xf0, 0xf0, 0xc6, 0xaa, 0x73, 0x63, 0x53, 0x83, 0x42, 0xa2, 0x33, 0xa3,
+    0x22, 0xc2, 0x22, 0xc2, 0x22, 0xc2, 0x22, 0xc2, 0x22, 0xc2, 0x23, 0xa3,
+    0x32, 0xa2, 0x43, 0x83, 0x53, 0x63, 0x7a, 0xa6, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x4f = { image_data_twr_font_ubuntu_24_0x4f,
-    18, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x50[48] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xc0, 0x3e,
-    0xc0, 0x0e,
-    0xcf, 0xc6,
-    0xcf, 0xe2,
-    0xcf, 0xf2,
-    0xcf, 0xf2,
-    0xcf, 0xf2,
-    0xcf, 0xe2,
-    0xcf, 0xc6,
-    0xc0, 0x0e,
-    0xc0, 0x3e,
-    0xcf, 0xfe,
-    0xcf, 0xfe,
-    0xcf, 0xfe,
-    0xcf, 0xfe,
-    0xcf, 0xfe,
-    0xcf, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_24_0x4f = { image_data_twr_font_ubuntu_24_0x4f, 18, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x50[27] = {
+    0xf0, 0xf0, 0x28, 0x7a, 0x52, 0x63, 0x42, 0x73, 0x32, 0x82, 0x32, 0x82,
+    0x32, 0x82, 0x32, 0x73, 0x32, 0x63, 0x4a, 0x58, 0x72, 0xd2, 0xd2, 0xd2,
+    0xd2, 0xd2, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x50 = { image_data_twr_font_ubuntu_24_0x50,
-    15, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x51[72] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xfc, 0x07, 0xe0,
-    0xf0, 0x01, 0xe0,
-    0xe1, 0xf0, 0xe0,
-    0xc7, 0xfc, 0x60,
-    0xcf, 0xfe, 0x60,
-    0x8f, 0xfe, 0x20,
-    0x9f, 0xff, 0x20,
-    0x9f, 0xff, 0x20,
-    0x9f, 0xff, 0x20,
-    0x9f, 0xff, 0x20,
-    0x9f, 0xff, 0x20,
-    0x8f, 0xfe, 0x20,
-    0xcf, 0xfe, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xe1, 0xf0, 0xe0,
-    0xf0, 0x03, 0xe0,
-    0xfc, 0x0f, 0xe0,
-    0xff, 0x9f, 0xe0,
-    0xff, 0xc7, 0xe0,
-    0xff, 0xe0, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_24_0x50 = { image_data_twr_font_ubuntu_24_0x50, 15, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x51[41] = {
+    0xf0, 0xf0, 0xe7, 0xab, 0x74, 0x54, 0x53, 0x93, 0x42, 0xb2, 0x33, 0xb3,
+    0x22, 0xd2, 0x22, 0xd2, 0x22, 0xd2, 0x22, 0xd2, 0x22, 0xd2, 0x23, 0xb3,
+    0x32, 0xb2, 0x43, 0x93, 0x54, 0x54, 0x7a, 0xb6, 0xf0, 0x12, 0xf0, 0x33,
+    0xf0, 0x25, 0xf0, 0x13, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x51 = { image_data_twr_font_ubuntu_24_0x51,
-    19, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x52[48] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xc0, 0x3e,
-    0xc0, 0x0e,
-    0xcf, 0xc6,
-    0xcf, 0xf2,
-    0xcf, 0xf2,
-    0xcf, 0xf2,
-    0xcf, 0xf2,
-    0xcf, 0xc6,
-    0xc0, 0x0e,
-    0xc0, 0x1e,
-    0xcf, 0x9e,
-    0xcf, 0xce,
-    0xcf, 0xc6,
-    0xcf, 0xe6,
-    0xcf, 0xf2,
-    0xcf, 0xf0,
-    0xcf, 0xf8,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_24_0x51 = { image_data_twr_font_ubuntu_24_0x51, 19, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x52[33] = {
+    0xf0, 0xf0, 0x28, 0x7a, 0x52, 0x63, 0x42, 0x82, 0x32, 0x82, 0x32, 0x82,
+    0x32, 0x82, 0x32, 0x63, 0x4a, 0x59, 0x62, 0x52, 0x62, 0x62, 0x52, 0x63,
+    0x42, 0x72, 0x42, 0x82, 0x32, 0x83, 0x22, 0x92, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x52 = { image_data_twr_font_ubuntu_24_0x52,
-    15, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x53[48] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xf0, 0x38,
-    0xc0, 0x18,
-    0x8f, 0xb8,
-    0x9f, 0xf8,
-    0x9f, 0xf8,
-    0x8f, 0xf8,
-    0xc3, 0xf8,
-    0xe1, 0xf8,
-    0xf8, 0x78,
-    0xfe, 0x18,
-    0xff, 0x88,
-    0xff, 0xc8,
-    0xff, 0xc8,
-    0xff, 0xc8,
-    0x9f, 0x88,
-    0x80, 0x18,
-    0xe0, 0x78,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_24_0x52 = { image_data_twr_font_ubuntu_24_0x52, 15, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x53[21] = {
+    0xf0, 0xf6, 0x59, 0x33, 0x51, 0x42, 0xb2, 0xb3, 0xb4, 0xa4, 0xb4, 0xb4,
+    0xb3, 0xb2, 0xb2, 0xb2, 0x22, 0x63, 0x2a, 0x56, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x53 = { image_data_twr_font_ubuntu_24_0x53,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x54[48] = {
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0x00, 0x00,
-    0x00, 0x00,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
+static const twr_font_image_t twr_font_ubuntu_24_0x53 = { image_data_twr_font_ubuntu_24_0x53, 13, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x54[19] = {
+    0xf0, 0x9f, 0x09, 0x52, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2,
+    0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x54 = { image_data_twr_font_ubuntu_24_0x54,
-    12, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x55[72] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xe7, 0xf3, 0x80,
-    0xe3, 0xe3, 0x80,
-    0xf0, 0x07, 0x80,
-    0xfc, 0x1f, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_24_0x54 = { image_data_twr_font_ubuntu_24_0x54, 12, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x55[35] = {
+    0xf0, 0xf0, 0x62, 0x92, 0x42, 0x92, 0x42, 0x92, 0x42, 0x92, 0x42, 0x92,
+    0x42, 0x92, 0x42, 0x92, 0x42, 0x92, 0x42, 0x92, 0x42, 0x92, 0x42, 0x92,
+    0x42, 0x92, 0x42, 0x92, 0x52, 0x72, 0x63, 0x53, 0x79, 0xa5, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x55 = { image_data_twr_font_ubuntu_24_0x55,
-    17, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x56[48] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0x3f, 0xfc,
-    0x9f, 0xf9,
-    0x9f, 0xf9,
-    0x9f, 0xf9,
-    0xcf, 0xf3,
-    0xcf, 0xf3,
-    0xc7, 0xe3,
-    0xe7, 0xe7,
-    0xe7, 0xe7,
-    0xf3, 0xcf,
-    0xf3, 0xcf,
-    0xf9, 0x9f,
-    0xf9, 0x9f,
-    0xf8, 0x1f,
-    0xfc, 0x3f,
-    0xfc, 0x3f,
-    0xfe, 0x7f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_24_0x55 = { image_data_twr_font_ubuntu_24_0x55, 17, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x56[33] = {
+    0xf0, 0xf0, 0x22, 0xc2, 0x12, 0xa2, 0x22, 0xa2, 0x22, 0xa2, 0x32, 0x82,
+    0x42, 0x82, 0x43, 0x63, 0x52, 0x62, 0x62, 0x62, 0x72, 0x42, 0x82, 0x42,
+    0x92, 0x22, 0xa2, 0x22, 0xa6, 0xb4, 0xc4, 0xd2, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x56 = { image_data_twr_font_ubuntu_24_0x56,
-    16, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x57[72] = {
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0x9f, 0xff, 0xf2,
-    0x9f, 0xff, 0xf2,
-    0x8f, 0xe7, 0xe2,
-    0xcf, 0xc7, 0xe6,
-    0xcf, 0xc7, 0xe6,
-    0xcf, 0xd7, 0xe6,
-    0xcf, 0x93, 0xe6,
-    0xe7, 0x93, 0xce,
-    0xe7, 0x91, 0xce,
-    0xe7, 0x39, 0xce,
-    0xe7, 0x39, 0xce,
-    0xe2, 0x38, 0x8e,
-    0xf2, 0x7c, 0x9e,
-    0xf2, 0x7c, 0x9e,
-    0xf0, 0xfc, 0x1e,
-    0xf8, 0xfe, 0x3e,
-    0xf8, 0xfe, 0x3e,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_24_0x56 = { image_data_twr_font_ubuntu_24_0x56, 16, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x57[61] = {
+    0xf0, 0xf0, 0xf0, 0x22, 0xf0, 0x22, 0x22, 0xf0, 0x22, 0x23, 0x72, 0x63,
+    0x32, 0x63, 0x62, 0x42, 0x63, 0x62, 0x42, 0x61, 0x11, 0x62, 0x42, 0x52,
+    0x12, 0x52, 0x52, 0x42, 0x12, 0x42, 0x62, 0x42, 0x13, 0x32, 0x62, 0x32,
+    0x32, 0x32, 0x62, 0x32, 0x32, 0x32, 0x63, 0x13, 0x33, 0x13, 0x72, 0x12,
+    0x52, 0x12, 0x82, 0x12, 0x52, 0x12, 0x84, 0x65, 0x93, 0x73, 0xa3, 0x73,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x57 = { image_data_twr_font_ubuntu_24_0x57,
-    23, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x58[48] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0x8f, 0xf0,
-    0xcf, 0xf2,
-    0xe7, 0xe6,
-    0xe3, 0xc6,
-    0xf3, 0xce,
-    0xf9, 0x9e,
-    0xfc, 0x1e,
-    0xfc, 0x3e,
-    0xfe, 0x7e,
-    0xfc, 0x3e,
-    0xf8, 0x1e,
-    0xf9, 0x9e,
-    0xf3, 0xce,
-    0xe3, 0xc6,
-    0xe7, 0xe6,
-    0xcf, 0xf2,
-    0x8f, 0xf0,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_24_0x57 = { image_data_twr_font_ubuntu_24_0x57, 23, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x58[32] = {
+    0xf0, 0xf0, 0x13, 0x83, 0x22, 0x82, 0x42, 0x62, 0x53, 0x43, 0x62, 0x42,
+    0x82, 0x22, 0xa5, 0xa4, 0xc2, 0xc4, 0xa6, 0x92, 0x22, 0x82, 0x42, 0x63,
+    0x43, 0x52, 0x62, 0x42, 0x82, 0x23, 0x83, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x58 = { image_data_twr_font_ubuntu_24_0x58,
-    15, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x59[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0x3f, 0xf0,
-    0x9f, 0xe4,
-    0x8f, 0xc4,
-    0xcf, 0xcc,
-    0xe7, 0x9c,
-    0xe7, 0x9c,
-    0xf3, 0x3c,
-    0xf0, 0x3c,
-    0xf8, 0x7c,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x58 = { image_data_twr_font_ubuntu_24_0x58, 15, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x59[26] = {
+    0xf0, 0xd2, 0xa2, 0x12, 0x82, 0x23, 0x63, 0x32, 0x62, 0x52, 0x42, 0x62,
+    0x42, 0x72, 0x22, 0x86, 0x94, 0xb2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2,
+    0xc2, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x59 = { image_data_twr_font_ubuntu_24_0x59,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x5a[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0x80, 0x04,
-    0x80, 0x04,
-    0xff, 0xc4,
-    0xff, 0xcc,
-    0xff, 0x9c,
-    0xff, 0x3c,
-    0xfe, 0x7c,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xf9, 0xfc,
-    0xf3, 0xfc,
-    0xe3, 0xfc,
-    0xe7, 0xfc,
-    0xcf, 0xfc,
-    0x8f, 0xfc,
-    0x80, 0x04,
-    0x80, 0x04,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x59 = { image_data_twr_font_ubuntu_24_0x59, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x5a[19] = {
+    0xf0, 0xec, 0x2c, 0xb3, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xc2, 0xb2, 0xb2,
+    0xb3, 0xb2, 0xb2, 0xb3, 0xbc, 0x2c, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x5a = { image_data_twr_font_ubuntu_24_0x5a,
-    14, 24/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_24_0x5a = { image_data_twr_font_ubuntu_24_0x5a, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_24_0x5b[24] = {
-    0xc0,
-    0xc0,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xc0,
-    0xc0,
-    0xff
+    0xc0, 0xc0, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf,
+    0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xc0, 0xc0, 0xff
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x5b = { image_data_twr_font_ubuntu_24_0x5b,
-    8, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x5c[48] = {
-    0x7f, 0xc0,
-    0x3f, 0xc0,
-    0x3f, 0xc0,
-    0x3f, 0xc0,
-    0x9f, 0xc0,
-    0x9f, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xe7, 0xc0,
-    0xe7, 0xc0,
-    0xe3, 0xc0,
-    0xf3, 0xc0,
-    0xf3, 0xc0,
-    0xf9, 0xc0,
-    0xf9, 0xc0,
-    0xf9, 0xc0,
-    0xfc, 0xc0,
-    0xfc, 0xc0,
-    0xfe, 0x40,
-    0xfe, 0x40,
-    0xfe, 0x40,
-    0xff, 0x00,
-    0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_24_0x5b = { image_data_twr_font_ubuntu_24_0x5b, 8, 24, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x5c[24] = {
+    0x01, 0x92, 0x82, 0x82, 0x92, 0x82, 0x92, 0x82, 0x82, 0x92, 0x82, 0x83,
+    0x82, 0x82, 0x92, 0x82, 0x82, 0x92, 0x82, 0x92, 0x82, 0x82, 0x92, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x5c = { image_data_twr_font_ubuntu_24_0x5c,
-    10, 24/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_24_0x5c = { image_data_twr_font_ubuntu_24_0x5c, 10, 24, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_24_0x5d[24] = {
-    0x03,
-    0x03,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0x03,
-    0x03,
-    0xff
+    0x03, 0x03, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
+    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x03, 0x03, 0xff
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x5d = { image_data_twr_font_ubuntu_24_0x5d,
-    8, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x5e[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xfd, 0xfc,
-    0xf8, 0xfc,
-    0xf2, 0x7c,
-    0xf2, 0x7c,
-    0xe7, 0x3c,
-    0xe7, 0x3c,
-    0xcf, 0x9c,
-    0x8f, 0x8c,
-    0xdf, 0xdc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x5d = { image_data_twr_font_ubuntu_24_0x5d, 8, 24, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x5e[19] = {
+    0xf0, 0xf0, 0x41, 0xc3, 0xa2, 0x12, 0x92, 0x12, 0x82, 0x32, 0x72, 0x32,
+    0x62, 0x52, 0x43, 0x53, 0x41, 0x71, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x5e = { image_data_twr_font_ubuntu_24_0x5e,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x5f[48] = {
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0x00, 0x00,
-    0x00, 0x00,
-    0xff, 0xf0
+static const twr_font_image_t twr_font_ubuntu_24_0x5e = { image_data_twr_font_ubuntu_24_0x5e, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x5f[19] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0, 0xf0, 0xcf, 0x09, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x5f = { image_data_twr_font_ubuntu_24_0x5f,
-    12, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x60[48] = {
-    0xdf, 0x80,
-    0x8f, 0x80,
-    0xc7, 0x80,
-    0xe3, 0x80,
-    0xf7, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_24_0x5f = { image_data_twr_font_ubuntu_24_0x5f, 12, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x60[6] = {
+    0x21, 0x73, 0x73, 0x73, 0x71, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x60 = { image_data_twr_font_ubuntu_24_0x60,
-    9, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x61[48] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xc0, 0x78,
-    0xc0, 0x38,
-    0xff, 0x18,
-    0xff, 0x98,
-    0xff, 0x98,
-    0xe0, 0x18,
-    0xc0, 0x18,
-    0x8f, 0x98,
-    0x9f, 0x98,
-    0x9f, 0x98,
-    0x8f, 0x98,
-    0xc0, 0x18,
-    0xe0, 0x18,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_24_0x60 = { image_data_twr_font_ubuntu_24_0x60, 9, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x61[23] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x57, 0x68, 0xb3, 0xb2, 0xb2, 0x58, 0x49,
+    0x33, 0x52, 0x32, 0x62, 0x32, 0x62, 0x33, 0x52, 0x49, 0x58, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x61 = { image_data_twr_font_ubuntu_24_0x61,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x62[48] = {
-    0xff, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xc8, 0x3c,
-    0xc0, 0x1c,
-    0xc7, 0x8c,
-    0xcf, 0xcc,
-    0xcf, 0xe4,
-    0xcf, 0xe4,
-    0xcf, 0xe4,
-    0xcf, 0xe4,
-    0xcf, 0xe4,
-    0xcf, 0xcc,
-    0xcf, 0x8c,
-    0xc0, 0x1c,
-    0xe0, 0x7c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x61 = { image_data_twr_font_ubuntu_24_0x61, 13, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x62[30] = {
+    0xf0, 0x12, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0x15, 0x69, 0x53, 0x43, 0x42,
+    0x62, 0x42, 0x72, 0x32, 0x72, 0x32, 0x72, 0x32, 0x72, 0x32, 0x72, 0x32,
+    0x62, 0x42, 0x53, 0x49, 0x66, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x62 = { image_data_twr_font_ubuntu_24_0x62,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x63[48] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xf8, 0x00,
-    0xe0, 0x00,
-    0xc7, 0xe0,
-    0xcf, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0xcf, 0xe0,
-    0xc7, 0xe0,
-    0xe0, 0x00,
-    0xf8, 0x00,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_24_0x62 = { image_data_twr_font_ubuntu_24_0x62, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x63[18] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xb6, 0x38, 0x23, 0x82, 0x82, 0x92, 0x92, 0x92,
+    0x92, 0xa2, 0x93, 0x98, 0x56, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x63 = { image_data_twr_font_ubuntu_24_0x63,
-    11, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x64[48] = {
-    0xff, 0xfc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xf0, 0x4c,
-    0xe0, 0x0c,
-    0xc7, 0x8c,
-    0xcf, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0xcf, 0xcc,
-    0xc7, 0xcc,
-    0xe0, 0x0c,
-    0xf8, 0x1c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x63 = { image_data_twr_font_ubuntu_24_0x63, 11, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x64[30] = {
+    0xf0, 0x92, 0xc2, 0xc2, 0xc2, 0xc2, 0x65, 0x12, 0x59, 0x43, 0x43, 0x42,
+    0x62, 0x32, 0x72, 0x32, 0x72, 0x32, 0x72, 0x32, 0x72, 0x32, 0x72, 0x42,
+    0x62, 0x43, 0x52, 0x59, 0x76, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x64 = { image_data_twr_font_ubuntu_24_0x64,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x65[48] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xf0, 0x78,
-    0xe0, 0x18,
-    0xc7, 0x98,
-    0xcf, 0xc8,
-    0x9f, 0xc8,
-    0x80, 0x08,
-    0x80, 0x08,
-    0x9f, 0xf8,
-    0x9f, 0xf8,
-    0xcf, 0xf8,
-    0xc7, 0xd8,
-    0xe0, 0x18,
-    0xf0, 0x18,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_24_0x64 = { image_data_twr_font_ubuntu_24_0x64, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x65[23] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x75, 0x78, 0x43, 0x42, 0x42, 0x62, 0x22,
+    0x72, 0x2b, 0x2b, 0x22, 0xb2, 0xc2, 0xb3, 0x51, 0x58, 0x67, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x65 = { image_data_twr_font_ubuntu_24_0x65,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x66[48] = {
-    0xff, 0x80,
-    0xf0, 0x00,
-    0xe0, 0x00,
-    0xc7, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xc0, 0x80,
-    0xc0, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_24_0x65 = { image_data_twr_font_ubuntu_24_0x65, 13, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x66[19] = {
+    0xd5, 0x36, 0x23, 0x62, 0x72, 0x76, 0x36, 0x32, 0x72, 0x72, 0x72, 0x72,
+    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x66 = { image_data_twr_font_ubuntu_24_0x66,
-    9, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x67[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xf8, 0x1c,
-    0xe0, 0x0c,
-    0xc7, 0xcc,
-    0xcf, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0x8f, 0xcc,
-    0xc7, 0x8c,
-    0xe0, 0x0c,
-    0xf0, 0x4c,
-    0xff, 0xcc,
-    0xdf, 0x9c,
-    0xc0, 0x1c,
-    0xc0, 0x7c,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x66 = { image_data_twr_font_ubuntu_24_0x66, 9, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x67[34] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe6, 0x69, 0x43, 0x52, 0x42, 0x62, 0x32,
+    0x72, 0x32, 0x72, 0x32, 0x72, 0x32, 0x72, 0x32, 0x72, 0x33, 0x62, 0x43,
+    0x43, 0x59, 0x65, 0x12, 0xc2, 0x41, 0x62, 0x59, 0x57, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x67 = { image_data_twr_font_ubuntu_24_0x67,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x68[48] = {
-    0xff, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xc0, 0x7c,
-    0xc0, 0x1c,
-    0xcf, 0x9c,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x67 = { image_data_twr_font_ubuntu_24_0x67, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x68[31] = {
+    0xf0, 0x12, 0xc2, 0xc2, 0xc2, 0xc2, 0xc7, 0x79, 0x52, 0x52, 0x52, 0x62,
+    0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62,
+    0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x68 = { image_data_twr_font_ubuntu_24_0x68,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x69[24] = {
-    0xfc,
-    0xcc,
-    0xcc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x68 = { image_data_twr_font_ubuntu_24_0x68, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x69[17] = {
+    0x82, 0x42, 0xf0, 0x72, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x69 = { image_data_twr_font_ubuntu_24_0x69,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x6a[24] = {
-    0xfc,
-    0xcc,
-    0xcc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0x8c,
-    0x1c,
-    0x3c,
-    0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x69 = { image_data_twr_font_ubuntu_24_0x69, 6, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x6a[21] = {
+    0x82, 0x42, 0xf0, 0x72, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x33, 0x23, 0x32, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x6a = { image_data_twr_font_ubuntu_24_0x6a,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x6b[48] = {
-    0xff, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xc8,
-    0xcf, 0x98,
-    0xce, 0x38,
-    0xcc, 0x78,
-    0xc9, 0xf8,
-    0xc3, 0xf8,
-    0xc1, 0xf8,
-    0xc8, 0x78,
-    0xce, 0x78,
-    0xcf, 0x38,
-    0xcf, 0x98,
-    0xcf, 0xc8,
-    0xcf, 0xe0,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_24_0x6a = { image_data_twr_font_ubuntu_24_0x6a, 6, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x6b[30] = {
+    0xf2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0x62, 0x32, 0x52, 0x42, 0x33, 0x52,
+    0x23, 0x62, 0x12, 0x84, 0x95, 0x82, 0x14, 0x62, 0x32, 0x62, 0x42, 0x52,
+    0x52, 0x42, 0x62, 0x32, 0x72, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x6b = { image_data_twr_font_ubuntu_24_0x6b,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x6c[24] = {
-    0xfe,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xc2,
-    0xe2,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
+static const twr_font_image_t twr_font_ubuntu_24_0x6b = { image_data_twr_font_ubuntu_24_0x6b, 13, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x6c[19] = {
+    0x92, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+    0x52, 0x52, 0x52, 0x52, 0x54, 0x43, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x6c = { image_data_twr_font_ubuntu_24_0x6c,
-    7, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x6d[72] = {
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xe0, 0x30, 0x3c,
-    0xc0, 0x00, 0x1c,
-    0xcf, 0x8f, 0x8c,
-    0xcf, 0xcf, 0xcc,
-    0xcf, 0xcf, 0xcc,
-    0xcf, 0xcf, 0xcc,
-    0xcf, 0xcf, 0xcc,
-    0xcf, 0xcf, 0xcc,
-    0xcf, 0xcf, 0xcc,
-    0xcf, 0xcf, 0xcc,
-    0xcf, 0xcf, 0xcc,
-    0xcf, 0xcf, 0xcc,
-    0xcf, 0xcf, 0xcc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x6c = { image_data_twr_font_ubuntu_24_0x6c, 7, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x6d[46] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf7, 0x26, 0x6f, 0x02,
+    0x52, 0x53, 0x53, 0x42, 0x62, 0x62, 0x42, 0x62, 0x62, 0x42, 0x62, 0x62,
+    0x42, 0x62, 0x62, 0x42, 0x62, 0x62, 0x42, 0x62, 0x62, 0x42, 0x62, 0x62,
+    0x42, 0x62, 0x62, 0x42, 0x62, 0x62, 0x42, 0x62, 0x62, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x6d = { image_data_twr_font_ubuntu_24_0x6d,
-    22, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x6e[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xe0, 0x3c,
-    0xc0, 0x1c,
-    0xcf, 0x9c,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x6d = { image_data_twr_font_ubuntu_24_0x6d, 22, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x6e[30] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xc7, 0x69, 0x52, 0x52, 0x52, 0x62, 0x42,
+    0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42,
+    0x62, 0x42, 0x62, 0x42, 0x62, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x6e = { image_data_twr_font_ubuntu_24_0x6e,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x6f[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xf0, 0x3c,
-    0xe0, 0x1c,
-    0xc7, 0x8c,
-    0xcf, 0xcc,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0xcf, 0xcc,
-    0xc7, 0x8c,
-    0xe0, 0x1c,
-    0xf8, 0x7c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x6e = { image_data_twr_font_ubuntu_24_0x6e, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x6f[28] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xd6, 0x78, 0x53, 0x43, 0x42, 0x62, 0x32,
+    0x82, 0x22, 0x82, 0x22, 0x82, 0x22, 0x82, 0x22, 0x82, 0x32, 0x62, 0x43,
+    0x43, 0x58, 0x84, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x6f = { image_data_twr_font_ubuntu_24_0x6f,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x70[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xe0, 0x7c,
-    0xc0, 0x1c,
-    0xcf, 0x8c,
-    0xcf, 0xcc,
-    0xcf, 0xe4,
-    0xcf, 0xe4,
-    0xcf, 0xe4,
-    0xcf, 0xe4,
-    0xcf, 0xe4,
-    0xcf, 0xcc,
-    0xc7, 0x8c,
-    0xc0, 0x1c,
-    0xc8, 0x3c,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x6f = { image_data_twr_font_ubuntu_24_0x6f, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x70[33] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xc6, 0x79, 0x52, 0x53, 0x42, 0x62, 0x42,
+    0x72, 0x32, 0x72, 0x32, 0x72, 0x32, 0x72, 0x32, 0x72, 0x32, 0x62, 0x43,
+    0x43, 0x49, 0x52, 0x15, 0x62, 0xc2, 0xc2, 0xc2, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x70 = { image_data_twr_font_ubuntu_24_0x70,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x71[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xf8, 0x1c,
-    0xe0, 0x0c,
-    0xc7, 0xcc,
-    0xcf, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0xcf, 0xcc,
-    0xc7, 0x8c,
-    0xe0, 0x0c,
-    0xf0, 0x4c,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x70 = { image_data_twr_font_ubuntu_24_0x70, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x71[33] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe6, 0x69, 0x43, 0x52, 0x42, 0x62, 0x32,
+    0x72, 0x32, 0x72, 0x32, 0x72, 0x32, 0x72, 0x32, 0x72, 0x42, 0x62, 0x43,
+    0x43, 0x59, 0x65, 0x12, 0xc2, 0xc2, 0xc2, 0xc2, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x71 = { image_data_twr_font_ubuntu_24_0x71,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x72[48] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe0, 0x00,
-    0xc0, 0x00,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_24_0x71 = { image_data_twr_font_ubuntu_24_0x71, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x72[17] = {
+    0xf0, 0xf0, 0xf0, 0xc6, 0x27, 0x22, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+    0x72, 0x72, 0x72, 0x72, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x72 = { image_data_twr_font_ubuntu_24_0x72,
-    9, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x73[48] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xe0, 0x60,
-    0xc0, 0x60,
-    0x9f, 0x60,
-    0x9f, 0xe0,
-    0x8f, 0xe0,
-    0xc3, 0xe0,
-    0xe0, 0xe0,
-    0xf8, 0x20,
-    0xff, 0x20,
-    0xff, 0x20,
-    0xbf, 0x20,
-    0x80, 0x60,
-    0xc0, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_24_0x72 = { image_data_twr_font_ubuntu_24_0x72, 9, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x73[20] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0x96, 0x47, 0x32, 0x51, 0x32, 0x93, 0x94, 0x85,
+    0x85, 0x92, 0x92, 0x21, 0x62, 0x28, 0x46, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x73 = { image_data_twr_font_ubuntu_24_0x73,
-    11, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x74[48] = {
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xc0, 0x40,
-    0xc0, 0x40,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xc7, 0x40,
-    0xe0, 0x40,
-    0xf0, 0x40,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_24_0x73 = { image_data_twr_font_ubuntu_24_0x73, 11, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x74[20] = {
+    0xf0, 0x72, 0x82, 0x82, 0x82, 0x87, 0x37, 0x32, 0x82, 0x82, 0x82, 0x82,
+    0x82, 0x82, 0x82, 0x83, 0x31, 0x46, 0x55, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x74 = { image_data_twr_font_ubuntu_24_0x74,
-    10, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x75[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xe7, 0xcc,
-    0xe0, 0x0c,
-    0xf8, 0x1c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x74 = { image_data_twr_font_ubuntu_24_0x74, 10, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x75[30] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xb2, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42,
+    0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42,
+    0x62, 0x52, 0x52, 0x59, 0x76, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x75 = { image_data_twr_font_ubuntu_24_0x75,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x76[48] = {
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0x3f, 0xc0,
-    0x1f, 0x80,
-    0x9f, 0x90,
-    0x9f, 0x90,
-    0x8f, 0x10,
-    0xcf, 0x30,
-    0xcf, 0x30,
-    0xe6, 0x70,
-    0xe6, 0x70,
-    0xe0, 0x70,
-    0xf0, 0xf0,
-    0xf0, 0xf0,
-    0xf9, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
+static const twr_font_image_t twr_font_ubuntu_24_0x75 = { image_data_twr_font_ubuntu_24_0x75, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x76[26] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xc2, 0x85, 0x63, 0x12, 0x62, 0x22, 0x62, 0x23,
+    0x43, 0x32, 0x42, 0x42, 0x42, 0x52, 0x22, 0x62, 0x22, 0x66, 0x74, 0x84,
+    0x92, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x76 = { image_data_twr_font_ubuntu_24_0x76,
-    12, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x77[72] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0x3f, 0xbf, 0x80,
-    0x3f, 0x1f, 0x80,
-    0x9f, 0x1f, 0x20,
-    0x9f, 0x1f, 0x20,
-    0x9e, 0x4f, 0x20,
-    0xce, 0x4e, 0x60,
-    0xce, 0x4e, 0x60,
-    0xce, 0x46, 0x60,
-    0xe4, 0xe4, 0xe0,
-    0xe4, 0xe4, 0xe0,
-    0xe0, 0xe0, 0xe0,
-    0xf1, 0xf1, 0xe0,
-    0xf1, 0xf1, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_24_0x76 = { image_data_twr_font_ubuntu_24_0x76, 12, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x77[49] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x92, 0x71, 0x74, 0x63, 0x62,
+    0x12, 0x53, 0x52, 0x22, 0x53, 0x52, 0x22, 0x42, 0x12, 0x42, 0x32, 0x32,
+    0x12, 0x32, 0x42, 0x32, 0x12, 0x32, 0x42, 0x32, 0x13, 0x22, 0x52, 0x12,
+    0x32, 0x12, 0x62, 0x12, 0x32, 0x12, 0x65, 0x35, 0x73, 0x53, 0x83, 0x53,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x77 = { image_data_twr_font_ubuntu_24_0x77,
-    19, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x78[48] = {
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0x1f, 0x80,
-    0x9f, 0x90,
-    0xcf, 0x30,
-    0xe6, 0x70,
-    0xe0, 0x70,
-    0xf0, 0xf0,
-    0xf9, 0xf0,
-    0xf0, 0xf0,
-    0xe0, 0x70,
-    0xc6, 0x30,
-    0xcf, 0x30,
-    0x9f, 0x90,
-    0x1f, 0x80,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
+static const twr_font_image_t twr_font_ubuntu_24_0x77 = { image_data_twr_font_ubuntu_24_0x77, 19, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x78[26] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xc3, 0x63, 0x12, 0x62, 0x32, 0x42, 0x52, 0x22,
+    0x66, 0x74, 0x92, 0x94, 0x76, 0x53, 0x23, 0x42, 0x42, 0x32, 0x62, 0x13,
+    0x63, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x78 = { image_data_twr_font_ubuntu_24_0x78,
-    12, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x79[48] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0x3f, 0x80,
-    0x1f, 0x20,
-    0x9f, 0x20,
-    0x9f, 0x20,
-    0xce, 0x60,
-    0xce, 0x60,
-    0xce, 0x60,
-    0xe4, 0xe0,
-    0xe4, 0xe0,
-    0xe4, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf3, 0xe0,
-    0xe3, 0xe0,
-    0x07, 0xe0,
-    0x0f, 0xe0,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_24_0x78 = { image_data_twr_font_ubuntu_24_0x78, 12, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x79[31] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0x62, 0x75, 0x52, 0x22, 0x52, 0x22, 0x52, 0x32,
+    0x32, 0x42, 0x32, 0x42, 0x32, 0x52, 0x12, 0x62, 0x12, 0x62, 0x12, 0x73,
+    0x83, 0x83, 0x82, 0x83, 0x55, 0x64, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x79 = { image_data_twr_font_ubuntu_24_0x79,
-    11, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x7a[48] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0x80, 0x20,
-    0x80, 0x20,
-    0xfe, 0x20,
-    0xfc, 0x60,
-    0xfc, 0xe0,
-    0xf9, 0xe0,
-    0xf3, 0xe0,
-    0xe3, 0xe0,
-    0xe7, 0xe0,
-    0xcf, 0xe0,
-    0x8f, 0xe0,
-    0x80, 0x20,
-    0x80, 0x20,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_24_0x79 = { image_data_twr_font_ubuntu_24_0x79, 11, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x7a[18] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0x79, 0x29, 0x83, 0x73, 0x82, 0x82, 0x82, 0x83,
+    0x82, 0x82, 0x83, 0x89, 0x29, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x7a = { image_data_twr_font_ubuntu_24_0x7a,
-    11, 24/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_24_0x7a = { image_data_twr_font_ubuntu_24_0x7a, 11, 24, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_24_0x7b[24] = {
-    0xf8,
-    0xf0,
-    0xe3,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xcf,
-    0x9f,
-    0x8f,
-    0xc7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe3,
-    0xf0,
-    0xf8,
-    0xff
+    0xf8, 0xf0, 0xe3, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xcf, 0x9f,
+    0x8f, 0xc7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe3, 0xf0, 0xf8, 0xff
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x7b = { image_data_twr_font_ubuntu_24_0x7b,
-    8, 24/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_24_0x7b = { image_data_twr_font_ubuntu_24_0x7b, 8, 24, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_24_0x7c[24] = {
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xfe
+    0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce,
+    0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xfe
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x7c = { image_data_twr_font_ubuntu_24_0x7c,
-    7, 24/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_24_0x7c = { image_data_twr_font_ubuntu_24_0x7c, 7, 24, TWR_FONT_IMAGE_FORMAT_RAW };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_24_0x7d[24] = {
-    0x1f,
-    0x0f,
-    0xc7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xf3,
-    0xf9,
-    0xf1,
-    0xe3,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xc7,
-    0x0f,
-    0x1f,
-    0xff
+    0x1f, 0x0f, 0xc7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xf3, 0xf9,
+    0xf1, 0xe3, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xc7, 0x0f, 0x1f, 0xff
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x7d = { image_data_twr_font_ubuntu_24_0x7d,
-    8, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x7e[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xe3, 0xcc,
-    0xc1, 0x8c,
-    0x8c, 0x1c,
-    0x9e, 0x3c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0x7d = { image_data_twr_font_ubuntu_24_0x7d, 8, 24, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0x7e[18] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x83, 0x42, 0x45,
+    0x23, 0x33, 0x25, 0x42, 0x43, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0x7e = { image_data_twr_font_ubuntu_24_0x7e,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xb0[24] = {
-    0xe3,
-    0xc1,
-    0x9c,
-    0x9c,
-    0x9c,
-    0xc1,
-    0xe3,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff
+static const twr_font_image_t twr_font_ubuntu_24_0x7e = { image_data_twr_font_ubuntu_24_0x7e, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0xb0[11] = {
+    0x33, 0x45, 0x22, 0x32, 0x12, 0x32, 0x12, 0x32, 0x25, 0x43, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0xb0 = { image_data_twr_font_ubuntu_24_0xb0,
-    8, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xb9[48] = {
-    0xff, 0xe0,
-    0xce, 0x60,
-    0xe4, 0xe0,
-    0xf1, 0xe0,
-    0xfb, 0xe0,
-    0xff, 0xe0,
-    0xe0, 0x60,
-    0xc0, 0x60,
-    0x9f, 0x60,
-    0x9f, 0xe0,
-    0x8f, 0xe0,
-    0xc3, 0xe0,
-    0xe0, 0xe0,
-    0xf8, 0x20,
-    0xff, 0x20,
-    0xff, 0x20,
-    0xbf, 0x20,
-    0x80, 0x60,
-    0xc0, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_24_0xb0 = { image_data_twr_font_ubuntu_24_0xb0, 8, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0xb9[23] = {
+    0xd2, 0x32, 0x52, 0x12, 0x73, 0x91, 0xf0, 0x46, 0x47, 0x32, 0x51, 0x32,
+    0x93, 0x94, 0x85, 0x85, 0x92, 0x92, 0x21, 0x62, 0x28, 0x46, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0xb9 = { image_data_twr_font_ubuntu_24_0xb9,
-    11, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xbb[48] = {
-    0xf9, 0xc0,
-    0xf9, 0xc0,
-    0xc9, 0xc0,
-    0xc9, 0xc0,
-    0xcb, 0xc0,
-    0xcf, 0xc0,
-    0xc0, 0x40,
-    0xc0, 0x40,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xc7, 0x40,
-    0xe0, 0x40,
-    0xf0, 0x40,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_24_0xb9 = { image_data_twr_font_ubuntu_24_0xb9, 11, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0xbb[24] = {
+    0x52, 0x82, 0x52, 0x12, 0x52, 0x12, 0x52, 0x11, 0x62, 0x87, 0x37, 0x32,
+    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x31, 0x46, 0x55, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0xbb = { image_data_twr_font_ubuntu_24_0xbb,
-    10, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xbe[48] = {
-    0xff, 0xe0,
-    0xce, 0x60,
-    0xe4, 0xe0,
-    0xf1, 0xe0,
-    0xfb, 0xe0,
-    0xff, 0xe0,
-    0x80, 0x20,
-    0x80, 0x20,
-    0xfe, 0x20,
-    0xfc, 0x60,
-    0xfc, 0xe0,
-    0xf9, 0xe0,
-    0xf3, 0xe0,
-    0xe3, 0xe0,
-    0xe7, 0xe0,
-    0xcf, 0xe0,
-    0x8f, 0xe0,
-    0x80, 0x20,
-    0x80, 0x20,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_24_0xbb = { image_data_twr_font_ubuntu_24_0xbb, 10, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0xbe[21] = {
+    0xd2, 0x32, 0x52, 0x12, 0x73, 0x91, 0xf0, 0x29, 0x29, 0x83, 0x73, 0x82,
+    0x82, 0x82, 0x83, 0x82, 0x82, 0x83, 0x89, 0x29, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0xbe = { image_data_twr_font_ubuntu_24_0xbe,
-    11, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xe1[48] = {
-    0xff, 0x78,
-    0xfe, 0x38,
-    0xfc, 0x78,
-    0xf8, 0xf8,
-    0xfd, 0xf8,
-    0xff, 0xf8,
-    0xc0, 0x78,
-    0xc0, 0x38,
-    0xff, 0x18,
-    0xff, 0x98,
-    0xff, 0x98,
-    0xe0, 0x18,
-    0xc0, 0x18,
-    0x8f, 0x98,
-    0x9f, 0x98,
-    0x9f, 0x98,
-    0x8f, 0x98,
-    0xc0, 0x18,
-    0xe0, 0x18,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_24_0xbe = { image_data_twr_font_ubuntu_24_0xbe, 11, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0xe1[24] = {
+    0x81, 0xb3, 0x93, 0x93, 0xb1, 0xf0, 0x67, 0x68, 0xb3, 0xb2, 0xb2, 0x58,
+    0x49, 0x33, 0x52, 0x32, 0x62, 0x32, 0x62, 0x33, 0x52, 0x49, 0x58, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0xe1 = { image_data_twr_font_ubuntu_24_0xe1,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xe8[48] = {
-    0xff, 0xe0,
-    0xe7, 0x20,
-    0xf2, 0x60,
-    0xf8, 0xe0,
-    0xfd, 0xe0,
-    0xff, 0xe0,
-    0xf8, 0x00,
-    0xe0, 0x00,
-    0xc7, 0xe0,
-    0xcf, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0xcf, 0xe0,
-    0xc7, 0xe0,
-    0xe0, 0x00,
-    0xf8, 0x00,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_24_0xe1 = { image_data_twr_font_ubuntu_24_0xe1, 13, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0xe8[21] = {
+    0xe2, 0x32, 0x52, 0x12, 0x73, 0x91, 0xf0, 0x56, 0x38, 0x23, 0x82, 0x82,
+    0x92, 0x92, 0x92, 0x92, 0xa2, 0x93, 0x98, 0x56, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0xe8 = { image_data_twr_font_ubuntu_24_0xe8,
-    11, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xe9[48] = {
-    0xff, 0x78,
-    0xfe, 0x38,
-    0xfc, 0x78,
-    0xf8, 0xf8,
-    0xfd, 0xf8,
-    0xff, 0xf8,
-    0xf0, 0x78,
-    0xe0, 0x18,
-    0xc7, 0x98,
-    0xcf, 0xc8,
-    0x9f, 0xc8,
-    0x80, 0x08,
-    0x80, 0x08,
-    0x9f, 0xf8,
-    0x9f, 0xf8,
-    0xcf, 0xf8,
-    0xc7, 0xd8,
-    0xe0, 0x18,
-    0xf0, 0x18,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_24_0xe8 = { image_data_twr_font_ubuntu_24_0xe8, 11, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0xe9[24] = {
+    0x81, 0xb3, 0x93, 0x93, 0xb1, 0xf0, 0x85, 0x78, 0x43, 0x42, 0x42, 0x62,
+    0x22, 0x72, 0x2b, 0x2b, 0x22, 0xb2, 0xc2, 0xb3, 0x51, 0x58, 0x67, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0xe9 = { image_data_twr_font_ubuntu_24_0xe9,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xec[48] = {
-    0xe7, 0x38,
-    0xf2, 0x78,
-    0xf8, 0xf8,
-    0xfd, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xf0, 0x78,
-    0xe0, 0x18,
-    0xc7, 0x98,
-    0xcf, 0xc8,
-    0x9f, 0xc8,
-    0x80, 0x08,
-    0x80, 0x08,
-    0x9f, 0xf8,
-    0x9f, 0xf8,
-    0xcf, 0xf8,
-    0xc7, 0xd8,
-    0xe0, 0x18,
-    0xf0, 0x18,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_24_0xe9 = { image_data_twr_font_ubuntu_24_0xe9, 13, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0xec[26] = {
+    0x32, 0x32, 0x72, 0x12, 0x93, 0xb1, 0xf0, 0xf0, 0x65, 0x78, 0x43, 0x42,
+    0x42, 0x62, 0x22, 0x72, 0x2b, 0x2b, 0x22, 0xb2, 0xc2, 0xb3, 0x51, 0x58,
+    0x67, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0xec = { image_data_twr_font_ubuntu_24_0xec,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xed[24] = {
-    0xf4,
-    0xe0,
-    0xc4,
-    0x8c,
-    0xdc,
-    0xfc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0xec = { image_data_twr_font_ubuntu_24_0xec, 13, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0xed[19] = {
+    0x41, 0x43, 0x23, 0x23, 0x41, 0xb2, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0xed = { image_data_twr_font_ubuntu_24_0xed,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xef[48] = {
-    0xff, 0xff,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcd,
-    0xf0, 0x4f,
-    0xe0, 0x0f,
-    0xc7, 0x8f,
-    0xcf, 0xcf,
-    0x9f, 0xcf,
-    0x9f, 0xcf,
-    0x9f, 0xcf,
-    0x9f, 0xcf,
-    0x9f, 0xcf,
-    0xcf, 0xcf,
-    0xc7, 0xcf,
-    0xe0, 0x0f,
-    0xf8, 0x1f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_24_0xed = { image_data_twr_font_ubuntu_24_0xed, 6, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0xef[35] = {
+    0xf0, 0xb2, 0x22, 0xa2, 0x22, 0xa2, 0x22, 0xa2, 0x22, 0xa2, 0x21, 0x55,
+    0x12, 0x79, 0x63, 0x43, 0x62, 0x62, 0x52, 0x72, 0x52, 0x72, 0x52, 0x72,
+    0x52, 0x72, 0x52, 0x72, 0x62, 0x62, 0x63, 0x52, 0x79, 0x96, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0xef = { image_data_twr_font_ubuntu_24_0xef,
-    16, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xf2[48] = {
-    0xff, 0xfc,
-    0xf3, 0x9c,
-    0xf9, 0x3c,
-    0xfc, 0x7c,
-    0xfe, 0xfc,
-    0xff, 0xfc,
-    0xe0, 0x3c,
-    0xc0, 0x1c,
-    0xcf, 0x9c,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0xef = { image_data_twr_font_ubuntu_24_0xef, 16, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0xf2[33] = {
+    0xf0, 0x32, 0x32, 0x82, 0x12, 0xa3, 0xc1, 0xf0, 0x87, 0x69, 0x52, 0x52,
+    0x52, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62,
+    0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0xf2 = { image_data_twr_font_ubuntu_24_0xf2,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xf8[48] = {
-    0xff, 0x80,
-    0xce, 0x00,
-    0xe4, 0x80,
-    0xf1, 0x80,
-    0xfb, 0x80,
-    0xff, 0x80,
-    0xe0, 0x00,
-    0xc0, 0x00,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_24_0xf2 = { image_data_twr_font_ubuntu_24_0xf2, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0xf8[20] = {
+    0xb2, 0x32, 0x32, 0x12, 0x53, 0x71, 0xf6, 0x27, 0x22, 0x72, 0x72, 0x72,
+    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0xf8 = { image_data_twr_font_ubuntu_24_0xf8,
-    9, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xf9[48] = {
-    0xf8, 0x7c,
-    0xf3, 0x3c,
-    0xf3, 0x3c,
-    0xf3, 0x3c,
-    0xf8, 0x7c,
-    0xff, 0xfc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xe7, 0xcc,
-    0xe0, 0x0c,
-    0xf8, 0x1c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0xf8 = { image_data_twr_font_ubuntu_24_0xf8, 9, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0xf9[34] = {
+    0x54, 0x92, 0x22, 0x82, 0x22, 0x82, 0x22, 0x94, 0xf0, 0x62, 0x62, 0x42,
+    0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42,
+    0x62, 0x42, 0x62, 0x42, 0x62, 0x52, 0x52, 0x59, 0x76, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0xf9 = { image_data_twr_font_ubuntu_24_0xf9,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xfa[48] = {
-    0xff, 0x7c,
-    0xfe, 0x3c,
-    0xfc, 0x7c,
-    0xf8, 0xfc,
-    0xfd, 0xfc,
-    0xff, 0xfc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xe7, 0xcc,
-    0xe0, 0x0c,
-    0xf8, 0x1c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_24_0xf9 = { image_data_twr_font_ubuntu_24_0xf9, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0xfa[31] = {
+    0x81, 0xc3, 0xa3, 0xa3, 0xc1, 0xf0, 0x82, 0x62, 0x42, 0x62, 0x42, 0x62,
+    0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62,
+    0x42, 0x62, 0x52, 0x52, 0x59, 0x76, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0xfa = { image_data_twr_font_ubuntu_24_0xfa,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xfd[48] = {
-    0xfe, 0xe0,
-    0xfc, 0x60,
-    0xf8, 0xe0,
-    0xf1, 0xe0,
-    0xfb, 0xe0,
-    0xff, 0xe0,
-    0x3f, 0x80,
-    0x1f, 0x20,
-    0x9f, 0x20,
-    0x9f, 0x20,
-    0xce, 0x60,
-    0xce, 0x60,
-    0xce, 0x60,
-    0xe4, 0xe0,
-    0xe4, 0xe0,
-    0xe4, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf3, 0xe0,
-    0xe3, 0xe0,
-    0x07, 0xe0,
-    0x0f, 0xe0,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_24_0xfa = { image_data_twr_font_ubuntu_24_0xfa, 14, 24, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_24_0xfd[33] = {
+    0x71, 0x93, 0x73, 0x73, 0x91, 0xf0, 0x12, 0x75, 0x52, 0x22, 0x52, 0x22,
+    0x52, 0x32, 0x32, 0x42, 0x32, 0x42, 0x32, 0x52, 0x12, 0x62, 0x12, 0x62,
+    0x12, 0x73, 0x83, 0x83, 0x82, 0x83, 0x55, 0x64, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_24_0xfd = { image_data_twr_font_ubuntu_24_0xfd,
-    11, 24/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_24_0xfd = { image_data_twr_font_ubuntu_24_0xfd, 11, 24, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 
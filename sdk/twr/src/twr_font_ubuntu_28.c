@@ -14,7 +14,7 @@
 *
 * preset name: HARDWARIO LCD Module
 * data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
+* RLE compression enabled: no, converted by sdk/tools/font_rle.py
 * conversion type: Monochrome, Diffuse Dither 128
 * bits per pixel: 1
 *
@@ -31,3853 +31,990 @@
 
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x20[28] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc
+static const uint8_t image_data_twr_font_ubuntu_28_0x20[1] = {
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x20 = { image_data_twr_font_ubuntu_28_0x20,
-    6, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x21[28] = {
-    0xff,
-    0xff,
-    0xff,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xf7,
-    0xff,
-    0xff,
-    0xff,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x20 = { image_data_twr_font_ubuntu_28_0x20, 6, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x21[19] = {
+    0xf0, 0xc3, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+    0x61, 0xf0, 0xf3, 0x53, 0x53, 0x53, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x21 = { image_data_twr_font_ubuntu_28_0x21,
-    8, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x22[56] = {
-    0xc6, 0x30,
-    0xc6, 0x30,
-    0xc6, 0x30,
-    0xc6, 0x30,
-    0xc6, 0x30,
-    0xc6, 0x30,
-    0xef, 0x70,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
+static const twr_font_image_t twr_font_ubuntu_28_0x21 = { image_data_twr_font_ubuntu_28_0x21, 8, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x22[15] = {
+    0x23, 0x23, 0x43, 0x23, 0x43, 0x23, 0x43, 0x23, 0x43, 0x23, 0x43, 0x23,
+    0x51, 0x41, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x22 = { image_data_twr_font_ubuntu_28_0x22,
-    12, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x23[84] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xfc, 0x7c, 0x60,
-    0xfc, 0x7c, 0x60,
-    0xf8, 0xf8, 0xe0,
-    0xf8, 0xf8, 0xe0,
-    0xf8, 0xf8, 0xe0,
-    0x80, 0x00, 0x20,
-    0x80, 0x00, 0x20,
-    0xf1, 0xf1, 0xe0,
-    0xf1, 0xf1, 0xe0,
-    0xf1, 0xf1, 0xe0,
-    0xf1, 0xf1, 0xe0,
-    0xf1, 0xf1, 0xe0,
-    0x80, 0x00, 0x20,
-    0x80, 0x00, 0x20,
-    0xe3, 0xe3, 0xe0,
-    0xe3, 0xe3, 0xe0,
-    0xe3, 0xe3, 0xe0,
-    0xc7, 0xc7, 0xe0,
-    0xc7, 0xc7, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_28_0x22 = { image_data_twr_font_ubuntu_28_0x22, 12, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x23[43] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0x33, 0x53, 0x83, 0x53, 0x73, 0x53, 0x83, 0x53,
+    0x83, 0x53, 0x4f, 0x02, 0x2f, 0x02, 0x53, 0x53, 0x83, 0x53, 0x83, 0x53,
+    0x83, 0x53, 0x83, 0x53, 0x5f, 0x02, 0x2f, 0x02, 0x43, 0x53, 0x83, 0x53,
+    0x83, 0x53, 0x73, 0x53, 0x83, 0x53, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x23 = { image_data_twr_font_ubuntu_28_0x23,
-    19, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x24[56] = {
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xf8, 0x0f,
-    0xf0, 0x07,
-    0xe3, 0xf7,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc3, 0xff,
-    0xe1, 0xff,
-    0xe0, 0x7f,
-    0xf8, 0x1f,
-    0xfe, 0x07,
-    0xff, 0xc7,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xcf, 0xc7,
-    0xc0, 0x07,
-    0xf0, 0x1f,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x23 = { image_data_twr_font_ubuntu_28_0x23, 19, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x24[29] = {
+    0x72, 0xe2, 0xe2, 0xc7, 0x89, 0x63, 0x61, 0x53, 0xd3, 0xd3, 0xd4, 0xd4,
+    0xc6, 0xc6, 0xc6, 0xd3, 0xe3, 0xd3, 0xd3, 0xd3, 0x42, 0x63, 0x5b, 0x77,
+    0xc2, 0xe2, 0xe2, 0xe2, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x24 = { image_data_twr_font_ubuntu_28_0x24,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x25[84] = {
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xe0, 0xff, 0x1f,
-    0xc0, 0x7f, 0x3f,
-    0x8e, 0x3e, 0x7f,
-    0x9f, 0x3e, 0x7f,
-    0x9f, 0x3c, 0xff,
-    0x9f, 0x38, 0xff,
-    0x9f, 0x39, 0xff,
-    0x8e, 0x33, 0xff,
-    0xc0, 0x73, 0xff,
-    0xe0, 0xe7, 0x07,
-    0xff, 0xce, 0x03,
-    0xff, 0xcc, 0x71,
-    0xff, 0x9c, 0xf9,
-    0xff, 0x1c, 0xf9,
-    0xff, 0x3c, 0xf9,
-    0xfe, 0x7c, 0xf9,
-    0xfe, 0x7c, 0x71,
-    0xfc, 0xfe, 0x03,
-    0xf8, 0xff, 0x07,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x24 = { image_data_twr_font_ubuntu_28_0x24, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x25[56] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf5, 0x83, 0x77, 0x72, 0x73, 0x33, 0x52, 0x82,
+    0x52, 0x52, 0x82, 0x52, 0x42, 0x92, 0x52, 0x33, 0x92, 0x52, 0x32, 0xa3,
+    0x33, 0x22, 0xc7, 0x32, 0xd5, 0x32, 0x35, 0xd2, 0x37, 0xc2, 0x23, 0x33,
+    0xa2, 0x32, 0x52, 0x93, 0x32, 0x52, 0x92, 0x42, 0x52, 0x82, 0x52, 0x52,
+    0x82, 0x53, 0x33, 0x72, 0x77, 0x73, 0x85, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x25 = { image_data_twr_font_ubuntu_28_0x25,
-    24, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x26[84] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xfc, 0x1f, 0xe0,
-    0xf0, 0x0f, 0xe0,
-    0xf1, 0x87, 0xe0,
-    0xe3, 0xc7, 0xe0,
-    0xe3, 0xc7, 0xe0,
-    0xe3, 0xc7, 0xe0,
-    0xe3, 0x8f, 0xe0,
-    0xf1, 0x0f, 0xe0,
-    0xf8, 0x3f, 0xe0,
-    0xf0, 0x7f, 0xe0,
-    0xe2, 0x3e, 0x60,
-    0xc7, 0x1e, 0x60,
-    0x8f, 0x8c, 0xe0,
-    0x8f, 0xc0, 0xe0,
-    0x8f, 0xe1, 0xe0,
-    0x8f, 0xf1, 0xe0,
-    0xc3, 0xc0, 0xe0,
-    0xe0, 0x0c, 0x60,
-    0xf0, 0x1e, 0x20,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_28_0x25 = { image_data_twr_font_ubuntu_28_0x25, 24, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x26[42] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0x35, 0xc8, 0xb3, 0x24, 0x93, 0x43, 0x93, 0x43,
+    0x93, 0x43, 0x93, 0x33, 0xb3, 0x14, 0xc5, 0xd5, 0xd3, 0x13, 0x52, 0x43,
+    0x33, 0x42, 0x33, 0x53, 0x22, 0x43, 0x66, 0x43, 0x74, 0x53, 0x83, 0x64,
+    0x46, 0x69, 0x23, 0x67, 0x43, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x26 = { image_data_twr_font_ubuntu_28_0x26,
-    19, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x27[28] = {
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xee,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
+static const twr_font_image_t twr_font_ubuntu_28_0x26 = { image_data_twr_font_ubuntu_28_0x26, 19, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x27[8] = {
+    0x23, 0x43, 0x43, 0x43, 0x43, 0x43, 0x51, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x27 = { image_data_twr_font_ubuntu_28_0x27,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x28[56] = {
-    0xfe, 0x80,
-    0xfc, 0x00,
-    0xf8, 0x80,
-    0xf8, 0x80,
-    0xf1, 0x80,
-    0xf1, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xf1, 0x80,
-    0xf1, 0x80,
-    0xf8, 0x80,
-    0xf8, 0x80,
-    0xfc, 0x00,
-    0xfe, 0x80,
-    0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_28_0x27 = { image_data_twr_font_ubuntu_28_0x27, 7, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x28[28] = {
+    0x71, 0x73, 0x53, 0x63, 0x53, 0x63, 0x53, 0x63, 0x63, 0x53, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x73, 0x63, 0x63, 0x73, 0x63, 0x73,
+    0x63, 0x73, 0x71, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x28 = { image_data_twr_font_ubuntu_28_0x28,
-    9, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x29[56] = {
-    0xbf, 0x80,
-    0x1f, 0x80,
-    0x8f, 0x80,
-    0x8f, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xf1, 0x80,
-    0xf1, 0x80,
-    0xf1, 0x80,
-    0xf1, 0x80,
-    0xf1, 0x80,
-    0xf1, 0x80,
-    0xf1, 0x80,
-    0xf1, 0x80,
-    0xf1, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0x8f, 0x80,
-    0x8f, 0x80,
-    0x1f, 0x80,
-    0xbf, 0x80,
-    0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_28_0x28 = { image_data_twr_font_ubuntu_28_0x28, 9, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x29[28] = {
+    0x11, 0x73, 0x73, 0x63, 0x73, 0x63, 0x73, 0x63, 0x63, 0x73, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x53, 0x63, 0x63, 0x53, 0x63, 0x53,
+    0x63, 0x53, 0x71, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x29 = { image_data_twr_font_ubuntu_28_0x29,
-    9, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x2a[56] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xf8, 0xf8,
-    0xf8, 0xf8,
-    0xf8, 0xf8,
-    0xdc, 0xd8,
-    0x85, 0x08,
-    0xc0, 0x18,
-    0xf8, 0xf8,
-    0xf2, 0x78,
-    0xe2, 0x38,
-    0xc7, 0x18,
-    0xef, 0xb8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_28_0x29 = { image_data_twr_font_ubuntu_28_0x29, 9, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x2a[22] = {
+    0xf0, 0xf0, 0xe3, 0xa3, 0xa3, 0x71, 0x32, 0x21, 0x34, 0x11, 0x14, 0x39,
+    0x73, 0x92, 0x12, 0x73, 0x13, 0x53, 0x33, 0x51, 0x51, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x2a = { image_data_twr_font_ubuntu_28_0x2a,
-    13, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x2b[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xc0, 0x03,
-    0xc0, 0x03,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x2a = { image_data_twr_font_ubuntu_28_0x2a, 13, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x2b[21] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xe2, 0xe2, 0xe2,
+    0xe2, 0x9c, 0x4c, 0x92, 0xe2, 0xe2, 0xe2, 0xe2, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x2b = { image_data_twr_font_ubuntu_28_0x2b,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x2c[28] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xce,
-    0x8e,
-    0x9e,
-    0xfe,
-    0xfe
+static const twr_font_image_t twr_font_ubuntu_28_0x2b = { image_data_twr_font_ubuntu_28_0x2b, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x2c[16] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf3, 0x43, 0x43, 0x43,
+    0x42, 0x43, 0x42, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x2c = { image_data_twr_font_ubuntu_28_0x2c,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x2d[56] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0x80, 0x80,
-    0x80, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_28_0x2c = { image_data_twr_font_ubuntu_28_0x2c, 7, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x2d[10] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xd7, 0x27, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x2d = { image_data_twr_font_ubuntu_28_0x2d,
-    9, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x2e[28] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xe6,
-    0xc2,
-    0xc2,
-    0xe6,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
+static const twr_font_image_t twr_font_ubuntu_28_0x2d = { image_data_twr_font_ubuntu_28_0x2d, 9, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x2e[13] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x92, 0x44, 0x34, 0x42,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x2e = { image_data_twr_font_ubuntu_28_0x2e,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x2f[56] = {
-    0xff, 0x80,
-    0xff, 0x20,
-    0xff, 0x20,
-    0xff, 0x20,
-    0xfe, 0x60,
-    0xfe, 0x60,
-    0xfe, 0x60,
-    0xfc, 0xe0,
-    0xfc, 0xe0,
-    0xf8, 0xe0,
-    0xf9, 0xe0,
-    0xf9, 0xe0,
-    0xf3, 0xe0,
-    0xf3, 0xe0,
-    0xf3, 0xe0,
-    0xe7, 0xe0,
-    0xe7, 0xe0,
-    0xc7, 0xe0,
-    0xcf, 0xe0,
-    0xcf, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0x3f, 0xe0,
-    0x3f, 0xe0,
-    0x3f, 0xe0,
-    0x7f, 0xe0,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_28_0x2e = { image_data_twr_font_ubuntu_28_0x2e, 7, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x2f[28] = {
+    0x92, 0x82, 0x92, 0x92, 0x82, 0x92, 0x92, 0x82, 0x92, 0x83, 0x82, 0x92,
+    0x82, 0x92, 0x92, 0x82, 0x92, 0x83, 0x82, 0x92, 0x82, 0x92, 0x92, 0x82,
+    0x92, 0x92, 0x91, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x2f = { image_data_twr_font_ubuntu_28_0x2f,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x30[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xf8, 0x1f,
-    0xf0, 0x0f,
-    0xe3, 0xc7,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0x8f, 0xf1,
-    0x8f, 0xf1,
-    0x8f, 0xf1,
-    0x8f, 0xf1,
-    0x8f, 0xf1,
-    0x8f, 0xf1,
-    0x8f, 0xf1,
-    0x8f, 0xf1,
-    0x8f, 0xf1,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xe3, 0xc7,
-    0xf0, 0x0f,
-    0xf8, 0x1f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x2f = { image_data_twr_font_ubuntu_28_0x2f, 11, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x30[38] = {
+    0xf0, 0xf0, 0xf0, 0x86, 0x98, 0x73, 0x43, 0x53, 0x63, 0x43, 0x63, 0x33,
+    0x83, 0x23, 0x83, 0x23, 0x83, 0x23, 0x83, 0x23, 0x83, 0x23, 0x83, 0x23,
+    0x83, 0x23, 0x83, 0x23, 0x83, 0x33, 0x63, 0x43, 0x63, 0x53, 0x43, 0x78,
+    0x96, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x30 = { image_data_twr_font_ubuntu_28_0x30,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x31[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0x1f,
-    0xfe, 0x1f,
-    0xfc, 0x1f,
-    0xf0, 0x1f,
-    0xe1, 0x1f,
-    0xf7, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x30 = { image_data_twr_font_ubuntu_28_0x30, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x31[25] = {
+    0xf0, 0xf0, 0xf0, 0xb3, 0xc4, 0xb5, 0x97, 0x84, 0x13, 0x91, 0x33, 0xd3,
+    0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x31 = { image_data_twr_font_ubuntu_28_0x31,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x32[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xf8, 0x3f,
-    0xe0, 0x0f,
-    0xc7, 0x8f,
-    0xef, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xcf,
-    0xff, 0x8f,
-    0xff, 0x1f,
-    0xfe, 0x3f,
-    0xfc, 0x7f,
-    0xf8, 0xff,
-    0xf1, 0xff,
-    0xe3, 0xff,
-    0xe3, 0xff,
-    0xc7, 0xff,
-    0xc0, 0x03,
-    0xc0, 0x03,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x31 = { image_data_twr_font_ubuntu_28_0x31, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x32[25] = {
+    0xf0, 0xf0, 0xf0, 0x85, 0x99, 0x63, 0x43, 0x71, 0x63, 0xd3, 0xd3, 0xd3,
+    0xd2, 0xd3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xd3, 0xc3, 0xdc, 0x4c,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x32 = { image_data_twr_font_ubuntu_28_0x32,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x33[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xf0, 0x3f,
-    0xc0, 0x0f,
-    0xef, 0x8f,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0x0f,
-    0xf8, 0x1f,
-    0xf8, 0x1f,
-    0xff, 0x87,
-    0xff, 0xc7,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xc3,
-    0xcf, 0x87,
-    0xc0, 0x0f,
-    0xe0, 0x3f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x32 = { image_data_twr_font_ubuntu_28_0x32, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x33[25] = {
+    0xf0, 0xf0, 0xf0, 0x76, 0x8a, 0x71, 0x53, 0xe3, 0xd3, 0xd3, 0xd3, 0xb4,
+    0x96, 0xa6, 0xe4, 0xd3, 0xe3, 0xd3, 0xd3, 0xc4, 0x42, 0x54, 0x5a, 0x77,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x33 = { image_data_twr_font_ubuntu_28_0x33,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x34[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0x87,
-    0xff, 0x87,
-    0xff, 0x07,
-    0xfe, 0x07,
-    0xfc, 0x47,
-    0xf8, 0xc7,
-    0xf9, 0xc7,
-    0xf1, 0xc7,
-    0xe3, 0xc7,
-    0xe7, 0xc7,
-    0xc7, 0xc7,
-    0x8f, 0xc7,
-    0x80, 0x01,
-    0x80, 0x01,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x33 = { image_data_twr_font_ubuntu_28_0x33, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x34[31] = {
+    0xf0, 0xf0, 0xf0, 0xc4, 0xc4, 0xb5, 0xa6, 0x93, 0x13, 0x83, 0x23, 0x82,
+    0x33, 0x73, 0x33, 0x63, 0x43, 0x62, 0x53, 0x53, 0x53, 0x43, 0x63, 0x4e,
+    0x2e, 0xb3, 0xd3, 0xd3, 0xd3, 0xd3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x34 = { image_data_twr_font_ubuntu_28_0x34,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x35[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xf0, 0x07,
-    0xf0, 0x07,
-    0xf1, 0xff,
-    0xf1, 0xff,
-    0xf1, 0xff,
-    0xf1, 0xff,
-    0xf1, 0xff,
-    0xe0, 0x3f,
-    0xe0, 0x0f,
-    0xff, 0x07,
-    0xff, 0xc7,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xc3,
-    0xcf, 0x87,
-    0xc0, 0x0f,
-    0xe0, 0x3f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x34 = { image_data_twr_font_ubuntu_28_0x34, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x35[24] = {
+    0xf0, 0xf0, 0xf0, 0x79, 0x79, 0x73, 0xd3, 0xd3, 0xd3, 0xd3, 0xc7, 0x99,
+    0xc5, 0xd3, 0xe3, 0xd3, 0xd3, 0xd3, 0xc4, 0x42, 0x54, 0x5a, 0x77, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x35 = { image_data_twr_font_ubuntu_28_0x35,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x36[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xc3,
-    0xfe, 0x03,
-    0xfc, 0x3f,
-    0xf8, 0xff,
-    0xf1, 0xff,
-    0xe3, 0xff,
-    0xe3, 0xff,
-    0xc4, 0x0f,
-    0xc0, 0x07,
-    0xc3, 0xe3,
-    0xc7, 0xe1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xe3, 0xe3,
-    0xe1, 0xc3,
-    0xf0, 0x07,
-    0xfc, 0x1f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x35 = { image_data_twr_font_ubuntu_28_0x35, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x36[32] = {
+    0xf0, 0xf0, 0xf0, 0xd4, 0x97, 0x84, 0xb3, 0xc3, 0xc3, 0xd3, 0xc3, 0x16,
+    0x6b, 0x54, 0x53, 0x43, 0x64, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33,
+    0x73, 0x43, 0x53, 0x54, 0x34, 0x69, 0x95, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x36 = { image_data_twr_font_ubuntu_28_0x36,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x37[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xc0, 0x03,
-    0xc0, 0x03,
-    0xff, 0xe3,
-    0xff, 0xc7,
-    0xff, 0x8f,
-    0xff, 0x8f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x3f,
-    0xfe, 0x3f,
-    0xfe, 0x3f,
-    0xfc, 0x7f,
-    0xfc, 0x7f,
-    0xfc, 0x7f,
-    0xfc, 0x7f,
-    0xf8, 0xff,
-    0xf8, 0xff,
-    0xf8, 0xff,
-    0xf8, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x36 = { image_data_twr_font_ubuntu_28_0x36, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x37[23] = {
+    0xf0, 0xf0, 0xf0, 0x5c, 0x4c, 0xd3, 0xc3, 0xc3, 0xd3, 0xc3, 0xd3, 0xd2,
+    0xd3, 0xd3, 0xc3, 0xd3, 0xd3, 0xd3, 0xc3, 0xd3, 0xd3, 0xd3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x37 = { image_data_twr_font_ubuntu_28_0x37,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x38[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xf8, 0x1f,
-    0xf0, 0x0f,
-    0xe3, 0xc7,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc3, 0xe3,
-    0xe1, 0xc7,
-    0xf0, 0x0f,
-    0xf8, 0x1f,
-    0xf2, 0x0f,
-    0xe3, 0x87,
-    0xc7, 0xc3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xe3, 0xc7,
-    0xe0, 0x07,
-    0xf8, 0x1f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x37 = { image_data_twr_font_ubuntu_28_0x37, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x38[36] = {
+    0xf0, 0xf0, 0xf0, 0x86, 0x98, 0x73, 0x43, 0x53, 0x63, 0x43, 0x63, 0x43,
+    0x63, 0x44, 0x53, 0x54, 0x33, 0x78, 0x96, 0x92, 0x15, 0x73, 0x34, 0x53,
+    0x54, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x53, 0x43, 0x6a, 0x86, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x38 = { image_data_twr_font_ubuntu_28_0x38,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x39[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xf8, 0x3f,
-    0xe0, 0x0f,
-    0xc3, 0x87,
-    0xc7, 0xc7,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x87, 0xe3,
-    0xc7, 0xc3,
-    0xe0, 0x03,
-    0xf0, 0x23,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0x8f,
-    0xff, 0x0f,
-    0xfc, 0x1f,
-    0xc0, 0x7f,
-    0xc3, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x38 = { image_data_twr_font_ubuntu_28_0x38, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x39[32] = {
+    0xf0, 0xf0, 0xf0, 0x85, 0x99, 0x64, 0x34, 0x53, 0x53, 0x43, 0x73, 0x33,
+    0x73, 0x33, 0x73, 0x33, 0x73, 0x34, 0x63, 0x43, 0x54, 0x5b, 0x66, 0x13,
+    0xc3, 0xd3, 0xc3, 0xc4, 0xa5, 0x77, 0x94, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x39 = { image_data_twr_font_ubuntu_28_0x39,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x3a[28] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xe6,
-    0xc2,
-    0xc2,
-    0xe6,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xe6,
-    0xc2,
-    0xc2,
-    0xe6,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
+static const twr_font_image_t twr_font_ubuntu_28_0x39 = { image_data_twr_font_ubuntu_28_0x39, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x3a[15] = {
+    0xf0, 0xf0, 0xf0, 0x72, 0x44, 0x34, 0x42, 0xf0, 0xf0, 0xf0, 0x92, 0x44,
+    0x34, 0x42, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x3a = { image_data_twr_font_ubuntu_28_0x3a,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x3b[28] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xce,
-    0x86,
-    0x86,
-    0xce,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xce,
-    0x8e,
-    0x9e,
-    0xfe,
-    0xfe
+static const twr_font_image_t twr_font_ubuntu_28_0x3a = { image_data_twr_font_ubuntu_28_0x3a, 7, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x3b[19] = {
+    0xf0, 0xf0, 0xf0, 0x62, 0x44, 0x34, 0x42, 0xf0, 0xf0, 0xf0, 0xf0, 0x13,
+    0x43, 0x43, 0x43, 0x42, 0x43, 0x42, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x3b = { image_data_twr_font_ubuntu_28_0x3b,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x3c[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xfb,
-    0xff, 0xe1,
-    0xff, 0x07,
-    0xfc, 0x1f,
-    0xf0, 0x7f,
-    0x83, 0xff,
-    0x8f, 0xff,
-    0x83, 0xff,
-    0xf0, 0x7f,
-    0xfc, 0x1f,
-    0xff, 0x07,
-    0xff, 0xe1,
-    0xff, 0xfb,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x3b = { image_data_twr_font_ubuntu_28_0x3b, 7, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x3c[22] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x51, 0xd4, 0x95, 0x95,
+    0x95, 0x85, 0xb3, 0xd5, 0xe5, 0xd5, 0xd5, 0xe4, 0xe1, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x3c = { image_data_twr_font_ubuntu_28_0x3c,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x3d[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xc0, 0x01,
-    0xc0, 0x01,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xc0, 0x01,
-    0xc0, 0x01,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x3c = { image_data_twr_font_ubuntu_28_0x3c, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x3d[19] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xcd, 0x3d,
+    0xf0, 0xf0, 0xf0, 0xf0, 0x7d, 0x3d, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x3d = { image_data_twr_font_ubuntu_28_0x3d,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x3e[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xdf, 0xff,
-    0x87, 0xff,
-    0xe1, 0xff,
-    0xf8, 0x7f,
-    0xfe, 0x1f,
-    0xff, 0x87,
-    0xff, 0xe3,
-    0xff, 0x87,
-    0xfe, 0x1f,
-    0xf8, 0x7f,
-    0xe1, 0xff,
-    0x87, 0xff,
-    0xdf, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x3d = { image_data_twr_font_ubuntu_28_0x3d, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x3e[21] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x91, 0xe4, 0xe4, 0xe4, 0xe4,
+    0xe4, 0xe3, 0xb4, 0xa4, 0xa4, 0xa4, 0xa4, 0xd1, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x3e = { image_data_twr_font_ubuntu_28_0x3e,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x3f[56] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xc0, 0xe0,
-    0x80, 0x60,
-    0xdc, 0x20,
-    0xfe, 0x20,
-    0xfe, 0x20,
-    0xfe, 0x20,
-    0xfc, 0x60,
-    0xf8, 0x60,
-    0xf8, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_28_0x3e = { image_data_twr_font_ubuntu_28_0x3e, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x3f[22] = {
+    0xf0, 0xf0, 0x56, 0x48, 0x41, 0x34, 0x83, 0x83, 0x83, 0x73, 0x74, 0x73,
+    0x73, 0x83, 0x83, 0xf0, 0xf0, 0xb3, 0x83, 0x83, 0x83, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x3f = { image_data_twr_font_ubuntu_28_0x3f,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x40[112] = {
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xc0, 0x7f, 0xe0,
-    0xfe, 0x00, 0x0f, 0xe0,
-    0xfc, 0x1f, 0x87, 0xe0,
-    0xf8, 0x7f, 0xe3, 0xe0,
-    0xf1, 0xff, 0xf1, 0xe0,
-    0xe1, 0xe0, 0x78, 0xe0,
-    0xe3, 0xc0, 0x38, 0xe0,
-    0xe3, 0x8e, 0x3c, 0x60,
-    0xc7, 0x8e, 0x3c, 0x60,
-    0xc7, 0x1e, 0x3c, 0x60,
-    0xc7, 0x1e, 0x3c, 0x60,
-    0xc7, 0x1e, 0x3c, 0x60,
-    0xc7, 0x1e, 0x3c, 0x60,
-    0xc7, 0x1e, 0x3c, 0x60,
-    0xc7, 0x0e, 0x38, 0xe0,
-    0xe3, 0x8e, 0x30, 0xe0,
-    0xe3, 0xc0, 0x01, 0xe0,
-    0xe1, 0xe0, 0x83, 0xe0,
-    0xf1, 0xff, 0xff, 0xe0,
-    0xf8, 0x7f, 0xff, 0xe0,
-    0xfc, 0x1f, 0xff, 0xe0,
-    0xfe, 0x00, 0x3f, 0xe0,
-    0xff, 0xc0, 0x3f, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_28_0x3f = { image_data_twr_font_ubuntu_28_0x3f, 11, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x40[72] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x17, 0xf0, 0x2d, 0xd5, 0x64, 0xb4,
+    0xa3, 0x93, 0xd3, 0x74, 0x46, 0x43, 0x63, 0x48, 0x33, 0x63, 0x33, 0x33,
+    0x43, 0x43, 0x43, 0x33, 0x43, 0x43, 0x33, 0x43, 0x43, 0x43, 0x33, 0x43,
+    0x43, 0x43, 0x33, 0x43, 0x43, 0x43, 0x33, 0x43, 0x43, 0x43, 0x33, 0x43,
+    0x43, 0x43, 0x34, 0x33, 0x33, 0x63, 0x33, 0x33, 0x24, 0x63, 0x4d, 0x74,
+    0x45, 0x15, 0x93, 0xf0, 0xa4, 0xf0, 0x95, 0xf0, 0x8b, 0xf0, 0x48, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x40 = { image_data_twr_font_ubuntu_28_0x40,
-    27, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x41[84] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0x0f, 0xe0,
-    0xfe, 0x0f, 0xe0,
-    0xfe, 0x0f, 0xe0,
-    0xfc, 0x47, 0xe0,
-    0xfc, 0x47, 0xe0,
-    0xf8, 0xe3, 0xe0,
-    0xf8, 0xe3, 0xe0,
-    0xf8, 0xe3, 0xe0,
-    0xf1, 0xf1, 0xe0,
-    0xf1, 0xf1, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe0, 0x00, 0xe0,
-    0xc0, 0x00, 0x60,
-    0xc7, 0xfc, 0x60,
-    0x8f, 0xfe, 0x20,
-    0x8f, 0xfe, 0x20,
-    0x8f, 0xfe, 0x20,
-    0x1f, 0xff, 0x00,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_28_0x40 = { image_data_twr_font_ubuntu_28_0x40, 27, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x41[38] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0x54, 0xe5, 0xe5, 0xd3, 0x13, 0xc3, 0x13, 0xb3,
+    0x33, 0xa3, 0x33, 0xa3, 0x33, 0x93, 0x53, 0x83, 0x53, 0x73, 0x73, 0x63,
+    0x73, 0x6d, 0x5f, 0x43, 0x93, 0x33, 0xb3, 0x23, 0xb3, 0x23, 0xb3, 0x13,
+    0xd3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x41 = { image_data_twr_font_ubuntu_28_0x41,
-    19, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x42[84] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xc0, 0x0f, 0xc0,
-    0xc0, 0x03, 0xc0,
-    0xc7, 0xe1, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xe1, 0xc0,
-    0xc0, 0x03, 0xc0,
-    0xc0, 0x01, 0xc0,
-    0xc7, 0xf0, 0xc0,
-    0xc7, 0xf8, 0x40,
-    0xc7, 0xfc, 0x40,
-    0xc7, 0xfc, 0x40,
-    0xc7, 0xfc, 0x40,
-    0xc7, 0xf8, 0x40,
-    0xc7, 0xf0, 0xc0,
-    0xc0, 0x01, 0xc0,
-    0xc0, 0x0f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_28_0x41 = { image_data_twr_font_ubuntu_28_0x41, 19, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x42[36] = {
+    0xf0, 0xf0, 0xf0, 0xba, 0x8c, 0x63, 0x64, 0x53, 0x83, 0x43, 0x83, 0x43,
+    0x83, 0x43, 0x83, 0x43, 0x64, 0x5c, 0x6d, 0x53, 0x74, 0x43, 0x84, 0x33,
+    0x93, 0x33, 0x93, 0x33, 0x93, 0x33, 0x84, 0x33, 0x74, 0x4d, 0x5a, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x42 = { image_data_twr_font_ubuntu_28_0x42,
-    18, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x43[84] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0x03, 0x80,
-    0xfc, 0x00, 0x80,
-    0xf8, 0x7c, 0x80,
-    0xf1, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xf1, 0xff, 0x80,
-    0xf0, 0xfc, 0x80,
-    0xf8, 0x00, 0x80,
-    0xfe, 0x03, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_28_0x42 = { image_data_twr_font_ubuntu_28_0x42, 18, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x43[25] = {
+    0xf0, 0xf0, 0xf0, 0xe6, 0x9a, 0x64, 0x52, 0x53, 0xd3, 0xe3, 0xd3, 0xe3,
+    0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xf3, 0xe3, 0xf3, 0xe4, 0x62, 0x6b, 0x87,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x43 = { image_data_twr_font_ubuntu_28_0x43,
-    17, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x44[84] = {
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xc0, 0x1f, 0xf0,
-    0xc0, 0x03, 0xf0,
-    0xc7, 0xe1, 0xf0,
-    0xc7, 0xf8, 0xf0,
-    0xc7, 0xfc, 0x70,
-    0xc7, 0xfc, 0x70,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfc, 0x70,
-    0xc7, 0xfc, 0x70,
-    0xc7, 0xf8, 0xf0,
-    0xc7, 0xe1, 0xf0,
-    0xc0, 0x03, 0xf0,
-    0xc0, 0x1f, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0
+static const twr_font_image_t twr_font_ubuntu_28_0x43 = { image_data_twr_font_ubuntu_28_0x43, 17, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x44[39] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0x29, 0xbc, 0x83, 0x64, 0x73, 0x83, 0x63, 0x93,
+    0x53, 0x93, 0x53, 0xa3, 0x43, 0xa3, 0x43, 0xa3, 0x43, 0xa3, 0x43, 0xa3,
+    0x43, 0xa3, 0x43, 0xa3, 0x43, 0x93, 0x53, 0x93, 0x53, 0x83, 0x63, 0x64,
+    0x7c, 0x89, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x44 = { image_data_twr_font_ubuntu_28_0x44,
-    20, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x45[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xc0, 0x03,
-    0xc0, 0x03,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc0, 0x07,
-    0xc0, 0x07,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc0, 0x01,
-    0xc0, 0x01,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x44 = { image_data_twr_font_ubuntu_28_0x44, 20, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x45[23] = {
+    0xf0, 0xf0, 0xf0, 0x5c, 0x4c, 0x43, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xdb,
+    0x5b, 0x53, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xdd, 0x3d, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x45 = { image_data_twr_font_ubuntu_28_0x45,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x46[56] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xc0, 0x02,
-    0xc0, 0x02,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc0, 0x06,
-    0xc0, 0x06,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_28_0x45 = { image_data_twr_font_ubuntu_28_0x45, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x46[23] = {
+    0xf0, 0xf0, 0xf0, 0x2c, 0x3c, 0x33, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xcb,
+    0x4b, 0x43, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x46 = { image_data_twr_font_ubuntu_28_0x46,
-    15, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x47[84] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0x01, 0xe0,
-    0xfc, 0x00, 0x60,
-    0xf8, 0x7e, 0xe0,
-    0xf1, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xc7, 0xff, 0xe0,
-    0xc7, 0xff, 0xe0,
-    0xc7, 0xff, 0xe0,
-    0xc7, 0xff, 0xe0,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xf1, 0xfc, 0x60,
-    0xf0, 0x7c, 0x60,
-    0xfc, 0x00, 0x60,
-    0xff, 0x00, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_28_0x46 = { image_data_twr_font_ubuntu_28_0x46, 15, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x47[37] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0x57, 0xab, 0x74, 0x61, 0x73, 0xf3, 0xf0, 0x13,
+    0xf3, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0x93, 0x43, 0x93,
+    0x43, 0x93, 0x53, 0x83, 0x53, 0x83, 0x63, 0x73, 0x65, 0x53, 0x8b, 0xa8,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x47 = { image_data_twr_font_ubuntu_28_0x47,
-    19, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x48[84] = {
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc0, 0x00, 0x30,
-    0xc0, 0x00, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0
+static const twr_font_image_t twr_font_ubuntu_28_0x47 = { image_data_twr_font_ubuntu_28_0x47, 19, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x48[43] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0x23, 0xa3, 0x43, 0xa3, 0x43, 0xa3, 0x43, 0xa3,
+    0x43, 0xa3, 0x43, 0xa3, 0x43, 0xa3, 0x43, 0xa3, 0x4f, 0x01, 0x4f, 0x01,
+    0x43, 0xa3, 0x43, 0xa3, 0x43, 0xa3, 0x43, 0xa3, 0x43, 0xa3, 0x43, 0xa3,
+    0x43, 0xa3, 0x43, 0xa3, 0x43, 0xa3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x48 = { image_data_twr_font_ubuntu_28_0x48,
-    20, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x49[28] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
+static const twr_font_image_t twr_font_ubuntu_28_0x48 = { image_data_twr_font_ubuntu_28_0x48, 20, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x49[21] = {
+    0xf0, 0x83, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x49 = { image_data_twr_font_ubuntu_28_0x49,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x4a[56] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x0c,
-    0x9e, 0x1c,
-    0x00, 0x3c,
-    0xc0, 0x7c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_28_0x49 = { image_data_twr_font_ubuntu_28_0x49, 7, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x4a[24] = {
+    0xf0, 0xf0, 0xf0, 0x63, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3,
+    0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa4, 0x32, 0x44, 0x3a, 0x67, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x4a = { image_data_twr_font_ubuntu_28_0x4a,
-    14, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x4b[84] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf1, 0xc0,
-    0xc7, 0xe3, 0xc0,
-    0xc7, 0xc7, 0xc0,
-    0xc7, 0x8f, 0xc0,
-    0xc7, 0x1f, 0xc0,
-    0xc6, 0x3f, 0xc0,
-    0xc4, 0x7f, 0xc0,
-    0xc0, 0xff, 0xc0,
-    0xc0, 0x7f, 0xc0,
-    0xc4, 0x3f, 0xc0,
-    0xc6, 0x1f, 0xc0,
-    0xc7, 0x07, 0xc0,
-    0xc7, 0xc3, 0xc0,
-    0xc7, 0xe1, 0xc0,
-    0xc7, 0xe1, 0xc0,
-    0xc7, 0xf0, 0xc0,
-    0xc7, 0xf8, 0x40,
-    0xc7, 0xfc, 0x00,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_28_0x4a = { image_data_twr_font_ubuntu_28_0x4a, 14, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x4b[40] = {
+    0xf0, 0xf0, 0xf0, 0xb3, 0x83, 0x43, 0x73, 0x53, 0x63, 0x63, 0x53, 0x73,
+    0x43, 0x83, 0x33, 0x93, 0x23, 0xa3, 0x13, 0xb6, 0xc7, 0xb3, 0x14, 0xa3,
+    0x24, 0x93, 0x35, 0x73, 0x54, 0x63, 0x64, 0x53, 0x64, 0x53, 0x74, 0x43,
+    0x84, 0x33, 0x94, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x4b = { image_data_twr_font_ubuntu_28_0x4b,
-    18, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x4c[56] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc0, 0x00,
-    0xc0, 0x00,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_28_0x4b = { image_data_twr_font_ubuntu_28_0x4b, 18, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x4c[23] = {
+    0xf0, 0xf0, 0xf0, 0x23, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xcd, 0x2d, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x4c = { image_data_twr_font_ubuntu_28_0x4c,
-    15, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x4d[112] = {
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xe3, 0xff, 0xe3, 0x80,
-    0xe1, 0xff, 0xc3, 0x80,
-    0xe1, 0xff, 0xc3, 0x80,
-    0xe0, 0xff, 0x83, 0x80,
-    0xe0, 0x7f, 0x83, 0x80,
-    0xe2, 0x7f, 0x23, 0x80,
-    0xe6, 0x3f, 0x33, 0x80,
-    0xc7, 0x3e, 0x73, 0x80,
-    0xc7, 0x3e, 0x71, 0x80,
-    0xc7, 0x1c, 0x71, 0x80,
-    0xc7, 0x9c, 0xf1, 0x80,
-    0xc7, 0x88, 0xf1, 0x80,
-    0xc7, 0xc9, 0xf1, 0x80,
-    0xc7, 0xc1, 0xf1, 0x80,
-    0xc7, 0xc1, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_28_0x4c = { image_data_twr_font_ubuntu_28_0x4c, 15, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x4d[63] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x33, 0xd3, 0x64, 0xb4, 0x64, 0xb4, 0x65,
+    0x95, 0x66, 0x85, 0x63, 0x12, 0x72, 0x13, 0x62, 0x23, 0x62, 0x22, 0x53,
+    0x32, 0x52, 0x32, 0x53, 0x32, 0x52, 0x33, 0x43, 0x33, 0x33, 0x33, 0x43,
+    0x42, 0x32, 0x43, 0x43, 0x43, 0x13, 0x43, 0x43, 0x52, 0x12, 0x53, 0x43,
+    0x55, 0x53, 0x43, 0x55, 0x53, 0x43, 0x63, 0x63, 0x43, 0xf3, 0x43, 0xf3,
+    0x43, 0xf3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x4d = { image_data_twr_font_ubuntu_28_0x4d,
-    25, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x4e[84] = {
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xc7, 0xfe, 0x30,
-    0xc3, 0xfe, 0x30,
-    0xc1, 0xfe, 0x30,
-    0xc0, 0xfe, 0x30,
-    0xc0, 0x7e, 0x30,
-    0xc4, 0x7e, 0x30,
-    0xc6, 0x3e, 0x30,
-    0xc7, 0x1e, 0x30,
-    0xc7, 0x9e, 0x30,
-    0xc7, 0x8e, 0x30,
-    0xc7, 0xc6, 0x30,
-    0xc7, 0xe6, 0x30,
-    0xc7, 0xe2, 0x30,
-    0xc7, 0xf0, 0x30,
-    0xc7, 0xf8, 0x30,
-    0xc7, 0xf8, 0x30,
-    0xc7, 0xfc, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0
+static const twr_font_image_t twr_font_ubuntu_28_0x4d = { image_data_twr_font_ubuntu_28_0x4d, 25, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x4e[51] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0x23, 0xa3, 0x44, 0x93, 0x45, 0x83, 0x46, 0x73,
+    0x47, 0x63, 0x43, 0x13, 0x63, 0x43, 0x23, 0x53, 0x43, 0x33, 0x43, 0x43,
+    0x42, 0x43, 0x43, 0x43, 0x33, 0x43, 0x53, 0x23, 0x43, 0x62, 0x23, 0x43,
+    0x63, 0x13, 0x43, 0x76, 0x43, 0x85, 0x43, 0x85, 0x43, 0x94, 0x43, 0xa3,
+    0x43, 0xa3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x4e = { image_data_twr_font_ubuntu_28_0x4e,
-    20, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x4f[84] = {
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0x03, 0xfc,
-    0xfc, 0x00, 0xfc,
-    0xf8, 0x78, 0x7c,
-    0xf1, 0xfe, 0x3c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xf1, 0xfe, 0x3c,
-    0xf8, 0x78, 0x7c,
-    0xfc, 0x00, 0xfc,
-    0xff, 0x03, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_28_0x4e = { image_data_twr_font_ubuntu_28_0x4e, 20, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x4f[39] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xe6, 0xea, 0xb4, 0x44, 0x93, 0x83, 0x73, 0xa3,
+    0x63, 0xa3, 0x53, 0xc3, 0x43, 0xc3, 0x43, 0xc3, 0x43, 0xc3, 0x43, 0xc3,
+    0x43, 0xc3, 0x43, 0xc3, 0x53, 0xa3, 0x63, 0xa3, 0x73, 0x83, 0x94, 0x44,
+    0xba, 0xe6, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x4f = { image_data_twr_font_ubuntu_28_0x4f,
-    22, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x50[84] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xc0, 0x1f, 0x80,
-    0xc0, 0x03, 0x80,
-    0xc7, 0xe1, 0x80,
-    0xc7, 0xf1, 0x80,
-    0xc7, 0xf8, 0x80,
-    0xc7, 0xf8, 0x80,
-    0xc7, 0xf8, 0x80,
-    0xc7, 0xf8, 0x80,
-    0xc7, 0xf0, 0x80,
-    0xc7, 0xe1, 0x80,
-    0xc0, 0x03, 0x80,
-    0xc0, 0x0f, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_28_0x4f = { image_data_twr_font_ubuntu_28_0x4f, 22, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x50[31] = {
+    0xf0, 0xf0, 0xf0, 0x89, 0x8c, 0x53, 0x64, 0x43, 0x73, 0x43, 0x83, 0x33,
+    0x83, 0x33, 0x83, 0x33, 0x83, 0x33, 0x74, 0x33, 0x64, 0x4c, 0x5a, 0x73,
+    0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x50 = { image_data_twr_font_ubuntu_28_0x50,
-    17, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x51[84] = {
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0x03, 0xfc,
-    0xfc, 0x00, 0xfc,
-    0xf8, 0x78, 0x7c,
-    0xf1, 0xfe, 0x3c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xf1, 0xfe, 0x3c,
-    0xf0, 0x78, 0x7c,
-    0xfc, 0x00, 0xfc,
-    0xff, 0x03, 0xfc,
-    0xff, 0xc7, 0xfc,
-    0xff, 0xe3, 0xfc,
-    0xff, 0xe0, 0xfc,
-    0xff, 0xf8, 0x3c,
-    0xff, 0xfe, 0x3c,
-    0xff, 0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_28_0x50 = { image_data_twr_font_ubuntu_28_0x50, 17, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x51[49] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xe6, 0xea, 0xb4, 0x44, 0x93, 0x83, 0x73, 0xa3,
+    0x63, 0xa3, 0x53, 0xc3, 0x43, 0xc3, 0x43, 0xc3, 0x43, 0xc3, 0x43, 0xc3,
+    0x43, 0xc3, 0x43, 0xc3, 0x53, 0xa3, 0x63, 0xa3, 0x73, 0x83, 0x85, 0x44,
+    0xba, 0xe6, 0xf0, 0x33, 0xf0, 0x53, 0xf0, 0x45, 0xf0, 0x45, 0xf0, 0x43,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x51 = { image_data_twr_font_ubuntu_28_0x51,
-    22, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x52[84] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xc0, 0x0f, 0xc0,
-    0xc0, 0x03, 0xc0,
-    0xc7, 0xe1, 0xc0,
-    0xc7, 0xf1, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf0, 0xc0,
-    0xc7, 0xe1, 0xc0,
-    0xc0, 0x03, 0xc0,
-    0xc0, 0x0f, 0xc0,
-    0xc7, 0x87, 0xc0,
-    0xc7, 0xc3, 0xc0,
-    0xc7, 0xe1, 0xc0,
-    0xc7, 0xf1, 0xc0,
-    0xc7, 0xf0, 0xc0,
-    0xc7, 0xf8, 0x40,
-    0xc7, 0xfc, 0x40,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_28_0x51 = { image_data_twr_font_ubuntu_28_0x51, 22, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x52[38] = {
+    0xf0, 0xf0, 0xf0, 0xba, 0x8c, 0x63, 0x64, 0x53, 0x73, 0x53, 0x83, 0x43,
+    0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x74, 0x43, 0x64, 0x5c, 0x6a, 0x83,
+    0x44, 0x73, 0x54, 0x63, 0x64, 0x53, 0x73, 0x53, 0x74, 0x43, 0x84, 0x33,
+    0x93, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x52 = { image_data_twr_font_ubuntu_28_0x52,
-    18, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x53[56] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xf0, 0x1e,
-    0xe0, 0x06,
-    0xc7, 0xee,
-    0x8f, 0xfe,
-    0x8f, 0xfe,
-    0x8f, 0xfe,
-    0x87, 0xfe,
-    0xc1, 0xfe,
-    0xe0, 0x3e,
-    0xf0, 0x0e,
-    0xfe, 0x06,
-    0xff, 0xc2,
-    0xff, 0xe2,
-    0xff, 0xe2,
-    0xff, 0xe2,
-    0xff, 0xe2,
-    0x8f, 0xc6,
-    0x80, 0x0e,
-    0xe0, 0x3e,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_28_0x52 = { image_data_twr_font_ubuntu_28_0x52, 18, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x53[25] = {
+    0xf0, 0xf0, 0xf0, 0x47, 0x7a, 0x43, 0x61, 0x43, 0xc3, 0xc3, 0xc4, 0xc5,
+    0xb7, 0x98, 0xa6, 0xc4, 0xc3, 0xc3, 0xc3, 0xc3, 0x23, 0x63, 0x3b, 0x67,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x53 = { image_data_twr_font_ubuntu_28_0x53,
-    15, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x54[56] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0x00, 0x00,
-    0x00, 0x00,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_28_0x53 = { image_data_twr_font_ubuntu_28_0x53, 15, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x54[22] = {
+    0xf0, 0xf0, 0xff, 0x0f, 0x63, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x54 = { image_data_twr_font_ubuntu_28_0x54,
-    15, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x55[84] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xe3, 0xf8, 0xe0,
-    0xe1, 0xf0, 0xe0,
-    0xf0, 0x01, 0xe0,
-    0xfc, 0x07, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_28_0x54 = { image_data_twr_font_ubuntu_28_0x54, 15, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x55[40] = {
+    0xf0, 0xf0, 0xf0, 0xe3, 0x93, 0x43, 0x93, 0x43, 0x93, 0x43, 0x93, 0x43,
+    0x93, 0x43, 0x93, 0x43, 0x93, 0x43, 0x93, 0x43, 0x93, 0x43, 0x93, 0x43,
+    0x93, 0x43, 0x93, 0x43, 0x93, 0x43, 0x93, 0x43, 0x93, 0x53, 0x73, 0x64,
+    0x54, 0x7b, 0xa7, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x55 = { image_data_twr_font_ubuntu_28_0x55,
-    19, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x56[84] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0x1f, 0xff, 0x00,
-    0x8f, 0xfe, 0x20,
-    0x8f, 0xfe, 0x20,
-    0x8f, 0xfe, 0x20,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc3, 0xf8, 0x60,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xf1, 0xf1, 0xe0,
-    0xf1, 0xf1, 0xe0,
-    0xf8, 0xe3, 0xe0,
-    0xf8, 0xe3, 0xe0,
-    0xf8, 0x43, 0xe0,
-    0xfc, 0x47, 0xe0,
-    0xfc, 0x07, 0xe0,
-    0xfe, 0x0f, 0xe0,
-    0xfe, 0x0f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_28_0x55 = { image_data_twr_font_ubuntu_28_0x55, 19, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x56[38] = {
+    0xf0, 0xf0, 0xf0, 0xc3, 0xd3, 0x13, 0xb3, 0x23, 0xb3, 0x23, 0xb3, 0x33,
+    0x93, 0x43, 0x93, 0x44, 0x74, 0x53, 0x73, 0x63, 0x73, 0x73, 0x53, 0x83,
+    0x53, 0x93, 0x33, 0xa3, 0x33, 0xa4, 0x14, 0xb3, 0x13, 0xc7, 0xd5, 0xe5,
+    0xf3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x56 = { image_data_twr_font_ubuntu_28_0x56,
-    19, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x57[112] = {
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0x8f, 0xff, 0xfe, 0x20,
-    0x8f, 0xff, 0xfe, 0x20,
-    0x87, 0xf1, 0xfc, 0x20,
-    0xc7, 0xf0, 0xfc, 0x60,
-    0xc7, 0xe0, 0xfc, 0x60,
-    0xc7, 0xe0, 0xfc, 0x60,
-    0xc7, 0xe4, 0xfc, 0x60,
-    0xc3, 0xc4, 0x78, 0x60,
-    0xe3, 0xc4, 0x78, 0xe0,
-    0xe3, 0xcc, 0x78, 0xe0,
-    0xe3, 0x8e, 0x38, 0xe0,
-    0xe3, 0x8e, 0x38, 0xe0,
-    0xe1, 0x9e, 0x30, 0xe0,
-    0xf1, 0x1f, 0x11, 0xe0,
-    0xf1, 0x1f, 0x11, 0xe0,
-    0xf1, 0x3f, 0x11, 0xe0,
-    0xf0, 0x3f, 0x81, 0xe0,
-    0xf8, 0x3f, 0x83, 0xe0,
-    0xf8, 0x7f, 0x83, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_28_0x56 = { image_data_twr_font_ubuntu_28_0x56, 19, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x57[70] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x73, 0xf0, 0x43, 0x23, 0xf0, 0x43, 0x24,
+    0x73, 0x74, 0x33, 0x74, 0x63, 0x43, 0x65, 0x63, 0x43, 0x65, 0x63, 0x43,
+    0x62, 0x12, 0x63, 0x44, 0x43, 0x13, 0x44, 0x53, 0x43, 0x13, 0x43, 0x63,
+    0x42, 0x23, 0x43, 0x63, 0x33, 0x33, 0x33, 0x63, 0x33, 0x33, 0x33, 0x64,
+    0x22, 0x43, 0x24, 0x73, 0x13, 0x53, 0x13, 0x83, 0x13, 0x53, 0x13, 0x83,
+    0x12, 0x63, 0x13, 0x86, 0x76, 0x95, 0x75, 0xa4, 0x85, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x57 = { image_data_twr_font_ubuntu_28_0x57,
-    27, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x58[84] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0x8f, 0xfc, 0x40,
-    0xc7, 0xf8, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xf1, 0xe3, 0xc0,
-    0xf8, 0xc7, 0xc0,
-    0xf8, 0xc7, 0xc0,
-    0xfc, 0x0f, 0xc0,
-    0xfe, 0x1f, 0xc0,
-    0xfe, 0x1f, 0xc0,
-    0xfe, 0x1f, 0xc0,
-    0xfc, 0x0f, 0xc0,
-    0xf8, 0xc7, 0xc0,
-    0xf8, 0xc7, 0xc0,
-    0xf1, 0xe3, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xc3, 0xf0, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0x8f, 0xfc, 0x40,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_28_0x57 = { image_data_twr_font_ubuntu_28_0x57, 27, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x58[37] = {
+    0xf0, 0xf0, 0xf0, 0xa3, 0xa3, 0x33, 0x83, 0x53, 0x63, 0x63, 0x63, 0x73,
+    0x43, 0x93, 0x23, 0xa3, 0x23, 0xb6, 0xd4, 0xe4, 0xe4, 0xd6, 0xb3, 0x23,
+    0xa3, 0x23, 0x93, 0x43, 0x73, 0x63, 0x54, 0x64, 0x43, 0x83, 0x33, 0xa3,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x58 = { image_data_twr_font_ubuntu_28_0x58,
-    18, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x59[84] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0x1f, 0xfc, 0x00,
-    0x8f, 0xf8, 0x80,
-    0x8f, 0xf8, 0x80,
-    0xc7, 0xf1, 0x80,
-    0xe3, 0xe3, 0x80,
-    0xe3, 0xe3, 0x80,
-    0xf1, 0xc7, 0x80,
-    0xf8, 0x8f, 0x80,
-    0xf8, 0x8f, 0x80,
-    0xfc, 0x1f, 0x80,
-    0xfe, 0x3f, 0x80,
-    0xfe, 0x3f, 0x80,
-    0xfe, 0x3f, 0x80,
-    0xfe, 0x3f, 0x80,
-    0xfe, 0x3f, 0x80,
-    0xfe, 0x3f, 0x80,
-    0xfe, 0x3f, 0x80,
-    0xfe, 0x3f, 0x80,
-    0xfe, 0x3f, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_28_0x58 = { image_data_twr_font_ubuntu_28_0x58, 18, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x59[32] = {
+    0xf0, 0xf0, 0xf0, 0x63, 0xb3, 0x13, 0x93, 0x23, 0x93, 0x33, 0x73, 0x53,
+    0x53, 0x63, 0x53, 0x73, 0x33, 0x93, 0x13, 0xa3, 0x13, 0xb5, 0xd3, 0xe3,
+    0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x59 = { image_data_twr_font_ubuntu_28_0x59,
-    17, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x5a[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xc0, 0x01,
-    0xc0, 0x01,
-    0xff, 0xf1,
-    0xff, 0xe3,
-    0xff, 0xc7,
-    0xff, 0x8f,
-    0xff, 0x8f,
-    0xff, 0x1f,
-    0xfe, 0x3f,
-    0xfc, 0x7f,
-    0xfc, 0x7f,
-    0xf8, 0xff,
-    0xf1, 0xff,
-    0xf1, 0xff,
-    0xe3, 0xff,
-    0xe3, 0xff,
-    0xc7, 0xff,
-    0x80, 0x01,
-    0x80, 0x01,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x59 = { image_data_twr_font_ubuntu_28_0x59, 17, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x5a[23] = {
+    0xf0, 0xf0, 0xf0, 0x5d, 0x3d, 0xd3, 0xc3, 0xc3, 0xc3, 0xd3, 0xc3, 0xc3,
+    0xc3, 0xd3, 0xc3, 0xc3, 0xd3, 0xc3, 0xd3, 0xc3, 0xce, 0x2e, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x5a = { image_data_twr_font_ubuntu_28_0x5a,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x5b[56] = {
-    0xe0, 0x00,
-    0xe0, 0x00,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe0, 0x00,
-    0xe0, 0x00,
-    0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_28_0x5a = { image_data_twr_font_ubuntu_28_0x5a, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x5b[28] = {
+    0x36, 0x36, 0x33, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x66, 0x36, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x5b = { image_data_twr_font_ubuntu_28_0x5b,
-    9, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x5c[56] = {
-    0x7f, 0xe0,
-    0x3f, 0xe0,
-    0x3f, 0xe0,
-    0x3f, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0xcf, 0xe0,
-    0xcf, 0xe0,
-    0xc7, 0xe0,
-    0xe7, 0xe0,
-    0xe7, 0xe0,
-    0xf3, 0xe0,
-    0xf3, 0xe0,
-    0xf3, 0xe0,
-    0xf9, 0xe0,
-    0xf9, 0xe0,
-    0xf8, 0xe0,
-    0xfc, 0xe0,
-    0xfc, 0xe0,
-    0xfe, 0x60,
-    0xfe, 0x60,
-    0xfe, 0x60,
-    0xff, 0x20,
-    0xff, 0x20,
-    0xff, 0x20,
-    0xff, 0x80,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_28_0x5b = { image_data_twr_font_ubuntu_28_0x5b, 9, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x5c[28] = {
+    0x01, 0xa2, 0x92, 0x92, 0xa2, 0x92, 0x92, 0xa2, 0x92, 0x93, 0x92, 0x92,
+    0xa2, 0x92, 0x92, 0xa2, 0x92, 0x93, 0x92, 0x92, 0xa2, 0x92, 0x92, 0xa2,
+    0x92, 0x92, 0xa2, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x5c = { image_data_twr_font_ubuntu_28_0x5c,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x5d[56] = {
-    0x03, 0x80,
-    0x03, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0x03, 0x80,
-    0x03, 0x80,
-    0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_28_0x5c = { image_data_twr_font_ubuntu_28_0x5c, 11, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x5d[28] = {
+    0x06, 0x36, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x36, 0x36, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x5d = { image_data_twr_font_ubuntu_28_0x5d,
-    9, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x5e[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xfc, 0x7f,
-    0xf8, 0x3f,
-    0xf8, 0x3f,
-    0xf1, 0x1f,
-    0xf1, 0x1f,
-    0xe3, 0x8f,
-    0xe3, 0x8f,
-    0xc7, 0xc7,
-    0xcf, 0xe7,
-    0x8f, 0xe3,
-    0xdf, 0xf7,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x5d = { image_data_twr_font_ubuntu_28_0x5d, 9, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x5e[23] = {
+    0xf0, 0xf0, 0xf0, 0x93, 0xc5, 0xb5, 0xa3, 0x13, 0x93, 0x13, 0x83, 0x33,
+    0x73, 0x33, 0x63, 0x53, 0x52, 0x72, 0x43, 0x73, 0x41, 0x91, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x5e = { image_data_twr_font_ubuntu_28_0x5e,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x5f[56] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0x00, 0x00,
-    0x00, 0x00,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_28_0x5e = { image_data_twr_font_ubuntu_28_0x5e, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x5f[26] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x5f,
+    0x0d, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x5f = { image_data_twr_font_ubuntu_28_0x5f,
-    14, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x60[56] = {
-    0xff, 0xe0,
-    0xef, 0xe0,
-    0xc7, 0xe0,
-    0xe3, 0xe0,
-    0xf1, 0xe0,
-    0xfb, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_28_0x5f = { image_data_twr_font_ubuntu_28_0x5f, 14, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x60[6] = {
+    0xe1, 0x93, 0x93, 0x93, 0x91, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x60 = { image_data_twr_font_ubuntu_28_0x60,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x61[56] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xe0, 0x3e,
-    0xe0, 0x0e,
-    0xff, 0x8e,
-    0xff, 0xc6,
-    0xff, 0xc6,
-    0xff, 0xc6,
-    0xf0, 0x06,
-    0xc0, 0x06,
-    0x87, 0xc6,
-    0x8f, 0xc6,
-    0x8f, 0xc6,
-    0x8f, 0xc6,
-    0x87, 0xc6,
-    0xc0, 0x06,
-    0xf0, 0x06,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_28_0x60 = { image_data_twr_font_ubuntu_28_0x60, 11, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x61[28] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x37, 0x89, 0xc3, 0xd3, 0xc3,
+    0xc3, 0x69, 0x4b, 0x34, 0x53, 0x33, 0x63, 0x33, 0x63, 0x33, 0x63, 0x34,
+    0x53, 0x4b, 0x69, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x61 = { image_data_twr_font_ubuntu_28_0x61,
-    15, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x62[56] = {
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc4, 0x1f,
-    0xc0, 0x07,
-    0xc3, 0xc3,
-    0xc7, 0xe3,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xe1,
-    0xc7, 0xe3,
-    0xc7, 0xc7,
-    0xc0, 0x0f,
-    0xe0, 0x1f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x61 = { image_data_twr_font_ubuntu_28_0x61, 15, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x62[35] = {
+    0x23, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0x15, 0x7b, 0x54, 0x44,
+    0x43, 0x63, 0x43, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73,
+    0x33, 0x73, 0x33, 0x64, 0x33, 0x63, 0x43, 0x53, 0x5a, 0x78, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x62 = { image_data_twr_font_ubuntu_28_0x62,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x63[56] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xf8, 0x18,
-    0xf0, 0x08,
-    0xe3, 0xf8,
-    0xc7, 0xf8,
-    0xc7, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0x87, 0xf8,
-    0xc7, 0xf8,
-    0xc3, 0xe8,
-    0xe0, 0x08,
-    0xf8, 0x18,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_28_0x62 = { image_data_twr_font_ubuntu_28_0x62, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x63[23] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x66, 0x68, 0x43, 0x93, 0xa3, 0x93,
+    0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa4, 0x51, 0x49, 0x66, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x63 = { image_data_twr_font_ubuntu_28_0x63,
-    13, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x64[56] = {
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xf8, 0x23,
-    0xe0, 0x03,
-    0xc3, 0xc3,
-    0xc7, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x87, 0xe3,
-    0xc7, 0xe3,
-    0xe3, 0xe3,
-    0xf0, 0x03,
-    0xf8, 0x07,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x63 = { image_data_twr_font_ubuntu_28_0x63, 13, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x64[35] = {
+    0xb3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0x75, 0x13, 0x5b, 0x44, 0x44,
+    0x43, 0x63, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73,
+    0x33, 0x73, 0x34, 0x63, 0x43, 0x63, 0x53, 0x53, 0x6a, 0x78, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x64 = { image_data_twr_font_ubuntu_28_0x64,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x65[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xfc, 0x1f,
-    0xf0, 0x07,
-    0xe3, 0xc3,
-    0xc7, 0xe3,
-    0xcf, 0xf1,
-    0x8f, 0xf1,
-    0x80, 0x01,
-    0x80, 0x01,
-    0x8f, 0xff,
-    0x8f, 0xff,
-    0x87, 0xff,
-    0xc7, 0xff,
-    0xe1, 0xfb,
-    0xf0, 0x03,
-    0xfc, 0x07,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x64 = { image_data_twr_font_ubuntu_28_0x64, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x65[28] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xd5, 0x99, 0x63, 0x44, 0x43,
+    0x63, 0x42, 0x83, 0x23, 0x83, 0x2e, 0x2e, 0x23, 0xd3, 0xd4, 0xd3, 0xe4,
+    0x61, 0x6a, 0x87, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x65 = { image_data_twr_font_ubuntu_28_0x65,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x66[56] = {
-    0xf8, 0x00,
-    0xe0, 0x00,
-    0xe3, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc0, 0x20,
-    0xc0, 0x20,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_28_0x65 = { image_data_twr_font_ubuntu_28_0x65, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x66[23] = {
+    0x56, 0x38, 0x33, 0x73, 0x83, 0x83, 0x83, 0x88, 0x38, 0x33, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x66 = { image_data_twr_font_ubuntu_28_0x66,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x67[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xf8, 0x07,
-    0xf0, 0x03,
-    0xc3, 0xe3,
-    0xc7, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0xc7, 0xe3,
-    0xc3, 0xc3,
-    0xe0, 0x03,
-    0xf8, 0x23,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xc3,
-    0xdf, 0x87,
-    0xc0, 0x0f,
-    0xe0, 0x3f,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x66 = { image_data_twr_font_ubuntu_28_0x66, 11, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x67[40] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xc8, 0x7a, 0x44, 0x53, 0x43,
+    0x63, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33,
+    0x73, 0x43, 0x63, 0x44, 0x44, 0x5b, 0x75, 0x13, 0xd3, 0xd3, 0xc4, 0x41,
+    0x64, 0x5a, 0x77, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x67 = { image_data_twr_font_ubuntu_28_0x67,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x68[56] = {
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc0, 0x1f,
-    0xc0, 0x0f,
-    0xc7, 0xc7,
-    0xc7, 0xc3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x67 = { image_data_twr_font_ubuntu_28_0x67, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x68[36] = {
+    0x23, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd9, 0x7a, 0x63, 0x53, 0x53,
+    0x54, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43,
+    0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x68 = { image_data_twr_font_ubuntu_28_0x68,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x69[28] = {
-    0xfe,
-    0xc6,
-    0xc6,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
+static const twr_font_image_t twr_font_ubuntu_28_0x68 = { image_data_twr_font_ubuntu_28_0x68, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x69[20] = {
+    0x93, 0x43, 0xf0, 0xf0, 0x23, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x69 = { image_data_twr_font_ubuntu_28_0x69,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x6a[28] = {
-    0xfe,
-    0xc6,
-    0xc6,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0x8e,
-    0x0e,
-    0x3e,
-    0xfe
+static const twr_font_image_t twr_font_ubuntu_28_0x69 = { image_data_twr_font_ubuntu_28_0x69, 7, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x6a[25] = {
+    0x93, 0x43, 0xf0, 0xf0, 0x23, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x33, 0x34, 0x32,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x6a = { image_data_twr_font_ubuntu_28_0x6a,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x6b[56] = {
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xc2,
-    0xc7, 0xc6,
-    0xc7, 0x8e,
-    0xc7, 0x1e,
-    0xc6, 0x3e,
-    0xc4, 0x7e,
-    0xc0, 0xfe,
-    0xc0, 0x7e,
-    0xc4, 0x3e,
-    0xc6, 0x1e,
-    0xc7, 0x0e,
-    0xc7, 0x86,
-    0xc7, 0xc6,
-    0xc7, 0xc2,
-    0xc7, 0xe0,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_28_0x6a = { image_data_twr_font_ubuntu_28_0x6a, 7, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x6b[36] = {
+    0x23, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x54, 0x33, 0x53, 0x43,
+    0x43, 0x53, 0x33, 0x63, 0x23, 0x73, 0x13, 0x86, 0x97, 0x83, 0x14, 0x73,
+    0x24, 0x63, 0x34, 0x53, 0x44, 0x43, 0x53, 0x43, 0x54, 0x33, 0x64, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x6b = { image_data_twr_font_ubuntu_28_0x6b,
-    15, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x6c[28] = {
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc3,
-    0xe1,
-    0xf1,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x6b = { image_data_twr_font_ubuntu_28_0x6b, 15, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x6c[23] = {
+    0x23, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x53, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x6c = { image_data_twr_font_ubuntu_28_0x6c,
-    8, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x6d[112] = {
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xe0, 0x1c, 0x0f, 0x80,
-    0xc0, 0x00, 0x03, 0x80,
-    0xc7, 0xc3, 0xe3, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_28_0x6c = { image_data_twr_font_ubuntu_28_0x6c, 8, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x6d[55] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xd8,
+    0x36, 0x7f, 0x05, 0x53, 0x54, 0x53, 0x53, 0x63, 0x63, 0x43, 0x63, 0x63,
+    0x43, 0x63, 0x63, 0x43, 0x63, 0x63, 0x43, 0x63, 0x63, 0x43, 0x63, 0x63,
+    0x43, 0x63, 0x63, 0x43, 0x63, 0x63, 0x43, 0x63, 0x63, 0x43, 0x63, 0x63,
+    0x43, 0x63, 0x63, 0x43, 0x63, 0x63, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x6d = { image_data_twr_font_ubuntu_28_0x6d,
-    25, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x6e[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xe0, 0x1f,
-    0xc0, 0x0f,
-    0xc7, 0xc7,
-    0xc7, 0xc3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x6d = { image_data_twr_font_ubuntu_28_0x6d, 25, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x6e[36] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xa8, 0x7a, 0x63, 0x53, 0x53,
+    0x54, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43,
+    0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x6e = { image_data_twr_font_ubuntu_28_0x6e,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x6f[84] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xfc, 0x1f, 0x80,
-    0xf0, 0x07, 0x80,
-    0xe3, 0xe3, 0x80,
-    0xc7, 0xf1, 0x80,
-    0xc7, 0xf1, 0x80,
-    0x8f, 0xf8, 0x80,
-    0x8f, 0xf8, 0x80,
-    0x8f, 0xf8, 0x80,
-    0x8f, 0xf8, 0x80,
-    0x8f, 0xf8, 0x80,
-    0xc7, 0xf1, 0x80,
-    0xc7, 0xf1, 0x80,
-    0xe3, 0xe3, 0x80,
-    0xf0, 0x07, 0x80,
-    0xfc, 0x1f, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_28_0x6e = { image_data_twr_font_ubuntu_28_0x6e, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x6f[35] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x55, 0xa9, 0x73, 0x53,
+    0x53, 0x73, 0x43, 0x73, 0x33, 0x93, 0x23, 0x93, 0x23, 0x93, 0x23, 0x93,
+    0x23, 0x93, 0x33, 0x73, 0x43, 0x73, 0x53, 0x53, 0x79, 0xa5, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x6f = { image_data_twr_font_ubuntu_28_0x6f,
-    17, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x70[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xe0, 0x1f,
-    0xc0, 0x0f,
-    0xc7, 0xc7,
-    0xc7, 0xe3,
-    0xc7, 0xe1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xe3,
-    0xc3, 0xc3,
-    0xc0, 0x07,
-    0xc4, 0x1f,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x6f = { image_data_twr_font_ubuntu_28_0x6f, 17, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x70[40] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xa8, 0x7a, 0x63, 0x53, 0x53,
+    0x63, 0x43, 0x64, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33,
+    0x73, 0x33, 0x73, 0x33, 0x63, 0x44, 0x44, 0x4b, 0x53, 0x15, 0x73, 0xd3,
+    0xd3, 0xd3, 0xd3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x70 = { image_data_twr_font_ubuntu_28_0x70,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x71[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xf8, 0x07,
-    0xf0, 0x03,
-    0xe3, 0xe3,
-    0xc7, 0xe3,
-    0x87, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0xc7, 0xe3,
-    0xc3, 0xc3,
-    0xe0, 0x03,
-    0xf8, 0x23,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x70 = { image_data_twr_font_ubuntu_28_0x70, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x71[40] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xc8, 0x7a, 0x53, 0x53, 0x43,
+    0x63, 0x34, 0x63, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33,
+    0x73, 0x33, 0x73, 0x43, 0x63, 0x44, 0x44, 0x5b, 0x75, 0x13, 0xd3, 0xd3,
+    0xd3, 0xd3, 0xd3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x71 = { image_data_twr_font_ubuntu_28_0x71,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x72[56] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xf0, 0x00,
-    0xc0, 0x00,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_28_0x71 = { image_data_twr_font_ubuntu_28_0x71, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x72[21] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x67, 0x29, 0x23, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x72 = { image_data_twr_font_ubuntu_28_0x72,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x73[56] = {
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xf0, 0x30,
-    0xc0, 0x30,
-    0x87, 0xb0,
-    0x8f, 0xf0,
-    0x8f, 0xf0,
-    0x87, 0xf0,
-    0x81, 0xf0,
-    0xc0, 0x30,
-    0xf8, 0x10,
-    0xfe, 0x10,
-    0xff, 0x10,
-    0xff, 0x10,
-    0xbe, 0x10,
-    0x80, 0x30,
-    0xc0, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
+static const twr_font_image_t twr_font_ubuntu_28_0x72 = { image_data_twr_font_ubuntu_28_0x72, 11, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x73[23] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xd6, 0x48, 0x34, 0x41, 0x33, 0x93, 0x94,
+    0x86, 0x78, 0x76, 0x84, 0x93, 0x93, 0x21, 0x54, 0x29, 0x46, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x73 = { image_data_twr_font_ubuntu_28_0x73,
-    12, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x74[56] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc0, 0x60,
-    0xc0, 0x60,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc3, 0xa0,
-    0xe0, 0x20,
-    0xf0, 0x60,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_28_0x73 = { image_data_twr_font_ubuntu_28_0x73, 12, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x74[23] = {
+    0xf0, 0x93, 0x83, 0x83, 0x83, 0x83, 0x87, 0x47, 0x43, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x31, 0x47, 0x55, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x74 = { image_data_twr_font_ubuntu_28_0x74,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x75[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc3, 0xe3,
-    0xe3, 0xe3,
-    0xf0, 0x03,
-    0xf8, 0x07,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x74 = { image_data_twr_font_ubuntu_28_0x74, 11, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x75[36] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x93, 0x63, 0x43, 0x63, 0x43,
+    0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43,
+    0x63, 0x43, 0x63, 0x43, 0x63, 0x44, 0x53, 0x53, 0x53, 0x6a, 0x78, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x75 = { image_data_twr_font_ubuntu_28_0x75,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x76[56] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0x1f, 0xc0,
-    0x1f, 0xc0,
-    0x8f, 0x88,
-    0x8f, 0x88,
-    0x8f, 0x88,
-    0xc7, 0x18,
-    0xc7, 0x18,
-    0xc7, 0x18,
-    0xe2, 0x38,
-    0xe2, 0x38,
-    0xe0, 0x38,
-    0xf0, 0x78,
-    0xf0, 0x78,
-    0xf0, 0x78,
-    0xf8, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_28_0x75 = { image_data_twr_font_ubuntu_28_0x75, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x76[31] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x13, 0x76, 0x73, 0x13, 0x53, 0x23,
+    0x53, 0x23, 0x53, 0x33, 0x33, 0x43, 0x33, 0x43, 0x33, 0x53, 0x13, 0x63,
+    0x13, 0x67, 0x75, 0x85, 0x85, 0x93, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x76 = { image_data_twr_font_ubuntu_28_0x76,
-    13, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x77[84] = {
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0x1f, 0x8f, 0xc0,
-    0x1f, 0x8f, 0xc0,
-    0x9f, 0x8f, 0xc8,
-    0x8f, 0x07, 0x88,
-    0x8f, 0x07, 0x88,
-    0x8f, 0x27, 0x88,
-    0xce, 0x23, 0x98,
-    0xce, 0x23, 0x98,
-    0xc6, 0x73, 0x18,
-    0xc4, 0x71, 0x18,
-    0xe4, 0x71, 0x38,
-    0xe4, 0xf9, 0x38,
-    0xe0, 0xf8, 0x38,
-    0xf0, 0xf8, 0x78,
-    0xf1, 0xfc, 0x78,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_28_0x76 = { image_data_twr_font_ubuntu_28_0x76, 13, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x77[58] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xc3, 0x63, 0x66,
+    0x63, 0x63, 0x12, 0x63, 0x62, 0x23, 0x45, 0x43, 0x23, 0x45, 0x43, 0x23,
+    0x42, 0x12, 0x43, 0x32, 0x33, 0x13, 0x32, 0x42, 0x33, 0x13, 0x32, 0x43,
+    0x22, 0x32, 0x23, 0x43, 0x13, 0x33, 0x13, 0x52, 0x13, 0x33, 0x12, 0x62,
+    0x12, 0x52, 0x12, 0x65, 0x55, 0x74, 0x54, 0x83, 0x73, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x77 = { image_data_twr_font_ubuntu_28_0x77,
-    21, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x78[56] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0x1f, 0xc4,
-    0x8f, 0x8c,
-    0xc7, 0x1c,
-    0xc7, 0x1c,
-    0xe2, 0x3c,
-    0xf0, 0x7c,
-    0xf8, 0xfc,
-    0xf8, 0xfc,
-    0xf0, 0x7c,
-    0xf0, 0x7c,
-    0xe2, 0x3c,
-    0xc7, 0x1c,
-    0xc7, 0x1c,
-    0x8f, 0x8c,
-    0x1f, 0xc4,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_28_0x77 = { image_data_twr_font_ubuntu_28_0x77, 21, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x78[32] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x83, 0x73, 0x23, 0x53, 0x43, 0x33,
+    0x53, 0x33, 0x63, 0x13, 0x85, 0xa3, 0xb3, 0xa5, 0x95, 0x83, 0x13, 0x63,
+    0x33, 0x53, 0x33, 0x43, 0x53, 0x23, 0x73, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x78 = { image_data_twr_font_ubuntu_28_0x78,
-    14, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x79[56] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0x1f, 0xc4,
-    0x1f, 0xc4,
-    0x8f, 0x8c,
-    0x8f, 0x8c,
-    0x8f, 0x8c,
-    0xc7, 0x1c,
-    0xc7, 0x1c,
-    0xc7, 0x1c,
-    0xe2, 0x3c,
-    0xe2, 0x3c,
-    0xe2, 0x3c,
-    0xe2, 0x7c,
-    0xf0, 0x7c,
-    0xf0, 0x7c,
-    0xf0, 0xfc,
-    0xf0, 0xfc,
-    0xf0, 0xfc,
-    0xf1, 0xfc,
-    0x03, 0xfc,
-    0x07, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_28_0x78 = { image_data_twr_font_ubuntu_28_0x78, 14, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x79[39] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x83, 0x73, 0x13, 0x73, 0x23, 0x53,
+    0x33, 0x53, 0x33, 0x53, 0x43, 0x33, 0x53, 0x33, 0x53, 0x33, 0x63, 0x13,
+    0x73, 0x13, 0x73, 0x13, 0x73, 0x12, 0x95, 0x95, 0x94, 0xa4, 0xa4, 0xa3,
+    0x76, 0x85, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x79 = { image_data_twr_font_ubuntu_28_0x79,
-    14, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x7a[56] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0x80, 0x08,
-    0x80, 0x08,
-    0xff, 0x88,
-    0xff, 0x18,
-    0xfe, 0x38,
-    0xfc, 0x78,
-    0xf8, 0xf8,
-    0xf8, 0xf8,
-    0xf1, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xc7, 0xf8,
-    0x8f, 0xf8,
-    0x80, 0x08,
-    0x80, 0x08,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_28_0x79 = { image_data_twr_font_ubuntu_28_0x79, 14, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x7a[22] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x2b, 0x2b, 0xa3, 0x93, 0x93, 0x93,
+    0x93, 0xa3, 0x93, 0x93, 0xa3, 0x93, 0x93, 0xab, 0x2b, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x7a = { image_data_twr_font_ubuntu_28_0x7a,
-    13, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x7b[56] = {
-    0xfc, 0x00,
-    0xf8, 0x00,
-    0xf0, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xe1, 0xc0,
-    0x83, 0xc0,
-    0x87, 0xc0,
-    0xe3, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf0, 0xc0,
-    0xf8, 0x00,
-    0xfe, 0x00,
-    0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_28_0x7a = { image_data_twr_font_ubuntu_28_0x7a, 13, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x7b[28] = {
+    0x64, 0x55, 0x44, 0x63, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x64,
+    0x45, 0x54, 0x83, 0x83, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+    0x74, 0x75, 0x73, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x7b = { image_data_twr_font_ubuntu_28_0x7b,
-    10, 28/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_28_0x7b = { image_data_twr_font_ubuntu_28_0x7b, 10, 28, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 #if (0x0 == 0x0)
 static const uint8_t image_data_twr_font_ubuntu_28_0x7c[28] = {
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xff
+    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
+    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
+    0xe7, 0xe7, 0xe7, 0xff
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x7c = { image_data_twr_font_ubuntu_28_0x7c,
-    8, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x7d[56] = {
-    0x1f, 0x80,
-    0x0f, 0x80,
-    0x87, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc3, 0x80,
-    0xe0, 0x80,
-    0xf0, 0x80,
-    0xe3, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0x87, 0x80,
-    0x0f, 0x80,
-    0x3f, 0x80,
-    0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_28_0x7c = { image_data_twr_font_ubuntu_28_0x7c, 8, 28, TWR_FONT_IMAGE_FORMAT_RAW };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x7d[28] = {
+    0x03, 0x64, 0x64, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x64,
+    0x65, 0x54, 0x43, 0x53, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x54, 0x44, 0x52, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x7d = { image_data_twr_font_ubuntu_28_0x7d,
-    9, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x7e[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xe1, 0xf3,
-    0xc0, 0x63,
-    0x8c, 0x07,
-    0x9f, 0x0f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0x7d = { image_data_twr_font_ubuntu_28_0x7d, 9, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0x7e[21] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf4, 0x52, 0x47, 0x23, 0x33, 0x27, 0x42, 0x54, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0x7e = { image_data_twr_font_ubuntu_28_0x7e,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xb0[56] = {
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xc1, 0x80,
-    0x9c, 0x80,
-    0x9c, 0x80,
-    0x9c, 0x80,
-    0xc1, 0x80,
-    0xe3, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_28_0x7e = { image_data_twr_font_ubuntu_28_0x7e, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0xb0[11] = {
+    0xc3, 0x55, 0x32, 0x32, 0x22, 0x32, 0x22, 0x32, 0x35, 0x53, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0xb0 = { image_data_twr_font_ubuntu_28_0xb0,
-    9, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xb9[56] = {
-    0xff, 0xf0,
-    0xee, 0xf0,
-    0xc4, 0x70,
-    0xe0, 0xf0,
-    0xf1, 0xf0,
-    0xfb, 0xf0,
-    0xff, 0xf0,
-    0xf0, 0x30,
-    0xc0, 0x30,
-    0x87, 0xb0,
-    0x8f, 0xf0,
-    0x8f, 0xf0,
-    0x87, 0xf0,
-    0x81, 0xf0,
-    0xc0, 0x30,
-    0xf8, 0x10,
-    0xfe, 0x10,
-    0xff, 0x10,
-    0xff, 0x10,
-    0xbe, 0x10,
-    0x80, 0x30,
-    0xc0, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
+static const twr_font_image_t twr_font_ubuntu_28_0xb0 = { image_data_twr_font_ubuntu_28_0xb0, 9, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0xb9[26] = {
+    0xf1, 0x31, 0x63, 0x13, 0x65, 0x83, 0xa1, 0xf0, 0x76, 0x48, 0x34, 0x41,
+    0x33, 0x93, 0x94, 0x86, 0x78, 0x76, 0x84, 0x93, 0x93, 0x21, 0x54, 0x29,
+    0x46, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0xb9 = { image_data_twr_font_ubuntu_28_0xb9,
-    12, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xbb[56] = {
-    0xfe, 0x60,
-    0xfe, 0x60,
-    0xc6, 0x60,
-    0xc6, 0x60,
-    0xc6, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc0, 0x60,
-    0xc0, 0x60,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc3, 0xa0,
-    0xe0, 0x20,
-    0xf0, 0x60,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_28_0xb9 = { image_data_twr_font_ubuntu_28_0xb9, 12, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0xbb[27] = {
+    0x72, 0x92, 0x43, 0x22, 0x43, 0x22, 0x43, 0x21, 0x53, 0x83, 0x87, 0x47,
+    0x43, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x31,
+    0x47, 0x55, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0xbb = { image_data_twr_font_ubuntu_28_0xbb,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xbe[56] = {
-    0xff, 0xf8,
-    0xf7, 0x78,
-    0xe2, 0x38,
-    0xf0, 0x78,
-    0xf8, 0xf8,
-    0xfd, 0xf8,
-    0xff, 0xf8,
-    0x80, 0x08,
-    0x80, 0x08,
-    0xff, 0x88,
-    0xff, 0x18,
-    0xfe, 0x38,
-    0xfc, 0x78,
-    0xf8, 0xf8,
-    0xf8, 0xf8,
-    0xf1, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xc7, 0xf8,
-    0x8f, 0xf8,
-    0x80, 0x08,
-    0x80, 0x08,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_28_0xbb = { image_data_twr_font_ubuntu_28_0xbb, 11, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0xbe[25] = {
+    0xf0, 0x21, 0x31, 0x73, 0x13, 0x75, 0x93, 0xb1, 0xf0, 0x5b, 0x2b, 0xa3,
+    0x93, 0x93, 0x93, 0x93, 0xa3, 0x93, 0x93, 0xa3, 0x93, 0x93, 0xab, 0x2b,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0xbe = { image_data_twr_font_ubuntu_28_0xbe,
-    13, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xe1[56] = {
-    0xff, 0xfe,
-    0xff, 0xbe,
-    0xff, 0x1e,
-    0xfe, 0x3e,
-    0xfc, 0x7e,
-    0xfe, 0xfe,
-    0xff, 0xfe,
-    0xe0, 0x3e,
-    0xe0, 0x0e,
-    0xff, 0x8e,
-    0xff, 0xc6,
-    0xff, 0xc6,
-    0xff, 0xc6,
-    0xf0, 0x06,
-    0xc0, 0x06,
-    0x87, 0xc6,
-    0x8f, 0xc6,
-    0x8f, 0xc6,
-    0x8f, 0xc6,
-    0x87, 0xc6,
-    0xc0, 0x06,
-    0xf0, 0x06,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_28_0xbe = { image_data_twr_font_ubuntu_28_0xbe, 13, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0xe1[28] = {
+    0xf0, 0x91, 0xd3, 0xb3, 0xb3, 0xd1, 0xf0, 0xa7, 0x89, 0xc3, 0xd3, 0xc3,
+    0xc3, 0x69, 0x4b, 0x34, 0x53, 0x33, 0x63, 0x33, 0x63, 0x33, 0x63, 0x34,
+    0x53, 0x4b, 0x69, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0xe1 = { image_data_twr_font_ubuntu_28_0xe1,
-    15, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xe8[56] = {
-    0xff, 0xf8,
-    0xfb, 0xb8,
-    0xf1, 0x18,
-    0xf8, 0x38,
-    0xfc, 0x78,
-    0xfe, 0xf8,
-    0xff, 0xf8,
-    0xf8, 0x18,
-    0xf0, 0x08,
-    0xe3, 0xf8,
-    0xc7, 0xf8,
-    0xc7, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0x87, 0xf8,
-    0xc7, 0xf8,
-    0xc3, 0xe8,
-    0xe0, 0x08,
-    0xf8, 0x18,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_28_0xe1 = { image_data_twr_font_ubuntu_28_0xe1, 15, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0xe8[26] = {
+    0xf0, 0x31, 0x31, 0x73, 0x13, 0x75, 0x93, 0xb1, 0xf0, 0x86, 0x68, 0x43,
+    0x93, 0xa3, 0x93, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa4, 0x51, 0x49,
+    0x66, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0xe8 = { image_data_twr_font_ubuntu_28_0xe8,
-    13, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xe9[56] = {
-    0xff, 0xff,
-    0xff, 0xbf,
-    0xff, 0x1f,
-    0xfe, 0x3f,
-    0xfc, 0x7f,
-    0xfe, 0xff,
-    0xff, 0xff,
-    0xfc, 0x1f,
-    0xf0, 0x07,
-    0xe3, 0xc3,
-    0xc7, 0xe3,
-    0xcf, 0xf1,
-    0x8f, 0xf1,
-    0x80, 0x01,
-    0x80, 0x01,
-    0x8f, 0xff,
-    0x8f, 0xff,
-    0x87, 0xff,
-    0xc7, 0xff,
-    0xe1, 0xfb,
-    0xf0, 0x03,
-    0xfc, 0x07,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0xe8 = { image_data_twr_font_ubuntu_28_0xe8, 13, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0xe9[28] = {
+    0xf0, 0xa1, 0xe3, 0xc3, 0xc3, 0xe1, 0xf0, 0xf5, 0x99, 0x63, 0x44, 0x43,
+    0x63, 0x42, 0x83, 0x23, 0x83, 0x2e, 0x2e, 0x23, 0xd3, 0xd4, 0xd3, 0xe4,
+    0x61, 0x6a, 0x87, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0xe9 = { image_data_twr_font_ubuntu_28_0xe9,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xec[56] = {
-    0xfd, 0xdf,
-    0xf8, 0x8f,
-    0xfc, 0x1f,
-    0xfe, 0x3f,
-    0xff, 0x7f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xfc, 0x1f,
-    0xf0, 0x07,
-    0xe3, 0xc3,
-    0xc7, 0xe3,
-    0xcf, 0xf1,
-    0x8f, 0xf1,
-    0x80, 0x01,
-    0x80, 0x01,
-    0x8f, 0xff,
-    0x8f, 0xff,
-    0x87, 0xff,
-    0xc7, 0xff,
-    0xe1, 0xfb,
-    0xf0, 0x03,
-    0xfc, 0x07,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0xe9 = { image_data_twr_font_ubuntu_28_0xe9, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0xec[30] = {
+    0x61, 0x31, 0xa3, 0x13, 0xa5, 0xc3, 0xe1, 0xf0, 0xf0, 0xf5, 0x99, 0x63,
+    0x44, 0x43, 0x63, 0x42, 0x83, 0x23, 0x83, 0x2e, 0x2e, 0x23, 0xd3, 0xd4,
+    0xd3, 0xe4, 0x61, 0x6a, 0x87, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0xec = { image_data_twr_font_ubuntu_28_0xec,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xed[28] = {
-    0xfe,
-    0xfa,
-    0xf0,
-    0xe2,
-    0xc6,
-    0xee,
-    0xfe,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
+static const twr_font_image_t twr_font_ubuntu_28_0xec = { image_data_twr_font_ubuntu_28_0xec, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0xed[21] = {
+    0xc1, 0x53, 0x33, 0x33, 0x51, 0xc3, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0xed = { image_data_twr_font_ubuntu_28_0xed,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xef[84] = {
-    0xff, 0xe3, 0x80,
-    0xff, 0xe3, 0x80,
-    0xff, 0xe3, 0x80,
-    0xff, 0xe3, 0x80,
-    0xff, 0xe3, 0x90,
-    0xff, 0xe3, 0x90,
-    0xff, 0xe3, 0xf0,
-    0xf8, 0x23, 0xf0,
-    0xe0, 0x03, 0xf0,
-    0xc3, 0xc3, 0xf0,
-    0xc7, 0xe3, 0xf0,
-    0x8f, 0xe3, 0xf0,
-    0x8f, 0xe3, 0xf0,
-    0x8f, 0xe3, 0xf0,
-    0x8f, 0xe3, 0xf0,
-    0x8f, 0xe3, 0xf0,
-    0x8f, 0xe3, 0xf0,
-    0x87, 0xe3, 0xf0,
-    0xc7, 0xe3, 0xf0,
-    0xe3, 0xe3, 0xf0,
-    0xf0, 0x03, 0xf0,
-    0xf8, 0x07, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0
+static const twr_font_image_t twr_font_ubuntu_28_0xed = { image_data_twr_font_ubuntu_28_0xed, 7, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0xef[41] = {
+    0xb3, 0x33, 0xb3, 0x33, 0xb3, 0x33, 0xb3, 0x33, 0xb3, 0x32, 0xc3, 0x32,
+    0xc3, 0xb5, 0x13, 0x9b, 0x84, 0x44, 0x83, 0x63, 0x73, 0x73, 0x73, 0x73,
+    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x74, 0x63, 0x83, 0x63,
+    0x93, 0x53, 0xaa, 0xb8, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0xef = { image_data_twr_font_ubuntu_28_0xef,
-    20, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xf2[56] = {
-    0xff, 0xff,
-    0xfb, 0xbf,
-    0xf1, 0x1f,
-    0xf8, 0x3f,
-    0xfc, 0x7f,
-    0xfe, 0xff,
-    0xff, 0xff,
-    0xe0, 0x1f,
-    0xc0, 0x0f,
-    0xc7, 0xc7,
-    0xc7, 0xc3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0xef = { image_data_twr_font_ubuntu_28_0xef, 20, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0xf2[38] = {
+    0xf0, 0x61, 0x31, 0xa3, 0x13, 0xa5, 0xc3, 0xe1, 0xf0, 0xc8, 0x7a, 0x63,
+    0x53, 0x53, 0x54, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43,
+    0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43,
+    0x63, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0xf2 = { image_data_twr_font_ubuntu_28_0xf2,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xf8[56] = {
-    0xff, 0xe0,
-    0xf7, 0x60,
-    0xe2, 0x20,
-    0xf0, 0x60,
-    0xf8, 0xe0,
-    0xfd, 0xe0,
-    0xff, 0xe0,
-    0xf0, 0x00,
-    0xc0, 0x00,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_28_0xf2 = { image_data_twr_font_ubuntu_28_0xf2, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0xf8[24] = {
+    0xf1, 0x31, 0x53, 0x13, 0x55, 0x73, 0x91, 0xf0, 0x47, 0x29, 0x23, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0xf8 = { image_data_twr_font_ubuntu_28_0xf8,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xf9[56] = {
-    0xf8, 0x3f,
-    0xf3, 0x9f,
-    0xf3, 0x9f,
-    0xf3, 0x9f,
-    0xf3, 0x9f,
-    0xf8, 0x3f,
-    0xff, 0xff,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc3, 0xe3,
-    0xe3, 0xe3,
-    0xf0, 0x03,
-    0xf8, 0x07,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0xf8 = { image_data_twr_font_ubuntu_28_0xf8, 11, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0xf9[40] = {
+    0x55, 0xa2, 0x32, 0x92, 0x32, 0x92, 0x32, 0x92, 0x32, 0xa5, 0xf0, 0x93,
+    0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43,
+    0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x44, 0x53, 0x53,
+    0x53, 0x6a, 0x78, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0xf9 = { image_data_twr_font_ubuntu_28_0xf9,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xfa[56] = {
-    0xff, 0xff,
-    0xff, 0xbf,
-    0xff, 0x1f,
-    0xfe, 0x3f,
-    0xfc, 0x7f,
-    0xfe, 0xff,
-    0xff, 0xff,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc3, 0xe3,
-    0xe3, 0xe3,
-    0xf0, 0x03,
-    0xf8, 0x07,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_28_0xf9 = { image_data_twr_font_ubuntu_28_0xf9, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0xfa[36] = {
+    0xf0, 0xa1, 0xe3, 0xc3, 0xc3, 0xe1, 0xf0, 0xb3, 0x63, 0x43, 0x63, 0x43,
+    0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43,
+    0x63, 0x43, 0x63, 0x43, 0x63, 0x44, 0x53, 0x53, 0x53, 0x6a, 0x78, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0xfa = { image_data_twr_font_ubuntu_28_0xfa,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xfd[56] = {
-    0xff, 0xfc,
-    0xff, 0x7c,
-    0xfe, 0x3c,
-    0xfc, 0x7c,
-    0xf8, 0xfc,
-    0xfd, 0xfc,
-    0xff, 0xfc,
-    0x1f, 0xc4,
-    0x1f, 0xc4,
-    0x8f, 0x8c,
-    0x8f, 0x8c,
-    0x8f, 0x8c,
-    0xc7, 0x1c,
-    0xc7, 0x1c,
-    0xc7, 0x1c,
-    0xe2, 0x3c,
-    0xe2, 0x3c,
-    0xe2, 0x3c,
-    0xe2, 0x7c,
-    0xf0, 0x7c,
-    0xf0, 0x7c,
-    0xf0, 0xfc,
-    0xf0, 0xfc,
-    0xf0, 0xfc,
-    0xf1, 0xfc,
-    0x03, 0xfc,
-    0x07, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_28_0xfa = { image_data_twr_font_ubuntu_28_0xfa, 16, 28, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_28_0xfd[40] = {
+    0xf0, 0x71, 0xc3, 0xa3, 0xa3, 0xc1, 0xf0, 0x63, 0x73, 0x13, 0x73, 0x23,
+    0x53, 0x33, 0x53, 0x33, 0x53, 0x43, 0x33, 0x53, 0x33, 0x53, 0x33, 0x63,
+    0x13, 0x73, 0x13, 0x73, 0x13, 0x73, 0x12, 0x95, 0x95, 0x94, 0xa4, 0xa4,
+    0xa3, 0x76, 0x85, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_28_0xfd = { image_data_twr_font_ubuntu_28_0xfd,
-    14, 28/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_28_0xfd = { image_data_twr_font_ubuntu_28_0xfd, 14, 28, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 
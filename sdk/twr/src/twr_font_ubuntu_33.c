@@ -14,7 +14,7 @@
 *
 * preset name: HARDWARIO LCD Module
 * data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
+* RLE compression enabled: no, converted by sdk/tools/font_rle.py
 * conversion type: Monochrome, Diffuse Dither 128
 * bits per pixel: 1
 *
@@ -31,4403 +31,1050 @@
 
 
 #if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x20[33] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
+static const uint8_t image_data_twr_font_ubuntu_33_0x20[1] = {
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x20 = { image_data_twr_font_ubuntu_33_0x20,
-    7, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x21[66] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xf7, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xc1, 0x80,
-    0xc1, 0x80,
-    0xe3, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_33_0x20 = { image_data_twr_font_ubuntu_33_0x20, 7, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x21[24] = {
+    0xf0, 0xf0, 0x93, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x71, 0xf0, 0xf0, 0x43, 0x55, 0x45, 0x53, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x21 = { image_data_twr_font_ubuntu_33_0x21,
-    9, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x22[66] = {
-    0xff, 0xf8,
-    0xc7, 0x18,
-    0xc7, 0x18,
-    0xc7, 0x18,
-    0xc7, 0x18,
-    0xc7, 0x18,
-    0xc7, 0x18,
-    0xc7, 0x18,
-    0xef, 0xb8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_33_0x21 = { image_data_twr_font_ubuntu_33_0x21, 9, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x22[17] = {
+    0xf3, 0x33, 0x43, 0x33, 0x43, 0x33, 0x43, 0x33, 0x43, 0x33, 0x43, 0x33,
+    0x43, 0x33, 0x51, 0x51, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x22 = { image_data_twr_font_ubuntu_33_0x22,
-    13, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x23[99] = {
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0x1c, 0x78,
-    0xff, 0x1c, 0x78,
-    0xff, 0x1c, 0x78,
-    0xfe, 0x38, 0xf8,
-    0xfe, 0x38, 0xf8,
-    0xfe, 0x38, 0xf8,
-    0xc0, 0x00, 0x18,
-    0xc0, 0x00, 0x18,
-    0xc0, 0x00, 0x18,
-    0xfc, 0x71, 0xf8,
-    0xfc, 0x71, 0xf8,
-    0xfc, 0x71, 0xf8,
-    0xfc, 0x71, 0xf8,
-    0xc0, 0x00, 0x18,
-    0xc0, 0x00, 0x18,
-    0xc0, 0x00, 0x18,
-    0xf8, 0xe3, 0xf8,
-    0xf8, 0xe3, 0xf8,
-    0xf8, 0xe3, 0xf8,
-    0xf1, 0xc7, 0xf8,
-    0xf1, 0xc7, 0xf8,
-    0xf1, 0xc7, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_33_0x22 = { image_data_twr_font_ubuntu_33_0x22, 13, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x23[51] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x23, 0x33, 0xc3, 0x33, 0xc3, 0x33,
+    0xb3, 0x33, 0xc3, 0x33, 0xc3, 0x33, 0x7f, 0x02, 0x4f, 0x02, 0x4f, 0x02,
+    0x83, 0x33, 0xc3, 0x33, 0xc3, 0x33, 0xc3, 0x33, 0x8f, 0x02, 0x4f, 0x02,
+    0x4f, 0x02, 0x73, 0x33, 0xc3, 0x33, 0xc3, 0x33, 0xb3, 0x33, 0xc3, 0x33,
+    0xc3, 0x33, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x23 = { image_data_twr_font_ubuntu_33_0x23,
-    21, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x24[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xfc, 0x03, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xe0, 0x01, 0xc0,
-    0xc3, 0xfb, 0xc0,
-    0xc7, 0xff, 0xc0,
-    0xc7, 0xff, 0xc0,
-    0xc7, 0xff, 0xc0,
-    0xc3, 0xff, 0xc0,
-    0xe0, 0x7f, 0xc0,
-    0xf0, 0x1f, 0xc0,
-    0xfc, 0x07, 0xc0,
-    0xff, 0x03, 0xc0,
-    0xff, 0xe1, 0xc0,
-    0xff, 0xf0, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xe7, 0xf0, 0xc0,
-    0xc0, 0x01, 0xc0,
-    0xc0, 0x03, 0xc0,
-    0xf0, 0x07, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x23 = { image_data_twr_font_ubuntu_33_0x23, 21, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x24[33] = {
+    0xf0, 0xb3, 0xf3, 0xf3, 0xf3, 0xd8, 0x8b, 0x6c, 0x54, 0x71, 0x63, 0xf3,
+    0xf3, 0xf4, 0xf6, 0xd7, 0xd7, 0xd6, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0x52,
+    0x74, 0x4d, 0x5c, 0x89, 0xd3, 0xf3, 0xf3, 0xf3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x24 = { image_data_twr_font_ubuntu_33_0x24,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x25[132] = {
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xf8, 0x3f, 0xc7, 0xe0,
-    0xe0, 0x0f, 0x8f, 0xe0,
-    0xe3, 0x8f, 0x8f, 0xe0,
-    0xc7, 0xc7, 0x1f, 0xe0,
-    0xc7, 0xc7, 0x1f, 0xe0,
-    0xc7, 0xc6, 0x3f, 0xe0,
-    0xc7, 0xc4, 0x7f, 0xe0,
-    0xc7, 0xc4, 0x7f, 0xe0,
-    0xe3, 0x88, 0xff, 0xe0,
-    0xe0, 0x08, 0xff, 0xe0,
-    0xf8, 0x31, 0xff, 0xe0,
-    0xff, 0xf1, 0x83, 0xe0,
-    0xff, 0xe2, 0x00, 0xe0,
-    0xff, 0xe2, 0x38, 0xe0,
-    0xff, 0xc4, 0x7c, 0x60,
-    0xff, 0xc4, 0x7c, 0x60,
-    0xff, 0x8c, 0x7c, 0x60,
-    0xff, 0x1c, 0x7c, 0x60,
-    0xff, 0x1c, 0x7c, 0x60,
-    0xfe, 0x3e, 0x38, 0xe0,
-    0xfe, 0x3e, 0x00, 0xe0,
-    0xfc, 0x7f, 0x83, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_33_0x24 = { image_data_twr_font_ubuntu_33_0x24, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x25[69] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x85, 0x83, 0x99, 0x53, 0xa3,
+    0x33, 0x53, 0x93, 0x53, 0x33, 0xa3, 0x53, 0x33, 0xa3, 0x53, 0x23, 0xb3,
+    0x53, 0x13, 0xc3, 0x53, 0x13, 0xd3, 0x33, 0x13, 0xe9, 0x13, 0xf0, 0x15,
+    0x23, 0xf0, 0x93, 0x25, 0xf0, 0x13, 0x19, 0xe3, 0x13, 0x33, 0xd3, 0x13,
+    0x53, 0xc3, 0x13, 0x53, 0xb3, 0x23, 0x53, 0xa3, 0x33, 0x53, 0xa3, 0x33,
+    0x53, 0x93, 0x53, 0x33, 0xa3, 0x59, 0x93, 0x85, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x25 = { image_data_twr_font_ubuntu_33_0x25,
-    27, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x26[99] = {
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xfc, 0x0f, 0xf8,
-    0xf8, 0x03, 0xf8,
-    0xf0, 0x03, 0xf8,
-    0xe1, 0xe1, 0xf8,
-    0xe3, 0xf1, 0xf8,
-    0xe3, 0xf1, 0xf8,
-    0xe3, 0xe1, 0xf8,
-    0xf3, 0x83, 0xf8,
-    0xf0, 0x07, 0xf8,
-    0xf8, 0x1f, 0xf8,
-    0xf0, 0x3f, 0xf8,
-    0xe0, 0x3f, 0x98,
-    0xc1, 0x1f, 0x18,
-    0xc7, 0x8f, 0x18,
-    0x8f, 0xc6, 0x38,
-    0x8f, 0xe0, 0x38,
-    0x8f, 0xf0, 0x78,
-    0x8f, 0xf8, 0xf8,
-    0xc3, 0xf0, 0x78,
-    0xc0, 0x00, 0x38,
-    0xe0, 0x07, 0x18,
-    0xf8, 0x1f, 0x88,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_33_0x25 = { image_data_twr_font_ubuntu_33_0x25, 27, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x26[47] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf6, 0xe9, 0xba, 0xa4, 0x44, 0x93, 0x63,
+    0x93, 0x63, 0x93, 0x54, 0xa2, 0x35, 0xb9, 0xd6, 0xe6, 0xe7, 0x72, 0x45,
+    0x13, 0x53, 0x43, 0x43, 0x43, 0x33, 0x63, 0x23, 0x43, 0x77, 0x43, 0x85,
+    0x53, 0x93, 0x74, 0x65, 0x6f, 0x01, 0x6a, 0x33, 0x76, 0x63, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x26 = { image_data_twr_font_ubuntu_33_0x26,
-    21, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x27[33] = {
-    0xff,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xef,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff
+static const twr_font_image_t twr_font_ubuntu_33_0x26 = { image_data_twr_font_ubuntu_33_0x26, 21, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x27[9] = {
+    0xa3, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x61, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x27 = { image_data_twr_font_ubuntu_33_0x27,
-    8, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x28[66] = {
-    0xff, 0xe0,
-    0xff, 0xa0,
-    0xff, 0x00,
-    0xfe, 0x20,
-    0xfc, 0x60,
-    0xfc, 0x60,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xfc, 0x60,
-    0xfc, 0x60,
-    0xfe, 0x20,
-    0xff, 0x00,
-    0xff, 0xa0,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_33_0x27 = { image_data_twr_font_ubuntu_33_0x27, 8, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x28[33] = {
+    0xf0, 0x51, 0x93, 0x73, 0x73, 0x83, 0x73, 0x83, 0x73, 0x83, 0x83, 0x83,
+    0x73, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x93, 0x83, 0x83,
+    0x83, 0x93, 0x83, 0x93, 0x83, 0x93, 0x93, 0x91, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x28 = { image_data_twr_font_ubuntu_33_0x28,
-    11, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x29[66] = {
-    0xff, 0xc0,
-    0x7f, 0xc0,
-    0x3f, 0xc0,
-    0x1f, 0xc0,
-    0x8f, 0xc0,
-    0x8f, 0xc0,
-    0xc7, 0xc0,
-    0xc7, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xc7, 0xc0,
-    0xc7, 0xc0,
-    0x8f, 0xc0,
-    0x8f, 0xc0,
-    0x1f, 0xc0,
-    0x3f, 0xc0,
-    0x7f, 0xc0,
-    0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x28 = { image_data_twr_font_ubuntu_33_0x28, 11, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x29[32] = {
+    0xa1, 0x92, 0x83, 0x83, 0x73, 0x83, 0x73, 0x83, 0x73, 0x73, 0x73, 0x83,
+    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x63, 0x73, 0x73, 0x73,
+    0x63, 0x73, 0x63, 0x73, 0x63, 0x72, 0x81, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x29 = { image_data_twr_font_ubuntu_33_0x29,
-    10, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x2a[66] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xdc, 0x76,
-    0x86, 0xc2,
-    0xc0, 0x06,
-    0xfc, 0x7e,
-    0xf9, 0x3e,
-    0xf1, 0x1e,
-    0xf1, 0x1e,
-    0xe3, 0x8e,
-    0xfb, 0xbe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_33_0x29 = { image_data_twr_font_ubuntu_33_0x29, 10, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x2a[26] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0x63, 0xc3, 0xc3, 0x81, 0x33, 0x31, 0x34, 0x21,
+    0x24, 0x3b, 0x83, 0xb2, 0x12, 0x93, 0x13, 0x83, 0x13, 0x73, 0x33, 0x81,
+    0x31, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x2a = { image_data_twr_font_ubuntu_33_0x2a,
-    15, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x2b[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xc0, 0x00, 0x40,
-    0xc0, 0x00, 0x40,
-    0xc0, 0x00, 0x40,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x2a = { image_data_twr_font_ubuntu_33_0x2a, 15, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x2b[27] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x53,
+    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x9f, 0x3f, 0x3f, 0x93, 0xf3, 0xf3, 0xf3,
+    0xf3, 0xf3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x2b = { image_data_twr_font_ubuntu_33_0x2b,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x2c[33] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe7,
-    0xe7,
-    0xc7,
-    0xef,
-    0xff,
-    0xff
+static const twr_font_image_t twr_font_ubuntu_33_0x2b = { image_data_twr_font_ubuntu_33_0x2b, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x2c[21] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe3,
+    0x53, 0x53, 0x53, 0x53, 0x52, 0x62, 0x53, 0x61, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x2c = { image_data_twr_font_ubuntu_33_0x2c,
-    8, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x2d[66] = {
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0x80, 0x40,
-    0x80, 0x40,
-    0x80, 0x40,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x2c = { image_data_twr_font_ubuntu_33_0x2c, 8, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x2d[14] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x18, 0x28,
+    0x28, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x2d = { image_data_twr_font_ubuntu_33_0x2d,
-    10, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x2e[33] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xe7,
-    0xc3,
-    0xc3,
-    0xe7,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff
+static const twr_font_image_t twr_font_ubuntu_33_0x2d = { image_data_twr_font_ubuntu_33_0x2d, 10, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x2e[16] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe2,
+    0x54, 0x44, 0x52, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x2e = { image_data_twr_font_ubuntu_33_0x2e,
-    8, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x2f[66] = {
-    0xff, 0xf8,
-    0xff, 0xc0,
-    0xff, 0x88,
-    0xff, 0x88,
-    0xff, 0x88,
-    0xff, 0x18,
-    0xff, 0x18,
-    0xff, 0x18,
-    0xfe, 0x38,
-    0xfe, 0x38,
-    0xfe, 0x38,
-    0xfc, 0x78,
-    0xfc, 0x78,
-    0xfc, 0x78,
-    0xf8, 0xf8,
-    0xf8, 0xf8,
-    0xf0, 0xf8,
-    0xf1, 0xf8,
-    0xf1, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xc7, 0xf8,
-    0xc7, 0xf8,
-    0xc7, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0x1f, 0xf8,
-    0x1f, 0xf8,
-    0x1f, 0xf8,
-    0x3f, 0xf8,
-    0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_33_0x2e = { image_data_twr_font_ubuntu_33_0x2e, 8, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x2f[33] = {
+    0xf0, 0x83, 0x93, 0xa3, 0xa3, 0x93, 0xa3, 0xa3, 0x93, 0xa3, 0xa3, 0x93,
+    0xa3, 0xa3, 0x93, 0xa3, 0x94, 0x93, 0xa3, 0x93, 0xa3, 0xa3, 0x93, 0xa3,
+    0xa3, 0x93, 0xa3, 0xa3, 0x93, 0xa3, 0xa3, 0xa2, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x2f = { image_data_twr_font_ubuntu_33_0x2f,
-    13, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x30[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xfe, 0x1f, 0xc0,
-    0xf8, 0x07, 0xc0,
-    0xf0, 0x03, 0xc0,
-    0xe1, 0xe1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe1, 0xe1, 0xc0,
-    0xf0, 0x03, 0xc0,
-    0xf8, 0x07, 0xc0,
-    0xfe, 0x1f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x2f = { image_data_twr_font_ubuntu_33_0x2f, 13, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x30[44] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x44, 0xc8, 0x9a, 0x74, 0x44, 0x63, 0x63,
+    0x63, 0x63, 0x53, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83,
+    0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x53, 0x63,
+    0x63, 0x63, 0x64, 0x44, 0x7a, 0x98, 0xc4, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x30 = { image_data_twr_font_ubuntu_33_0x30,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x31[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x0f, 0xc0,
-    0xfc, 0x0f, 0xc0,
-    0xf0, 0x0f, 0xc0,
-    0xe0, 0x0f, 0xc0,
-    0xe1, 0x8f, 0xc0,
-    0xf7, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x30 = { image_data_twr_font_ubuntu_33_0x30, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x31[30] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x63, 0xe4, 0xc6, 0xa8, 0x99, 0x94, 0x23,
+    0xa1, 0x43, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
+    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x31 = { image_data_twr_font_ubuntu_33_0x31,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x32[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xf8, 0x1f, 0xc0,
-    0xe0, 0x07, 0xc0,
-    0xc0, 0x03, 0xc0,
-    0xe3, 0xc1, 0xc0,
-    0xef, 0xf1, 0xc0,
-    0xff, 0xf1, 0xc0,
-    0xff, 0xf1, 0xc0,
-    0xff, 0xf1, 0xc0,
-    0xff, 0xe3, 0xc0,
-    0xff, 0xc3, 0xc0,
-    0xff, 0xc7, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xfe, 0x3f, 0xc0,
-    0xfc, 0x7f, 0xc0,
-    0xf8, 0xff, 0xc0,
-    0xf1, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x31 = { image_data_twr_font_ubuntu_33_0x31, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x32[30] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x26, 0xaa, 0x7c, 0x73, 0x45, 0x61, 0x83,
+    0xf3, 0xf3, 0xf3, 0xe3, 0xe4, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3,
+    0xe3, 0xf3, 0xee, 0x4e, 0x4e, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x32 = { image_data_twr_font_ubuntu_33_0x32,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x33[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xf8, 0x0f, 0xc0,
-    0xc0, 0x07, 0xc0,
-    0xc0, 0x03, 0xc0,
-    0xe7, 0xe1, 0xc0,
-    0xff, 0xf1, 0xc0,
-    0xff, 0xf1, 0xc0,
-    0xff, 0xf1, 0xc0,
-    0xff, 0xc3, 0xc0,
-    0xfc, 0x07, 0xc0,
-    0xfc, 0x07, 0xc0,
-    0xfc, 0x03, 0xc0,
-    0xff, 0xc1, 0xc0,
-    0xff, 0xf0, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xff, 0xf0, 0xc0,
-    0xcf, 0xe1, 0xc0,
-    0xc0, 0x03, 0xc0,
-    0xc0, 0x07, 0xc0,
-    0xf0, 0x1f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x32 = { image_data_twr_font_ubuntu_33_0x32, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x33[30] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x27, 0x8b, 0x7c, 0x72, 0x64, 0xf3, 0xf3,
+    0xf3, 0xd4, 0xa7, 0xb7, 0xb8, 0xe5, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xe4,
+    0x42, 0x74, 0x5c, 0x6b, 0x97, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x33 = { image_data_twr_font_ubuntu_33_0x33,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x34[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xe3, 0xc0,
-    0xff, 0xc3, 0xc0,
-    0xff, 0x83, 0xc0,
-    0xff, 0x03, 0xc0,
-    0xfe, 0x03, 0xc0,
-    0xfc, 0x23, 0xc0,
-    0xf8, 0x63, 0xc0,
-    0xf8, 0xe3, 0xc0,
-    0xf1, 0xe3, 0xc0,
-    0xe3, 0xe3, 0xc0,
-    0xe3, 0xe3, 0xc0,
-    0xc7, 0xe3, 0xc0,
-    0x8f, 0xe3, 0xc0,
-    0x80, 0x00, 0x40,
-    0x80, 0x00, 0x40,
-    0x80, 0x00, 0x40,
-    0xff, 0xe3, 0xc0,
-    0xff, 0xe3, 0xc0,
-    0xff, 0xe3, 0xc0,
-    0xff, 0xe3, 0xc0,
-    0xff, 0xe3, 0xc0,
-    0xff, 0xe3, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x33 = { image_data_twr_font_ubuntu_33_0x33, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x34[39] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x83, 0xe4, 0xd5, 0xc6, 0xb7, 0xa4, 0x13,
+    0x94, 0x23, 0x93, 0x33, 0x83, 0x43, 0x73, 0x53, 0x73, 0x53, 0x63, 0x63,
+    0x53, 0x73, 0x5f, 0x01, 0x2f, 0x01, 0x2f, 0x01, 0xc3, 0xf3, 0xf3, 0xf3,
+    0xf3, 0xf3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x34 = { image_data_twr_font_ubuntu_33_0x34,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x35[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xf1, 0xff, 0xc0,
-    0xf1, 0xff, 0xc0,
-    0xf1, 0xff, 0xc0,
-    0xf1, 0xff, 0xc0,
-    0xf1, 0xff, 0xc0,
-    0xf0, 0x3f, 0xc0,
-    0xe0, 0x07, 0xc0,
-    0xe0, 0x03, 0xc0,
-    0xff, 0x81, 0xc0,
-    0xff, 0xf1, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xff, 0xf0, 0xc0,
-    0xcf, 0xe1, 0xc0,
-    0xc0, 0x01, 0xc0,
-    0xc0, 0x07, 0xc0,
-    0xf0, 0x1f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x34 = { image_data_twr_font_ubuntu_33_0x34, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x35[30] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x1b, 0x7b, 0x7b, 0x73, 0xf3, 0xf3, 0xf3,
+    0xf3, 0xf6, 0xba, 0x8b, 0xd6, 0xf3, 0xf0, 0x13, 0xf3, 0xf3, 0xf3, 0xe4,
+    0x42, 0x74, 0x5d, 0x5b, 0x97, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x35 = { image_data_twr_font_ubuntu_33_0x35,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x36[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xe1, 0xc0,
-    0xff, 0x01, 0xc0,
-    0xfc, 0x01, 0xc0,
-    0xf8, 0x1f, 0xc0,
-    0xf0, 0xff, 0xc0,
-    0xf1, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe4, 0x0f, 0xc0,
-    0xc0, 0x03, 0xc0,
-    0xc0, 0x01, 0xc0,
-    0xc3, 0xe1, 0xc0,
-    0xc7, 0xf0, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc3, 0xf8, 0xc0,
-    0xe3, 0xf0, 0xc0,
-    0xe1, 0xe1, 0xc0,
-    0xf0, 0x03, 0xc0,
-    0xf8, 0x03, 0xc0,
-    0xfc, 0x0f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x35 = { image_data_twr_font_ubuntu_33_0x35, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x36[37] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x84, 0xb7, 0x99, 0x86, 0xb4, 0xe3, 0xe3,
+    0xf3, 0xf2, 0x16, 0x8c, 0x6d, 0x54, 0x54, 0x53, 0x74, 0x43, 0x83, 0x43,
+    0x83, 0x43, 0x83, 0x44, 0x73, 0x53, 0x64, 0x54, 0x44, 0x7a, 0x99, 0xa6,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x36 = { image_data_twr_font_ubuntu_33_0x36,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x37[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xff, 0xf9, 0xc0,
-    0xff, 0xf1, 0xc0,
-    0xff, 0xe3, 0xc0,
-    0xff, 0xc7, 0xc0,
-    0xff, 0xc7, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xfe, 0x3f, 0xc0,
-    0xfe, 0x3f, 0xc0,
-    0xfe, 0x3f, 0xc0,
-    0xfc, 0x7f, 0xc0,
-    0xfc, 0x7f, 0xc0,
-    0xfc, 0x7f, 0xc0,
-    0xfc, 0xff, 0xc0,
-    0xf8, 0xff, 0xc0,
-    0xf8, 0xff, 0xc0,
-    0xf8, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x36 = { image_data_twr_font_ubuntu_33_0x36, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x37[27] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0x4e, 0x4e, 0xf2, 0xf3, 0xe3, 0xe3, 0xf3,
+    0xe3, 0xf3, 0xe3, 0xf3, 0xe3, 0xf3, 0xf3, 0xe3, 0xf3, 0xf3, 0xf2, 0xf3,
+    0xf3, 0xf3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x37 = { image_data_twr_font_ubuntu_33_0x37,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x38[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xfc, 0x0f, 0xc0,
-    0xf8, 0x07, 0xc0,
-    0xf0, 0x03, 0xc0,
-    0xe1, 0xe1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe1, 0xf1, 0xc0,
-    0xf0, 0xe3, 0xc0,
-    0xf8, 0x07, 0xc0,
-    0xfc, 0x0f, 0xc0,
-    0xf0, 0x03, 0xc0,
-    0xe3, 0xc1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc3, 0xf8, 0xc0,
-    0xe1, 0xe0, 0xc0,
-    0xe0, 0x01, 0xc0,
-    0xf0, 0x03, 0xc0,
-    0xfc, 0x0f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x37 = { image_data_twr_font_ubuntu_33_0x37, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x38[41] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x36, 0xb8, 0x9a, 0x74, 0x44, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x64, 0x53, 0x74, 0x33, 0x98, 0xb6, 0xaa, 0x73,
+    0x45, 0x63, 0x63, 0x53, 0x83, 0x43, 0x83, 0x43, 0x83, 0x44, 0x73, 0x54,
+    0x45, 0x5c, 0x7a, 0xa6, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x38 = { image_data_twr_font_ubuntu_33_0x38,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x39[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xfc, 0x0f, 0xc0,
-    0xf0, 0x07, 0xc0,
-    0xf0, 0x03, 0xc0,
-    0xe1, 0xe1, 0xc0,
-    0xc3, 0xf1, 0xc0,
-    0xc7, 0xf0, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc3, 0xf8, 0xc0,
-    0xe1, 0xf0, 0xc0,
-    0xe0, 0x00, 0xc0,
-    0xf0, 0x00, 0xc0,
-    0xfc, 0x08, 0xc0,
-    0xff, 0xf1, 0xc0,
-    0xff, 0xf1, 0xc0,
-    0xff, 0xe3, 0xc0,
-    0xff, 0xc3, 0xc0,
-    0xfe, 0x07, 0xc0,
-    0xe0, 0x0f, 0xc0,
-    0xe0, 0x3f, 0xc0,
-    0xe1, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x38 = { image_data_twr_font_ubuntu_33_0x38, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x39[37] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x36, 0xa9, 0x9a, 0x74, 0x44, 0x54, 0x63,
+    0x53, 0x74, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x44, 0x73, 0x54, 0x54,
+    0x5d, 0x6c, 0x86, 0x13, 0xe3, 0xf3, 0xe3, 0xe4, 0xb6, 0x89, 0x97, 0xb4,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x39 = { image_data_twr_font_ubuntu_33_0x39,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x3a[33] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xe7,
-    0xc3,
-    0xc3,
-    0xe7,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xe7,
-    0xc3,
-    0xc3,
-    0xe7,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff
+static const twr_font_image_t twr_font_ubuntu_33_0x39 = { image_data_twr_font_ubuntu_33_0x39, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x3a[18] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0x54, 0x44, 0x52, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf0, 0x32, 0x54, 0x44, 0x52, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x3a = { image_data_twr_font_ubuntu_33_0x3a,
-    8, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x3b[33] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xe7,
-    0xc3,
-    0xc3,
-    0xe7,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe7,
-    0xe7,
-    0xc7,
-    0xef,
-    0xff,
-    0xff
+static const twr_font_image_t twr_font_ubuntu_33_0x3a = { image_data_twr_font_ubuntu_33_0x3a, 8, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x3b[23] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0x54, 0x44, 0x52, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf0, 0x33, 0x53, 0x53, 0x53, 0x53, 0x52, 0x62, 0x53, 0x61, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x3b = { image_data_twr_font_ubuntu_33_0x3b,
-    8, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x3c[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xfe, 0xc0,
-    0xff, 0xf0, 0xc0,
-    0xff, 0xc0, 0x40,
-    0xfe, 0x01, 0xc0,
-    0xf8, 0x0f, 0xc0,
-    0xe0, 0x3f, 0xc0,
-    0xc1, 0xff, 0xc0,
-    0xc7, 0xff, 0xc0,
-    0xc1, 0xff, 0xc0,
-    0xe0, 0x3f, 0xc0,
-    0xf8, 0x0f, 0xc0,
-    0xfe, 0x01, 0xc0,
-    0xff, 0xc0, 0x40,
-    0xff, 0xf0, 0xc0,
-    0xff, 0xfe, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x3b = { image_data_twr_font_ubuntu_33_0x3b, 8, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x3c[28] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xc1,
+    0xe4, 0xc7, 0x88, 0x87, 0x97, 0xa5, 0xd3, 0xf5, 0xe7, 0xd7, 0xd8, 0xd7,
+    0xd4, 0xf0, 0x21, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x3c = { image_data_twr_font_ubuntu_33_0x3c,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x3d[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0x80, 0x00, 0xc0,
-    0x80, 0x00, 0xc0,
-    0x80, 0x00, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0x80, 0x00, 0xc0,
-    0x80, 0x00, 0xc0,
-    0x80, 0x00, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x3c = { image_data_twr_font_ubuntu_33_0x3c, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x3d[24] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf0, 0x4f, 0x3f, 0x3f, 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0x3f, 0x3f, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x3d = { image_data_twr_font_ubuntu_33_0x3d,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x3e[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xef, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xc0, 0x7f, 0xc0,
-    0xf0, 0x1f, 0xc0,
-    0xfc, 0x07, 0xc0,
-    0xff, 0x81, 0xc0,
-    0xff, 0xe0, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xff, 0xe0, 0xc0,
-    0xff, 0x81, 0xc0,
-    0xfc, 0x07, 0xc0,
-    0xf0, 0x1f, 0xc0,
-    0xc0, 0x7f, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xef, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x3d = { image_data_twr_font_ubuntu_33_0x3d, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x3e[27] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0xf0,
+    0x23, 0xe7, 0xd7, 0xd7, 0xe6, 0xe5, 0xf3, 0xd5, 0xb6, 0x97, 0x97, 0x97,
+    0xc3, 0xf1, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x3e = { image_data_twr_font_ubuntu_33_0x3e,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x3f[66] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xe0, 0x78,
-    0x80, 0x18,
-    0x80, 0x18,
-    0xdf, 0x08,
-    0xff, 0x88,
-    0xff, 0x88,
-    0xff, 0x88,
-    0xff, 0x18,
-    0xff, 0x18,
-    0xfc, 0x38,
-    0xf8, 0x78,
-    0xf8, 0xf8,
-    0xf1, 0xf8,
-    0xf1, 0xf8,
-    0xf1, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xf1, 0xf8,
-    0xf1, 0xf8,
-    0xf1, 0xf8,
-    0xf1, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_33_0x3e = { image_data_twr_font_ubuntu_33_0x3e, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x3f[27] = {
+    0xf0, 0xf0, 0xf0, 0xa6, 0x5a, 0x3a, 0x41, 0x54, 0xa3, 0xa3, 0xa3, 0x93,
+    0xa3, 0x84, 0x84, 0x93, 0x93, 0xa3, 0xa3, 0xf0, 0xf0, 0xf0, 0x43, 0xa3,
+    0xa3, 0xa3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x3f = { image_data_twr_font_ubuntu_33_0x3f,
-    13, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x40[132] = {
-    0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xe0, 0x1f, 0xfc,
-    0xff, 0x80, 0x03, 0xfc,
-    0xfe, 0x00, 0x01, 0xfc,
-    0xfc, 0x0f, 0xe0, 0xfc,
-    0xf8, 0x3f, 0xf8, 0x7c,
-    0xf0, 0xff, 0xfc, 0x3c,
-    0xf1, 0xff, 0xfe, 0x1c,
-    0xe1, 0xf8, 0x1f, 0x1c,
-    0xe3, 0xe0, 0x0f, 0x1c,
-    0xe3, 0xc0, 0x0f, 0x8c,
-    0xc7, 0xc3, 0x8f, 0x8c,
-    0xc7, 0x87, 0x8f, 0x8c,
-    0xc7, 0x8f, 0x8f, 0x8c,
-    0xc7, 0x8f, 0x8f, 0x8c,
-    0xc7, 0x8f, 0x8f, 0x8c,
-    0xc7, 0x8f, 0x8f, 0x0c,
-    0xc7, 0x87, 0x8f, 0x1c,
-    0xc7, 0xc7, 0x8e, 0x1c,
-    0xc3, 0xc0, 0x00, 0x3c,
-    0xe3, 0xe0, 0x00, 0x7c,
-    0xe1, 0xf0, 0x60, 0xfc,
-    0xf1, 0xff, 0xff, 0xfc,
-    0xf0, 0xff, 0xff, 0xfc,
-    0xf8, 0x3f, 0xff, 0xfc,
-    0xfc, 0x0f, 0xef, 0xfc,
-    0xfe, 0x00, 0x0f, 0xfc,
-    0xff, 0x80, 0x0f, 0xfc,
-    0xff, 0xe0, 0x0f, 0xfc,
-    0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_33_0x3f = { image_data_twr_font_ubuntu_33_0x3f, 13, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x40[84] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xb8, 0xf0, 0x5d, 0xff, 0x01, 0xd6,
+    0x75, 0xb5, 0xb4, 0x94, 0xe4, 0x83, 0xf0, 0x14, 0x64, 0x66, 0x53, 0x63,
+    0x59, 0x43, 0x63, 0x4a, 0x53, 0x43, 0x54, 0x33, 0x53, 0x43, 0x44, 0x43,
+    0x53, 0x43, 0x43, 0x53, 0x53, 0x43, 0x43, 0x53, 0x53, 0x43, 0x43, 0x53,
+    0x53, 0x43, 0x43, 0x53, 0x44, 0x43, 0x44, 0x43, 0x43, 0x53, 0x53, 0x43,
+    0x34, 0x54, 0x4f, 0x01, 0x73, 0x5e, 0x84, 0x55, 0x25, 0xa3, 0xf0, 0xc4,
+    0xf0, 0xc5, 0xf0, 0xb6, 0x71, 0xf0, 0x2d, 0xf0, 0x4b, 0xf0, 0x69, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x40 = { image_data_twr_font_ubuntu_33_0x40,
-    30, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x41[99] = {
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0x8f, 0xf8,
-    0xff, 0x07, 0xf8,
-    0xff, 0x07, 0xf8,
-    0xff, 0x07, 0xf8,
-    0xfe, 0x23, 0xf8,
-    0xfe, 0x23, 0xf8,
-    0xfc, 0x71, 0xf8,
-    0xfc, 0x71, 0xf8,
-    0xf8, 0x70, 0xf8,
-    0xf8, 0xf8, 0xf8,
-    0xf8, 0xf8, 0xf8,
-    0xf1, 0xfc, 0x78,
-    0xf1, 0xfc, 0x78,
-    0xe1, 0xfc, 0x38,
-    0xe0, 0x00, 0x38,
-    0xe0, 0x00, 0x38,
-    0xc0, 0x00, 0x18,
-    0xc7, 0xff, 0x18,
-    0x87, 0xff, 0x08,
-    0x8f, 0xff, 0x88,
-    0x8f, 0xff, 0x88,
-    0x1f, 0xff, 0xc0,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_33_0x40 = { image_data_twr_font_ubuntu_33_0x40, 30, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x41[48] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x33, 0xf0, 0x25, 0xf0, 0x15, 0xf0,
+    0x15, 0xf3, 0x13, 0xe3, 0x13, 0xd3, 0x33, 0xc3, 0x33, 0xb4, 0x34, 0xa3,
+    0x53, 0xa3, 0x53, 0x93, 0x73, 0x83, 0x73, 0x74, 0x74, 0x6f, 0x6f, 0x5f,
+    0x02, 0x43, 0xb3, 0x34, 0xb4, 0x23, 0xd3, 0x23, 0xd3, 0x13, 0xf3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x41 = { image_data_twr_font_ubuntu_33_0x41,
-    21, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x42[99] = {
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xe0, 0x03, 0xf8,
-    0xe0, 0x00, 0xf8,
-    0xe0, 0x00, 0x78,
-    0xe3, 0xf8, 0x38,
-    0xe3, 0xfc, 0x38,
-    0xe3, 0xfe, 0x38,
-    0xe3, 0xfe, 0x38,
-    0xe3, 0xfe, 0x38,
-    0xe3, 0xf8, 0x78,
-    0xe0, 0x00, 0xf8,
-    0xe0, 0x00, 0xf8,
-    0xe0, 0x00, 0x78,
-    0xe3, 0xfc, 0x38,
-    0xe3, 0xfe, 0x18,
-    0xe3, 0xff, 0x18,
-    0xe3, 0xff, 0x18,
-    0xe3, 0xff, 0x18,
-    0xe3, 0xfe, 0x18,
-    0xe3, 0xf8, 0x38,
-    0xe0, 0x00, 0x38,
-    0xe0, 0x00, 0xf8,
-    0xe0, 0x03, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_33_0x41 = { image_data_twr_font_ubuntu_33_0x41, 21, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x42[41] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xcb, 0xad, 0x8e, 0x73, 0x75, 0x63, 0x84,
+    0x63, 0x93, 0x63, 0x93, 0x63, 0x93, 0x63, 0x74, 0x7d, 0x8d, 0x8e, 0x73,
+    0x84, 0x63, 0x94, 0x53, 0xa3, 0x53, 0xa3, 0x53, 0xa3, 0x53, 0x94, 0x53,
+    0x75, 0x6f, 0x6d, 0x8b, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x42 = { image_data_twr_font_ubuntu_33_0x42,
-    21, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x43[99] = {
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0x80, 0x70,
-    0xfe, 0x00, 0x10,
-    0xf8, 0x00, 0x10,
-    0xf8, 0x3f, 0x30,
-    0xf0, 0xff, 0xf0,
-    0xe1, 0xff, 0xf0,
-    0xe3, 0xff, 0xf0,
-    0xc3, 0xff, 0xf0,
-    0xc7, 0xff, 0xf0,
-    0xc7, 0xff, 0xf0,
-    0xc7, 0xff, 0xf0,
-    0xc7, 0xff, 0xf0,
-    0xc7, 0xff, 0xf0,
-    0xc7, 0xff, 0xf0,
-    0xc3, 0xff, 0xf0,
-    0xe3, 0xff, 0xf0,
-    0xe1, 0xff, 0xf0,
-    0xf0, 0xff, 0xf0,
-    0xf0, 0x7f, 0x30,
-    0xf8, 0x00, 0x10,
-    0xfe, 0x00, 0x10,
-    0xff, 0x80, 0x70,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0
+static const twr_font_image_t twr_font_ubuntu_33_0x42 = { image_data_twr_font_ubuntu_33_0x42, 21, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x43[43] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe8, 0xac, 0x6e, 0x65, 0x62, 0x64, 0xf4,
+    0xf0, 0x13, 0xf0, 0x14, 0xf0, 0x13, 0xf0, 0x23, 0xf0, 0x23, 0xf0, 0x23,
+    0xf0, 0x23, 0xf0, 0x23, 0xf0, 0x24, 0xf0, 0x23, 0xf0, 0x24, 0xf0, 0x24,
+    0xf0, 0x15, 0x72, 0x7e, 0x8c, 0xa8, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x43 = { image_data_twr_font_ubuntu_33_0x43,
-    20, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x44[99] = {
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xe0, 0x07, 0xfe,
-    0xe0, 0x00, 0xfe,
-    0xe0, 0x00, 0x7e,
-    0xe3, 0xf8, 0x3e,
-    0xe3, 0xfe, 0x1e,
-    0xe3, 0xff, 0x0e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x86,
-    0xe3, 0xff, 0xc6,
-    0xe3, 0xff, 0xc6,
-    0xe3, 0xff, 0xc6,
-    0xe3, 0xff, 0xc6,
-    0xe3, 0xff, 0xc6,
-    0xe3, 0xff, 0xc6,
-    0xe3, 0xff, 0x86,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x0e,
-    0xe3, 0xfe, 0x1e,
-    0xe3, 0xf8, 0x3e,
-    0xe0, 0x00, 0x7e,
-    0xe0, 0x00, 0xfe,
-    0xe0, 0x07, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_33_0x43 = { image_data_twr_font_ubuntu_33_0x43, 20, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x44[45] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x5a, 0xdd, 0xae, 0x93, 0x75, 0x83,
+    0x94, 0x73, 0xa4, 0x63, 0xb3, 0x63, 0xb4, 0x53, 0xc3, 0x53, 0xc3, 0x53,
+    0xc3, 0x53, 0xc3, 0x53, 0xc3, 0x53, 0xc3, 0x53, 0xb4, 0x53, 0xb3, 0x63,
+    0xa4, 0x63, 0x94, 0x73, 0x75, 0x8e, 0x9d, 0xaa, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x44 = { image_data_twr_font_ubuntu_33_0x44,
-    23, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x45[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xe0, 0x00, 0xc0,
-    0xe0, 0x00, 0xc0,
-    0xe0, 0x00, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe0, 0x01, 0xc0,
-    0xe0, 0x01, 0xc0,
-    0xe0, 0x01, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe0, 0x00, 0x40,
-    0xe0, 0x00, 0x40,
-    0xe0, 0x00, 0x40,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x44 = { image_data_twr_font_ubuntu_33_0x44, 23, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x45[27] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xfd, 0x5d, 0x5d, 0x53, 0xf3, 0xf3, 0xf3, 0xf3,
+    0xf3, 0xfc, 0x6c, 0x6c, 0x63, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xfe,
+    0x4e, 0x4e, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x45 = { image_data_twr_font_ubuntu_33_0x45,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x46[99] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xe0, 0x00, 0x80,
-    0xe0, 0x00, 0x80,
-    0xe0, 0x00, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe0, 0x01, 0x80,
-    0xe0, 0x01, 0x80,
-    0xe0, 0x01, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_33_0x45 = { image_data_twr_font_ubuntu_33_0x45, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x46[27] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xbd, 0x4d, 0x4d, 0x43, 0xe3, 0xe3, 0xe3, 0xe3,
+    0xe3, 0xec, 0x5c, 0x5c, 0x53, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3,
+    0xe3, 0xe3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x46 = { image_data_twr_font_ubuntu_33_0x46,
-    17, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x47[99] = {
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0x80, 0x7c,
-    0xfe, 0x00, 0x1c,
-    0xf8, 0x00, 0x1c,
-    0xf0, 0x3f, 0x3c,
-    0xf0, 0xff, 0xfc,
-    0xe1, 0xff, 0xfc,
-    0xe3, 0xff, 0xfc,
-    0xc3, 0xff, 0xfc,
-    0xc7, 0xff, 0xfc,
-    0xc7, 0xff, 0xfc,
-    0xc7, 0xff, 0xfc,
-    0xc7, 0xff, 0x1c,
-    0xc7, 0xff, 0x1c,
-    0xc7, 0xff, 0x1c,
-    0xc3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe1, 0xff, 0x1c,
-    0xf0, 0xff, 0x1c,
-    0xf0, 0x7f, 0x1c,
-    0xf8, 0x00, 0x1c,
-    0xfc, 0x00, 0x1c,
-    0xff, 0x80, 0x7c,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_33_0x46 = { image_data_twr_font_ubuntu_33_0x46, 17, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x47[45] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x78, 0xcc, 0x8e, 0x76, 0x62, 0x84,
+    0xf0, 0x24, 0xf0, 0x33, 0xf0, 0x34, 0xf0, 0x33, 0xf0, 0x43, 0xf0, 0x43,
+    0xf0, 0x43, 0xb3, 0x53, 0xb3, 0x53, 0xb3, 0x54, 0xa3, 0x63, 0xa3, 0x64,
+    0x93, 0x74, 0x83, 0x75, 0x73, 0x8e, 0x9d, 0xc8, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x47 = { image_data_twr_font_ubuntu_33_0x47,
-    22, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x48[99] = {
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe0, 0x00, 0x0e,
-    0xe0, 0x00, 0x0e,
-    0xe0, 0x00, 0x0e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_33_0x47 = { image_data_twr_font_ubuntu_33_0x47, 22, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x48[51] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x53, 0xb3, 0x63, 0xb3, 0x63, 0xb3,
+    0x63, 0xb3, 0x63, 0xb3, 0x63, 0xb3, 0x63, 0xb3, 0x63, 0xb3, 0x63, 0xb3,
+    0x6f, 0x02, 0x6f, 0x02, 0x6f, 0x02, 0x63, 0xb3, 0x63, 0xb3, 0x63, 0xb3,
+    0x63, 0xb3, 0x63, 0xb3, 0x63, 0xb3, 0x63, 0xb3, 0x63, 0xb3, 0x63, 0xb3,
+    0x63, 0xb3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x48 = { image_data_twr_font_ubuntu_33_0x48,
-    23, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x49[66] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_33_0x48 = { image_data_twr_font_ubuntu_33_0x48, 23, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x49[25] = {
+    0xf0, 0xf0, 0x93, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x49 = { image_data_twr_font_ubuntu_33_0x49,
-    9, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x4a[66] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0x87,
-    0x9f, 0x0f,
-    0x00, 0x0f,
-    0x00, 0x1f,
-    0xe0, 0x7f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_33_0x49 = { image_data_twr_font_ubuntu_33_0x49, 9, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x4a[28] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xe3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
+    0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xc4, 0x42, 0x54,
+    0x4c, 0x4b, 0x86, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x4a = { image_data_twr_font_ubuntu_33_0x4a,
-    16, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x4b[99] = {
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xe3, 0xfe, 0x10,
-    0xe3, 0xfc, 0x30,
-    0xe3, 0xf8, 0x70,
-    0xe3, 0xf0, 0xf0,
-    0xe3, 0xe1, 0xf0,
-    0xe3, 0xc3, 0xf0,
-    0xe3, 0x87, 0xf0,
-    0xe3, 0x0f, 0xf0,
-    0xe2, 0x1f, 0xf0,
-    0xe0, 0x3f, 0xf0,
-    0xe0, 0x7f, 0xf0,
-    0xe0, 0x1f, 0xf0,
-    0xe2, 0x0f, 0xf0,
-    0xe3, 0x07, 0xf0,
-    0xe3, 0x83, 0xf0,
-    0xe3, 0xe1, 0xf0,
-    0xe3, 0xf0, 0xf0,
-    0xe3, 0xf8, 0x70,
-    0xe3, 0xf8, 0x30,
-    0xe3, 0xfc, 0x30,
-    0xe3, 0xfe, 0x10,
-    0xe3, 0xff, 0x00,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0
+static const twr_font_image_t twr_font_ubuntu_33_0x4a = { image_data_twr_font_ubuntu_33_0x4a, 16, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x4b[47] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x83, 0x94, 0x43, 0x84, 0x53, 0x74, 0x63,
+    0x64, 0x73, 0x54, 0x83, 0x44, 0x93, 0x34, 0xa3, 0x24, 0xb3, 0x14, 0xc7,
+    0xd6, 0xe8, 0xc3, 0x15, 0xb3, 0x25, 0xa3, 0x35, 0x93, 0x54, 0x83, 0x64,
+    0x73, 0x74, 0x63, 0x75, 0x53, 0x84, 0x53, 0x94, 0x43, 0xa4, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x4b = { image_data_twr_font_ubuntu_33_0x4b,
-    20, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x4c[99] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe0, 0x00, 0x80,
-    0xe0, 0x00, 0x80,
-    0xe0, 0x00, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_33_0x4b = { image_data_twr_font_ubuntu_33_0x4b, 20, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x4c[27] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xb3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3,
+    0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xed,
+    0x4d, 0x4d, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x4c = { image_data_twr_font_ubuntu_33_0x4c,
-    17, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x4d[132] = {
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xf1, 0xff, 0xfc, 0x78,
-    0xf0, 0xff, 0xf8, 0x78,
-    0xf0, 0xff, 0xf8, 0x78,
-    0xf0, 0x7f, 0xf0, 0x78,
-    0xe0, 0x7f, 0xf0, 0x38,
-    0xe0, 0x3f, 0xe0, 0x38,
-    0xe2, 0x3f, 0xe2, 0x38,
-    0xe3, 0x1f, 0xc6, 0x38,
-    0xe3, 0x1f, 0xc6, 0x38,
-    0xe3, 0x8f, 0x8e, 0x38,
-    0xe3, 0x8f, 0x8e, 0x38,
-    0xe3, 0xc7, 0x1e, 0x38,
-    0xe3, 0xc7, 0x1e, 0x38,
-    0xe3, 0xe7, 0x3e, 0x38,
-    0xc3, 0xe2, 0x3e, 0x38,
-    0xc7, 0xf2, 0x7f, 0x18,
-    0xc7, 0xf0, 0x7f, 0x18,
-    0xc7, 0xf0, 0x7f, 0x18,
-    0xc7, 0xf8, 0xff, 0x18,
-    0xc7, 0xff, 0xff, 0x18,
-    0xc7, 0xff, 0xff, 0x18,
-    0xc7, 0xff, 0xff, 0x18,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_33_0x4c = { image_data_twr_font_ubuntu_33_0x4c, 17, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x4d[78] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf3, 0xf3, 0x84, 0xd4, 0x84,
+    0xd4, 0x85, 0xb5, 0x76, 0xb6, 0x67, 0x97, 0x63, 0x13, 0x93, 0x13, 0x63,
+    0x23, 0x73, 0x23, 0x63, 0x23, 0x73, 0x23, 0x63, 0x33, 0x53, 0x33, 0x63,
+    0x33, 0x53, 0x33, 0x63, 0x43, 0x33, 0x43, 0x63, 0x43, 0x33, 0x43, 0x63,
+    0x52, 0x32, 0x53, 0x54, 0x53, 0x13, 0x53, 0x53, 0x72, 0x12, 0x73, 0x43,
+    0x75, 0x73, 0x43, 0x75, 0x73, 0x43, 0x83, 0x83, 0x43, 0xf0, 0x43, 0x43,
+    0xf0, 0x43, 0x43, 0xf0, 0x43, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x4d = { image_data_twr_font_ubuntu_33_0x4d,
-    29, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x4e[99] = {
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xe3, 0xff, 0x8e,
-    0xe1, 0xff, 0x8e,
-    0xe0, 0xff, 0x8e,
-    0xe0, 0x7f, 0x8e,
-    0xe0, 0x7f, 0x8e,
-    0xe2, 0x3f, 0x8e,
-    0xe2, 0x1f, 0x8e,
-    0xe3, 0x0f, 0x8e,
-    0xe3, 0x8f, 0x8e,
-    0xe3, 0xc7, 0x8e,
-    0xe3, 0xc3, 0x8e,
-    0xe3, 0xe3, 0x8e,
-    0xe3, 0xf1, 0x8e,
-    0xe3, 0xf1, 0x8e,
-    0xe3, 0xf8, 0x8e,
-    0xe3, 0xfc, 0x0e,
-    0xe3, 0xfc, 0x0e,
-    0xe3, 0xfe, 0x0e,
-    0xe3, 0xff, 0x0e,
-    0xe3, 0xff, 0x0e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_33_0x4d = { image_data_twr_font_ubuntu_33_0x4d, 29, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x4e[61] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x53, 0xb3, 0x64, 0xa3, 0x65, 0x93,
+    0x66, 0x83, 0x66, 0x83, 0x63, 0x13, 0x73, 0x63, 0x14, 0x63, 0x63, 0x24,
+    0x53, 0x63, 0x33, 0x53, 0x63, 0x43, 0x43, 0x63, 0x44, 0x33, 0x63, 0x53,
+    0x33, 0x63, 0x63, 0x23, 0x63, 0x63, 0x23, 0x63, 0x73, 0x13, 0x63, 0x86,
+    0x63, 0x86, 0x63, 0x95, 0x63, 0xa4, 0x63, 0xa4, 0x63, 0xb3, 0x63, 0xb3,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x4e = { image_data_twr_font_ubuntu_33_0x4e,
-    23, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x4f[132] = {
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0x80, 0xff, 0x80,
-    0xfe, 0x00, 0x3f, 0x80,
-    0xf8, 0x00, 0x0f, 0x80,
-    0xf0, 0x3e, 0x07, 0x80,
-    0xf0, 0xff, 0x87, 0x80,
-    0xe1, 0xff, 0xc3, 0x80,
-    0xe3, 0xff, 0xe3, 0x80,
-    0xc3, 0xff, 0xe1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc3, 0xff, 0xe1, 0x80,
-    0xe3, 0xff, 0xe3, 0x80,
-    0xe1, 0xff, 0xc3, 0x80,
-    0xf0, 0xff, 0x87, 0x80,
-    0xf0, 0x3e, 0x07, 0x80,
-    0xf8, 0x00, 0x0f, 0x80,
-    0xfe, 0x00, 0x3f, 0x80,
-    0xff, 0x80, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_33_0x4e = { image_data_twr_font_ubuntu_33_0x4e, 23, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x4f[48] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x47, 0xf0, 0x1b, 0xcf, 0x96,
+    0x56, 0x84, 0x94, 0x74, 0xb4, 0x63, 0xd3, 0x54, 0xd4, 0x43, 0xf3, 0x43,
+    0xf3, 0x43, 0xf3, 0x43, 0xf3, 0x43, 0xf3, 0x43, 0xf3, 0x44, 0xd4, 0x53,
+    0xd3, 0x64, 0xb4, 0x74, 0x94, 0x86, 0x56, 0x9f, 0xcb, 0xf0, 0x17, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x4f = { image_data_twr_font_ubuntu_33_0x4f,
-    25, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x50[99] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xe0, 0x07, 0xe0,
-    0xe0, 0x01, 0xe0,
-    0xe0, 0x00, 0xe0,
-    0xe3, 0xf8, 0x60,
-    0xe3, 0xfc, 0x20,
-    0xe3, 0xfe, 0x20,
-    0xe3, 0xfe, 0x20,
-    0xe3, 0xfe, 0x20,
-    0xe3, 0xfe, 0x20,
-    0xe3, 0xfc, 0x20,
-    0xe3, 0xf0, 0x60,
-    0xe0, 0x00, 0xe0,
-    0xe0, 0x01, 0xe0,
-    0xe0, 0x07, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_33_0x4f = { image_data_twr_font_ubuntu_33_0x4f, 25, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x50[43] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x4a, 0x9c, 0x7d, 0x63, 0x74, 0x53, 0x84,
+    0x43, 0x93, 0x43, 0x93, 0x43, 0x93, 0x43, 0x93, 0x43, 0x84, 0x43, 0x65,
+    0x5d, 0x6c, 0x7a, 0x93, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13,
+    0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x50 = { image_data_twr_font_ubuntu_33_0x50,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x51[132] = {
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0x80, 0xff, 0x80,
-    0xfe, 0x00, 0x3f, 0x80,
-    0xf8, 0x00, 0x0f, 0x80,
-    0xf0, 0x3e, 0x07, 0x80,
-    0xf0, 0xff, 0x87, 0x80,
-    0xe1, 0xff, 0xc3, 0x80,
-    0xe3, 0xff, 0xe3, 0x80,
-    0xc3, 0xff, 0xe1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc3, 0xff, 0xe1, 0x80,
-    0xe3, 0xff, 0xe3, 0x80,
-    0xe1, 0xff, 0xc3, 0x80,
-    0xf0, 0xff, 0x87, 0x80,
-    0xf8, 0x3e, 0x07, 0x80,
-    0xfc, 0x00, 0x0f, 0x80,
-    0xfe, 0x00, 0x3f, 0x80,
-    0xff, 0x80, 0xff, 0x80,
-    0xff, 0xf1, 0xff, 0x80,
-    0xff, 0xf0, 0xff, 0x80,
-    0xff, 0xf8, 0x1f, 0x80,
-    0xff, 0xfc, 0x03, 0x80,
-    0xff, 0xff, 0x07, 0x80,
-    0xff, 0xff, 0xc7, 0x80,
-    0xff, 0xff, 0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_33_0x50 = { image_data_twr_font_ubuntu_33_0x50, 19, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x51[60] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x47, 0xf0, 0x1b, 0xcf, 0x96,
+    0x56, 0x84, 0x94, 0x74, 0xb4, 0x63, 0xd3, 0x54, 0xd4, 0x43, 0xf3, 0x43,
+    0xf3, 0x43, 0xf3, 0x43, 0xf3, 0x43, 0xf3, 0x43, 0xf3, 0x44, 0xd4, 0x53,
+    0xd3, 0x64, 0xb4, 0x74, 0x94, 0x95, 0x56, 0xae, 0xcb, 0xf0, 0x17, 0xf0,
+    0x63, 0xf0, 0x74, 0xf0, 0x76, 0xf0, 0x58, 0xf0, 0x45, 0xf0, 0x73, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x51 = { image_data_twr_font_ubuntu_33_0x51,
-    25, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x52[99] = {
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xe0, 0x07, 0xf0,
-    0xe0, 0x01, 0xf0,
-    0xe0, 0x00, 0x70,
-    0xe3, 0xf8, 0x70,
-    0xe3, 0xfc, 0x30,
-    0xe3, 0xfe, 0x30,
-    0xe3, 0xfe, 0x30,
-    0xe3, 0xfe, 0x30,
-    0xe3, 0xfc, 0x30,
-    0xe3, 0xf8, 0x70,
-    0xe0, 0x00, 0x70,
-    0xe0, 0x01, 0xf0,
-    0xe0, 0x07, 0xf0,
-    0xe3, 0xe3, 0xf0,
-    0xe3, 0xe1, 0xf0,
-    0xe3, 0xf1, 0xf0,
-    0xe3, 0xf0, 0xf0,
-    0xe3, 0xf8, 0xf0,
-    0xe3, 0xf8, 0x70,
-    0xe3, 0xfc, 0x70,
-    0xe3, 0xfc, 0x30,
-    0xe3, 0xfe, 0x10,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0
+static const twr_font_image_t twr_font_ubuntu_33_0x51 = { image_data_twr_font_ubuntu_33_0x51, 25, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x52[44] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x8a, 0xac, 0x8e, 0x63, 0x74, 0x63, 0x84,
+    0x53, 0x93, 0x53, 0x93, 0x53, 0x93, 0x53, 0x84, 0x53, 0x74, 0x6e, 0x6c,
+    0x8a, 0xa3, 0x53, 0x93, 0x54, 0x83, 0x63, 0x83, 0x64, 0x73, 0x73, 0x73,
+    0x74, 0x63, 0x83, 0x63, 0x84, 0x53, 0x94, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x52 = { image_data_twr_font_ubuntu_33_0x52,
-    20, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x53[99] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xfc, 0x07, 0x80,
-    0xf0, 0x01, 0x80,
-    0xe0, 0x01, 0x80,
-    0xc3, 0xf3, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc3, 0xff, 0x80,
-    0xe0, 0xff, 0x80,
-    0xf0, 0x3f, 0x80,
-    0xf8, 0x0f, 0x80,
-    0xff, 0x03, 0x80,
-    0xff, 0xc1, 0x80,
-    0xff, 0xe1, 0x80,
-    0xff, 0xf8, 0x80,
-    0xff, 0xf8, 0x80,
-    0xff, 0xf8, 0x80,
-    0xff, 0xf8, 0x80,
-    0xcf, 0xe0, 0x80,
-    0x80, 0x01, 0x80,
-    0x80, 0x03, 0x80,
-    0xf0, 0x0f, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_33_0x52 = { image_data_twr_font_ubuntu_33_0x52, 20, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x53[29] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xe7, 0x8b, 0x5c, 0x44, 0x62, 0x53, 0xe3, 0xe3,
+    0xe4, 0xe5, 0xd6, 0xc7, 0xd6, 0xd5, 0xd4, 0xf3, 0xe3, 0xe3, 0xe3, 0x32,
+    0x75, 0x2e, 0x3d, 0x78, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x53 = { image_data_twr_font_ubuntu_33_0x53,
-    17, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x54[99] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0x80, 0x00, 0x20,
-    0x80, 0x00, 0x20,
-    0x80, 0x00, 0x20,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_33_0x53 = { image_data_twr_font_ubuntu_33_0x53, 17, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x54[49] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x2f, 0x02, 0x2f, 0x02, 0x2f, 0x02, 0x93,
+    0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13,
+    0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13,
+    0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x54 = { image_data_twr_font_ubuntu_33_0x54,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x55[99] = {
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe1, 0xfe, 0x1c,
-    0xf1, 0xfe, 0x3c,
-    0xf0, 0x78, 0x3c,
-    0xf8, 0x00, 0x7c,
-    0xfc, 0x00, 0xfc,
-    0xff, 0x03, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_33_0x54 = { image_data_twr_font_ubuntu_33_0x54, 19, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x55[48] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x13, 0xa3, 0x63, 0xa3, 0x63, 0xa3,
+    0x63, 0xa3, 0x63, 0xa3, 0x63, 0xa3, 0x63, 0xa3, 0x63, 0xa3, 0x63, 0xa3,
+    0x63, 0xa3, 0x63, 0xa3, 0x63, 0xa3, 0x63, 0xa3, 0x63, 0xa3, 0x63, 0xa3,
+    0x63, 0xa3, 0x64, 0x84, 0x73, 0x83, 0x85, 0x45, 0x9c, 0xba, 0xe6, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x55 = { image_data_twr_font_ubuntu_33_0x55,
-    22, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x56[99] = {
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0x1f, 0xff, 0xc0,
-    0x8f, 0xff, 0x88,
-    0x8f, 0xff, 0x88,
-    0x87, 0xff, 0x08,
-    0xc7, 0xff, 0x18,
-    0xc7, 0xff, 0x18,
-    0xc3, 0xfe, 0x18,
-    0xe3, 0xfe, 0x38,
-    0xe3, 0xfe, 0x38,
-    0xf1, 0xfc, 0x78,
-    0xf1, 0xfc, 0x78,
-    0xf0, 0xf8, 0x78,
-    0xf8, 0xf8, 0xf8,
-    0xf8, 0x70, 0xf8,
-    0xfc, 0x71, 0xf8,
-    0xfc, 0x71, 0xf8,
-    0xfe, 0x21, 0xf8,
-    0xfe, 0x23, 0xf8,
-    0xfe, 0x03, 0xf8,
-    0xff, 0x07, 0xf8,
-    0xff, 0x07, 0xf8,
-    0xff, 0x8f, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_33_0x55 = { image_data_twr_font_ubuntu_33_0x55, 22, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x56[48] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x93, 0xf3, 0x13, 0xd3, 0x23, 0xd3, 0x24,
+    0xb4, 0x33, 0xb3, 0x43, 0xb3, 0x44, 0x94, 0x53, 0x93, 0x63, 0x93, 0x73,
+    0x73, 0x83, 0x73, 0x84, 0x54, 0x93, 0x53, 0xa4, 0x34, 0xb3, 0x33, 0xc3,
+    0x33, 0xd3, 0x14, 0xd3, 0x13, 0xe7, 0xf5, 0xf0, 0x15, 0xf0, 0x23, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x56 = { image_data_twr_font_ubuntu_33_0x56,
-    21, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x57[132] = {
-    0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xfe,
-    0x8f, 0xff, 0xff, 0xe2,
-    0x8f, 0xff, 0xff, 0xe2,
-    0x87, 0xff, 0xff, 0xc2,
-    0xc7, 0xfc, 0x7f, 0xc6,
-    0xc7, 0xfc, 0x3f, 0xc6,
-    0xc7, 0xf8, 0x3f, 0xc6,
-    0xc7, 0xf8, 0x3f, 0xc6,
-    0xc3, 0xf9, 0x1f, 0x86,
-    0xe3, 0xf1, 0x1f, 0x8e,
-    0xe3, 0xf1, 0x1f, 0x8e,
-    0xe3, 0xf3, 0x0f, 0x8e,
-    0xe1, 0xe3, 0x8f, 0x0e,
-    0xf1, 0xe3, 0x8f, 0x1e,
-    0xf1, 0xc7, 0x87, 0x1e,
-    0xf1, 0xc7, 0xc7, 0x1e,
-    0xf0, 0xc7, 0xc6, 0x1e,
-    0xf8, 0x8f, 0xe2, 0x3e,
-    0xf8, 0x8f, 0xe2, 0x3e,
-    0xf8, 0x0f, 0xe0, 0x3e,
-    0xf8, 0x1f, 0xf0, 0x3e,
-    0xfc, 0x1f, 0xf0, 0x7e,
-    0xfc, 0x3f, 0xf0, 0x7e,
-    0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_33_0x56 = { image_data_twr_font_ubuntu_33_0x56, 21, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x57[82] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x53, 0xf0, 0x83, 0x23,
+    0xf0, 0x83, 0x24, 0xf0, 0x64, 0x33, 0x93, 0x93, 0x43, 0x94, 0x83, 0x43,
+    0x85, 0x83, 0x43, 0x85, 0x83, 0x44, 0x72, 0x13, 0x64, 0x53, 0x63, 0x13,
+    0x63, 0x63, 0x63, 0x13, 0x63, 0x63, 0x62, 0x24, 0x53, 0x64, 0x43, 0x33,
+    0x44, 0x73, 0x43, 0x33, 0x43, 0x83, 0x33, 0x44, 0x33, 0x83, 0x33, 0x53,
+    0x33, 0x84, 0x23, 0x53, 0x24, 0x93, 0x13, 0x73, 0x13, 0xa3, 0x13, 0x73,
+    0x13, 0xa7, 0x77, 0xa6, 0x96, 0xb5, 0x95, 0xc4, 0xa5, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x57 = { image_data_twr_font_ubuntu_33_0x57,
-    31, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x58[99] = {
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0x87, 0xfc, 0x30,
-    0xc7, 0xfc, 0x70,
-    0xe3, 0xf8, 0xf0,
-    0xe1, 0xf0, 0xf0,
-    0xf1, 0xf1, 0xf0,
-    0xf8, 0xe1, 0xf0,
-    0xf8, 0x63, 0xf0,
-    0xfc, 0x47, 0xf0,
-    0xfe, 0x07, 0xf0,
-    0xfe, 0x0f, 0xf0,
-    0xff, 0x0f, 0xf0,
-    0xfe, 0x0f, 0xf0,
-    0xfe, 0x07, 0xf0,
-    0xfc, 0x03, 0xf0,
-    0xf8, 0x63, 0xf0,
-    0xf8, 0xe1, 0xf0,
-    0xf0, 0xf0, 0xf0,
-    0xf1, 0xf8, 0xf0,
-    0xe3, 0xf8, 0x70,
-    0xc3, 0xfc, 0x30,
-    0xc7, 0xfe, 0x30,
-    0x87, 0xfe, 0x10,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0
+static const twr_font_image_t twr_font_ubuntu_33_0x57 = { image_data_twr_font_ubuntu_33_0x57, 31, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x58[45] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x64, 0x94, 0x43, 0x93, 0x63, 0x73, 0x74,
+    0x54, 0x83, 0x53, 0xa3, 0x34, 0xa4, 0x23, 0xc3, 0x13, 0xe6, 0xe5, 0xf0,
+    0x14, 0xf5, 0xf6, 0xd8, 0xb4, 0x23, 0xb3, 0x34, 0x94, 0x44, 0x83, 0x63,
+    0x73, 0x74, 0x54, 0x84, 0x43, 0xa3, 0x34, 0xa4, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x58 = { image_data_twr_font_ubuntu_33_0x58,
-    20, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x59[99] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0x0f, 0xfe, 0x00,
-    0x8f, 0xfe, 0x20,
-    0x87, 0xfc, 0x20,
-    0xc7, 0xfc, 0x60,
-    0xe3, 0xf8, 0xe0,
-    0xe1, 0xf0, 0xe0,
-    0xf1, 0xf1, 0xe0,
-    0xf0, 0xe1, 0xe0,
-    0xf8, 0xc3, 0xe0,
-    0xfc, 0x47, 0xe0,
-    0xfc, 0x07, 0xe0,
-    0xfe, 0x0f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_33_0x58 = { image_data_twr_font_ubuntu_33_0x58, 20, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x59[47] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x14, 0xb4, 0x13, 0xb3, 0x24, 0x94, 0x33,
+    0x93, 0x53, 0x73, 0x64, 0x54, 0x73, 0x53, 0x84, 0x34, 0x93, 0x24, 0xb3,
+    0x13, 0xc7, 0xd5, 0xf3, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13,
+    0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x59 = { image_data_twr_font_ubuntu_33_0x59,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x5a[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xc0, 0x00, 0x40,
-    0xc0, 0x00, 0x40,
-    0xc0, 0x00, 0x40,
-    0xff, 0xf8, 0x40,
-    0xff, 0xf0, 0xc0,
-    0xff, 0xe1, 0xc0,
-    0xff, 0xe3, 0xc0,
-    0xff, 0xc7, 0xc0,
-    0xff, 0x87, 0xc0,
-    0xff, 0x0f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xfe, 0x3f, 0xc0,
-    0xfc, 0x3f, 0xc0,
-    0xf8, 0x7f, 0xc0,
-    0xf8, 0xff, 0xc0,
-    0xf1, 0xff, 0xc0,
-    0xe1, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xc3, 0xff, 0xc0,
-    0x80, 0x00, 0x40,
-    0x80, 0x00, 0x40,
-    0x80, 0x00, 0x40,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x59 = { image_data_twr_font_ubuntu_33_0x59, 19, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x5a[30] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0x3f, 0x3f, 0xe4, 0xd4, 0xd4, 0xe3, 0xe3,
+    0xe4, 0xd4, 0xe3, 0xe3, 0xe4, 0xd4, 0xe3, 0xe3, 0xe4, 0xe3, 0xe4, 0xdf,
+    0x01, 0x2f, 0x01, 0x2f, 0x01, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x5a = { image_data_twr_font_ubuntu_33_0x5a,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x5b[66] = {
-    0xff, 0xe0,
-    0xe0, 0x00,
-    0xe0, 0x00,
-    0xe0, 0x00,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe0, 0x00,
-    0xe0, 0x00,
-    0xe0, 0x00,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_33_0x5a = { image_data_twr_font_ubuntu_33_0x5a, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x5b[32] = {
+    0xe8, 0x38, 0x38, 0x33, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x88, 0x38, 0x38, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x5b = { image_data_twr_font_ubuntu_33_0x5b,
-    11, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x5c[66] = {
-    0xff, 0xf8,
-    0x3f, 0xf8,
-    0x1f, 0xf8,
-    0x1f, 0xf8,
-    0x1f, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0xc7, 0xf8,
-    0xc7, 0xf8,
-    0xc7, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xf1, 0xf8,
-    0xf1, 0xf8,
-    0xf0, 0xf8,
-    0xf8, 0xf8,
-    0xf8, 0xf8,
-    0xfc, 0x78,
-    0xfc, 0x78,
-    0xfc, 0x78,
-    0xfe, 0x38,
-    0xfe, 0x38,
-    0xfe, 0x38,
-    0xff, 0x18,
-    0xff, 0x18,
-    0xff, 0x18,
-    0xff, 0x88,
-    0xff, 0x88,
-    0xff, 0x88,
-    0xff, 0xc0,
-    0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_33_0x5b = { image_data_twr_font_ubuntu_33_0x5b, 11, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x5c[32] = {
+    0xd2, 0xb3, 0xa3, 0xa3, 0xb3, 0xa3, 0xa3, 0xb3, 0xa3, 0xa3, 0xb3, 0xa3,
+    0xa3, 0xb3, 0xa3, 0xa4, 0xa3, 0xa3, 0xb3, 0xa3, 0xa3, 0xb3, 0xa3, 0xa3,
+    0xb3, 0xa3, 0xa3, 0xb3, 0xa3, 0xa3, 0xb3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x5c = { image_data_twr_font_ubuntu_33_0x5c,
-    13, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x5d[66] = {
-    0xff, 0xe0,
-    0x00, 0xe0,
-    0x00, 0xe0,
-    0x00, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0x00, 0xe0,
-    0x00, 0xe0,
-    0x00, 0xe0,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_33_0x5c = { image_data_twr_font_ubuntu_33_0x5c, 13, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x5d[32] = {
+    0xb8, 0x38, 0x38, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x38, 0x38, 0x38, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x5d = { image_data_twr_font_ubuntu_33_0x5d,
-    11, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x5e[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xfe, 0x0f, 0xc0,
-    0xfe, 0x0f, 0xc0,
-    0xfc, 0x47, 0xc0,
-    0xf8, 0x43, 0xc0,
-    0xf8, 0xe3, 0xc0,
-    0xf1, 0xf1, 0xc0,
-    0xf1, 0xf1, 0xc0,
-    0xe3, 0xf8, 0xc0,
-    0xe3, 0xf8, 0xc0,
-    0xc7, 0xfc, 0x40,
-    0xef, 0xfe, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x5d = { image_data_twr_font_ubuntu_33_0x5d, 11, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x5e[27] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x53, 0xe5, 0xd5, 0xc3, 0x13, 0xa4, 0x14,
+    0x93, 0x33, 0x83, 0x53, 0x73, 0x53, 0x63, 0x73, 0x53, 0x73, 0x43, 0x93,
+    0x41, 0xb1, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x5e = { image_data_twr_font_ubuntu_33_0x5e,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x5f[66] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0x00, 0x00,
-    0x00, 0x00,
-    0x00, 0x00,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_33_0x5e = { image_data_twr_font_ubuntu_33_0x5e, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x5f[35] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0x0f, 0x0f, 0x03, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x5f = { image_data_twr_font_ubuntu_33_0x5f,
-    16, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x60[66] = {
-    0xff, 0xf0,
-    0xef, 0xf0,
-    0xc7, 0xf0,
-    0xe3, 0xf0,
-    0xf1, 0xf0,
-    0xf8, 0xf0,
-    0xfd, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
+static const twr_font_image_t twr_font_ubuntu_33_0x5f = { image_data_twr_font_ubuntu_33_0x5f, 16, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x60[7] = {
+    0xf1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x60 = { image_data_twr_font_ubuntu_33_0x60,
-    12, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x61[99] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xf0, 0x1f, 0x80,
-    0xe0, 0x0f, 0x80,
-    0xe0, 0x07, 0x80,
-    0xef, 0xc3, 0x80,
-    0xff, 0xe3, 0x80,
-    0xff, 0xe3, 0x80,
-    0xf8, 0x03, 0x80,
-    0xe0, 0x03, 0x80,
-    0xc0, 0x03, 0x80,
-    0x87, 0xe3, 0x80,
-    0x8f, 0xe3, 0x80,
-    0x8f, 0xe3, 0x80,
-    0x8f, 0xe3, 0x80,
-    0x87, 0xe3, 0x80,
-    0xc0, 0x03, 0x80,
-    0xe0, 0x03, 0x80,
-    0xf0, 0x07, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_33_0x60 = { image_data_twr_font_ubuntu_33_0x60, 12, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x61[34] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x77, 0x99,
+    0x8a, 0x71, 0x64, 0xe3, 0xe3, 0x89, 0x6b, 0x5c, 0x44, 0x63, 0x43, 0x73,
+    0x43, 0x73, 0x43, 0x73, 0x44, 0x63, 0x5c, 0x6b, 0x79, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x61 = { image_data_twr_font_ubuntu_33_0x61,
-    17, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x62[99] = {
-    0xff, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe2, 0x07, 0xe0,
-    0xe0, 0x03, 0xe0,
-    0xe0, 0x01, 0xe0,
-    0xe1, 0xf0, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xe3, 0xf8, 0x60,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xe0, 0xe0,
-    0xe0, 0x01, 0xe0,
-    0xe0, 0x03, 0xe0,
-    0xf0, 0x0f, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_33_0x61 = { image_data_twr_font_ubuntu_33_0x61, 17, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x62[47] = {
+    0xf0, 0x73, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13,
+    0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0x16, 0x9b, 0x8c, 0x74, 0x54, 0x63,
+    0x73, 0x63, 0x74, 0x53, 0x83, 0x53, 0x83, 0x53, 0x83, 0x53, 0x83, 0x53,
+    0x83, 0x53, 0x74, 0x53, 0x73, 0x63, 0x55, 0x6c, 0x7b, 0x98, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x62 = { image_data_twr_font_ubuntu_33_0x62,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x63[66] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xfe, 0x06,
-    0xf8, 0x02,
-    0xf0, 0x02,
-    0xe0, 0xfe,
-    0xe3, 0xfe,
-    0xc3, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc3, 0xfe,
-    0xe3, 0xfe,
-    0xe0, 0xfa,
-    0xf0, 0x02,
-    0xf8, 0x02,
-    0xfe, 0x06,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_33_0x62 = { image_data_twr_font_ubuntu_33_0x62, 19, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x63[28] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x76, 0x79, 0x5a,
+    0x45, 0xa3, 0xb4, 0xb3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc4, 0xc3, 0xc5, 0x51,
+    0x5a, 0x69, 0x86, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x63 = { image_data_twr_font_ubuntu_33_0x63,
-    15, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x64[99] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xfc, 0x08, 0xe0,
-    0xf8, 0x00, 0xe0,
-    0xf0, 0x00, 0xe0,
-    0xe1, 0xf0, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xc3, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe0, 0xf8, 0xe0,
-    0xf0, 0x00, 0xe0,
-    0xf8, 0x00, 0xe0,
-    0xfe, 0x01, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_33_0x63 = { image_data_twr_font_ubuntu_33_0x63, 15, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x64[47] = {
+    0xf0, 0xf0, 0x23, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf0,
+    0x13, 0xf0, 0x13, 0xf0, 0x13, 0x96, 0x13, 0x8b, 0x7c, 0x64, 0x54, 0x63,
+    0x73, 0x54, 0x73, 0x53, 0x83, 0x53, 0x83, 0x53, 0x83, 0x53, 0x83, 0x53,
+    0x83, 0x54, 0x73, 0x63, 0x73, 0x65, 0x53, 0x7c, 0x8b, 0xa8, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x64 = { image_data_twr_font_ubuntu_33_0x64,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x65[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xfe, 0x0f, 0xc0,
-    0xf8, 0x03, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xe1, 0xf1, 0xc0,
-    0xe3, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc7, 0xff, 0xc0,
-    0xc7, 0xff, 0xc0,
-    0xc3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe0, 0xfd, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xf8, 0x01, 0xc0,
-    0xfe, 0x03, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x64 = { image_data_twr_font_ubuntu_33_0x64, 19, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x65[33] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x45,
+    0xb9, 0x8b, 0x64, 0x53, 0x63, 0x73, 0x43, 0x83, 0x4e, 0x4e, 0x4e, 0x43,
+    0xf3, 0xf4, 0xf3, 0xf5, 0x61, 0x7b, 0x8a, 0xa7, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x65 = { image_data_twr_font_ubuntu_33_0x65,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x66[66] = {
-    0xff, 0xf0,
-    0xfc, 0x00,
-    0xf8, 0x00,
-    0xf0, 0x00,
-    0xe1, 0xe0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe0, 0x10,
-    0xe0, 0x10,
-    0xe0, 0x10,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
+static const twr_font_image_t twr_font_ubuntu_33_0x65 = { image_data_twr_font_ubuntu_33_0x65, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x66[28] = {
+    0xf0, 0x36, 0x57, 0x48, 0x34, 0x41, 0x33, 0x93, 0x93, 0x93, 0x98, 0x48,
+    0x48, 0x43, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+    0x93, 0x93, 0x93, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x66 = { image_data_twr_font_ubuntu_33_0x66,
-    12, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x67[99] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xfe, 0x03, 0xe0,
-    0xf8, 0x00, 0xe0,
-    0xf0, 0x00, 0xe0,
-    0xe1, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xc3, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe1, 0xf0, 0xe0,
-    0xf0, 0x00, 0xe0,
-    0xf8, 0x00, 0xe0,
-    0xfc, 0x08, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf0, 0xe0,
-    0xe7, 0xe1, 0xe0,
-    0xe0, 0x01, 0xe0,
-    0xe0, 0x03, 0xe0,
-    0xf0, 0x0f, 0xe0,
-    0xff, 0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_33_0x66 = { image_data_twr_font_ubuntu_33_0x66, 12, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x67[49] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xd7,
+    0xab, 0x7c, 0x64, 0x63, 0x63, 0x73, 0x54, 0x73, 0x53, 0x83, 0x53, 0x83,
+    0x53, 0x83, 0x53, 0x83, 0x53, 0x83, 0x63, 0x73, 0x64, 0x54, 0x7c, 0x8b,
+    0x96, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf4, 0x62, 0x64, 0x7c, 0x7b, 0x98,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x67 = { image_data_twr_font_ubuntu_33_0x67,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x68[99] = {
-    0xff, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe0, 0x0f, 0xe0,
-    0xe0, 0x03, 0xe0,
-    0xe0, 0x01, 0xe0,
-    0xe3, 0xe1, 0xe0,
-    0xe3, 0xf0, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_33_0x67 = { image_data_twr_font_ubuntu_33_0x67, 19, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x68[49] = {
+    0xf0, 0x73, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13,
+    0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x19, 0xab, 0x8c, 0x73, 0x54, 0x73, 0x64,
+    0x63, 0x73, 0x63, 0x73, 0x63, 0x73, 0x63, 0x73, 0x63, 0x73, 0x63, 0x73,
+    0x63, 0x73, 0x63, 0x73, 0x63, 0x73, 0x63, 0x73, 0x63, 0x73, 0x63, 0x73,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x68 = { image_data_twr_font_ubuntu_33_0x68,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x69[66] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_33_0x68 = { image_data_twr_font_ubuntu_33_0x68, 19, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x69[24] = {
+    0xf0, 0x63, 0x63, 0x63, 0xf0, 0xf0, 0xc3, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x69 = { image_data_twr_font_ubuntu_33_0x69,
-    9, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x6a[66] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xc3, 0x80,
-    0x07, 0x80,
-    0x0f, 0x80,
-    0x1f, 0x80,
-    0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_33_0x69 = { image_data_twr_font_ubuntu_33_0x69, 9, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x6a[30] = {
+    0xf0, 0x63, 0x63, 0x63, 0xf0, 0xf0, 0xc3, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x54, 0x35, 0x44, 0x53, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x6a = { image_data_twr_font_ubuntu_33_0x6a,
-    9, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x6b[99] = {
-    0xff, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xf0, 0x80,
-    0xe3, 0xf1, 0x80,
-    0xe3, 0xe3, 0x80,
-    0xe3, 0xc7, 0x80,
-    0xe3, 0x8f, 0x80,
-    0xe3, 0x1f, 0x80,
-    0xe2, 0x3f, 0x80,
-    0xe0, 0x7f, 0x80,
-    0xe0, 0x3f, 0x80,
-    0xe2, 0x1f, 0x80,
-    0xe3, 0x0f, 0x80,
-    0xe3, 0x87, 0x80,
-    0xe3, 0xc3, 0x80,
-    0xe3, 0xe1, 0x80,
-    0xe3, 0xf1, 0x80,
-    0xe3, 0xf8, 0x80,
-    0xe3, 0xf8, 0x00,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_33_0x6a = { image_data_twr_font_ubuntu_33_0x6a, 9, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x6b[42] = {
+    0xf0, 0x53, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0x64, 0x43,
+    0x63, 0x53, 0x53, 0x63, 0x43, 0x73, 0x33, 0x83, 0x23, 0x93, 0x13, 0xa6,
+    0xb7, 0xa3, 0x14, 0x93, 0x24, 0x83, 0x34, 0x73, 0x44, 0x63, 0x54, 0x53,
+    0x63, 0x53, 0x73, 0x43, 0x74, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x6b = { image_data_twr_font_ubuntu_33_0x6b,
-    17, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x6c[66] = {
-    0xff, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe1, 0xc0,
-    0xe0, 0x40,
-    0xf0, 0x40,
-    0xf8, 0x40,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x6b = { image_data_twr_font_ubuntu_33_0x6b, 17, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x6c[26] = {
+    0xd3, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x74, 0x66, 0x55,
+    0x64, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x6c = { image_data_twr_font_ubuntu_33_0x6c,
-    10, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x6d[132] = {
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xf8, 0x07, 0x81, 0xf8,
-    0xe0, 0x02, 0x00, 0xf8,
-    0xe0, 0x00, 0x00, 0x78,
-    0xe3, 0xe0, 0x78, 0x78,
-    0xe3, 0xf0, 0xfc, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_33_0x6c = { image_data_twr_font_ubuntu_33_0x6c, 10, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x6d[66] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xb8, 0x46, 0x9b, 0x19, 0x8f, 0x07, 0x73,
+    0x56, 0x44, 0x73, 0x64, 0x64, 0x63, 0x73, 0x73, 0x63, 0x73, 0x73, 0x63,
+    0x73, 0x73, 0x63, 0x73, 0x73, 0x63, 0x73, 0x73, 0x63, 0x73, 0x73, 0x63,
+    0x73, 0x73, 0x63, 0x73, 0x73, 0x63, 0x73, 0x73, 0x63, 0x73, 0x73, 0x63,
+    0x73, 0x73, 0x63, 0x73, 0x73, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x6d = { image_data_twr_font_ubuntu_33_0x6d,
-    29, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x6e[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xf0, 0x0f, 0xc0,
-    0xe0, 0x07, 0xc0,
-    0xe0, 0x03, 0xc0,
-    0xe3, 0xe3, 0xc0,
-    0xe3, 0xe1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x6d = { image_data_twr_font_ubuntu_33_0x6d, 29, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x6e[43] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x18,
+    0x9a, 0x8b, 0x73, 0x53, 0x73, 0x54, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x6e = { image_data_twr_font_ubuntu_33_0x6e,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x6f[99] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xfe, 0x0f, 0xe0,
-    0xf8, 0x03, 0xe0,
-    0xf0, 0x01, 0xe0,
-    0xe1, 0xf0, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xc3, 0xf8, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc3, 0xf8, 0x60,
-    0xe3, 0xf8, 0xe0,
-    0xe1, 0xf0, 0xe0,
-    0xf0, 0x01, 0xe0,
-    0xf8, 0x03, 0xe0,
-    0xfe, 0x0f, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_33_0x6e = { image_data_twr_font_ubuntu_33_0x6e, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x6f[40] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xd5,
+    0xc9, 0x9b, 0x74, 0x54, 0x63, 0x73, 0x54, 0x74, 0x43, 0x93, 0x43, 0x93,
+    0x43, 0x93, 0x43, 0x93, 0x43, 0x93, 0x44, 0x74, 0x53, 0x73, 0x64, 0x54,
+    0x7b, 0x99, 0xc5, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x6f = { image_data_twr_font_ubuntu_33_0x6f,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x70[99] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xf8, 0x0f, 0xe0,
-    0xe0, 0x03, 0xe0,
-    0xe0, 0x01, 0xe0,
-    0xe3, 0xe0, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xe3, 0xf8, 0x60,
-    0xe3, 0xf8, 0xe0,
-    0xe1, 0xf0, 0xe0,
-    0xe0, 0x01, 0xe0,
-    0xe0, 0x03, 0xe0,
-    0xe2, 0x07, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_33_0x6f = { image_data_twr_font_ubuntu_33_0x6f, 19, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x70[52] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xb7,
+    0xab, 0x8c, 0x73, 0x55, 0x63, 0x73, 0x63, 0x74, 0x53, 0x83, 0x53, 0x83,
+    0x53, 0x83, 0x53, 0x83, 0x53, 0x83, 0x53, 0x74, 0x53, 0x73, 0x64, 0x54,
+    0x6c, 0x7b, 0x83, 0x16, 0x93, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf0,
+    0x13, 0xf0, 0x13, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x70 = { image_data_twr_font_ubuntu_33_0x70,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x71[99] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xfe, 0x03, 0xe0,
-    0xf8, 0x00, 0xe0,
-    0xf0, 0x00, 0xe0,
-    0xe0, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xc3, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe1, 0xf0, 0xe0,
-    0xf0, 0x00, 0xe0,
-    0xf8, 0x00, 0xe0,
-    0xfc, 0x08, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_33_0x70 = { image_data_twr_font_ubuntu_33_0x70, 19, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x71[53] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xd7,
+    0xab, 0x7c, 0x65, 0x53, 0x63, 0x73, 0x54, 0x73, 0x53, 0x83, 0x53, 0x83,
+    0x53, 0x83, 0x53, 0x83, 0x53, 0x83, 0x54, 0x73, 0x63, 0x73, 0x64, 0x54,
+    0x7c, 0x8b, 0x96, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13,
+    0xf0, 0x13, 0xf0, 0x13, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x71 = { image_data_twr_font_ubuntu_33_0x71,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x72[66] = {
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xf8, 0x00,
-    0xe0, 0x00,
-    0xe0, 0x00,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
+static const twr_font_image_t twr_font_ubuntu_33_0x71 = { image_data_twr_font_ubuntu_33_0x71, 19, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x72[25] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x87, 0x39, 0x39, 0x33, 0x93,
+    0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x72 = { image_data_twr_font_ubuntu_33_0x72,
-    12, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x73[66] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xf0, 0x3c,
-    0xc0, 0x1c,
-    0xc0, 0x1c,
-    0x87, 0xdc,
-    0x8f, 0xfc,
-    0x8f, 0xfc,
-    0x87, 0xfc,
-    0xc0, 0xfc,
-    0xe0, 0x3c,
-    0xf8, 0x1c,
-    0xff, 0x0c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0x9f, 0x0c,
-    0x80, 0x0c,
-    0x80, 0x1c,
-    0xc0, 0x7c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_33_0x72 = { image_data_twr_font_ubuntu_33_0x72, 12, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x73[28] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xa6, 0x69, 0x59, 0x44,
+    0x51, 0x43, 0xb3, 0xb4, 0xb6, 0x97, 0x96, 0xb4, 0xb3, 0xb3, 0x32, 0x54,
+    0x3b, 0x3a, 0x57, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x73 = { image_data_twr_font_ubuntu_33_0x73,
-    14, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x74[66] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe0, 0x18,
-    0xe0, 0x18,
-    0xe0, 0x18,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe1, 0xf8,
-    0xf0, 0x08,
-    0xf0, 0x08,
-    0xfc, 0x18,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_33_0x73 = { image_data_twr_font_ubuntu_33_0x73, 14, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x74[26] = {
+    0xf0, 0xf0, 0xf0, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa8, 0x58, 0x58, 0x53,
+    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa8, 0x58,
+    0x75, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x74 = { image_data_twr_font_ubuntu_33_0x74,
-    13, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x75[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe1, 0xf1, 0xc0,
-    0xf1, 0xf1, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xf8, 0x01, 0xc0,
-    0xfc, 0x03, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x74 = { image_data_twr_font_ubuntu_33_0x74, 13, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x75[42] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf3, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x64, 0x53,
+    0x73, 0x53, 0x7b, 0x8a, 0x98, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x75 = { image_data_twr_font_ubuntu_33_0x75,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x76[99] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0x8f, 0xf8, 0x80,
-    0x8f, 0xf8, 0x80,
-    0xc7, 0xf1, 0x80,
-    0xc7, 0xf1, 0x80,
-    0xc7, 0xf1, 0x80,
-    0xe3, 0xe3, 0x80,
-    0xe3, 0xe3, 0x80,
-    0xe3, 0xe3, 0x80,
-    0xf1, 0xc7, 0x80,
-    0xf1, 0xc7, 0x80,
-    0xf0, 0x87, 0x80,
-    0xf8, 0x8f, 0x80,
-    0xf8, 0x8f, 0x80,
-    0xfc, 0x1f, 0x80,
-    0xfc, 0x1f, 0x80,
-    0xfc, 0x1f, 0x80,
-    0xfe, 0x3f, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_33_0x75 = { image_data_twr_font_ubuntu_33_0x75, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x76[41] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x43, 0x93,
+    0x23, 0x93, 0x33, 0x73, 0x43, 0x73, 0x43, 0x73, 0x53, 0x53, 0x63, 0x53,
+    0x63, 0x53, 0x73, 0x33, 0x83, 0x33, 0x84, 0x14, 0x93, 0x13, 0xa3, 0x13,
+    0xb5, 0xc5, 0xc5, 0xd3, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x76 = { image_data_twr_font_ubuntu_33_0x76,
-    17, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x77[132] = {
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0x8f, 0xe3, 0xf8, 0x80,
-    0x8f, 0xe3, 0xf8, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xc1, 0xf1, 0x80,
-    0xc7, 0xc1, 0xf1, 0x80,
-    0xc7, 0xc9, 0xf1, 0x80,
-    0xe7, 0xc9, 0xf3, 0x80,
-    0xe3, 0x88, 0xe3, 0x80,
-    0xe3, 0x88, 0xe3, 0x80,
-    0xe3, 0x9c, 0xe3, 0x80,
-    0xf1, 0x1c, 0x47, 0x80,
-    0xf1, 0x1c, 0x47, 0x80,
-    0xf1, 0x3e, 0x47, 0x80,
-    0xf8, 0x3e, 0x0f, 0x80,
-    0xf8, 0x3e, 0x0f, 0x80,
-    0xf8, 0x7f, 0x0f, 0x80,
-    0xfc, 0x7f, 0x1f, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_33_0x76 = { image_data_twr_font_ubuntu_33_0x76, 17, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x77[71] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0, 0x13, 0x73, 0x73, 0x23, 0x73, 0x73, 0x33, 0x63, 0x63,
+    0x43, 0x55, 0x53, 0x43, 0x55, 0x53, 0x43, 0x52, 0x12, 0x53, 0x52, 0x52,
+    0x12, 0x52, 0x63, 0x33, 0x13, 0x33, 0x63, 0x33, 0x13, 0x33, 0x63, 0x32,
+    0x32, 0x33, 0x73, 0x13, 0x33, 0x13, 0x83, 0x13, 0x33, 0x13, 0x83, 0x12,
+    0x52, 0x13, 0x95, 0x55, 0xa5, 0x55, 0xa4, 0x74, 0xb3, 0x73, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x77 = { image_data_twr_font_ubuntu_33_0x77,
-    25, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x78[66] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0x8f, 0xe3,
-    0xc7, 0xc7,
-    0xe3, 0xc7,
-    0xe3, 0x8f,
-    0xf1, 0x1f,
-    0xf8, 0x1f,
-    0xf8, 0x3f,
-    0xfc, 0x3f,
-    0xfc, 0x3f,
-    0xf8, 0x3f,
-    0xf8, 0x1f,
-    0xf1, 0x0f,
-    0xe1, 0x8f,
-    0xe3, 0xc7,
-    0xc7, 0xc3,
-    0xc7, 0xe3,
-    0x8f, 0xf1,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_33_0x77 = { image_data_twr_font_ubuntu_33_0x77, 25, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x78[38] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xa3, 0x73, 0x43,
+    0x53, 0x63, 0x43, 0x63, 0x33, 0x83, 0x13, 0xa6, 0xa5, 0xc4, 0xc4, 0xb5,
+    0xb6, 0x93, 0x14, 0x74, 0x23, 0x73, 0x43, 0x53, 0x54, 0x43, 0x63, 0x33,
+    0x83, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x78 = { image_data_twr_font_ubuntu_33_0x78,
-    16, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x79[66] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0x8f, 0xf1,
-    0x8f, 0xf1,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xe3, 0xc7,
-    0xe3, 0xc7,
-    0xe3, 0xc7,
-    0xf1, 0xc7,
-    0xf1, 0x8f,
-    0xf1, 0x8f,
-    0xf8, 0x8f,
-    0xf8, 0x9f,
-    0xf8, 0x9f,
-    0xfc, 0x1f,
-    0xfc, 0x3f,
-    0xfc, 0x3f,
-    0xfe, 0x3f,
-    0xfc, 0x3f,
-    0xfc, 0x7f,
-    0x80, 0xff,
-    0x80, 0xff,
-    0x83, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_33_0x78 = { image_data_twr_font_ubuntu_33_0x78, 16, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x79[47] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xa3, 0x83, 0x23,
+    0x83, 0x33, 0x63, 0x43, 0x63, 0x43, 0x63, 0x53, 0x43, 0x63, 0x43, 0x63,
+    0x43, 0x73, 0x33, 0x73, 0x23, 0x83, 0x23, 0x93, 0x13, 0x93, 0x12, 0xa3,
+    0x12, 0xb5, 0xb4, 0xc4, 0xd3, 0xc4, 0xc3, 0x87, 0x97, 0x95, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x79 = { image_data_twr_font_ubuntu_33_0x79,
-    16, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x7a[66] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0x80, 0x02,
-    0x80, 0x02,
-    0x80, 0x02,
-    0xff, 0xc2,
-    0xff, 0xc6,
-    0xff, 0x8e,
-    0xff, 0x1e,
-    0xfe, 0x3e,
-    0xfc, 0x7e,
-    0xf8, 0xfe,
-    0xf1, 0xfe,
-    0xf1, 0xfe,
-    0xe3, 0xfe,
-    0xc7, 0xfe,
-    0x80, 0x02,
-    0x80, 0x02,
-    0x80, 0x02,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_33_0x79 = { image_data_twr_font_ubuntu_33_0x79, 16, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x7a[27] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x1d, 0x2d, 0x2d,
+    0xb4, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xc3, 0xb3, 0xb3, 0xbd,
+    0x2d, 0x2d, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x7a = { image_data_twr_font_ubuntu_33_0x7a,
-    15, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x7b[66] = {
-    0xff, 0xe0,
-    0xfe, 0x20,
-    0xf8, 0x20,
-    0xf0, 0x20,
-    0xf0, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xe1, 0xe0,
-    0x83, 0xe0,
-    0x87, 0xe0,
-    0x83, 0xe0,
-    0xe1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf0, 0xe0,
-    0xf0, 0x20,
-    0xf8, 0x20,
-    0xfe, 0x20,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_33_0x7a = { image_data_twr_font_ubuntu_33_0x7a, 15, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x7b[33] = {
+    0xf0, 0x33, 0x65, 0x56, 0x54, 0x73, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x74, 0x55, 0x64, 0x75, 0x84, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x84, 0x76, 0x65, 0x83, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x7b = { image_data_twr_font_ubuntu_33_0x7b,
-    11, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x7c[66] = {
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_33_0x7b = { image_data_twr_font_ubuntu_33_0x7b, 11, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x7c[32] = {
+    0xc3, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x7c = { image_data_twr_font_ubuntu_33_0x7c,
-    9, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x7d[66] = {
-    0xff, 0xe0,
-    0x8f, 0xe0,
-    0x83, 0xe0,
-    0x81, 0xe0,
-    0xe1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf0, 0xe0,
-    0xf8, 0x20,
-    0xfc, 0x20,
-    0xf8, 0x20,
-    0xf0, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xe1, 0xe0,
-    0x81, 0xe0,
-    0x83, 0xe0,
-    0x8f, 0xe0,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_33_0x7c = { image_data_twr_font_ubuntu_33_0x7c, 9, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x7d[32] = {
+    0xc3, 0x85, 0x66, 0x74, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x84, 0x85, 0x74, 0x65, 0x54, 0x73, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x74, 0x56, 0x55, 0x63, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x7d = { image_data_twr_font_ubuntu_33_0x7d,
-    11, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x7e[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xe1, 0xf8, 0xc0,
-    0xc0, 0xf8, 0xc0,
-    0xc0, 0x30, 0xc0,
-    0x86, 0x01, 0xc0,
-    0x8f, 0x81, 0xc0,
-    0x8f, 0xc3, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0x7d = { image_data_twr_font_ubuntu_33_0x7d, 11, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0x7e[28] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0, 0xc4, 0x63, 0x46, 0x53, 0x48, 0x24, 0x34, 0x28, 0x43,
+    0x56, 0x43, 0x64, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0x7e = { image_data_twr_font_ubuntu_33_0x7e,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xb0[66] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xe0, 0xe0,
-    0xc0, 0x60,
-    0x8e, 0x20,
-    0x9f, 0x20,
-    0x9f, 0x20,
-    0x8e, 0x20,
-    0xc0, 0x60,
-    0xe0, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
+static const twr_font_image_t twr_font_ubuntu_33_0x7e = { image_data_twr_font_ubuntu_33_0x7e, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0xb0[14] = {
+    0xf0, 0xa5, 0x57, 0x33, 0x33, 0x22, 0x52, 0x22, 0x52, 0x23, 0x33, 0x37,
+    0x55, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0xb0 = { image_data_twr_font_ubuntu_33_0xb0,
-    11, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xb9[66] = {
-    0xff, 0xfc,
-    0xef, 0xbc,
-    0xc7, 0x1c,
-    0xe2, 0x3c,
-    0xf0, 0x7c,
-    0xf8, 0xfc,
-    0xfd, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xf0, 0x3c,
-    0xc0, 0x1c,
-    0xc0, 0x1c,
-    0x87, 0xdc,
-    0x8f, 0xfc,
-    0x8f, 0xfc,
-    0x87, 0xfc,
-    0xc0, 0xfc,
-    0xe0, 0x3c,
-    0xf8, 0x1c,
-    0xff, 0x0c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0x9f, 0x0c,
-    0x80, 0x0c,
-    0x80, 0x1c,
-    0xc0, 0x7c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_33_0xb0 = { image_data_twr_font_ubuntu_33_0xb0, 11, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0xb9[32] = {
+    0xf0, 0x21, 0x51, 0x63, 0x33, 0x63, 0x13, 0x85, 0xa3, 0xc1, 0xf0, 0xf0,
+    0x96, 0x69, 0x59, 0x44, 0x51, 0x43, 0xb3, 0xb4, 0xb6, 0x97, 0x96, 0xb4,
+    0xb3, 0xb3, 0x32, 0x54, 0x3b, 0x3a, 0x57, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0xb9 = { image_data_twr_font_ubuntu_33_0xb9,
-    14, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xbb[66] = {
-    0xff, 0xf8,
-    0xff, 0x18,
-    0xff, 0x18,
-    0xff, 0x18,
-    0xe3, 0x38,
-    0xe3, 0x38,
-    0xe3, 0x38,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe0, 0x18,
-    0xe0, 0x18,
-    0xe0, 0x18,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe1, 0xf8,
-    0xf0, 0x08,
-    0xf0, 0x08,
-    0xfc, 0x18,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
+static const twr_font_image_t twr_font_ubuntu_33_0xb9 = { image_data_twr_font_ubuntu_33_0xb9, 14, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0xbb[30] = {
+    0xf0, 0x63, 0xa3, 0xa3, 0x53, 0x22, 0x63, 0x22, 0x63, 0x22, 0x63, 0xa3,
+    0xa8, 0x58, 0x58, 0x53, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
+    0xa3, 0xa4, 0xa8, 0x58, 0x75, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0xbb = { image_data_twr_font_ubuntu_33_0xbb,
-    13, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xbe[66] = {
-    0xff, 0xfe,
-    0xf7, 0xde,
-    0xe3, 0x8e,
-    0xf1, 0x1e,
-    0xf8, 0x3e,
-    0xfc, 0x7e,
-    0xfe, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0x80, 0x02,
-    0x80, 0x02,
-    0x80, 0x02,
-    0xff, 0xc2,
-    0xff, 0xc6,
-    0xff, 0x8e,
-    0xff, 0x1e,
-    0xfe, 0x3e,
-    0xfc, 0x7e,
-    0xf8, 0xfe,
-    0xf1, 0xfe,
-    0xf1, 0xfe,
-    0xe3, 0xfe,
-    0xc7, 0xfe,
-    0x80, 0x02,
-    0x80, 0x02,
-    0x80, 0x02,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_33_0xbb = { image_data_twr_font_ubuntu_33_0xbb, 13, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0xbe[30] = {
+    0xf0, 0x41, 0x51, 0x73, 0x33, 0x73, 0x13, 0x95, 0xb3, 0xd1, 0xf0, 0xf0,
+    0x8d, 0x2d, 0x2d, 0xb4, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xc3,
+    0xb3, 0xb3, 0xbd, 0x2d, 0x2d, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0xbe = { image_data_twr_font_ubuntu_33_0xbe,
-    15, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xe1[99] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xdf, 0x80,
-    0xff, 0x8f, 0x80,
-    0xff, 0x1f, 0x80,
-    0xfe, 0x3f, 0x80,
-    0xfc, 0x7f, 0x80,
-    0xfe, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xf0, 0x1f, 0x80,
-    0xe0, 0x0f, 0x80,
-    0xe0, 0x07, 0x80,
-    0xef, 0xc3, 0x80,
-    0xff, 0xe3, 0x80,
-    0xff, 0xe3, 0x80,
-    0xf8, 0x03, 0x80,
-    0xe0, 0x03, 0x80,
-    0xc0, 0x03, 0x80,
-    0x87, 0xe3, 0x80,
-    0x8f, 0xe3, 0x80,
-    0x8f, 0xe3, 0x80,
-    0x8f, 0xe3, 0x80,
-    0x87, 0xe3, 0x80,
-    0xc0, 0x03, 0x80,
-    0xe0, 0x03, 0x80,
-    0xf0, 0x07, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_33_0xbe = { image_data_twr_font_ubuntu_33_0xbe, 15, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0xe1[34] = {
+    0xf0, 0xc1, 0xf3, 0xd3, 0xd3, 0xd3, 0xf1, 0xf0, 0xf0, 0xf0, 0x27, 0x99,
+    0x8a, 0x71, 0x64, 0xe3, 0xe3, 0x89, 0x6b, 0x5c, 0x44, 0x63, 0x43, 0x73,
+    0x43, 0x73, 0x43, 0x73, 0x44, 0x63, 0x5c, 0x6b, 0x79, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0xe1 = { image_data_twr_font_ubuntu_33_0xe1,
-    17, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xe8[66] = {
-    0xff, 0xfe,
-    0xfd, 0xf6,
-    0xf8, 0xe2,
-    0xfc, 0x46,
-    0xfe, 0x0e,
-    0xff, 0x1e,
-    0xff, 0xbe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xfe, 0x06,
-    0xf8, 0x02,
-    0xf0, 0x02,
-    0xe0, 0xfe,
-    0xe3, 0xfe,
-    0xc3, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc3, 0xfe,
-    0xe3, 0xfe,
-    0xe0, 0xfa,
-    0xf0, 0x02,
-    0xf8, 0x02,
-    0xfe, 0x06,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
+static const twr_font_image_t twr_font_ubuntu_33_0xe1 = { image_data_twr_font_ubuntu_33_0xe1, 17, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0xe8[31] = {
+    0xf0, 0x61, 0x51, 0x73, 0x33, 0x73, 0x13, 0x95, 0xb3, 0xd1, 0xf0, 0xf0,
+    0xc6, 0x79, 0x5a, 0x45, 0xa3, 0xb4, 0xb3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc4,
+    0xc3, 0xc5, 0x51, 0x5a, 0x69, 0x86, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0xe8 = { image_data_twr_font_ubuntu_33_0xe8,
-    15, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xe9[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xef, 0xc0,
-    0xff, 0xc7, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xfe, 0x3f, 0xc0,
-    0xff, 0x7f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xfe, 0x0f, 0xc0,
-    0xf8, 0x03, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xe1, 0xf1, 0xc0,
-    0xe3, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc7, 0xff, 0xc0,
-    0xc7, 0xff, 0xc0,
-    0xc3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe0, 0xfd, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xf8, 0x01, 0xc0,
-    0xfe, 0x03, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0xe8 = { image_data_twr_font_ubuntu_33_0xe8, 15, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0xe9[34] = {
+    0xf0, 0xe1, 0xf0, 0x13, 0xe3, 0xe3, 0xe3, 0xf0, 0x11, 0xf0, 0xf0, 0xf0,
+    0x75, 0xb9, 0x8b, 0x64, 0x53, 0x63, 0x73, 0x43, 0x83, 0x4e, 0x4e, 0x4e,
+    0x43, 0xf3, 0xf4, 0xf3, 0xf5, 0x61, 0x7b, 0x8a, 0xa7, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0xe9 = { image_data_twr_font_ubuntu_33_0xe9,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xec[99] = {
-    0xfd, 0xf7, 0xc0,
-    0xf8, 0xe3, 0xc0,
-    0xfc, 0x47, 0xc0,
-    0xfe, 0x0f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0xbf, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xfe, 0x0f, 0xc0,
-    0xf8, 0x03, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xe1, 0xf1, 0xc0,
-    0xe3, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc7, 0xff, 0xc0,
-    0xc7, 0xff, 0xc0,
-    0xc3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe0, 0xfd, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xf8, 0x01, 0xc0,
-    0xfe, 0x03, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0xe9 = { image_data_twr_font_ubuntu_33_0xe9, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0xec[36] = {
+    0x61, 0x51, 0xa3, 0x33, 0xa3, 0x13, 0xc5, 0xe3, 0xf0, 0x11, 0xf0, 0xf0,
+    0xf0, 0xf0, 0x95, 0xb9, 0x8b, 0x64, 0x53, 0x63, 0x73, 0x43, 0x83, 0x4e,
+    0x4e, 0x4e, 0x43, 0xf3, 0xf4, 0xf3, 0xf5, 0x61, 0x7b, 0x8a, 0xa7, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0xec = { image_data_twr_font_ubuntu_33_0xec,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xed[66] = {
-    0xff, 0x80,
-    0xfd, 0x80,
-    0xf8, 0x80,
-    0xf1, 0x80,
-    0xe3, 0x80,
-    0xc7, 0x80,
-    0xef, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
+static const twr_font_image_t twr_font_ubuntu_33_0xec = { image_data_twr_font_ubuntu_33_0xec, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0xed[25] = {
+    0xf1, 0x73, 0x53, 0x53, 0x53, 0x71, 0xf0, 0xb3, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0xed = { image_data_twr_font_ubuntu_33_0xed,
-    9, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xef[99] = {
-    0xff, 0xff, 0xfc,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe4,
-    0xff, 0xf8, 0xe4,
-    0xff, 0xf8, 0xe4,
-    0xff, 0xf8, 0xfc,
-    0xfc, 0x08, 0xfc,
-    0xf8, 0x00, 0xfc,
-    0xf0, 0x00, 0xfc,
-    0xe1, 0xf0, 0xfc,
-    0xe3, 0xf8, 0xfc,
-    0xc3, 0xf8, 0xfc,
-    0xc7, 0xf8, 0xfc,
-    0xc7, 0xf8, 0xfc,
-    0xc7, 0xf8, 0xfc,
-    0xc7, 0xf8, 0xfc,
-    0xc7, 0xf8, 0xfc,
-    0xc3, 0xf8, 0xfc,
-    0xe3, 0xf8, 0xfc,
-    0xe0, 0xf8, 0xfc,
-    0xf0, 0x00, 0xfc,
-    0xf8, 0x00, 0xfc,
-    0xfe, 0x01, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc
+static const twr_font_image_t twr_font_ubuntu_33_0xed = { image_data_twr_font_ubuntu_33_0xed, 9, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0xef[47] = {
+    0xf0, 0xf0, 0x53, 0x33, 0xd3, 0x33, 0xd3, 0x33, 0xd3, 0x33, 0xd3, 0x32,
+    0xe3, 0x32, 0xe3, 0x32, 0xe3, 0xc6, 0x13, 0xbb, 0xac, 0x94, 0x54, 0x93,
+    0x73, 0x84, 0x73, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x84, 0x73, 0x93, 0x73, 0x95, 0x53, 0xac, 0xbb, 0xd8, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0xef = { image_data_twr_font_ubuntu_33_0xef,
-    22, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xf2[99] = {
-    0xff, 0xff, 0xc0,
-    0xfb, 0xef, 0xc0,
-    0xf1, 0xc7, 0xc0,
-    0xf8, 0x8f, 0xc0,
-    0xfc, 0x1f, 0xc0,
-    0xfe, 0x3f, 0xc0,
-    0xff, 0x7f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xf0, 0x0f, 0xc0,
-    0xe0, 0x07, 0xc0,
-    0xe0, 0x03, 0xc0,
-    0xe3, 0xe3, 0xc0,
-    0xe3, 0xe1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0xef = { image_data_twr_font_ubuntu_33_0xef, 22, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0xf2[46] = {
+    0xf0, 0x81, 0x51, 0xa3, 0x33, 0xa3, 0x13, 0xc5, 0xe3, 0xf0, 0x11, 0xf0,
+    0xf0, 0xf0, 0x48, 0x9a, 0x8b, 0x73, 0x53, 0x73, 0x54, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0xf2 = { image_data_twr_font_ubuntu_33_0xf2,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xf8[66] = {
-    0xff, 0xf0,
-    0xf7, 0xd0,
-    0xe3, 0x80,
-    0xf1, 0x10,
-    0xf8, 0x30,
-    0xfc, 0x70,
-    0xfe, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xf8, 0x00,
-    0xe0, 0x00,
-    0xe0, 0x00,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
+static const twr_font_image_t twr_font_ubuntu_33_0xf2 = { image_data_twr_font_ubuntu_33_0xf2, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0xf8[30] = {
+    0xf0, 0x11, 0x51, 0x43, 0x33, 0x43, 0x13, 0x65, 0x83, 0xa1, 0xf0, 0xf0,
+    0x37, 0x39, 0x39, 0x33, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+    0x93, 0x93, 0x93, 0x93, 0x93, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0xf8 = { image_data_twr_font_ubuntu_33_0xf8,
-    12, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xf9[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xfc, 0x1f, 0xc0,
-    0xf9, 0xcf, 0xc0,
-    0xf9, 0xcf, 0xc0,
-    0xf9, 0xcf, 0xc0,
-    0xfc, 0x1f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe1, 0xf1, 0xc0,
-    0xf1, 0xf1, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xf8, 0x01, 0xc0,
-    0xfc, 0x03, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0xf8 = { image_data_twr_font_ubuntu_33_0xf8, 12, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0xf9[45] = {
+    0xf0, 0xf0, 0xc5, 0xc2, 0x32, 0xb2, 0x32, 0xb2, 0x32, 0xc5, 0xf0, 0xf0,
+    0xf0, 0x13, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x64, 0x53, 0x73, 0x53, 0x7b, 0x8a, 0x98, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0xf9 = { image_data_twr_font_ubuntu_33_0xf9,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xfa[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xef, 0xc0,
-    0xff, 0xc7, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xfe, 0x3f, 0xc0,
-    0xff, 0x7f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe1, 0xf1, 0xc0,
-    0xf1, 0xf1, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xf8, 0x01, 0xc0,
-    0xfc, 0x03, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
+static const twr_font_image_t twr_font_ubuntu_33_0xf9 = { image_data_twr_font_ubuntu_33_0xf9, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0xfa[44] = {
+    0xf0, 0xe1, 0xf0, 0x13, 0xe3, 0xe3, 0xe3, 0xf0, 0x11, 0xf0, 0xf0, 0xf0,
+    0x33, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x64, 0x53, 0x73, 0x53, 0x7b, 0x8a, 0x98, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0xfa = { image_data_twr_font_ubuntu_33_0xfa,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xfd[66] = {
-    0xff, 0xff,
-    0xff, 0xdf,
-    0xff, 0x8f,
-    0xff, 0x1f,
-    0xfe, 0x3f,
-    0xfc, 0x7f,
-    0xfe, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0x8f, 0xf1,
-    0x8f, 0xf1,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xe3, 0xc7,
-    0xe3, 0xc7,
-    0xe3, 0xc7,
-    0xf1, 0xc7,
-    0xf1, 0x8f,
-    0xf1, 0x8f,
-    0xf8, 0x8f,
-    0xf8, 0x9f,
-    0xf8, 0x9f,
-    0xfc, 0x1f,
-    0xfc, 0x3f,
-    0xfc, 0x3f,
-    0xfe, 0x3f,
-    0xfc, 0x3f,
-    0xfc, 0x7f,
-    0x80, 0xff,
-    0x80, 0xff,
-    0x83, 0xff,
-    0xff, 0xff
+static const twr_font_image_t twr_font_ubuntu_33_0xfa = { image_data_twr_font_ubuntu_33_0xfa, 18, 33, TWR_FONT_IMAGE_FORMAT_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_twr_font_ubuntu_33_0xfd[47] = {
+    0xf0, 0xb1, 0xe3, 0xc3, 0xc3, 0xc3, 0xe1, 0xf0, 0xf0, 0xb3, 0x83, 0x23,
+    0x83, 0x33, 0x63, 0x43, 0x63, 0x43, 0x63, 0x53, 0x43, 0x63, 0x43, 0x63,
+    0x43, 0x73, 0x33, 0x73, 0x23, 0x83, 0x23, 0x93, 0x13, 0x93, 0x12, 0xa3,
+    0x12, 0xb5, 0xb4, 0xc4, 0xd3, 0xc4, 0xc3, 0x87, 0x97, 0x95, 0x00
 };
-static const twr_font_image_t twr_font_ubuntu_33_0xfd = { image_data_twr_font_ubuntu_33_0xfd,
-    16, 33/*, 8*/};
+static const twr_font_image_t twr_font_ubuntu_33_0xfd = { image_data_twr_font_ubuntu_33_0xfd, 16, 33, TWR_FONT_IMAGE_FORMAT_RLE };
 #endif
 
 
@@ -1,4 +1,10 @@
 #include <twr_gfx.h>
+#include <twr_fmt.h>
+
+static void _twr_gfx_rotate(twr_gfx_t *self, int *x, int *y);
+static bool _twr_gfx_clip(twr_gfx_t *self, int *x0, int *y0, int *x1, int *y1);
+static void _twr_gfx_fill(twr_gfx_t *self, int x0, int y0, int x1, int y1, uint32_t color);
+static void _twr_gfx_draw_rle(twr_gfx_t *self, int left, int top, const uint8_t *image, int width, uint32_t color);
 
 void twr_gfx_init(twr_gfx_t *self, void *display, const twr_gfx_driver_t *driver)
 {
@@ -41,46 +47,148 @@ twr_gfx_rotation_t twr_gfx_get_rotation(twr_gfx_t *self)
 
 void twr_gfx_draw_pixel(twr_gfx_t *self, int x, int y, uint32_t color)
 {
-    int tmp;
+    _twr_gfx_rotate(self, &x, &y);
+
+    if (x >= self->_caps.width || y >= self->_caps.height || x < 0 || y < 0)
+    {
+        return;
+    }
+
+    self->_driver->draw_pixel(self->_display, x, y, color);
+}
+
+void twr_gfx_draw_bitmap(twr_gfx_t *self, int left, int top, const uint8_t *image, int width, int height, uint32_t color)
+{
+    int x0 = left;
+    int y0 = top;
+    int x1 = left + width - 1;
+    int y1 = top + height - 1;
+
+    if (!_twr_gfx_clip(self, &x0, &y0, &x1, &y1))
+    {
+        return;
+    }
+
+    int bytes = (width + 7) / 8;
+
+    if (self->_rotation == TWR_GFX_ROTATION_0 && self->_driver->draw_bitmap != NULL &&
+        x0 == left && y0 == top && x1 == left + width - 1 && y1 == top + height - 1)
+    {
+        self->_driver->draw_bitmap(self->_display, left, top, image, width, height, color);
+
+        return;
+    }
+
+    // Position of the first pixel and steps along bitmap row and column on display
+    int x = x0;
+    int y = y0;
+
+    _twr_gfx_rotate(self, &x, &y);
+
+    int row_dx = 0;
+    int row_dy = 0;
+    int column_dx = 0;
+    int column_dy = 0;
 
     switch (self->_rotation)
     {
         case TWR_GFX_ROTATION_90:
         {
-            tmp = x;
-            x = self->_caps.width - 1 - y;
-            y = tmp;
+            row_dy = 1;
+            column_dx = -1;
             break;
         }
         case TWR_GFX_ROTATION_180:
         {
-            x = self->_caps.width - 1 - x;
-            y = self->_caps.height - 1 - y;
+            row_dx = -1;
+            column_dy = -1;
             break;
         }
         case TWR_GFX_ROTATION_270:
         {
-            tmp = y;
-            y = self->_caps.height - 1 - x;
-            x = tmp;
+            row_dy = -1;
+            column_dx = 1;
             break;
         }
         case TWR_GFX_ROTATION_0:
+        default:
         {
+            row_dx = 1;
+            column_dy = 1;
             break;
         }
-        default:
+    }
+
+    // Rows stay rows on display, runs of drawn pixels can be sent as spans
+    bool spans = self->_driver->draw_span != NULL && row_dy == 0;
+
+    for (int by = y0 - top; by <= y1 - top; by++, x += column_dx, y += column_dy)
+    {
+        const uint8_t *row = image + by * bytes;
+
+        int px = x;
+        int py = y;
+        int run = 0;
+
+        for (int bx = x0 - left; bx <= x1 - left; bx++, px += row_dx, py += row_dy)
         {
-            break;
+            if ((row[bx / 8] & (1 << (7 - (bx % 8)))) == 0)
+            {
+                if (spans)
+                {
+                    run++;
+                }
+                else
+                {
+                    self->_driver->draw_pixel(self->_display, px, py, color);
+                }
+            }
+            else if (run != 0)
+            {
+                self->_driver->draw_span(self->_display, row_dx > 0 ? px - run : px + 1, py, run, color);
+
+                run = 0;
+            }
+        }
+
+        if (run != 0)
+        {
+            self->_driver->draw_span(self->_display, row_dx > 0 ? px - run : px + 1, py, run, color);
         }
     }
+}
 
-    if (x >= self->_caps.width || y >= self->_caps.height || x < 0 || y < 0)
+void twr_gfx_draw_image(twr_gfx_t *self, int left, int top, const uint8_t *image, int width, int height)
+{
+    int x0 = left;
+    int y0 = top;
+    int x1 = left + width - 1;
+    int y1 = top + height - 1;
+
+    if (!_twr_gfx_clip(self, &x0, &y0, &x1, &y1))
     {
         return;
     }
 
-    self->_driver->draw_pixel(self->_display, x, y, color);
+    if (self->_rotation == TWR_GFX_ROTATION_0 && self->_driver->draw_image != NULL &&
+        x0 == left && y0 == top && x1 == left + width - 1 && y1 == top + height - 1)
+    {
+        self->_driver->draw_image(self->_display, left, top, image, width, height);
+
+        return;
+    }
+
+    int bytes = (width + 7) / 8;
+
+    for (int y = y0; y <= y1; y++)
+    {
+        const uint8_t *row = image + (y - top) * bytes;
+
+        for (int x = x0; x <= x1; x++)
+        {
+            twr_gfx_draw_pixel(self, x, y, (row[(x - left) / 8] >> ((x - left) % 8)) & 1);
+        }
+    }
 }
 
 int twr_gfx_draw_char(twr_gfx_t *self, int left, int top, uint8_t ch, uint32_t color)
@@ -95,9 +203,6 @@ int twr_gfx_draw_char(twr_gfx_t *self, int left, int top, uint8_t ch, uint32_t c
     int w = 0;
     uint8_t h = 0;
     uint16_t i;
-    uint16_t x;
-    uint16_t y;
-    uint8_t bytes;
 
     for (i = 0; i < font->length; i++)
     {
@@ -106,22 +211,13 @@ int twr_gfx_draw_char(twr_gfx_t *self, int left, int top, uint8_t ch, uint32_t c
             w = font->chars[i].image->width;
             h = font->chars[i].image->heigth;
 
-            bytes = (w + 7) / 8;
-
-            for (y = 0; y < h; y++)
+            if (font->chars[i].image->format == TWR_FONT_IMAGE_FORMAT_RLE)
             {
-                for (x = 0; x < w; x++)
-                {
-                    uint32_t byteIndex = x / 8;
-                    byteIndex += y * bytes;
-
-                    uint8_t bitMask = 1 << (7 - (x % 8));
-
-                    if ((font->chars[i].image->image[byteIndex] & bitMask) == 0)
-                    {
-                        twr_gfx_draw_pixel(self, left + x, top + y, color);
-                    }
-                }
+                _twr_gfx_draw_rle(self, left, top, font->chars[i].image->image, w, color);
+            }
+            else
+            {
+                twr_gfx_draw_bitmap(self, left, top, font->chars[i].image->image, w, h, color);
             }
         }
     }
@@ -178,7 +274,7 @@ int twr_gfx_printf(twr_gfx_t *self, int left, int top, uint32_t color, char *for
 
     va_start(ap, format);
 
-    vsnprintf(buffer, sizeof(buffer), format, ap);
+    twr_fmt_vsnprintf(buffer, sizeof(buffer), format, ap);
 
     va_end(ap);
 
@@ -198,10 +294,7 @@ void twr_gfx_draw_line(twr_gfx_t *self, int x0, int y0, int x1, int y1, uint32_t
             x1 = tmp;
         }
 
-        for (; x0 <= x1; x0++)
-        {
-            twr_gfx_draw_pixel(self, x0, y0, color);
-        }
+        _twr_gfx_fill(self, x0, y0, x1, y1, color);
 
         return;
     }
@@ -214,10 +307,7 @@ void twr_gfx_draw_line(twr_gfx_t *self, int x0, int y0, int x1, int y1, uint32_t
             y1 = tmp;
         }
 
-        for (; y0 <= y1; y0++)
-        {
-            twr_gfx_draw_pixel(self, x0, y0, color);
-        }
+        _twr_gfx_fill(self, x0, y0, x1, y1, color);
 
         return;
     }
@@ -285,14 +375,7 @@ void twr_gfx_draw_rectangle(twr_gfx_t *self, int x0, int y0, int x1, int y1, uin
 
 void twr_gfx_draw_fill_rectangle(twr_gfx_t *self, int x0, int y0, int x1, int y1, uint32_t color)
 {
-    int y;
-    for (; x0 <= x1; x0++)
-    {
-        for (y = y0; y <= y1; y++)
-        {
-            twr_gfx_draw_pixel(self, x0, y, color);
-        }
-    }
+    _twr_gfx_fill(self, x0, y0, x1, y1, color);
 }
 
 void twr_gfx_draw_fill_rectangle_dithering(twr_gfx_t *self, int x0, int y0, int x1, int y1, uint32_t color)
@@ -492,3 +575,155 @@ bool twr_gfx_update(twr_gfx_t *self)
 {
     return self->_driver->update(self->_display);
 }
+
+static void _twr_gfx_rotate(twr_gfx_t *self, int *x, int *y)
+{
+    int tmp;
+
+    switch (self->_rotation)
+    {
+        case TWR_GFX_ROTATION_90:
+        {
+            tmp = *x;
+            *x = self->_caps.width - 1 - *y;
+            *y = tmp;
+            break;
+        }
+        case TWR_GFX_ROTATION_180:
+        {
+            *x = self->_caps.width - 1 - *x;
+            *y = self->_caps.height - 1 - *y;
+            break;
+        }
+        case TWR_GFX_ROTATION_270:
+        {
+            tmp = *y;
+            *y = self->_caps.height - 1 - *x;
+            *x = tmp;
+            break;
+        }
+        case TWR_GFX_ROTATION_0:
+        {
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+static bool _twr_gfx_clip(twr_gfx_t *self, int *x0, int *y0, int *x1, int *y1)
+{
+    int width = self->_caps.width;
+    int height = self->_caps.height;
+
+    if (self->_rotation == TWR_GFX_ROTATION_90 || self->_rotation == TWR_GFX_ROTATION_270)
+    {
+        width = self->_caps.height;
+        height = self->_caps.width;
+    }
+
+    if (*x0 < 0)
+    {
+        *x0 = 0;
+    }
+
+    if (*y0 < 0)
+    {
+        *y0 = 0;
+    }
+
+    if (*x1 >= width)
+    {
+        *x1 = width - 1;
+    }
+
+    if (*y1 >= height)
+    {
+        *y1 = height - 1;
+    }
+
+    return *x0 <= *x1 && *y0 <= *y1;
+}
+
+static void _twr_gfx_fill(twr_gfx_t *self, int x0, int y0, int x1, int y1, uint32_t color)
+{
+    if (!_twr_gfx_clip(self, &x0, &y0, &x1, &y1))
+    {
+        return;
+    }
+
+    // Rotated rectangle is still rectangle, only its corners have to be rotated
+    _twr_gfx_rotate(self, &x0, &y0);
+    _twr_gfx_rotate(self, &x1, &y1);
+
+    int tmp;
+
+    if (x0 > x1)
+    {
+        tmp = x0;
+        x0 = x1;
+        x1 = tmp;
+    }
+
+    if (y0 > y1)
+    {
+        tmp = y0;
+        y0 = y1;
+        y1 = tmp;
+    }
+
+    for (int y = y0; y <= y1; y++)
+    {
+        if (self->_driver->draw_span != NULL)
+        {
+            self->_driver->draw_span(self->_display, x0, y, x1 - x0 + 1, color);
+        }
+        else
+        {
+            for (int x = x0; x <= x1; x++)
+            {
+                self->_driver->draw_pixel(self->_display, x, y, color);
+            }
+        }
+    }
+}
+
+static void _twr_gfx_draw_rle(twr_gfx_t *self, int left, int top, const uint8_t *image, int width, uint32_t color)
+{
+    int x = 0;
+    int y = 0;
+
+    while (*image != 0x00)
+    {
+        x += *image >> 4;
+
+        while (x >= width)
+        {
+            x -= width;
+            y++;
+        }
+
+        int run = *image & 0x0f;
+
+        // Run of drawn pixels is split into spans at the end of row
+        while (run > 0)
+        {
+            int length = width - x < run ? width - x : run;
+
+            _twr_gfx_fill(self, left + x, top + y, left + x + length - 1, top + y, color);
+
+            run -= length;
+            x += length;
+
+            if (x == width)
+            {
+                x = 0;
+                y++;
+            }
+        }
+
+        image++;
+    }
+}
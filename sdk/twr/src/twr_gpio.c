@@ -325,7 +325,7 @@ const uint32_t twr_gpio_32_bit_upper_mask[TWR_GPIO_CHANNEL_COUNT] =
 void twr_gpio_init(twr_gpio_channel_t channel)
 {
     // Disable interrupts
-    twr_irq_disable();
+    uint32_t primask = twr_irq_save();
 
     // Enable GPIO clock
     RCC->IOPENR |= _twr_gpio_iopenr_mask[channel];
@@ -334,13 +334,13 @@ void twr_gpio_init(twr_gpio_channel_t channel)
     RCC->IOPENR;
 
     // Enable interrupts
-    twr_irq_enable();
+    twr_irq_restore(primask);
 }
 
 void twr_gpio_set_pull(twr_gpio_channel_t channel, twr_gpio_pull_t pull)
 {
     // Disable interrupts
-    twr_irq_disable();
+    uint32_t primask = twr_irq_save();
 
     // Read PUPDR register
     uint32_t pupdr = twr_gpio_port[channel]->PUPDR;
@@ -355,7 +355,7 @@ void twr_gpio_set_pull(twr_gpio_channel_t channel, twr_gpio_pull_t pull)
     twr_gpio_port[channel]->PUPDR = pupdr;
 
     // Enable interrupts
-    twr_irq_enable();
+    twr_irq_restore(primask);
 }
 
 twr_gpio_pull_t twr_gpio_get_pull(twr_gpio_channel_t channel)
@@ -367,7 +367,7 @@ twr_gpio_pull_t twr_gpio_get_pull(twr_gpio_channel_t channel)
 void twr_gpio_set_mode(twr_gpio_channel_t channel, twr_gpio_mode_t mode)
 {
     // Disable interrupts
-    twr_irq_disable();
+    uint32_t primask = twr_irq_save();
 
     // Read OTYPER register
     uint32_t otyper = twr_gpio_port[channel]->OTYPER;
@@ -422,7 +422,7 @@ void twr_gpio_set_mode(twr_gpio_channel_t channel, twr_gpio_mode_t mode)
     twr_gpio_port[channel]->MODER = moder;
 
     // Enable interrupts
-    twr_irq_enable();
+    twr_irq_restore(primask);
 }
 
 twr_gpio_mode_t twr_gpio_get_mode(twr_gpio_channel_t channel)
@@ -483,11 +483,30 @@ int twr_gpio_get_output(twr_gpio_channel_t channel)
 void twr_gpio_toggle_output(twr_gpio_channel_t channel)
 {
     // Disable interrupts
-    twr_irq_disable();
+    uint32_t primask = twr_irq_save();
 
     // Write ODR register with inverted bit
     twr_gpio_port[channel]->ODR ^= twr_gpio_16_bit_mask[channel];
 
     // Enable interrupts
-    twr_irq_enable();
+    twr_irq_restore(primask);
+}
+
+bool twr_gpio_group_init(twr_gpio_group_t *group, const twr_gpio_channel_t *channels, size_t count)
+{
+    group->port = count != 0 ? twr_gpio_port[channels[0]] : NULL;
+    group->mask = 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        // Single BSRR/IDR access can cover one port only
+        if (twr_gpio_port[channels[i]] != group->port)
+        {
+            return false;
+        }
+
+        group->mask |= twr_gpio_16_bit_mask[channels[i]];
+    }
+
+    return true;
 }
@@ -4,11 +4,18 @@
 #define _TWR_HDC2080_DELAY_RUN 50
 #define _TWR_HDC2080_DELAY_INITIALIZATION 50
 #define _TWR_HDC2080_DELAY_MEASUREMENT 50
+#define _TWR_HDC2080_DELAY_RETRY 1000
 
 static void _twr_hdc2080_task_interval(void *param);
 
 static void _twr_hdc2080_task_measure(void *param);
 
+static bool _twr_hdc2080_auto_configure(twr_hdc2080_t *self);
+
+static void _twr_hdc2080_exti_handler(twr_exti_line_t line, void *param);
+
+static uint8_t _twr_hdc2080_threshold(float value, float offset, float range);
+
 void twr_hdc2080_init(twr_hdc2080_t *self, twr_i2c_channel_t i2c_channel, uint8_t i2c_address)
 {
     memset(self, 0, sizeof(*self));
@@ -28,6 +35,11 @@ void twr_hdc2080_deinit(twr_hdc2080_t *self)
 {
     twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x0e, 0x80);
 
+    if (self->_auto != TWR_HDC2080_AUTO_DISABLED)
+    {
+        twr_exti_unregister(self->_exti_line);
+    }
+
     twr_scheduler_unregister(self->_task_id_interval);
 
     twr_scheduler_unregister(self->_task_id_measure);
@@ -69,6 +81,56 @@ bool twr_hdc2080_measure(twr_hdc2080_t *self)
     return true;
 }
 
+void twr_hdc2080_set_auto_measurement(twr_hdc2080_t *self, twr_hdc2080_auto_t rate, twr_exti_line_t line)
+{
+    if (self->_auto != TWR_HDC2080_AUTO_DISABLED)
+    {
+        twr_exti_unregister(self->_exti_line);
+    }
+
+    self->_auto = rate;
+    self->_exti_line = line;
+    self->_auto_configured = false;
+
+    if (self->_auto != TWR_HDC2080_AUTO_DISABLED)
+    {
+        twr_exti_register_deferred(self->_exti_line, TWR_EXTI_EDGE_RISING, _twr_hdc2080_exti_handler, self);
+    }
+
+    // Configuration is written by measure task before its next measurement
+    if (!_twr_hdc2080_auto_configure(self))
+    {
+        twr_hdc2080_measure(self);
+    }
+}
+
+void twr_hdc2080_set_thresholds(twr_hdc2080_t *self, float temperature_low, float temperature_high, float humidity_low, float humidity_high)
+{
+    self->_thresholds[0] = _twr_hdc2080_threshold(temperature_low, 40.f, 165.f);
+    self->_thresholds[1] = _twr_hdc2080_threshold(temperature_high, 40.f, 165.f);
+    self->_thresholds[2] = _twr_hdc2080_threshold(humidity_low, 0.f, 100.f);
+    self->_thresholds[3] = _twr_hdc2080_threshold(humidity_high, 0.f, 100.f);
+
+    self->_thresholds_enabled = true;
+    self->_auto_configured = false;
+
+    if (!_twr_hdc2080_auto_configure(self))
+    {
+        twr_hdc2080_measure(self);
+    }
+}
+
+void twr_hdc2080_clear_thresholds(twr_hdc2080_t *self)
+{
+    self->_thresholds_enabled = false;
+    self->_auto_configured = false;
+
+    if (!_twr_hdc2080_auto_configure(self))
+    {
+        twr_hdc2080_measure(self);
+    }
+}
+
 bool twr_hdc2080_get_humidity_raw(twr_hdc2080_t *self, uint16_t *raw)
 {
     if (!self->_humidity_valid)
@@ -139,115 +201,190 @@ static void _twr_hdc2080_task_measure(void *param)
 {
     twr_hdc2080_t *self = param;
 
-start:
+    TWR_COROUTINE_BEGIN(&self->_coroutine);
 
-    switch (self->_state)
+    if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x0e, 0x80))
     {
-        case TWR_HDC2080_STATE_ERROR:
-        {
-            self->_humidity_valid = false;
-            self->_temperature_valid = false;
+        goto error;
+    }
 
-            self->_measurement_active = false;
+    self->_tick_ready = twr_tick_get() + _TWR_HDC2080_DELAY_INITIALIZATION;
 
-            if (self->_event_handler != NULL)
-            {
-                self->_event_handler(self, TWR_HDC2080_EVENT_ERROR, self->_event_param);
-            }
+    // Reset cleared auto-measurement configuration
+    self->_auto_configured = false;
 
-            self->_state = TWR_HDC2080_STATE_INITIALIZE;
+    self->_initialized = true;
 
-            return;
-        }
-        case TWR_HDC2080_STATE_INITIALIZE:
-        {
-            self->_state = TWR_HDC2080_STATE_ERROR;
+    if (self->_measurement_active)
+    {
+        twr_scheduler_plan_current_absolute(self->_tick_ready);
+    }
 
-            if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x0e, 0x80))
+    // Continued by twr_hdc2080_measure
+    TWR_COROUTINE_SUSPEND(&self->_coroutine);
+
+    while (true)
+    {
+        if (!self->_auto_configured)
+        {
+            if (!_twr_hdc2080_auto_configure(self))
             {
-                goto start;
+                goto error;
             }
 
-            self->_state = TWR_HDC2080_STATE_MEASURE;
+            // The first measurement of auto-measurement mode is reported by DRDY/INT pin
+            if (self->_auto != TWR_HDC2080_AUTO_DISABLED)
+            {
+                self->_measurement_active = false;
 
-            self->_tick_ready = twr_tick_get() + _TWR_HDC2080_DELAY_INITIALIZATION;
+                TWR_COROUTINE_SUSPEND(&self->_coroutine);
 
-            if (self->_measurement_active)
-            {
-                twr_scheduler_plan_current_absolute(self->_tick_ready);
+                continue;
             }
-
-            return;
         }
-        case TWR_HDC2080_STATE_MEASURE:
-        {
-            self->_state = TWR_HDC2080_STATE_ERROR;
 
+        if (self->_auto == TWR_HDC2080_AUTO_DISABLED)
+        {
             if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x0f, 0x07))
             {
-                goto start;
+                goto error;
             }
 
-            self->_state = TWR_HDC2080_STATE_READ;
+            TWR_COROUTINE_WAIT_MS(&self->_coroutine, _TWR_HDC2080_DELAY_MEASUREMENT);
+        }
 
-            twr_scheduler_plan_current_from_now(_TWR_HDC2080_DELAY_MEASUREMENT);
+        // Reading of status clears DRDY/INT pin
+        if (!twr_i2c_memory_read_8b(self->_i2c_channel, self->_i2c_address, 0x04, &self->_reg_interrupt))
+        {
+            goto error;
+        }
 
-            return;
+        if (self->_auto == TWR_HDC2080_AUTO_DISABLED && (self->_reg_interrupt & 0x80) == 0)
+        {
+            goto error;
         }
-        case TWR_HDC2080_STATE_READ:
+
+        // Temperature and humidity registers are read in one transaction, core sleeps meanwhile
+        self->_transaction.type = TWR_I2C_ASYNC_MEMORY_READ;
+        self->_transaction.device_address = self->_i2c_address;
+        self->_transaction.memory_address = 0x00;
+        self->_transaction.buffer = self->_buffer;
+        self->_transaction.length = sizeof(self->_buffer);
+
+        TWR_COROUTINE_AWAIT_I2C(&self->_coroutine, self->_i2c_channel, &self->_transaction);
+
+        if (!twr_coroutine_get_result(&self->_coroutine))
         {
-            self->_state = TWR_HDC2080_STATE_ERROR;
+            goto error;
+        }
 
-            uint8_t reg_interrupt;
+        self->_reg_temperature = self->_buffer[1] << 8 | self->_buffer[0];
+        self->_reg_humidity = self->_buffer[3] << 8 | self->_buffer[2];
 
-            if (!twr_i2c_memory_read_8b(self->_i2c_channel, self->_i2c_address, 0x04, &reg_interrupt))
-            {
-                goto start;
-            }
+        self->_temperature_valid = true;
+        self->_humidity_valid = true;
 
-            if ((reg_interrupt & 0x80) == 0)
-            {
-                goto start;
-            }
+        self->_measurement_active = false;
 
-            if (!twr_i2c_memory_read_16b(self->_i2c_channel, self->_i2c_address, 0x02, &self->_reg_humidity))
-            {
-                goto start;
-            }
+        if (self->_event_handler != NULL)
+        {
+            self->_event_handler(self, (self->_reg_interrupt & 0x78) != 0 ? TWR_HDC2080_EVENT_THRESHOLD : TWR_HDC2080_EVENT_UPDATE, self->_event_param);
+        }
 
-            if (!twr_i2c_memory_read_16b(self->_i2c_channel, self->_i2c_address, 0x00, &self->_reg_temperature))
-            {
-                goto start;
-            }
+        TWR_COROUTINE_SUSPEND(&self->_coroutine);
+    }
 
-            self->_reg_temperature = self->_reg_temperature << 8 | self->_reg_temperature >> 8;
-            self->_reg_humidity = self->_reg_humidity << 8 | self->_reg_humidity >> 8;
+error:
 
-            self->_temperature_valid = true;
-            self->_humidity_valid = true;
+    self->_initialized = false;
 
-            self->_state = TWR_HDC2080_STATE_UPDATE;
+    self->_humidity_valid = false;
+    self->_temperature_valid = false;
 
-            goto start;
-        }
-        case TWR_HDC2080_STATE_UPDATE:
-        {
-            self->_measurement_active = false;
+    self->_measurement_active = false;
 
-            if (self->_event_handler != NULL)
-            {
-                self->_event_handler(self, TWR_HDC2080_EVENT_UPDATE, self->_event_param);
-            }
+    if (self->_event_handler != NULL)
+    {
+        self->_event_handler(self, TWR_HDC2080_EVENT_ERROR, self->_event_param);
+    }
 
-            self->_state = TWR_HDC2080_STATE_MEASURE;
+    // Nothing triggers auto-measurement mode without its configuration
+    if (self->_auto != TWR_HDC2080_AUTO_DISABLED && twr_hdc2080_measure(self))
+    {
+        twr_scheduler_plan_current_from_now(_TWR_HDC2080_DELAY_RETRY);
+    }
 
-            return;
-        }
-        default:
-        {
-            self->_state = TWR_HDC2080_STATE_ERROR;
+    // Initialization is run again by the next measurement
+    TWR_COROUTINE_RESTART(&self->_coroutine);
 
-            goto start;
-        }
+    TWR_COROUTINE_END(&self->_coroutine);
+}
+
+static bool _twr_hdc2080_auto_configure(twr_hdc2080_t *self)
+{
+    if (self->_auto_configured)
+    {
+        return true;
+    }
+
+    // Sensor is configured by measure task after its initialization
+    if (!self->_initialized || self->_measurement_active || twr_tick_get() < self->_tick_ready)
+    {
+        return false;
+    }
+
+    uint8_t enable = self->_thresholds_enabled ? 0x78 : 0x80;
+
+    // Auto-measurement rate, DRDY/INT pin enabled, active high, level sensitive
+    uint8_t config = self->_auto << 4 | (self->_auto != TWR_HDC2080_AUTO_DISABLED ? 0x06 : 0x00);
+
+    twr_i2c_memory_transfer_t transfer;
+
+    transfer.device_address = self->_i2c_address;
+    transfer.memory_address = 0x0a;
+    transfer.buffer = self->_thresholds;
+    transfer.length = sizeof(self->_thresholds);
+
+    if (!twr_i2c_memory_write(self->_i2c_channel, &transfer) ||
+            !twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x07, enable) ||
+            !twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x0e, config))
+    {
+        return false;
+    }
+
+    // Start conversions
+    if (self->_auto != TWR_HDC2080_AUTO_DISABLED && !twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x0f, 0x01))
+    {
+        return false;
+    }
+
+    self->_auto_configured = true;
+
+    return true;
+}
+
+static void _twr_hdc2080_exti_handler(twr_exti_line_t line, void *param)
+{
+    (void) line;
+
+    twr_hdc2080_t *self = param;
+
+    twr_hdc2080_measure(self);
+}
+
+static uint8_t _twr_hdc2080_threshold(float value, float offset, float range)
+{
+    float raw = (value + offset) / range * 256.f;
+
+    if (raw < 0.f)
+    {
+        return 0;
     }
+
+    if (raw > 255.f)
+    {
+        return 255;
+    }
+
+    return (uint8_t) raw;
 }
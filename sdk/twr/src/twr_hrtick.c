@@ -0,0 +1,129 @@
+#include <twr_hrtick.h>
+#include <twr_irq.h>
+#include <stm32l0xx.h>
+
+// Number of auto-reload matches, counted when counter reaches 0xffff (one LSE period before it wraps to zero)
+static volatile uint32_t _twr_hrtick_overflow;
+
+static bool _twr_hrtick_running;
+
+static inline uint16_t _twr_hrtick_read_counter(void);
+
+bool twr_hrtick_init(void)
+{
+    if (_twr_hrtick_running)
+    {
+        return true;
+    }
+
+    // LPTIM1 is taken by hardware timing of twr_led
+    if ((RCC->APB1ENR & RCC_APB1ENR_LPTIM1EN) != 0)
+    {
+        return false;
+    }
+
+    RCC->APB1ENR |= RCC_APB1ENR_LPTIM1EN;
+
+    // Errata workaround
+    RCC->APB1ENR;
+
+    // LSE as clock source
+    RCC->CCIPR |= RCC_CCIPR_LPTIM1SEL;
+
+    LPTIM1->CR = 0;
+
+    // No prescaler, configuration and interrupt enable can be changed only with timer disabled
+    LPTIM1->CFGR = 0;
+
+    LPTIM1->IER = LPTIM_IER_ARRMIE;
+
+    LPTIM1->CR = LPTIM_CR_ENABLE;
+
+    LPTIM1->ICR = LPTIM_ICR_ARROKCF;
+
+    LPTIM1->ARR = 0xffff;
+
+    while ((LPTIM1->ISR & LPTIM_ISR_ARROK) == 0)
+    {
+        continue;
+    }
+
+    LPTIM1->ICR = LPTIM_ICR_ARROKCF | LPTIM_ICR_ARRMCF;
+
+    _twr_hrtick_overflow = 0;
+
+    // LPTIM1 interrupt wakes up from stop mode through EXTI line 29
+    EXTI->IMR |= EXTI_IMR_IM29;
+
+    NVIC_EnableIRQ(LPTIM1_IRQn);
+
+    LPTIM1->CR |= LPTIM_CR_CNTSTRT;
+
+    _twr_hrtick_running = true;
+
+    return true;
+}
+
+bool twr_hrtick_is_running(void)
+{
+    return _twr_hrtick_running;
+}
+
+uint64_t twr_hrtick_get(void)
+{
+    uint32_t overflow;
+    uint16_t counter;
+    bool pending;
+
+    // Read again if overflow has been counted in between
+    do
+    {
+        overflow = _twr_hrtick_overflow;
+
+        // Counting from one makes the match at 0xffff (which counts the overflow) coincide with wrap to zero
+        counter = _twr_hrtick_read_counter() + 1;
+
+        pending = (LPTIM1->ISR & LPTIM_ISR_ARRM) != 0;
+
+    } while (overflow != _twr_hrtick_overflow);
+
+    // Overflow not counted yet as interrupt is disabled or preempted by caller
+    if (pending && counter < 0x8000)
+    {
+        overflow++;
+    }
+
+    uint64_t counts = ((uint64_t) overflow << 16) + counter - 1;
+
+    // LSE period is 1000000 / 32768 = 15625 / 512 us, division is a shift
+    return counts * 15625 / 512;
+}
+
+uint32_t twr_hrtick_get_32(void)
+{
+    return (uint32_t) twr_hrtick_get();
+}
+
+TWR_RAMFUNC void LPTIM1_IRQHandler(void)
+{
+    if ((LPTIM1->ISR & LPTIM_ISR_ARRM) != 0)
+    {
+        LPTIM1->ICR = LPTIM_ICR_ARRMCF;
+
+        _twr_hrtick_overflow++;
+    }
+}
+
+static inline uint16_t _twr_hrtick_read_counter(void)
+{
+    uint16_t counter;
+
+    // Counter is clocked asynchronously, the value is valid when two consecutive reads match
+    do
+    {
+        counter = LPTIM1->CNT;
+
+    } while (counter != LPTIM1->CNT);
+
+    return counter;
+}
@@ -8,6 +8,8 @@
 #include <twr_onewire.h>
 #include <twr_system.h>
 #include <twr_gpio.h>
+#include <twr_irq.h>
+#include <twr_timer.h>
 
 #define _TWR_I2C_TX_TIMEOUT_ADJUST_FACTOR 1.5
 #define _TWR_I2C_RX_TIMEOUT_ADJUST_FACTOR 1.5
@@ -21,14 +23,62 @@
 #define _TWR_I2C_GENERATE_START_WRITE       I2C_CR2_START
 #define _TWR_I2C_BYTE_TRANSFER_TIME_US_100     80
 #define _TWR_I2C_BYTE_TRANSFER_TIME_US_400     20
+#define _TWR_I2C_BYTE_TRANSFER_TIME_US_1000    10
 
 #define __TWR_I2C_RESET_PERIPHERAL(__I2C__) {__I2C__->CR1 &= ~I2C_CR1_PE; __I2C__->CR1 |= I2C_CR1_PE; }
 
+#define _TWR_I2C_CHANNEL(__I2C__) ((__I2C__) == I2C2 ? TWR_I2C_I2C0 : TWR_I2C_I2C1)
+
+#if TWR_I2C_STATS
+#define _TWR_I2C_STATS_INC(__CHANNEL__, __FIELD__) (_twr_i2c[__CHANNEL__].stats.__FIELD__++)
+#else
+#define _TWR_I2C_STATS_INC(__CHANNEL__, __FIELD__)
+#endif
+
+// Transactions running longer than 16-bit microsecond timer range are measured by tick
+#define _TWR_I2C_MEASURE_TIMER_LIMIT_MS 50
+
+typedef struct
+{
+    twr_tick_t tick;
+    uint16_t microseconds;
+
+} _twr_i2c_measure_t;
+
+#define _TWR_I2C_ASYNC_IRQ_MASK (I2C_CR1_TXIE | I2C_CR1_RXIE | I2C_CR1_NACKIE | I2C_CR1_STOPIE | I2C_CR1_TCIE | I2C_CR1_ERRIE)
+
+typedef enum
+{
+    _TWR_I2C_ASYNC_STATE_IDLE = 0,
+    _TWR_I2C_ASYNC_STATE_RUNNING = 1,
+    _TWR_I2C_ASYNC_STATE_DONE = 2
+
+} _twr_i2c_async_state_t;
+
 static struct
 {
     int initialized_semaphore;
     twr_i2c_speed_t speed;
     I2C_TypeDef *i2c;
+    twr_i2c_async_t *async_head;
+    twr_i2c_async_t *async_tail;
+    volatile _twr_i2c_async_state_t async_state;
+    bool async_error;
+    bool async_task_registered;
+    twr_scheduler_task_id_t async_task_id;
+    size_t async_index;
+    uint8_t async_address[2];
+    uint8_t async_address_length;
+    uint8_t async_address_index;
+    twr_tick_t async_tick_timeout;
+    _twr_i2c_measure_t measure;
+    _twr_i2c_measure_t async_measure;
+#if TWR_I2C_STATS
+    twr_i2c_stats_t stats;
+#endif
+#if TWR_I2C_ADAPTIVE_TIMEOUT
+    uint32_t byte_time_us;
+#endif
 
 } _twr_i2c[] = {
     [TWR_I2C_I2C0] = { .initialized_semaphore = 0, .i2c = I2C2 },
@@ -39,6 +89,7 @@ static struct
 static twr_tick_t tick_timeout;
 static twr_ds28e17_t ds28e17;
 
+static bool _twr_i2c_memory_transfer(I2C_TypeDef *i2c, const twr_i2c_memory_transfer_t *transfer, bool write);
 static bool _twr_i2c_mem_write(I2C_TypeDef *i2c, uint8_t device_address, uint16_t memory_address, uint16_t memory_address_length, uint8_t *buffer, uint16_t length);
 static bool _twr_i2c_mem_read(I2C_TypeDef *i2c, uint8_t device_address, uint16_t memory_address, uint16_t memory_address_length, uint8_t *buffer, uint16_t length);
 static bool _twr_i2c_req_mem_write(I2C_TypeDef *i2c, uint8_t device_address, uint16_t memory_address, uint16_t memory_address_length);
@@ -53,6 +104,13 @@ static uint32_t twr_i2c_get_timeout_us(twr_i2c_channel_t channel, size_t length)
 static void _twr_i2c_timeout_begin(uint32_t timeout_ms);
 static bool _twr_i2c_timeout_is_expired(void);
 static void _twr_i2c_restore_bus(I2C_TypeDef *i2c);
+static bool _twr_i2c_async_wait(twr_i2c_channel_t channel);
+static void _twr_i2c_measure_begin(_twr_i2c_measure_t *measure);
+static void _twr_i2c_measure_end(twr_i2c_channel_t channel, _twr_i2c_measure_t *measure, size_t length, bool status);
+static void _twr_i2c_failure(twr_i2c_channel_t channel);
+static void _twr_i2c_async_start(twr_i2c_channel_t channel);
+static void _twr_i2c_async_task(void *param);
+static void _twr_i2c_async_irq(twr_i2c_channel_t channel);
 
 void twr_i2c_init(twr_i2c_channel_t channel, twr_i2c_speed_t speed)
 {
@@ -61,6 +119,10 @@ void twr_i2c_init(twr_i2c_channel_t channel, twr_i2c_speed_t speed)
         return;
     }
 
+#if TWR_I2C_STATS || TWR_I2C_ADAPTIVE_TIMEOUT
+    twr_timer_init();
+#endif
+
     if (channel == TWR_I2C_I2C0)
     {
         twr_gpio_init(TWR_GPIO_SCL0);
@@ -84,6 +146,8 @@ void twr_i2c_init(twr_i2c_channel_t channel, twr_i2c_speed_t speed)
         // Enable I2C2 peripheral
         I2C2->CR1 |= I2C_CR1_PE;
 
+        NVIC_EnableIRQ(I2C2_IRQn);
+
         twr_i2c_set_speed(channel, speed);
     }
     else if (channel == TWR_I2C_I2C1)
@@ -109,6 +173,8 @@ void twr_i2c_init(twr_i2c_channel_t channel, twr_i2c_speed_t speed)
         // Enable I2C1 peripheral
         I2C1->CR1 |= I2C_CR1_PE;
 
+        NVIC_EnableIRQ(I2C1_IRQn);
+
         twr_i2c_set_speed(channel, speed);
     }
     else if (channel == TWR_I2C_I2C_1W)
@@ -146,6 +212,8 @@ void twr_i2c_deinit(twr_i2c_channel_t channel)
 
     if (channel == TWR_I2C_I2C0)
     {
+        NVIC_DisableIRQ(I2C2_IRQn);
+
         // Disable I2C2 peripheral
         I2C2->CR1 &= ~I2C_CR1_PE;
 
@@ -165,6 +233,8 @@ void twr_i2c_deinit(twr_i2c_channel_t channel)
     }
     else if (channel == TWR_I2C_I2C1)
     {
+        NVIC_DisableIRQ(I2C1_IRQn);
+
         // Disable I2C1 peripheral
         I2C1->CR1 &= ~I2C_CR1_PE;
 
@@ -215,7 +285,11 @@ void twr_i2c_set_speed(twr_i2c_channel_t channel, twr_i2c_speed_t speed)
         return;
     }
 
-    if (speed == TWR_I2C_SPEED_400_KHZ)
+    if (speed == TWR_I2C_SPEED_1_MHZ)
+    {
+        timingr = 0x500913;
+    }
+    else if (speed == TWR_I2C_SPEED_400_KHZ)
     {
         timingr = 0x301d1d;
     }
@@ -224,6 +298,24 @@ void twr_i2c_set_speed(twr_i2c_channel_t channel, twr_i2c_speed_t speed)
         timingr = 0x709595;
     }
 
+    // Enable SYSCFG clock
+    RCC->APB2ENR |= RCC_APB2ENR_SYSCFGEN;
+
+    // Errata workaround
+    RCC->APB2ENR;
+
+    // Fast-mode Plus needs 20 mA drive on SCL and SDA
+    uint32_t fmp = channel == TWR_I2C_I2C0 ? SYSCFG_CFGR2_I2C2_FMP : SYSCFG_CFGR2_I2C_PB8_FMP | SYSCFG_CFGR2_I2C_PB9_FMP;
+
+    if (speed == TWR_I2C_SPEED_1_MHZ)
+    {
+        SYSCFG->CFGR2 |= fmp;
+    }
+    else
+    {
+        SYSCFG->CFGR2 &= ~fmp;
+    }
+
     if (channel == TWR_I2C_I2C0)
     {
         I2C2->CR1 &= ~I2C_CR1_PE;
@@ -252,10 +344,17 @@ bool twr_i2c_write(twr_i2c_channel_t channel, const twr_i2c_transfer_t *transfer
         return twr_ds28e17_write(&ds28e17, transfer);
     }
 
+    if (!_twr_i2c_async_wait(channel))
+    {
+        return false;
+    }
+
     I2C_TypeDef *i2c = _twr_i2c[channel].i2c;
 
     twr_system_pll_enable();
 
+    _twr_i2c_measure_begin(&_twr_i2c[channel].measure);
+
     // Get maximum allowed timeout in ms
     uint32_t timeout_ms = _TWR_I2C_TX_TIMEOUT_ADJUST_FACTOR * twr_i2c_get_timeout_ms(channel, transfer->length);
 
@@ -276,10 +375,14 @@ bool twr_i2c_write(twr_i2c_channel_t channel, const twr_i2c_transfer_t *transfer
     // If error occured ( timeout | NACK | ... ) ...
     if (status == false)
     {
+        _twr_i2c_failure(channel);
+
         // Reset I2C peripheral to generate STOP conditions immediately
         __TWR_I2C_RESET_PERIPHERAL(i2c);
     }
 
+    _twr_i2c_measure_end(channel, &_twr_i2c[channel].measure, transfer->length, status);
+
     twr_system_pll_disable();
 
     return status;
@@ -298,10 +401,17 @@ bool twr_i2c_read(twr_i2c_channel_t channel, const twr_i2c_transfer_t *transfer)
         return twr_ds28e17_read(&ds28e17, transfer);
     }
 
+    if (!_twr_i2c_async_wait(channel))
+    {
+        return false;
+    }
+
     I2C_TypeDef *i2c = _twr_i2c[channel].i2c;
 
     twr_system_pll_enable();
 
+    _twr_i2c_measure_begin(&_twr_i2c[channel].measure);
+
     // Get maximum allowed timeout in ms
     uint32_t timeout_ms = _TWR_I2C_RX_TIMEOUT_ADJUST_FACTOR * twr_i2c_get_timeout_ms(channel, transfer->length);
 
@@ -322,9 +432,13 @@ bool twr_i2c_read(twr_i2c_channel_t channel, const twr_i2c_transfer_t *transfer)
     // If error occured ( timeout | NACK | ... ) ...
     if (status == false)
     {
+        _twr_i2c_failure(channel);
+
         _twr_i2c_restore_bus(i2c);
     }
 
+    _twr_i2c_measure_end(channel, &_twr_i2c[channel].measure, transfer->length, status);
+
     twr_system_pll_disable();
 
     return status;
@@ -342,30 +456,24 @@ bool twr_i2c_memory_write(twr_i2c_channel_t channel, const twr_i2c_memory_transf
         return twr_ds28e17_memory_write(&ds28e17, transfer);
     }
 
-    I2C_TypeDef *i2c = _twr_i2c[channel].i2c;
+    if (!_twr_i2c_async_wait(channel))
+    {
+        return false;
+    }
 
     // Enable PLL and disable sleep
     twr_system_pll_enable();
 
-    uint16_t transfer_memory_address_length =
-            (transfer->memory_address & TWR_I2C_MEMORY_ADDRESS_16_BIT) != 0 ? _TWR_I2C_MEMORY_ADDRESS_SIZE_16BIT : _TWR_I2C_MEMORY_ADDRESS_SIZE_8BIT;
+    _twr_i2c_measure_begin(&_twr_i2c[channel].measure);
 
-    // If memory write failed ...
-    if (!_twr_i2c_mem_write(i2c, transfer->device_address << 1, transfer->memory_address, transfer_memory_address_length, transfer->buffer, transfer->length))
-    {
-        // Reset I2C peripheral to generate STOP conditions immediately
-        __TWR_I2C_RESET_PERIPHERAL(i2c);
+    bool status = _twr_i2c_memory_transfer(_twr_i2c[channel].i2c, transfer, true);
 
-        // Disable PLL and enable sleep
-        twr_system_pll_disable();
-
-        return false;
-    }
+    _twr_i2c_measure_end(channel, &_twr_i2c[channel].measure, transfer->length, status);
 
     // Disable PLL and enable sleep
     twr_system_pll_disable();
 
-    return true;
+    return status;
 }
 
 bool twr_i2c_memory_read(twr_i2c_channel_t channel, const twr_i2c_memory_transfer_t *transfer)
@@ -380,31 +488,149 @@ bool twr_i2c_memory_read(twr_i2c_channel_t channel, const twr_i2c_memory_transfe
         return twr_ds28e17_memory_read(&ds28e17, transfer);
     }
 
-    I2C_TypeDef *i2c = _twr_i2c[channel].i2c;
+    if (!_twr_i2c_async_wait(channel))
+    {
+        return false;
+    }
 
     // Enable PLL and disable sleep
     twr_system_pll_enable();
 
-    uint16_t transfer_memory_address_length =
-            (transfer->memory_address & TWR_I2C_MEMORY_ADDRESS_16_BIT) != 0 ? _TWR_I2C_MEMORY_ADDRESS_SIZE_16BIT : _TWR_I2C_MEMORY_ADDRESS_SIZE_8BIT;
+    _twr_i2c_measure_begin(&_twr_i2c[channel].measure);
 
-    // If error occurs during memory read ...
-    if (!_twr_i2c_mem_read(i2c, transfer->device_address << 1, transfer->memory_address, transfer_memory_address_length, transfer->buffer, transfer->length))
+    bool status = _twr_i2c_memory_transfer(_twr_i2c[channel].i2c, transfer, false);
+
+    _twr_i2c_measure_end(channel, &_twr_i2c[channel].measure, transfer->length, status);
+
+    // Disable PLL and enable sleep
+    twr_system_pll_disable();
+
+    return status;
+}
+
+size_t twr_i2c_memory_batch(twr_i2c_channel_t channel, twr_i2c_batch_t *batch, size_t count)
+{
+    size_t done = 0;
+
+    if (_twr_i2c[channel].initialized_semaphore == 0)
     {
-        _twr_i2c_restore_bus(i2c);
+        return 0;
+    }
 
-        // Disable PLL and enable sleep
-        twr_system_pll_disable();
+    if (channel == TWR_I2C_I2C_1W)
+    {
+        return twr_ds28e17_memory_batch(&ds28e17, batch, count);
+    }
 
-        return false;
+    if (!_twr_i2c_async_wait(channel))
+    {
+        return 0;
+    }
+
+    // All transfers share one PLL enable window
+    twr_system_pll_enable();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        _twr_i2c_measure_begin(&_twr_i2c[channel].measure);
+
+        batch[i].success = _twr_i2c_memory_transfer(_twr_i2c[channel].i2c, &batch[i].transfer, batch[i].write);
+
+        _twr_i2c_measure_end(channel, &_twr_i2c[channel].measure, batch[i].transfer.length, batch[i].success);
+
+        done += batch[i].success ? 1 : 0;
     }
 
-    // Disable PLL and enable sleep
     twr_system_pll_disable();
 
+    return done;
+}
+
+bool twr_i2c_async_submit(twr_i2c_channel_t channel, twr_i2c_async_t *transaction)
+{
+    if (channel == TWR_I2C_I2C_1W || _twr_i2c[channel].initialized_semaphore == 0)
+    {
+        return false;
+    }
+
+    // Transfer size is limited by NBYTES field, reload chaining is not used
+    if (transaction->length > 255 || (transaction->type == TWR_I2C_ASYNC_MEMORY_READ && transaction->length == 0))
+    {
+        return false;
+    }
+
+    if (!_twr_i2c[channel].async_task_registered)
+    {
+        _twr_i2c[channel].async_task_id = twr_scheduler_register(_twr_i2c_async_task, (void *) channel, TWR_TICK_INFINITY);
+
+        _twr_i2c[channel].async_task_registered = true;
+    }
+
+    transaction->_next = NULL;
+
+    if (_twr_i2c[channel].async_head == NULL)
+    {
+        _twr_i2c[channel].async_head = transaction;
+    }
+    else
+    {
+        _twr_i2c[channel].async_tail->_next = transaction;
+    }
+
+    _twr_i2c[channel].async_tail = transaction;
+
+    if (_twr_i2c[channel].async_state == _TWR_I2C_ASYNC_STATE_IDLE)
+    {
+        _twr_i2c_async_start(channel);
+    }
+
     return true;
 }
 
+bool twr_i2c_async_is_busy(twr_i2c_channel_t channel)
+{
+    return _twr_i2c[channel].async_head != NULL;
+}
+
+#if TWR_I2C_STATS
+
+bool twr_i2c_get_stats(twr_i2c_channel_t channel, twr_i2c_stats_t *stats)
+{
+    if (channel > TWR_I2C_I2C1)
+    {
+        return false;
+    }
+
+    twr_irq_disable();
+
+    *stats = _twr_i2c[channel].stats;
+
+    twr_irq_enable();
+
+    return true;
+}
+
+void twr_i2c_stats_reset(twr_i2c_channel_t channel)
+{
+    twr_irq_disable();
+
+    memset(&_twr_i2c[channel].stats, 0, sizeof(_twr_i2c[channel].stats));
+
+    twr_irq_enable();
+}
+
+#endif
+
+void I2C1_IRQHandler(void)
+{
+    _twr_i2c_async_irq(TWR_I2C_I2C1);
+}
+
+void I2C2_IRQHandler(void)
+{
+    _twr_i2c_async_irq(TWR_I2C_I2C0);
+}
+
 bool twr_i2c_memory_write_8b(twr_i2c_channel_t channel, uint8_t device_address, uint32_t memory_address, uint8_t data)
 {
     twr_i2c_memory_transfer_t transfer;
@@ -434,6 +660,64 @@ bool twr_i2c_memory_write_16b(twr_i2c_channel_t channel, uint8_t device_address,
     return twr_i2c_memory_write(channel, &transfer);
 }
 
+bool twr_i2c_memory_write_8b_shadow(twr_i2c_channel_t channel, uint8_t device_address, uint8_t memory_address, uint8_t data, twr_i2c_shadow_t *shadow)
+{
+    uint8_t i;
+
+    for (i = 0; i < shadow->count; i++)
+    {
+        if (shadow->memory_address[i] == memory_address)
+        {
+            break;
+        }
+    }
+
+    if (i < shadow->count && shadow->value[i] == data)
+    {
+        return true;
+    }
+
+    if (!twr_i2c_memory_write_8b(channel, device_address, memory_address, data))
+    {
+        // Register content is unknown after failed write
+        if (i < shadow->count)
+        {
+            shadow->count--;
+
+            shadow->memory_address[i] = shadow->memory_address[shadow->count];
+            shadow->value[i] = shadow->value[shadow->count];
+        }
+
+        return false;
+    }
+
+    if (i == shadow->count)
+    {
+        if (shadow->count < TWR_I2C_SHADOW_SIZE)
+        {
+            shadow->count++;
+        }
+        else
+        {
+            // Replace entries in round-robin order when shadow is full
+            i = shadow->next;
+
+            shadow->next = (shadow->next + 1) % TWR_I2C_SHADOW_SIZE;
+        }
+    }
+
+    shadow->memory_address[i] = memory_address;
+    shadow->value[i] = data;
+
+    return true;
+}
+
+void twr_i2c_shadow_invalidate(twr_i2c_shadow_t *shadow)
+{
+    shadow->count = 0;
+    shadow->next = 0;
+}
+
 bool twr_i2c_memory_read_8b(twr_i2c_channel_t channel, uint8_t device_address, uint32_t memory_address, uint8_t *data)
 {
     twr_i2c_memory_transfer_t transfer;
@@ -467,6 +751,40 @@ bool twr_i2c_memory_read_16b(twr_i2c_channel_t channel, uint8_t device_address,
     return true;
 }
 
+static bool _twr_i2c_memory_transfer(I2C_TypeDef *i2c, const twr_i2c_memory_transfer_t *transfer, bool write)
+{
+    uint16_t transfer_memory_address_length =
+            (transfer->memory_address & TWR_I2C_MEMORY_ADDRESS_16_BIT) != 0 ? _TWR_I2C_MEMORY_ADDRESS_SIZE_16BIT : _TWR_I2C_MEMORY_ADDRESS_SIZE_8BIT;
+
+    if (write)
+    {
+        // If memory write failed ...
+        if (!_twr_i2c_mem_write(i2c, transfer->device_address << 1, transfer->memory_address, transfer_memory_address_length, transfer->buffer, transfer->length))
+        {
+            _twr_i2c_failure(_TWR_I2C_CHANNEL(i2c));
+
+            // Reset I2C peripheral to generate STOP conditions immediately
+            __TWR_I2C_RESET_PERIPHERAL(i2c);
+
+            return false;
+        }
+    }
+    else
+    {
+        // If error occurs during memory read ...
+        if (!_twr_i2c_mem_read(i2c, transfer->device_address << 1, transfer->memory_address, transfer_memory_address_length, transfer->buffer, transfer->length))
+        {
+            _twr_i2c_failure(_TWR_I2C_CHANNEL(i2c));
+
+            _twr_i2c_restore_bus(i2c);
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
 static bool _twr_i2c_mem_write(I2C_TypeDef *i2c, uint8_t device_address, uint16_t memory_address, uint16_t memory_address_length, uint8_t *buffer, uint16_t length)
 {
     // Get maximum allowed timeout in ms
@@ -631,6 +949,8 @@ static bool _twr_i2c_is_ack_failure(I2C_TypeDef *i2c)
 {
     if ((i2c->ISR & I2C_ISR_NACKF) != 0)
     {
+        _TWR_I2C_STATS_INC(_TWR_I2C_CHANNEL(i2c), nacks);
+
         // Wait until STOP flag is reset
         // AutoEnd should be initialized after AF
         while ((i2c->ISR & I2C_ISR_STOPF) == 0)
@@ -706,6 +1026,14 @@ static bool _twr_i2c_read(I2C_TypeDef *i2c, const void *buffer, size_t length)
 
 static uint32_t twr_i2c_get_timeout_ms(twr_i2c_channel_t channel, size_t length)
 {
+#if TWR_I2C_ADAPTIVE_TIMEOUT
+    // Observed byte time replaces the fixed margin once known
+    if (_twr_i2c[channel].byte_time_us != 0)
+    {
+        return (TWR_I2C_ADAPTIVE_TIMEOUT_FACTOR * _twr_i2c[channel].byte_time_us * (length + 3)) / 1000 + 2;
+    }
+#endif
+
     uint32_t timeout_us = twr_i2c_get_timeout_us(channel, length);
 
     return (timeout_us / 1000) + 10;
@@ -717,10 +1045,14 @@ static uint32_t twr_i2c_get_timeout_us(twr_i2c_channel_t channel, size_t length)
     {
         return _TWR_I2C_BYTE_TRANSFER_TIME_US_100 * (length + 3);
     }
-    else
+    else if (twr_i2c_get_speed(channel) == TWR_I2C_SPEED_400_KHZ)
     {
         return _TWR_I2C_BYTE_TRANSFER_TIME_US_400 * (length + 3);
     }
+    else
+    {
+        return _TWR_I2C_BYTE_TRANSFER_TIME_US_1000 * (length + 3);
+    }
 }
 
 static bool _twr_i2c_write(I2C_TypeDef *i2c, const void *buffer, size_t length)
@@ -772,6 +1104,8 @@ bool _twr_i2c_timeout_is_expired(void)
 
 static void _twr_i2c_restore_bus(I2C_TypeDef *i2c)
 {
+    _TWR_I2C_STATS_INC(_TWR_I2C_CHANNEL(i2c), restores);
+
     // TODO Take care of maximum rate on clk pin
 
     if (i2c == I2C2)
@@ -837,3 +1171,348 @@ static void _twr_i2c_restore_bus(I2C_TypeDef *i2c)
         GPIOB->BSRR = GPIO_BSRR_BR_11;
     }
 }
+
+static bool _twr_i2c_async_wait(twr_i2c_channel_t channel)
+{
+    if (_twr_i2c[channel].async_state != _TWR_I2C_ASYNC_STATE_RUNNING)
+    {
+        return true;
+    }
+
+    // Transaction in progress is finished by interrupt, its own timeout is handled by task
+    twr_tick_t tick_timeout = _twr_i2c[channel].async_tick_timeout;
+
+    while (_twr_i2c[channel].async_state == _TWR_I2C_ASYNC_STATE_RUNNING)
+    {
+        if (twr_tick_get() > tick_timeout)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void _twr_i2c_async_start(twr_i2c_channel_t channel)
+{
+    twr_i2c_async_t *transaction = _twr_i2c[channel].async_head;
+    I2C_TypeDef *i2c = _twr_i2c[channel].i2c;
+
+    if (transaction == NULL)
+    {
+        return;
+    }
+
+    twr_system_pll_enable();
+
+    _twr_i2c_measure_begin(&_twr_i2c[channel].async_measure);
+
+    _twr_i2c[channel].async_error = false;
+    _twr_i2c[channel].async_index = 0;
+    _twr_i2c[channel].async_address_index = 0;
+    _twr_i2c[channel].async_address_length = 0;
+
+    if (transaction->type == TWR_I2C_ASYNC_MEMORY_WRITE || transaction->type == TWR_I2C_ASYNC_MEMORY_READ)
+    {
+        if ((transaction->memory_address & TWR_I2C_MEMORY_ADDRESS_16_BIT) != 0)
+        {
+            _twr_i2c[channel].async_address[_twr_i2c[channel].async_address_length++] = transaction->memory_address >> 8;
+        }
+
+        _twr_i2c[channel].async_address[_twr_i2c[channel].async_address_length++] = transaction->memory_address;
+    }
+
+    uint32_t timeout_ms = _TWR_I2C_TX_TIMEOUT_ADJUST_FACTOR * twr_i2c_get_timeout_ms(channel, transaction->length + _twr_i2c[channel].async_address_length);
+
+    _twr_i2c[channel].async_tick_timeout = twr_tick_get() + timeout_ms;
+
+    twr_scheduler_plan_absolute(_twr_i2c[channel].async_task_id, _twr_i2c[channel].async_tick_timeout);
+
+    _twr_i2c[channel].async_state = _TWR_I2C_ASYNC_STATE_RUNNING;
+
+    i2c->ICR = I2C_ICR_NACKCF | I2C_ICR_STOPCF | I2C_ICR_BERRCF | I2C_ICR_ARLOCF | I2C_ICR_OVRCF;
+
+    i2c->CR1 |= _TWR_I2C_ASYNC_IRQ_MASK;
+
+    uint8_t device_address = transaction->device_address << 1;
+
+    switch (transaction->type)
+    {
+        case TWR_I2C_ASYNC_WRITE:
+        {
+            _twr_i2c_config(i2c, device_address, transaction->length, _TWR_I2C_AUTOEND_MODE, _TWR_I2C_GENERATE_START_WRITE);
+
+            break;
+        }
+        case TWR_I2C_ASYNC_READ:
+        {
+            _twr_i2c_config(i2c, device_address, transaction->length, _TWR_I2C_AUTOEND_MODE, I2C_CR2_START | I2C_CR2_RD_WRN);
+
+            break;
+        }
+        case TWR_I2C_ASYNC_MEMORY_WRITE:
+        {
+            // Memory address is followed by data after reload, or ends transfer if there are none
+            uint32_t mode = transaction->length != 0 ? _TWR_I2C_RELOAD_MODE : _TWR_I2C_AUTOEND_MODE;
+
+            _twr_i2c_config(i2c, device_address, _twr_i2c[channel].async_address_length, mode, _TWR_I2C_GENERATE_START_WRITE);
+
+            break;
+        }
+        case TWR_I2C_ASYNC_MEMORY_READ:
+        {
+            // Memory address is followed by repeated start on transfer complete
+            _twr_i2c_config(i2c, device_address, _twr_i2c[channel].async_address_length, _TWR_I2C_SOFTEND_MODE, _TWR_I2C_GENERATE_START_WRITE);
+
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+static void _twr_i2c_async_task(void *param)
+{
+    twr_i2c_channel_t channel = (twr_i2c_channel_t) param;
+
+    if (_twr_i2c[channel].async_state == _TWR_I2C_ASYNC_STATE_RUNNING)
+    {
+        if (twr_tick_get() < _twr_i2c[channel].async_tick_timeout)
+        {
+            twr_scheduler_plan_current_absolute(_twr_i2c[channel].async_tick_timeout);
+
+            return;
+        }
+
+        I2C_TypeDef *i2c = _twr_i2c[channel].i2c;
+
+        twr_irq_disable();
+
+        i2c->CR1 &= ~_TWR_I2C_ASYNC_IRQ_MASK;
+
+        bool running = _twr_i2c[channel].async_state == _TWR_I2C_ASYNC_STATE_RUNNING;
+
+        twr_irq_enable();
+
+        if (running)
+        {
+            _TWR_I2C_STATS_INC(channel, timeouts);
+
+            if (_twr_i2c[channel].async_head->type == TWR_I2C_ASYNC_READ || _twr_i2c[channel].async_head->type == TWR_I2C_ASYNC_MEMORY_READ)
+            {
+                _twr_i2c_restore_bus(i2c);
+            }
+            else
+            {
+                // Reset I2C peripheral to generate STOP conditions immediately
+                __TWR_I2C_RESET_PERIPHERAL(i2c);
+            }
+
+            _twr_i2c[channel].async_error = true;
+            _twr_i2c[channel].async_state = _TWR_I2C_ASYNC_STATE_DONE;
+        }
+    }
+
+    if (_twr_i2c[channel].async_state != _TWR_I2C_ASYNC_STATE_DONE)
+    {
+        return;
+    }
+
+    twr_i2c_async_t *transaction = _twr_i2c[channel].async_head;
+
+    _twr_i2c[channel].async_head = transaction->_next;
+
+    _twr_i2c[channel].async_state = _TWR_I2C_ASYNC_STATE_IDLE;
+
+    _twr_i2c_measure_end(channel, &_twr_i2c[channel].async_measure, transaction->length, !_twr_i2c[channel].async_error);
+
+    twr_system_pll_disable();
+
+    if (transaction->event_handler != NULL)
+    {
+        transaction->event_handler(channel, _twr_i2c[channel].async_error ? TWR_I2C_EVENT_ASYNC_ERROR : TWR_I2C_EVENT_ASYNC_DONE, transaction->event_param);
+    }
+
+    // Handler may have submitted a transaction which already started
+    if (_twr_i2c[channel].async_state == _TWR_I2C_ASYNC_STATE_IDLE)
+    {
+        _twr_i2c_async_start(channel);
+    }
+}
+
+static void _twr_i2c_async_irq(twr_i2c_channel_t channel)
+{
+    I2C_TypeDef *i2c = _twr_i2c[channel].i2c;
+    twr_i2c_async_t *transaction = _twr_i2c[channel].async_head;
+
+    if (_twr_i2c[channel].async_state != _TWR_I2C_ASYNC_STATE_RUNNING)
+    {
+        i2c->CR1 &= ~_TWR_I2C_ASYNC_IRQ_MASK;
+
+        return;
+    }
+
+    uint32_t isr = i2c->ISR;
+    uint8_t *buffer = transaction->buffer;
+
+    if ((isr & (I2C_ISR_BERR | I2C_ISR_ARLO | I2C_ISR_OVR)) != 0)
+    {
+        i2c->ICR = I2C_ICR_BERRCF | I2C_ICR_ARLOCF | I2C_ICR_OVRCF;
+
+        i2c->CR1 &= ~_TWR_I2C_ASYNC_IRQ_MASK;
+
+        // Reset I2C peripheral to generate STOP conditions immediately
+        __TWR_I2C_RESET_PERIPHERAL(i2c);
+
+        _twr_i2c[channel].async_error = true;
+        _twr_i2c[channel].async_state = _TWR_I2C_ASYNC_STATE_DONE;
+
+        twr_scheduler_signal(_twr_i2c[channel].async_task_id);
+
+        return;
+    }
+
+    if ((isr & I2C_ISR_NACKF) != 0)
+    {
+        // STOP condition is generated after NACK, transaction ends on STOPF
+        i2c->ICR = I2C_ICR_NACKCF;
+
+        _TWR_I2C_STATS_INC(channel, nacks);
+
+        _twr_i2c[channel].async_error = true;
+    }
+
+    if ((isr & I2C_ISR_TXIS) != 0)
+    {
+        if (_twr_i2c[channel].async_address_index < _twr_i2c[channel].async_address_length)
+        {
+            i2c->TXDR = _twr_i2c[channel].async_address[_twr_i2c[channel].async_address_index++];
+        }
+        else if (_twr_i2c[channel].async_index < transaction->length)
+        {
+            i2c->TXDR = buffer[_twr_i2c[channel].async_index++];
+        }
+        else
+        {
+            i2c->TXDR = 0;
+        }
+    }
+
+    if ((isr & I2C_ISR_RXNE) != 0)
+    {
+        uint8_t data = i2c->RXDR;
+
+        if (_twr_i2c[channel].async_index < transaction->length)
+        {
+            buffer[_twr_i2c[channel].async_index++] = data;
+        }
+    }
+
+    if ((isr & I2C_ISR_TCR) != 0)
+    {
+        // Memory address has been sent, continue with data in the same transfer
+        _twr_i2c_config(i2c, transaction->device_address << 1, transaction->length, _TWR_I2C_AUTOEND_MODE, _TWR_I2C_NO_STARTSTOP);
+    }
+
+    if ((isr & I2C_ISR_TC) != 0)
+    {
+        // Memory address has been sent, read data after repeated start
+        _twr_i2c_config(i2c, transaction->device_address << 1, transaction->length, _TWR_I2C_AUTOEND_MODE, I2C_CR2_START | I2C_CR2_RD_WRN);
+    }
+
+    if ((isr & I2C_ISR_STOPF) != 0)
+    {
+        i2c->ICR = I2C_ICR_STOPCF;
+
+        i2c->CR1 &= ~_TWR_I2C_ASYNC_IRQ_MASK;
+
+        // Clear Configuration Register 2
+        i2c->CR2 &= ~(I2C_CR2_SADD | I2C_CR2_HEAD10R | I2C_CR2_NBYTES | I2C_CR2_RELOAD | I2C_CR2_RD_WRN);
+
+        if (_twr_i2c[channel].async_index != transaction->length)
+        {
+            _twr_i2c[channel].async_error = true;
+        }
+
+        if (_twr_i2c[channel].async_error)
+        {
+            // Flush TX register if not empty
+            i2c->ISR |= I2C_ISR_TXE;
+        }
+
+        _twr_i2c[channel].async_state = _TWR_I2C_ASYNC_STATE_DONE;
+
+        twr_scheduler_signal(_twr_i2c[channel].async_task_id);
+    }
+}
+
+static void _twr_i2c_measure_begin(_twr_i2c_measure_t *measure)
+{
+#if TWR_I2C_STATS || TWR_I2C_ADAPTIVE_TIMEOUT
+    measure->tick = twr_tick_get();
+
+    twr_timer_start();
+
+    measure->microseconds = twr_timer_get_microseconds();
+#else
+    (void) measure;
+#endif
+}
+
+static void _twr_i2c_measure_end(twr_i2c_channel_t channel, _twr_i2c_measure_t *measure, size_t length, bool status)
+{
+#if TWR_I2C_STATS || TWR_I2C_ADAPTIVE_TIMEOUT
+    uint32_t duration = (uint16_t) (twr_timer_get_microseconds() - measure->microseconds);
+
+    twr_timer_stop();
+
+    twr_tick_t ticks = twr_tick_get() - measure->tick;
+
+    if (ticks >= _TWR_I2C_MEASURE_TIMER_LIMIT_MS)
+    {
+        duration = ticks * 1000;
+    }
+#endif
+
+#if TWR_I2C_STATS
+    _twr_i2c[channel].stats.transactions++;
+
+    _twr_i2c[channel].stats.busy_time_us += duration;
+#endif
+
+#if TWR_I2C_ADAPTIVE_TIMEOUT
+    if (status)
+    {
+        uint32_t byte_time_us = duration / (length + 3) + 1;
+
+        // Exponential moving average with weight 1/8 for the new sample
+        if (_twr_i2c[channel].byte_time_us == 0)
+        {
+            _twr_i2c[channel].byte_time_us = byte_time_us;
+        }
+        else
+        {
+            _twr_i2c[channel].byte_time_us = (_twr_i2c[channel].byte_time_us * 7 + byte_time_us) / 8;
+        }
+    }
+#else
+    (void) channel;
+    (void) measure;
+    (void) length;
+    (void) status;
+#endif
+}
+
+static void _twr_i2c_failure(twr_i2c_channel_t channel)
+{
+#if TWR_I2C_STATS
+    if (_twr_i2c_timeout_is_expired())
+    {
+        _twr_i2c[channel].stats.timeouts++;
+    }
+#else
+    (void) channel;
+#endif
+}
@@ -1,3 +1,5 @@
+#define TWR_LOG_MODULE TWR_LOG_MODULE_SYSTEM
+
 #include <twr_info.h>
 #include <twr_log.h>
 
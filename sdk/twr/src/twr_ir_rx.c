@@ -18,7 +18,7 @@ static struct
 {
     TIM_HandleTypeDef ir_timer;
     uint8_t counter;
-    uint32_t ir_rx_temp;
+    uint16_t lengths[32];
     uint32_t ir_rx_value;
 
     twr_scheduler_task_id_t task_id_notify;
@@ -26,9 +26,6 @@ static struct
     void (*event_handler)(twr_ir_rx_event_t, void *);
     void *event_param;
 
-    #ifdef _TWR_IR_RX_DEBUG
-    uint16_t lengths[40];
-    #endif
 } _twr_ir_rx;
 
 static void TIM6_handler(void *param);
@@ -43,6 +40,19 @@ static void _twr_ir_rx_task_notify(void *param)
 {
     (void) param;
 
+    // Bits are decoded from recorded lengths out of interrupt
+    uint32_t value = 0;
+
+    for (int i = 0; i < 32; i++)
+    {
+        if (_twr_ir_rx.lengths[i] > 1500)
+        {
+            value |= 1UL << i;
+        }
+    }
+
+    _twr_ir_rx.ir_rx_value = value;
+
     if (_twr_ir_rx.event_handler != NULL)
     {
         _twr_ir_rx.event_handler(TWR_IR_RX_NEC_FORMAT, _twr_ir_rx.event_param);
@@ -74,11 +84,6 @@ static void _twr_ir_rx_exti_int(twr_exti_line_t line, void *param)
     uint16_t act_len = __HAL_TIM_GET_COUNTER(&_twr_ir_rx.ir_timer);
     __HAL_TIM_SET_COUNTER(&_twr_ir_rx.ir_timer, 0);
 
-    // Array for debugging
-    #ifdef _TWR_IR_RX_DEBUG
-    _twr_ir_rx.lengths[_twr_ir_rx.counter] = act_len;
-    #endif
-
     // Check start pulse length
     if(_twr_ir_rx.counter == 1)
     {
@@ -91,15 +96,10 @@ static void _twr_ir_rx_exti_int(twr_exti_line_t line, void *param)
         }
     }
 
-    if(_twr_ir_rx.counter == 2)
-    {
-        _twr_ir_rx.ir_rx_temp = 0;
-    }
-
     // ignore first two items (first zero value and start pulse)
-    if(act_len > 1500 && _twr_ir_rx.counter >= 2)
+    if(_twr_ir_rx.counter >= 2)
     {
-        _twr_ir_rx.ir_rx_temp |= (1 << (_twr_ir_rx.counter-2));
+        _twr_ir_rx.lengths[_twr_ir_rx.counter - 2] = act_len;
     }
 
     // Received packet
@@ -113,7 +113,6 @@ static void _twr_ir_rx_exti_int(twr_exti_line_t line, void *param)
         #endif
 
         _twr_ir_rx.counter = 0;
-        _twr_ir_rx.ir_rx_value = _twr_ir_rx.ir_rx_temp;
 
         // The ir_rx_value should have inverted one addr and one command byte, but
         // the test of my IR remotes shows, that only the second CMD byte is inversion of the fist one
@@ -0,0 +1,408 @@
+#include <twr_kv.h>
+#include <twr_eeprom.h>
+#include <twr_crc.h>
+
+#define _TWR_KV_MAGIC 0x4b56
+#define _TWR_KV_CRC_POLYNOMIAL 0x1021
+#define _TWR_KV_CRC_INITIALIZATION 0xffff
+#define _TWR_KV_ALIGN(length) (((length) + 3) & ~3UL)
+
+#pragma pack(push, 1)
+
+typedef struct
+{
+    uint16_t magic;
+    uint16_t generation;
+    uint16_t crc;
+    uint16_t reserved;
+
+} _twr_kv_header_t;
+
+typedef struct
+{
+    uint16_t key;
+    uint8_t length;
+    uint8_t reserved;
+    uint16_t crc;
+
+} _twr_kv_record_t;
+
+#pragma pack(pop)
+
+typedef struct
+{
+    uint16_t key;
+    uint8_t length;
+    uint16_t offset;
+
+} _twr_kv_index_t;
+
+static struct
+{
+    uint32_t address;
+    size_t half_size;
+    int half;
+    uint16_t generation;
+    size_t end;
+
+    _twr_kv_index_t index[TWR_KV_KEYS_MAX];
+    int index_length;
+
+} _twr_kv;
+
+static bool _twr_kv_read_header(int half, uint16_t *generation);
+static bool _twr_kv_write_header(int half, uint16_t generation);
+static uint16_t _twr_kv_crc(uint16_t generation, const _twr_kv_record_t *record, const void *value);
+static void _twr_kv_scan(void);
+static bool _twr_kv_invalidate(int half, uint16_t generation);
+static bool _twr_kv_append(int half, size_t *end, uint16_t generation, uint16_t key, const void *buffer, size_t length);
+static int _twr_kv_find(uint16_t key);
+static void _twr_kv_index_update(uint16_t key, size_t length, size_t offset);
+
+bool twr_kv_init(uint32_t address, size_t size)
+{
+    memset(&_twr_kv, 0, sizeof(_twr_kv));
+
+    _twr_kv.address = address;
+    _twr_kv.half_size = (size / 2) & ~3UL;
+
+    if (_twr_kv.half_size < sizeof(_twr_kv_header_t) + _TWR_KV_ALIGN(sizeof(_twr_kv_record_t) + TWR_KV_VALUE_SIZE_MAX))
+    {
+        return false;
+    }
+
+    uint16_t generation[2];
+    bool valid[2];
+
+    valid[0] = _twr_kv_read_header(0, &generation[0]);
+    valid[1] = _twr_kv_read_header(1, &generation[1]);
+
+    if (!valid[0] && !valid[1])
+    {
+        _twr_kv.half = 0;
+        _twr_kv.generation = 1;
+        _twr_kv.end = sizeof(_twr_kv_header_t);
+
+        return _twr_kv_write_header(0, 1);
+    }
+
+    // Generation wraps around, half written later holds the higher one
+    if (!valid[0] || (valid[1] && ((int16_t) (generation[1] - generation[0]) > 0)))
+    {
+        _twr_kv.half = 1;
+    }
+
+    _twr_kv.generation = generation[_twr_kv.half];
+
+    _twr_kv_scan();
+
+    return true;
+}
+
+bool twr_kv_set(uint16_t key, const void *buffer, size_t length)
+{
+    if ((length == 0) || (length > TWR_KV_VALUE_SIZE_MAX))
+    {
+        return false;
+    }
+
+    int i = _twr_kv_find(key);
+
+    if (i >= 0)
+    {
+        uint8_t value[TWR_KV_VALUE_SIZE_MAX];
+
+        twr_eeprom_read(_twr_kv.address + _twr_kv.index[i].offset + sizeof(_twr_kv_record_t), value, _twr_kv.index[i].length);
+
+        // Unchanged value costs no write
+        if ((_twr_kv.index[i].length == length) && (memcmp(value, buffer, length) == 0))
+        {
+            return true;
+        }
+    }
+    else if (_twr_kv.index_length == TWR_KV_KEYS_MAX)
+    {
+        return false;
+    }
+
+    if ((_twr_kv.end + _TWR_KV_ALIGN(sizeof(_twr_kv_record_t) + length) > _twr_kv.half_size) && !twr_kv_compact())
+    {
+        return false;
+    }
+
+    size_t offset = _twr_kv.end;
+
+    if (!_twr_kv_append(_twr_kv.half, &_twr_kv.end, _twr_kv.generation, key, buffer, length))
+    {
+        return false;
+    }
+
+    _twr_kv_index_update(key, length, _twr_kv.half * _twr_kv.half_size + offset);
+
+    return true;
+}
+
+bool twr_kv_get(uint16_t key, void *buffer, size_t *length)
+{
+    int i = _twr_kv_find(key);
+
+    if ((i < 0) || (*length < _twr_kv.index[i].length))
+    {
+        return false;
+    }
+
+    *length = _twr_kv.index[i].length;
+
+    return twr_eeprom_read(_twr_kv.address + _twr_kv.index[i].offset + sizeof(_twr_kv_record_t), buffer, *length);
+}
+
+bool twr_kv_delete(uint16_t key)
+{
+    if (_twr_kv_find(key) < 0)
+    {
+        return true;
+    }
+
+    _twr_kv_index_update(key, 0, 0);
+
+    // Compaction drops deleted key on its own
+    if (_twr_kv.end + _TWR_KV_ALIGN(sizeof(_twr_kv_record_t)) > _twr_kv.half_size)
+    {
+        return twr_kv_compact();
+    }
+
+    // Record with empty value hides the previous ones
+    return _twr_kv_append(_twr_kv.half, &_twr_kv.end, _twr_kv.generation, key, NULL, 0);
+}
+
+bool twr_kv_compact(void)
+{
+    int half = 1 - _twr_kv.half;
+    uint16_t generation = _twr_kv.generation + 1;
+    size_t end = sizeof(_twr_kv_header_t);
+    uint8_t value[TWR_KV_VALUE_SIZE_MAX];
+    bool success = true;
+
+    if (!_twr_kv_invalidate(half, generation))
+    {
+        return false;
+    }
+
+    // Header of target half still holds lower generation, so active half stays valid until the end
+    for (int i = 0; success && (i < _twr_kv.index_length); i++)
+    {
+        twr_eeprom_read(_twr_kv.address + _twr_kv.index[i].offset + sizeof(_twr_kv_record_t), value, _twr_kv.index[i].length);
+
+        size_t offset = end;
+
+        success = _twr_kv_append(half, &end, generation, _twr_kv.index[i].key, value, _twr_kv.index[i].length);
+
+        _twr_kv.index[i].offset = half * _twr_kv.half_size + offset;
+    }
+
+    if (!success || !_twr_kv_write_header(half, generation))
+    {
+        // Index points to copies which are not valid yet
+        _twr_kv_scan();
+
+        return false;
+    }
+
+    _twr_kv.half = half;
+    _twr_kv.generation = generation;
+    _twr_kv.end = end;
+
+    return true;
+}
+
+size_t twr_kv_get_free(void)
+{
+    return _twr_kv.half_size - _twr_kv.end;
+}
+
+static bool _twr_kv_read_header(int half, uint16_t *generation)
+{
+    _twr_kv_header_t header;
+
+    if (!twr_eeprom_read(_twr_kv.address + half * _twr_kv.half_size, &header, sizeof(header)))
+    {
+        return false;
+    }
+
+    if ((header.magic != _TWR_KV_MAGIC) ||
+        (header.crc != twr_crc16(_TWR_KV_CRC_POLYNOMIAL, &header, 4, _TWR_KV_CRC_INITIALIZATION)))
+    {
+        return false;
+    }
+
+    *generation = header.generation;
+
+    return true;
+}
+
+static bool _twr_kv_write_header(int half, uint16_t generation)
+{
+    _twr_kv_header_t header;
+
+    header.magic = _TWR_KV_MAGIC;
+    header.generation = generation;
+    header.crc = twr_crc16(_TWR_KV_CRC_POLYNOMIAL, &header, 4, _TWR_KV_CRC_INITIALIZATION);
+    header.reserved = 0;
+
+    return twr_eeprom_write(_twr_kv.address + half * _twr_kv.half_size, &header, sizeof(header));
+}
+
+static uint16_t _twr_kv_crc(uint16_t generation, const _twr_kv_record_t *record, const void *value)
+{
+    // Generation in CRC rejects records left from previous use of half
+    uint16_t crc = twr_crc16(_TWR_KV_CRC_POLYNOMIAL, &generation, sizeof(generation), _TWR_KV_CRC_INITIALIZATION);
+
+    crc = twr_crc16(_TWR_KV_CRC_POLYNOMIAL, record, 4, crc);
+
+    return twr_crc16(_TWR_KV_CRC_POLYNOMIAL, value, record->length, crc);
+}
+
+static void _twr_kv_scan(void)
+{
+    uint32_t base = _twr_kv.half * _twr_kv.half_size;
+    uint8_t value[TWR_KV_VALUE_SIZE_MAX];
+    _twr_kv_record_t record;
+    size_t end = sizeof(_twr_kv_header_t);
+
+    _twr_kv.index_length = 0;
+
+    while (end + sizeof(record) <= _twr_kv.half_size)
+    {
+        twr_eeprom_read(_twr_kv.address + base + end, &record, sizeof(record));
+
+        if ((record.length > TWR_KV_VALUE_SIZE_MAX) || (end + _TWR_KV_ALIGN(sizeof(record) + record.length) > _twr_kv.half_size))
+        {
+            break;
+        }
+
+        twr_eeprom_read(_twr_kv.address + base + end + sizeof(record), value, record.length);
+
+        if (record.crc != _twr_kv_crc(_twr_kv.generation, &record, value))
+        {
+            break;
+        }
+
+        _twr_kv_index_update(record.key, record.length, base + end);
+
+        end += _TWR_KV_ALIGN(sizeof(record) + record.length);
+    }
+
+    _twr_kv.end = end;
+}
+
+static bool _twr_kv_invalidate(int half, uint16_t generation)
+{
+    uint32_t base = half * _twr_kv.half_size;
+    uint8_t value[TWR_KV_VALUE_SIZE_MAX];
+    _twr_kv_record_t record;
+
+    // Records left by interrupted compaction carry the same generation, they would extend the log past its end
+    for (size_t end = sizeof(_twr_kv_header_t); end + sizeof(record) <= _twr_kv.half_size; end += 4)
+    {
+        twr_eeprom_read(_twr_kv.address + base + end, &record, sizeof(record));
+
+        if ((record.length > TWR_KV_VALUE_SIZE_MAX) || (end + _TWR_KV_ALIGN(sizeof(record) + record.length) > _twr_kv.half_size))
+        {
+            continue;
+        }
+
+        twr_eeprom_read(_twr_kv.address + base + end + sizeof(record), value, record.length);
+
+        if (record.crc != _twr_kv_crc(generation, &record, value))
+        {
+            continue;
+        }
+
+        record.crc = ~record.crc;
+
+        if (!twr_eeprom_write(_twr_kv.address + base + end + offsetof(_twr_kv_record_t, crc), &record.crc, sizeof(record.crc)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool _twr_kv_append(int half, size_t *end, uint16_t generation, uint16_t key, const void *buffer, size_t length)
+{
+    uint32_t record_buffer[_TWR_KV_ALIGN(sizeof(_twr_kv_record_t) + TWR_KV_VALUE_SIZE_MAX) / 4];
+    _twr_kv_record_t *record = (_twr_kv_record_t *) record_buffer;
+    size_t size = _TWR_KV_ALIGN(sizeof(_twr_kv_record_t) + length);
+
+    if (*end + size > _twr_kv.half_size)
+    {
+        return false;
+    }
+
+    memset(record_buffer, 0, size);
+
+    record->key = key;
+    record->length = length;
+
+    if (length > 0)
+    {
+        memcpy(record + 1, buffer, length);
+    }
+
+    record->crc = _twr_kv_crc(generation, record, record + 1);
+
+    // Torn record fails CRC and ends the log on the next scan
+    if (!twr_eeprom_write(_twr_kv.address + half * _twr_kv.half_size + *end, record_buffer, size))
+    {
+        return false;
+    }
+
+    *end += size;
+
+    return true;
+}
+
+static int _twr_kv_find(uint16_t key)
+{
+    for (int i = 0; i < _twr_kv.index_length; i++)
+    {
+        if (_twr_kv.index[i].key == key)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+static void _twr_kv_index_update(uint16_t key, size_t length, size_t offset)
+{
+    int i = _twr_kv_find(key);
+
+    if (length == 0)
+    {
+        if (i >= 0)
+        {
+            _twr_kv.index[i] = _twr_kv.index[--_twr_kv.index_length];
+        }
+
+        return;
+    }
+
+    if (i < 0)
+    {
+        // Records of keys above limit are skipped
+        if (_twr_kv.index_length == TWR_KV_KEYS_MAX)
+        {
+            return;
+        }
+
+        i = _twr_kv.index_length++;
+
+        _twr_kv.index[i].key = key;
+    }
+
+    _twr_kv.index[i].length = length;
+    _twr_kv.index[i].offset = offset;
+}
@@ -0,0 +1,223 @@
+#include <twr_latency.h>
+
+#if TWR_LATENCY
+
+#include <twr_hrtick.h>
+#include <twr_irq.h>
+
+#define _TWR_LATENCY_POINT_SOURCE 0
+#define _TWR_LATENCY_POINT_HANDLER 1
+#define _TWR_LATENCY_POINT_TRANSMIT 2
+#define _TWR_LATENCY_POINT_CANCEL 3
+
+typedef struct
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint16_t bucket[TWR_LATENCY_BUCKETS];
+
+} _twr_latency_histogram_t;
+
+typedef struct
+{
+    // Point of the last stamp of event in flight, -1 when none
+    int8_t point;
+    uint32_t source;
+    uint32_t handler;
+    _twr_latency_histogram_t histogram[TWR_LATENCY_STAGE_COUNT];
+
+} _twr_latency_probe_t;
+
+static struct
+{
+    _twr_latency_probe_t probe[TWR_LATENCY_PROBE_COUNT];
+
+} _twr_latency;
+
+static void _twr_latency_add(_twr_latency_histogram_t *histogram, uint32_t duration);
+static int _twr_latency_bucket(uint32_t duration);
+static uint32_t _twr_latency_bucket_upper(int bucket);
+
+bool twr_latency_init(void)
+{
+    memset(&_twr_latency, 0, sizeof(_twr_latency));
+
+    for (int i = 0; i < TWR_LATENCY_PROBE_COUNT; i++)
+    {
+        _twr_latency.probe[i].point = -1;
+
+        twr_latency_reset(i);
+    }
+
+    return twr_hrtick_init();
+}
+
+void twr_latency_stamp(twr_latency_probe_t probe, int point)
+{
+    if (!twr_hrtick_is_running())
+    {
+        return;
+    }
+
+    uint32_t now = twr_hrtick_get_32();
+
+    uint32_t primask = twr_irq_save();
+
+    _twr_latency_probe_t *self = &_twr_latency.probe[probe];
+
+    if (point == _TWR_LATENCY_POINT_SOURCE)
+    {
+        // Bounces do not restart event, source which has not reached handler is replaced by later one
+        if (self->point != _TWR_LATENCY_POINT_SOURCE || (now - self->source) >= TWR_LATENCY_BOUNCE)
+        {
+            self->source = now;
+            self->point = _TWR_LATENCY_POINT_SOURCE;
+        }
+    }
+    else if (point == _TWR_LATENCY_POINT_HANDLER)
+    {
+        if (self->point == _TWR_LATENCY_POINT_SOURCE)
+        {
+            _twr_latency_add(&self->histogram[TWR_LATENCY_STAGE_HANDLER], now - self->source);
+
+            self->handler = now;
+            self->point = _TWR_LATENCY_POINT_HANDLER;
+        }
+    }
+    else if (point == _TWR_LATENCY_POINT_CANCEL)
+    {
+        self->point = -1;
+    }
+    else if (self->point == _TWR_LATENCY_POINT_HANDLER)
+    {
+        _twr_latency_add(&self->histogram[TWR_LATENCY_STAGE_TRANSMIT], now - self->handler);
+        _twr_latency_add(&self->histogram[TWR_LATENCY_STAGE_TOTAL], now - self->source);
+
+        self->point = -1;
+    }
+
+    twr_irq_restore(primask);
+}
+
+bool twr_latency_get_stats(twr_latency_probe_t probe, twr_latency_stage_t stage, twr_latency_stats_t *stats)
+{
+    _twr_latency_histogram_t histogram;
+
+    uint32_t primask = twr_irq_save();
+
+    histogram = _twr_latency.probe[probe].histogram[stage];
+
+    twr_irq_restore(primask);
+
+    memset(stats, 0, sizeof(*stats));
+
+    if (histogram.count == 0)
+    {
+        return false;
+    }
+
+    stats->count = histogram.count;
+    stats->min = histogram.min;
+    stats->avg = (uint32_t) (histogram.sum / histogram.count);
+    stats->max = histogram.max;
+
+    // The smallest bucket below which at most 1 % of events remain
+    uint32_t rest = histogram.count / 100;
+    uint32_t above = histogram.count;
+
+    for (int i = 0; i < TWR_LATENCY_BUCKETS; i++)
+    {
+        above -= histogram.bucket[i];
+
+        if (above <= rest)
+        {
+            stats->p99 = _twr_latency_bucket_upper(i);
+
+            break;
+        }
+    }
+
+    // Bucket bound is never reported beyond the measured maximum
+    if (stats->p99 > stats->max)
+    {
+        stats->p99 = stats->max;
+    }
+
+    return true;
+}
+
+void twr_latency_reset(twr_latency_probe_t probe)
+{
+    uint32_t primask = twr_irq_save();
+
+    for (int i = 0; i < TWR_LATENCY_STAGE_COUNT; i++)
+    {
+        _twr_latency_histogram_t *histogram = &_twr_latency.probe[probe].histogram[i];
+
+        memset(histogram, 0, sizeof(*histogram));
+
+        histogram->min = UINT32_MAX;
+    }
+
+    twr_irq_restore(primask);
+}
+
+static void _twr_latency_add(_twr_latency_histogram_t *histogram, uint32_t duration)
+{
+    histogram->count++;
+    histogram->sum += duration;
+
+    if (duration < histogram->min)
+    {
+        histogram->min = duration;
+    }
+
+    if (duration > histogram->max)
+    {
+        histogram->max = duration;
+    }
+
+    int bucket = _twr_latency_bucket(duration);
+
+    // Bucket saturates, statistics stay consistent with count only until then
+    if (histogram->bucket[bucket] != UINT16_MAX)
+    {
+        histogram->bucket[bucket]++;
+    }
+}
+
+static int _twr_latency_bucket(uint32_t duration)
+{
+    if (duration < 2)
+    {
+        return duration;
+    }
+
+    int octave = 31 - __builtin_clz(duration);
+
+    // Half of octave is given by the bit below the leading one
+    int bucket = 2 * octave + ((duration >> (octave - 1)) & 1);
+
+    return bucket < TWR_LATENCY_BUCKETS ? bucket : TWR_LATENCY_BUCKETS - 1;
+}
+
+static uint32_t _twr_latency_bucket_upper(int bucket)
+{
+    if (bucket < 2)
+    {
+        return bucket;
+    }
+
+    if (bucket == TWR_LATENCY_BUCKETS - 1)
+    {
+        return UINT32_MAX;
+    }
+
+    int octave = bucket / 2;
+
+    return ((2U + (bucket & 1)) << (octave - 1)) + (1U << (octave - 1)) - 1;
+}
+
+#endif
@@ -1,7 +1,16 @@
 #include <twr_led.h>
+#include <twr_hrtick.h>
+#include <stm32l0xx.h>
 
 #define _TWR_LED_DEFAULT_SLOT_INTERVAL 100
 
+// LPTIM1 clocked from LSE divided by 128
+#define _TWR_LED_LPTIM_FREQUENCY (LSE_VALUE / 128)
+
+static bool _twr_led_hardware_start(twr_led_t *self);
+
+static void _twr_led_hardware_stop(twr_led_t *self);
+
 static void _twr_led_gpio_init(twr_led_t *self)
 {
     twr_gpio_init(self->_channel.gpio);
@@ -40,17 +49,51 @@ static void _twr_led_task(void *param)
         return;
     }
 
+    if (self->_hardware_active)
+    {
+        _twr_led_hardware_stop(self);
+
+        if ((self->_count > 0) && (twr_scheduler_get_spin_tick() >= self->_tick_hardware_end))
+        {
+            // LED is left in state of the last slot as by software processing
+            if ((self->_pattern & (0x80000000 >> ((self->_count - 1) % 32))) != 0)
+            {
+                self->_driver->on(self);
+            }
+
+            self->_pattern = 0;
+            self->_selector = 0;
+            self->_count = 0;
+
+            return;
+        }
+    }
+
     if (self->_pattern == 0 || self->_pattern == 0xffffffff)
     {
         return;
     }
 
+    if (self->_hardware && (self->_selector == 0) && _twr_led_hardware_start(self))
+    {
+        if (self->_count > 0)
+        {
+            self->_tick_hardware_end = twr_scheduler_get_spin_tick() + self->_count * self->_slot_interval;
+
+            twr_scheduler_plan_current_absolute(self->_tick_hardware_end);
+        }
+
+        return;
+    }
+
     if (self->_selector == 0)
     {
         self->_selector = 0x80000000;
     }
 
-    if ((self->_pattern & self->_selector) != 0)
+    bool on = (self->_pattern & self->_selector) != 0;
+
+    if (on)
     {
         self->_driver->on(self);
     }
@@ -59,17 +102,28 @@ static void _twr_led_task(void *param)
         self->_driver->off(self);
     }
 
-    self->_selector >>= 1;
+    // Slots with the same state as the current one are skipped, task wakes up only on change
+    int slots = 0;
 
-    if (self->_count != 0)
+    do
     {
-        if (--self->_count == 0)
+        self->_selector = self->_selector == 1 ? 0x80000000 : self->_selector >> 1;
+
+        slots++;
+    }
+    while ((slots < 32) && (((self->_pattern & self->_selector) != 0) == on) && ((self->_count <= 0) || (slots < self->_count)));
+
+    if (self->_count > 0)
+    {
+        self->_count -= slots;
+
+        if (self->_count == 0)
         {
             self->_pattern = 0;
         }
     }
 
-    twr_scheduler_plan_current_relative(self->_slot_interval);
+    twr_scheduler_plan_current_relative(slots * self->_slot_interval);
 }
 
 void twr_led_init(twr_led_t *self, twr_gpio_channel_t gpio_channel, bool open_drain_output, int idle_state)
@@ -126,6 +180,11 @@ void twr_led_set_mode(twr_led_t *self, twr_led_mode_t mode)
 {
     uint32_t pattern = self->_pattern;
 
+    if (self->_hardware_active && (mode == TWR_LED_MODE_OFF || mode == TWR_LED_MODE_ON))
+    {
+        _twr_led_hardware_stop(self);
+    }
+
     switch (mode)
     {
         case TWR_LED_MODE_TOGGLE:
@@ -238,6 +297,11 @@ void twr_led_blink(twr_led_t *self, int count)
 
 void twr_led_pulse(twr_led_t *self, twr_tick_t duration)
 {
+    if (self->_hardware_active)
+    {
+        _twr_led_hardware_stop(self);
+    }
+
     if (!self->_pulse_active)
     {
         self->_driver->on(self);
@@ -252,3 +316,120 @@ bool twr_led_is_pulse(twr_led_t *self)
 {
     return self->_pulse_active;
 }
+
+bool twr_led_set_hardware(twr_led_t *self, bool enable)
+{
+    if ((self->_driver != &_twr_led_driver_gpio) || (self->_channel.gpio != TWR_GPIO_P9))
+    {
+        return false;
+    }
+
+    if (!enable && self->_hardware_active)
+    {
+        _twr_led_hardware_stop(self);
+    }
+
+    self->_hardware = enable;
+
+    // Running pattern is restarted by the new backend
+    if (!self->_pulse_active)
+    {
+        self->_selector = 0;
+
+        twr_scheduler_plan_now(self->_task_id);
+    }
+
+    return true;
+}
+
+static bool _twr_led_hardware_start(twr_led_t *self)
+{
+    uint32_t pattern = self->_pattern;
+    int period = 1;
+
+    // Find the shortest period of pattern
+    while ((period < 32) && (((pattern >> period) | (pattern << (32 - period))) != pattern))
+    {
+        period <<= 1;
+    }
+
+    uint32_t slots = period == 32 ? pattern : pattern >> (32 - period);
+    int active = 0;
+
+    while ((active < period) && ((slots & (1UL << (period - 1 - active))) != 0))
+    {
+        active++;
+    }
+
+    // Only active slots followed by inactive ones can be generated by PWM
+    if ((active == 0) || (active == period) || ((slots & ((1UL << (period - active)) - 1)) != 0))
+    {
+        return false;
+    }
+
+    // LPTIM1 is taken by high-resolution clock
+    if (twr_hrtick_is_running())
+    {
+        return false;
+    }
+
+    uint32_t counts_period = period * self->_slot_interval * _TWR_LED_LPTIM_FREQUENCY / 1000;
+    uint32_t counts_active = active * self->_slot_interval * _TWR_LED_LPTIM_FREQUENCY / 1000;
+
+    if ((counts_active == 0) || (counts_active >= counts_period) || (counts_period > 0x10000))
+    {
+        return false;
+    }
+
+    RCC->APB1ENR |= RCC_APB1ENR_LPTIM1EN;
+
+    // Errata workaround
+    RCC->APB1ENR;
+
+    // LSE as clock source
+    RCC->CCIPR |= RCC_CCIPR_LPTIM1SEL;
+
+    LPTIM1->CR = 0;
+
+    // Output is low until compare match, inverted polarity makes active slots first
+    LPTIM1->CFGR = LPTIM_CFGR_PRESC | (self->_idle_state ? 0 : LPTIM_CFGR_WAVPOL);
+
+    LPTIM1->CR = LPTIM_CR_ENABLE;
+
+    LPTIM1->ICR = LPTIM_ICR_ARROKCF | LPTIM_ICR_CMPOKCF;
+
+    LPTIM1->ARR = counts_period - 1;
+
+    while ((LPTIM1->ISR & LPTIM_ISR_ARROK) == 0)
+    {
+        continue;
+    }
+
+    LPTIM1->CMP = counts_active - 1;
+
+    while ((LPTIM1->ISR & LPTIM_ISR_CMPOK) == 0)
+    {
+        continue;
+    }
+
+    LPTIM1->CR |= LPTIM_CR_CNTSTRT;
+
+    twr_gpio_set_mode(self->_channel.gpio, TWR_GPIO_MODE_ALTERNATE_2);
+
+    self->_hardware_active = true;
+
+    return true;
+}
+
+static void _twr_led_hardware_stop(twr_led_t *self)
+{
+    self->_driver->off(self);
+
+    twr_gpio_set_mode(self->_channel.gpio, self->_open_drain_output ? TWR_GPIO_MODE_OUTPUT_OD : TWR_GPIO_MODE_OUTPUT);
+
+    LPTIM1->CR = 0;
+
+    RCC->APB1ENR &= ~RCC_APB1ENR_LPTIM1EN;
+
+    self->_hardware_active = false;
+}
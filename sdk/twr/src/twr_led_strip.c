@@ -3,8 +3,30 @@
 #define TWR_LED_STRIP_NULL_TASK TWR_SCHEDULER_MAX_TASKS + 1
 
 static uint32_t _twr_led_strip_wheel(int position);
+static void _twr_led_strip_update_lut(twr_led_strip_t *self);
+static uint32_t _twr_led_strip_mix(uint32_t from, uint32_t to, uint32_t position);
 static void _twr_led_strip_get_heat_map_color(float value, float *red, float *green, float *blue);
 
+const uint8_t twr_led_strip_gamma_2_2[256] =
+{
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,
+      3,   3,   3,   3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   6,   6,   6,
+      6,   7,   7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  11,  11,  11,  12,
+     12,  13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,
+     20,  20,  21,  22,  22,  23,  23,  24,  25,  25,  26,  26,  27,  28,  28,  29,
+     30,  30,  31,  32,  33,  33,  34,  35,  35,  36,  37,  38,  39,  39,  40,  41,
+     42,  43,  43,  44,  45,  46,  47,  48,  49,  49,  50,  51,  52,  53,  54,  55,
+     56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,
+     73,  74,  75,  76,  77,  78,  79,  81,  82,  83,  84,  85,  87,  88,  89,  90,
+     91,  93,  94,  95,  97,  98,  99, 100, 102, 103, 105, 106, 107, 109, 110, 111,
+    113, 114, 116, 117, 119, 120, 121, 123, 124, 126, 127, 129, 130, 132, 133, 135,
+    137, 138, 140, 141, 143, 145, 146, 148, 149, 151, 153, 154, 156, 158, 159, 161,
+    163, 165, 166, 168, 170, 172, 173, 175, 177, 179, 181, 182, 184, 186, 188, 190,
+    192, 194, 196, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221,
+    223, 225, 227, 229, 231, 234, 236, 238, 240, 242, 244, 246, 248, 251, 253, 255
+};
+
 void twr_led_strip_init(twr_led_strip_t *self, const twr_led_strip_driver_t *driver, const twr_led_strip_buffer_t *buffer)
 {
     memset(self, 0x00, sizeof(twr_led_strip_t));
@@ -38,7 +60,7 @@ void twr_led_strip_set_pixel(twr_led_strip_t *self, int position, uint32_t color
         return;
     }
 
-    if (self->_brightness != 255)
+    if (self->_lut_active && self->_driver->set_lut == NULL)
     {
         twr_led_strip_set_pixel_rgbw(self, position, color >> 24, color >> 16, color >> 8, color);
     }
@@ -55,13 +77,15 @@ void twr_led_strip_set_pixel_rgbw(twr_led_strip_t *self, int position, uint8_t r
         return;
     }
 
-    if (self->_brightness != 255)
+    // Driver without lookup table support gets already corrected values
+    if (self->_lut_active && self->_driver->set_lut == NULL)
     {
-        r = ((uint16_t) r * self->_brightness) >> 8;
-        g = ((uint16_t) g * self->_brightness) >> 8;
-        b = ((uint16_t) b * self->_brightness) >> 8;
-        w = ((uint16_t) w * self->_brightness) >> 8;
+        r = self->_lut[r];
+        g = self->_lut[g];
+        b = self->_lut[b];
+        w = self->_lut[w];
     }
+
     self->_driver->set_pixel_rgbw(position, r, g, b, w);
 }
 
@@ -113,6 +137,15 @@ bool twr_led_strip_is_ready(twr_led_strip_t *self)
 void twr_led_strip_set_brightness(twr_led_strip_t *self, uint8_t brightness)
 {
     self->_brightness = brightness;
+
+    _twr_led_strip_update_lut(self);
+}
+
+void twr_led_strip_set_gamma(twr_led_strip_t *self, const uint8_t *gamma)
+{
+    self->_gamma = gamma;
+
+    _twr_led_strip_update_lut(self);
 }
 
 void twr_led_strip_effect_stop(twr_led_strip_t *self)
@@ -558,6 +591,143 @@ void twr_led_strip_effect_pulse_color(twr_led_strip_t *self, uint32_t color, twr
     self->_effect.task_id = twr_scheduler_register(_twr_led_strip_effect_pulse_color_task, self, 0);
 }
 
+static void _twr_led_strip_effect_keyframes_task(void *param)
+{
+    twr_led_strip_t *self = (twr_led_strip_t *)param;
+
+    if (!self->_driver->is_ready())
+    {
+        twr_scheduler_plan_current_now();
+
+        return;
+    }
+
+    const twr_led_strip_keyframe_t *keyframes = self->_keyframes.keyframes;
+
+    twr_tick_t now = twr_tick_get();
+
+    bool done = false;
+
+    // Whole laps are skipped at once, the start of segment stays aligned
+    if (self->_keyframes.loop && now - self->_keyframes.start >= self->_keyframes.total)
+    {
+        self->_keyframes.start += (now - self->_keyframes.start) / self->_keyframes.total * self->_keyframes.total;
+    }
+
+    // Time based position, frames delayed by busy strip do not slow down the animation
+    for (int i = 0; i <= self->_keyframes.count; i++)
+    {
+        twr_tick_t duration = keyframes[self->_keyframes.index].duration;
+
+        if (now - self->_keyframes.start < duration)
+        {
+            break;
+        }
+
+        self->_keyframes.start += duration;
+
+        if (++self->_keyframes.index == self->_keyframes.count)
+        {
+            if (!self->_keyframes.loop)
+            {
+                self->_keyframes.index--;
+
+                done = true;
+
+                break;
+            }
+
+            self->_keyframes.index = 0;
+        }
+    }
+
+    const twr_led_strip_keyframe_t *to = &keyframes[self->_keyframes.index];
+    const twr_led_strip_keyframe_t *from = &keyframes[self->_keyframes.index == 0 ? self->_keyframes.count - 1 : self->_keyframes.index - 1];
+
+    uint32_t position = 256;
+
+    if (!done && now - self->_keyframes.start < to->duration)
+    {
+        position = (now - self->_keyframes.start) * 256 / to->duration;
+    }
+
+    uint32_t color_first = _twr_led_strip_mix(from->color_first, to->color_first, position);
+    uint32_t color_last = _twr_led_strip_mix(from->color_last, to->color_last, position);
+
+    // Frame equal to the previous one is neither encoded nor sent
+    if (!self->_keyframes.rendered || color_first != self->_keyframes.color_first || color_last != self->_keyframes.color_last)
+    {
+        int divisor = self->_keyframes.length > 1 ? self->_keyframes.length - 1 : 1;
+
+        for (int i = 0; i < self->_keyframes.length; i++)
+        {
+            twr_led_strip_set_pixel(self, self->_keyframes.first + i, _twr_led_strip_mix(color_first, color_last, i * 256 / divisor));
+        }
+
+        self->_driver->write();
+
+        self->_keyframes.rendered = true;
+        self->_keyframes.color_first = color_first;
+        self->_keyframes.color_last = color_last;
+    }
+
+    if (done)
+    {
+        _twr_led_strip_effect_done(self);
+
+        return;
+    }
+
+    twr_tick_t end = self->_keyframes.start + to->duration;
+
+    if (from->color_first == to->color_first && from->color_last == to->color_last)
+    {
+        twr_scheduler_plan_current_absolute(end);
+    }
+    else
+    {
+        twr_tick_t next = now + self->_keyframes.frame_interval;
+
+        twr_scheduler_plan_current_absolute(next < end ? next : end);
+    }
+}
+
+void twr_led_strip_effect_keyframes(twr_led_strip_t *self, const twr_led_strip_keyframe_t *keyframes, int count, int first, int length, twr_tick_t frame_interval, bool loop)
+{
+    twr_led_strip_effect_stop(self);
+
+    if (count < 1)
+    {
+        return;
+    }
+
+    self->_keyframes.total = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        self->_keyframes.total += keyframes[i].duration;
+    }
+
+    self->_keyframes.keyframes = keyframes;
+    self->_keyframes.count = count;
+    self->_keyframes.first = first;
+    self->_keyframes.length = length;
+    self->_keyframes.frame_interval = frame_interval;
+    self->_keyframes.loop = loop && self->_keyframes.total != 0;
+    self->_keyframes.rendered = false;
+
+    // Animation starts showing the first keyframe
+    self->_keyframes.index = count > 1 ? 1 : 0;
+    self->_keyframes.start = twr_tick_get();
+
+    if (count == 1)
+    {
+        self->_keyframes.start -= keyframes[0].duration;
+    }
+
+    self->_effect.task_id = twr_scheduler_register(_twr_led_strip_effect_keyframes_task, self, 0);
+}
+
 void twr_led_strip_thermometer(twr_led_strip_t *self, float temperature, float min, float max, uint8_t white_dots, float set_point, uint32_t color)
 {
     temperature -= min;
@@ -582,7 +752,7 @@ void twr_led_strip_thermometer(twr_led_strip_t *self, float temperature, float m
     {
         _twr_led_strip_get_heat_map_color((float)i / self->_buffer->count, &red, &green, &blue);
 
-        self->_driver->set_pixel_rgbw(i, self->_brightness * red, self->_brightness * green, self->_brightness * blue, 0);
+        twr_led_strip_set_pixel_rgbw(self, i, 255 * red, 255 * green, 255 * blue, 0);
     }
 
     if (self->_buffer->type == TWR_LED_STRIP_TYPE_RGBW)
@@ -658,3 +828,38 @@ static void _twr_led_strip_get_heat_map_color(float value, float *red, float *gr
     *green = (color[idx2][1] - color[idx1][1]) * fractBetween + color[idx1][1];
     *blue  = (color[idx2][2] - color[idx1][2]) * fractBetween + color[idx1][2];
 }
+
+static void _twr_led_strip_update_lut(twr_led_strip_t *self)
+{
+    self->_lut_active = self->_brightness != 255 || self->_gamma != NULL;
+
+    if (self->_lut_active)
+    {
+        for (int i = 0; i < 256; i++)
+        {
+            uint8_t value = self->_gamma != NULL ? self->_gamma[i] : i;
+
+            self->_lut[i] = ((uint16_t) value * (self->_brightness + 1)) >> 8;
+        }
+    }
+
+    if (self->_driver->set_lut != NULL)
+    {
+        self->_driver->set_lut(self->_lut_active ? self->_lut : NULL);
+    }
+}
+
+static uint32_t _twr_led_strip_mix(uint32_t from, uint32_t to, uint32_t position)
+{
+    uint32_t color = 0;
+
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        int a = (from >> shift) & 0xff;
+        int b = (to >> shift) & 0xff;
+
+        color |= (uint32_t) (a + (b - a) * (int) position / 256) << shift;
+    }
+
+    return color;
+}
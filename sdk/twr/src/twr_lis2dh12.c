@@ -1,14 +1,22 @@
 #include <twr_lis2dh12.h>
 #include <twr_scheduler.h>
 #include <twr_exti.h>
+#include <twr_trace.h>
 #include <stm32l0xx.h>
 
 #define _TWR_LIS2DH12_DELAY_RUN 10
 #define _TWR_LIS2DH12_DELAY_READ 10
 #define _TWR_LIS2DH12_AUTOINCREMENT_ADR 0x80
+#define _TWR_LIS2DH12_ORIENTATION_THRESHOLD 0.6f
+#define _TWR_LIS2DH12_ORIENTATION_DURATION 2
+#define _TWR_LIS2DH12_ORIENTATION_RETRY 100
+#define _TWR_LIS2DH12_FIFO_RETRY 10
 
 static void _twr_lis2dh12_task_interval(void *param);
 static void _twr_lis2dh12_task_measure(void *param);
+static void _twr_lis2dh12_task_orientation(void *param);
+static void _twr_lis2dh12_task_fifo(void *param);
+static bool _twr_lis2dh12_interrupt_config(twr_lis2dh12_t *self);
 static bool _twr_lis2dh12_power_down(twr_lis2dh12_t *self);
 static bool _twr_lis2dh12_continuous_conversion(twr_lis2dh12_t *self);
 static bool _twr_lis2dh12_read_result(twr_lis2dh12_t *self);
@@ -22,6 +30,15 @@ static const float _twr_lis2dh12_fs_lut[] =
         [TWR_LIS2DH12_SCALE_16G] = (12/1000.f)
 };
 
+// Raw values are left aligned, results are shifted by 4 bits before applying sensitivity
+static const int16_t _twr_lis2dh12_one_g_lut[] =
+{
+        [TWR_LIS2DH12_SCALE_2G] = 16000,
+        [TWR_LIS2DH12_SCALE_4G] = 8000,
+        [TWR_LIS2DH12_SCALE_8G] = 4000,
+        [TWR_LIS2DH12_SCALE_16G] = 1333
+};
+
 static const float _twr_lis2dh12_ths_lut[] =
 {
         [TWR_LIS2DH12_SCALE_2G] = (0.016f),
@@ -30,6 +47,17 @@ static const float _twr_lis2dh12_ths_lut[] =
         [TWR_LIS2DH12_SCALE_16G] = (0.186f)
 };
 
+// INT2_SRC position bits XL, XH, YL, YH, ZL, ZH mapped to faces with the same vectors as used by twr_dice
+static const twr_dice_face_t _twr_lis2dh12_6d_face_lut[] =
+{
+        TWR_DICE_FACE_5,
+        TWR_DICE_FACE_2,
+        TWR_DICE_FACE_4,
+        TWR_DICE_FACE_3,
+        TWR_DICE_FACE_6,
+        TWR_DICE_FACE_1
+};
+
 bool twr_lis2dh12_init(twr_lis2dh12_t *self, twr_i2c_channel_t i2c_channel, uint8_t i2c_address)
 {
     memset(self, 0, sizeof(*self));
@@ -78,7 +106,8 @@ void twr_lis2dh12_set_update_interval(twr_lis2dh12_t *self, twr_tick_t interval)
 
 bool twr_lis2dh12_measure(twr_lis2dh12_t *self)
 {
-    if (self->_measurement_active)
+    // Output registers are the FIFO output in stream mode
+    if (self->_measurement_active || self->_fifo_active)
     {
         return false;
     }
@@ -115,6 +144,11 @@ bool twr_lis2dh12_get_result_g(twr_lis2dh12_t *self, twr_lis2dh12_result_g_t *re
     return true;
 }
 
+int16_t twr_lis2dh12_get_raw_one_g(twr_lis2dh12_t *self)
+{
+    return _twr_lis2dh12_one_g_lut[self->_scale];
+}
+
 static void _twr_lis2dh12_task_interval(void *param)
 {
     twr_lis2dh12_t *self = param;
@@ -130,12 +164,17 @@ static void _twr_lis2dh12_task_measure(void *param)
 
     while (true)
     {
+        twr_trace_state(TWR_TRACE_DRIVER_LIS2DH12, self->_state);
+
         switch (self->_state)
         {
             case TWR_LIS2DH12_STATE_ERROR:
             {
                 self->_accelerometer_valid = false;
 
+                // Device may have been reset, configuration is rewritten on initialization
+                twr_i2c_shadow_invalidate(&self->_shadow);
+
                 self->_measurement_active = false;
 
                 if (self->_event_handler != NULL)
@@ -165,7 +204,7 @@ static void _twr_lis2dh12_task_measure(void *param)
 
                 uint8_t cfg_reg4 = 0x80 | ((uint8_t) self->_scale << 4) | (((uint8_t) self->_resolution & 0x01) << 3);
 
-                if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x23, cfg_reg4))
+                if (!twr_i2c_memory_write_8b_shadow(self->_i2c_channel, self->_i2c_address, 0x23, cfg_reg4, &self->_shadow))
                 {
                     continue;
                 }
@@ -271,7 +310,16 @@ static void _twr_lis2dh12_task_measure(void *param)
 
 static bool _twr_lis2dh12_power_down(twr_lis2dh12_t *self)
 {
-    if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x20, 0x07))
+    // Orientation detection needs conversions running, ODR = 0x2 => 10Hz in low-power mode
+    uint8_t cfg_reg1 = self->_orientation_active ? 0x2f : 0x07;
+
+    // FIFO stream mode keeps converting at its own rate
+    if (self->_fifo_active)
+    {
+        cfg_reg1 = ((uint8_t) self->_fifo.odr << 4) | 0x07 | ((self->_resolution & 0x02) << 2);
+    }
+
+    if (!twr_i2c_memory_write_8b_shadow(self->_i2c_channel, self->_i2c_address, 0x20, cfg_reg1, &self->_shadow))
     {
         return false;
     }
@@ -285,7 +333,7 @@ static bool _twr_lis2dh12_continuous_conversion(twr_lis2dh12_t *self)
     uint8_t cfg_reg1 = 0x57 | ((self->_resolution & 0x02) << 2);
 
     // ODR = 0x5 => 100Hz
-    if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x20, cfg_reg1))
+    if (!twr_i2c_memory_write_8b_shadow(self->_i2c_channel, self->_i2c_address, 0x20, cfg_reg1, &self->_shadow))
     {
         return false;
     }
@@ -337,23 +385,7 @@ bool twr_lis2dh12_set_alarm(twr_lis2dh12_t *self, twr_lis2dh12_alarm_t *alarm)
             return false;
         }
 
-        // CTRL_REG3
-        uint8_t ctrl_reg3 = (1 << 6);
-        if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x22, ctrl_reg3))
-        {
-            return false;
-        }
-
-        // CTRL_REG6 - invert interrupt
-        uint8_t ctrl_reg6 = (1 << 1);
-        if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x25, ctrl_reg6))
-        {
-            return false;
-        }
-
-        // ctr_reg5
-        uint8_t ctrl_reg5 = (0 << 3); // latch interrupt request
-        if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x24, ctrl_reg5))
+        if (!_twr_lis2dh12_interrupt_config(self))
         {
             return false;
         }
@@ -389,7 +421,15 @@ bool twr_lis2dh12_set_alarm(twr_lis2dh12_t *self, twr_lis2dh12_alarm_t *alarm)
             return false;
         }
 
-        twr_exti_unregister(TWR_EXTI_LINE_PB6);
+        if (!_twr_lis2dh12_interrupt_config(self))
+        {
+            return false;
+        }
+
+        if (!self->_orientation_active && !self->_fifo_active)
+        {
+            twr_exti_unregister(TWR_EXTI_LINE_PB6);
+        }
     }
 
     twr_lis2dh12_measure(self);
@@ -397,6 +437,160 @@ bool twr_lis2dh12_set_alarm(twr_lis2dh12_t *self, twr_lis2dh12_alarm_t *alarm)
     return true;
 }
 
+bool twr_lis2dh12_set_orientation_detection(twr_lis2dh12_t *self, bool enable)
+{
+    self->_orientation_active = enable;
+
+    // Disable IRQ first to change the registers
+    if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x34, 0x00))
+    {
+        return false;
+    }
+
+    if (enable)
+    {
+        uint8_t int2_ths = (uint8_t)(_TWR_LIS2DH12_ORIENTATION_THRESHOLD / _twr_lis2dh12_ths_lut[self->_scale]);
+
+        if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x36, int2_ths))
+        {
+            return false;
+        }
+
+        if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x37, _TWR_LIS2DH12_ORIENTATION_DURATION))
+        {
+            return false;
+        }
+
+        if (!_twr_lis2dh12_interrupt_config(self))
+        {
+            return false;
+        }
+
+        // INT2_CFG - AOI = 0, 6D = 1 => 6D movement recognition on all axes
+        if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x34, 0x7f))
+        {
+            return false;
+        }
+
+        if (self->_task_id_orientation == 0)
+        {
+            self->_task_id_orientation = twr_scheduler_register(_twr_lis2dh12_task_orientation, self, TWR_TICK_INFINITY);
+        }
+
+        twr_exti_register(TWR_EXTI_LINE_PB6, TWR_EXTI_EDGE_FALLING, _twr_lis2dh12_interrupt, self);
+
+        // Clear possibly latched request, its edge would be lost otherwise
+        twr_scheduler_plan_now(self->_task_id_orientation);
+    }
+    else
+    {
+        if (!_twr_lis2dh12_interrupt_config(self))
+        {
+            return false;
+        }
+
+        if (self->_task_id_orientation != 0)
+        {
+            twr_scheduler_unregister(self->_task_id_orientation);
+
+            self->_task_id_orientation = 0;
+        }
+
+        if (!self->_alarm_active && !self->_fifo_active)
+        {
+            twr_exti_unregister(TWR_EXTI_LINE_PB6);
+        }
+
+        self->_face = TWR_DICE_FACE_UNKNOWN;
+    }
+
+    // Measurement ends with the configuration of conversions needed by orientation detection
+    if (!twr_lis2dh12_measure(self))
+    {
+        return _twr_lis2dh12_power_down(self);
+    }
+
+    return true;
+}
+
+bool twr_lis2dh12_set_fifo(twr_lis2dh12_t *self, twr_lis2dh12_fifo_t *fifo)
+{
+    // Bypass mode first, it also empties the FIFO
+    if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x2e, 0x00))
+    {
+        return false;
+    }
+
+    self->_fifo_active = fifo != NULL;
+
+    self->_fifo_count = 0;
+
+    if (fifo != NULL)
+    {
+        self->_fifo = *fifo;
+
+        if (self->_fifo.watermark == 0 || self->_fifo.watermark >= TWR_LIS2DH12_FIFO_SIZE)
+        {
+            self->_fifo.watermark = TWR_LIS2DH12_FIFO_SIZE - 1;
+        }
+
+        // Enable FIFO and watermark interrupt
+        if (!_twr_lis2dh12_interrupt_config(self))
+        {
+            return false;
+        }
+
+        // FIFO_CTRL_REG - FM = 10 => stream mode
+        if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x2e, 0x80 | self->_fifo.watermark))
+        {
+            return false;
+        }
+
+        if (self->_task_id_fifo == 0)
+        {
+            self->_task_id_fifo = twr_scheduler_register(_twr_lis2dh12_task_fifo, self, TWR_TICK_INFINITY);
+        }
+
+        twr_exti_register(TWR_EXTI_LINE_PB6, TWR_EXTI_EDGE_FALLING, _twr_lis2dh12_interrupt, self);
+    }
+    else
+    {
+        if (!_twr_lis2dh12_interrupt_config(self))
+        {
+            return false;
+        }
+
+        if (self->_task_id_fifo != 0)
+        {
+            twr_scheduler_unregister(self->_task_id_fifo);
+
+            self->_task_id_fifo = 0;
+        }
+
+        if (!self->_alarm_active && !self->_orientation_active)
+        {
+            twr_exti_unregister(TWR_EXTI_LINE_PB6);
+        }
+    }
+
+    // Start or stop conversions
+    return _twr_lis2dh12_power_down(self);
+}
+
+size_t twr_lis2dh12_get_fifo_result_raw(twr_lis2dh12_t *self, const twr_lis2dh12_result_raw_t **samples)
+{
+    *samples = self->_fifo.buffer;
+
+    return self->_fifo_count;
+}
+
+bool twr_lis2dh12_get_orientation(twr_lis2dh12_t *self, twr_dice_face_t *face)
+{
+    *face = self->_face;
+
+    return self->_face != TWR_DICE_FACE_UNKNOWN;
+}
+
 bool twr_lis2dh12_set_resolution(twr_lis2dh12_t *self, twr_lis2dh12_resolution_t resolution)
 {
     self->_resolution = resolution;
@@ -419,13 +613,165 @@ bool twr_lis2dh12_set_scale(twr_lis2dh12_t *self, twr_lis2dh12_scale_t scale)
     return true;
 }
 
+static bool _twr_lis2dh12_interrupt_config(twr_lis2dh12_t *self)
+{
+    // CTRL_REG3 - IA1 (alarm), IA2 (orientation) and FIFO watermark on INT1 pin
+    uint8_t ctrl_reg3 = (self->_alarm_active ? (1 << 6) : 0) | (self->_orientation_active ? (1 << 5) : 0);
+    ctrl_reg3 |= self->_fifo_active ? (1 << 2) : 0;
+    if (!twr_i2c_memory_write_8b_shadow(self->_i2c_channel, self->_i2c_address, 0x22, ctrl_reg3, &self->_shadow))
+    {
+        return false;
+    }
+
+    // CTRL_REG6 - invert interrupt
+    uint8_t ctrl_reg6 = (1 << 1);
+    if (!twr_i2c_memory_write_8b_shadow(self->_i2c_channel, self->_i2c_address, 0x25, ctrl_reg6, &self->_shadow))
+    {
+        return false;
+    }
+
+    // ctr_reg5
+    uint8_t ctrl_reg5 = (0 << 3); // latch interrupt request
+
+    // Latch orientation request until INT2_SRC is read
+    ctrl_reg5 |= self->_orientation_active ? (1 << 1) : 0;
+
+    // Enable FIFO
+    ctrl_reg5 |= self->_fifo_active ? (1 << 6) : 0;
+
+    if (!twr_i2c_memory_write_8b_shadow(self->_i2c_channel, self->_i2c_address, 0x24, ctrl_reg5, &self->_shadow))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+static void _twr_lis2dh12_task_orientation(void *param)
+{
+    twr_lis2dh12_t *self = param;
+
+    uint8_t int2_src;
+
+    // Reading of INT2_SRC also releases latched request
+    if (!twr_i2c_memory_read_8b(self->_i2c_channel, self->_i2c_address, 0x35, &int2_src))
+    {
+        twr_scheduler_plan_current_from_now(_TWR_LIS2DH12_ORIENTATION_RETRY);
+
+        return;
+    }
+
+    // No interrupt active?
+    if ((int2_src & (1 << 6)) == 0)
+    {
+        return;
+    }
+
+    twr_dice_face_t face = TWR_DICE_FACE_UNKNOWN;
+
+    // Exactly one axis is beyond threshold in recognized position
+    for (int i = 0; i < 6; i++)
+    {
+        if ((int2_src & 0x3f) == (1 << i))
+        {
+            face = _twr_lis2dh12_6d_face_lut[i];
+        }
+    }
+
+    if (face == TWR_DICE_FACE_UNKNOWN)
+    {
+        return;
+    }
+
+    if (face == self->_face)
+    {
+        return;
+    }
+
+    self->_face = face;
+
+    if (self->_event_handler != NULL)
+    {
+        self->_event_handler(self, TWR_LIS2DH12_EVENT_ORIENTATION, self->_event_param);
+    }
+}
+
+static void _twr_lis2dh12_task_fifo(void *param)
+{
+    twr_lis2dh12_t *self = param;
+
+    uint8_t fifo_src;
+
+    // FIFO_SRC_REG - number of unread samples
+    if (!twr_i2c_memory_read_8b(self->_i2c_channel, self->_i2c_address, 0x2f, &fifo_src))
+    {
+        twr_scheduler_plan_current_from_now(_TWR_LIS2DH12_FIFO_RETRY);
+
+        return;
+    }
+
+    // Watermark not reached?
+    if ((fifo_src & (1 << 7)) == 0)
+    {
+        return;
+    }
+
+    size_t count = (fifo_src & (1 << 6)) != 0 ? TWR_LIS2DH12_FIFO_SIZE : (fifo_src & 0x1f);
+
+    twr_i2c_memory_transfer_t transfer;
+
+    // Output address rolls back from OUT_Z_H to OUT_X_L when FIFO is enabled, so one transfer drains whole block
+    transfer.device_address = self->_i2c_address;
+    transfer.memory_address = _TWR_LIS2DH12_AUTOINCREMENT_ADR | 0x28;
+    transfer.buffer = self->_fifo.buffer;
+    transfer.length = count * sizeof(twr_lis2dh12_result_raw_t);
+
+    if (!twr_i2c_memory_read(self->_i2c_channel, &transfer))
+    {
+        self->_fifo_count = 0;
+
+        if (self->_event_handler != NULL)
+        {
+            self->_event_handler(self, TWR_LIS2DH12_EVENT_ERROR, self->_event_param);
+        }
+
+        // Watermark interrupt would not come again while the FIFO is not drained
+        twr_scheduler_plan_current_from_now(_TWR_LIS2DH12_FIFO_RETRY);
+
+        return;
+    }
+
+    self->_fifo_count = count;
+
+    // Check once more, level could reach watermark again during transfer and then there is no new edge
+    twr_scheduler_plan_current_now();
+
+    if (self->_event_handler != NULL)
+    {
+        self->_event_handler(self, TWR_LIS2DH12_EVENT_FIFO, self->_event_param);
+    }
+}
+
 static void _twr_lis2dh12_interrupt(twr_exti_line_t line, void *param)
 {
     (void) line;
 
     twr_lis2dh12_t *self = param;
 
-    self->_irq_flag = true;
+    if (self->_fifo_active)
+    {
+        twr_scheduler_signal(self->_task_id_fifo);
+    }
 
-    twr_lis2dh12_measure(self);
+    if (self->_orientation_active)
+    {
+        twr_scheduler_signal(self->_task_id_orientation);
+    }
+
+    if (self->_alarm_active)
+    {
+        self->_irq_flag = true;
+
+        twr_lis2dh12_measure(self);
+    }
 }
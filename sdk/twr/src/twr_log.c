@@ -1,23 +1,112 @@
 #include <twr_log.h>
 #include <twr_error.h>
+#include <twr_scheduler.h>
+#include <twr_atci.h>
+#include <twr_crc.h>
+#include <twr_fmt.h>
+#include <twr_pool.h>
+
+#define _TWR_LOG_RECORD_SYNC 0xa5
+#define _TWR_LOG_RECORD_HEADER_SIZE 11
+#define _TWR_LOG_RECORD_ARGUMENTS_MAX (TWR_LOG_BUFFER_SIZE - _TWR_LOG_RECORD_HEADER_SIZE < 255 ? TWR_LOG_BUFFER_SIZE - _TWR_LOG_RECORD_HEADER_SIZE : 255)
+
+#define _TWR_LOG_FIFO ((TWR_LOG_ASYNC || TWR_LOG_DEFERRED) && TWR_LOG_UART_OUTPUT)
+
+#define _TWR_LOG_RAM_MAGIC 0x4c4f4721
+#define _TWR_LOG_RAM_RESET_MARKER "# <!> reset\r\n"
+
+#if TWR_POOL_SHARED_BLOCK_SIZE < TWR_LOG_BUFFER_SIZE
+#error "TWR_POOL_SHARED_BLOCK_SIZE has to hold TWR_LOG_BUFFER_SIZE"
+#endif
+
+// Transmit FIFO of UART holds at least one whole message, truncated line takes ellipsis and new line extra
+#define _TWR_LOG_UART_FIFO_SIZE (TWR_LOG_BUFFER_SIZE + 8)
 
 typedef struct
 {
     bool initialized;
-    twr_log_level_t level;
+    twr_log_level_t level[TWR_LOG_MODULE_COUNT];
     twr_log_timestamp_t timestamp;
     twr_tick_t tick_last;
-    char buffer[TWR_LOG_BUFFER_SIZE];
+    // Scratch block of shared pool, held only during call
+    char *buffer;
+    int buffer_depth;
+    twr_transport_t *transport;
+
+#if _TWR_LOG_FIFO
+    // Messages prefixed by 2 B length wait here, so whole messages can be dropped
+    twr_fifo_t fifo;
+    uint8_t fifo_buffer[TWR_LOG_FIFO_SIZE];
+    size_t entry_length;
+    twr_fifo_t uart_fifo;
+    uint8_t uart_fifo_buffer[_TWR_LOG_UART_FIFO_SIZE];
+    twr_scheduler_task_id_t drain_task_id;
+    uint32_t dropped;
+    uint32_t dropped_total;
+#endif
 
 } twr_log_t;
 
+#if TWR_LOG_RAM
+
+typedef struct
+{
+    // CRC covers only header, so it is cheap to update with every message
+    uint32_t magic;
+    uint32_t size;
+    uint32_t head;
+    uint32_t length;
+    uint32_t crc;
+    uint8_t data[TWR_LOG_RAM_SIZE];
+
+} twr_log_ram_t;
+
+#endif
+
 #ifndef RELEASE
 
 static twr_log_t _twr_log = { .initialized = false };
 
+#if TWR_LOG_RAM
+static twr_log_ram_t _twr_log_ram __attribute__((section(".noinit")));
+#endif
+
 void application_error(twr_error_t code);
 
-static void _twr_log_message(twr_log_level_t level, char id, const char *format, va_list ap);
+static void _twr_log_message(twr_log_module_t module, twr_log_level_t level, char id, const char *format, va_list ap);
+static void _twr_log_writev(const twr_uart_segment_t *segments, size_t count);
+static bool _twr_log_buffer_acquire(void);
+static void _twr_log_buffer_release(void);
+
+#if _TWR_LOG_FIFO
+
+static bool _twr_log_fifo_reserve(size_t length);
+static size_t _twr_log_fifo_spaces(twr_fifo_t *fifo);
+static void _twr_log_fifo_put(const twr_uart_segment_t *segments, size_t count, size_t length);
+static bool _twr_log_fifo_drop(void);
+static bool _twr_log_fifo_next(void);
+static size_t _twr_log_notice(uint8_t *notice);
+static void _twr_log_drain_task(void *param);
+static void _twr_log_uart_event_handler(twr_uart_channel_t channel, twr_uart_event_t event, void *event_param);
+
+TWR_SCHEDULER_TASK_STATIC(_twr_log_drain_task_static, _twr_log_drain_task, NULL);
+
+#endif
+
+#if TWR_LOG_DEFERRED
+
+static size_t _twr_log_record(char id, const char *format, va_list ap);
+static inline void _twr_log_put_u32(uint8_t *p, uint32_t value);
+
+#endif
+
+#if TWR_LOG_RAM
+
+static void _twr_log_ram_init(void);
+static void _twr_log_ram_write(const void *buffer, size_t length);
+static uint32_t _twr_log_ram_crc(void);
+
+#endif
 
 void twr_log_init(twr_log_level_t level, twr_log_timestamp_t timestamp)
 {
@@ -28,31 +117,106 @@ void twr_log_init(twr_log_level_t level, twr_log_timestamp_t timestamp)
 
     memset(&_twr_log, 0, sizeof(_twr_log));
 
-    _twr_log.level = level;
+    for (size_t i = 0; i < TWR_LOG_MODULE_COUNT; i++)
+    {
+        _twr_log.level[i] = level;
+    }
+
     _twr_log.timestamp = timestamp;
 
+#if TWR_LOG_RAM
+    _twr_log_ram_init();
+#endif
+
+#if TWR_LOG_UART_OUTPUT
     twr_uart_init(TWR_LOG_UART, TWR_UART_BAUDRATE_115200, TWR_UART_SETTING_8N1);
     twr_uart_write(TWR_LOG_UART, "\r\n", 2);
+#endif
+
+#if _TWR_LOG_FIFO
+    twr_fifo_init(&_twr_log.fifo, _twr_log.fifo_buffer, sizeof(_twr_log.fifo_buffer));
+    twr_fifo_init(&_twr_log.uart_fifo, _twr_log.uart_fifo_buffer, sizeof(_twr_log.uart_fifo_buffer));
+
+    twr_uart_set_async_fifo(TWR_LOG_UART, &_twr_log.uart_fifo, NULL);
+    twr_uart_set_event_handler(TWR_LOG_UART, _twr_log_uart_event_handler, NULL);
+
+    _twr_log.drain_task_id = twr_scheduler_get_static_id(&_twr_log_drain_task_static);
+#endif
 
     _twr_log.initialized = true;
 }
 
-void twr_log_dump(const void *buffer, size_t length, const char *format, ...)
+void twr_log_set_module_level(twr_log_module_t module, twr_log_level_t level)
+{
+    if (module < TWR_LOG_MODULE_COUNT)
+    {
+        _twr_log.level[module] = level;
+    }
+}
+
+twr_log_level_t twr_log_get_module_level(twr_log_module_t module)
+{
+    return module < TWR_LOG_MODULE_COUNT ? _twr_log.level[module] : TWR_LOG_LEVEL_OFF;
+}
+
+void twr_log_module_dump(twr_log_module_t module, const void *buffer, size_t length, const char *format, ...)
 {
     va_list ap;
 
-    if (_twr_log.level > TWR_LOG_LEVEL_DUMP)
+    if (module >= TWR_LOG_MODULE_COUNT || _twr_log.level[module] > TWR_LOG_LEVEL_DUMP)
     {
         return;
     }
 
+    if (!_twr_log_buffer_acquire())
+    {
+        return;
+    }
+
+#if TWR_LOG_DEFERRED
+    if (!_twr_log.initialized)
+    {
+        application_error(TWR_ERROR_LOG_NOT_INITIALIZED);
+    }
+
     va_start(ap, format);
-    _twr_log_message(TWR_LOG_LEVEL_DUMP, 'X', format, ap);
+    size_t record_length = _twr_log_record('X', format, ap);
+    va_end(ap);
+
+    uint8_t *record = (uint8_t *) _twr_log.buffer;
+
+    if (buffer != NULL)
+    {
+        // Dumped bytes are sent as trailing arguments, what does not fit into record is cut off
+        size_t count = _TWR_LOG_RECORD_HEADER_SIZE + _TWR_LOG_RECORD_ARGUMENTS_MAX - record_length;
+
+        if (count > length)
+        {
+            count = length;
+        }
+
+        memcpy(record + record_length, buffer, count);
+
+        record_length += count;
+        record[1] += count;
+    }
+
+    twr_uart_segment_t segment = { .buffer = record, .length = record_length };
+
+    _twr_log_writev(&segment, 1);
+
+    _twr_log_buffer_release();
+
+    return;
+#endif
+
+    va_start(ap, format);
+    _twr_log_message(module, TWR_LOG_LEVEL_DUMP, 'X', format, ap);
     va_end(ap);
 
     size_t offset_base = 0;
 
-    for (; offset_base < sizeof(_twr_log.buffer); offset_base++)
+    for (; offset_base < TWR_LOG_BUFFER_SIZE; offset_base++)
     {
         if (_twr_log.buffer[offset_base] == '>')
         {
@@ -70,7 +234,7 @@ void twr_log_dump(const void *buffer, size_t length, const char *format, ...)
     {
         for (position = 0; position < length; position += TWR_LOG_DUMP_WIDTH)
         {
-            offset = offset_base + snprintf(_twr_log.buffer + offset_base, sizeof(_twr_log.buffer) - offset_base, "%3d: ", position);
+            offset = offset_base + twr_fmt_snprintf(_twr_log.buffer + offset_base, TWR_LOG_BUFFER_SIZE - offset_base, "%3d: ", position);
 
             char *ptr_hex = _twr_log.buffer + offset;
 
@@ -103,7 +267,7 @@ void twr_log_dump(const void *buffer, size_t length, const char *format, ...)
                     *ptr_hex++ = ' ';
                 }
 
-                snprintf(ptr_hex, 4, "%02X ", value);
+                twr_fmt_snprintf(ptr_hex, 4, "%02X ", value);
 
                 ptr_hex += 3;
 
@@ -135,59 +299,78 @@ void twr_log_dump(const void *buffer, size_t length, const char *format, ...)
             _twr_log.buffer[offset++] = '\r';
             _twr_log.buffer[offset++] = '\n';
 
-            twr_uart_write(TWR_LOG_UART, _twr_log.buffer, offset);
+            twr_uart_segment_t segment = { .buffer = _twr_log.buffer, .length = offset };
+
+            _twr_log_writev(&segment, 1);
         }
     }
+
+    _twr_log_buffer_release();
 }
 
-void twr_log_debug(const char *format, ...)
+void twr_log_module_debug(twr_log_module_t module, const char *format, ...)
 {
     va_list ap;
 
     va_start(ap, format);
-    _twr_log_message(TWR_LOG_LEVEL_DEBUG, 'D', format, ap);
+    _twr_log_message(module, TWR_LOG_LEVEL_DEBUG, 'D', format, ap);
     va_end(ap);
 }
 
-void twr_log_info(const char *format, ...)
+void twr_log_module_info(twr_log_module_t module, const char *format, ...)
 {
     va_list ap;
 
     va_start(ap, format);
-    _twr_log_message(TWR_LOG_LEVEL_INFO, 'I', format, ap);
+    _twr_log_message(module, TWR_LOG_LEVEL_INFO, 'I', format, ap);
     va_end(ap);
 }
 
-void twr_log_warning(const char *format, ...)
+void twr_log_module_warning(twr_log_module_t module, const char *format, ...)
 {
     va_list ap;
 
     va_start(ap, format);
-    _twr_log_message(TWR_LOG_LEVEL_WARNING, 'W', format, ap);
+    _twr_log_message(module, TWR_LOG_LEVEL_WARNING, 'W', format, ap);
     va_end(ap);
 }
 
-void twr_log_error(const char *format, ...)
+void twr_log_module_error(twr_log_module_t module, const char *format, ...)
 {
     va_list ap;
 
     va_start(ap, format);
-    _twr_log_message(TWR_LOG_LEVEL_ERROR, 'E', format, ap);
+    _twr_log_message(module, TWR_LOG_LEVEL_ERROR, 'E', format, ap);
     va_end(ap);
 }
 
-static void _twr_log_message(twr_log_level_t level, char id, const char *format, va_list ap)
+static void _twr_log_message(twr_log_module_t module, twr_log_level_t level, char id, const char *format, va_list ap)
 {
     if (!_twr_log.initialized)
     {
         application_error(TWR_ERROR_LOG_NOT_INITIALIZED);
     }
 
-    if (_twr_log.level > level)
+    if (module >= TWR_LOG_MODULE_COUNT || _twr_log.level[module] > level)
+    {
+        return;
+    }
+
+    if (!_twr_log_buffer_acquire())
     {
         return;
     }
 
+#if TWR_LOG_DEFERRED
+    twr_uart_segment_t segment = { .buffer = _twr_log.buffer, .length = _twr_log_record(id, format, ap) };
+
+    _twr_log_writev(&segment, 1);
+
+    _twr_log_buffer_release();
+
+    return;
+#endif
+
     size_t offset;
 
     if (_twr_log.timestamp == TWR_LOG_TIMESTAMP_ABS)
@@ -196,7 +379,7 @@ static void _twr_log_message(twr_log_level_t level, char id, const char *format,
 
         uint32_t timestamp_abs = tick_now / 10;
 
-        offset = sprintf(_twr_log.buffer, "# %lu.%02lu <%c> ", timestamp_abs / 100, timestamp_abs % 100, id);
+        offset = twr_fmt_snprintf(_twr_log.buffer, TWR_LOG_BUFFER_SIZE, "# %lu.%02lu <%c> ", timestamp_abs / 100, timestamp_abs % 100, id);
     }
     else if (_twr_log.timestamp == TWR_LOG_TIMESTAMP_REL)
     {
@@ -204,7 +387,7 @@ static void _twr_log_message(twr_log_level_t level, char id, const char *format,
 
         uint32_t timestamp_rel = (tick_now - _twr_log.tick_last) / 10;
 
-        offset = sprintf(_twr_log.buffer, "# +%lu.%02lu <%c> ", timestamp_rel / 100, timestamp_rel % 100, id);
+        offset = twr_fmt_snprintf(_twr_log.buffer, TWR_LOG_BUFFER_SIZE, "# +%lu.%02lu <%c> ", timestamp_rel / 100, timestamp_rel % 100, id);
 
         _twr_log.tick_last = tick_now;
     }
@@ -217,20 +400,628 @@ static void _twr_log_message(twr_log_level_t level, char id, const char *format,
         offset = 6;
     }
 
-    offset += vsnprintf(&_twr_log.buffer[offset], sizeof(_twr_log.buffer) - offset - 1, format, ap);
+    offset += twr_fmt_vsnprintf(&_twr_log.buffer[offset], TWR_LOG_BUFFER_SIZE - offset, format, ap);
+
+    twr_uart_segment_t segments[] =
+    {
+        { .buffer = _twr_log.buffer, .length = offset },
+        { .buffer = "...", .length = 0 },
+        { .buffer = "\r\n", .length = 2 }
+    };
+
+    if (offset >= TWR_LOG_BUFFER_SIZE)
+    {
+        // Truncated message is terminated by ellipsis
+        segments[0].length = TWR_LOG_BUFFER_SIZE - 1;
+        segments[1].length = 3;
+    }
+
+    _twr_log_writev(segments, 3);
+
+    _twr_log_buffer_release();
+}
+
+static bool _twr_log_buffer_acquire(void)
+{
+    // Dump keeps the block over formatting of its header
+    if (_twr_log.buffer_depth == 0)
+    {
+        _twr_log.buffer = twr_pool_alloc(twr_pool_get_shared());
+
+        if (_twr_log.buffer == NULL)
+        {
+            return false;
+        }
+    }
+
+    _twr_log.buffer_depth++;
+
+    return true;
+}
+
+static void _twr_log_buffer_release(void)
+{
+    if (--_twr_log.buffer_depth == 0)
+    {
+        twr_pool_unref(twr_pool_get_shared(), _twr_log.buffer);
+
+        _twr_log.buffer = NULL;
+    }
+}
+
+void twr_log_set_transport(twr_transport_t *transport)
+{
+    _twr_log.transport = transport;
+}
+
+uint32_t twr_log_get_dropped(void)
+{
+#if _TWR_LOG_FIFO
+    return _twr_log.dropped_total;
+#else
+    return 0;
+#endif
+}
+
+size_t twr_log_ram_get_length(void)
+{
+#if TWR_LOG_RAM
+    return _twr_log.initialized ? _twr_log_ram.length : 0;
+#else
+    return 0;
+#endif
+}
+
+size_t twr_log_ram_read(size_t offset, void *buffer, size_t length)
+{
+#if TWR_LOG_RAM
+    size_t available = twr_log_ram_get_length();
+
+    if (offset >= available)
+    {
+        return 0;
+    }
+
+    if (length > available - offset)
+    {
+        length = available - offset;
+    }
+
+    size_t index = (_twr_log_ram.head + TWR_LOG_RAM_SIZE - available + offset) % TWR_LOG_RAM_SIZE;
+    size_t first = TWR_LOG_RAM_SIZE - index;
+
+    if (first > length)
+    {
+        first = length;
+    }
+
+    memcpy(buffer, _twr_log_ram.data + index, first);
+    memcpy((uint8_t *) buffer + first, _twr_log_ram.data, length - first);
+
+    return length;
+#else
+    (void) offset;
+    (void) buffer;
+    (void) length;
+
+    return 0;
+#endif
+}
+
+void twr_log_ram_dump(twr_uart_channel_t channel)
+{
+    uint8_t buffer[64];
+    size_t offset = 0;
+    size_t length;
+
+    while ((length = twr_log_ram_read(offset, buffer, sizeof(buffer))) != 0)
+    {
+        twr_uart_write(channel, buffer, length);
+
+        offset += length;
+    }
+}
+
+void twr_log_ram_clear(void)
+{
+#if TWR_LOG_RAM
+    if (!_twr_log.initialized)
+    {
+        return;
+    }
+
+    _twr_log_ram.head = 0;
+    _twr_log_ram.length = 0;
+    _twr_log_ram.crc = _twr_log_ram_crc();
+#endif
+}
+
+bool twr_log_ram_atci_action(void)
+{
+    char buffer[65];
+    size_t offset = 0;
+    size_t length;
+
+    while ((length = twr_log_ram_read(offset, buffer, sizeof(buffer) - 1)) != 0)
+    {
+        buffer[length] = '\0';
+
+        twr_atci_print(buffer);
+
+        offset += length;
+    }
+
+    return true;
+}
+
+static void _twr_log_writev(const twr_uart_segment_t *segments, size_t count)
+{
+#if TWR_LOG_RAM
+    for (size_t i = 0; i < count; i++)
+    {
+        _twr_log_ram_write(segments[i].buffer, segments[i].length);
+    }
+
+    _twr_log_ram.crc = _twr_log_ram_crc();
+#endif
+
+    // Transport takes whole message, it buffers on its own or sends it at once
+    if ((_twr_log.transport != NULL) && twr_transport_is_ready(_twr_log.transport))
+    {
+        twr_transport_writev(_twr_log.transport, segments, count);
+    }
+
+#if !TWR_LOG_UART_OUTPUT
+    (void) segments;
+    (void) count;
+#elif _TWR_LOG_FIFO
+    size_t length = 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        length += segments[i].length;
+    }
+
+    if (!_twr_log_fifo_reserve(length))
+    {
+        _twr_log.dropped++;
+        _twr_log.dropped_total++;
+
+        return;
+    }
+
+#if TWR_LOG_OVERFLOW == TWR_LOG_OVERFLOW_DROP_NEWEST
+    if (_twr_log.dropped != 0)
+    {
+        uint8_t notice[32];
+
+        size_t notice_length = _twr_log_notice(notice);
+
+        // Notice goes in front of the message only when both fit, newer messages were dropped meanwhile
+        if (_twr_log_fifo_spaces(&_twr_log.fifo) >= 2 + notice_length + 2 + length)
+        {
+            twr_uart_segment_t segment = { .buffer = notice, .length = notice_length };
+
+            _twr_log_fifo_put(&segment, 1, notice_length);
+
+            _twr_log.dropped = 0;
+        }
+    }
+#endif
+
+    _twr_log_fifo_put(segments, count, length);
+
+    twr_scheduler_plan_now(_twr_log.drain_task_id);
+#else
+    twr_uart_writev(TWR_LOG_UART, segments, count);
+#endif
+}
+
+#if TWR_LOG_RAM
+
+static void _twr_log_ram_init(void)
+{
+    if (_twr_log_ram.magic == _TWR_LOG_RAM_MAGIC && _twr_log_ram.size == TWR_LOG_RAM_SIZE &&
+        _twr_log_ram.head < TWR_LOG_RAM_SIZE && _twr_log_ram.length <= TWR_LOG_RAM_SIZE &&
+        _twr_log_ram.crc == _twr_log_ram_crc())
+    {
+        // Content of previous run is kept, marker separates it from messages after reset
+        _twr_log_ram_write(_TWR_LOG_RAM_RESET_MARKER, sizeof(_TWR_LOG_RAM_RESET_MARKER) - 1);
+    }
+    else
+    {
+        _twr_log_ram.magic = _TWR_LOG_RAM_MAGIC;
+        _twr_log_ram.size = TWR_LOG_RAM_SIZE;
+        _twr_log_ram.head = 0;
+        _twr_log_ram.length = 0;
+    }
+
+    _twr_log_ram.crc = _twr_log_ram_crc();
+}
+
+static void _twr_log_ram_write(const void *buffer, size_t length)
+{
+    const uint8_t *p = buffer;
+
+    // Only the tail of message longer than ring is kept
+    if (length > TWR_LOG_RAM_SIZE)
+    {
+        p += length - TWR_LOG_RAM_SIZE;
+        length = TWR_LOG_RAM_SIZE;
+    }
+
+    size_t first = TWR_LOG_RAM_SIZE - _twr_log_ram.head;
+
+    if (first > length)
+    {
+        first = length;
+    }
+
+    memcpy(_twr_log_ram.data + _twr_log_ram.head, p, first);
+    memcpy(_twr_log_ram.data, p + first, length - first);
+
+    _twr_log_ram.head = (_twr_log_ram.head + length) % TWR_LOG_RAM_SIZE;
+
+    _twr_log_ram.length += length;
+
+    if (_twr_log_ram.length > TWR_LOG_RAM_SIZE)
+    {
+        _twr_log_ram.length = TWR_LOG_RAM_SIZE;
+    }
+}
+
+static uint32_t _twr_log_ram_crc(void)
+{
+    return twr_crc32(&_twr_log_ram, offsetof(twr_log_ram_t, crc));
+}
+
+#endif
+
+#if _TWR_LOG_FIFO
 
-    if (offset >= sizeof(_twr_log.buffer))
+static bool _twr_log_fifo_reserve(size_t length)
+{
+    if (2 + length >= sizeof(_twr_log.fifo_buffer) || length > _TWR_LOG_UART_FIFO_SIZE - 1)
     {
-        offset = sizeof(_twr_log.buffer) - 3 - 3; // space for ...\r\n
-        _twr_log.buffer[offset++] = '.';
-        _twr_log.buffer[offset++] = '.';
-        _twr_log.buffer[offset++] = '.';
+        return false;
     }
 
-    _twr_log.buffer[offset++] = '\r';
-    _twr_log.buffer[offset++] = '\n';
+    while (_twr_log_fifo_spaces(&_twr_log.fifo) < 2 + length)
+    {
+#if TWR_LOG_OVERFLOW == TWR_LOG_OVERFLOW_DROP_OLDEST
+        if (!_twr_log_fifo_drop())
+        {
+            return false;
+        }
+
+        _twr_log.dropped++;
+        _twr_log.dropped_total++;
+#else
+        return false;
+#endif
+    }
 
-    twr_uart_write(TWR_LOG_UART, _twr_log.buffer, offset);
+    return true;
 }
 
+static size_t _twr_log_fifo_spaces(twr_fifo_t *fifo)
+{
+    // Tail may only move forward meanwhile, so free space is never overestimated
+    return (fifo->tail + fifo->size - fifo->head - 1) % fifo->size;
+}
+
+static void _twr_log_fifo_put(const twr_uart_segment_t *segments, size_t count, size_t length)
+{
+    uint8_t header[2] = { length, length >> 8 };
+
+    twr_fifo_write(&_twr_log.fifo, header, sizeof(header));
+
+    for (size_t i = 0; i < count; i++)
+    {
+        twr_fifo_write(&_twr_log.fifo, segments[i].buffer, segments[i].length);
+    }
+}
+
+static bool _twr_log_fifo_next(void)
+{
+    if (_twr_log.entry_length != 0)
+    {
+        return true;
+    }
+
+    uint8_t header[2];
+
+    if (twr_fifo_read(&_twr_log.fifo, header, sizeof(header)) != sizeof(header))
+    {
+        return false;
+    }
+
+    _twr_log.entry_length = header[0] | (header[1] << 8);
+
+    return true;
+}
+
+static size_t _twr_log_notice(uint8_t *notice)
+{
+#if TWR_LOG_DEFERRED
+    notice[0] = _TWR_LOG_RECORD_SYNC;
+    notice[1] = 4;
+    notice[2] = '!';
+
+    _twr_log_put_u32(notice + 3, 0);
+    _twr_log_put_u32(notice + 7, (uint32_t) twr_tick_get());
+    _twr_log_put_u32(notice + 11, _twr_log.dropped);
+
+    return _TWR_LOG_RECORD_HEADER_SIZE + 4;
+#else
+    return twr_fmt_snprintf((char *) notice, 32, "# <!> %lu dropped\r\n", (unsigned long) _twr_log.dropped);
+#endif
+}
+
+static bool _twr_log_fifo_drop(void)
+{
+    if (!_twr_log_fifo_next())
+    {
+        return false;
+    }
+
+    const void *buffer;
+
+    while (_twr_log.entry_length != 0)
+    {
+        size_t length = twr_fifo_peek(&_twr_log.fifo, &buffer);
+
+        if (length > _twr_log.entry_length)
+        {
+            length = _twr_log.entry_length;
+        }
+
+        twr_fifo_consume(&_twr_log.fifo, length);
+
+        _twr_log.entry_length -= length;
+    }
+
+    return true;
+}
+
+static void _twr_log_drain_task(void *param)
+{
+    (void) param;
+
+    const void *buffer;
+
+    // Only whole messages are moved to transmission, the rest continues when transmission is done
+    while (_twr_log_fifo_next() && _twr_log_fifo_spaces(&_twr_log.uart_fifo) >= _twr_log.entry_length)
+    {
+#if TWR_LOG_OVERFLOW == TWR_LOG_OVERFLOW_DROP_OLDEST
+        if (_twr_log.dropped != 0)
+        {
+            uint8_t notice[32];
+
+            size_t notice_length = _twr_log_notice(notice);
+
+            // Notice of messages dropped from FIFO precedes the oldest message kept
+            if (_twr_log_fifo_spaces(&_twr_log.uart_fifo) < notice_length + _twr_log.entry_length)
+            {
+                break;
+            }
+
+            twr_uart_async_write(TWR_LOG_UART, notice, notice_length);
+
+            _twr_log.dropped = 0;
+        }
+#endif
+
+        while (_twr_log.entry_length != 0)
+        {
+            size_t length = twr_fifo_peek(&_twr_log.fifo, &buffer);
+
+            if (length > _twr_log.entry_length)
+            {
+                length = _twr_log.entry_length;
+            }
+
+            twr_uart_async_write(TWR_LOG_UART, buffer, length);
+
+            twr_fifo_consume(&_twr_log.fifo, length);
+
+            _twr_log.entry_length -= length;
+        }
+    }
+}
+
+static void _twr_log_uart_event_handler(twr_uart_channel_t channel, twr_uart_event_t event, void *event_param)
+{
+    (void) channel;
+    (void) event_param;
+
+    if (event == TWR_UART_EVENT_ASYNC_WRITE_DONE)
+    {
+        twr_scheduler_plan_now(_twr_log.drain_task_id);
+    }
+}
+
+#endif
+
+#if TWR_LOG_DEFERRED
+
+static size_t _twr_log_record(char id, const char *format, va_list ap)
+{
+    uint8_t *record = (uint8_t *) _twr_log.buffer;
+
+    size_t offset = _TWR_LOG_RECORD_HEADER_SIZE;
+    size_t end = _TWR_LOG_RECORD_HEADER_SIZE + _TWR_LOG_RECORD_ARGUMENTS_MAX;
+
+    record[0] = _TWR_LOG_RECORD_SYNC;
+    record[2] = id;
+
+    _twr_log_put_u32(record + 3, (uint32_t) format);
+    _twr_log_put_u32(record + 7, (uint32_t) twr_tick_get());
+
+    // Only conversions are parsed, arguments are copied as they are
+    while (*format != '\0')
+    {
+        if (*format++ != '%')
+        {
+            continue;
+        }
+
+        int longs = 0;
+
+        for (; *format != '\0' && strchr("-+ #0123456789.*hlLjzt", *format) != NULL; format++)
+        {
+            if (*format == '*')
+            {
+                if (offset + 4 > end)
+                {
+                    goto truncated;
+                }
+
+                _twr_log_put_u32(record + offset, va_arg(ap, int));
+
+                offset += 4;
+            }
+            else if (*format == 'l')
+            {
+                longs++;
+            }
+            else if (*format == 'j')
+            {
+                longs = 2;
+            }
+        }
+
+        switch (*format)
+        {
+            case 'd':
+            case 'i':
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+            case 'c':
+            {
+                if (longs >= 2)
+                {
+                    if (offset + 8 > end)
+                    {
+                        goto truncated;
+                    }
+
+                    uint64_t value = va_arg(ap, long long);
+
+                    _twr_log_put_u32(record + offset, value);
+                    _twr_log_put_u32(record + offset + 4, value >> 32);
+
+                    offset += 8;
+                }
+                else
+                {
+                    if (offset + 4 > end)
+                    {
+                        goto truncated;
+                    }
+
+                    _twr_log_put_u32(record + offset, va_arg(ap, int));
+
+                    offset += 4;
+                }
+
+                break;
+            }
+            case 'p':
+            {
+                if (offset + 4 > end)
+                {
+                    goto truncated;
+                }
+
+                _twr_log_put_u32(record + offset, (uint32_t) va_arg(ap, void *));
+
+                offset += 4;
+
+                break;
+            }
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+            {
+                if (offset + 8 > end)
+                {
+                    goto truncated;
+                }
+
+                double value = va_arg(ap, double);
+
+                memcpy(record + offset, &value, 8);
+
+                offset += 8;
+
+                break;
+            }
+            case 's':
+            {
+                if (offset + 1 > end)
+                {
+                    goto truncated;
+                }
+
+                const char *string = va_arg(ap, const char *);
+
+                size_t count = 0;
+
+                while (string[count] != '\0' && offset + 1 + count < end)
+                {
+                    count++;
+                }
+
+                record[offset++] = count;
+
+                memcpy(record + offset, string, count);
+
+                offset += count;
+
+                break;
+            }
+            case 'n':
+            {
+                (void) va_arg(ap, int *);
+
+                break;
+            }
+            case '\0':
+            {
+                goto truncated;
+            }
+            default:
+            {
+                break;
+            }
+        }
+
+        format++;
+    }
+
+truncated:
+
+    record[1] = offset - _TWR_LOG_RECORD_HEADER_SIZE;
+
+    return offset;
+}
+
+static inline void _twr_log_put_u32(uint8_t *p, uint32_t value)
+{
+    p[0] = value;
+    p[1] = value >> 8;
+    p[2] = value >> 16;
+    p[3] = value >> 24;
+}
+
+#endif
+
 #endif
@@ -1,4 +1,5 @@
 #include <twr_lp8.h>
+#include <twr_kv.h>
 
 #define _TWR_LP8_MODBUS_DEVICE_ADDRESS 0xfe
 #define _TWR_LP8_MODBUS_WRITE 0x41
@@ -10,6 +11,7 @@
 #define _TWR_LP8_RX_CONC (3 + 0x9a - 0x80)
 
 #define _TWR_LP8_CALIBRATION_TIMEOUT (8 * 24 * 60 * 60 * 1000)
+#define _TWR_LP8_PRECHARGE 5000
 
 static void _twr_lp8_task_interval(void *param);
 
@@ -103,6 +105,25 @@ void twr_lp8_calibration(twr_lp8_t *self, twr_lp8_calibration_t calibration)
     twr_lp8_measure(self);
 }
 
+void twr_lp8_set_state_key(twr_lp8_t *self, uint16_t key)
+{
+    self->_state_enabled = true;
+    self->_state_key = key;
+}
+
+void twr_lp8_set_charge_hold(twr_lp8_t *self, bool hold)
+{
+    self->_charge_hold = hold;
+
+    // Charging is started again by the next measurement
+    if (!hold && self->_charging && self->_state == TWR_LP8_STATE_READY)
+    {
+        self->_driver->charge_enable(false);
+
+        self->_charging = false;
+    }
+}
+
 static void _twr_lp8_task_interval(void *param)
 {
     twr_lp8_t *self = (twr_lp8_t *) param;
@@ -137,6 +158,8 @@ start:
             self->_driver->device_enable(false);
             self->_driver->charge_enable(false);
 
+            self->_charging = false;
+
             if (self->_event_handler != NULL)
             {
                 self->_event_handler(TWR_LP8_EVENT_ERROR, self->_event_param);
@@ -156,6 +179,16 @@ start:
                 goto start;
             }
 
+            self->_charging = true;
+
+            size_t length = sizeof(self->_sensor_state);
+
+            // Restored state continues sequential measurements of the previous run
+            if (self->_state_enabled && twr_kv_get(self->_state_key, self->_sensor_state, &length) && length == sizeof(self->_sensor_state))
+            {
+                self->_first_measurement_done = true;
+            }
+
             self->_state = TWR_LP8_STATE_CHARGE;
 
             twr_scheduler_plan_current_from_now(60000);
@@ -168,15 +201,23 @@ start:
         }
         case TWR_LP8_STATE_PRECHARGE:
         {
-            if (!self->_driver->charge_enable(true))
+            // Capacitor kept charging needs only the rest of precharge time
+            if (!self->_charging)
             {
-                _twr_lp8_error(self, TWR_LP8_ERROR_PRECHARGE);
-                goto start;
+                if (!self->_driver->charge_enable(true))
+                {
+                    _twr_lp8_error(self, TWR_LP8_ERROR_PRECHARGE);
+                    goto start;
+                }
+
+                self->_charging = true;
+
+                self->_tick_charged = twr_tick_get() + _TWR_LP8_PRECHARGE;
             }
 
             self->_state = TWR_LP8_STATE_CHARGE;
 
-            twr_scheduler_plan_current_from_now(5000);
+            twr_scheduler_plan_current_absolute(self->_tick_charged);
 
             return;
         }
@@ -188,6 +229,8 @@ start:
                 goto start;
             }
 
+            self->_charging = false;
+
             if (!self->_driver->device_enable(true))
             {
                 _twr_lp8_error(self, TWR_LP8_ERROR_CHARGE_DEVICE_ENABLE);
@@ -497,8 +540,31 @@ start:
 
                 memcpy(self->_sensor_state, &self->_rx_buffer[4], 23);
 
+                if (self->_state_enabled && (!self->_first_measurement_done || twr_tick_get() >= self->_tick_state))
+                {
+                    // Failed write is retried after the next measurement
+                    if (twr_kv_set(self->_state_key, self->_sensor_state, sizeof(self->_sensor_state)))
+                    {
+                        self->_tick_state = twr_tick_get() + TWR_LP8_STATE_INTERVAL;
+                    }
+                }
+
                 self->_first_measurement_done = true;
 
+                if (self->_charge_hold)
+                {
+                    if (!self->_driver->charge_enable(true))
+                    {
+                        _twr_lp8_error(self, TWR_LP8_ERROR_PRECHARGE);
+
+                        goto start;
+                    }
+
+                    self->_charging = true;
+
+                    self->_tick_charged = twr_tick_get() + _TWR_LP8_PRECHARGE;
+                }
+
                 self->_concentration = (int16_t) self->_rx_buffer[_TWR_LP8_RX_CONC] << 8;
                 self->_concentration |= (int16_t) self->_rx_buffer[_TWR_LP8_RX_CONC + 1];
 
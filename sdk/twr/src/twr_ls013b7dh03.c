@@ -8,14 +8,37 @@
 static void _twr_ls013b7dh03_task(void *param);
 static bool _twr_ls013b7dh03_spi_transfer(twr_ls013b7dh03_t *self, uint8_t *buffer, size_t length);
 static void _twr_ls013b7dh03_spi_event_handler(twr_spi_event_t event, void *event_param);
+static bool _twr_ls013b7dh03_spi_cs_set(bool active, void *event_param);
 static inline uint8_t _twr_ls013b7dh03_reverse(uint8_t b);
+static inline void _twr_ls013b7dh03_dirty(twr_ls013b7dh03_t *self, int first, int last);
+static inline bool _twr_ls013b7dh03_write(twr_ls013b7dh03_t *self, uint32_t index, uint8_t mask, uint32_t color);
+static inline bool _twr_ls013b7dh03_put(twr_ls013b7dh03_t *self, uint32_t index, uint8_t mask, uint8_t value);
+
+// Line data are sent MSB first, so the leftmost pixel of byte is its top bit
+static const uint8_t _twr_ls013b7dh03_pixel_mask[8] = { 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01 };
+
+static const uint8_t _twr_ls013b7dh03_reverse_nibble[16] =
+{
+    0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe, 0x1, 0x9, 0x5, 0xd, 0x3, 0xb, 0x7, 0xf
+};
 
 void twr_ls013b7dh03_init(twr_ls013b7dh03_t *self, bool (*pin_cs_set)(bool state))
 {
     memset(self, 0xff, sizeof(*self));
 
+    self->_framebuffer = self->_buffer;
+    self->_spare = NULL;
+    self->_transfer = self->_buffer;
+    self->_update_pending = false;
     self->_vcom = 0;
     self->_pin_cs_set = pin_cs_set;
+    self->_spi_pending = false;
+    self->_mode_offset = 0;
+    self->_end_offset = TWR_LS013B7DH03_FRAMEBUFFER_SIZE - 1;
+
+    // First update sends whole frame
+    self->_dirty_first = 0;
+    self->_dirty_last = TWR_LS013B7DH03_HEIGHT - 1;
 
     twr_spi_init(TWR_SPI_SPEED_1_MHZ, TWR_SPI_MODE_0);
 
@@ -42,23 +65,54 @@ twr_gfx_caps_t twr_ls013b7dh03_get_caps(twr_ls013b7dh03_t *self)
     return caps;
 }
 
-bool twr_ls013b7dh03_is_ready(twr_ls013b7dh03_t *self)
+bool twr_ls013b7dh03_set_double_buffer(twr_ls013b7dh03_t *self, uint8_t *buffer)
 {
-    (void) self;
+    if (self->_spi_pending)
+    {
+        return false;
+    }
+
+    if (self->_framebuffer != self->_buffer)
+    {
+        memcpy(self->_buffer, self->_framebuffer, TWR_LS013B7DH03_FRAMEBUFFER_SIZE);
+    }
+
+    self->_framebuffer = self->_buffer;
+    self->_transfer = self->_buffer;
+    self->_spare = NULL;
+    self->_update_pending = false;
+
+    if (buffer != NULL)
+    {
+        // Buffers may differ only in dirty lines
+        memcpy(buffer, self->_buffer, TWR_LS013B7DH03_FRAMEBUFFER_SIZE);
+
+        self->_spare = buffer;
+    }
+
+    return true;
+}
 
-    return twr_spi_is_ready();
+bool twr_ls013b7dh03_is_ready(twr_ls013b7dh03_t *self)
+{
+    return !self->_spi_pending || self->_spare != NULL;
 }
 
 void twr_ls013b7dh03_clear(twr_ls013b7dh03_t *self)
 {
-    uint8_t line;
+    int line;
     uint32_t offs;
     uint8_t col;
-    for (line = 0x01, offs = 2; line <= TWR_LS013B7DH03_HEIGHT; line++, offs += _TWR_LS013B7DH03_LINE_INCREMENT)
+    for (line = 0, offs = 2; line < TWR_LS013B7DH03_HEIGHT; line++, offs += _TWR_LS013B7DH03_LINE_INCREMENT)
     {
         for (col = 0; col < (TWR_LS013B7DH03_WIDTH / 8); col++)
         {
-            self->_framebuffer[offs + col] = 0xff;
+            if (self->_framebuffer[offs + col] != 0xff)
+            {
+                self->_framebuffer[offs + col] = 0xff;
+
+                _twr_ls013b7dh03_dirty(self, line, line);
+            }
         }
     }
 }
@@ -72,15 +126,24 @@ void twr_ls013b7dh03_draw_pixel(twr_ls013b7dh03_t *self, int x, int y, uint32_t
     // Select column byte
     byteIndex += x / 8;
 
-    uint8_t bitMask = 1 << (7 - (x % 8));
+    uint8_t bitMask = _twr_ls013b7dh03_pixel_mask[x % 8];
+
+    uint8_t byte = self->_framebuffer[byteIndex];
 
     if (color == 0)
     {
-        self->_framebuffer[byteIndex] |= bitMask;
+        byte |= bitMask;
     }
     else
     {
-        self->_framebuffer[byteIndex] &= ~bitMask;
+        byte &= ~bitMask;
+    }
+
+    if (byte != self->_framebuffer[byteIndex])
+    {
+        self->_framebuffer[byteIndex] = byte;
+
+        _twr_ls013b7dh03_dirty(self, y, y);
     }
 }
 
@@ -93,7 +156,113 @@ uint32_t twr_ls013b7dh03_get_pixel(twr_ls013b7dh03_t *self, int x, int y)
     // Select column byte
     byteIndex += x / 8;
 
-    return (self->_framebuffer[byteIndex] >> (7 - (x % 8))) & 1 ? 0 : 1;
+    return (self->_framebuffer[byteIndex] & _twr_ls013b7dh03_pixel_mask[x % 8]) != 0 ? 0 : 1;
+}
+
+void twr_ls013b7dh03_draw_span(twr_ls013b7dh03_t *self, int left, int top, int length, uint32_t color)
+{
+    uint32_t byteIndex = 2 + top * _TWR_LS013B7DH03_LINE_INCREMENT + left / 8;
+
+    int x = left;
+    int end = left + length;
+    bool changed = false;
+
+    while (x < end)
+    {
+        int bits = 8 - (x % 8);
+
+        if (bits > end - x)
+        {
+            bits = end - x;
+        }
+
+        // Mask of bits from x % 8 MSB first
+        uint8_t mask = (0xff >> (x % 8)) & (0xff << (8 - (x % 8) - bits));
+
+        changed |= _twr_ls013b7dh03_write(self, byteIndex++, mask, color);
+
+        x += bits;
+    }
+
+    if (changed)
+    {
+        _twr_ls013b7dh03_dirty(self, top, top);
+    }
+}
+
+void twr_ls013b7dh03_draw_bitmap(twr_ls013b7dh03_t *self, int left, int top, const uint8_t *image, int width, int height, uint32_t color)
+{
+    int bytes = (width + 7) / 8;
+    int shift = left % 8;
+    bool changed = false;
+
+    for (int y = 0; y < height; y++)
+    {
+        const uint8_t *row = image + y * bytes;
+
+        uint32_t byteIndex = 2 + (top + y) * _TWR_LS013B7DH03_LINE_INCREMENT + left / 8;
+
+        for (int i = 0; i < bytes; i++)
+        {
+            // Drawn pixels are cleared bits, padding behind width is not drawn
+            uint8_t mask = ~row[i];
+
+            if (i == bytes - 1 && (width % 8) != 0)
+            {
+                mask &= 0xff << (8 - (width % 8));
+            }
+
+            changed |= _twr_ls013b7dh03_write(self, byteIndex + i, mask >> shift, color);
+
+            if (shift != 0)
+            {
+                changed |= _twr_ls013b7dh03_write(self, byteIndex + i + 1, mask << (8 - shift), color);
+            }
+        }
+    }
+
+    if (changed)
+    {
+        _twr_ls013b7dh03_dirty(self, top, top + height - 1);
+    }
+}
+
+void twr_ls013b7dh03_draw_image(twr_ls013b7dh03_t *self, int left, int top, const uint8_t *image, int width, int height)
+{
+    int bytes = (width + 7) / 8;
+    int shift = left % 8;
+    bool changed = false;
+
+    for (int y = 0; y < height; y++)
+    {
+        const uint8_t *row = image + y * bytes;
+
+        uint32_t byteIndex = 2 + (top + y) * _TWR_LS013B7DH03_LINE_INCREMENT + left / 8;
+
+        for (int i = 0; i < bytes; i++)
+        {
+            // Image is LSB first with set bits black, framebuffer is MSB first with cleared bits black
+            uint8_t value = ~_twr_ls013b7dh03_reverse(row[i]);
+            uint8_t mask = 0xff;
+
+            if (i == bytes - 1 && (width % 8) != 0)
+            {
+                mask <<= 8 - (width % 8);
+            }
+
+            changed |= _twr_ls013b7dh03_put(self, byteIndex + i, mask >> shift, value >> shift);
+
+            if (shift != 0)
+            {
+                changed |= _twr_ls013b7dh03_put(self, byteIndex + i + 1, mask << (8 - shift), value << (8 - shift));
+            }
+        }
+    }
+
+    if (changed)
+    {
+        _twr_ls013b7dh03_dirty(self, top, top + height - 1);
+    }
 }
 
 /*
@@ -104,33 +273,84 @@ Framebuffer format for updating multiple lines, ideal for later DMA TX:
 ||        1B        ||   1B |  16B |  1B   ||   1B |  16B |  1B   |
 ||  M0 M1 M2  DUMMY || ADDR | DATA | DUMMY || ADDR | DATA | DUMMY |
 
+Only the span of dirty lines is sent, mode is written into the dummy byte in front of the first
+line and the byte behind the last line becomes the trailing dummy until transfer is done.
+
+With double buffering the sent span is copied into the spare buffer, which becomes the framebuffer
+for drawing while the previous one is being transferred.
+
 */
 bool twr_ls013b7dh03_update(twr_ls013b7dh03_t *self)
 {
-    if (twr_spi_is_ready())
+    if (self->_spi_pending)
     {
-        if (!self->_pin_cs_set(0))
+        if (self->_spare == NULL)
         {
             return false;
         }
 
-        self->_framebuffer[0] = 0x80 | self->_vcom;
+        // Frame is sent from task after transfer is done
+        self->_update_pending = true;
 
-        if (!twr_spi_async_transfer(self->_framebuffer, NULL, TWR_LS013B7DH03_FRAMEBUFFER_SIZE, _twr_ls013b7dh03_spi_event_handler, self))
-        {
-            self->_pin_cs_set(1);
+        return true;
+    }
 
-            return false;
-        }
+    self->_update_pending = false;
 
-        twr_scheduler_plan_relative(self->_task_id, _TWR_LS013B7DH03_VCOM_PERIOD);
+    if (self->_dirty_first > self->_dirty_last)
+    {
+        return true;
+    }
 
-        self->_vcom ^= 0x40;
+    self->_mode_offset = self->_dirty_first * _TWR_LS013B7DH03_LINE_INCREMENT;
+    self->_end_offset = (self->_dirty_last + 1) * _TWR_LS013B7DH03_LINE_INCREMENT + 1;
 
-        return true;
+    self->_transfer = self->_framebuffer;
+
+    if (self->_spare != NULL)
+    {
+        memcpy(self->_spare + self->_mode_offset + 1, self->_transfer + self->_mode_offset + 1, self->_end_offset - self->_mode_offset - 1);
     }
 
-    return false;
+    self->_transfer[self->_mode_offset] = 0x80 | self->_vcom;
+
+    // Address of the next line must not be sent as trailer
+    self->_end_byte = self->_transfer[self->_end_offset];
+    self->_transfer[self->_end_offset] = 0xff;
+
+    // Frame is queued, so it does not wait for other SPI users to finish
+    self->_spi_transaction.source = self->_transfer + self->_mode_offset;
+    self->_spi_transaction.length = self->_end_offset - self->_mode_offset + 1;
+    self->_spi_transaction.speed = TWR_SPI_SPEED_1_MHZ;
+    self->_spi_transaction.mode = TWR_SPI_MODE_0;
+    self->_spi_transaction.cs_set = _twr_ls013b7dh03_spi_cs_set;
+    self->_spi_transaction.event_handler = _twr_ls013b7dh03_spi_event_handler;
+    self->_spi_transaction.event_param = self;
+
+    if (!twr_spi_submit(&self->_spi_transaction))
+    {
+        self->_transfer[self->_mode_offset] = 0xff;
+        self->_transfer[self->_end_offset] = self->_end_byte;
+
+        return false;
+    }
+
+    self->_spi_pending = true;
+
+    self->_dirty_first = TWR_LS013B7DH03_HEIGHT;
+    self->_dirty_last = -1;
+
+    if (self->_spare != NULL)
+    {
+        self->_framebuffer = self->_spare;
+        self->_spare = self->_transfer;
+    }
+
+    twr_scheduler_plan_relative(self->_task_id, _TWR_LS013B7DH03_VCOM_PERIOD);
+
+    self->_vcom ^= 0x40;
+
+    return true;
 }
 
 const twr_gfx_driver_t *twr_ls013b7dh03_get_driver(void)
@@ -142,7 +362,10 @@ const twr_gfx_driver_t *twr_ls013b7dh03_get_driver(void)
         .draw_pixel = (void (*)(void *, int, int, uint32_t)) twr_ls013b7dh03_draw_pixel,
         .get_pixel = (uint32_t (*)(void *, int, int)) twr_ls013b7dh03_get_pixel,
         .update = (bool (*)(void *)) twr_ls013b7dh03_update,
-        .get_caps = (twr_gfx_caps_t (*)(void *)) twr_ls013b7dh03_get_caps
+        .get_caps = (twr_gfx_caps_t (*)(void *)) twr_ls013b7dh03_get_caps,
+        .draw_span = (void (*)(void *, int, int, int, uint32_t)) twr_ls013b7dh03_draw_span,
+        .draw_bitmap = (void (*)(void *, int, int, const uint8_t *, int, int, uint32_t)) twr_ls013b7dh03_draw_bitmap,
+        .draw_image = (void (*)(void *, int, int, const uint8_t *, int, int)) twr_ls013b7dh03_draw_image
     };
 
     return &driver;
@@ -152,13 +375,32 @@ bool twr_ls013b7dh03_clear_memory_command(twr_ls013b7dh03_t *self)
 {
     uint8_t spi_data[2] = { 0x20, 0x00 };
 
-    return _twr_ls013b7dh03_spi_transfer(self, spi_data, sizeof(spi_data));
+    if (!_twr_ls013b7dh03_spi_transfer(self, spi_data, sizeof(spi_data)))
+    {
+        return false;
+    }
+
+    // Display memory no longer matches framebuffer
+    _twr_ls013b7dh03_dirty(self, 0, TWR_LS013B7DH03_HEIGHT - 1);
+
+    return true;
 }
 
 static void _twr_ls013b7dh03_task(void *param)
 {
     twr_ls013b7dh03_t *self = (twr_ls013b7dh03_t *) param;
 
+    if (self->_update_pending)
+    {
+        twr_ls013b7dh03_update(self);
+
+        // Task is planned by update when frame is sent
+        if (self->_spi_pending)
+        {
+            return;
+        }
+    }
+
     uint8_t spi_data[2] = {self->_vcom, 0x00};
 
     if (_twr_ls013b7dh03_spi_transfer(self, spi_data, sizeof(spi_data)))
@@ -190,19 +432,72 @@ static bool _twr_ls013b7dh03_spi_transfer(twr_ls013b7dh03_t *self, uint8_t *buff
 
 static void _twr_ls013b7dh03_spi_event_handler(twr_spi_event_t event, void *event_param)
 {
+    (void) event;
+
     twr_ls013b7dh03_t *self = (twr_ls013b7dh03_t *) event_param;
 
-    if (event == TWR_SPI_EVENT_DONE)
+    // Restore dummy byte and address of the next line
+    self->_transfer[self->_mode_offset] = 0xff;
+    self->_transfer[self->_end_offset] = self->_end_byte;
+
+    self->_spi_pending = false;
+
+    if (self->_update_pending)
     {
-        self->_pin_cs_set(1);
+        twr_scheduler_plan_now(self->_task_id);
     }
 }
 
+static bool _twr_ls013b7dh03_spi_cs_set(bool active, void *event_param)
+{
+    twr_ls013b7dh03_t *self = (twr_ls013b7dh03_t *) event_param;
+
+    return self->_pin_cs_set(active ? 0 : 1);
+}
+
 static inline uint8_t _twr_ls013b7dh03_reverse(uint8_t b)
 {
-   b = (b & 0xf0) >> 4 | (b & 0x0f) << 4;
-   b = (b & 0xcc) >> 2 | (b & 0x33) << 2;
-   b = (b & 0xaa) >> 1 | (b & 0x55) << 1;
+    return _twr_ls013b7dh03_reverse_nibble[b & 0x0f] << 4 | _twr_ls013b7dh03_reverse_nibble[b >> 4];
+}
+
+static inline void _twr_ls013b7dh03_dirty(twr_ls013b7dh03_t *self, int first, int last)
+{
+    if (first < self->_dirty_first)
+    {
+        self->_dirty_first = first;
+    }
+
+    if (last > self->_dirty_last)
+    {
+        self->_dirty_last = last;
+    }
+}
+
+static inline bool _twr_ls013b7dh03_write(twr_ls013b7dh03_t *self, uint32_t index, uint8_t mask, uint32_t color)
+{
+    uint8_t byte = color == 0 ? self->_framebuffer[index] | mask : self->_framebuffer[index] & ~mask;
+
+    if (byte == self->_framebuffer[index])
+    {
+        return false;
+    }
+
+    self->_framebuffer[index] = byte;
+
+    return true;
+}
+
+static inline bool _twr_ls013b7dh03_put(twr_ls013b7dh03_t *self, uint32_t index, uint8_t mask, uint8_t value)
+{
+    // Whole byte is copied when mask is full
+    uint8_t byte = (self->_framebuffer[index] & ~mask) | (value & mask);
+
+    if (byte == self->_framebuffer[index])
+    {
+        return false;
+    }
+
+    self->_framebuffer[index] = byte;
 
-   return b;
+    return true;
 }
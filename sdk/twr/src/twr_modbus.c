@@ -0,0 +1,500 @@
+#include <twr_modbus.h>
+#include <twr_crc.h>
+#include <twr_scheduler.h>
+
+// Clock of UART bridge on RS-485 Module, baudrate is given by its divisor
+#define _TWR_MODBUS_UART_CLOCK 13560000UL
+
+// Start, 8 data and 2 stop bits
+#define _TWR_MODBUS_CHARACTER_BITS 11
+
+#define _TWR_MODBUS_TIMEOUT_DEFAULT 100
+
+// RTU frame is at most 256 bytes long and at least 4 bytes long (address, function, CRC)
+#define _TWR_MODBUS_FRAME_SIZE 256
+#define _TWR_MODBUS_FRAME_MIN 4
+#define _TWR_MODBUS_EXCEPTION_LENGTH 5
+
+// Space of UART bridge TX FIFO
+#define _TWR_MODBUS_FIFO_SIZE 64
+
+typedef enum
+{
+    TWR_MODBUS_STATE_IDLE = 0,
+    TWR_MODBUS_STATE_TRANSMIT = 1,
+    TWR_MODBUS_STATE_RECEIVE = 2
+
+} twr_modbus_state_t;
+
+static struct
+{
+    bool _initialized;
+    twr_scheduler_task_id_t _task_id;
+    twr_modbus_state_t _state;
+    uint32_t _character_us;
+    twr_tick_t _silence;
+    twr_tick_t _timeout;
+
+    twr_modbus_request_t *_head;
+    twr_modbus_request_t *_tail;
+
+    // Requests from head to this one are coalesced into current transaction
+    twr_modbus_request_t *_last;
+    uint16_t _address;
+    uint16_t _count;
+
+    uint8_t _frame[_TWR_MODBUS_FRAME_SIZE];
+    size_t _length;
+    size_t _sent;
+    size_t _expected;
+    twr_tick_t _tick_timeout;
+    twr_tick_t _tick_silence;
+
+} _twr_modbus;
+
+static void _twr_modbus_task(void *param);
+static void _twr_modbus_coalesce(void);
+static void _twr_modbus_build(void);
+static void _twr_modbus_finish(twr_modbus_result_t result);
+static twr_modbus_result_t _twr_modbus_check(void);
+static twr_tick_t _twr_modbus_characters_ms(size_t count);
+
+bool twr_modbus_init(twr_module_rs485_baudrate_t baudrate)
+{
+    memset(&_twr_modbus, 0, sizeof(_twr_modbus));
+
+    if (!twr_module_rs485_set_baudrate(baudrate))
+    {
+        return false;
+    }
+
+    // Baudrate is clock / 16 / divisor
+    _twr_modbus._character_us = (uint64_t) _TWR_MODBUS_CHARACTER_BITS * 16 * 1000000 * baudrate / _TWR_MODBUS_UART_CLOCK;
+
+    // Silence between frames is fixed to 1.75 ms above 19200 baud (smaller divisor)
+    if (baudrate < TWR_MODULE_RS485_BAUDRATE_19200)
+    {
+        _twr_modbus._silence = 2;
+    }
+    else
+    {
+        _twr_modbus._silence = (_twr_modbus._character_us * 7 / 2 + 999) / 1000;
+    }
+
+    _twr_modbus._timeout = _TWR_MODBUS_TIMEOUT_DEFAULT;
+
+    _twr_modbus._task_id = twr_scheduler_register(_twr_modbus_task, NULL, TWR_TICK_INFINITY);
+
+    _twr_modbus._initialized = true;
+
+    return true;
+}
+
+void twr_modbus_set_timeout(twr_tick_t timeout)
+{
+    _twr_modbus._timeout = timeout;
+}
+
+bool twr_modbus_submit(twr_modbus_request_t *request)
+{
+    if (!_twr_modbus._initialized || request->registers == NULL)
+    {
+        return false;
+    }
+
+    switch (request->function)
+    {
+        case TWR_MODBUS_FUNCTION_READ_HOLDING_REGISTERS:
+        case TWR_MODBUS_FUNCTION_READ_INPUT_REGISTERS:
+        {
+            if (request->slave == 0 || request->count == 0 || request->count > TWR_MODBUS_READ_COUNT_MAX)
+            {
+                return false;
+            }
+
+            break;
+        }
+        case TWR_MODBUS_FUNCTION_WRITE_SINGLE_REGISTER:
+        {
+            if (request->count != 1)
+            {
+                return false;
+            }
+
+            break;
+        }
+        case TWR_MODBUS_FUNCTION_WRITE_MULTIPLE_REGISTERS:
+        {
+            if (request->count == 0 || request->count > TWR_MODBUS_WRITE_COUNT_MAX)
+            {
+                return false;
+            }
+
+            break;
+        }
+        default:
+        {
+            return false;
+        }
+    }
+
+    request->exception = 0;
+    request->_next = NULL;
+
+    if (_twr_modbus._head == NULL)
+    {
+        _twr_modbus._head = request;
+
+        twr_scheduler_plan_now(_twr_modbus._task_id);
+    }
+    else
+    {
+        _twr_modbus._tail->_next = request;
+    }
+
+    _twr_modbus._tail = request;
+
+    return true;
+}
+
+bool twr_modbus_is_idle(void)
+{
+    return _twr_modbus._head == NULL;
+}
+
+static void _twr_modbus_task(void *param)
+{
+    (void) param;
+
+    switch (_twr_modbus._state)
+    {
+        case TWR_MODBUS_STATE_IDLE:
+        {
+            if (_twr_modbus._head == NULL)
+            {
+                return;
+            }
+
+            if (twr_tick_get() < _twr_modbus._tick_silence)
+            {
+                twr_scheduler_plan_current_absolute(_twr_modbus._tick_silence);
+
+                return;
+            }
+
+            _twr_modbus_coalesce();
+
+            _twr_modbus_build();
+
+            _twr_modbus._sent = 0;
+
+            _twr_modbus._state = TWR_MODBUS_STATE_TRANSMIT;
+        }
+        // Falls through
+        case TWR_MODBUS_STATE_TRANSMIT:
+        {
+            // Whole frame goes in one burst when it fits into FIFO, longer one is continued when FIFO is drained
+            size_t length = _twr_modbus._length - _twr_modbus._sent;
+
+            if (length > _TWR_MODBUS_FIFO_SIZE)
+            {
+                length = _TWR_MODBUS_FIFO_SIZE;
+            }
+
+            if (twr_module_rs485_write(_twr_modbus._frame + _twr_modbus._sent, length) != length)
+            {
+                _twr_modbus_finish(TWR_MODBUS_RESULT_ERROR);
+
+                return;
+            }
+
+            _twr_modbus._sent += length;
+
+            if (_twr_modbus._sent < _twr_modbus._length)
+            {
+                twr_scheduler_plan_current_from_now(_twr_modbus_characters_ms(length));
+
+                return;
+            }
+
+            twr_tick_t transmit = _twr_modbus_characters_ms(length);
+
+            if (_twr_modbus._head->slave == 0)
+            {
+                _twr_modbus._tick_silence = twr_tick_get() + transmit + _twr_modbus._silence;
+
+                _twr_modbus_finish(TWR_MODBUS_RESULT_OK);
+
+                return;
+            }
+
+            _twr_modbus._length = 0;
+
+            _twr_modbus._tick_timeout = twr_tick_get() + transmit + _twr_modbus._timeout;
+
+            _twr_modbus._state = TWR_MODBUS_STATE_RECEIVE;
+
+            // The first look is when complete response can be there
+            twr_scheduler_plan_current_from_now(transmit + _twr_modbus_characters_ms(_twr_modbus._expected));
+
+            return;
+        }
+        case TWR_MODBUS_STATE_RECEIVE:
+        {
+            bool rx_timeout;
+
+            // RX timeout is taken before FIFO is emptied, reading clears it
+            if (!twr_module_rs485_get_rx_timeout(&rx_timeout))
+            {
+                _twr_modbus_finish(TWR_MODBUS_RESULT_ERROR);
+
+                return;
+            }
+
+            _twr_modbus._length += twr_module_rs485_read(_twr_modbus._frame + _twr_modbus._length, sizeof(_twr_modbus._frame) - _twr_modbus._length, 0);
+
+            if (_twr_modbus._length >= 2 && (_twr_modbus._frame[1] & 0x80) != 0)
+            {
+                _twr_modbus._expected = _TWR_MODBUS_EXCEPTION_LENGTH;
+            }
+
+            _twr_modbus._tick_silence = twr_tick_get() + _twr_modbus._silence;
+
+            if (_twr_modbus._length >= _twr_modbus._expected)
+            {
+                _twr_modbus_finish(_twr_modbus_check());
+
+                return;
+            }
+
+            if (rx_timeout && _twr_modbus._length != 0)
+            {
+                _twr_modbus_finish(TWR_MODBUS_RESULT_FRAME);
+
+                return;
+            }
+
+            if (twr_tick_get() >= _twr_modbus._tick_timeout)
+            {
+                _twr_modbus_finish(_twr_modbus._length == 0 ? TWR_MODBUS_RESULT_TIMEOUT : TWR_MODBUS_RESULT_FRAME);
+
+                return;
+            }
+
+            twr_scheduler_plan_current_from_now(_twr_modbus_characters_ms(_twr_modbus._expected - _twr_modbus._length));
+
+            return;
+        }
+        default:
+        {
+            _twr_modbus._state = TWR_MODBUS_STATE_IDLE;
+
+            return;
+        }
+    }
+}
+
+static void _twr_modbus_coalesce(void)
+{
+    twr_modbus_request_t *head = _twr_modbus._head;
+
+    _twr_modbus._last = head;
+    _twr_modbus._address = head->address;
+    _twr_modbus._count = head->count;
+
+    if (head->function != TWR_MODBUS_FUNCTION_READ_HOLDING_REGISTERS && head->function != TWR_MODBUS_FUNCTION_READ_INPUT_REGISTERS)
+    {
+        return;
+    }
+
+    for (twr_modbus_request_t *request = head->_next; request != NULL; request = request->_next)
+    {
+        if (request->slave != head->slave || request->function != head->function)
+        {
+            break;
+        }
+
+        uint32_t start = _twr_modbus._address;
+        uint32_t end = start + _twr_modbus._count;
+
+        // Ranges have to touch or overlap
+        if (request->address > end || request->address + request->count < start)
+        {
+            break;
+        }
+
+        if (request->address < start)
+        {
+            start = request->address;
+        }
+
+        if (request->address + request->count > end)
+        {
+            end = request->address + request->count;
+        }
+
+        if (end - start > TWR_MODBUS_READ_COUNT_MAX)
+        {
+            break;
+        }
+
+        _twr_modbus._last = request;
+        _twr_modbus._address = start;
+        _twr_modbus._count = end - start;
+    }
+}
+
+static void _twr_modbus_build(void)
+{
+    twr_modbus_request_t *head = _twr_modbus._head;
+    uint8_t *frame = _twr_modbus._frame;
+    size_t length = 0;
+
+    frame[length++] = head->slave;
+    frame[length++] = head->function;
+    frame[length++] = _twr_modbus._address >> 8;
+    frame[length++] = _twr_modbus._address;
+
+    switch (head->function)
+    {
+        case TWR_MODBUS_FUNCTION_READ_HOLDING_REGISTERS:
+        case TWR_MODBUS_FUNCTION_READ_INPUT_REGISTERS:
+        {
+            frame[length++] = _twr_modbus._count >> 8;
+            frame[length++] = _twr_modbus._count;
+
+            _twr_modbus._expected = 5 + 2 * _twr_modbus._count;
+
+            break;
+        }
+        case TWR_MODBUS_FUNCTION_WRITE_SINGLE_REGISTER:
+        {
+            frame[length++] = head->registers[0] >> 8;
+            frame[length++] = head->registers[0];
+
+            _twr_modbus._expected = 8;
+
+            break;
+        }
+        case TWR_MODBUS_FUNCTION_WRITE_MULTIPLE_REGISTERS:
+        default:
+        {
+            frame[length++] = head->count >> 8;
+            frame[length++] = head->count;
+            frame[length++] = 2 * head->count;
+
+            for (uint16_t i = 0; i < head->count; i++)
+            {
+                frame[length++] = head->registers[i] >> 8;
+                frame[length++] = head->registers[i];
+            }
+
+            _twr_modbus._expected = 8;
+
+            break;
+        }
+    }
+
+    uint16_t crc = twr_crc16_modbus(frame, length);
+
+    frame[length++] = crc;
+    frame[length++] = crc >> 8;
+
+    _twr_modbus._length = length;
+}
+
+static twr_modbus_result_t _twr_modbus_check(void)
+{
+    twr_modbus_request_t *head = _twr_modbus._head;
+    uint8_t *frame = _twr_modbus._frame;
+
+    if (_twr_modbus._length < _TWR_MODBUS_FRAME_MIN || twr_crc16_modbus(frame, _twr_modbus._length) != 0)
+    {
+        return TWR_MODBUS_RESULT_FRAME;
+    }
+
+    if (frame[0] != head->slave || (frame[1] & 0x7f) != head->function)
+    {
+        return TWR_MODBUS_RESULT_FRAME;
+    }
+
+    if ((frame[1] & 0x80) != 0)
+    {
+        return TWR_MODBUS_RESULT_EXCEPTION;
+    }
+
+    if (_twr_modbus._length != _twr_modbus._expected)
+    {
+        return TWR_MODBUS_RESULT_FRAME;
+    }
+
+    if ((head->function == TWR_MODBUS_FUNCTION_READ_HOLDING_REGISTERS || head->function == TWR_MODBUS_FUNCTION_READ_INPUT_REGISTERS) &&
+            frame[2] != 2 * _twr_modbus._count)
+    {
+        return TWR_MODBUS_RESULT_FRAME;
+    }
+
+    return TWR_MODBUS_RESULT_OK;
+}
+
+static void _twr_modbus_finish(twr_modbus_result_t result)
+{
+    twr_modbus_request_t *last = _twr_modbus._last;
+    twr_modbus_request_t *request;
+
+    if (result == TWR_MODBUS_RESULT_FRAME || result == TWR_MODBUS_RESULT_TIMEOUT)
+    {
+        // Drop whatever arrives late
+        uint8_t buffer[_TWR_MODBUS_FIFO_SIZE];
+
+        twr_module_rs485_read(buffer, sizeof(buffer), 0);
+    }
+
+    _twr_modbus._state = TWR_MODBUS_STATE_IDLE;
+
+    // Requests are unlinked before callbacks, so that callbacks can submit new ones
+    do
+    {
+        request = _twr_modbus._head;
+
+        _twr_modbus._head = request->_next;
+
+        if (_twr_modbus._head == NULL)
+        {
+            _twr_modbus._tail = NULL;
+        }
+
+        if (result == TWR_MODBUS_RESULT_EXCEPTION)
+        {
+            request->exception = _twr_modbus._frame[2];
+        }
+        else if (result == TWR_MODBUS_RESULT_OK &&
+                (request->function == TWR_MODBUS_FUNCTION_READ_HOLDING_REGISTERS || request->function == TWR_MODBUS_FUNCTION_READ_INPUT_REGISTERS))
+        {
+            const uint8_t *data = &_twr_modbus._frame[3 + 2 * (request->address - _twr_modbus._address)];
+
+            for (uint16_t i = 0; i < request->count; i++)
+            {
+                request->registers[i] = (uint16_t) data[2 * i] << 8 | data[2 * i + 1];
+            }
+        }
+
+        if (request->callback != NULL)
+        {
+            request->callback(request, result, request->param);
+        }
+
+    } while (request != last);
+
+    if (_twr_modbus._head != NULL)
+    {
+        twr_scheduler_plan_current_absolute(_twr_modbus._tick_silence);
+    }
+}
+
+static twr_tick_t _twr_modbus_characters_ms(size_t count)
+{
+    twr_tick_t ms = (count * _twr_modbus._character_us + 999) / 1000;
+
+    return ms != 0 ? ms : 1;
+}
@@ -55,6 +55,7 @@ static bool _twr_module_battery_present_test(void);
 static void _twr_module_battery_task(void *param);
 static void _twr_module_battery_adc_event_handler(twr_adc_channel_t channel, twr_adc_event_t event, void *param);
 static void _twr_module_battery_measurement(int state);
+static float _twr_module_battery_adc_value_to_voltage(float adc_value);
 
 void twr_module_battery_init(void)
 {
@@ -128,6 +129,46 @@ bool twr_module_battery_get_voltage(float *voltage)
     return !isnan(_twr_module_battery.voltage);
 }
 
+bool twr_module_battery_measure_voltage(float *voltage)
+{
+    if (_twr_module_battery.measurement_active || _twr_module_battery.state != TWR_MODULE_STATE_MEASURE)
+    {
+        return false;
+    }
+
+    float vdda_voltage;
+    uint16_t result;
+
+    if (!twr_adc_get_vdda_voltage(&vdda_voltage))
+    {
+        return false;
+    }
+
+    _twr_module_battery_measurement(ENABLE);
+
+    bool success = twr_adc_get_value(TWR_ADC_CHANNEL_A0, &result);
+
+    _twr_module_battery_measurement(DISABLE);
+
+    if (!success)
+    {
+        return false;
+    }
+
+    float value = _twr_module_battery_adc_value_to_voltage((result * vdda_voltage) / 65536.f);
+
+    if ((value < _twr_module_battery.valid_min) || (value > _twr_module_battery.valid_max))
+    {
+        return false;
+    }
+
+    _twr_module_battery.voltage = value;
+
+    *voltage = value;
+
+    return true;
+}
+
 bool twr_module_battery_get_charge_level(int *percentage)
 {
     float voltage;
@@ -304,14 +345,7 @@ start:
         }
         case TWR_MODULE_STATE_READ:
         {
-            if (_twr_module_battery.format == TWR_MODULE_BATTERY_FORMAT_MINI)
-            {
-                _twr_module_battery.voltage = _TWR_MODULE_BATTERY_MINI_CALIBRATION(_TWR_MODULE_BATTERY_MINI_RESULT_TO_VOLTAGE(_twr_module_battery.adc_value));
-            }
-            else
-            {
-                _twr_module_battery.voltage = _TWR_MODULE_BATTERY_STANDARD_CALIBRATION(_TWR_MODULE_BATTERY_STANDARD_RESULT_TO_VOLTAGE(_twr_module_battery.adc_value));
-            }
+            _twr_module_battery.voltage = _twr_module_battery_adc_value_to_voltage(_twr_module_battery.adc_value);
 
             _twr_module_battery.measurement_active = false;
 
@@ -405,3 +439,14 @@ static void _twr_module_battery_measurement(int state)
     }
 }
 
+static float _twr_module_battery_adc_value_to_voltage(float adc_value)
+{
+    if (_twr_module_battery.format == TWR_MODULE_BATTERY_FORMAT_MINI)
+    {
+        return _TWR_MODULE_BATTERY_MINI_CALIBRATION(_TWR_MODULE_BATTERY_MINI_RESULT_TO_VOLTAGE(adc_value));
+    }
+    else
+    {
+        return _TWR_MODULE_BATTERY_STANDARD_CALIBRATION(_TWR_MODULE_BATTERY_STANDARD_RESULT_TO_VOLTAGE(adc_value));
+    }
+}
@@ -5,6 +5,14 @@
 #include <twr_mpl3115a2.h>
 #include <twr_sht30.h>
 
+// Barometer measures altitude and pressure in sequence, the slowest of all sensors
+#define _TWR_MODULE_CLIMATE_SYNCHRONIZED_READ_DELAY 3000
+
+#define _TWR_MODULE_CLIMATE_THERMOMETER 0x01
+#define _TWR_MODULE_CLIMATE_HYGROMETER 0x02
+#define _TWR_MODULE_CLIMATE_LUX_METER 0x04
+#define _TWR_MODULE_CLIMATE_BAROMETER 0x08
+
 static struct
 {
     void (*event_handler)(twr_module_climate_event_t, void *);
@@ -21,9 +29,20 @@ static struct
         twr_tick_t thermometer;
         twr_tick_t hygrometer;
     } update_interval;
+    struct {
+        twr_scheduler_task_id_t task_id;
+        twr_tick_t interval;
+        uint8_t pending;
+    } synchronized;
 
 } _twr_module_climate;
 
+static void _twr_module_climate_task_synchronized(void *param);
+
+static bool _twr_module_climate_synchronized_clear(uint8_t sensors);
+
+static void _twr_module_climate_synchronized_complete(bool cleared);
+
 static void _twr_module_climate_tmp112_event_handler(twr_tmp112_t *self, twr_tmp112_event_t event, void *event_param);
 
 static void _twr_module_climate_sht20_event_handler(twr_sht20_t *self, twr_sht20_event_t event, void *event_param);
@@ -41,6 +60,9 @@ void twr_module_climate_init(void)
     _twr_module_climate.update_interval.thermometer = TWR_TICK_INFINITY;
     _twr_module_climate.update_interval.hygrometer = TWR_TICK_INFINITY;
 
+    _twr_module_climate.synchronized.task_id = twr_scheduler_register(_twr_module_climate_task_synchronized, NULL, TWR_TICK_INFINITY);
+    _twr_module_climate.synchronized.interval = TWR_TICK_INFINITY;
+
     twr_tmp112_init(&_twr_module_climate.tmp112, TWR_I2C_I2C0, 0x48);
     twr_tmp112_set_event_handler(&_twr_module_climate.tmp112, _twr_module_climate_tmp112_event_handler, NULL);
 
@@ -110,6 +132,24 @@ void twr_module_climate_set_update_interval_barometer(twr_tick_t interval)
     twr_mpl3115a2_set_update_interval(&_twr_module_climate.mpl3115a2, interval);
 }
 
+void twr_module_climate_set_update_interval_synchronized(twr_tick_t interval)
+{
+    _twr_module_climate.synchronized.interval = interval;
+
+    if (interval == TWR_TICK_INFINITY)
+    {
+        _twr_module_climate.synchronized.pending = 0;
+
+        twr_scheduler_plan_absolute(_twr_module_climate.synchronized.task_id, TWR_TICK_INFINITY);
+    }
+    else
+    {
+        twr_module_climate_set_update_interval_all_sensors(TWR_TICK_INFINITY);
+
+        twr_scheduler_plan_now(_twr_module_climate.synchronized.task_id);
+    }
+}
+
 bool twr_module_climate_measure_all_sensors(void)
 {
     bool ret = true;
@@ -212,6 +252,8 @@ static void _twr_module_climate_tmp112_event_handler(twr_tmp112_t *self, twr_tmp
     (void) self;
     (void) event_param;
 
+    bool synchronized = _twr_module_climate_synchronized_clear(_TWR_MODULE_CLIMATE_THERMOMETER);
+
     if (_twr_module_climate.event_handler == NULL)
     {
         return;
@@ -219,12 +261,16 @@ static void _twr_module_climate_tmp112_event_handler(twr_tmp112_t *self, twr_tmp
 
     if (event == TWR_TMP112_EVENT_UPDATE)
     {
-        _twr_module_climate.event_handler(TWR_MODULE_CLIMATE_EVENT_UPDATE_THERMOMETER, _twr_module_climate.event_param);
+        if (!synchronized)
+        {
+            _twr_module_climate.event_handler(TWR_MODULE_CLIMATE_EVENT_UPDATE_THERMOMETER, _twr_module_climate.event_param);
+        }
     }
     else if (event == TWR_TMP112_EVENT_ERROR)
     {
         _twr_module_climate.event_handler(TWR_MODULE_CLIMATE_EVENT_ERROR_THERMOMETER, _twr_module_climate.event_param);
     }
+    _twr_module_climate_synchronized_complete(synchronized);
 }
 
 static void _twr_module_climate_sht20_event_handler(twr_sht20_t *self, twr_sht20_event_t event, void *event_param)
@@ -232,6 +278,8 @@ static void _twr_module_climate_sht20_event_handler(twr_sht20_t *self, twr_sht20
     (void) self;
     (void) event_param;
 
+    bool synchronized = _twr_module_climate_synchronized_clear(event == TWR_SHT20_EVENT_ERROR ? _TWR_MODULE_CLIMATE_THERMOMETER | _TWR_MODULE_CLIMATE_HYGROMETER : _TWR_MODULE_CLIMATE_HYGROMETER);
+
     if (_twr_module_climate.event_handler == NULL)
     {
         return;
@@ -239,7 +287,10 @@ static void _twr_module_climate_sht20_event_handler(twr_sht20_t *self, twr_sht20
 
     if (event == TWR_SHT20_EVENT_UPDATE)
     {
-        _twr_module_climate.event_handler(TWR_MODULE_CLIMATE_EVENT_UPDATE_HYGROMETER, _twr_module_climate.event_param);
+        if (!synchronized)
+        {
+            _twr_module_climate.event_handler(TWR_MODULE_CLIMATE_EVENT_UPDATE_HYGROMETER, _twr_module_climate.event_param);
+        }
     }
     else if (event == TWR_SHT20_EVENT_ERROR)
     {
@@ -254,6 +305,7 @@ static void _twr_module_climate_sht20_event_handler(twr_sht20_t *self, twr_sht20
 
         _twr_module_climate.event_handler(TWR_MODULE_CLIMATE_EVENT_ERROR_HYGROMETER, _twr_module_climate.event_param);
     }
+    _twr_module_climate_synchronized_complete(synchronized);
 }
 
 static void _twr_module_climate_sht30_event_handler(twr_sht30_t *self, twr_sht30_event_t event, void *event_param)
@@ -261,6 +313,8 @@ static void _twr_module_climate_sht30_event_handler(twr_sht30_t *self, twr_sht30
     (void) self;
     (void) event_param;
 
+    bool synchronized = _twr_module_climate_synchronized_clear(_TWR_MODULE_CLIMATE_THERMOMETER | _TWR_MODULE_CLIMATE_HYGROMETER);
+
     if (_twr_module_climate.event_handler == NULL)
     {
         return;
@@ -268,8 +322,11 @@ static void _twr_module_climate_sht30_event_handler(twr_sht30_t *self, twr_sht30
 
     if (event == TWR_SHT30_EVENT_UPDATE)
     {
-        _twr_module_climate.event_handler(TWR_MODULE_CLIMATE_EVENT_UPDATE_THERMOMETER, _twr_module_climate.event_param);
-        _twr_module_climate.event_handler(TWR_MODULE_CLIMATE_EVENT_UPDATE_HYGROMETER, _twr_module_climate.event_param);
+        if (!synchronized)
+        {
+            _twr_module_climate.event_handler(TWR_MODULE_CLIMATE_EVENT_UPDATE_THERMOMETER, _twr_module_climate.event_param);
+            _twr_module_climate.event_handler(TWR_MODULE_CLIMATE_EVENT_UPDATE_HYGROMETER, _twr_module_climate.event_param);
+        }
     }
     else if (event == TWR_SHT30_EVENT_ERROR)
     {
@@ -288,6 +345,7 @@ static void _twr_module_climate_sht30_event_handler(twr_sht30_t *self, twr_sht30
         _twr_module_climate.event_handler(TWR_MODULE_CLIMATE_EVENT_ERROR_THERMOMETER, _twr_module_climate.event_param);
         _twr_module_climate.event_handler(TWR_MODULE_CLIMATE_EVENT_ERROR_HYGROMETER, _twr_module_climate.event_param);
     }
+    _twr_module_climate_synchronized_complete(synchronized);
 }
 
 static void _twr_module_climate_opt3001_event_handler(twr_opt3001_t *self, twr_opt3001_event_t event, void *event_param)
@@ -295,6 +353,8 @@ static void _twr_module_climate_opt3001_event_handler(twr_opt3001_t *self, twr_o
     (void) self;
     (void) event_param;
 
+    bool synchronized = _twr_module_climate_synchronized_clear(_TWR_MODULE_CLIMATE_LUX_METER);
+
     if (_twr_module_climate.event_handler == NULL)
     {
         return;
@@ -302,12 +362,16 @@ static void _twr_module_climate_opt3001_event_handler(twr_opt3001_t *self, twr_o
 
     if (event == TWR_OPT3001_EVENT_UPDATE)
     {
-        _twr_module_climate.event_handler(TWR_MODULE_CLIMATE_EVENT_UPDATE_LUX_METER, _twr_module_climate.event_param);
+        if (!synchronized)
+        {
+            _twr_module_climate.event_handler(TWR_MODULE_CLIMATE_EVENT_UPDATE_LUX_METER, _twr_module_climate.event_param);
+        }
     }
     else if (event == TWR_OPT3001_EVENT_ERROR)
     {
         _twr_module_climate.event_handler(TWR_MODULE_CLIMATE_EVENT_ERROR_LUX_METER, _twr_module_climate.event_param);
     }
+    _twr_module_climate_synchronized_complete(synchronized);
 }
 
 static void _twr_module_climate_mpl3115a2_event_handler(twr_mpl3115a2_t *self, twr_mpl3115a2_event_t event, void *event_param)
@@ -315,6 +379,8 @@ static void _twr_module_climate_mpl3115a2_event_handler(twr_mpl3115a2_t *self, t
     (void) self;
     (void) event_param;
 
+    bool synchronized = _twr_module_climate_synchronized_clear(_TWR_MODULE_CLIMATE_BAROMETER);
+
     if (_twr_module_climate.event_handler == NULL)
     {
         return;
@@ -322,10 +388,69 @@ static void _twr_module_climate_mpl3115a2_event_handler(twr_mpl3115a2_t *self, t
 
     if (event == TWR_MPL3115A2_EVENT_UPDATE)
     {
-        _twr_module_climate.event_handler(TWR_MODULE_CLIMATE_EVENT_UPDATE_BAROMETER, _twr_module_climate.event_param);
+        if (!synchronized)
+        {
+            _twr_module_climate.event_handler(TWR_MODULE_CLIMATE_EVENT_UPDATE_BAROMETER, _twr_module_climate.event_param);
+        }
     }
     else if (event == TWR_MPL3115A2_EVENT_ERROR)
     {
         _twr_module_climate.event_handler(TWR_MODULE_CLIMATE_EVENT_ERROR_BAROMETER, _twr_module_climate.event_param);
     }
+    _twr_module_climate_synchronized_complete(synchronized);
+}
+
+static void _twr_module_climate_task_synchronized(void *param)
+{
+    (void) param;
+
+    // Cycle which is not finished yet is abandoned
+    _twr_module_climate.synchronized.pending = _TWR_MODULE_CLIMATE_THERMOMETER | _TWR_MODULE_CLIMATE_HYGROMETER | _TWR_MODULE_CLIMATE_LUX_METER | _TWR_MODULE_CLIMATE_BAROMETER;
+
+    twr_tick_t tick_read = twr_tick_get() + _TWR_MODULE_CLIMATE_SYNCHRONIZED_READ_DELAY;
+
+    if (_twr_module_climate.revision == TWR_MODULE_CLIMATE_REVISION_R1)
+    {
+        twr_tmp112_measure(&_twr_module_climate.tmp112);
+        twr_sensor_hold_read(&_twr_module_climate.tmp112._sensor, tick_read);
+
+        twr_sht20_measure(&_twr_module_climate.sht._20);
+    }
+    else
+    {
+        twr_sht30_measure(&_twr_module_climate.sht._30);
+        twr_sensor_hold_read(&_twr_module_climate.sht._30._sensor, tick_read);
+    }
+
+    twr_opt3001_measure(&_twr_module_climate.opt3001);
+    twr_sensor_hold_read(&_twr_module_climate.opt3001._sensor, tick_read);
+
+    twr_mpl3115a2_measure(&_twr_module_climate.mpl3115a2);
+
+    twr_scheduler_plan_current_relative(_twr_module_climate.synchronized.interval);
+}
+
+static bool _twr_module_climate_synchronized_clear(uint8_t sensors)
+{
+    if ((_twr_module_climate.synchronized.pending & sensors) == 0)
+    {
+        return false;
+    }
+
+    _twr_module_climate.synchronized.pending &= ~sensors;
+
+    return true;
+}
+
+static void _twr_module_climate_synchronized_complete(bool cleared)
+{
+    if (!cleared || _twr_module_climate.synchronized.pending != 0)
+    {
+        return;
+    }
+
+    if (_twr_module_climate.event_handler != NULL)
+    {
+        _twr_module_climate.event_handler(TWR_MODULE_CLIMATE_EVENT_UPDATE_ALL_SENSORS, _twr_module_climate.event_param);
+    }
 }
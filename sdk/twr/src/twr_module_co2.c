@@ -90,6 +90,16 @@ void twr_module_co2_calibration(twr_lp8_calibration_t calibration)
     twr_lp8_calibration(&_twr_module_co2.sensor, calibration);
 }
 
+void twr_module_co2_set_state_key(uint16_t key)
+{
+    twr_lp8_set_state_key(&_twr_module_co2.sensor, key);
+}
+
+void twr_module_co2_set_charge_hold(bool hold)
+{
+    twr_lp8_set_charge_hold(&_twr_module_co2.sensor, hold);
+}
+
 static bool _twr_module_co2_init(void)
 {
     if (!twr_tca9534a_init(&_twr_module_co2.tca9534a, TWR_I2C_I2C0, _TWR_MODULE_CO2_I2C_GPIO_EXPANDER_ADDRESS))
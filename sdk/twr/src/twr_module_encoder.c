@@ -12,12 +12,21 @@ static struct
     void (*event_handler)(twr_module_encoder_event_t, void *);
     void *event_param;
     twr_button_t button;
-    int increment;
+    int steps;
     int increment_shadow;
     int samples;
 
 } _twr_module_encoder;
 
+// Quarter steps indexed by previous and current state of P4 (bit 0) and P5 (bit 1), 0 for no change or skipped state
+static const int8_t _twr_module_encoder_quarter[16] =
+{
+     0, -1,  1,  0,
+     1,  0,  0, -1,
+    -1,  0,  0,  1,
+     0,  1, -1,  0
+};
+
 static void _twr_module_encoder_task(void *param);
 
 static void _twr_module_encoder_exti_handler(twr_exti_line_t line, void *param);
@@ -96,8 +105,9 @@ static void _twr_module_encoder_task(void *param)
         // Disable interrupts
         twr_irq_disable();
 
-        _twr_module_encoder.increment_shadow = _twr_module_encoder.increment;
-        _twr_module_encoder.increment = 0;
+        // One detent is the whole cycle of four quarter steps, the rest stays for the next run
+        _twr_module_encoder.increment_shadow = _twr_module_encoder.steps / 4;
+        _twr_module_encoder.steps %= 4;
 
         // Enable interrupts
         twr_irq_enable();
@@ -149,16 +159,11 @@ static void _twr_module_encoder_exti_handler(twr_exti_line_t line, void *param)
     _twr_module_encoder.samples |= twr_gpio_get_input(TWR_GPIO_P5) ? 0x2 : 0;
     _twr_module_encoder.samples &= 0xf;
 
-    if (_twr_module_encoder.samples == 0x7)
-    {
-        _twr_module_encoder.increment--;
+    // Every valid transition counts, so edges lost by fast spin do not break the cycle being decoded
+    _twr_module_encoder.steps += _twr_module_encoder_quarter[_twr_module_encoder.samples];
 
-        twr_scheduler_plan_now(_twr_module_encoder.task_id);
-    }
-    else if (_twr_module_encoder.samples == 0xd)
+    if (_twr_module_encoder.steps >= 4 || _twr_module_encoder.steps <= -4)
     {
-        _twr_module_encoder.increment++;
-
         twr_scheduler_plan_now(_twr_module_encoder.task_id);
     }
 }
@@ -63,6 +63,11 @@ void twr_module_gps_set_event_handler(twr_module_gps_event_handler_t event_handl
     _twr_module_gps.event_param = event_param;
 }
 
+void twr_module_gps_set_protocol(twr_sam_m8q_protocol_t protocol)
+{
+    twr_sam_m8q_set_protocol(&_twr_module_gps.sam_m8q, protocol);
+}
+
 void twr_module_gps_start(void)
 {
     twr_sam_m8q_start(&_twr_module_gps.sam_m8q);
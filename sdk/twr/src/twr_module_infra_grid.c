@@ -19,6 +19,11 @@
 #define _TWR_AMG88xx_SCLR 0x05
 #define _TWR_AMG88xx_AVE 0x07
 #define _TWR_AMG88xx_INTHL 0x08
+#define _TWR_AMG88xx_INTHH 0x09
+#define _TWR_AMG88xx_INTLL 0x0a
+#define _TWR_AMG88xx_INTLH 0x0b
+#define _TWR_AMG88xx_IHYSL 0x0c
+#define _TWR_AMG88xx_IHYSH 0x0d
 #define _TWR_AMG88xx_TTHL 0x0e
 #define _TWR_AMG88xx_TTHH 0x0f
 #define _TWR_AMG88xx_INT0 0x10
@@ -38,6 +43,16 @@
 
 static void _twr_module_infra_grid_task_interval(void *param);
 static void _twr_module_infra_grid_task_measure(void *param);
+static bool _twr_module_infra_grid_read_frame(twr_module_infra_grid_t *self);
+static bool _twr_module_infra_grid_write_interrupt(twr_module_infra_grid_t *self);
+static void _twr_module_infra_grid_alert_interrupt(twr_exti_line_t line, void *param);
+
+// Pixels are 12-bit two's complement, thermistor is 12-bit sign and magnitude
+#define _TWR_MODULE_INFRA_GRID_PIXEL(raw) ((int16_t) ((uint16_t) (raw) << 4) >> 4)
+#define _TWR_MODULE_INFRA_GRID_THERMISTOR(l, h) ((((h) & 0x08) ? -1 : 1) * (int16_t) ((l) | ((h) & 0x07) << 8))
+
+#define _TWR_MODULE_INFRA_GRID_RAW_MIN -2048
+#define _TWR_MODULE_INFRA_GRID_RAW_MAX 2047
 
 void twr_module_infra_grid_init(twr_module_infra_grid_t *self)
 {
@@ -96,49 +111,126 @@ bool twr_module_infra_grid_measure(twr_module_infra_grid_t *self)
 
 float twr_module_infra_grid_read_thermistor(twr_module_infra_grid_t *self)
 {
-    (void) self;
-    int8_t temperature[2];
+    uint8_t temperature[2];
+
+    twr_i2c_memory_transfer_t transfer;
+
+    transfer.device_address = self->_i2c_address;
+    transfer.memory_address = _TWR_AMG88xx_TTHL;
+    transfer.buffer = temperature;
+    transfer.length = sizeof(temperature);
 
-    twr_i2c_memory_read_8b(self->_i2c_channel, self->_i2c_address, _TWR_AMG88xx_TTHL, (uint8_t *) &temperature[0]);
-    twr_i2c_memory_read_8b(self->_i2c_channel, self->_i2c_address, _TWR_AMG88xx_TTHH, (uint8_t *) &temperature[1]);
+    if (!twr_i2c_memory_read(self->_i2c_channel, &transfer))
+    {
+        return NAN;
+    }
 
-    return (temperature[0] | temperature[1] << 8) * 0.0625f;
+    return _TWR_MODULE_INFRA_GRID_THERMISTOR(temperature[0], temperature[1]) * 0.0625f;
 }
 
 bool twr_module_infra_grid_read_values(twr_module_infra_grid_t *self)
 {
-    twr_i2c_memory_transfer_t transfer;
+    return _twr_module_infra_grid_read_frame(self);
+}
 
-    transfer.device_address = self->_i2c_address;
-    transfer.memory_address = _TWR_AMG88xx_T01L;
-    transfer.buffer = self->_sensor_data;
-    transfer.length = 64 * 2;
+bool twr_module_infra_grid_get_temperatures_celsius(twr_module_infra_grid_t *self, float *values)
+{
+    if (!self->_temperature_valid)
+    {
+        return false;
+    }
 
-    return twr_i2c_memory_read(self->_i2c_channel, &transfer);
+    for (int i = 0; i < 64; i++)
+    {
+        values[i] = self->_sensor_data[i] * 0.25f;
+    }
+
+    return true;
 }
 
-bool twr_module_infra_grid_get_temperatures_celsius(twr_module_infra_grid_t *self, float *values)
+bool twr_module_infra_grid_get_temperatures_raw(twr_module_infra_grid_t *self, int16_t *values)
 {
     if (!self->_temperature_valid)
     {
         return false;
     }
 
-    for (int i = 0; i < 64 ;i++)
+    memcpy(values, self->_sensor_data, sizeof(self->_sensor_data));
+
+    return true;
+}
+
+bool twr_module_infra_grid_get_thermistor_raw(twr_module_infra_grid_t *self, int16_t *raw)
+{
+    if (!self->_temperature_valid)
     {
-        float temperature;
-        int16_t temporary_data = self->_sensor_data[i];
+        return false;
+    }
 
-        if (temporary_data > 0x200)
-        {
-            temperature = (-temporary_data + 0xfff) * -0.25f;
-        }
-        else
-        {
-            temperature = temporary_data * 0.25f;
-        }
+    *raw = self->_thermistor;
+
+    return true;
+}
+
+bool twr_module_infra_grid_set_alert(twr_module_infra_grid_t *self, twr_exti_line_t line, int16_t low, int16_t high, int16_t hysteresis)
+{
+    if (low < _TWR_MODULE_INFRA_GRID_RAW_MIN || high > _TWR_MODULE_INFRA_GRID_RAW_MAX || low >= high ||
+        hysteresis < 0 || hysteresis > _TWR_MODULE_INFRA_GRID_RAW_MAX)
+    {
+        return false;
+    }
+
+    if (self->_alert_active)
+    {
+        twr_exti_unregister(self->_alert_line);
+    }
+
+    self->_alert_active = true;
+    self->_alert_line = line;
+    self->_alert_low = low;
+    self->_alert_high = high;
+    self->_alert_hysteresis = hysteresis;
+
+    // Sensor has to run to evaluate interrupt table
+    self->_cmd_sleep = false;
+    self->_state = TWR_MODULE_INFRA_GRID_STATE_INITIALIZE;
+
+    twr_exti_register_deferred(line, TWR_EXTI_EDGE_FALLING, _twr_module_infra_grid_alert_interrupt, self);
+
+    twr_module_infra_grid_measure(self);
+
+    return true;
+}
+
+void twr_module_infra_grid_clear_alert(twr_module_infra_grid_t *self)
+{
+    if (!self->_alert_active)
+    {
+        return;
+    }
+
+    twr_exti_unregister(self->_alert_line);
+
+    self->_alert_active = false;
+
+    self->_cmd_sleep = true;
+    self->_state = TWR_MODULE_INFRA_GRID_STATE_INITIALIZE;
+
+    twr_module_infra_grid_measure(self);
+}
+
+bool twr_module_infra_grid_get_alert_pixels(twr_module_infra_grid_t *self, uint64_t *mask)
+{
+    if (!self->_temperature_valid)
+    {
+        return false;
+    }
+
+    *mask = 0;
 
-        values[i] = temperature;
+    for (int i = 7; i >= 0; i--)
+    {
+        *mask = *mask << 8 | self->_interrupt_table[i];
     }
 
     return true;
@@ -205,6 +297,9 @@ static void _twr_module_infra_grid_task_measure(void *param)
                 self->_enable_sleep = self->_cmd_sleep;
             }
 
+            // Sensor running without sleep is configured by the first measurement
+            self->_awake = false;
+
             if (self->_enable_sleep)
             {
                 if (self->_revision == TWR_MODULE_INFRA_GRID_REVISION_R1_0)
@@ -224,23 +319,6 @@ static void _twr_module_infra_grid_task_measure(void *param)
                     }
                 }
             }
-            else
-            {
-                // Set 10 FPS
-                if (!twr_i2c_memory_write_8b (self->_i2c_channel, self->_i2c_address, _TWR_AMG88xx_FPSC, 0x00))
-                {
-                    goto start;
-                }
-
-                // Diff interrpt mode, INT output reactive
-                twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, _TWR_AMG88xx_INTC, 0x00);
-                // Moving average output mode active
-                twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, _TWR_AMG88xx_AVG, 0x50);
-                twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, _TWR_AMG88xx_AVG, 0x45);
-                twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, _TWR_AMG88xx_AVG, 0x57);
-                twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, _TWR_AMG88xx_AVE, 0x20);
-                twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, _TWR_AMG88xx_AVG, 0x00);
-            }
 
             self->_state = TWR_MODULE_INFRA_GRID_STATE_MODE_CHANGE; //TWR_MODULE_INFRA_GRID_STATE_MEASURE;
 
@@ -256,7 +334,7 @@ static void _twr_module_infra_grid_task_measure(void *param)
         case TWR_MODULE_INFRA_GRID_STATE_MODE_CHANGE:
         {
             // Skip wakeup commands in case of fast reading
-            if (!self->_enable_sleep)
+            if (!self->_enable_sleep && self->_awake)
             {
                 self->_state = TWR_MODULE_INFRA_GRID_STATE_READ;
                 goto start;
@@ -332,8 +410,11 @@ static void _twr_module_infra_grid_task_measure(void *param)
                 goto start;
             }
 
-            // Diff interrpt mode, INT output reactive
-            twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, _TWR_AMG88xx_INTC, 0x00);
+            if (!_twr_module_infra_grid_write_interrupt(self))
+            {
+                goto start;
+            }
+
             // Moving average output mode active
             twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, _TWR_AMG88xx_AVG, 0x50);
             twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, _TWR_AMG88xx_AVG, 0x45);
@@ -341,6 +422,7 @@ static void _twr_module_infra_grid_task_measure(void *param)
             twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, _TWR_AMG88xx_AVE, 0x20);
             twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, _TWR_AMG88xx_AVG, 0x00);
 
+            self->_awake = true;
             self->_state = TWR_MODULE_INFRA_GRID_STATE_READ;
 
             twr_scheduler_plan_current_from_now(_TWR_MODULE_INFRA_GRID_DELAY_MEASUREMENT);
@@ -351,20 +433,25 @@ static void _twr_module_infra_grid_task_measure(void *param)
         {
             self->_state = TWR_MODULE_INFRA_GRID_STATE_ERROR;
 
-            twr_i2c_memory_transfer_t transfer;
-            transfer.device_address = self->_i2c_address;
-            transfer.memory_address = _TWR_AMG88xx_T01L;
-            transfer.buffer = self->_sensor_data;
-            transfer.length = 64 * 2;
-
-            if (!twr_i2c_memory_read(self->_i2c_channel, &transfer))
+            if (!_twr_module_infra_grid_read_frame(self))
             {
                 goto start;
             }
 
+            // Interrupt flag and table are held until cleared
+            if (self->_alert_active)
+            {
+                if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, _TWR_AMG88xx_SCLR, 0x02))
+                {
+                    goto start;
+                }
+            }
+
             // Enable sleep mode
             if (self->_enable_sleep)
             {
+                self->_awake = false;
+
                 // Sleep Mode
                 if (self->_revision == TWR_MODULE_INFRA_GRID_REVISION_R1_0)
                 {
@@ -393,6 +480,13 @@ static void _twr_module_infra_grid_task_measure(void *param)
             if (self->_event_handler != NULL)
             {
                 self->_event_handler(self, TWR_MODULE_INFRA_GRID_EVENT_UPDATE, self->_event_param);
+
+                uint64_t mask;
+
+                if (self->_alert_active && twr_module_infra_grid_get_alert_pixels(self, &mask) && mask != 0)
+                {
+                    self->_event_handler(self, TWR_MODULE_INFRA_GRID_EVENT_ALERT, self->_event_param);
+                }
             }
 
             // Update sleep flag
@@ -416,3 +510,83 @@ twr_module_infra_grid_revision_t twr_module_infra_grid_get_revision(twr_module_i
 {
     return self->_revision;
 }
+
+static bool _twr_module_infra_grid_read_frame(twr_module_infra_grid_t *self)
+{
+    // Thermistor is followed by interrupt table
+    uint8_t buffer[_TWR_AMG88xx_INT0 + sizeof(self->_interrupt_table) - _TWR_AMG88xx_TTHL];
+
+    twr_i2c_memory_transfer_t transfer;
+
+    transfer.device_address = self->_i2c_address;
+    transfer.memory_address = _TWR_AMG88xx_TTHL;
+    transfer.buffer = buffer;
+    transfer.length = sizeof(buffer);
+
+    if (!twr_i2c_memory_read(self->_i2c_channel, &transfer))
+    {
+        return false;
+    }
+
+    transfer.memory_address = _TWR_AMG88xx_T01L;
+    transfer.buffer = self->_sensor_data;
+    transfer.length = sizeof(self->_sensor_data);
+
+    if (!twr_i2c_memory_read(self->_i2c_channel, &transfer))
+    {
+        return false;
+    }
+
+    self->_thermistor = _TWR_MODULE_INFRA_GRID_THERMISTOR(buffer[0], buffer[1]);
+
+    memcpy(self->_interrupt_table, &buffer[_TWR_AMG88xx_INT0 - _TWR_AMG88xx_TTHL], sizeof(self->_interrupt_table));
+
+    for (int i = 0; i < 64; i++)
+    {
+        self->_sensor_data[i] = _TWR_MODULE_INFRA_GRID_PIXEL(self->_sensor_data[i]);
+    }
+
+    return true;
+}
+
+static bool _twr_module_infra_grid_write_interrupt(twr_module_infra_grid_t *self)
+{
+    if (!self->_alert_active)
+    {
+        // Interrupt disabled
+        return twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, _TWR_AMG88xx_INTC, 0x00);
+    }
+
+    uint8_t buffer[6];
+
+    buffer[_TWR_AMG88xx_INTHL - _TWR_AMG88xx_INTHL] = self->_alert_high;
+    buffer[_TWR_AMG88xx_INTHH - _TWR_AMG88xx_INTHL] = (self->_alert_high >> 8) & 0x0f;
+    buffer[_TWR_AMG88xx_INTLL - _TWR_AMG88xx_INTHL] = self->_alert_low;
+    buffer[_TWR_AMG88xx_INTLH - _TWR_AMG88xx_INTHL] = (self->_alert_low >> 8) & 0x0f;
+    buffer[_TWR_AMG88xx_IHYSL - _TWR_AMG88xx_INTHL] = self->_alert_hysteresis;
+    buffer[_TWR_AMG88xx_IHYSH - _TWR_AMG88xx_INTHL] = (self->_alert_hysteresis >> 8) & 0x0f;
+
+    twr_i2c_memory_transfer_t transfer;
+
+    transfer.device_address = self->_i2c_address;
+    transfer.memory_address = _TWR_AMG88xx_INTHL;
+    transfer.buffer = buffer;
+    transfer.length = sizeof(buffer);
+
+    if (!twr_i2c_memory_write(self->_i2c_channel, &transfer))
+    {
+        return false;
+    }
+
+    // Absolute value interrupt mode, INT output active
+    return twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, _TWR_AMG88xx_INTC, 0x03);
+}
+
+static void _twr_module_infra_grid_alert_interrupt(twr_exti_line_t line, void *param)
+{
+    (void) line;
+
+    twr_module_infra_grid_t *self = param;
+
+    twr_module_infra_grid_measure(self);
+}
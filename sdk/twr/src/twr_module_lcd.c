@@ -29,6 +29,7 @@ typedef struct twr_module_lcd_t
 
     twr_button_t button_left;
     twr_button_t button_right;
+    twr_button_group_t button_group;
 
 } twr_module_lcd_t;
 
@@ -61,6 +62,8 @@ static void _twr_module_lcd_button_init(twr_button_t *self);
 
 static int _twr_module_lcd_button_get_input(twr_button_t *self);
 
+static uint32_t _twr_module_lcd_button_get_input_mask(twr_button_t *self);
+
 void twr_module_lcd_init()
 {
 	_twr_module_lcd_tca9534a_init();
@@ -148,27 +151,7 @@ void twr_module_lcd_draw_circle(int x0, int y0, int radius, bool color)
 
 void twr_module_lcd_draw_image(int left, int top, const twr_image_t *img)
 {
-    uint8_t line;
-	uint8_t row;
-    uint8_t bytes_per_row = img->width / 8;
-
-    if(img->width % 8 != 0)
-    {
-        bytes_per_row++;
-    }
-
-    twr_tick_t start = twr_tick_get();
-
-        for (row = 0; row < img->height; row++) {
-            for (line = 0; line < img->width; line++) {
-                uint32_t byte_offset = line / 8 + row * bytes_per_row;
-                uint32_t bit = line % 8;
-                twr_gfx_draw_pixel(&_twr_module_lcd.gfx, line + left, row + top, (img->data[byte_offset]) & (1 << bit));
-			}
-		}
-    volatile twr_tick_t duration = twr_tick_get() - start;
-    (void)duration;
-
+    twr_gfx_draw_image(&_twr_module_lcd.gfx, left, top, img->data, img->width, img->height);
 }
 
 bool twr_module_lcd_update(void)
@@ -176,6 +159,11 @@ bool twr_module_lcd_update(void)
     return twr_gfx_update(&_twr_module_lcd.gfx);
 }
 
+bool twr_module_lcd_set_double_buffer(uint8_t *buffer)
+{
+    return twr_ls013b7dh03_set_double_buffer(&_twr_module_lcd.ls013b7dh03, buffer);
+}
+
 void twr_module_lcd_set_font(const twr_font_t *font)
 {
     twr_gfx_set_font(&_twr_module_lcd.gfx, font);
@@ -254,6 +242,11 @@ void twr_module_lcd_set_event_handler(void (*event_handler)(twr_module_lcd_event
     twr_button_init_virtual(&_twr_module_lcd.button_left, 0, lcdButtonDriver, 0);
     twr_button_init_virtual(&_twr_module_lcd.button_right, 1, lcdButtonDriver, 0);
 
+    // Both buttons are read from expander in one transaction
+    twr_button_group_init(&_twr_module_lcd.button_group);
+    twr_button_group_add(&_twr_module_lcd.button_group, &_twr_module_lcd.button_left);
+    twr_button_group_add(&_twr_module_lcd.button_group, &_twr_module_lcd.button_right);
+
     twr_button_set_event_handler(&_twr_module_lcd.button_left, _twr_module_lcd_button_event_handler, (int*)0);
     twr_button_set_event_handler(&_twr_module_lcd.button_right, _twr_module_lcd_button_event_handler, (int*)1);
 }
@@ -268,6 +261,7 @@ void twr_module_lcd_set_button_scan_interval(twr_tick_t scan_interval)
 {
     twr_button_set_scan_interval(&_twr_module_lcd.button_left, scan_interval);
     twr_button_set_scan_interval(&_twr_module_lcd.button_right, scan_interval);
+    twr_button_group_set_scan_interval(&_twr_module_lcd.button_group, scan_interval);
 }
 
 void twr_module_lcd_set_button_debounce_time(twr_tick_t debounce_time)
@@ -310,6 +304,7 @@ const twr_button_driver_t *twr_module_lcd_get_button_driver(void)
     {
         .init = _twr_module_lcd_button_init,
         .get_input = _twr_module_lcd_button_get_input,
+        .get_input_mask = _twr_module_lcd_button_get_input_mask,
     };
 
     return &twr_module_lcd_button_driver;
@@ -366,18 +361,14 @@ static void _twr_module_lcd_led_init(twr_led_t *self)
 
 static void _twr_module_lcd_led_on(twr_led_t *self)
 {
-    if (!twr_tca9534a_write_pin(&_twr_module_lcd.tca9534a, _twr_module_lcd_led_pin_lut[self->_channel.virtual], self->_idle_state ? 0 : 1))
-    {
-    	_twr_module_lcd.is_tca9534a_initialized = false;
-    }
+    // Changes of all LEDs within one scheduler pass are written together
+    twr_tca9534a_write_pin_deferred(&_twr_module_lcd.tca9534a, _twr_module_lcd_led_pin_lut[self->_channel.virtual], self->_idle_state ? 0 : 1);
 }
 
 static void _twr_module_lcd_led_off(twr_led_t *self)
 {
-    if (!twr_tca9534a_write_pin(&_twr_module_lcd.tca9534a, _twr_module_lcd_led_pin_lut[self->_channel.virtual], self->_idle_state ? 1 : 0))
-    {
-    	_twr_module_lcd.is_tca9534a_initialized = false;
-    }
+    // Changes of all LEDs within one scheduler pass are written together
+    twr_tca9534a_write_pin_deferred(&_twr_module_lcd.tca9534a, _twr_module_lcd_led_pin_lut[self->_channel.virtual], self->_idle_state ? 1 : 0);
 }
 
 static void _twr_module_lcd_button_init(twr_button_t *self)
@@ -407,3 +398,30 @@ static int _twr_module_lcd_button_get_input(twr_button_t *self)
 
     return state;
 }
+
+static uint32_t _twr_module_lcd_button_get_input_mask(twr_button_t *self)
+{
+    (void) self;
+
+    if (twr_gpio_get_input(TWR_GPIO_BUTTON) == 0)
+    {
+        return 0;
+    }
+
+    uint8_t state;
+
+    if (!twr_tca9534a_read_port(&_twr_module_lcd.tca9534a, &state))
+    {
+        _twr_module_lcd.is_tca9534a_initialized = false;
+        return 0;
+    }
+
+    uint32_t mask = 0;
+
+    for (size_t i = 0; i < sizeof(_twr_module_lcd_button_pin_lut) / sizeof(_twr_module_lcd_button_pin_lut[0]); i++)
+    {
+        mask |= ((state >> (uint8_t) _twr_module_lcd_button_pin_lut[i]) & 0x01) << i;
+    }
+
+    return mask;
+}
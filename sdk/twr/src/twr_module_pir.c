@@ -14,3 +14,8 @@ void twr_module_pir_set_sensitivity(twr_module_pir_t *self, twr_module_pir_sensi
 {
     twr_pyq1648_set_sensitivity(self, (twr_pyq1648_sensitivity_t) sensitivity);
 }
+
+void twr_module_pir_set_wake_on_event(twr_module_pir_t *self)
+{
+    twr_pyq1648_set_wake_on_event(self, TWR_EXTI_LINE_P9);
+}
@@ -5,8 +5,8 @@
 
 #define TWR_MODULE_POWER_PIN_RELAY TWR_GPIO_P0
 
-static uint32_t _twr_module_power_led_strip_dma_buffer_rgbw_144[144 * 4 * 2];
-static uint32_t _twr_module_power_led_strip_dma_buffer_rgb_150[150 * 3 * 2];
+static uint32_t _twr_module_power_led_strip_dma_buffer_rgbw_144[TWR_WS2812B_BUFFER_LENGTH(144, TWR_LED_STRIP_TYPE_RGBW)];
+static uint32_t _twr_module_power_led_strip_dma_buffer_rgb_150[TWR_WS2812B_BUFFER_LENGTH(150, TWR_LED_STRIP_TYPE_RGB)];
 
 const twr_led_strip_buffer_t twr_module_power_led_strip_buffer_rgbw_144 =
 {
@@ -30,7 +30,8 @@ const twr_led_strip_driver_t twr_module_power_led_strip_driver =
     .write = twr_ws2812b_write,
     .set_pixel = twr_ws2812b_set_pixel_from_uint32,
     .set_pixel_rgbw = twr_ws2812b_set_pixel_from_rgb,
-    .is_ready = twr_ws2812b_is_ready
+    .is_ready = twr_ws2812b_is_ready,
+    .set_lut = twr_ws2812b_set_lut
 };
 
 #else
@@ -41,7 +42,8 @@ const twr_led_strip_driver_t twr_module_power_led_strip_driver =
     .write = twr_ws2812b_write,
     .set_pixel = twr_ws2812b_set_pixel_from_uint32_swap_rg,
     .set_pixel_rgbw = twr_ws2812b_set_pixel_from_rgb_swap_rg,
-    .is_ready = twr_ws2812b_is_ready
+    .is_ready = twr_ws2812b_is_ready,
+    .set_lut = twr_ws2812b_set_lut
 };
 
 #endif
@@ -55,6 +55,7 @@ static struct
 } _twr_module_rs485;
 
 static void _twr_module_rs485_async_write_task(void *param);
+static void _twr_module_rs485_irq_event_handler(twr_sc16is740_t *sc16is740, twr_sc16is740_event_t event, void *param);
 static void _twr_module_rs485_async_read_task(void *param);
 
 static void _twr_module_rs485_task_measure(void *param);
@@ -434,6 +435,31 @@ size_t twr_module_rs485_read(uint8_t *buffer, size_t length, twr_tick_t timeout)
     return twr_sc16is740_read(&_twr_module_rs485._sc16is750, buffer, length, timeout);
 }
 
+bool twr_module_rs485_set_irq(twr_exti_line_t line)
+{
+    return twr_sc16is740_set_irq(&_twr_module_rs485._sc16is750, line, _twr_module_rs485_irq_event_handler, NULL);
+}
+
+static void _twr_module_rs485_irq_event_handler(twr_sc16is740_t *sc16is740, twr_sc16is740_event_t event, void *param)
+{
+    (void) sc16is740;
+    (void) param;
+
+    if (event == TWR_SC16IS740_EVENT_RX && _twr_module_rs485._async_read_in_progress)
+    {
+        twr_scheduler_plan_now(_twr_module_rs485._async_read_task_id);
+    }
+    else if (event == TWR_SC16IS740_EVENT_TX && _twr_module_rs485._async_write_in_progress)
+    {
+        twr_scheduler_plan_now(_twr_module_rs485._async_write_task_id);
+    }
+}
+
+bool twr_module_rs485_get_rx_timeout(bool *rx_timeout)
+{
+    return twr_sc16is740_get_rx_timeout(&_twr_module_rs485._sc16is750, rx_timeout);
+}
+
 bool twr_module_rs485_set_baudrate(twr_module_rs485_baudrate_t baudrate)
 {
     return twr_sc16is740_set_baudrate(&_twr_module_rs485._sc16is750, (twr_sc16is740_baudrate_t) baudrate);
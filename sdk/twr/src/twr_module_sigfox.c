@@ -4,11 +4,17 @@ static void _twr_module_sigfox_event_handler_td1207r(twr_td1207r_t *child, twr_t
 
 static void _twr_module_sigfox_event_handler_wssfm10r1at(twr_wssfm10r1at_t *child, twr_wssfm10r1at_event_t event, void *event_param);
 
+static void _twr_module_sigfox_uplink_task(void *param);
+
+#define _TWR_MODULE_SIGFOX_FRAME_SIZE 12
+#define _TWR_MODULE_SIGFOX_UPLINK_RETRY 1000
+
 void twr_module_sigfox_init(twr_module_sigfox_t *self, twr_module_sigfox_revision_t revision)
 {
     memset(self, 0, sizeof(*self));
 
     self->_revision = revision;
+    self->_uplink_interval = 86400000 / TWR_MODULE_SIGFOX_UPLINK_BUDGET;
 
     if (self->_revision == TWR_MODULE_SIGFOX_REVISION_R1)
     {
@@ -51,6 +57,61 @@ bool twr_module_sigfox_send_rf_frame(twr_module_sigfox_t *self, const void *buff
     return twr_wssfm10r1at_send_rf_frame(&self->_modem.wssfm10r1at, buffer, length);
 }
 
+bool twr_module_sigfox_set_uplink_schema(twr_module_sigfox_t *self, const twr_payload_schema_t *schema)
+{
+    size_t length = twr_payload_get_length(schema);
+
+    if (schema->count > TWR_MODULE_SIGFOX_UPLINK_FIELDS_MAX || length == 0 || length > _TWR_MODULE_SIGFOX_FRAME_SIZE)
+    {
+        return false;
+    }
+
+    if (self->_uplink_schema == NULL)
+    {
+        self->_uplink_task_id = twr_scheduler_register(_twr_module_sigfox_uplink_task, self, TWR_TICK_INFINITY);
+    }
+
+    self->_uplink_schema = schema;
+    self->_uplink_pending = false;
+
+    for (size_t i = 0; i < schema->count; i++)
+    {
+        self->_uplink_value[i] = NAN;
+    }
+
+    return true;
+}
+
+void twr_module_sigfox_set_uplink_budget(twr_module_sigfox_t *self, int budget)
+{
+    if (budget > 0)
+    {
+        self->_uplink_interval = 86400000 / budget;
+    }
+}
+
+bool twr_module_sigfox_set_uplink_value(twr_module_sigfox_t *self, size_t field, float value)
+{
+    if (self->_uplink_schema == NULL || field >= self->_uplink_schema->count)
+    {
+        return false;
+    }
+
+    // Superseded value is not sent
+    self->_uplink_value[field] = value;
+
+    if (!self->_uplink_pending)
+    {
+        self->_uplink_pending = true;
+
+        twr_tick_t tick = twr_tick_get() + TWR_MODULE_SIGFOX_UPLINK_MERGE_DELAY;
+
+        twr_scheduler_plan_absolute(self->_uplink_task_id, tick > self->_uplink_tick_next ? tick : self->_uplink_tick_next);
+    }
+
+    return true;
+}
+
 bool twr_module_sigfox_read_device_id(twr_module_sigfox_t *self)
 {
     if (self->_revision == TWR_MODULE_SIGFOX_REVISION_R1)
@@ -101,6 +162,31 @@ bool twr_module_sigfox_continuous_wave(twr_module_sigfox_t *self)
     return twr_wssfm10r1at_continuous_wave(&self->_modem.wssfm10r1at);
 }
 
+static void _twr_module_sigfox_uplink_task(void *param)
+{
+    twr_module_sigfox_t *self = param;
+
+    if (!self->_uplink_pending)
+    {
+        return;
+    }
+
+    uint8_t buffer[_TWR_MODULE_SIGFOX_FRAME_SIZE];
+
+    size_t length = twr_payload_pack(self->_uplink_schema, self->_uplink_value, buffer, sizeof(buffer));
+
+    // Modem is busy with other command
+    if (!twr_module_sigfox_is_ready(self) || !twr_module_sigfox_send_rf_frame(self, buffer, length))
+    {
+        twr_scheduler_plan_current_relative(_TWR_MODULE_SIGFOX_UPLINK_RETRY);
+
+        return;
+    }
+
+    self->_uplink_pending = false;
+    self->_uplink_tick_next = twr_tick_get() + self->_uplink_interval;
+}
+
 static void _twr_module_sigfox_event_handler_td1207r(twr_td1207r_t *child, twr_td1207r_event_t event, void *event_param)
 {
     (void) child;
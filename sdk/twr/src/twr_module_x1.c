@@ -1,3 +1,5 @@
+#define TWR_LOG_MODULE TWR_LOG_MODULE_TOWER
+
 #include <twr_module_x1.h>
 #include <twr_onewire_ds2484.h>
 #include <twr_tca9534a.h>
@@ -12,9 +14,21 @@ static struct
     bool onewire_initialized;
     int onewire_power_semaphore;
 
+    struct
+    {
+        bool (*measure)(void *);
+        void *param;
+
+    } measurement[TWR_MODULE_X1_MEASUREMENT_COUNT];
+
+    int measurement_count;
+    twr_tick_t update_interval;
+    twr_scheduler_task_id_t task_id;
+
 } _twr_module_x1 = { .initialized = false };
 
 static bool _twr_module_x1_set_slpz(void *ctx, bool state);
+static void _twr_module_x1_task(void *param);
 
 bool twr_module_x1_init(void)
 {
@@ -42,6 +56,11 @@ bool twr_module_x1_init(void)
     twr_onewire_ds2484_init(&_twr_module_x1.onewire, &_twr_module_x1.ds2484);
     twr_ds2484_set_slpz_handler(&_twr_module_x1.ds2484, _twr_module_x1_set_slpz, NULL);
 
+    twr_onewire_set_linger(&_twr_module_x1.onewire, TWR_MODULE_X1_ONEWIRE_LINGER);
+
+    _twr_module_x1.update_interval = TWR_TICK_INFINITY;
+    _twr_module_x1.task_id = twr_scheduler_register(_twr_module_x1_task, NULL, TWR_TICK_INFINITY);
+
     _twr_module_x1.initialized = true;
 
     return true;
@@ -52,6 +71,53 @@ twr_onewire_t *twr_module_x1_get_onewire(void)
     return &_twr_module_x1.onewire;
 }
 
+bool twr_module_x1_register_measurement(bool (*measure)(void *), void *param)
+{
+    if (!twr_module_x1_init()) {
+        return false;
+    }
+
+    if (_twr_module_x1.measurement_count >= TWR_MODULE_X1_MEASUREMENT_COUNT) {
+        return false;
+    }
+
+    _twr_module_x1.measurement[_twr_module_x1.measurement_count].measure = measure;
+    _twr_module_x1.measurement[_twr_module_x1.measurement_count].param = param;
+
+    _twr_module_x1.measurement_count++;
+
+    return true;
+}
+
+void twr_module_x1_set_update_interval(twr_tick_t interval)
+{
+    if (!twr_module_x1_init()) {
+        return;
+    }
+
+    _twr_module_x1.update_interval = interval;
+
+    if (interval == TWR_TICK_INFINITY) {
+        twr_scheduler_plan_absolute(_twr_module_x1.task_id, TWR_TICK_INFINITY);
+    } else {
+        twr_scheduler_plan_relative(_twr_module_x1.task_id, interval);
+    }
+}
+
+static void _twr_module_x1_task(void *param)
+{
+    (void) param;
+
+    // Measurements started in one pass run their transactions back to back within linger of the bus
+    for (int i = 0; i < _twr_module_x1.measurement_count; i++) {
+        if (!_twr_module_x1.measurement[i].measure(_twr_module_x1.measurement[i].param)) {
+            twr_log_warning("X1: measurement %d not started", i);
+        }
+    }
+
+    twr_scheduler_plan_current_relative(_twr_module_x1.update_interval);
+}
+
 static bool _twr_module_x1_set_slpz(void *ctx, bool state)
 {
     (void) ctx;
@@ -8,6 +8,12 @@ static void _twr_mpl3115a2_task_interval(void *param);
 
 static void _twr_mpl3115a2_task_measure(void *param);
 
+static void _twr_mpl3115a2_fifo_irq(twr_exti_line_t line, void *param);
+
+static float _twr_mpl3115a2_altitude(const uint8_t *out_p);
+
+static float _twr_mpl3115a2_pressure(const uint8_t *out_p);
+
 void twr_mpl3115a2_init(twr_mpl3115a2_t *self, twr_i2c_channel_t i2c_channel, uint8_t i2c_address)
 {
     memset(self, 0, sizeof(*self));
@@ -56,7 +62,7 @@ void twr_mpl3115a2_set_update_interval(twr_mpl3115a2_t *self, twr_tick_t interva
 
 bool twr_mpl3115a2_measure(twr_mpl3115a2_t *self)
 {
-    if (self->_measurement_active)
+    if (self->_measurement_active || self->_fifo_watermark != 0)
     {
         return false;
     }
@@ -75,9 +81,9 @@ bool twr_mpl3115a2_get_altitude_meter(twr_mpl3115a2_t *self, float *meter)
         return false;
     }
 
-    int32_t out_pa = (uint32_t) self->_reg_out_p_msb_altitude << 24 | (uint32_t) self->_reg_out_p_csb_altitude << 16 | (uint32_t) (self->_reg_out_p_lsb_altitude & 0xf0) << 8;
+    uint8_t out_p[3] = { self->_reg_out_p_msb_altitude, self->_reg_out_p_csb_altitude, self->_reg_out_p_lsb_altitude };
 
-    *meter = ((float) out_pa) / 65536.f;
+    *meter = _twr_mpl3115a2_altitude(out_p);
 
     return true;
 }
@@ -89,13 +95,88 @@ bool twr_mpl3115a2_get_pressure_pascal(twr_mpl3115a2_t *self, float *pascal)
         return false;
     }
 
-    uint32_t out_p = (uint32_t) self->_reg_out_p_msb_pressure << 16 | (uint32_t) self->_reg_out_p_csb_pressure << 8 | (uint32_t) self->_reg_out_p_lsb_pressure;
+    uint8_t out_p[3] = { self->_reg_out_p_msb_pressure, self->_reg_out_p_csb_pressure, self->_reg_out_p_lsb_pressure };
 
-    *pascal = ((float) out_p) / 64.f;
+    *pascal = _twr_mpl3115a2_pressure(out_p);
 
     return true;
 }
 
+void twr_mpl3115a2_fifo_start(twr_mpl3115a2_t *self, twr_mpl3115a2_fifo_mode_t mode, twr_mpl3115a2_period_t period, uint8_t watermark)
+{
+    if (watermark == 0 || watermark > TWR_MPL3115A2_FIFO_SIZE)
+    {
+        watermark = TWR_MPL3115A2_FIFO_SIZE;
+    }
+
+    self->_fifo_mode = mode;
+    self->_fifo_period = period;
+    self->_fifo_watermark = watermark;
+    self->_fifo_count = 0;
+
+    // One-shot measurement in progress is abandoned
+    self->_measurement_active = false;
+
+    if (self->_state != TWR_MPL3115A2_STATE_INITIALIZE)
+    {
+        self->_state = TWR_MPL3115A2_STATE_FIFO_CONFIGURE;
+    }
+
+    twr_scheduler_plan_absolute(self->_task_id_measure, self->_tick_ready);
+}
+
+void twr_mpl3115a2_fifo_stop(twr_mpl3115a2_t *self)
+{
+    if (self->_fifo_watermark == 0)
+    {
+        return;
+    }
+
+    self->_fifo_watermark = 0;
+
+    if (self->_fifo_irq)
+    {
+        twr_exti_unregister(self->_fifo_irq_line);
+
+        self->_fifo_irq = false;
+    }
+
+    // Reset puts sensor back to standby with default configuration
+    self->_state = TWR_MPL3115A2_STATE_INITIALIZE;
+
+    twr_scheduler_plan_now(self->_task_id_measure);
+}
+
+void twr_mpl3115a2_set_fifo_irq(twr_mpl3115a2_t *self, twr_exti_line_t line)
+{
+    if (self->_fifo_irq)
+    {
+        twr_exti_unregister(self->_fifo_irq_line);
+    }
+
+    self->_fifo_irq = true;
+    self->_fifo_irq_line = line;
+
+    twr_exti_register_deferred(line, TWR_EXTI_EDGE_RISING, _twr_mpl3115a2_fifo_irq, self);
+}
+
+size_t twr_mpl3115a2_fifo_get(twr_mpl3115a2_t *self, float *values, size_t count)
+{
+    if (count > self->_fifo_count)
+    {
+        count = self->_fifo_count;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const uint8_t *sample = &self->_fifo[i * 5];
+
+        values[i] = self->_fifo_mode == TWR_MPL3115A2_FIFO_ALTITUDE ? _twr_mpl3115a2_altitude(sample) : _twr_mpl3115a2_pressure(sample);
+    }
+
+    return count;
+}
+
 static void _twr_mpl3115a2_task_interval(void *param)
 {
     twr_mpl3115a2_t *self = param;
@@ -127,17 +208,23 @@ start:
 
             self->_state = TWR_MPL3115A2_STATE_INITIALIZE;
 
+            // Auto-acquisition is configured again after reset
+            if (self->_fifo_watermark != 0)
+            {
+                twr_scheduler_plan_current_from_now(_TWR_MPL3115A2_DELAY_RUN);
+            }
+
             return;
         }
         case TWR_MPL3115A2_STATE_INITIALIZE:
         {
             twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x26, 0x04);
 
-            self->_state = TWR_MPL3115A2_STATE_MEASURE_ALTITUDE;
+            self->_state = self->_fifo_watermark != 0 ? TWR_MPL3115A2_STATE_FIFO_CONFIGURE : TWR_MPL3115A2_STATE_MEASURE_ALTITUDE;
 
             self->_tick_ready = twr_tick_get() + _TWR_MPL3115A2_DELAY_INITIALIZATION;
 
-            if (self->_measurement_active)
+            if (self->_measurement_active || self->_fifo_watermark != 0)
             {
                 twr_scheduler_plan_current_absolute(self->_tick_ready);
             }
@@ -291,6 +378,113 @@ start:
 
             return;
         }
+        case TWR_MPL3115A2_STATE_FIFO_CONFIGURE:
+        {
+            self->_state = TWR_MPL3115A2_STATE_ERROR;
+
+            // Standby with oversampling 128 (512 ms fits the shortest period)
+            uint8_t ctrl_reg1 = self->_fifo_mode == TWR_MPL3115A2_FIFO_ALTITUDE ? 0xb8 : 0x38;
+
+            if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x26, ctrl_reg1))
+            {
+                goto start;
+            }
+
+            if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x13, 0x07))
+            {
+                goto start;
+            }
+
+            // FIFO is flushed by disabling it, then set to circular mode with watermark
+            if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x0f, 0x00))
+            {
+                goto start;
+            }
+
+            if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x0f, 0x40 | (self->_fifo_watermark & 0x3f)))
+            {
+                goto start;
+            }
+
+            if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x27, self->_fifo_period))
+            {
+                goto start;
+            }
+
+            if (self->_fifo_irq)
+            {
+                // INT1 active high push-pull, FIFO interrupt routed to INT1
+                if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x28, 0x20) ||
+                        !twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x2a, 0x40) ||
+                        !twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x29, 0x40))
+                {
+                    goto start;
+                }
+            }
+
+            // Active mode starts auto-acquisition
+            if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x26, ctrl_reg1 | 0x01))
+            {
+                goto start;
+            }
+
+            self->_state = TWR_MPL3115A2_STATE_FIFO_READ;
+
+            if (!self->_fifo_irq)
+            {
+                twr_scheduler_plan_current_from_now((twr_tick_t) self->_fifo_watermark * (1000 << self->_fifo_period));
+            }
+
+            return;
+        }
+        case TWR_MPL3115A2_STATE_FIFO_READ:
+        {
+            self->_state = TWR_MPL3115A2_STATE_ERROR;
+
+            uint8_t reg_f_status;
+
+            if (!twr_i2c_memory_read_8b(self->_i2c_channel, self->_i2c_address, 0x0d, &reg_f_status))
+            {
+                goto start;
+            }
+
+            self->_fifo_count = reg_f_status & 0x3f;
+
+            if (self->_fifo_count > TWR_MPL3115A2_FIFO_SIZE)
+            {
+                self->_fifo_count = TWR_MPL3115A2_FIFO_SIZE;
+            }
+
+            if (self->_fifo_count != 0)
+            {
+                // All samples are read in one burst from F_DATA
+                twr_i2c_memory_transfer_t transfer;
+
+                transfer.device_address = self->_i2c_address;
+                transfer.memory_address = 0x0e;
+                transfer.buffer = self->_fifo;
+                transfer.length = self->_fifo_count * 5;
+
+                if (!twr_i2c_memory_read(self->_i2c_channel, &transfer))
+                {
+                    goto start;
+                }
+            }
+
+            self->_state = TWR_MPL3115A2_STATE_FIFO_READ;
+
+            if (!self->_fifo_irq)
+            {
+                twr_scheduler_plan_current_relative((twr_tick_t) self->_fifo_watermark * (1000 << self->_fifo_period));
+            }
+
+            if (self->_fifo_count != 0 && self->_event_handler != NULL)
+            {
+                self->_event_handler(self, TWR_MPL3115A2_EVENT_FIFO, self->_event_param);
+            }
+
+            return;
+        }
         default:
         {
             self->_state = TWR_MPL3115A2_STATE_ERROR;
@@ -299,3 +493,29 @@ start:
         }
     }
 }
+
+static void _twr_mpl3115a2_fifo_irq(twr_exti_line_t line, void *param)
+{
+    (void) line;
+
+    twr_mpl3115a2_t *self = param;
+
+    if (self->_state == TWR_MPL3115A2_STATE_FIFO_READ)
+    {
+        twr_scheduler_plan_now(self->_task_id_measure);
+    }
+}
+
+static float _twr_mpl3115a2_altitude(const uint8_t *out_p)
+{
+    int32_t out_pa = (uint32_t) out_p[0] << 24 | (uint32_t) out_p[1] << 16 | (uint32_t) (out_p[2] & 0xf0) << 8;
+
+    return ((float) out_pa) / 65536.f;
+}
+
+static float _twr_mpl3115a2_pressure(const uint8_t *out_p)
+{
+    uint32_t out = (uint32_t) out_p[0] << 16 | (uint32_t) out_p[1] << 8 | (uint32_t) out_p[2];
+
+    return ((float) out) / 64.f;
+}
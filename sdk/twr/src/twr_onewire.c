@@ -3,6 +3,8 @@
 
 static void _twr_onewire_lock(twr_onewire_t *self);
 static void _twr_onewire_unlock(twr_onewire_t *self);
+static void _twr_onewire_disable(twr_onewire_t *self);
+static void _twr_onewire_linger_task(void *param);
 static void _twr_onewire_search_reset(twr_onewire_t *self);
 static void _twr_onewire_search_target_setup(twr_onewire_t *self, uint8_t family_code);
 static int _twr_onewire_search_devices(twr_onewire_t *self, uint64_t *device_list, size_t device_list_size);
@@ -96,9 +98,16 @@ void twr_onewire_skip_rom(twr_onewire_t *self)
 void twr_onewire_write(twr_onewire_t *self, const void *buffer, size_t length)
 {
     _twr_onewire_lock(self);
-    for (size_t i = 0; i < length; i++)
+    if (self->_driver->write != NULL)
     {
-        self->_driver->write_byte(self->_driver_ctx, ((uint8_t *) buffer)[i]);
+        self->_driver->write(self->_driver_ctx, buffer, length);
+    }
+    else
+    {
+        for (size_t i = 0; i < length; i++)
+        {
+            self->_driver->write_byte(self->_driver_ctx, ((uint8_t *) buffer)[i]);
+        }
     }
     _twr_onewire_unlock(self);
 }
@@ -106,9 +115,16 @@ void twr_onewire_write(twr_onewire_t *self, const void *buffer, size_t length)
 void twr_onewire_read(twr_onewire_t *self, void *buffer, size_t length)
 {
     _twr_onewire_lock(self);
-    for (size_t i = 0; i < length; i++)
+    if (self->_driver->read != NULL)
     {
-        ((uint8_t *) buffer)[i] = self->_driver->read_byte(self->_driver_ctx);
+        self->_driver->read(self->_driver_ctx, buffer, length);
+    }
+    else
+    {
+        for (size_t i = 0; i < length; i++)
+        {
+            ((uint8_t *) buffer)[i] = self->_driver->read_byte(self->_driver_ctx);
+        }
     }
     _twr_onewire_unlock(self);
 }
@@ -157,6 +173,18 @@ int twr_onewire_search_family(twr_onewire_t *self, uint8_t family_code, uint64_t
     return _twr_onewire_search_devices(self, device_list, device_list_size);
 }
 
+void twr_onewire_set_linger(twr_onewire_t *self, twr_tick_t linger)
+{
+    self->_linger = linger;
+
+    if (linger != 0 && !self->_linger_task_registered)
+    {
+        self->_linger_task_id = twr_scheduler_register(_twr_onewire_linger_task, self, TWR_TICK_INFINITY);
+
+        self->_linger_task_registered = true;
+    }
+}
+
 void twr_onewire_auto_ds28e17_sleep_mode(twr_onewire_t *self, bool on)
 {
     self->_auto_ds28e17_sleep_mode = on;
@@ -236,11 +264,30 @@ bool twr_onewire_search_next(twr_onewire_t *self, uint64_t *device_number)
     return search_result;
 }
 
+bool twr_onewire_verify(twr_onewire_t *self, uint64_t *device_number)
+{
+    uint64_t found_number;
+
+    // Search continues along the given number and stops on the first device which differs from it
+    memcpy(self->_last_rom_no, device_number, sizeof(self->_last_rom_no));
+    self->_last_discrepancy = 64;
+    self->_last_family_discrepancy = 0;
+    self->_last_device_flag = false;
+
+    bool result = twr_onewire_search_next(self, &found_number) && (found_number == *device_number);
+
+    _twr_onewire_search_reset(self);
+
+    return result;
+}
+
 static void _twr_onewire_lock(twr_onewire_t *self)
 {
-    if ((self->_lock_count)++ == 0)
+    if ((self->_lock_count)++ == 0 && !self->_enabled)
     {
         self->_driver->enable(self->_driver_ctx);
+
+        self->_enabled = true;
     }
 }
 
@@ -250,21 +297,45 @@ static void _twr_onewire_unlock(twr_onewire_t *self)
 
     if (self->_lock_count == 1)
     {
-        if (self->_auto_ds28e17_sleep_mode)
+        if (self->_linger == 0)
         {
-            if (self->_driver->reset(self->_driver_ctx))
-            {
-                self->_driver->write_byte(self->_driver_ctx, 0xcc);
-                self->_driver->write_byte(self->_driver_ctx, 0x1e);
-            }
+            _twr_onewire_disable(self);
+        }
+        else
+        {
+            twr_scheduler_plan_from_now(self->_linger_task_id, self->_linger);
         }
-
-        self->_driver->disable(self->_driver_ctx);
     }
 
     self->_lock_count--;
 }
 
+static void _twr_onewire_disable(twr_onewire_t *self)
+{
+    if (self->_auto_ds28e17_sleep_mode)
+    {
+        if (self->_driver->reset(self->_driver_ctx))
+        {
+            self->_driver->write_byte(self->_driver_ctx, 0xcc);
+            self->_driver->write_byte(self->_driver_ctx, 0x1e);
+        }
+    }
+
+    self->_driver->disable(self->_driver_ctx);
+
+    self->_enabled = false;
+}
+
+static void _twr_onewire_linger_task(void *param)
+{
+    twr_onewire_t *self = param;
+
+    if (self->_lock_count == 0 && self->_enabled)
+    {
+        _twr_onewire_disable(self);
+    }
+}
+
 static void _twr_onewire_search_reset(twr_onewire_t *self)
 {
     self->_last_discrepancy = 0;
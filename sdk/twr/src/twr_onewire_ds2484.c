@@ -1,3 +1,5 @@
+#define TWR_LOG_MODULE TWR_LOG_MODULE_ONEWIRE
+
 #include <twr_onewire_ds2484.h>
 #include <twr_system.h>
 #include <twr_timer.h>
@@ -13,6 +15,8 @@ static uint8_t _twr_onewire_ds2484_read_bit(void *ctx);
 static void _twr_onewire_ds2484_write_byte(void *ctx, uint8_t byte);
 static uint8_t _twr_onewire_ds2484_read_byte(void *ctx);
 static bool _twr_onewire_ds2484_search_next(void *ctx, twr_onewire_t *onewire, uint64_t *device_number);
+static void _twr_onewire_ds2484_write(void *ctx, const void *buffer, size_t length);
+static void _twr_onewire_ds2484_read(void *ctx, void *buffer, size_t length);
 
 static const twr_onewire_driver_t _twr_onewire_ds2484_driver =
 {
@@ -24,7 +28,9 @@ static const twr_onewire_driver_t _twr_onewire_ds2484_driver =
     .read_bit = _twr_onewire_ds2484_read_bit,
     .write_byte = _twr_onewire_ds2484_write_byte,
     .read_byte = _twr_onewire_ds2484_read_byte,
-    .search_next = _twr_onewire_ds2484_search_next
+    .search_next = _twr_onewire_ds2484_search_next,
+    .write = _twr_onewire_ds2484_write,
+    .read = _twr_onewire_ds2484_read
 };
 
 void twr_onewire_ds2484_init(twr_onewire_t *onewire, twr_ds2484_t *twr_ds2484)
@@ -85,6 +91,19 @@ static uint8_t _twr_onewire_ds2484_read_byte(void *ctx)
     return byte;
 }
 
+static void _twr_onewire_ds2484_write(void *ctx, const void *buffer, size_t length)
+{
+    twr_ds2484_write((twr_ds2484_t *) ctx, buffer, length);
+}
+
+static void _twr_onewire_ds2484_read(void *ctx, void *buffer, size_t length)
+{
+    if (!twr_ds2484_read((twr_ds2484_t *) ctx, buffer, length))
+    {
+        memset(buffer, 0, length);
+    }
+}
+
 static bool _twr_onewire_ds2484_search_next(void *ctx, twr_onewire_t *onewire, uint64_t *device_number)
 {
     twr_ds2484_t *ds2484 = (twr_ds2484_t *) ctx;
@@ -1,3 +1,5 @@
+#define TWR_LOG_MODULE TWR_LOG_MODULE_ONEWIRE
+
 #include <twr_onewire_gpio.h>
 #include <twr_system.h>
 #include <twr_timer.h>
@@ -85,9 +87,9 @@ static bool _twr_onewire_gpio_reset(void *ctx)
         }
         twr_timer_delay(2);
     }
-    while (twr_gpio_get_input(channel) == 0);
+    while (twr_gpio_get_input_fast(channel) == 0);
 
-    twr_gpio_set_output(channel, 0);
+    twr_gpio_reset_output_fast(channel);
     twr_gpio_set_mode(channel, TWR_GPIO_MODE_OUTPUT);
 
     twr_timer_delay(480);
@@ -107,7 +109,7 @@ static bool _twr_onewire_gpio_reset(void *ctx)
     twr_timer_delay(60);
     retries = 4;
     do {
-        i = twr_gpio_get_input(channel);
+        i = twr_gpio_get_input_fast(channel);
         twr_timer_delay(4);
     }
     while (i && --retries);
@@ -123,7 +125,7 @@ static void _twr_onewire_gpio_write_bit(void *ctx, uint8_t bit)
 {
     twr_gpio_channel_t channel = (twr_gpio_channel_t) ctx;
 
-    twr_gpio_set_output(channel, 0);
+    twr_gpio_reset_output_fast(channel);
     twr_gpio_set_mode(channel, TWR_GPIO_MODE_OUTPUT);
 
     if (bit)
@@ -154,7 +156,7 @@ static uint8_t _twr_onewire_gpio_read_bit(void *ctx)
 
     uint8_t bit = 0;
 
-    twr_gpio_set_output(channel, 0);
+    twr_gpio_reset_output_fast(channel);
 
     twr_gpio_set_mode(channel, TWR_GPIO_MODE_OUTPUT);
 
@@ -172,7 +174,7 @@ static uint8_t _twr_onewire_gpio_read_bit(void *ctx)
 
     twr_irq_enable();
 
-    bit = twr_gpio_get_input(channel);
+    bit = twr_gpio_get_input_fast(channel);
 
     twr_timer_delay(50);
 
@@ -1,7 +1,28 @@
 #include <twr_gpio.h>
 #include <twr_onewire_relay.h>
+#include <twr_scheduler.h>
+
+typedef struct
+{
+    twr_onewire_relay_t *relay;
+    uint8_t mask;
+    uint8_t states;
+    twr_tick_t tick_end;
+
+} _twr_onewire_relay_pulse_t;
+
+static struct
+{
+    _twr_onewire_relay_pulse_t pulses[TWR_ONEWIRE_RELAY_PULSE_COUNT];
+    twr_scheduler_task_id_t task_id;
+    bool task_registered;
+
+} _twr_onewire_relay_pulse;
 
 bool _twr_onewire_relay_read_state(twr_onewire_relay_t *self);
+static bool _twr_onewire_relay_write_state(twr_onewire_relay_t *self, uint8_t mask, uint8_t states);
+static twr_tick_t _twr_onewire_relay_pulse_next(void);
+static void _twr_onewire_relay_pulse_task(void *param);
 
 bool twr_onewire_relay_init(twr_onewire_relay_t *self, twr_onewire_t *onewire, uint64_t device_number)
 {
@@ -19,27 +40,118 @@ bool twr_onewire_relay_init(twr_onewire_relay_t *self, twr_onewire_t *onewire, u
 
 bool twr_onewire_relay_set_state(twr_onewire_relay_t *self, twr_onewire_relay_channel_t relay_channel, bool state)
 {
-    if (!self->_state_valid && !_twr_onewire_relay_read_state(self))
+    return twr_onewire_relay_set_states(self, 1 << relay_channel, state ? 1 << relay_channel : 0);
+}
+
+bool twr_onewire_relay_set_states(twr_onewire_relay_t *self, uint8_t mask, uint8_t states)
+{
+    twr_onewire_transaction_start(self->_onewire);
+
+    bool success = _twr_onewire_relay_write_state(self, mask, states);
+
+    twr_onewire_transaction_stop(self->_onewire);
+
+    return success;
+}
+
+bool twr_onewire_relay_pulse(twr_onewire_relay_t *self, uint8_t mask, uint8_t states, twr_tick_t duration)
+{
+    _twr_onewire_relay_pulse_t *slot = NULL;
+
+    for (size_t i = 0; i < TWR_ONEWIRE_RELAY_PULSE_COUNT; i++)
+    {
+        _twr_onewire_relay_pulse_t *pulse = &_twr_onewire_relay_pulse.pulses[i];
+
+        if (pulse->relay == self)
+        {
+            // Channels are taken over by the new pulse
+            pulse->mask &= ~mask;
+
+            if (pulse->mask == 0)
+            {
+                pulse->relay = NULL;
+            }
+        }
+
+        if (pulse->relay == NULL && slot == NULL)
+        {
+            slot = pulse;
+        }
+    }
+
+    if (slot == NULL)
     {
         return false;
     }
 
+    if (!twr_onewire_relay_set_states(self, mask, states))
+    {
+        return false;
+    }
+
+    slot->relay = self;
+    slot->mask = mask;
+    slot->states = ~states;
+    slot->tick_end = twr_tick_get() + duration;
+
+    if (!_twr_onewire_relay_pulse.task_registered)
+    {
+        _twr_onewire_relay_pulse.task_id = twr_scheduler_register(_twr_onewire_relay_pulse_task, NULL, slot->tick_end);
+        _twr_onewire_relay_pulse.task_registered = true;
+    }
+
+    twr_scheduler_plan_absolute(_twr_onewire_relay_pulse.task_id, _twr_onewire_relay_pulse_next());
+
+    return true;
+}
+
+bool twr_onewire_relay_get_state(twr_onewire_relay_t *self, twr_onewire_relay_channel_t relay_channel, bool *state)
+{
+    if (!self->_state_valid)
+    {
+        return false;
+    }
+
+    *state = ((self->_state >> relay_channel) & 0x01) == 0x00;
+
+    return true;
+}
+
+bool _twr_onewire_relay_read_state(twr_onewire_relay_t *self)
+{
+    self->_state_valid = false;
+
     if (!twr_onewire_reset(self->_onewire))
     {
         return false;
     }
 
-    uint8_t new_state = self->_state;
+    twr_onewire_select(self->_onewire, &self->_device_number);
+
+    twr_onewire_write_byte(self->_onewire, 0xF5);
+
+    self->_state = twr_onewire_read_byte(self->_onewire);
+
+    self->_state_valid = true;
+
+    return true;
+}
 
-    if (!state)
+static bool _twr_onewire_relay_write_state(twr_onewire_relay_t *self, uint8_t mask, uint8_t states)
+{
+    if (!self->_state_valid && !_twr_onewire_relay_read_state(self))
     {
-        new_state |= (1 << relay_channel);
+        return false;
     }
-    else
+
+    if (!twr_onewire_reset(self->_onewire))
     {
-        new_state &= ~(1 << relay_channel);
+        return false;
     }
 
+    // Output latch is active low
+    uint8_t new_state = (self->_state & ~mask) | (~states & mask);
+
     twr_onewire_select(self->_onewire, &self->_device_number);
 
     uint8_t buffer[] = { 0x5A, new_state, ~new_state };
@@ -61,34 +173,55 @@ bool twr_onewire_relay_set_state(twr_onewire_relay_t *self, twr_onewire_relay_ch
     return true;
 }
 
-bool twr_onewire_relay_get_state(twr_onewire_relay_t *self, twr_onewire_relay_channel_t relay_channel, bool *state)
+static twr_tick_t _twr_onewire_relay_pulse_next(void)
 {
-    if (!self->_state_valid)
+    twr_tick_t tick_next = TWR_TICK_INFINITY;
+
+    for (size_t i = 0; i < TWR_ONEWIRE_RELAY_PULSE_COUNT; i++)
     {
-        return false;
+        if (_twr_onewire_relay_pulse.pulses[i].relay != NULL && _twr_onewire_relay_pulse.pulses[i].tick_end < tick_next)
+        {
+            tick_next = _twr_onewire_relay_pulse.pulses[i].tick_end;
+        }
     }
 
-    *state = ((self->_state >> relay_channel) & 0x01) == 0x00;
-
-    return true;
+    return tick_next;
 }
 
-bool _twr_onewire_relay_read_state(twr_onewire_relay_t *self)
+static void _twr_onewire_relay_pulse_task(void *param)
 {
-    self->_state_valid = false;
+    (void) param;
 
-    if (!twr_onewire_reset(self->_onewire))
+    twr_tick_t tick_now = twr_scheduler_get_spin_tick();
+
+    for (size_t i = 0; i < TWR_ONEWIRE_RELAY_PULSE_COUNT; i++)
     {
-        return false;
-    }
+        twr_onewire_relay_t *relay = _twr_onewire_relay_pulse.pulses[i].relay;
 
-    twr_onewire_select(self->_onewire, &self->_device_number);
+        if (relay == NULL || _twr_onewire_relay_pulse.pulses[i].tick_end > tick_now)
+        {
+            continue;
+        }
 
-    twr_onewire_write_byte(self->_onewire, 0xF5);
+        uint8_t mask = 0;
+        uint8_t states = 0;
 
-    self->_state = twr_onewire_read_byte(self->_onewire);
+        // All pulses of the relay that are due are ended by one write
+        for (size_t j = i; j < TWR_ONEWIRE_RELAY_PULSE_COUNT; j++)
+        {
+            _twr_onewire_relay_pulse_t *pulse = &_twr_onewire_relay_pulse.pulses[j];
 
-    self->_state_valid = true;
+            if (pulse->relay == relay && pulse->tick_end <= tick_now)
+            {
+                mask |= pulse->mask;
+                states |= pulse->states & pulse->mask;
 
-    return true;
+                pulse->relay = NULL;
+            }
+        }
+
+        twr_onewire_relay_set_states(relay, mask, states);
+    }
+
+    twr_scheduler_plan_current_absolute(_twr_onewire_relay_pulse_next());
 }
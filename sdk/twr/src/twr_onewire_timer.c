@@ -0,0 +1,460 @@
+#include <twr_onewire_timer.h>
+#include <twr_system.h>
+#include <twr_dma.h>
+#include <twr_irq.h>
+#include <stm32l0xx.h>
+
+// Timer runs from PLL with 1 us resolution during transaction
+#define _TWR_ONEWIRE_TIMER_PRESCALER (32 - 1)
+
+#define _TWR_ONEWIRE_TIMER_RESET_LOW 480
+#define _TWR_ONEWIRE_TIMER_RESET_PERIOD 960
+#define _TWR_ONEWIRE_TIMER_SLOT_PERIOD 70
+#define _TWR_ONEWIRE_TIMER_SLOT_LOW_1 3
+#define _TWR_ONEWIRE_TIMER_SLOT_LOW_0 60
+
+// Line released by the device before this time from the start of the slot is read as 1
+#define _TWR_ONEWIRE_TIMER_SLOT_SAMPLE 12
+
+static struct
+{
+    twr_gpio_channel_t channel;
+    bool ready;
+    twr_dma_channel_t update_channel;
+    twr_dma_channel_t capture_channel;
+    twr_dma_channel_config_t update_config;
+    twr_dma_channel_config_t capture_config;
+    uint16_t compare[8];
+    uint16_t capture[8];
+
+} _twr_onewire_timer;
+
+static bool _twr_onewire_timer_init(void *ctx);
+static bool _twr_onewire_timer_enable(void *ctx);
+static bool _twr_onewire_timer_disable(void *ctx);
+static bool _twr_onewire_timer_reset(void *ctx);
+static void _twr_onewire_timer_write_bit(void *ctx, uint8_t bit);
+static uint8_t _twr_onewire_timer_read_bit(void *ctx);
+static void _twr_onewire_timer_write_byte(void *ctx, uint8_t byte);
+static uint8_t _twr_onewire_timer_read_byte(void *ctx);
+static bool _twr_onewire_timer_search_next(void *ctx, twr_onewire_t *onewire, uint64_t *device_number);
+static int _twr_onewire_timer_run(const uint16_t *low, int count, uint16_t period, int capture_length);
+
+static const twr_onewire_driver_t _twr_onewire_timer_driver =
+{
+    .init = _twr_onewire_timer_init,
+    .enable = _twr_onewire_timer_enable,
+    .disable = _twr_onewire_timer_disable,
+    .reset = _twr_onewire_timer_reset,
+    .write_bit = _twr_onewire_timer_write_bit,
+    .read_bit = _twr_onewire_timer_read_bit,
+    .write_byte = _twr_onewire_timer_write_byte,
+    .read_byte = _twr_onewire_timer_read_byte,
+    .search_next = _twr_onewire_timer_search_next
+};
+
+bool twr_onewire_timer_init(twr_onewire_t *onewire, twr_gpio_channel_t channel)
+{
+    if (channel != TWR_GPIO_P0 && channel != TWR_GPIO_P5)
+    {
+        return false;
+    }
+
+    _twr_onewire_timer.channel = channel;
+
+    return twr_onewire_init(onewire, &_twr_onewire_timer_driver, (void *) channel);
+}
+
+static bool _twr_onewire_timer_init(void *ctx)
+{
+    twr_gpio_channel_t channel = (twr_gpio_channel_t) ctx;
+
+    twr_gpio_init(channel);
+
+    twr_gpio_set_pull(channel, TWR_GPIO_PULL_NONE);
+
+    twr_gpio_set_mode(channel, TWR_GPIO_MODE_INPUT);
+
+    twr_dma_init();
+
+    _twr_onewire_timer.update_config.direction = TWR_DMA_DIRECTION_TO_PERIPHERAL;
+    _twr_onewire_timer.update_config.data_size_memory = TWR_DMA_SIZE_2;
+    _twr_onewire_timer.update_config.data_size_peripheral = TWR_DMA_SIZE_2;
+    _twr_onewire_timer.update_config.mode = TWR_DMA_MODE_STANDARD;
+    _twr_onewire_timer.update_config.address_memory = _twr_onewire_timer.compare;
+    _twr_onewire_timer.update_config.address_peripheral = (void *) &TIM2->CCR1;
+    _twr_onewire_timer.update_config.priority = TWR_DMA_PRIORITY_VERY_HIGH;
+
+    _twr_onewire_timer.capture_config.direction = TWR_DMA_DIRECTION_TO_RAM;
+    _twr_onewire_timer.capture_config.data_size_memory = TWR_DMA_SIZE_2;
+    _twr_onewire_timer.capture_config.data_size_peripheral = TWR_DMA_SIZE_2;
+    _twr_onewire_timer.capture_config.mode = TWR_DMA_MODE_STANDARD;
+    _twr_onewire_timer.capture_config.address_memory = _twr_onewire_timer.capture;
+    _twr_onewire_timer.capture_config.address_peripheral = (void *) &TIM2->CCR2;
+    _twr_onewire_timer.capture_config.priority = TWR_DMA_PRIORITY_VERY_HIGH;
+
+    return true;
+}
+
+static bool _twr_onewire_timer_enable(void *ctx)
+{
+    twr_gpio_channel_t channel = (twr_gpio_channel_t) ctx;
+
+    if (!twr_dma_channel_allocate(TWR_DMA_LINE_TIM2_UP, &_twr_onewire_timer.update_channel, &_twr_onewire_timer.update_config.request))
+    {
+        return false;
+    }
+
+    if (!twr_dma_channel_allocate(TWR_DMA_LINE_TIM2_CH2, &_twr_onewire_timer.capture_channel, &_twr_onewire_timer.capture_config.request))
+    {
+        twr_dma_channel_release(_twr_onewire_timer.update_channel);
+
+        return false;
+    }
+
+    twr_system_pll_enable();
+
+    RCC->APB1ENR |= RCC_APB1ENR_TIM2EN;
+
+    // Errata workaround
+    RCC->APB1ENR;
+
+    TIM2->CR1 = 0;
+    TIM2->PSC = _TWR_ONEWIRE_TIMER_PRESCALER;
+
+    // PWM mode 1 with preload on channel 1, channel 2 captures TI1
+    TIM2->CCMR1 = TIM_CCMR1_OC1M_2 | TIM_CCMR1_OC1M_1 | TIM_CCMR1_OC1PE | TIM_CCMR1_CC2S_1;
+
+    // Channel 1 active low, channel 2 captures rising edge
+    TIM2->CCER = TIM_CCER_CC1E | TIM_CCER_CC1P | TIM_CCER_CC2E;
+
+    // Zero compare keeps the line released
+    TIM2->CCR1 = 0;
+    TIM2->EGR = TIM_EGR_UG;
+
+    twr_gpio_set_mode(channel, channel == TWR_GPIO_P0 ? TWR_GPIO_MODE_ALTERNATE_2 : TWR_GPIO_MODE_ALTERNATE_5);
+
+    // Line is driven low only, pull-up is external
+    GPIOA->OTYPER |= channel == TWR_GPIO_P0 ? GPIO_OTYPER_OT_0 : GPIO_OTYPER_OT_5;
+
+    _twr_onewire_timer.ready = true;
+
+    return true;
+}
+
+static bool _twr_onewire_timer_disable(void *ctx)
+{
+    if (!_twr_onewire_timer.ready)
+    {
+        return false;
+    }
+
+    _twr_onewire_timer.ready = false;
+
+    twr_gpio_set_mode((twr_gpio_channel_t) ctx, TWR_GPIO_MODE_ANALOG);
+
+    TIM2->CR1 = 0;
+    TIM2->CCER = 0;
+
+    RCC->APB1ENR &= ~RCC_APB1ENR_TIM2EN;
+
+    twr_dma_channel_release(_twr_onewire_timer.capture_channel);
+    twr_dma_channel_release(_twr_onewire_timer.update_channel);
+
+    twr_system_pll_disable();
+
+    return true;
+}
+
+static bool _twr_onewire_timer_reset(void *ctx)
+{
+    twr_gpio_channel_t channel = (twr_gpio_channel_t) ctx;
+
+    static const uint16_t low = _TWR_ONEWIRE_TIMER_RESET_LOW;
+
+    uint8_t retries = 125;
+
+    // Wait for the line to be released
+    TIM2->CNT = 0;
+    TIM2->ARR = 0xffff;
+    TIM2->CR1 = TIM_CR1_CEN;
+
+    while (twr_gpio_get_input(channel) == 0)
+    {
+        if (retries-- == 0)
+        {
+            TIM2->CR1 = 0;
+
+            return false;
+        }
+
+        uint16_t t = TIM2->CNT + 2;
+
+        while (TIM2->CNT < t)
+        {
+            continue;
+        }
+    }
+
+    TIM2->CR1 = 0;
+
+    // First rising edge ends the reset pulse, the second one ends the presence pulse
+    return _twr_onewire_timer_run(&low, 1, _TWR_ONEWIRE_TIMER_RESET_PERIOD, 2) == 2 &&
+           _twr_onewire_timer.capture[1] > _TWR_ONEWIRE_TIMER_RESET_LOW;
+}
+
+static void _twr_onewire_timer_write_bit(void *ctx, uint8_t bit)
+{
+    (void) ctx;
+
+    uint16_t low = bit ? _TWR_ONEWIRE_TIMER_SLOT_LOW_1 : _TWR_ONEWIRE_TIMER_SLOT_LOW_0;
+
+    _twr_onewire_timer_run(&low, 1, _TWR_ONEWIRE_TIMER_SLOT_PERIOD, 0);
+}
+
+static uint8_t _twr_onewire_timer_read_bit(void *ctx)
+{
+    (void) ctx;
+
+    static const uint16_t low = _TWR_ONEWIRE_TIMER_SLOT_LOW_1;
+
+    if (_twr_onewire_timer_run(&low, 1, _TWR_ONEWIRE_TIMER_SLOT_PERIOD, 1) != 1)
+    {
+        return 1;
+    }
+
+    return _twr_onewire_timer.capture[0] < _TWR_ONEWIRE_TIMER_SLOT_SAMPLE ? 1 : 0;
+}
+
+static void _twr_onewire_timer_write_byte(void *ctx, uint8_t byte)
+{
+    (void) ctx;
+
+    uint16_t low[8];
+
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        low[i] = (byte & 0x01) ? _TWR_ONEWIRE_TIMER_SLOT_LOW_1 : _TWR_ONEWIRE_TIMER_SLOT_LOW_0;
+        byte >>= 1;
+    }
+
+    _twr_onewire_timer_run(low, 8, _TWR_ONEWIRE_TIMER_SLOT_PERIOD, 0);
+}
+
+static uint8_t _twr_onewire_timer_read_byte(void *ctx)
+{
+    (void) ctx;
+
+    static const uint16_t low[8] =
+    {
+        _TWR_ONEWIRE_TIMER_SLOT_LOW_1, _TWR_ONEWIRE_TIMER_SLOT_LOW_1, _TWR_ONEWIRE_TIMER_SLOT_LOW_1, _TWR_ONEWIRE_TIMER_SLOT_LOW_1,
+        _TWR_ONEWIRE_TIMER_SLOT_LOW_1, _TWR_ONEWIRE_TIMER_SLOT_LOW_1, _TWR_ONEWIRE_TIMER_SLOT_LOW_1, _TWR_ONEWIRE_TIMER_SLOT_LOW_1
+    };
+
+    // Every slot has exactly one rising edge, missing one means the line is stuck
+    if (_twr_onewire_timer_run(low, 8, _TWR_ONEWIRE_TIMER_SLOT_PERIOD, 8) != 8)
+    {
+        return 0xff;
+    }
+
+    uint8_t byte = 0;
+
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        if (_twr_onewire_timer.capture[i] < _TWR_ONEWIRE_TIMER_SLOT_SAMPLE)
+        {
+            byte |= 1 << i;
+        }
+    }
+
+    return byte;
+}
+
+static bool _twr_onewire_timer_search_next(void *ctx, twr_onewire_t *onewire, uint64_t *device_number)
+{
+    bool search_result = false;
+    uint8_t id_bit_number = 1;
+    uint8_t last_zero = 0;
+    uint8_t rom_byte_number = 0;
+    uint8_t rom_byte_mask = 1;
+    uint8_t id_bit, cmp_id_bit, search_direction;
+
+    if (!_twr_onewire_timer_reset(ctx))
+    {
+        return false;
+    }
+
+    _twr_onewire_timer_write_byte(ctx, 0xf0);
+
+    do
+    {
+        id_bit = _twr_onewire_timer_read_bit(ctx);
+        cmp_id_bit = _twr_onewire_timer_read_bit(ctx);
+
+        // No device takes part in the search
+        if ((id_bit == 1) && (cmp_id_bit == 1))
+        {
+            break;
+        }
+
+        if (id_bit != cmp_id_bit)
+        {
+            search_direction = id_bit;
+        }
+        else
+        {
+            // Discrepancy, take the same branch as last time before the last discrepancy and 1 on it
+            if (id_bit_number < onewire->_last_discrepancy)
+            {
+                search_direction = ((onewire->_last_rom_no[rom_byte_number] & rom_byte_mask) > 0);
+            }
+            else
+            {
+                search_direction = (id_bit_number == onewire->_last_discrepancy);
+            }
+
+            if (search_direction == 0)
+            {
+                last_zero = id_bit_number;
+
+                if (last_zero < 9)
+                {
+                    onewire->_last_family_discrepancy = last_zero;
+                }
+            }
+        }
+
+        if (search_direction == 1)
+        {
+            onewire->_last_rom_no[rom_byte_number] |= rom_byte_mask;
+        }
+        else
+        {
+            onewire->_last_rom_no[rom_byte_number] &= ~rom_byte_mask;
+        }
+
+        _twr_onewire_timer_write_bit(ctx, search_direction);
+
+        id_bit_number++;
+        rom_byte_mask <<= 1;
+
+        if (rom_byte_mask == 0)
+        {
+            rom_byte_number++;
+            rom_byte_mask = 1;
+        }
+    }
+    while (rom_byte_number < 8);
+
+    if (!(id_bit_number < 65))
+    {
+        onewire->_last_discrepancy = last_zero;
+
+        if (onewire->_last_discrepancy == 0)
+        {
+            onewire->_last_device_flag = true;
+        }
+
+        search_result = onewire->_last_rom_no[0] != 0;
+    }
+
+    if (search_result && twr_onewire_crc8(onewire->_last_rom_no, sizeof(onewire->_last_rom_no), 0x00) != 0)
+    {
+        search_result = false;
+    }
+
+    if (search_result)
+    {
+        memcpy(device_number, onewire->_last_rom_no, sizeof(onewire->_last_rom_no));
+    }
+    else
+    {
+        _twr_onewire_timer_reset(ctx);
+    }
+
+    return search_result;
+}
+
+static int _twr_onewire_timer_run(const uint16_t *low, int count, uint16_t period, int capture_length)
+{
+    if (!_twr_onewire_timer.ready)
+    {
+        return -1;
+    }
+
+    // Compare values are loaded on update, so the DMA feeds the third slot onwards and zero releases the line at the end
+    int feed_length = count - 1;
+
+    for (int i = 0; i < feed_length - 1; i++)
+    {
+        _twr_onewire_timer.compare[i] = low[i + 2];
+    }
+
+    if (feed_length > 0)
+    {
+        _twr_onewire_timer.compare[feed_length - 1] = 0;
+
+        _twr_onewire_timer.update_config.length = feed_length;
+
+        twr_dma_channel_config(_twr_onewire_timer.update_channel, &_twr_onewire_timer.update_config);
+        twr_dma_channel_run(_twr_onewire_timer.update_channel);
+    }
+
+    if (capture_length > 0)
+    {
+        _twr_onewire_timer.capture_config.length = capture_length;
+
+        twr_dma_channel_config(_twr_onewire_timer.capture_channel, &_twr_onewire_timer.capture_config);
+        twr_dma_channel_run(_twr_onewire_timer.capture_channel);
+    }
+
+    TIM2->ARR = period - 1;
+
+    // Pin goes low as soon as the first compare value is loaded, the start must not be delayed
+    twr_irq_disable();
+
+    TIM2->CCR1 = low[0];
+    TIM2->EGR = TIM_EGR_UG;
+    TIM2->CCR1 = count > 1 ? low[1] : 0;
+    TIM2->SR = 0;
+    TIM2->DIER = (feed_length > 0 ? TIM_DIER_UDE : 0) | (capture_length > 0 ? TIM_DIER_CC2DE : 0);
+    TIM2->CR1 = TIM_CR1_CEN;
+
+    twr_irq_enable();
+
+    if (feed_length > 0)
+    {
+        // Update of the last slot has been fed
+        while (twr_dma_channel_get_length(_twr_onewire_timer.update_channel) != 0)
+        {
+            continue;
+        }
+
+        TIM2->SR &= ~TIM_SR_UIF;
+    }
+
+    // Wait for the end of the last slot, late return only extends recovery time on released line
+    while ((TIM2->SR & TIM_SR_UIF) == 0)
+    {
+        continue;
+    }
+
+    TIM2->CR1 = 0;
+    TIM2->DIER = 0;
+
+    int captured = 0;
+
+    if (capture_length > 0)
+    {
+        captured = capture_length - (int) twr_dma_channel_get_length(_twr_onewire_timer.capture_channel);
+
+        twr_dma_channel_stop(_twr_onewire_timer.capture_channel);
+    }
+
+    if (feed_length > 0)
+    {
+        twr_dma_channel_stop(_twr_onewire_timer.update_channel);
+    }
+
+    return captured;
+}
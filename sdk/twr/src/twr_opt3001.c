@@ -4,9 +4,39 @@
 #define _TWR_OPT3001_DELAY_INITIALIZATION 50
 #define _TWR_OPT3001_DELAY_MEASUREMENT 1000
 
-static void _twr_opt3001_task_interval(void *param);
+// Configuration with automatic full-scale range, 800 ms conversion and latched window comparison
+#define _TWR_OPT3001_CONFIG_SHUTDOWN 0xc810
+#define _TWR_OPT3001_CONFIG_SINGLE_SHOT 0xca10
+#define _TWR_OPT3001_CONFIG_CONTINUOUS 0xcc10
 
-static void _twr_opt3001_task_measure(void *param);
+// Limit registers are in result format, exponent 11 and mantissa 0xfff is the top of the range
+#define _TWR_OPT3001_LIMIT_MAX 0xbfff
+
+static bool _twr_opt3001_initialize(void *param);
+
+static bool _twr_opt3001_trigger(void *param);
+
+static bool _twr_opt3001_read(void *param);
+
+static void _twr_opt3001_event(void *param, twr_sensor_event_t event);
+
+static void _twr_opt3001_reconfigure(twr_opt3001_t *self);
+
+static bool _twr_opt3001_alert_update(twr_opt3001_t *self);
+
+static uint16_t _twr_opt3001_limit(float value);
+
+static void _twr_opt3001_alert_interrupt(twr_exti_line_t line, void *param);
+
+static const twr_sensor_descriptor_t _twr_opt3001_descriptor =
+{
+    .initialize = _twr_opt3001_initialize,
+    .initialization_time = _TWR_OPT3001_DELAY_INITIALIZATION,
+    .trigger = _twr_opt3001_trigger,
+    .conversion_time = _TWR_OPT3001_DELAY_MEASUREMENT,
+    .read = _twr_opt3001_read,
+    .event = _twr_opt3001_event
+};
 
 void twr_opt3001_init(twr_opt3001_t *self, twr_i2c_channel_t i2c_channel, uint8_t i2c_address)
 {
@@ -15,21 +45,21 @@ void twr_opt3001_init(twr_opt3001_t *self, twr_i2c_channel_t i2c_channel, uint8_
     self->_i2c_channel = i2c_channel;
     self->_i2c_address = i2c_address;
 
-    self->_task_id_interval = twr_scheduler_register(_twr_opt3001_task_interval, self, TWR_TICK_INFINITY);
-    self->_task_id_measure = twr_scheduler_register(_twr_opt3001_task_measure, self, _TWR_OPT3001_DELAY_RUN);
-
-    self->_tick_ready = _TWR_OPT3001_DELAY_RUN;
+    twr_sensor_init(&self->_sensor, &_twr_opt3001_descriptor, self, _TWR_OPT3001_DELAY_RUN);
 
     twr_i2c_init(self->_i2c_channel, TWR_I2C_SPEED_400_KHZ);
 }
 
 void twr_opt3001_deinit(twr_opt3001_t *self)
 {
-    twr_i2c_memory_write_16b(self->_i2c_channel, self->_i2c_address, 0x01, 0xc810);
+    if (self->_alert_active)
+    {
+        twr_exti_unregister(self->_alert_line);
+    }
 
-    twr_scheduler_unregister(self->_task_id_interval);
+    twr_i2c_memory_write_16b(self->_i2c_channel, self->_i2c_address, 0x01, _TWR_OPT3001_CONFIG_SHUTDOWN);
 
-    twr_scheduler_unregister(self->_task_id_measure);
+    twr_sensor_unregister(&self->_sensor);
 }
 
 void twr_opt3001_set_event_handler(twr_opt3001_t *self, void (*event_handler)(twr_opt3001_t *, twr_opt3001_event_t, void *), void *event_param)
@@ -40,32 +70,52 @@ void twr_opt3001_set_event_handler(twr_opt3001_t *self, void (*event_handler)(tw
 
 void twr_opt3001_set_update_interval(twr_opt3001_t *self, twr_tick_t interval)
 {
-    self->_update_interval = interval;
+    twr_sensor_set_update_interval(&self->_sensor, interval);
+}
 
-    if (self->_update_interval == TWR_TICK_INFINITY)
+bool twr_opt3001_set_alert(twr_opt3001_t *self, twr_exti_line_t line, float delta)
+{
+    if (!(delta > 0.f))
     {
-        twr_scheduler_plan_absolute(self->_task_id_interval, TWR_TICK_INFINITY);
+        return false;
     }
-    else
-    {
-        twr_scheduler_plan_relative(self->_task_id_interval, self->_update_interval);
 
-        twr_opt3001_measure(self);
+    if (self->_alert_active)
+    {
+        twr_exti_unregister(self->_alert_line);
     }
+
+    self->_alert_active = true;
+    self->_alert_line = line;
+    self->_alert_delta = delta;
+
+    twr_exti_register(line, TWR_EXTI_EDGE_FALLING, _twr_opt3001_alert_interrupt, self);
+
+    _twr_opt3001_reconfigure(self);
+
+    // First result sets the window
+    twr_opt3001_measure(self);
+
+    return true;
 }
 
-bool twr_opt3001_measure(twr_opt3001_t *self)
+void twr_opt3001_clear_alert(twr_opt3001_t *self)
 {
-    if (self->_measurement_active)
+    if (!self->_alert_active)
     {
-        return false;
+        return;
     }
 
-    self->_measurement_active = true;
+    twr_exti_unregister(self->_alert_line);
 
-    twr_scheduler_plan_absolute(self->_task_id_measure, self->_tick_ready);
+    self->_alert_active = false;
 
-    return true;
+    _twr_opt3001_reconfigure(self);
+}
+
+bool twr_opt3001_measure(twr_opt3001_t *self)
+{
+    return twr_sensor_measure(&self->_sensor);
 }
 
 bool twr_opt3001_get_illuminance_raw(twr_opt3001_t *self, uint16_t *raw)
@@ -94,118 +144,145 @@ bool twr_opt3001_get_illuminance_lux(twr_opt3001_t *self, float *lux)
     return true;
 }
 
-static void _twr_opt3001_task_interval(void *param)
+static bool _twr_opt3001_initialize(void *param)
 {
     twr_opt3001_t *self = param;
 
-    twr_opt3001_measure(self);
+    if (!self->_alert_active)
+    {
+        return twr_i2c_memory_write_16b(self->_i2c_channel, self->_i2c_address, 0x01, _TWR_OPT3001_CONFIG_SHUTDOWN);
+    }
+
+    // Window over the whole range keeps INT quiet until the first result is known
+    if (!twr_i2c_memory_write_16b(self->_i2c_channel, self->_i2c_address, 0x02, 0x0000))
+    {
+        return false;
+    }
+
+    if (!twr_i2c_memory_write_16b(self->_i2c_channel, self->_i2c_address, 0x03, _TWR_OPT3001_LIMIT_MAX))
+    {
+        return false;
+    }
+
+    if (!twr_i2c_memory_write_16b(self->_i2c_channel, self->_i2c_address, 0x01, _TWR_OPT3001_CONFIG_CONTINUOUS))
+    {
+        return false;
+    }
+
+    // The first conversion has to finish before the result is read
+    twr_sensor_hold_read(&self->_sensor, twr_tick_get() + _TWR_OPT3001_DELAY_MEASUREMENT);
 
-    twr_scheduler_plan_current_relative(self->_update_interval);
+    return true;
 }
 
-static void _twr_opt3001_task_measure(void *param)
+static bool _twr_opt3001_trigger(void *param)
 {
     twr_opt3001_t *self = param;
 
-start:
+    return twr_i2c_memory_write_16b(self->_i2c_channel, self->_i2c_address, 0x01, _TWR_OPT3001_CONFIG_SINGLE_SHOT);
+}
 
-    switch (self->_state)
-    {
-        case TWR_OPT3001_STATE_ERROR:
-        {
-            self->_illuminance_valid = false;
+static bool _twr_opt3001_read(void *param)
+{
+    twr_opt3001_t *self = param;
 
-            self->_measurement_active = false;
+    uint16_t reg_configuration;
 
-            if (self->_event_handler != NULL)
-            {
-                self->_event_handler(self, TWR_OPT3001_EVENT_ERROR, self->_event_param);
-            }
+    // Reading configuration clears latched INT
+    if (!twr_i2c_memory_read_16b(self->_i2c_channel, self->_i2c_address, 0x01, &reg_configuration))
+    {
+        return false;
+    }
 
-            self->_state = TWR_OPT3001_STATE_INITIALIZE;
+    if (!self->_alert_active && (reg_configuration & 0x0680) != 0x0080)
+    {
+        return false;
+    }
 
-            return;
-        }
-        case TWR_OPT3001_STATE_INITIALIZE:
-        {
-            self->_state = TWR_OPT3001_STATE_ERROR;
+    if (!twr_i2c_memory_read_16b(self->_i2c_channel, self->_i2c_address, 0x00, &self->_reg_result))
+    {
+        return false;
+    }
 
-            if (!twr_i2c_memory_write_16b(self->_i2c_channel, self->_i2c_address, 0x01, 0xc810))
-            {
-                goto start;
-            }
+    if (self->_alert_active && !_twr_opt3001_alert_update(self))
+    {
+        return false;
+    }
 
-            self->_state = TWR_OPT3001_STATE_MEASURE;
+    self->_illuminance_valid = true;
 
-            self->_tick_ready = twr_tick_get() + _TWR_OPT3001_DELAY_INITIALIZATION;
+    return true;
+}
 
-            if (self->_measurement_active)
-            {
-                twr_scheduler_plan_current_absolute(self->_tick_ready);
-            }
+static void _twr_opt3001_event(void *param, twr_sensor_event_t event)
+{
+    twr_opt3001_t *self = param;
 
-            return;
-        }
-        case TWR_OPT3001_STATE_MEASURE:
-        {
-            self->_state = TWR_OPT3001_STATE_ERROR;
+    if (event == TWR_SENSOR_EVENT_ERROR)
+    {
+        self->_illuminance_valid = false;
+    }
 
-            if (!twr_i2c_memory_write_16b(self->_i2c_channel, self->_i2c_address, 0x01, 0xca10))
-            {
-                goto start;
-            }
+    if (self->_event_handler != NULL)
+    {
+        self->_event_handler(self, event == TWR_SENSOR_EVENT_ERROR ? TWR_OPT3001_EVENT_ERROR : TWR_OPT3001_EVENT_UPDATE, self->_event_param);
+    }
+}
 
-            self->_state = TWR_OPT3001_STATE_READ;
+static void _twr_opt3001_reconfigure(twr_opt3001_t *self)
+{
+    // Continuous conversion has the last result ready all the time
+    twr_sensor_set_conversion_time(&self->_sensor, self->_alert_active ? 0 : _TWR_OPT3001_DELAY_MEASUREMENT);
 
-            twr_scheduler_plan_current_from_now(_TWR_OPT3001_DELAY_MEASUREMENT);
+    // Configuration is written again before next measurement
+    twr_sensor_reinitialize(&self->_sensor);
+}
 
-            return;
-        }
-        case TWR_OPT3001_STATE_READ:
-        {
-            self->_state = TWR_OPT3001_STATE_ERROR;
+static bool _twr_opt3001_alert_update(twr_opt3001_t *self)
+{
+    // Value in units of 0.01 lux
+    float value = (float) ((uint32_t) (self->_reg_result & 0xfff) << (self->_reg_result >> 12));
 
-            uint16_t reg_configuration;
+    uint16_t low = _twr_opt3001_limit(value * (1.f - self->_alert_delta));
+    uint16_t high = _twr_opt3001_limit(value * (1.f + self->_alert_delta));
 
-            if (!twr_i2c_memory_read_16b(self->_i2c_channel, self->_i2c_address, 0x01, &reg_configuration))
-            {
-                goto start;
-            }
+    if (!twr_i2c_memory_write_16b(self->_i2c_channel, self->_i2c_address, 0x02, low))
+    {
+        return false;
+    }
 
-            if ((reg_configuration & 0x0680) != 0x0080)
-            {
-                goto start;
-            }
+    return twr_i2c_memory_write_16b(self->_i2c_channel, self->_i2c_address, 0x03, high);
+}
 
-            if (!twr_i2c_memory_read_16b(self->_i2c_channel, self->_i2c_address, 0x00, &self->_reg_result))
-            {
-                goto start;
-            }
+static uint16_t _twr_opt3001_limit(float value)
+{
+    if (!(value > 0.f))
+    {
+        return 0x0000;
+    }
 
-            self->_illuminance_valid = true;
+    if (value >= (float) (0xfff << 11))
+    {
+        return _TWR_OPT3001_LIMIT_MAX;
+    }
 
-            self->_state = TWR_OPT3001_STATE_UPDATE;
+    uint32_t mantissa = (uint32_t) value;
+    uint16_t exponent = 0;
 
-            goto start;
-        }
-        case TWR_OPT3001_STATE_UPDATE:
-        {
-            self->_measurement_active = false;
+    while (mantissa > 0xfff)
+    {
+        mantissa >>= 1;
+        exponent++;
+    }
 
-            if (self->_event_handler != NULL)
-            {
-                self->_event_handler(self, TWR_OPT3001_EVENT_UPDATE, self->_event_param);
-            }
+    return exponent << 12 | mantissa;
+}
 
-            self->_state = TWR_OPT3001_STATE_MEASURE;
+static void _twr_opt3001_alert_interrupt(twr_exti_line_t line, void *param)
+{
+    (void) line;
 
-            return;
-        }
-        default:
-        {
-            self->_state = TWR_OPT3001_STATE_ERROR;
+    twr_opt3001_t *self = param;
 
-            goto start;
-        }
-    }
+    twr_sensor_signal(&self->_sensor);
 }
@@ -0,0 +1,123 @@
+#include <twr_payload.h>
+
+static uint32_t _twr_payload_get_count(const twr_payload_field_t *field);
+
+int twr_payload_get_field_bits(const twr_payload_field_t *field)
+{
+    if (!(field->resolution > 0.f) || !(field->maximum >= field->minimum))
+    {
+        return 0;
+    }
+
+    // Range with extra code for value which is not available
+    float codes = floorf((field->maximum - field->minimum) / field->resolution + 0.5f) + 2.f;
+
+    for (int bits = 1; bits <= TWR_PAYLOAD_FIELD_BITS_MAX; bits++)
+    {
+        if (codes <= ldexpf(1.f, bits))
+        {
+            return bits;
+        }
+    }
+
+    return 0;
+}
+
+size_t twr_payload_get_length(const twr_payload_schema_t *schema)
+{
+    size_t bits = 0;
+
+    for (size_t i = 0; i < schema->count; i++)
+    {
+        int field_bits = twr_payload_get_field_bits(&schema->field[i]);
+
+        if (field_bits == 0)
+        {
+            return 0;
+        }
+
+        bits += field_bits;
+    }
+
+    return (bits + 7) / 8;
+}
+
+size_t twr_payload_pack(const twr_payload_schema_t *schema, const float *value, uint8_t *buffer, size_t size)
+{
+    size_t length = twr_payload_get_length(schema);
+
+    if (length == 0 || length > size)
+    {
+        return 0;
+    }
+
+    memset(buffer, 0, length);
+
+    size_t position = 0;
+
+    for (size_t i = 0; i < schema->count; i++)
+    {
+        const twr_payload_field_t *field = &schema->field[i];
+        int bits = twr_payload_get_field_bits(field);
+        uint32_t code = 0xffffffff >> (32 - bits);
+
+        if (!isnan(value[i]))
+        {
+            float scaled = (value[i] - field->minimum) / field->resolution + 0.5f;
+            uint32_t count = _twr_payload_get_count(field);
+
+            code = scaled <= 0.f ? 0 : scaled >= (float) count ? count - 1 : (uint32_t) scaled;
+        }
+
+        // Code is written MSB first, bit by bit across byte boundaries
+        for (int b = bits - 1; b >= 0; b--, position++)
+        {
+            if ((code >> b) & 1)
+            {
+                buffer[position / 8] |= 0x80 >> (position % 8);
+            }
+        }
+    }
+
+    return length;
+}
+
+bool twr_payload_unpack(const twr_payload_schema_t *schema, const uint8_t *buffer, size_t length, float *value)
+{
+    size_t payload_length = twr_payload_get_length(schema);
+
+    if (payload_length == 0 || length < payload_length)
+    {
+        return false;
+    }
+
+    size_t position = 0;
+
+    for (size_t i = 0; i < schema->count; i++)
+    {
+        const twr_payload_field_t *field = &schema->field[i];
+        int bits = twr_payload_get_field_bits(field);
+        uint32_t code = 0;
+
+        for (int b = 0; b < bits; b++, position++)
+        {
+            code = (code << 1) | ((buffer[position / 8] >> (7 - position % 8)) & 1);
+        }
+
+        if (code == 0xffffffff >> (32 - bits))
+        {
+            value[i] = NAN;
+        }
+        else
+        {
+            value[i] = field->minimum + code * field->resolution;
+        }
+    }
+
+    return true;
+}
+
+static uint32_t _twr_payload_get_count(const twr_payload_field_t *field)
+{
+    return (uint32_t) floorf((field->maximum - field->minimum) / field->resolution + 0.5f) + 1;
+}
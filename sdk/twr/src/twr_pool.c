@@ -0,0 +1,124 @@
+#include <twr_pool.h>
+#include <twr_irq.h>
+
+#if (TWR_POOL_SHARED_BLOCKS > TWR_POOL_BLOCKS_MAX) || (TWR_POOL_SHARED_BLOCK_SIZE % 4 != 0)
+#error "Shared pool has to have up to TWR_POOL_BLOCKS_MAX blocks of size multiple of 4"
+#endif
+
+static uint32_t _twr_pool_shared_storage[TWR_POOL_SHARED_BLOCKS][TWR_POOL_SHARED_BLOCK_SIZE / 4];
+
+static twr_pool_t _twr_pool_shared;
+
+static int _twr_pool_index(twr_pool_t *self, void *buffer);
+
+void twr_pool_init(twr_pool_t *self, void *storage, size_t block_size, size_t count)
+{
+    memset(self, 0, sizeof(*self));
+
+    if (count > TWR_POOL_BLOCKS_MAX)
+    {
+        count = TWR_POOL_BLOCKS_MAX;
+    }
+
+    self->_storage = storage;
+    self->_block_size = block_size;
+    self->_count = count;
+    self->_free = count == 32 ? UINT32_MAX : (1UL << count) - 1;
+}
+
+void *twr_pool_alloc(twr_pool_t *self)
+{
+    uint32_t primask = twr_irq_save();
+
+    if (self->_free == 0)
+    {
+        twr_irq_restore(primask);
+
+        return NULL;
+    }
+
+    int index = __builtin_ctz(self->_free);
+
+    self->_free &= ~(1UL << index);
+
+    self->_references[index] = 1;
+
+    twr_irq_restore(primask);
+
+    return self->_storage + index * self->_block_size;
+}
+
+void twr_pool_ref(twr_pool_t *self, void *buffer)
+{
+    int index = _twr_pool_index(self, buffer);
+
+    if (index < 0)
+    {
+        return;
+    }
+
+    uint32_t primask = twr_irq_save();
+
+    if (self->_references[index] != 0 && self->_references[index] != UINT8_MAX)
+    {
+        self->_references[index]++;
+    }
+
+    twr_irq_restore(primask);
+}
+
+void twr_pool_unref(twr_pool_t *self, void *buffer)
+{
+    int index = _twr_pool_index(self, buffer);
+
+    if (index < 0)
+    {
+        return;
+    }
+
+    uint32_t primask = twr_irq_save();
+
+    if (self->_references[index] != 0 && --self->_references[index] == 0)
+    {
+        self->_free |= 1UL << index;
+    }
+
+    twr_irq_restore(primask);
+}
+
+size_t twr_pool_get_block_size(twr_pool_t *self)
+{
+    return self->_block_size;
+}
+
+size_t twr_pool_get_free(twr_pool_t *self)
+{
+    return __builtin_popcount(self->_free);
+}
+
+twr_pool_t *twr_pool_get_shared(void)
+{
+    uint32_t primask = twr_irq_save();
+
+    if (_twr_pool_shared._storage == NULL)
+    {
+        twr_pool_init(&_twr_pool_shared, _twr_pool_shared_storage, TWR_POOL_SHARED_BLOCK_SIZE, TWR_POOL_SHARED_BLOCKS);
+    }
+
+    twr_irq_restore(primask);
+
+    return &_twr_pool_shared;
+}
+
+static int _twr_pool_index(twr_pool_t *self, void *buffer)
+{
+    uint8_t *p = buffer;
+
+    if (p == NULL || p < self->_storage || p >= self->_storage + self->_count * self->_block_size)
+    {
+        return -1;
+    }
+
+    // Pointer anywhere inside block refers to it, so layers can pass offset views
+    return (p - self->_storage) / self->_block_size;
+}
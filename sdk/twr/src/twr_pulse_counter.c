@@ -5,6 +5,8 @@ typedef struct
 {
     twr_module_sensor_channel_t channel;
     unsigned int count;
+    unsigned int count_reported;
+    bool deferred;
     twr_pulse_counter_edge_t edge;
     twr_tick_t update_interval;
     void (*event_handler)(twr_module_sensor_channel_t, twr_pulse_counter_event_t, void *);
@@ -63,9 +65,16 @@ void twr_pulse_counter_set_update_interval(twr_module_sensor_channel_t channel,
     }
 }
 
+void twr_pulse_counter_set_deferred(twr_module_sensor_channel_t channel, bool deferred)
+{
+    _twr_module_pulse_counter[channel].count_reported = _twr_module_pulse_counter[channel].count;
+    _twr_module_pulse_counter[channel].deferred = deferred;
+}
+
 void twr_pulse_counter_set(twr_module_sensor_channel_t channel, unsigned int count)
 {
     _twr_module_pulse_counter[channel].count = count;
+    _twr_module_pulse_counter[channel].count_reported = count;
 }
 
 unsigned int twr_pulse_counter_get(twr_module_sensor_channel_t channel)
@@ -76,12 +85,21 @@ unsigned int twr_pulse_counter_get(twr_module_sensor_channel_t channel)
 void twr_pulse_counter_reset(twr_module_sensor_channel_t channel)
 {
     _twr_module_pulse_counter[channel].count = 0;
+    _twr_module_pulse_counter[channel].count_reported = 0;
 }
 
 static void _twr_pulse_counter_channel_task_update(void *param)
 {
     twr_pulse_counter_t *self = param;
 
+    if (self->deferred && (self->count != self->count_reported) && !self->pending_event_flag)
+    {
+        self->pending_event_flag = true;
+        self->pending_event = TWR_PULSE_COUNTER_EVENT_UPDATE;
+    }
+
+    self->count_reported = self->count;
+
     if (self->pending_event_flag)
     {
         self->pending_event_flag = false;
@@ -112,6 +130,12 @@ static void _twr_pulse_counter_channel_exti(twr_exti_line_t line, void *param)
 
     _twr_module_pulse_counter[channel].count++;
 
+    // Count is reported by update interval task
+    if (_twr_module_pulse_counter[channel].deferred && _twr_module_pulse_counter[channel].count != 0)
+    {
+        return;
+    }
+
     _twr_module_pulse_counter[channel].pending_event_flag = true;
     _twr_module_pulse_counter[channel].pending_event = TWR_PULSE_COUNTER_EVENT_UPDATE;
 
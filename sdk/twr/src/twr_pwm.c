@@ -24,6 +24,19 @@
     P17 PB9 none
 */
 
+static struct
+{
+    bool active;
+    bool circular;
+    twr_dma_channel_t dma_channel;
+    void (*event_handler)(twr_pwm_tim_t, void *);
+    void *event_param;
+
+} _twr_pwm_burst[TWR_PWM_TIM21_P12_P14];
+
+static bool _twr_pwm_get_compare(twr_pwm_channel_t channel, twr_pwm_tim_t *tim, int *index);
+static void _twr_pwm_burst_dma_handler(twr_dma_channel_t channel, twr_dma_event_t event, void *event_param);
+
 static void _twr_pwm_tim2_configure(uint32_t resolution_us, uint32_t period_cycles)
 {
     // Enable TIM2 clock
@@ -245,3 +258,156 @@ void twr_pwm_set(twr_pwm_channel_t channel, uint16_t pwm_value)
         }
     }
 }
+
+bool twr_pwm_burst_start(twr_pwm_channel_t first, twr_pwm_channel_t last, const uint16_t *sequence, size_t count, bool circular, void (*event_handler)(twr_pwm_tim_t, void *), void *event_param)
+{
+    twr_pwm_tim_t tim;
+    twr_pwm_tim_t tim_last;
+    int index;
+    int index_last;
+
+    if (!_twr_pwm_get_compare(first, &tim, &index) || !_twr_pwm_get_compare(last, &tim_last, &index_last))
+    {
+        return false;
+    }
+
+    if (tim != tim_last || index > index_last || tim == TWR_PWM_TIM21_P12_P14 || count == 0)
+    {
+        return false;
+    }
+
+    if (_twr_pwm_burst[tim].active)
+    {
+        return false;
+    }
+
+    twr_dma_channel_config_t config =
+    {
+        .direction = TWR_DMA_DIRECTION_TO_PERIPHERAL,
+        .data_size_memory = TWR_DMA_SIZE_2,
+        .data_size_peripheral = TWR_DMA_SIZE_2,
+        .length = count * (index_last - index + 1),
+        .mode = circular ? TWR_DMA_MODE_CIRCULAR : TWR_DMA_MODE_STANDARD,
+        .address_memory = (void *) sequence,
+        .priority = TWR_DMA_PRIORITY_LOW
+    };
+
+    TIM_TypeDef *instance = tim == TWR_PWM_TIM2_P0_P1_P2_P3 ? TIM2 : TIM3;
+
+    config.address_peripheral = (void *) &instance->DMAR;
+
+    if (!twr_dma_channel_allocate(tim == TWR_PWM_TIM2_P0_P1_P2_P3 ? TWR_DMA_LINE_TIM2_UP : TWR_DMA_LINE_TIM3_UP, &_twr_pwm_burst[tim].dma_channel, &config.request))
+    {
+        return false;
+    }
+
+    _twr_pwm_burst[tim].active = true;
+    _twr_pwm_burst[tim].circular = circular;
+    _twr_pwm_burst[tim].event_handler = event_handler;
+    _twr_pwm_burst[tim].event_param = event_param;
+
+    twr_dma_init();
+
+    twr_dma_channel_config(_twr_pwm_burst[tim].dma_channel, &config);
+
+    twr_dma_set_event_handler(_twr_pwm_burst[tim].dma_channel, _twr_pwm_burst_dma_handler, (void *) tim);
+
+    twr_dma_channel_run(_twr_pwm_burst[tim].dma_channel);
+
+    // Every update event writes one frame through DMAR to compare registers starting by the first one
+    instance->DCR = (index_last - index) << TIM_DCR_DBL_Pos | (offsetof(TIM_TypeDef, CCR1) / 4 + index) << TIM_DCR_DBA_Pos;
+
+    instance->DIER |= TIM_DIER_UDE;
+
+    return true;
+}
+
+void twr_pwm_burst_stop(twr_pwm_tim_t tim)
+{
+    if (tim == TWR_PWM_TIM21_P12_P14 || !_twr_pwm_burst[tim].active)
+    {
+        return;
+    }
+
+    TIM_TypeDef *instance = tim == TWR_PWM_TIM2_P0_P1_P2_P3 ? TIM2 : TIM3;
+
+    instance->DIER &= ~TIM_DIER_UDE;
+
+    twr_dma_channel_stop(_twr_pwm_burst[tim].dma_channel);
+
+    twr_dma_set_event_handler(_twr_pwm_burst[tim].dma_channel, NULL, NULL);
+
+    twr_dma_channel_release(_twr_pwm_burst[tim].dma_channel);
+
+    _twr_pwm_burst[tim].active = false;
+}
+
+static bool _twr_pwm_get_compare(twr_pwm_channel_t channel, twr_pwm_tim_t *tim, int *index)
+{
+    switch (channel)
+    {
+        case TWR_PWM_P0:
+        case TWR_PWM_P1:
+        case TWR_PWM_P2:
+        case TWR_PWM_P3:
+        {
+            *tim = TWR_PWM_TIM2_P0_P1_P2_P3;
+            *index = channel - TWR_PWM_P0;
+            return true;
+        }
+        case TWR_PWM_P7:
+        {
+            *tim = TWR_PWM_TIM3_P6_P7_P8;
+            *index = 0;
+            return true;
+        }
+        case TWR_PWM_P8:
+        {
+            *tim = TWR_PWM_TIM3_P6_P7_P8;
+            *index = 2;
+            return true;
+        }
+        case TWR_PWM_P6:
+        {
+            *tim = TWR_PWM_TIM3_P6_P7_P8;
+            *index = 3;
+            return true;
+        }
+        case TWR_PWM_P14:
+        {
+            *tim = TWR_PWM_TIM21_P12_P14;
+            *index = 0;
+            return true;
+        }
+        case TWR_PWM_P12:
+        {
+            *tim = TWR_PWM_TIM21_P12_P14;
+            *index = 1;
+            return true;
+        }
+        default:
+        {
+            return false;
+        }
+    }
+}
+
+static void _twr_pwm_burst_dma_handler(twr_dma_channel_t channel, twr_dma_event_t event, void *event_param)
+{
+    (void) channel;
+
+    twr_pwm_tim_t tim = (twr_pwm_tim_t) event_param;
+
+    // Circular sequence ends only by error
+    if (event == TWR_DMA_EVENT_HALF_DONE || (event == TWR_DMA_EVENT_DONE && _twr_pwm_burst[tim].circular))
+    {
+        return;
+    }
+
+    twr_pwm_burst_stop(tim);
+
+    if (_twr_pwm_burst[tim].event_handler != NULL)
+    {
+        _twr_pwm_burst[tim].event_handler(tim, _twr_pwm_burst[tim].event_param);
+    }
+}
@@ -3,6 +3,7 @@
 #include <twr_gpio.h>
 #include <twr_system.h>
 #include <twr_timer.h>
+#include <twr_dma.h>
 #include <stm32l0xx.h>
 
 #define TWR_PYQ1648_BPF 0x00
@@ -13,10 +14,31 @@
 #define TWR_PYQ1648_DELAY_INITIALIZATION 10
 #define TWR_PYQ1648_UPDATE_INTERVAL 100
 
+// Every configuration bit is low for 1 us, high for 1 us and then holds its value for 81 us
+#define _TWR_PYQ1648_SERIN_BITS 25
+#define _TWR_PYQ1648_SERIN_PHASES (_TWR_PYQ1648_SERIN_BITS * 3 + 1)
+
+// Compare match of channel 2 shortly after each update event loads period of the next phase
+#define _TWR_PYQ1648_SERIN_COMPARE 8
+
 static inline void _twr_pyq1648_msp_init(twr_gpio_channel_t gpio_channel_serin, twr_gpio_channel_t gpio_channel_dl);
 static inline void _twr_pyq1648_dev_init(twr_pyq1648_t *self);
 static inline void _twr_pyq1648_compose_event_unit_config(twr_pyq1648_t *self);
 static void _twr_pyq1648_task(void *param);
+static void _twr_pyq1648_exti_handler(twr_exti_line_t line, void *param);
+static bool _twr_pyq1648_dev_init_dma(twr_pyq1648_t *self);
+static void _twr_pyq1648_serin_dma_irq_handler(twr_dma_channel_t channel, twr_dma_event_t event, void *param);
+
+// Auto-reload values in 32 MHz ticks loaded one phase ahead, so the sequence starts by period of the second phase
+static const uint16_t _twr_pyq1648_serin_period[3] = { 32 - 1, 2592 - 1, 32 - 1 };
+
+static struct
+{
+    uint32_t bsrr[_TWR_PYQ1648_SERIN_PHASES];
+    twr_dma_channel_t update_channel;
+    twr_dma_channel_t compare_channel;
+
+} _twr_pyq1648_serin;
 
 static const uint8_t _twr_pyq1648_sensitivity_table[4] =
 {
@@ -26,14 +48,6 @@ static const uint8_t _twr_pyq1648_sensitivity_table[4] =
     [TWR_PYQ1648_SENSITIVITY_VERY_HIGH] = 9
 };
 
-extern GPIO_TypeDef * twr_gpio_port[];
-extern uint16_t twr_gpio_16_bit_mask[];
-extern uint32_t twr_gpio_32_bit_upper_mask[];
-
-static GPIO_TypeDef **_pyq1648_gpiox_table = twr_gpio_port;
-static uint16_t *_pyq1648_set_mask = twr_gpio_16_bit_mask;
-static uint32_t *_pyq1648_reset_mask = twr_gpio_32_bit_upper_mask;
-
 void twr_pyq1648_init(twr_pyq1648_t *self, twr_gpio_channel_t gpio_channel_serin, twr_gpio_channel_t gpio_channel_dl)
 {
     // Initialize structure
@@ -79,6 +93,31 @@ void twr_pyq1648_set_blank_period(twr_pyq1648_t *self, twr_tick_t blank_period)
 {
     // Set blank period
     self->_blank_period = blank_period;
+
+    if (self->_wake_on_event)
+    {
+        self->_state = TWR_PYQ1648_STATE_INITIALIZE;
+
+        twr_scheduler_plan_now(self->_task_id);
+    }
+}
+
+void twr_pyq1648_set_wake_on_event(twr_pyq1648_t *self, twr_exti_line_t line)
+{
+    if (self->_wake_on_event)
+    {
+        return;
+    }
+
+    self->_wake_on_event = true;
+
+    // Callback plans task only in check state
+    twr_exti_register_deferred(line, TWR_EXTI_EDGE_RISING, _twr_pyq1648_exti_handler, self);
+
+    // Blind time is part of event unit configuration
+    self->_state = TWR_PYQ1648_STATE_INITIALIZE;
+
+    twr_scheduler_plan_now(self->_task_id);
 }
 
 void _twr_pyq1648_compose_event_unit_config(twr_pyq1648_t *self)
@@ -93,6 +132,14 @@ void _twr_pyq1648_compose_event_unit_config(twr_pyq1648_t *self)
 
     self->_config = 0x00000000;
     self->_config |= (self->_sensitivity << 17) | (TWR_PYQ1648_WAKE_UP_MODE << 7) | (TWR_PYQ1648_BPF << 5) |0x10;
+
+    if (self->_wake_on_event)
+    {
+        // Blind time is 0.5 s + 0.5 s * value
+        uint32_t blind = self->_blank_period > 500 ? (self->_blank_period - 500 + 250) / 500 : 0;
+
+        self->_config |= (blind > 15 ? 15 : blind) << 13;
+    }
 }
 
 static inline void _twr_pyq1648_msp_init(twr_gpio_channel_t gpio_channel_serin, twr_gpio_channel_t gpio_channel_dl)
@@ -115,9 +162,14 @@ static void _twr_pyq1648_clear_event(twr_pyq1648_t *self)
     twr_gpio_set_mode(self->_gpio_channel_dl, TWR_GPIO_MODE_INPUT);
 }
 
-// TODO Consider using "OneWire"
 static inline void _twr_pyq1648_dev_init(twr_pyq1648_t *self)
 {
+    // Waveform generated by timer and DMA does not need critical section
+    if (_twr_pyq1648_dev_init_dma(self))
+    {
+        return;
+    }
+
     // Disable interrupts
     twr_irq_disable();
 
@@ -132,10 +184,10 @@ static inline void _twr_pyq1648_dev_init(twr_pyq1648_t *self)
     // Prepare fast GPIO access
     uint32_t bsrr_mask[2] =
     {
-        [0] = _pyq1648_reset_mask[self->_gpio_channel_serin],
-        [1] = _pyq1648_set_mask[self->_gpio_channel_serin]
+        [0] = twr_gpio_32_bit_upper_mask[self->_gpio_channel_serin],
+        [1] = twr_gpio_16_bit_mask[self->_gpio_channel_serin]
     };
-    GPIO_TypeDef *GPIOx = _pyq1648_gpiox_table[self->_gpio_channel_serin];
+    GPIO_TypeDef *GPIOx = twr_gpio_port[self->_gpio_channel_serin];
     volatile uint32_t *GPIOx_BSRR = &GPIOx->BSRR;
 
     // Low level pin initialization
@@ -182,6 +234,124 @@ static inline void _twr_pyq1648_dev_init(twr_pyq1648_t *self)
     twr_irq_enable();
 }
 
+static bool _twr_pyq1648_dev_init_dma(twr_pyq1648_t *self)
+{
+    if ((TIM2->CR1 & TIM_CR1_CEN) != 0)
+    {
+        // TIM2 is busy
+        return false;
+    }
+
+    twr_dma_channel_config_t update_config =
+    {
+        .direction = TWR_DMA_DIRECTION_TO_PERIPHERAL,
+        .data_size_memory = TWR_DMA_SIZE_4,
+        .data_size_peripheral = TWR_DMA_SIZE_4,
+        .length = _TWR_PYQ1648_SERIN_PHASES - 1,
+        .mode = TWR_DMA_MODE_STANDARD,
+        .address_memory = &_twr_pyq1648_serin.bsrr[1],
+        .address_peripheral = (void *) &twr_gpio_port[self->_gpio_channel_serin]->BSRR,
+        .priority = TWR_DMA_PRIORITY_VERY_HIGH
+    };
+
+    twr_dma_channel_config_t compare_config =
+    {
+        .direction = TWR_DMA_DIRECTION_TO_PERIPHERAL,
+        .data_size_memory = TWR_DMA_SIZE_2,
+        .data_size_peripheral = TWR_DMA_SIZE_2,
+        .length = 3,
+        .mode = TWR_DMA_MODE_CIRCULAR,
+        .address_memory = (void *) _twr_pyq1648_serin_period,
+        .address_peripheral = (void *) &TIM2->ARR,
+        .priority = TWR_DMA_PRIORITY_VERY_HIGH
+    };
+
+    // Channels are kept until the waveform ends, so they guard the shared buffer as well
+    if (!twr_dma_channel_allocate(TWR_DMA_LINE_TIM2_UP, &_twr_pyq1648_serin.update_channel, &update_config.request))
+    {
+        return false;
+    }
+
+    if (!twr_dma_channel_allocate(TWR_DMA_LINE_TIM2_CH2, &_twr_pyq1648_serin.compare_channel, &compare_config.request))
+    {
+        twr_dma_channel_release(_twr_pyq1648_serin.update_channel);
+
+        return false;
+    }
+
+    uint32_t regmask = 0x1000000;
+
+    for (int i = 0; i < _TWR_PYQ1648_SERIN_BITS; i++)
+    {
+        _twr_pyq1648_serin.bsrr[i * 3] = twr_gpio_32_bit_upper_mask[self->_gpio_channel_serin];
+        _twr_pyq1648_serin.bsrr[i * 3 + 1] = twr_gpio_16_bit_mask[self->_gpio_channel_serin];
+        _twr_pyq1648_serin.bsrr[i * 3 + 2] = (self->_config & regmask) != 0 ? twr_gpio_16_bit_mask[self->_gpio_channel_serin] : twr_gpio_32_bit_upper_mask[self->_gpio_channel_serin];
+
+        regmask >>= 1;
+    }
+
+    _twr_pyq1648_serin.bsrr[_TWR_PYQ1648_SERIN_PHASES - 1] = twr_gpio_32_bit_upper_mask[self->_gpio_channel_serin];
+
+    // Low level pin initialization
+    _twr_pyq1648_msp_init(self->_gpio_channel_serin, self->_gpio_channel_dl);
+
+    twr_system_pll_enable();
+
+    RCC->APB1ENR |= RCC_APB1ENR_TIM2EN;
+
+    // Errata workaround
+    RCC->APB1ENR;
+
+    // Auto-reload preload, period of the first phase is loaded by update generation
+    TIM2->CR1 = TIM_CR1_ARPE;
+    TIM2->PSC = 0;
+    TIM2->ARR = _twr_pyq1648_serin_period[2];
+    TIM2->CCMR1 = 0;
+    TIM2->CCER = 0;
+    TIM2->CCR2 = _TWR_PYQ1648_SERIN_COMPARE;
+    TIM2->EGR = TIM_EGR_UG;
+    TIM2->SR = 0;
+
+    twr_dma_init();
+
+    twr_dma_channel_config(_twr_pyq1648_serin.update_channel, &update_config);
+    twr_dma_channel_config(_twr_pyq1648_serin.compare_channel, &compare_config);
+
+    twr_dma_set_irq_handler(_twr_pyq1648_serin.update_channel, _twr_pyq1648_serin_dma_irq_handler, NULL);
+
+    twr_dma_channel_run(_twr_pyq1648_serin.update_channel);
+    twr_dma_channel_run(_twr_pyq1648_serin.compare_channel);
+
+    TIM2->DIER = TIM_DIER_UDE | TIM_DIER_CC2DE;
+
+    // The first phase is started right away, the others are written on update events
+    twr_gpio_port[self->_gpio_channel_serin]->BSRR = _twr_pyq1648_serin.bsrr[0];
+
+    TIM2->CR1 |= TIM_CR1_CEN;
+
+    return true;
+}
+
+static void _twr_pyq1648_serin_dma_irq_handler(twr_dma_channel_t channel, twr_dma_event_t event, void *param)
+{
+    (void) channel;
+    (void) param;
+
+    if (event == TWR_DMA_EVENT_HALF_DONE)
+    {
+        return;
+    }
+
+    // Pin has been set low by the last phase
+    TIM2->CR1 = 0;
+    TIM2->DIER = 0;
+
+    twr_dma_channel_release(_twr_pyq1648_serin.compare_channel);
+    twr_dma_channel_release(_twr_pyq1648_serin.update_channel);
+
+    twr_system_pll_disable();
+}
+
 static void _twr_pyq1648_task(void *param)
 {
     twr_pyq1648_t *self = param;
@@ -241,6 +411,21 @@ start:
                 self->_state = TWR_PYQ1648_STATE_IGNORE;
             }
 
+            if (self->_wake_on_event)
+            {
+                // Event raised during settling is cleared once at its end
+                if (self->_state == TWR_PYQ1648_STATE_CHECK)
+                {
+                    twr_scheduler_plan_current_now();
+                }
+                else
+                {
+                    twr_scheduler_plan_current_absolute(self->_ignore_untill);
+                }
+
+                return;
+            }
+
             twr_scheduler_plan_current_relative(TWR_PYQ1648_UPDATE_INTERVAL);
 
             return;
@@ -267,7 +452,10 @@ start:
 
             self->_state = TWR_PYQ1648_STATE_CHECK;
 
-            twr_scheduler_plan_current_relative(TWR_PYQ1648_UPDATE_INTERVAL);
+            if (!self->_wake_on_event)
+            {
+                twr_scheduler_plan_current_relative(TWR_PYQ1648_UPDATE_INTERVAL);
+            }
 
             return;
         }
@@ -279,3 +467,15 @@ start:
         }
     }
 }
+
+static void _twr_pyq1648_exti_handler(twr_exti_line_t line, void *param)
+{
+    (void) line;
+
+    twr_pyq1648_t *self = param;
+
+    if (self->_state == TWR_PYQ1648_STATE_CHECK)
+    {
+        twr_scheduler_plan_now(self->_task_id);
+    }
+}
@@ -1,5 +1,16 @@
 #include <twr_queue.h>
 
+// Zero length in place of message header marks the skipped end of buffer
+#define _TWR_QUEUE_WRAP 0x00
+
+#define _TWR_QUEUE_HEADER_LONG 0x80
+
+static inline void _twr_queue_stats_put(twr_queue_t *queue, bool success);
+static inline uint8_t _twr_queue_header_size(size_t length);
+static bool _twr_queue_alloc(twr_queue_t *queue, size_t total, size_t *offset);
+static void _twr_queue_append(twr_queue_t *queue, size_t offset, uint8_t header, size_t length);
+static uint8_t *_twr_queue_front(twr_queue_t *queue, size_t *length, uint8_t *header);
+
 void twr_queue_init(twr_queue_t *queue, void *buffer, size_t size)
 {
     memset(queue, 0, sizeof(*queue));
@@ -15,20 +26,17 @@ bool twr_queue_put(twr_queue_t *queue, const void *buffer, size_t length)
         return true;
     }
 
-    if (sizeof(length) + length > queue->_size - queue->_length)
+    uint8_t header = _twr_queue_header_size(length);
+    size_t offset;
+
+    if (length > TWR_QUEUE_MESSAGE_LENGTH_MAX || !_twr_queue_alloc(queue, header + length, &offset))
     {
+        _twr_queue_stats_put(queue, false);
+
         return false;
     }
 
-    uint8_t *p = queue->_buffer;
-
-    p += queue->_length;
-
-    memcpy(p, &length, sizeof(length));
-
-    p += sizeof(length);
-
-    queue->_length += sizeof(length) + length;
+    uint8_t *p = (uint8_t *) queue->_buffer + offset + header;
 
     if (buffer != NULL)
     {
@@ -39,35 +47,229 @@ bool twr_queue_put(twr_queue_t *queue, const void *buffer, size_t length)
         memset(p, 0, length);
     }
 
+    _twr_queue_append(queue, offset, header, length);
+
+    _twr_queue_stats_put(queue, true);
+
     return true;
 }
 
 bool twr_queue_get(twr_queue_t *queue, void *buffer, size_t *length)
 {
-    if (queue->_length == 0)
+    uint8_t *p = twr_queue_peek(queue, length);
+
+    if (p == NULL)
     {
         return false;
     }
 
-    uint8_t *p = queue->_buffer;
+    if (buffer != NULL)
+    {
+        memcpy(buffer, p, *length);
+    }
 
-    memcpy(length, p, sizeof(*length));
+    twr_queue_pop(queue);
 
-    p += sizeof(*length);
+    return true;
+}
 
-    queue->_length -= sizeof(*length) + *length;
+void *twr_queue_reserve(twr_queue_t *queue, size_t length)
+{
+    uint8_t header = _twr_queue_header_size(length);
+    size_t offset;
 
-    if (buffer != NULL)
+    if (length > TWR_QUEUE_MESSAGE_LENGTH_MAX || !_twr_queue_alloc(queue, header + length, &offset))
     {
-        memcpy(buffer, p, *length);
+        _twr_queue_stats_put(queue, false);
+
+        return NULL;
     }
 
-    memmove(queue->_buffer, p + *length, queue->_length);
+    // Header size follows the reserved length, so the message does not move on commit
+    queue->_reserve_offset = offset;
+    queue->_reserve_header = header;
 
-    return true;
+    return (uint8_t *) queue->_buffer + offset + header;
+}
+
+void twr_queue_commit(twr_queue_t *queue, size_t length)
+{
+    if (length == 0)
+    {
+        return;
+    }
+
+    _twr_queue_append(queue, queue->_reserve_offset, queue->_reserve_header, length);
+
+    _twr_queue_stats_put(queue, true);
+}
+
+void *twr_queue_peek(twr_queue_t *queue, size_t *length)
+{
+    uint8_t header;
+
+    return _twr_queue_front(queue, length, &header);
+}
+
+void twr_queue_pop(twr_queue_t *queue)
+{
+    size_t length;
+    uint8_t header;
+
+    if (_twr_queue_front(queue, &length, &header) == NULL)
+    {
+        return;
+    }
+
+    queue->_tail += header + length;
+    queue->_length -= header + length;
+
+    if (queue->_length == 0)
+    {
+        queue->_head = 0;
+        queue->_tail = 0;
+    }
 }
 
 void twr_queue_clear(twr_queue_t *queue)
 {
     queue->_length = 0;
+    queue->_head = 0;
+    queue->_tail = 0;
+}
+
+#if TWR_QUEUE_STATS
+
+void twr_queue_get_stats(twr_queue_t *queue, twr_queue_stats_t *stats)
+{
+    *stats = queue->_stats;
+}
+
+void twr_queue_reset_stats(twr_queue_t *queue)
+{
+    memset(&queue->_stats, 0, sizeof(queue->_stats));
+}
+
+#endif
+
+static inline void _twr_queue_stats_put(twr_queue_t *queue, bool success)
+{
+#if TWR_QUEUE_STATS
+    if (!success)
+    {
+        queue->_stats.dropped++;
+
+        return;
+    }
+
+    queue->_stats.total++;
+
+    if (queue->_stats.peak < queue->_length)
+    {
+        queue->_stats.peak = queue->_length;
+    }
+#else
+    (void) queue;
+    (void) success;
+#endif
+}
+
+static inline uint8_t _twr_queue_header_size(size_t length)
+{
+    return length < _TWR_QUEUE_HEADER_LONG ? 1 : 2;
+}
+
+static bool _twr_queue_alloc(twr_queue_t *queue, size_t total, size_t *offset)
+{
+    if (queue->_length == 0)
+    {
+        queue->_head = 0;
+        queue->_tail = 0;
+
+        *offset = 0;
+
+        return total <= queue->_size;
+    }
+
+    if (queue->_head > queue->_tail)
+    {
+        // Free space at the end and in front of the oldest message
+        if (total <= queue->_size - queue->_head)
+        {
+            *offset = queue->_head;
+
+            return true;
+        }
+
+        *offset = 0;
+
+        return total <= queue->_tail;
+    }
+
+    // Free space between the newest and the oldest message, none when they meet
+    *offset = queue->_head;
+
+    return total <= queue->_tail - queue->_head;
+}
+
+static void _twr_queue_append(twr_queue_t *queue, size_t offset, uint8_t header, size_t length)
+{
+    uint8_t *p = queue->_buffer;
+
+    if (offset != queue->_head)
+    {
+        if (queue->_head < queue->_size)
+        {
+            p[queue->_head] = _TWR_QUEUE_WRAP;
+        }
+
+        queue->_length += queue->_size - queue->_head;
+    }
+
+    p += offset;
+
+    if (header == 1)
+    {
+        p[0] = length;
+    }
+    else
+    {
+        p[0] = _TWR_QUEUE_HEADER_LONG | (length >> 8);
+        p[1] = length;
+    }
+
+    queue->_head = offset + header + length;
+    queue->_length += header + length;
+}
+
+static uint8_t *_twr_queue_front(twr_queue_t *queue, size_t *length, uint8_t *header)
+{
+    if (queue->_length == 0)
+    {
+        return NULL;
+    }
+
+    uint8_t *p = queue->_buffer;
+
+    // Skip the end of buffer left behind by wrapped message
+    if (queue->_tail == queue->_size || p[queue->_tail] == _TWR_QUEUE_WRAP)
+    {
+        queue->_length -= queue->_size - queue->_tail;
+        queue->_tail = 0;
+    }
+
+    p += queue->_tail;
+
+    if ((p[0] & _TWR_QUEUE_HEADER_LONG) == 0)
+    {
+        *header = 1;
+        *length = p[0];
+    }
+    else
+    {
+        *header = 2;
+        *length = ((size_t) (p[0] & ~_TWR_QUEUE_HEADER_LONG) << 8) | p[1];
+    }
+
+    return p + *header;
 }
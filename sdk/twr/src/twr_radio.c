@@ -1,3 +1,5 @@
+#define TWR_LOG_MODULE TWR_LOG_MODULE_RADIO
+
 #include <twr_radio.h>
 #include <twr_queue.h>
 #include <twr_atsha204.h>
@@ -6,13 +8,69 @@
 #include <twr_i2c.h>
 #include <twr_radio_pub.h>
 #include <twr_radio_node.h>
+#include <twr_radio_compact.h>
+#include <twr_crc.h>
 #include <math.h>
 
 #define _TWR_RADIO_SCAN_CACHE_LENGTH	4
 #define _TWR_RADIO_ACK_TIMEOUT       100
 #define _TWR_RADIO_SLEEP_RX_TIMEOUT  100
 #define _TWR_RADIO_TX_MAX_COUNT      6
+#define _TWR_RADIO_TX_GOOD_COUNT     3
+#define _TWR_RADIO_TX_EDGE_COUNT     2
+#define _TWR_RADIO_ACK_RATE_INIT     128
+#define _TWR_RADIO_ACK_RATE_GOOD     192
+#define _TWR_RADIO_ACK_RATE_POOR     64
+#define _TWR_RADIO_RSSI_WEAK         -105
+#define _TWR_RADIO_BACKOFF_SLOT      20
+#define _TWR_RADIO_BACKOFF_MAX_EXPONENT 5
+#define _TWR_RADIO_LBT_LISTEN_TIME   2
+#define _TWR_RADIO_LBT_MAX_DEFER     4
+#define _TWR_RADIO_DUTY_CYCLE_BUCKETS 12
 #define _TWR_RADIO_ACK_SUB_REQUEST   0x11
+#define _TWR_RADIO_ACK_COMPACT_RESET 0x12
+#define _TWR_RADIO_ACK_RX_SLOT       0x13
+#define _TWR_RADIO_ACK_DATA          0x14
+#define _TWR_RADIO_ACK_TOPICS_RESET  0x15
+#define _TWR_RADIO_CAPABILITY_COMPACT 0x01
+#define _TWR_RADIO_CAPABILITY_RX_SLOT 0x02
+#define _TWR_RADIO_CAPABILITY_ACK_DATA 0x04
+#define _TWR_RADIO_CAPABILITY_TOPICS 0x08
+#define _TWR_RADIO_RX_SLOT_DELAY     50
+#define _TWR_RADIO_RX_SLOT_GUARD     10
+#define _TWR_RADIO_PEER_HASH_MASK    (TWR_RADIO_PEER_HASH_SIZE - 1)
+
+#if TWR_RADIO_PEER_STORAGE_REDUNDANT
+#define _TWR_RADIO_PEER_ENTRY_SIZE   24
+#else
+#define _TWR_RADIO_PEER_ENTRY_SIZE   8
+#endif
+
+#if TWR_RADIO_MAX_DEVICES > 255
+#define _TWR_RADIO_PEER_LENGTH_SIZE  2
+#else
+#define _TWR_RADIO_PEER_LENGTH_SIZE  1
+#endif
+
+#define _TWR_RADIO_ID_RETRY_INTERVAL 100
+#define _TWR_RADIO_ID_CACHE_MAGIC    0x44495742
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t crc;
+    uint64_t id;
+
+} _twr_radio_id_cache_t;
+
+// Capabilities gateway confirms to node on pairing
+#define _TWR_RADIO_CAPABILITIES      ((TWR_RADIO_COMPACT ? _TWR_RADIO_CAPABILITY_COMPACT : 0) | \
+                                      (TWR_RADIO_RX_SLOT ? _TWR_RADIO_CAPABILITY_RX_SLOT : 0) | \
+                                      (TWR_RADIO_ACK_DATA ? _TWR_RADIO_CAPABILITY_ACK_DATA : 0) | \
+                                      (TWR_RADIO_TOPICS ? _TWR_RADIO_CAPABILITY_TOPICS : 0))
+
+// Gateway holds messages for sleeping nodes
+#define _TWR_RADIO_HOLD              (TWR_RADIO_RX_SLOT || TWR_RADIO_ACK_DATA)
 
 typedef enum
 {
@@ -22,6 +80,7 @@ typedef enum
     TWR_RADIO_STATE_TX_WAIT_ACK = 3,
     TWR_RADIO_STATE_RX_SEND_ACK = 4,
     TWR_RADIO_STATE_TX_SEND_ACK = 5,
+    TWR_RADIO_STATE_TX_BACKOFF = 6,
 
 } twr_radio_state_t;
 
@@ -31,11 +90,13 @@ static struct
     twr_atsha204_t atsha204;
     twr_radio_state_t state;
     uint64_t my_id;
+    bool init_done_pending;
     uint16_t message_id;
     int transmit_count;
     void (*event_handler)(twr_radio_event_t, void *);
     void *event_param;
     twr_scheduler_task_id_t task_id;
+    twr_scheduler_task_id_t rx_task_id;
     bool pairing_request_to_gateway;
     const char *firmware;
     const char *firmware_version;
@@ -46,7 +107,7 @@ static struct
     uint8_t pub_queue_buffer[TWR_RADIO_PUB_QUEUE_BUFFER_SIZE];
     uint8_t rx_queue_buffer[TWR_RADIO_RX_QUEUE_BUFFER_SIZE];
 
-    uint8_t ack_tx_cache_buffer[15];
+    uint8_t ack_tx_cache_buffer[TWR_SPIRIT1_MAX_PACKET_SIZE];
     size_t ack_tx_cache_length;
     int ack_transmit_count;
     twr_tick_t rx_timeout;
@@ -55,6 +116,9 @@ static struct
     twr_radio_peer_t peer_devices[TWR_RADIO_MAX_DEVICES];
     int peer_devices_length;
 
+    // Open addressing with linear probing, position in peer_devices or -1 for empty slot
+    int16_t peer_index[TWR_RADIO_PEER_HASH_SIZE];
+
     uint64_t peer_id;
 
     twr_tick_t sleeping_mode_rx_timeout;
@@ -68,20 +132,132 @@ static struct
     bool automatic_pairing;
     bool save_peer_devices;
 
+    // Positions in peer_devices to be written to EEPROM, -1 stands for number of devices
+    uint8_t peer_storage_dirty[(TWR_RADIO_MAX_DEVICES + 7) / 8];
+    bool peer_storage_length_dirty;
+    bool peer_storage_busy;
+    int peer_storage_position;
+    uint64_t peer_storage_buffer[_TWR_RADIO_PEER_ENTRY_SIZE / sizeof(uint64_t)];
+    uint16_t peer_storage_length;
+
     twr_radio_sub_t *subs;
     int subs_length;
     int sent_subs;
 
+#if TWR_RADIO_TOPICS
+    const char * const *topics;
+    int topics_length;
+    int sent_topics;
+    uint32_t topics_short;
+#endif
+
+    bool pub_batching;
+
+    uint64_t transmit_peer_id;
+    int transmit_max;
+    int backoff_exponent;
+    twr_tick_t backoff_tick;
+    bool lbt;
+    bool lbt_listening;
+    int lbt_defer;
+
+    twr_radio_stats_t stats;
+    twr_tick_t duty_cycle_bucket[_TWR_RADIO_DUTY_CYCLE_BUCKETS];
+    uint32_t duty_cycle_epoch;
+    twr_tick_t duty_cycle_tx_time;
+    uint16_t duty_cycle_limit;
+
+#if _TWR_RADIO_HOLD
+    twr_queue_t hold_queue;
+    uint8_t hold_queue_buffer[TWR_RADIO_HOLD_QUEUE_BUFFER_SIZE];
+    int hold_queue_count;
+#endif
+
+#if TWR_RADIO_RX_SLOT
+    bool rx_slot;
+    twr_scheduler_task_id_t rx_slot_task_id;
+    twr_tick_t rx_slot_next;
+#endif
+
 } _twr_radio;
 
+#if TWR_RADIO_TOPICS
+// Dictionaries of nodes kept by gateway
+static struct
+{
+    struct
+    {
+        uint64_t id;
+        char topic[TWR_RADIO_TOPICS_MAX][TWR_RADIO_TOPIC_SIZE];
+        uint32_t valid;
+
+    } peer[TWR_RADIO_TOPICS_PEERS];
+
+    int peer_length;
+    int peer_next;
+
+} _twr_radio_topics;
+#endif
+
 static void _twr_radio_task(void *param);
+static void _twr_radio_rx_task(void *param);
+static void _twr_radio_rx_put(const void *buffer, size_t length);
 static void _twr_radio_go_to_state_rx_or_sleep(void);
 static void _twr_radio_spirit1_event_handler(twr_spirit1_event_t event, void *event_param);
 static void _twr_radio_load_peer_devices(void);
 static void _twr_radio_save_peer_devices(void);
+static void _twr_radio_peer_storage_mark(int position);
+static bool _twr_radio_peer_storage_write(uint32_t address, const void *buffer, size_t length, int position);
+static void _twr_radio_eeprom_event_handler(twr_eepromc_event_t event, void *event_param);
 static void _twr_radio_atsha204_event_handler(twr_atsha204_t *self, twr_atsha204_event_t event, void *event_param);
+#if TWR_RADIO_ID_CACHE
+static bool _twr_radio_id_cache_load(uint64_t *id);
+static void _twr_radio_id_cache_save(uint64_t id);
+#endif
 static bool _twr_radio_peer_device_add(uint64_t id);
 static bool _twr_radio_peer_device_remove(uint64_t id);
+static int _twr_radio_peer_hash(uint64_t id);
+static int _twr_radio_peer_index_slot(uint64_t id);
+static void _twr_radio_peer_index_remove(int slot);
+static void _twr_radio_peer_index_rebuild(void);
+#if !TWR_RADIO_PEER_STORAGE_REDUNDANT
+static uint64_t _twr_radio_peer_entry_encode(uint64_t id);
+#endif
+static bool _twr_radio_is_pub(uint8_t header);
+static void _twr_radio_transmit_start(void);
+static void _twr_radio_transmit_retry(void);
+static void _twr_radio_transmit_defer(void);
+static void _twr_radio_duty_cycle_update(twr_tick_t now);
+static void _twr_radio_transmit_backoff(void);
+static void _twr_radio_transmit_update_rate(int successes, int failures);
+static size_t _twr_radio_pub_batch(uint8_t *buffer);
+#if TWR_RADIO_COMPACT
+static size_t _twr_radio_pub_compact(uint8_t *buffer);
+#endif
+#if _TWR_RADIO_HOLD
+static void _twr_radio_hold_rotate(void);
+static void _twr_radio_hold_pop(void);
+static void _twr_radio_hold_attach(twr_radio_peer_t *peer);
+static void _twr_radio_ack_decode(uint8_t *buffer, size_t length);
+#endif
+#if TWR_RADIO_ACK_DATA
+static uint8_t *_twr_radio_hold_find(uint64_t id, size_t *length);
+#endif
+#if TWR_RADIO_TOPICS
+static void _twr_radio_topic_store(uint64_t *id, uint8_t topic_id, const char *topic);
+#endif
+#if TWR_RADIO_RX_SLOT
+static void _twr_radio_rx_slot_task(void *param);
+static uint8_t *_twr_radio_rx_slot_peek(size_t *length);
+static size_t _twr_radio_rx_slot_assign(twr_radio_peer_t *peer, uint8_t *buffer);
+#endif
+
+TWR_SCHEDULER_TASK_STATIC(_twr_radio_task_static, _twr_radio_task, NULL);
+TWR_SCHEDULER_TASK_STATIC(_twr_radio_rx_task_static, _twr_radio_rx_task, NULL);
+
+#if TWR_RADIO_RX_SLOT
+TWR_SCHEDULER_TASK_STATIC(_twr_radio_rx_slot_task_static, _twr_radio_rx_slot_task, NULL);
+#endif
 
 __attribute__((weak)) void twr_radio_on_info(uint64_t *id, char *firmware, char *version, twr_radio_mode_t mode) { (void) id; (void) firmware; (void) version; (void) mode;}
 __attribute__((weak)) void twr_radio_on_sub(uint64_t *id, uint8_t *order, twr_radio_sub_pt_t *pt, char *topic) { (void) id; (void) order; (void) pt; (void) topic; }
@@ -94,7 +270,6 @@ void twr_radio_init(twr_radio_mode_t mode)
 
     twr_atsha204_init(&_twr_radio.atsha204, TWR_I2C_I2C0, 0x64);
     twr_atsha204_set_event_handler(&_twr_radio.atsha204, _twr_radio_atsha204_event_handler, NULL);
-    twr_atsha204_read_serial_number(&_twr_radio.atsha204);
 
     twr_queue_init(&_twr_radio.pub_queue, _twr_radio.pub_queue_buffer, sizeof(_twr_radio.pub_queue_buffer));
     twr_queue_init(&_twr_radio.rx_queue, _twr_radio.rx_queue_buffer, sizeof(_twr_radio.rx_queue_buffer));
@@ -104,7 +279,37 @@ void twr_radio_init(twr_radio_mode_t mode)
 
     _twr_radio_load_peer_devices();
 
-    _twr_radio.task_id = twr_scheduler_register(_twr_radio_task, NULL, TWR_TICK_INFINITY);
+    _twr_radio.task_id = twr_scheduler_get_static_id(&_twr_radio_task_static);
+
+    // Acknowledgements and retransmissions are timed
+    twr_scheduler_set_priority(_twr_radio.task_id, TWR_SCHEDULER_PRIORITY_HIGH);
+
+    // Decoding runs with normal priority, so that acknowledgments are not delayed by application handlers
+    _twr_radio.rx_task_id = twr_scheduler_get_static_id(&_twr_radio_rx_task_static);
+
+#if TWR_RADIO_ID_CACHE
+    // Event handler is not set yet, init done is reported from task
+    if (_twr_radio_id_cache_load(&_twr_radio.my_id) && twr_atsha204_is_present(&_twr_radio.atsha204))
+    {
+        _twr_radio.init_done_pending = true;
+    }
+    else
+#endif
+    {
+        _twr_radio.my_id = 0;
+
+        twr_atsha204_read_serial_number(&_twr_radio.atsha204);
+    }
+
+    twr_scheduler_plan_now(_twr_radio.task_id);
+
+#if _TWR_RADIO_HOLD
+    twr_queue_init(&_twr_radio.hold_queue, _twr_radio.hold_queue_buffer, sizeof(_twr_radio.hold_queue_buffer));
+#endif
+
+#if TWR_RADIO_RX_SLOT
+    _twr_radio.rx_slot_task_id = twr_scheduler_get_static_id(&_twr_radio_rx_slot_task_static);
+#endif
 
     _twr_radio_go_to_state_rx_or_sleep();
 }
@@ -247,14 +452,7 @@ uint64_t twr_radio_get_event_id(void)
 
 bool twr_radio_is_peer_device(uint64_t id)
 {
-    for (int i = 0; i < _twr_radio.peer_devices_length; i++)
-    {
-        if (id == _twr_radio.peer_devices[i].id)
-        {
-            return true;
-        }
-    }
-    return false;
+    return _twr_radio.peer_index[_twr_radio_peer_index_slot(id)] >= 0;
 }
 
 bool twr_radio_pub_queue_put(const void *buffer, size_t length)
@@ -269,6 +467,18 @@ bool twr_radio_pub_queue_put(const void *buffer, size_t length)
     return true;
 }
 
+void *twr_radio_pub_queue_reserve(size_t length)
+{
+    return twr_queue_reserve(&_twr_radio.pub_queue, length);
+}
+
+void twr_radio_pub_queue_commit(size_t length)
+{
+    twr_queue_commit(&_twr_radio.pub_queue, length);
+
+    twr_scheduler_plan_now(_twr_radio.task_id);
+}
+
 void twr_radio_pub_queue_clear()
 {
     twr_queue_clear(&_twr_radio.pub_queue);
@@ -283,32 +493,144 @@ void twr_radio_set_subs(twr_radio_sub_t *subs, int length)
     _twr_radio.sent_subs = 0;
 }
 
-bool twr_radio_send_sub_data(uint64_t *id, uint8_t order, void *payload, size_t size)
+#if TWR_RADIO_TOPICS
+
+void twr_radio_set_topics(const char * const *topics, int length)
 {
-    uint8_t qbuffer[1 + TWR_RADIO_ID_SIZE + TWR_RADIO_NODE_MAX_BUFFER_SIZE];
+    if (length > TWR_RADIO_TOPICS_MAX)
+    {
+        length = TWR_RADIO_TOPICS_MAX;
+    }
 
-    if (size > TWR_RADIO_NODE_MAX_BUFFER_SIZE - 1)
+    _twr_radio.topics = topics;
+
+    _twr_radio.topics_length = length;
+
+    _twr_radio.sent_topics = 0;
+
+    _twr_radio.topics_short = 0;
+
+    // Gateway keeps only subtopics which fit its storage
+    for (int i = 0; i < length; i++)
     {
-        return false;
+        if (strlen(topics[i]) < TWR_RADIO_TOPIC_SIZE)
+        {
+            _twr_radio.topics_short |= 1UL << i;
+        }
     }
+}
 
-    qbuffer[0] = TWR_RADIO_HEADER_SUB_DATA;
+int twr_radio_get_topic_id(const char *subtopic)
+{
+    if (!_twr_radio.peer_devices[0].topics)
+    {
+        return -1;
+    }
 
-    uint8_t *pqbuffer = twr_radio_id_to_buffer(id, qbuffer + 1);
+    int i;
 
-    *pqbuffer++ = order;
+    // Subtopics are usually passed by the same pointer as in dictionary
+    for (i = 0; i < _twr_radio.sent_topics; i++)
+    {
+        if (_twr_radio.topics[i] == subtopic)
+        {
+            break;
+        }
+    }
+
+    if (i == _twr_radio.sent_topics)
+    {
+        for (i = 0; i < _twr_radio.sent_topics; i++)
+        {
+            if (strcmp(_twr_radio.topics[i], subtopic) == 0)
+            {
+                break;
+            }
+        }
+    }
+
+    if ((i == _twr_radio.sent_topics) || ((_twr_radio.topics_short & (1UL << i)) == 0))
+    {
+        return -1;
+    }
+
+    return i;
+}
+
+#endif
+
+bool twr_radio_send_sub_data(uint64_t *id, uint8_t order, void *payload, size_t size)
+{
+    if (size > TWR_RADIO_NODE_MAX_BUFFER_SIZE - 1)
+    {
+        return false;
+    }
 
     if (payload == NULL)
     {
         size = 0;
     }
 
+#if _TWR_RADIO_HOLD
+    twr_radio_peer_t *peer = _twr_radio.mode == TWR_RADIO_MODE_GATEWAY ? twr_radio_get_peer_device(*id) : NULL;
+
+    // Sleeping node gets message in its next RX slot or in acknowledgment of its next packet if it fits
+    if ((peer != NULL) && (peer->rx_slot || (peer->ack_data && (9 + 2 + 1 + TWR_RADIO_ID_SIZE + 1 + size <= TWR_SPIRIT1_MAX_PACKET_SIZE))))
+    {
+        if (peer->hold_pending == UINT8_MAX)
+        {
+            return false;
+        }
+
+        uint8_t *qbuffer = twr_queue_reserve(&_twr_radio.hold_queue, 1 + TWR_RADIO_ID_SIZE + 1 + size);
+
+        if (qbuffer == NULL)
+        {
+            return false;
+        }
+
+        qbuffer[0] = TWR_RADIO_HEADER_SUB_DATA;
+
+        uint8_t *pqbuffer = twr_radio_id_to_buffer(id, qbuffer + 1);
+
+        *pqbuffer++ = order;
+
+        if (size > 0)
+        {
+            memcpy(pqbuffer, payload, size);
+        }
+
+        twr_queue_commit(&_twr_radio.hold_queue, 1 + TWR_RADIO_ID_SIZE + 1 + size);
+
+        _twr_radio.hold_queue_count++;
+
+        peer->hold_pending++;
+
+        return true;
+    }
+#endif
+
+    uint8_t *qbuffer = twr_radio_pub_queue_reserve(1 + TWR_RADIO_ID_SIZE + 1 + size);
+
+    if (qbuffer == NULL)
+    {
+        return false;
+    }
+
+    qbuffer[0] = TWR_RADIO_HEADER_SUB_DATA;
+
+    uint8_t *pqbuffer = twr_radio_id_to_buffer(id, qbuffer + 1);
+
+    *pqbuffer++ = order;
+
     if (size > 0)
     {
         memcpy(pqbuffer, payload, size);
     }
 
-    return twr_radio_pub_queue_put(qbuffer, 1 + TWR_RADIO_ID_SIZE + 1 + size);
+    twr_radio_pub_queue_commit(1 + TWR_RADIO_ID_SIZE + 1 + size);
+
+    return true;
 }
 
 void twr_radio_set_rx_timeout_for_sleeping_node(twr_tick_t timeout)
@@ -316,31 +638,101 @@ void twr_radio_set_rx_timeout_for_sleeping_node(twr_tick_t timeout)
     _twr_radio.sleeping_mode_rx_timeout = timeout;
 }
 
+void twr_radio_set_rx_slot(bool enable)
+{
+#if TWR_RADIO_RX_SLOT
+    _twr_radio.rx_slot = enable;
+#else
+    (void) enable;
+#endif
+}
+
+void twr_radio_set_pub_batching(bool enable)
+{
+    _twr_radio.pub_batching = enable;
+}
+
+void twr_radio_set_listen_before_talk(bool enable)
+{
+    _twr_radio.lbt = enable;
+}
+
+void twr_radio_get_stats(twr_radio_stats_t *stats)
+{
+    twr_spirit1_stats_t spirit1;
+
+    twr_spirit1_get_stats(&spirit1);
+
+    _twr_radio_duty_cycle_update(twr_tick_get());
+
+    *stats = _twr_radio.stats;
+
+    stats->tx_time = spirit1.tx_time;
+    stats->rx_time = spirit1.rx_time;
+    stats->sleep_time = spirit1.sleep_time;
+
+    twr_tick_t window_tx_time = 0;
+
+    for (int i = 0; i < _TWR_RADIO_DUTY_CYCLE_BUCKETS; i++)
+    {
+        window_tx_time += _twr_radio.duty_cycle_bucket[i];
+    }
+
+    stats->duty_cycle = window_tx_time * 10000 / TWR_RADIO_DUTY_CYCLE_WINDOW;
+}
+
+void twr_radio_set_duty_cycle_limit(uint16_t limit)
+{
+    _twr_radio.duty_cycle_limit = limit;
+
+    twr_scheduler_plan_now(_twr_radio.task_id);
+}
+
 static void _twr_radio_task(void *param)
 {
     (void) param;
 
+    // Task is planned again by event of ATSHA204
     if (_twr_radio.my_id == 0)
     {
-        twr_atsha204_read_serial_number(&_twr_radio.atsha204);
-
-        twr_scheduler_plan_current_now();
+        if (twr_atsha204_is_ready(&_twr_radio.atsha204) && !twr_atsha204_read_serial_number(&_twr_radio.atsha204))
+        {
+            twr_scheduler_plan_current_relative(_TWR_RADIO_ID_RETRY_INTERVAL);
+        }
 
         return;
     }
 
-    if ((_twr_radio.state != TWR_RADIO_STATE_RX) && (_twr_radio.state != TWR_RADIO_STATE_SLEEP))
+    if (_twr_radio.init_done_pending)
     {
-        twr_scheduler_plan_current_now();
+        _twr_radio.init_done_pending = false;
 
-        return;
+        if (_twr_radio.event_handler != NULL)
+        {
+            _twr_radio.event_handler(TWR_RADIO_EVENT_INIT_DONE, _twr_radio.event_param);
+        }
     }
 
+    // Write runs asynchronously alongside reception and transmission
     if (_twr_radio.save_peer_devices)
     {
         _twr_radio_save_peer_devices();
     }
 
+    if (_twr_radio.state == TWR_RADIO_STATE_TX_BACKOFF)
+    {
+        _twr_radio_transmit_backoff();
+
+        return;
+    }
+
+    if ((_twr_radio.state != TWR_RADIO_STATE_RX) && (_twr_radio.state != TWR_RADIO_STATE_SLEEP))
+    {
+        twr_scheduler_plan_current_now();
+
+        return;
+    }
+
     if (_twr_radio.pairing_request_to_gateway)
     {
         _twr_radio.pairing_request_to_gateway = false;
@@ -369,128 +761,767 @@ static void _twr_radio_task(void *param)
         strncpy((char *)buffer + 10, _twr_radio.firmware, TWR_RADIO_MAX_BUFFER_SIZE - 2);
         strncpy((char *)buffer + 10 + len_firmware + 1, _twr_radio.firmware_version, TWR_RADIO_MAX_BUFFER_SIZE - 2 - len_firmware - 1);
 
-        buffer[10 + len + 1] = _twr_radio.mode;
+        size_t length = 10 + len + 1;
+        uint8_t capabilities = TWR_RADIO_COMPACT ? _TWR_RADIO_CAPABILITY_COMPACT : 0;
+
+#if TWR_RADIO_RX_SLOT
+        if (_twr_radio.rx_slot && (_twr_radio.mode == TWR_RADIO_MODE_NODE_SLEEPING))
+        {
+            capabilities |= _TWR_RADIO_CAPABILITY_RX_SLOT;
+        }
+#endif
+#if TWR_RADIO_ACK_DATA
+        if (_twr_radio.mode == TWR_RADIO_MODE_NODE_SLEEPING)
+        {
+            capabilities |= _TWR_RADIO_CAPABILITY_ACK_DATA;
+        }
+#endif
+#if TWR_RADIO_TOPICS
+        if (_twr_radio.topics_length != 0)
+        {
+            capabilities |= _TWR_RADIO_CAPABILITY_TOPICS;
+        }
+#endif
+
+        // Capabilities go before mode, older gateway takes mode from the last byte
+        if (capabilities != 0)
+        {
+            buffer[length++] = capabilities;
+        }
+
+        buffer[length++] = _twr_radio.mode;
+
+        twr_spirit1_set_tx_length(length);
+
+        _twr_radio_transmit_start();
+
+        return;
+    }
+
+    if (_twr_radio.ack && (_twr_radio.sent_subs != _twr_radio.subs_length))
+    {
+        uint8_t *buffer = twr_spirit1_get_tx_buffer();
+
+        twr_radio_sub_t *sub = &_twr_radio.subs[_twr_radio.sent_subs];
+
+        twr_radio_id_to_buffer(&_twr_radio.my_id, buffer);
+
+        _twr_radio.message_id++;
+
+        buffer[6] = _twr_radio.message_id;
+        buffer[7] = _twr_radio.message_id >> 8;
+
+        buffer[8] = TWR_RADIO_HEADER_SUB_REG;
+
+        buffer[9] = _twr_radio.sent_subs;
+
+        buffer[10] = sub->type;
+
+        strncpy((char *)buffer + 11, sub->topic, TWR_RADIO_MAX_BUFFER_SIZE - 3);
+
+        twr_spirit1_set_tx_length(11 + strlen(sub->topic) + 1);
+
+        _twr_radio_transmit_start();
+
+        return;
+    }
+
+#if TWR_RADIO_TOPICS
+    if (_twr_radio.ack && _twr_radio.peer_devices[0].topics && (_twr_radio.sent_topics != _twr_radio.topics_length))
+    {
+        uint8_t *buffer = twr_spirit1_get_tx_buffer();
+
+        const char *topic = _twr_radio.topics[_twr_radio.sent_topics];
+
+        twr_radio_id_to_buffer(&_twr_radio.my_id, buffer);
+
+        _twr_radio.message_id++;
+
+        buffer[6] = _twr_radio.message_id;
+        buffer[7] = _twr_radio.message_id >> 8;
+
+        buffer[8] = TWR_RADIO_HEADER_TOPIC_REG;
+
+        buffer[9] = _twr_radio.sent_topics;
+
+        // Long subtopic is registered empty to keep indexes, it is always sent as string
+        if ((_twr_radio.topics_short & (1UL << _twr_radio.sent_topics)) == 0)
+        {
+            topic = "";
+        }
+
+        strcpy((char *)buffer + 10, topic);
+
+        twr_spirit1_set_tx_length(10 + strlen(topic) + 1);
+
+        _twr_radio_transmit_start();
+
+        return;
+    }
+#endif
+
+    uint8_t *queue_item_buffer;
+    size_t queue_item_length;
+
+#if TWR_RADIO_RX_SLOT
+    // Held message has priority as slot of node is short, it counts into airtime without waiting for duty cycle
+    if ((queue_item_buffer = _twr_radio_rx_slot_peek(&queue_item_length)) != NULL)
+    {
+        uint8_t *buffer = twr_spirit1_get_tx_buffer();
+
+        twr_radio_id_to_buffer(&_twr_radio.my_id, buffer);
+
+        _twr_radio.message_id++;
+
+        buffer[6] = _twr_radio.message_id;
+        buffer[7] = _twr_radio.message_id >> 8;
+
+        memcpy(buffer + 8, queue_item_buffer, queue_item_length);
 
-        twr_spirit1_set_tx_length(10 + len + 2);
+        _twr_radio_hold_pop();
 
-        twr_spirit1_tx();
+        twr_spirit1_set_tx_length(8 + queue_item_length);
+
+        _twr_radio_transmit_start();
+
+        return;
+    }
+#endif
+
+    // Message goes from queue straight to transmit buffer
+    if ((queue_item_buffer = twr_queue_peek(&_twr_radio.pub_queue, &queue_item_length)) != NULL)
+    {
+        if (_twr_radio.duty_cycle_limit != 0)
+        {
+            twr_tick_t now = twr_tick_get();
+            twr_tick_t window_tx_time = 0;
+            twr_spirit1_stats_t spirit1;
+
+            _twr_radio_duty_cycle_update(now);
+
+            for (int i = 0; i < _TWR_RADIO_DUTY_CYCLE_BUCKETS; i++)
+            {
+                window_tx_time += _twr_radio.duty_cycle_bucket[i];
+            }
+
+            twr_spirit1_get_stats(&spirit1);
+
+            // Average airtime of packet sent so far stands for the next one
+            twr_tick_t estimate = spirit1.tx_count != 0 ? spirit1.tx_time / spirit1.tx_count : 0;
+
+            if ((window_tx_time + estimate) * 10000 > (twr_tick_t) _twr_radio.duty_cycle_limit * TWR_RADIO_DUTY_CYCLE_WINDOW)
+            {
+                // Oldest bucket drops out of window at the start of the next one
+                twr_tick_t bucket = TWR_RADIO_DUTY_CYCLE_WINDOW / _TWR_RADIO_DUTY_CYCLE_BUCKETS;
+
+                _twr_radio.stats.duty_cycle_delayed++;
+
+                twr_scheduler_plan_current_absolute((now / bucket + 1) * bucket);
+
+                return;
+            }
+        }
+
+        uint8_t *buffer = twr_spirit1_get_tx_buffer();
+
+        twr_radio_id_to_buffer(&_twr_radio.my_id, buffer);
+
+        _twr_radio.message_id++;
+
+        buffer[6] = _twr_radio.message_id;
+        buffer[7] = _twr_radio.message_id >> 8;
+
+        size_t length = 0;
+
+#if TWR_RADIO_COMPACT
+        if ((_twr_radio.mode != TWR_RADIO_MODE_GATEWAY) && (_twr_radio.peer_devices_length > 0) &&
+            _twr_radio.peer_devices[0].compact && _twr_radio_is_pub(queue_item_buffer[0]))
+        {
+            length = _twr_radio_pub_compact(buffer);
+        }
+#endif
+
+        if ((length == 0) && _twr_radio.pub_batching && _twr_radio_is_pub(queue_item_buffer[0]))
+        {
+            length = _twr_radio_pub_batch(buffer);
+        }
+
+        if (length == 0)
+        {
+            memcpy(buffer + 8, queue_item_buffer, queue_item_length);
+
+            twr_queue_pop(&_twr_radio.pub_queue);
+
+            length = 8 + queue_item_length;
+        }
+
+        twr_spirit1_set_tx_length(length);
+
+        _twr_radio_transmit_start();
+    }
+}
+
+static void _twr_radio_duty_cycle_update(twr_tick_t now)
+{
+    twr_spirit1_stats_t spirit1;
+
+    uint32_t epoch = now / (TWR_RADIO_DUTY_CYCLE_WINDOW / _TWR_RADIO_DUTY_CYCLE_BUCKETS);
+
+    // Buckets of time which passed since last update start empty
+    for (int i = 0; (i < _TWR_RADIO_DUTY_CYCLE_BUCKETS) && (_twr_radio.duty_cycle_epoch != epoch); i++)
+    {
+        _twr_radio.duty_cycle_epoch++;
+
+        _twr_radio.duty_cycle_bucket[_twr_radio.duty_cycle_epoch % _TWR_RADIO_DUTY_CYCLE_BUCKETS] = 0;
+    }
+
+    _twr_radio.duty_cycle_epoch = epoch;
+
+    twr_spirit1_get_stats(&spirit1);
+
+    _twr_radio.duty_cycle_bucket[epoch % _TWR_RADIO_DUTY_CYCLE_BUCKETS] += spirit1.tx_time - _twr_radio.duty_cycle_tx_time;
+
+    _twr_radio.duty_cycle_tx_time = spirit1.tx_time;
+}
+
+static void _twr_radio_transmit_start(void)
+{
+    uint8_t *buffer = twr_spirit1_get_tx_buffer();
+    twr_radio_peer_t *peer = NULL;
+
+    _twr_radio.stats.tx_packets++;
+
+    // Node talks to gateway, gateway addresses node in messages for node
+    if (_twr_radio.mode != TWR_RADIO_MODE_GATEWAY)
+    {
+        peer = _twr_radio.peer_devices_length > 0 ? &_twr_radio.peer_devices[0] : NULL;
+    }
+    else if ((buffer[8] >= 0x15) && (buffer[8] <= 0x1d) && (twr_spirit1_get_tx_length() > 14))
+    {
+        uint64_t for_id;
+
+        twr_radio_id_from_buffer(buffer + 9, &for_id);
+
+        peer = twr_radio_get_peer_device(for_id);
+    }
+
+    _twr_radio.transmit_peer_id = peer != NULL ? peer->id : 0;
+
+    _twr_radio.transmit_max = _TWR_RADIO_TX_MAX_COUNT;
+
+    if (peer != NULL)
+    {
+        if (peer->ack_rate >= _TWR_RADIO_ACK_RATE_GOOD)
+        {
+            // Almost every packet passes, more retries would only add to collisions
+            _twr_radio.transmit_max = _TWR_RADIO_TX_GOOD_COUNT;
+        }
+        else if ((peer->ack_rate < _TWR_RADIO_ACK_RATE_POOR) && (peer->rssi != 0) && (peer->rssi < _TWR_RADIO_RSSI_WEAK))
+        {
+            // Edge of coverage, retries are unlikely to pass and cost battery
+            _twr_radio.transmit_max = _TWR_RADIO_TX_EDGE_COUNT;
+        }
+    }
+
+    _twr_radio.transmit_count = _twr_radio.transmit_max;
+
+    _twr_radio.backoff_exponent = 0;
+
+    _twr_radio.lbt_defer = 0;
+
+    if (_twr_radio.lbt)
+    {
+        _twr_radio.lbt_listening = false;
+
+        _twr_radio.backoff_tick = twr_tick_get();
+
+        _twr_radio.state = TWR_RADIO_STATE_TX_BACKOFF;
+
+        twr_scheduler_plan_now(_twr_radio.task_id);
+
+        return;
+    }
+
+    twr_spirit1_tx();
+
+    _twr_radio.state = TWR_RADIO_STATE_TX;
+}
+
+static void _twr_radio_transmit_retry(void)
+{
+    _twr_radio.stats.tx_retries++;
+
+    _twr_radio_transmit_defer();
+}
+
+static void _twr_radio_transmit_defer(void)
+{
+    if (_twr_radio.backoff_exponent < _TWR_RADIO_BACKOFF_MAX_EXPONENT)
+    {
+        _twr_radio.backoff_exponent++;
+    }
+
+    // Randomized exponential backoff spreads retransmissions of colliding nodes
+    _twr_radio.backoff_tick = twr_tick_get() + rand() % (_TWR_RADIO_BACKOFF_SLOT << _twr_radio.backoff_exponent);
+
+    _twr_radio.rx_timeout = TWR_TICK_INFINITY;
+
+    _twr_radio.lbt_listening = false;
+
+    if (_twr_radio.mode == TWR_RADIO_MODE_NODE_SLEEPING)
+    {
+        twr_spirit1_sleep();
+    }
+    else
+    {
+        twr_spirit1_set_rx_timeout(TWR_TICK_INFINITY);
+
+        twr_spirit1_rx();
+    }
+
+    _twr_radio.state = TWR_RADIO_STATE_TX_BACKOFF;
+
+    twr_scheduler_plan_absolute(_twr_radio.task_id, _twr_radio.backoff_tick);
+}
+
+static void _twr_radio_transmit_backoff(void)
+{
+    if (twr_tick_get() < _twr_radio.backoff_tick)
+    {
+        twr_scheduler_plan_current_absolute(_twr_radio.backoff_tick);
+
+        return;
+    }
+
+    if (_twr_radio.lbt && (_twr_radio.lbt_defer < _TWR_RADIO_LBT_MAX_DEFER))
+    {
+        int rssi;
+
+        if (!twr_spirit1_get_rssi(&rssi) && !_twr_radio.lbt_listening)
+        {
+            // Receiver needs a moment to measure the channel
+            _twr_radio.lbt_listening = true;
+
+            twr_spirit1_set_rx_timeout(TWR_TICK_INFINITY);
+
+            twr_spirit1_rx();
+
+            _twr_radio.backoff_tick = twr_tick_get() + _TWR_RADIO_LBT_LISTEN_TIME;
+
+            twr_scheduler_plan_current_absolute(_twr_radio.backoff_tick);
+
+            return;
+        }
+
+        if (_twr_radio.lbt_listening && !twr_spirit1_get_rssi(&rssi))
+        {
+            rssi = INT32_MIN;
+        }
+
+        if (rssi > TWR_RADIO_LBT_THRESHOLD)
+        {
+            _twr_radio.lbt_defer++;
+
+            _twr_radio.stats.lbt_deferred++;
+
+            _twr_radio_transmit_defer();
+
+            return;
+        }
+    }
+
+    twr_spirit1_tx();
+
+    _twr_radio.state = TWR_RADIO_STATE_TX;
+}
+
+static void _twr_radio_transmit_update_rate(int successes, int failures)
+{
+    if (_twr_radio.transmit_peer_id == 0)
+    {
+        return;
+    }
+
+    twr_radio_peer_t *peer = twr_radio_get_peer_device(_twr_radio.transmit_peer_id);
+
+    if (peer == NULL)
+    {
+        return;
+    }
+
+    // Exponentially weighted rate of acknowledged transmissions with weight 1/8
+    for (int i = 0; i < failures; i++)
+    {
+        peer->ack_rate -= peer->ack_rate >> 3;
+    }
+
+    for (int i = 0; i < successes; i++)
+    {
+        peer->ack_rate += (255 - peer->ack_rate) >> 3;
+    }
+}
+
+static bool _twr_radio_is_pub(uint8_t header)
+{
+    // Only messages for gateway decoded by twr_radio_pub_decode, node messages are filtered by target on receive
+    return (header >= TWR_RADIO_HEADER_PUB_PUSH_BUTTON && header <= TWR_RADIO_HEADER_PUB_BUFFER) ||
+           header == TWR_RADIO_HEADER_PUB_BATTERY ||
+           (header >= TWR_RADIO_HEADER_PUB_ACCELERATION && header <= TWR_RADIO_HEADER_PUB_STATE) ||
+           header == TWR_RADIO_HEADER_PUB_VALUE_INT ||
+           header == TWR_RADIO_HEADER_PUB_TOPIC_ID;
+}
+
+static size_t _twr_radio_pub_batch(uint8_t *buffer)
+{
+    uint8_t *queue_item_buffer;
+    size_t queue_item_length;
+    size_t length = 9;
+    int count = 0;
+
+    buffer[8] = TWR_RADIO_HEADER_PUB_BATCH;
+
+    while ((queue_item_buffer = twr_queue_peek(&_twr_radio.pub_queue, &queue_item_length)) != NULL)
+    {
+        if (!_twr_radio_is_pub(queue_item_buffer[0]) || length + 1 + queue_item_length > TWR_SPIRIT1_MAX_PACKET_SIZE)
+        {
+            break;
+        }
+
+        buffer[length++] = queue_item_length;
+
+        memcpy(buffer + length, queue_item_buffer, queue_item_length);
+
+        length += queue_item_length;
+
+        twr_queue_pop(&_twr_radio.pub_queue);
+
+        count++;
+    }
+
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    // Single message goes without batch overhead
+    if (count == 1)
+    {
+        memmove(buffer + 8, buffer + 10, length - 10);
+
+        length -= 2;
+    }
+
+    return length;
+}
+
+#if TWR_RADIO_COMPACT
+static size_t _twr_radio_pub_compact(uint8_t *buffer)
+{
+    uint8_t *queue_item_buffer;
+    size_t queue_item_length;
+    size_t length = 9;
+
+    buffer[8] = TWR_RADIO_HEADER_PUB_COMPACT;
+
+    while ((queue_item_buffer = twr_queue_peek(&_twr_radio.pub_queue, &queue_item_length)) != NULL)
+    {
+        if (!_twr_radio_is_pub(queue_item_buffer[0]))
+        {
+            break;
+        }
+
+        // Slots are updated only by record which fits into packet
+        if (twr_radio_compact_encode(queue_item_buffer, queue_item_length, buffer + length, TWR_SPIRIT1_MAX_PACKET_SIZE - length, false) == 0)
+        {
+            break;
+        }
+
+        length += twr_radio_compact_encode(queue_item_buffer, queue_item_length, buffer + length, TWR_SPIRIT1_MAX_PACKET_SIZE - length, true);
+
+        twr_queue_pop(&_twr_radio.pub_queue);
+    }
+
+    return length > 9 ? length : 0;
+}
+#endif
+
+#if _TWR_RADIO_HOLD
+static void _twr_radio_hold_rotate(void)
+{
+    uint8_t item[TWR_RADIO_MAX_BUFFER_SIZE];
+    size_t length;
+
+    uint8_t *queue_item_buffer = twr_queue_peek(&_twr_radio.hold_queue, &length);
+
+    memcpy(item, queue_item_buffer, length);
+
+    twr_queue_pop(&_twr_radio.hold_queue);
+
+    // Space of popped message is free for it again
+    twr_queue_put(&_twr_radio.hold_queue, item, length);
+}
+
+static void _twr_radio_hold_pop(void)
+{
+    size_t length;
+    uint64_t id;
+
+    uint8_t *queue_item_buffer = twr_queue_peek(&_twr_radio.hold_queue, &length);
+
+    twr_radio_id_from_buffer(queue_item_buffer + 1, &id);
+
+    twr_radio_peer_t *peer = twr_radio_get_peer_device(id);
+
+    if ((peer != NULL) && (peer->hold_pending > 0))
+    {
+        peer->hold_pending--;
+    }
+
+    twr_queue_pop(&_twr_radio.hold_queue);
+
+    _twr_radio.hold_queue_count--;
+}
+
+static void _twr_radio_hold_attach(twr_radio_peer_t *peer)
+{
+    uint8_t *tx_buffer = twr_spirit1_get_tx_buffer();
+    size_t length = 9;
+
+    // Acknowledgment was not sent as radio is busy
+    if ((_twr_radio.state != TWR_RADIO_STATE_RX_SEND_ACK) && (_twr_radio.state != TWR_RADIO_STATE_TX_SEND_ACK))
+    {
+        return;
+    }
+
+#if TWR_RADIO_ACK_DATA
+    if (peer->ack_data)
+    {
+        size_t queue_item_length;
+        uint8_t *queue_item_buffer = _twr_radio_hold_find(peer->id, &queue_item_length);
+
+        if ((queue_item_buffer != NULL) && (length + 2 + queue_item_length <= TWR_SPIRIT1_MAX_PACKET_SIZE))
+        {
+            tx_buffer[length++] = _TWR_RADIO_ACK_DATA;
+            tx_buffer[length++] = queue_item_length;
+
+            memcpy(tx_buffer + length, queue_item_buffer, queue_item_length);
+
+            length += queue_item_length;
+
+            _twr_radio_hold_pop();
+        }
+    }
+#endif
+
+#if TWR_RADIO_RX_SLOT
+    // Messages which did not fit go in slot
+    if (peer->rx_slot && (peer->hold_pending > 0) && (length + 3 <= TWR_SPIRIT1_MAX_PACKET_SIZE))
+    {
+        length += _twr_radio_rx_slot_assign(peer, tx_buffer + length);
+    }
+#endif
+
+    if (length > 9)
+    {
+        twr_spirit1_set_tx_length(length);
+    }
+}
+
+static void _twr_radio_ack_decode(uint8_t *buffer, size_t length)
+{
+    uint8_t *extension = buffer + 9;
+    uint8_t *end = buffer + length;
+
+    // Extensions follow each other, codes of single byte acknowledgments end decoding
+    while (extension < end)
+    {
+#if TWR_RADIO_ACK_DATA
+        if ((extension[0] == _TWR_RADIO_ACK_DATA) && (extension + 2 <= end) && (extension + 2 + extension[1] <= end))
+        {
+            uint8_t *qbuffer = twr_queue_reserve(&_twr_radio.rx_queue, TWR_RADIO_HEAD_SIZE + extension[1]);
+
+            // Message goes to decoding as if gateway sent it in own packet
+            if (qbuffer != NULL)
+            {
+                twr_radio_id_to_buffer(&_twr_radio.peer_devices[0].id, qbuffer);
+
+                qbuffer[6] = buffer[6];
+                qbuffer[7] = buffer[7];
+
+                memcpy(qbuffer + TWR_RADIO_HEAD_SIZE, extension + 2, extension[1]);
+
+                twr_queue_commit(&_twr_radio.rx_queue, TWR_RADIO_HEAD_SIZE + extension[1]);
+
+                _twr_radio.stats.rx_packets++;
+
+                twr_scheduler_plan_now(_twr_radio.rx_task_id);
+            }
+            else
+            {
+                _twr_radio.stats.rx_dropped++;
+            }
+
+            extension += 2 + extension[1];
+
+            continue;
+        }
+#endif
+#if TWR_RADIO_RX_SLOT
+        if ((extension[0] == _TWR_RADIO_ACK_RX_SLOT) && (extension + 3 <= end))
+        {
+            twr_tick_t delay = (twr_tick_t) extension[1] | (twr_tick_t) extension[2] << 8;
 
-        _twr_radio.transmit_count = _TWR_RADIO_TX_MAX_COUNT;
+            twr_scheduler_plan_absolute(_twr_radio.rx_slot_task_id, twr_tick_get() + delay);
 
-        _twr_radio.state = TWR_RADIO_STATE_TX;
+            extension += 3;
 
-        return;
+            continue;
+        }
+#endif
+        break;
     }
+}
+#endif
 
-    if (_twr_radio.ack && (_twr_radio.sent_subs != _twr_radio.subs_length))
-    {
-        uint8_t *buffer = twr_spirit1_get_tx_buffer();
+#if TWR_RADIO_ACK_DATA
+static uint8_t *_twr_radio_hold_find(uint64_t id, size_t *length)
+{
+    uint8_t *queue_item_buffer;
+    uint64_t item_id;
 
-        twr_radio_sub_t *sub = &_twr_radio.subs[_twr_radio.sent_subs];
+    // Messages of other nodes rotate to the tail, the first message of node is the oldest one
+    for (int i = _twr_radio.hold_queue_count; i > 0; i--)
+    {
+        queue_item_buffer = twr_queue_peek(&_twr_radio.hold_queue, length);
 
-        twr_radio_id_to_buffer(&_twr_radio.my_id, buffer);
+        twr_radio_id_from_buffer(queue_item_buffer + 1, &item_id);
 
-        _twr_radio.message_id++;
+        if (item_id == id)
+        {
+            return queue_item_buffer;
+        }
 
-        buffer[6] = _twr_radio.message_id;
-        buffer[7] = _twr_radio.message_id >> 8;
+        twr_radio_peer_t *peer = twr_radio_get_peer_device(item_id);
 
-        buffer[8] = TWR_RADIO_HEADER_SUB_REG;
+        if ((peer == NULL) || (!peer->rx_slot && !peer->ack_data))
+        {
+            // Node was unpaired or paired again without holding of messages
+            _twr_radio_hold_pop();
 
-        buffer[9] = _twr_radio.sent_subs;
+            continue;
+        }
 
-        buffer[10] = sub->type;
+        _twr_radio_hold_rotate();
+    }
 
-        strncpy((char *)buffer + 11, sub->topic, TWR_RADIO_MAX_BUFFER_SIZE - 3);
+    return NULL;
+}
+#endif
 
-        twr_spirit1_set_tx_length(11 + strlen(sub->topic) + 1);
+#if TWR_RADIO_RX_SLOT
+static void _twr_radio_rx_slot_task(void *param)
+{
+    (void) param;
 
-        twr_spirit1_tx();
+    // Gateway serves held messages from radio task
+    if (_twr_radio.mode == TWR_RADIO_MODE_GATEWAY)
+    {
+        twr_scheduler_plan_now(_twr_radio.task_id);
 
-        _twr_radio.transmit_count = _TWR_RADIO_TX_MAX_COUNT;
+        return;
+    }
 
-        _twr_radio.state = TWR_RADIO_STATE_TX;
+    _twr_radio.rx_timeout_sleeping = twr_tick_get() + TWR_RADIO_RX_SLOT_WINDOW;
 
-        return;
+    // Transmission in progress continues to slot on its own
+    if ((_twr_radio.state == TWR_RADIO_STATE_SLEEP) || (_twr_radio.state == TWR_RADIO_STATE_RX))
+    {
+        _twr_radio_go_to_state_rx_or_sleep();
     }
+}
 
-    uint8_t queue_item_buffer[sizeof(_twr_radio.pub_queue_buffer)];
+static uint8_t *_twr_radio_rx_slot_peek(size_t *length)
+{
+    twr_tick_t now = twr_tick_get();
+    twr_tick_t next = TWR_TICK_INFINITY;
+    uint8_t *queue_item_buffer;
     size_t queue_item_length;
     uint64_t id;
 
-    while (twr_queue_get(&_twr_radio.rx_queue, queue_item_buffer, &queue_item_length))
+    // Messages of nodes without open slot rotate to the tail, order of messages of one node is kept
+    for (int i = _twr_radio.hold_queue_count; i > 0; i--)
     {
-        twr_radio_id_from_buffer(queue_item_buffer, &id);
-
-        queue_item_length -= TWR_RADIO_HEAD_SIZE;
+        queue_item_buffer = twr_queue_peek(&_twr_radio.hold_queue, &queue_item_length);
 
-        twr_radio_pub_decode(&id, queue_item_buffer + TWR_RADIO_HEAD_SIZE, queue_item_length);
+        twr_radio_id_from_buffer(queue_item_buffer + 1, &id);
 
-        twr_radio_node_decode(&id, queue_item_buffer + TWR_RADIO_HEAD_SIZE, queue_item_length);
+        twr_radio_peer_t *peer = twr_radio_get_peer_device(id);
 
-        if (queue_item_buffer[TWR_RADIO_HEAD_SIZE] == TWR_RADIO_HEADER_SUB_DATA)
+        if ((peer == NULL) || (!peer->rx_slot && !peer->ack_data))
         {
-            uint8_t order = queue_item_buffer[TWR_RADIO_HEAD_SIZE + 1 + TWR_RADIO_ID_SIZE];
-
-            if (order >= _twr_radio.subs_length)
-            {
-                return;
-            }
+            // Node was unpaired or paired again without holding of messages
+            _twr_radio_hold_pop();
 
-            twr_radio_sub_t *sub = &_twr_radio.subs[order];
+            continue;
+        }
 
-            if (sub->callback != NULL)
+        if ((peer->rx_slot_tick != 0) && (now >= peer->rx_slot_tick))
+        {
+            // Started transmission has to fit into slot with acknowledgment
+            if (now + _TWR_RADIO_ACK_TIMEOUT < peer->rx_slot_tick + TWR_RADIO_RX_SLOT_WINDOW - _TWR_RADIO_RX_SLOT_GUARD)
             {
-                uint8_t *payload = NULL;
-
-                if (queue_item_length > 1 + TWR_RADIO_ID_SIZE + 1)
-                {
-                    payload = queue_item_buffer + TWR_RADIO_HEAD_SIZE + 1 + TWR_RADIO_ID_SIZE + 1;
-                }
+                *length = queue_item_length;
 
-                sub->callback(&id, sub->topic, payload, sub->param);
+                return queue_item_buffer;
             }
-        }
-        else if (queue_item_buffer[TWR_RADIO_HEAD_SIZE] == TWR_RADIO_HEADER_PUB_INFO)
-        {
-            queue_item_buffer[queue_item_length + TWR_RADIO_HEAD_SIZE - 1] = 0;
 
-            twr_radio_on_info(&id, (char *) queue_item_buffer + TWR_RADIO_HEAD_SIZE + 1, "", TWR_RADIO_MODE_UNKNOWN);
+            // Rest waits for slot assigned in the next acknowledgment
+            peer->rx_slot_tick = 0;
         }
-        else if (queue_item_buffer[TWR_RADIO_HEAD_SIZE] == TWR_RADIO_HEADER_SUB_REG)
+        else if ((peer->rx_slot_tick != 0) && (peer->rx_slot_tick < next))
         {
-            uint8_t *order = queue_item_buffer + TWR_RADIO_HEAD_SIZE + 1;
-
-            twr_radio_sub_pt_t *pt = (twr_radio_sub_pt_t *) queue_item_buffer + TWR_RADIO_HEAD_SIZE + 2;
-
-            char *topic = (char *) queue_item_buffer + TWR_RADIO_HEAD_SIZE + 3;
-
-            twr_radio_on_sub(&id, order, pt, topic);
+            next = peer->rx_slot_tick;
         }
+
+        _twr_radio_hold_rotate();
     }
 
-    if (twr_queue_get(&_twr_radio.pub_queue, queue_item_buffer, &queue_item_length))
+    if (next != TWR_TICK_INFINITY)
     {
-        uint8_t *buffer = twr_spirit1_get_tx_buffer();
+        twr_scheduler_plan_absolute(_twr_radio.rx_slot_task_id, next);
+    }
 
-        twr_radio_id_to_buffer(&_twr_radio.my_id, buffer);
+    return NULL;
+}
 
-        _twr_radio.message_id++;
+static size_t _twr_radio_rx_slot_assign(twr_radio_peer_t *peer, uint8_t *buffer)
+{
+    twr_tick_t now = twr_tick_get();
+    twr_tick_t tick = now + _TWR_RADIO_RX_SLOT_DELAY;
 
-        buffer[6] = _twr_radio.message_id;
-        buffer[7] = _twr_radio.message_id >> 8;
+    // Slots of nodes follow each other so that gateway serves one node at a time
+    if (tick < _twr_radio.rx_slot_next)
+    {
+        tick = _twr_radio.rx_slot_next;
+    }
 
-        memcpy(buffer + 8, queue_item_buffer, queue_item_length);
+    if (tick - now > UINT16_MAX)
+    {
+        return 0;
+    }
 
-        twr_spirit1_set_tx_length(8 + queue_item_length);
+    buffer[0] = _TWR_RADIO_ACK_RX_SLOT;
+    buffer[1] = tick - now;
+    buffer[2] = (tick - now) >> 8;
 
-        twr_spirit1_tx();
+    // Node opens receiver after reception of acknowledgment, gateway starts a bit later
+    peer->rx_slot_tick = tick + _TWR_RADIO_RX_SLOT_GUARD;
 
-        _twr_radio.transmit_count = _TWR_RADIO_TX_MAX_COUNT;
+    _twr_radio.rx_slot_next = tick + TWR_RADIO_RX_SLOT_WINDOW;
 
-        _twr_radio.state = TWR_RADIO_STATE_TX;
-    }
+    return 3;
 }
+#endif
 
 static bool _twr_radio_scan_cache_push(void)
 {
@@ -550,12 +1581,14 @@ static void _twr_radio_send_ack(void)
 
     _twr_radio.transmit_count = 2;
 
+    _twr_radio.stats.ack_sent++;
+
     twr_spirit1_tx();
 }
 
 static void _twr_radio_go_to_state_rx_or_sleep(void)
 {
-    if (_twr_radio.state == TWR_RADIO_STATE_TX)
+    if ((_twr_radio.state == TWR_RADIO_STATE_TX) || (_twr_radio.state == TWR_RADIO_STATE_TX_BACKOFF))
     {
         return;
     }
@@ -595,12 +1628,139 @@ static void _twr_radio_go_to_state_rx_or_sleep(void)
     twr_scheduler_plan_now(_twr_radio.task_id);
 }
 
+static void _twr_radio_rx_task(void *param)
+{
+    (void) param;
+
+    uint8_t *queue_item_buffer;
+    size_t queue_item_length;
+    uint64_t id;
+
+    // Received messages are decoded in place and dropped afterwards, the rest waits for the next run
+    for (int i = 0; i < TWR_RADIO_RX_BATCH; i++)
+    {
+        if ((queue_item_buffer = twr_queue_peek(&_twr_radio.rx_queue, &queue_item_length)) == NULL)
+        {
+            return;
+        }
+
+        twr_radio_id_from_buffer(queue_item_buffer, &id);
+
+        queue_item_length -= TWR_RADIO_HEAD_SIZE;
+
+        twr_radio_pub_decode(&id, queue_item_buffer + TWR_RADIO_HEAD_SIZE, queue_item_length);
+
+        twr_radio_node_decode(&id, queue_item_buffer + TWR_RADIO_HEAD_SIZE, queue_item_length);
+
+        if (queue_item_buffer[TWR_RADIO_HEAD_SIZE] == TWR_RADIO_HEADER_SUB_DATA)
+        {
+            uint8_t order = queue_item_buffer[TWR_RADIO_HEAD_SIZE + 1 + TWR_RADIO_ID_SIZE];
+
+            if (order >= _twr_radio.subs_length)
+            {
+                twr_queue_pop(&_twr_radio.rx_queue);
+
+                continue;
+            }
+
+            twr_radio_sub_t *sub = &_twr_radio.subs[order];
+
+            if (sub->callback != NULL)
+            {
+                uint8_t *payload = NULL;
+
+                if (queue_item_length > 1 + TWR_RADIO_ID_SIZE + 1)
+                {
+                    payload = queue_item_buffer + TWR_RADIO_HEAD_SIZE + 1 + TWR_RADIO_ID_SIZE + 1;
+                }
+
+                sub->callback(&id, sub->topic, payload, sub->param);
+            }
+        }
+        else if (queue_item_buffer[TWR_RADIO_HEAD_SIZE] == TWR_RADIO_HEADER_PUB_INFO)
+        {
+            queue_item_buffer[queue_item_length + TWR_RADIO_HEAD_SIZE - 1] = 0;
+
+            twr_radio_on_info(&id, (char *) queue_item_buffer + TWR_RADIO_HEAD_SIZE + 1, "", TWR_RADIO_MODE_UNKNOWN);
+        }
+        else if (queue_item_buffer[TWR_RADIO_HEAD_SIZE] == TWR_RADIO_HEADER_PUB_BATCH)
+        {
+            uint8_t *record = queue_item_buffer + TWR_RADIO_HEAD_SIZE + 1;
+            uint8_t *end = queue_item_buffer + TWR_RADIO_HEAD_SIZE + queue_item_length;
+
+            // Records are decoded as if they came in separate packets
+            while (record < end && record[0] != 0 && record + 1 + record[0] <= end)
+            {
+                twr_radio_pub_decode(&id, record + 1, record[0]);
+
+                record += 1 + record[0];
+            }
+        }
+#if TWR_RADIO_COMPACT
+        else if (queue_item_buffer[TWR_RADIO_HEAD_SIZE] == TWR_RADIO_HEADER_PUB_COMPACT)
+        {
+            if (!twr_radio_compact_decode(&id, queue_item_buffer + TWR_RADIO_HEAD_SIZE + 1, queue_item_length - 1))
+            {
+                twr_radio_peer_t *peer = twr_radio_get_peer_device(id);
+
+                // Node starts again with keys on the next acknowledgment
+                if (peer != NULL)
+                {
+                    peer->compact_reset = true;
+                }
+            }
+        }
+#endif
+        else if (queue_item_buffer[TWR_RADIO_HEAD_SIZE] == TWR_RADIO_HEADER_SUB_REG)
+        {
+            uint8_t *order = queue_item_buffer + TWR_RADIO_HEAD_SIZE + 1;
+
+            twr_radio_sub_pt_t *pt = (twr_radio_sub_pt_t *) queue_item_buffer + TWR_RADIO_HEAD_SIZE + 2;
+
+            char *topic = (char *) queue_item_buffer + TWR_RADIO_HEAD_SIZE + 3;
+
+            twr_radio_on_sub(&id, order, pt, topic);
+        }
+#if TWR_RADIO_TOPICS
+        else if ((queue_item_buffer[TWR_RADIO_HEAD_SIZE] == TWR_RADIO_HEADER_TOPIC_REG) && (queue_item_length > 2))
+        {
+            queue_item_buffer[TWR_RADIO_HEAD_SIZE + queue_item_length - 1] = 0;
+
+            _twr_radio_topic_store(&id, queue_item_buffer[TWR_RADIO_HEAD_SIZE + 1], (char *) queue_item_buffer + TWR_RADIO_HEAD_SIZE + 2);
+        }
+#endif
+
+        twr_queue_pop(&_twr_radio.rx_queue);
+    }
+
+    if (twr_queue_peek(&_twr_radio.rx_queue, &queue_item_length) != NULL)
+    {
+        twr_scheduler_plan_current_now();
+    }
+}
+
+static void _twr_radio_rx_put(const void *buffer, size_t length)
+{
+    if (!twr_queue_put(&_twr_radio.rx_queue, buffer, length))
+    {
+        _twr_radio.stats.rx_dropped++;
+
+        return;
+    }
+
+    _twr_radio.stats.rx_packets++;
+
+    twr_scheduler_plan_now(_twr_radio.rx_task_id);
+}
+
 static void _twr_radio_spirit1_event_handler(twr_spirit1_event_t event, void *event_param)
 {
     (void) event_param;
 
     if (event == TWR_SPIRIT1_EVENT_TX_DONE)
     {
+        _twr_radio_duty_cycle_update(twr_tick_get());
+
         if (_twr_radio.transmit_count > 0)
         {
             _twr_radio.transmit_count--;
@@ -673,14 +1833,21 @@ static void _twr_radio_spirit1_event_handler(twr_spirit1_event_t event, void *ev
         {
             if (_twr_radio.transmit_count > 0)
             {
-                twr_spirit1_tx();
-
-                _twr_radio.state = TWR_RADIO_STATE_TX;
+                _twr_radio_transmit_retry();
 
                 return;
             }
             else
             {
+                _twr_radio_transmit_update_rate(0, _twr_radio.transmit_max);
+
+                _twr_radio.stats.tx_dropped++;
+
+#if TWR_RADIO_COMPACT
+                // Gateway may have missed keys or values of the lost packet
+                twr_radio_compact_reset();
+#endif
+
                 if (_twr_radio.event_handler)
                 {
                     _twr_radio.event_handler(TWR_RADIO_EVENT_TX_ERROR, _twr_radio.event_param);
@@ -702,9 +1869,7 @@ static void _twr_radio_spirit1_event_handler(twr_spirit1_event_t event, void *ev
             {
                 if (_twr_radio.transmit_count > 0)
                 {
-                    twr_spirit1_tx();
-
-                    _twr_radio.state = TWR_RADIO_STATE_TX;
+                    _twr_radio_transmit_retry();
 
                     return;
                 }
@@ -726,19 +1891,26 @@ static void _twr_radio_spirit1_event_handler(twr_spirit1_event_t event, void *ev
             // ACK check
             if (buffer[8] == TWR_RADIO_HEADER_ACK)
             {
-                if (_twr_radio.state == TWR_RADIO_STATE_TX_WAIT_ACK)
+                // Late acknowledgment is accepted during backoff as well
+                if ((_twr_radio.state == TWR_RADIO_STATE_TX_WAIT_ACK) || (_twr_radio.state == TWR_RADIO_STATE_TX_BACKOFF))
                 {
                     uint8_t *tx_buffer = twr_spirit1_get_tx_buffer();
 
                     if ((_twr_radio.peer_id == _twr_radio.my_id) && (_twr_radio.message_id == message_id) )
                     {
+                        _twr_radio_transmit_update_rate(1, _twr_radio.transmit_max - _twr_radio.transmit_count - 1);
+
+                        _twr_radio.stats.tx_acked++;
+
                         _twr_radio.transmit_count = 0;
 
+                        _twr_radio.state = TWR_RADIO_STATE_TX_WAIT_ACK;
+
                         _twr_radio.ack = true;
 
                         if (tx_buffer[8] == TWR_RADIO_HEADER_PAIRING)
                         {
-                            if (length == 15)
+                            if (length >= 15)
                             {
                                 twr_radio_id_from_buffer(buffer + 9, &_twr_radio.peer_id);
 
@@ -746,10 +1918,13 @@ static void _twr_radio_spirit1_event_handler(twr_spirit1_event_t event, void *ev
                                 {
                                     _twr_radio.peer_devices[0].id = _twr_radio.peer_id;
                                     _twr_radio.peer_devices[0].message_id_synced = false;
+                                    _twr_radio.peer_devices[0].ack_rate = _TWR_RADIO_ACK_RATE_INIT;
                                     _twr_radio.peer_devices_length = 1;
 
-                                    _twr_radio.save_peer_devices = true;
-                                    twr_scheduler_plan_now(_twr_radio.task_id);
+                                    _twr_radio_peer_index_rebuild();
+
+                                    _twr_radio_peer_storage_mark(0);
+                                    _twr_radio_peer_storage_mark(-1);
 
                                     _twr_radio.sent_subs = 0;
 
@@ -758,18 +1933,82 @@ static void _twr_radio_spirit1_event_handler(twr_spirit1_event_t event, void *ev
                                         _twr_radio.event_handler(TWR_RADIO_EVENT_PAIRED, _twr_radio.event_param);
                                     }
                                 }
+#if TWR_RADIO_COMPACT
+                                if (_twr_radio.mode != TWR_RADIO_MODE_GATEWAY)
+                                {
+                                    // Gateway with older firmware acknowledges without capabilities
+                                    _twr_radio.peer_devices[0].compact = (length > 15) && ((buffer[15] & _TWR_RADIO_CAPABILITY_COMPACT) != 0);
+
+                                    twr_radio_compact_reset();
+                                }
+#endif
+#if TWR_RADIO_TOPICS
+                                if (_twr_radio.mode != TWR_RADIO_MODE_GATEWAY)
+                                {
+                                    _twr_radio.peer_devices[0].topics = (length > 15) && ((buffer[15] & _TWR_RADIO_CAPABILITY_TOPICS) != 0);
+
+                                    _twr_radio.sent_topics = 0;
+                                }
+#endif
+#if _TWR_RADIO_HOLD
+                                if (_twr_radio.mode != TWR_RADIO_MODE_GATEWAY)
+                                {
+                                    _twr_radio.peer_devices[0].rx_slot = (length > 15) && ((buffer[15] & _TWR_RADIO_CAPABILITY_RX_SLOT) != 0);
+                                    _twr_radio.peer_devices[0].ack_data = (length > 15) && ((buffer[15] & _TWR_RADIO_CAPABILITY_ACK_DATA) != 0);
+                                }
+#endif
                             }
                         }
                         else if (tx_buffer[8] == TWR_RADIO_HEADER_SUB_REG)
                         {
                             _twr_radio.sent_subs++;
                         }
+#if TWR_RADIO_TOPICS
+                        else if (tx_buffer[8] == TWR_RADIO_HEADER_TOPIC_REG)
+                        {
+                            _twr_radio.sent_topics++;
+                        }
+                        else if ((length == 10) && (buffer[9] == _TWR_RADIO_ACK_TOPICS_RESET))
+                        {
+                            _twr_radio.sent_topics = 0;
+                        }
+#endif
                         else if ((length == 10) && (buffer[9] == _TWR_RADIO_ACK_SUB_REQUEST))
                         {
                             _twr_radio.sent_subs = 0;
+
+#if TWR_RADIO_TOPICS
+                            _twr_radio.sent_topics = 0;
+#endif
+
+#if TWR_RADIO_COMPACT
+                            // Gateway was restarted and lost slots as well
+                            twr_radio_compact_reset();
+#endif
+                        }
+#if TWR_RADIO_COMPACT
+                        else if ((length == 10) && (buffer[9] == _TWR_RADIO_ACK_COMPACT_RESET))
+                        {
+                            twr_radio_compact_reset();
+                        }
+#endif
+
+                        bool rx_after_ack = _twr_radio.sleeping_mode_rx_timeout != 0;
+
+#if _TWR_RADIO_HOLD
+                        if ((_twr_radio.mode != TWR_RADIO_MODE_GATEWAY) && (tx_buffer[8] != TWR_RADIO_HEADER_PAIRING))
+                        {
+                            _twr_radio_ack_decode(buffer, length);
+
+                            // Gateway assigns slot only when it holds messages, receiver stays off otherwise
+                            if (_twr_radio.peer_devices[0].rx_slot)
+                            {
+                                rx_after_ack = false;
+                            }
                         }
+#endif
 
-                        if (_twr_radio.sleeping_mode_rx_timeout != 0)
+                        if (rx_after_ack)
                         {
                             _twr_radio.rx_timeout_sleeping = twr_tick_get() + _twr_radio.sleeping_mode_rx_timeout;
                         }
@@ -809,6 +2048,49 @@ static void _twr_radio_spirit1_event_handler(twr_spirit1_event_t event, void *ev
 
                     twr_spirit1_set_tx_length(15);
 
+                    uint8_t capabilities = 0;
+
+                    if ((length > 10) && (10 + (size_t) buffer[9] + 1 < length))
+                    {
+                        uint8_t *version = buffer + 10 + buffer[9] + 1;
+                        uint8_t *end = memchr(version, 0, buffer + length - version);
+
+                        // Older node sends mode right after version
+                        if ((end != NULL) && (end + 3 == buffer + length))
+                        {
+                            capabilities = end[1] & _TWR_RADIO_CAPABILITIES;
+                        }
+                    }
+
+                    // Capabilities are acknowledged only to node which sent its own
+                    if (capabilities != 0)
+                    {
+                        tx_buffer[15] = capabilities;
+
+                        twr_spirit1_set_tx_length(16);
+                    }
+
+                    if (peer->message_id != message_id)
+                    {
+#if TWR_RADIO_COMPACT
+                        peer->compact = (capabilities & _TWR_RADIO_CAPABILITY_COMPACT) != 0;
+                        peer->compact_reset = false;
+
+                        twr_radio_compact_peer_reset(&_twr_radio.peer_id);
+#endif
+#if TWR_RADIO_TOPICS
+                        peer->topics = (capabilities & _TWR_RADIO_CAPABILITY_TOPICS) != 0;
+                        peer->topics_reset = false;
+
+                        _twr_radio_topic_store(&_twr_radio.peer_id, 0xff, NULL);
+#endif
+#if _TWR_RADIO_HOLD
+                        peer->rx_slot = (capabilities & _TWR_RADIO_CAPABILITY_RX_SLOT) != 0;
+                        peer->ack_data = (capabilities & _TWR_RADIO_CAPABILITY_ACK_DATA) != 0;
+                        peer->rx_slot_tick = 0;
+#endif
+                    }
+
                     if ((length > 10) && (peer->message_id != message_id))
                     {
                         if (10 + (size_t) buffer[9] + 1 < length)
@@ -887,27 +2169,71 @@ static void _twr_radio_spirit1_event_handler(twr_spirit1_event_t event, void *ev
                             }
                         }
 
-                        twr_queue_put(&_twr_radio.rx_queue, buffer, length);
-
-                        twr_scheduler_plan_now(_twr_radio.task_id);
+                        _twr_radio_rx_put(buffer, length);
 
                         peer->message_id_synced = true;
 
                         peer->rssi = twr_spirit1_get_rx_rssi();
+
+#if TWR_RADIO_RSSI_HISTOGRAM
+                        int bin = (peer->rssi - TWR_RADIO_RSSI_HISTOGRAM_MIN) / TWR_RADIO_RSSI_HISTOGRAM_STEP;
+
+                        bin = bin < 0 ? 0 : bin >= TWR_RADIO_RSSI_HISTOGRAM_BINS ? TWR_RADIO_RSSI_HISTOGRAM_BINS - 1 : bin;
+
+                        if (peer->rssi_histogram[bin] != UINT16_MAX)
+                        {
+                            peer->rssi_histogram[bin]++;
+                        }
+#endif
                     }
 
-                    if (peer->message_id_synced)
-                    {
-                        _twr_radio_send_ack();
+                    if (peer->message_id_synced)
+                    {
+                        _twr_radio_send_ack();
+
+                        if (send_subs_request)
+                        {
+                            uint8_t *tx_buffer = twr_spirit1_get_tx_buffer();
+
+                            tx_buffer[9] = _TWR_RADIO_ACK_SUB_REQUEST;
+
+                            twr_spirit1_set_tx_length(10);
+
+                            peer->compact_reset = false;
+#if TWR_RADIO_TOPICS
+                            peer->topics_reset = false;
+#endif
+                        }
+#if TWR_RADIO_COMPACT
+                        else if (peer->compact_reset)
+                        {
+                            uint8_t *tx_buffer = twr_spirit1_get_tx_buffer();
+
+                            tx_buffer[9] = _TWR_RADIO_ACK_COMPACT_RESET;
+
+                            twr_spirit1_set_tx_length(10);
 
-                        if (send_subs_request)
+                            peer->compact_reset = false;
+                        }
+#endif
+#if TWR_RADIO_TOPICS
+                        else if (peer->topics_reset)
                         {
                             uint8_t *tx_buffer = twr_spirit1_get_tx_buffer();
 
-                            tx_buffer[9] = _TWR_RADIO_ACK_SUB_REQUEST;
+                            tx_buffer[9] = _TWR_RADIO_ACK_TOPICS_RESET;
 
                             twr_spirit1_set_tx_length(10);
+
+                            peer->topics_reset = false;
                         }
+#endif
+#if _TWR_RADIO_HOLD
+                        else if (peer->hold_pending > 0)
+                        {
+                            _twr_radio_hold_attach(peer);
+                        }
+#endif
                     }
 
                     return;
@@ -932,20 +2258,24 @@ static void _twr_radio_spirit1_event_handler(twr_spirit1_event_t event, void *ev
 static void _twr_radio_load_peer_devices(void)
 {
     uint32_t address = (uint32_t) twr_eeprom_get_size() - 8;
-    uint64_t buffer[3];
-    uint32_t *pointer = (uint32_t *)buffer;
-    uint8_t length = 0;
+    uint64_t buffer[_TWR_RADIO_PEER_ENTRY_SIZE / sizeof(uint64_t)];
+    uint16_t length = 0;
 
-    twr_eeprom_read(twr_eeprom_get_size() - 1, &length, 1);
+    twr_eeprom_read(twr_eeprom_get_size() - _TWR_RADIO_PEER_LENGTH_SIZE, &length, _TWR_RADIO_PEER_LENGTH_SIZE);
 
     _twr_radio.peer_devices_length = 0;
 
-    for (int i = 0; (i < length) && (i < TWR_RADIO_MAX_DEVICES); i++)
+    for (int i = 0; (i < length) && (i < TWR_RADIO_MAX_DEVICES) && (address >= sizeof(buffer)); i++)
     {
         address -= sizeof(buffer);
 
         twr_eeprom_read(address, buffer, sizeof(buffer));
 
+        bool repair = false;
+
+#if TWR_RADIO_PEER_STORAGE_REDUNDANT
+        uint32_t *pointer = (uint32_t *)buffer;
+
         pointer[2] = ~pointer[2];
         pointer[5] = ~pointer[5];
 
@@ -955,67 +2285,167 @@ static void _twr_radio_load_peer_devices(void)
             {
                 buffer[0] = buffer[1];
 
-                _twr_radio.save_peer_devices = true;
-
-                twr_scheduler_plan_now(_twr_radio.task_id);
+                repair = true;
             }
             else
             {
                 continue;
             }
         }
+#else
+        if (buffer[0] != _twr_radio_peer_entry_encode(buffer[0]))
+        {
+            continue;
+        }
+
+        buffer[0] &= 0xffffffffffffULL;
+#endif
 
         if (buffer[0] != 0)
         {
-            _twr_radio.peer_devices[_twr_radio.peer_devices_length].id = buffer[0];
-            _twr_radio.peer_devices[_twr_radio.peer_devices_length].message_id_synced = false;
+            int position = _twr_radio.peer_devices_length;
+
+            // Entry is rewritten when repaired or shifted by skipped entry
+            if (repair || (position != i))
+            {
+                _twr_radio.peer_storage_dirty[position / 8] |= 1 << (position % 8);
+            }
+
+            _twr_radio.peer_devices[position].id = buffer[0];
+            _twr_radio.peer_devices[position].message_id_synced = false;
+            _twr_radio.peer_devices[position].ack_rate = _TWR_RADIO_ACK_RATE_INIT;
             _twr_radio.peer_devices_length++;
         }
     }
+
+    if (_twr_radio.peer_devices_length != length)
+    {
+        _twr_radio.peer_storage_length_dirty = true;
+    }
+
+    _twr_radio.save_peer_devices = true;
+
+    _twr_radio_peer_index_rebuild();
 }
 
 static void _twr_radio_save_peer_devices(void)
 {
-    uint32_t address = (uint32_t) twr_eeprom_get_size() - 8;
-    uint64_t buffer_write[3];
-    uint32_t *pointer_write = (uint32_t *)buffer_write;
-    uint64_t buffer_read[3];
+    uint64_t buffer_read[_TWR_RADIO_PEER_ENTRY_SIZE / sizeof(uint64_t)];
+
+    if (_twr_radio.peer_storage_busy)
+    {
+        return;
+    }
 
     _twr_radio.save_peer_devices = false;
 
+    // Only one dirty entry is written at a time, the next one follows on completion
     for (int i = 0; i < _twr_radio.peer_devices_length; i++)
     {
-        buffer_write[0] = _twr_radio.peer_devices[i].id;
-        buffer_write[1] = _twr_radio.peer_devices[i].id;
-        buffer_write[2] = _twr_radio.peer_devices[i].id;
+        if ((_twr_radio.peer_storage_dirty[i / 8] & (1 << (i % 8))) == 0)
+        {
+            continue;
+        }
+
+        _twr_radio.peer_storage_dirty[i / 8] &= ~(1 << (i % 8));
+
+        if ((size_t) (i + 1) * _TWR_RADIO_PEER_ENTRY_SIZE > twr_eeprom_get_size() - 8)
+        {
+            continue;
+        }
+
+        uint32_t address = (uint32_t) twr_eeprom_get_size() - 8 - (i + 1) * _TWR_RADIO_PEER_ENTRY_SIZE;
+
+#if TWR_RADIO_PEER_STORAGE_REDUNDANT
+        uint32_t *pointer_write = (uint32_t *)_twr_radio.peer_storage_buffer;
+
+        _twr_radio.peer_storage_buffer[0] = _twr_radio.peer_devices[i].id;
+        _twr_radio.peer_storage_buffer[1] = _twr_radio.peer_devices[i].id;
+        _twr_radio.peer_storage_buffer[2] = _twr_radio.peer_devices[i].id;
 
         pointer_write[2] = ~pointer_write[2];
         pointer_write[5] = ~pointer_write[5];
-
-        address -= sizeof(buffer_write);
+#else
+        _twr_radio.peer_storage_buffer[0] = _twr_radio_peer_entry_encode(_twr_radio.peer_devices[i].id);
+#endif
 
         twr_eeprom_read(address, buffer_read, sizeof(buffer_read));
 
-        if (memcmp(buffer_read, buffer_write, sizeof(buffer_write)) != 0)
+        if (memcmp(buffer_read, _twr_radio.peer_storage_buffer, sizeof(buffer_read)) != 0)
         {
-            if (!twr_eeprom_write(address, buffer_write, sizeof(buffer_write)))
-            {
-                _twr_radio.save_peer_devices = true;
+            _twr_radio_peer_storage_write(address, _twr_radio.peer_storage_buffer, sizeof(_twr_radio.peer_storage_buffer), i);
 
-                twr_scheduler_plan_now(_twr_radio.task_id);
+            return;
+        }
+    }
 
-                return;
-            }
+    // Number of devices goes last so that it never covers unwritten entries
+    if (_twr_radio.peer_storage_length_dirty)
+    {
+        uint16_t length = 0;
+
+        _twr_radio.peer_storage_length_dirty = false;
+
+        _twr_radio.peer_storage_length = _twr_radio.peer_devices_length;
+
+        twr_eeprom_read(twr_eeprom_get_size() - _TWR_RADIO_PEER_LENGTH_SIZE, &length, _TWR_RADIO_PEER_LENGTH_SIZE);
+
+        if (length != _twr_radio.peer_storage_length)
+        {
+            _twr_radio_peer_storage_write(twr_eeprom_get_size() - _TWR_RADIO_PEER_LENGTH_SIZE, &_twr_radio.peer_storage_length, _TWR_RADIO_PEER_LENGTH_SIZE, -1);
         }
     }
+}
+
+static void _twr_radio_peer_storage_mark(int position)
+{
+    if (position < 0)
+    {
+        _twr_radio.peer_storage_length_dirty = true;
+    }
+    else
+    {
+        _twr_radio.peer_storage_dirty[position / 8] |= 1 << (position % 8);
+    }
+
+    _twr_radio.save_peer_devices = true;
+
+    twr_scheduler_plan_now(_twr_radio.task_id);
+}
+
+static bool _twr_radio_peer_storage_write(uint32_t address, const void *buffer, size_t length, int position)
+{
+    if (!twr_eeprom_async_write(address, buffer, length, _twr_radio_eeprom_event_handler, NULL))
+    {
+        // EEPROM is busy with another write, try again on next run of task
+        _twr_radio_peer_storage_mark(position);
+
+        return false;
+    }
+
+    _twr_radio.peer_storage_position = position;
+
+    _twr_radio.peer_storage_busy = true;
+
+    return true;
+}
+
+static void _twr_radio_eeprom_event_handler(twr_eepromc_event_t event, void *event_param)
+{
+    (void) event_param;
 
-    if (!twr_eeprom_write(twr_eeprom_get_size() - 1, &_twr_radio.peer_devices_length, 1))
+    _twr_radio.peer_storage_busy = false;
+
+    if (event == TWR_EEPROM_EVENT_ASYNC_WRITE_ERROR)
+    {
+        _twr_radio_peer_storage_mark(_twr_radio.peer_storage_position);
+    }
+    else
     {
+        // Continue with next dirty entry
         _twr_radio.save_peer_devices = true;
 
         twr_scheduler_plan_now(_twr_radio.task_id);
-
-        return;
     }
 }
 
@@ -1027,6 +2457,12 @@ static void _twr_radio_atsha204_event_handler(twr_atsha204_t *self, twr_atsha204
     {
         if (twr_atsha204_get_serial_number(self, &_twr_radio.my_id, sizeof(_twr_radio.my_id)))
         {
+#if TWR_RADIO_ID_CACHE
+            _twr_radio_id_cache_save(_twr_radio.my_id);
+#endif
+
+            twr_scheduler_plan_now(_twr_radio.task_id);
+
             if (_twr_radio.event_handler != NULL)
             {
                 _twr_radio.event_handler(TWR_RADIO_EVENT_INIT_DONE, _twr_radio.event_param);
@@ -1042,6 +2478,8 @@ static void _twr_radio_atsha204_event_handler(twr_atsha204_t *self, twr_atsha204
     }
     else if (event == TWR_ATSHA204_EVENT_ERROR)
     {
+        twr_scheduler_plan_relative(_twr_radio.task_id, _TWR_RADIO_ID_RETRY_INTERVAL);
+
         if (_twr_radio.event_handler != NULL)
         {
             _twr_radio.event_handler(TWR_RADIO_EVENT_INIT_FAILURE, _twr_radio.event_param);
@@ -1049,6 +2487,46 @@ static void _twr_radio_atsha204_event_handler(twr_atsha204_t *self, twr_atsha204
     }
 }
 
+#if TWR_RADIO_ID_CACHE
+
+static uint32_t _twr_radio_id_cache_address(void)
+{
+    return (uint32_t) twr_eeprom_get_size() - 8 - TWR_RADIO_MAX_DEVICES * _TWR_RADIO_PEER_ENTRY_SIZE - sizeof(_twr_radio_id_cache_t);
+}
+
+static bool _twr_radio_id_cache_load(uint64_t *id)
+{
+    _twr_radio_id_cache_t cache;
+
+    if (!twr_eeprom_read(_twr_radio_id_cache_address(), &cache, sizeof(cache)))
+    {
+        return false;
+    }
+
+    if (cache.magic != _TWR_RADIO_ID_CACHE_MAGIC || cache.id == 0 || cache.crc != twr_crc32(&cache.id, sizeof(cache.id)))
+    {
+        return false;
+    }
+
+    *id = cache.id;
+
+    return true;
+}
+
+static void _twr_radio_id_cache_save(uint64_t id)
+{
+    _twr_radio_id_cache_t cache;
+
+    cache.magic = _TWR_RADIO_ID_CACHE_MAGIC;
+    cache.crc = twr_crc32(&id, sizeof(id));
+    cache.id = id;
+
+    // Words which did not change are not programmed
+    twr_eeprom_write(_twr_radio_id_cache_address(), &cache, sizeof(cache));
+}
+
+#endif
+
 static bool _twr_radio_peer_device_add(uint64_t id)
 {
     if (_twr_radio.peer_devices_length + 1 == TWR_RADIO_MAX_DEVICES)
@@ -1068,10 +2546,19 @@ static bool _twr_radio_peer_device_add(uint64_t id)
 
     _twr_radio.peer_devices[_twr_radio.peer_devices_length].id = id;
     _twr_radio.peer_devices[_twr_radio.peer_devices_length].message_id_synced = false;
-    _twr_radio.peer_devices_length++;
+    _twr_radio.peer_devices[_twr_radio.peer_devices_length].ack_rate = _TWR_RADIO_ACK_RATE_INIT;
+#if _TWR_RADIO_HOLD
+    _twr_radio.peer_devices[_twr_radio.peer_devices_length].rx_slot = false;
+    _twr_radio.peer_devices[_twr_radio.peer_devices_length].ack_data = false;
+    _twr_radio.peer_devices[_twr_radio.peer_devices_length].hold_pending = 0;
+#endif
 
-    _twr_radio.save_peer_devices = true;
-    twr_scheduler_plan_now(_twr_radio.task_id);
+    _twr_radio.peer_index[_twr_radio_peer_index_slot(id)] = _twr_radio.peer_devices_length;
+
+    _twr_radio_peer_storage_mark(_twr_radio.peer_devices_length);
+    _twr_radio_peer_storage_mark(-1);
+
+    _twr_radio.peer_devices_length++;
 
     if (_twr_radio.event_handler != NULL)
     {
@@ -1084,45 +2571,112 @@ static bool _twr_radio_peer_device_add(uint64_t id)
 
 static bool _twr_radio_peer_device_remove(uint64_t id)
 {
-    for (int i = 0; i < _twr_radio.peer_devices_length; i++)
+    int slot = _twr_radio_peer_index_slot(id);
+    int i = _twr_radio.peer_index[slot];
+
+    if (i < 0)
     {
-        if (id == _twr_radio.peer_devices[i].id)
-        {
-            _twr_radio.peer_devices_length--;
-            _twr_radio.peer_devices[i].id = 0;
+        return false;
+    }
 
-            if (i != _twr_radio.peer_devices_length)
-            {
-                memcpy(_twr_radio.peer_devices + i, _twr_radio.peer_devices + _twr_radio.peer_devices_length, sizeof(twr_radio_peer_t));
-            }
+    _twr_radio_peer_index_remove(slot);
 
-            _twr_radio.save_peer_devices = true;
-            twr_scheduler_plan_now(_twr_radio.task_id);
+    _twr_radio.peer_devices_length--;
+    _twr_radio.peer_devices[i].id = 0;
 
-            if (_twr_radio.event_handler != NULL)
-            {
-                _twr_radio.peer_id = id;
-                _twr_radio.event_handler(TWR_RADIO_EVENT_DETACH, _twr_radio.event_param);
-            }
+    if (i != _twr_radio.peer_devices_length)
+    {
+        memcpy(_twr_radio.peer_devices + i, _twr_radio.peer_devices + _twr_radio.peer_devices_length, sizeof(twr_radio_peer_t));
 
-            return true;
-        }
+        _twr_radio.peer_index[_twr_radio_peer_index_slot(_twr_radio.peer_devices[i].id)] = i;
+
+        _twr_radio_peer_storage_mark(i);
+    }
+
+    _twr_radio_peer_storage_mark(-1);
+
+    if (_twr_radio.event_handler != NULL)
+    {
+        _twr_radio.peer_id = id;
+        _twr_radio.event_handler(TWR_RADIO_EVENT_DETACH, _twr_radio.event_param);
     }
 
-    return false;
+    return true;
 }
 
-twr_radio_peer_t *twr_radio_get_peer_device(uint64_t id)
+static int _twr_radio_peer_hash(uint64_t id)
 {
-    for (int i = 0; i < _twr_radio.peer_devices_length; i++)
+    // Multiplicative hash of 48-bit ID folded to 32 bits
+    uint32_t hash = ((uint32_t) id ^ (uint32_t) (id >> 24)) * 2654435761U;
+
+    return (hash >> 16) & _TWR_RADIO_PEER_HASH_MASK;
+}
+
+static int _twr_radio_peer_index_slot(uint64_t id)
+{
+    int slot = _twr_radio_peer_hash(id);
+
+    // Terminates as index always has empty slot
+    while ((_twr_radio.peer_index[slot] >= 0) && (_twr_radio.peer_devices[_twr_radio.peer_index[slot]].id != id))
+    {
+        slot = (slot + 1) & _TWR_RADIO_PEER_HASH_MASK;
+    }
+
+    return slot;
+}
+
+static void _twr_radio_peer_index_remove(int slot)
+{
+    int next = slot;
+
+    // Backward shift keeps probe sequences without tombstones
+    while (true)
     {
-        if (id == _twr_radio.peer_devices[i].id)
+        next = (next + 1) & _TWR_RADIO_PEER_HASH_MASK;
+
+        if (_twr_radio.peer_index[next] < 0)
+        {
+            break;
+        }
+
+        int home = _twr_radio_peer_hash(_twr_radio.peer_devices[_twr_radio.peer_index[next]].id);
+
+        if (((next - home) & _TWR_RADIO_PEER_HASH_MASK) >= ((next - slot) & _TWR_RADIO_PEER_HASH_MASK))
         {
-            return &_twr_radio.peer_devices[i];
+            _twr_radio.peer_index[slot] = _twr_radio.peer_index[next];
+
+            slot = next;
         }
     }
 
-    return NULL;
+    _twr_radio.peer_index[slot] = -1;
+}
+
+static void _twr_radio_peer_index_rebuild(void)
+{
+    memset(_twr_radio.peer_index, 0xff, sizeof(_twr_radio.peer_index));
+
+    for (int i = 0; i < _twr_radio.peer_devices_length; i++)
+    {
+        _twr_radio.peer_index[_twr_radio_peer_index_slot(_twr_radio.peer_devices[i].id)] = i;
+    }
+}
+
+#if !TWR_RADIO_PEER_STORAGE_REDUNDANT
+static uint64_t _twr_radio_peer_entry_encode(uint64_t id)
+{
+    // Upper bytes of 48-bit ID carry inverted XOR of its 16-bit words
+    uint16_t check = ~((uint16_t) id ^ (uint16_t) (id >> 16) ^ (uint16_t) (id >> 32));
+
+    return (id & 0xffffffffffffULL) | ((uint64_t) check << 48);
+}
+#endif
+
+twr_radio_peer_t *twr_radio_get_peer_device(uint64_t id)
+{
+    int i = _twr_radio.peer_index[_twr_radio_peer_index_slot(id)];
+
+    return i < 0 ? NULL : &_twr_radio.peer_devices[i];
 }
 
 uint8_t *twr_radio_id_to_buffer(uint64_t *id, uint8_t *buffer)
@@ -1377,3 +2931,136 @@ void twr_radio_init_pairing_button(const char *firmware, const char *version)
     twr_led_init(&led, TWR_GPIO_LED, false, 0);
 
 }
+
+static size_t _twr_radio_transport_writev(twr_transport_t *self, const twr_transport_segment_t *segments, size_t count)
+{
+    (void) self;
+
+    uint8_t buffer[TWR_RADIO_MAX_BUFFER_SIZE - 1];
+    size_t length = 0;
+    size_t written = 0;
+
+    // Segments are packed into buffers as large as radio can publish
+    for (size_t i = 0; i < count; i++)
+    {
+        const uint8_t *data = segments[i].buffer;
+
+        for (size_t j = 0; j < segments[i].length; j++)
+        {
+            buffer[length++] = data[j];
+
+            if (length == sizeof(buffer))
+            {
+                if (!twr_radio_pub_buffer(buffer, length))
+                {
+                    return written;
+                }
+
+                written += length;
+                length = 0;
+            }
+        }
+    }
+
+    if ((length != 0) && twr_radio_pub_buffer(buffer, length))
+    {
+        written += length;
+    }
+
+    return written;
+}
+
+static bool _twr_radio_transport_ready(twr_transport_t *self)
+{
+    (void) self;
+
+    return (_twr_radio.mode != TWR_RADIO_MODE_GATEWAY) && (_twr_radio.peer_devices_length > 0);
+}
+
+const twr_transport_driver_t *twr_radio_get_transport_driver(void)
+{
+    static const twr_transport_driver_t driver =
+    {
+        .writev = _twr_radio_transport_writev,
+        .ready = _twr_radio_transport_ready
+    };
+
+    return &driver;
+}
+
+#if TWR_RADIO_TOPICS
+
+static int _twr_radio_topic_find_peer(uint64_t id)
+{
+    for (int i = 0; i < _twr_radio_topics.peer_length; i++)
+    {
+        if (_twr_radio_topics.peer[i].id == id)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+const char *twr_radio_get_topic(uint64_t *id, uint8_t topic_id)
+{
+    int i = _twr_radio_topic_find_peer(*id);
+
+    if ((i >= 0) && (topic_id < TWR_RADIO_TOPICS_MAX) && ((_twr_radio_topics.peer[i].valid & (1UL << topic_id)) != 0))
+    {
+        return _twr_radio_topics.peer[i].topic[topic_id];
+    }
+
+    twr_radio_peer_t *peer = twr_radio_get_peer_device(*id);
+
+    // Node registers dictionary again on the next acknowledgment
+    if ((peer != NULL) && peer->topics)
+    {
+        peer->topics_reset = true;
+    }
+
+    return NULL;
+}
+
+static void _twr_radio_topic_store(uint64_t *id, uint8_t topic_id, const char *topic)
+{
+    int i = _twr_radio_topic_find_peer(*id);
+
+    if (i < 0)
+    {
+        if (_twr_radio_topics.peer_length < TWR_RADIO_TOPICS_PEERS)
+        {
+            i = _twr_radio_topics.peer_length++;
+        }
+        else
+        {
+            i = _twr_radio_topics.peer_next;
+
+            _twr_radio_topics.peer_next = (_twr_radio_topics.peer_next + 1) % TWR_RADIO_TOPICS_PEERS;
+        }
+
+        _twr_radio_topics.peer[i].id = *id;
+
+        _twr_radio_topics.peer[i].valid = 0;
+    }
+
+    // Without subtopic the whole dictionary is dropped
+    if (topic == NULL)
+    {
+        _twr_radio_topics.peer[i].valid = 0;
+
+        return;
+    }
+
+    if ((topic_id >= TWR_RADIO_TOPICS_MAX) || (topic[0] == 0) || (strlen(topic) >= TWR_RADIO_TOPIC_SIZE))
+    {
+        return;
+    }
+
+    strcpy(_twr_radio_topics.peer[i].topic[topic_id], topic);
+
+    _twr_radio_topics.peer[i].valid |= 1UL << topic_id;
+}
+
+#endif
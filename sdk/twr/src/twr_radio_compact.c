@@ -0,0 +1,619 @@
+#include <twr_radio_compact.h>
+#include <twr_radio_pub.h>
+
+#if TWR_RADIO_COMPACT
+
+#define _TWR_RADIO_COMPACT_RECORD_DELTA     0x00
+#define _TWR_RADIO_COMPACT_RECORD_ABSOLUTE  0x40
+#define _TWR_RADIO_COMPACT_RECORD_DEFINE    0x80
+#define _TWR_RADIO_COMPACT_RECORD_RAW       0xc0
+#define _TWR_RADIO_COMPACT_RECORD_MASK      0xc0
+#define _TWR_RADIO_COMPACT_MAX_VALUES       3
+
+typedef enum
+{
+    _TWR_RADIO_COMPACT_TYPE_BOOL = 0,
+    _TWR_RADIO_COMPACT_TYPE_UINT16 = 1,
+    _TWR_RADIO_COMPACT_TYPE_INT = 2,
+    _TWR_RADIO_COMPACT_TYPE_UINT32 = 3,
+    _TWR_RADIO_COMPACT_TYPE_FLOAT = 4
+
+} _twr_radio_compact_type_t;
+
+typedef struct
+{
+    uint8_t header;
+
+    // Bytes following header which identify topic, subtopic follows values
+    uint8_t key_length;
+    bool subtopic;
+
+    _twr_radio_compact_type_t type;
+    uint8_t value_count;
+    uint16_t scale;
+
+} _twr_radio_compact_format_t;
+
+typedef struct
+{
+    uint8_t key_length;
+    uint8_t key[TWR_RADIO_COMPACT_KEY_SIZE];
+    int32_t value[_TWR_RADIO_COMPACT_MAX_VALUES];
+
+} _twr_radio_compact_slot_t;
+
+static const _twr_radio_compact_format_t _twr_radio_compact_formats[] =
+{
+    { TWR_RADIO_HEADER_PUB_EVENT_COUNT,  1, false, _TWR_RADIO_COMPACT_TYPE_UINT16, 1, 1 },
+    { TWR_RADIO_HEADER_PUB_TEMPERATURE,  1, false, _TWR_RADIO_COMPACT_TYPE_FLOAT, 1, 100 },
+    { TWR_RADIO_HEADER_PUB_HUMIDITY,     1, false, _TWR_RADIO_COMPACT_TYPE_FLOAT, 1, 100 },
+    { TWR_RADIO_HEADER_PUB_LUX_METER,    1, false, _TWR_RADIO_COMPACT_TYPE_FLOAT, 1, 100 },
+    { TWR_RADIO_HEADER_PUB_BAROMETER,    1, false, _TWR_RADIO_COMPACT_TYPE_FLOAT, 2, 10 },
+    { TWR_RADIO_HEADER_PUB_CO2,          0, false, _TWR_RADIO_COMPACT_TYPE_FLOAT, 1, 10 },
+    { TWR_RADIO_HEADER_PUB_BATTERY,      0, false, _TWR_RADIO_COMPACT_TYPE_FLOAT, 1, 1000 },
+    { TWR_RADIO_HEADER_PUB_ACCELERATION, 0, false, _TWR_RADIO_COMPACT_TYPE_FLOAT, 3, 1000 },
+    { TWR_RADIO_HEADER_PUB_STATE,        1, false, _TWR_RADIO_COMPACT_TYPE_BOOL, 1, 1 },
+    { TWR_RADIO_HEADER_PUB_VALUE_INT,    1, false, _TWR_RADIO_COMPACT_TYPE_INT, 1, 1 },
+    { TWR_RADIO_HEADER_PUB_TOPIC_BOOL,   0, true, _TWR_RADIO_COMPACT_TYPE_BOOL, 1, 1 },
+    { TWR_RADIO_HEADER_PUB_TOPIC_INT,    0, true, _TWR_RADIO_COMPACT_TYPE_INT, 1, 1 },
+    { TWR_RADIO_HEADER_PUB_TOPIC_UINT32, 0, true, _TWR_RADIO_COMPACT_TYPE_UINT32, 1, 1 },
+    { TWR_RADIO_HEADER_PUB_TOPIC_FLOAT,  0, true, _TWR_RADIO_COMPACT_TYPE_FLOAT, 1, 1000 }
+};
+
+static struct
+{
+    _twr_radio_compact_slot_t slot[TWR_RADIO_COMPACT_SLOTS];
+    int slot_next;
+
+    struct
+    {
+        uint64_t id;
+        _twr_radio_compact_slot_t slot[TWR_RADIO_COMPACT_SLOTS];
+
+    } peer[TWR_RADIO_COMPACT_PEERS];
+
+    int peer_length;
+    int peer_next;
+
+} _twr_radio_compact;
+
+static const _twr_radio_compact_format_t *_twr_radio_compact_find_format(uint8_t header);
+static size_t _twr_radio_compact_value_size(_twr_radio_compact_type_t type);
+static bool _twr_radio_compact_key_check(const _twr_radio_compact_format_t *format, size_t key_length);
+static bool _twr_radio_compact_value_read(const _twr_radio_compact_format_t *format, const uint8_t *buffer, int32_t *value);
+static uint8_t *_twr_radio_compact_value_write(const _twr_radio_compact_format_t *format, int32_t value, uint8_t *buffer);
+static size_t _twr_radio_compact_varint_length(uint32_t value);
+static uint8_t *_twr_radio_compact_varint_write(uint32_t value, uint8_t *buffer);
+static size_t _twr_radio_compact_varint_read(const uint8_t *buffer, size_t length, uint32_t *value);
+static uint32_t _twr_radio_compact_zigzag(int32_t value);
+static int32_t _twr_radio_compact_unzigzag(uint32_t value);
+static _twr_radio_compact_slot_t *_twr_radio_compact_get_peer_slots(uint64_t id);
+
+size_t twr_radio_compact_encode(const uint8_t *message, size_t length, uint8_t *buffer, size_t size, bool commit)
+{
+    const _twr_radio_compact_format_t *format = _twr_radio_compact_find_format(message[0]);
+
+    uint8_t key[TWR_RADIO_COMPACT_KEY_SIZE];
+    size_t key_length = 0;
+    int32_t value[_TWR_RADIO_COMPACT_MAX_VALUES];
+
+    if (format != NULL)
+    {
+        size_t values_length = _twr_radio_compact_value_size(format->type) * format->value_count;
+
+        key_length = length - values_length;
+
+        if ((length <= values_length) || (key_length > sizeof(key)) || !_twr_radio_compact_key_check(format, key_length))
+        {
+            format = NULL;
+        }
+    }
+
+    if (format != NULL)
+    {
+        const uint8_t *pointer = message + 1 + format->key_length;
+
+        for (int i = 0; i < format->value_count; i++)
+        {
+            if (!_twr_radio_compact_value_read(format, pointer, &value[i]))
+            {
+                format = NULL;
+
+                break;
+            }
+
+            pointer += _twr_radio_compact_value_size(format->type);
+        }
+
+        if (format != NULL)
+        {
+            memcpy(key, message, 1 + format->key_length);
+            memcpy(key + 1 + format->key_length, pointer, length - (pointer - message));
+        }
+    }
+
+    if (format == NULL)
+    {
+        if (2 + length > size)
+        {
+            return 0;
+        }
+
+        buffer[0] = _TWR_RADIO_COMPACT_RECORD_RAW;
+        buffer[1] = length;
+
+        memcpy(buffer + 2, message, length);
+
+        return 2 + length;
+    }
+
+    int index = -1;
+
+    for (int i = 0; i < TWR_RADIO_COMPACT_SLOTS; i++)
+    {
+        _twr_radio_compact_slot_t *slot = &_twr_radio_compact.slot[i];
+
+        if ((slot->key_length == key_length) && (memcmp(slot->key, key, key_length) == 0))
+        {
+            index = i;
+
+            break;
+        }
+    }
+
+    uint8_t record = _TWR_RADIO_COMPACT_RECORD_DEFINE;
+    uint32_t varint[_TWR_RADIO_COMPACT_MAX_VALUES];
+    size_t record_length = 0;
+
+    if (index >= 0)
+    {
+        size_t absolute_length = 0;
+        size_t delta_length = 0;
+
+        for (int i = 0; i < format->value_count; i++)
+        {
+            int32_t delta = (int32_t) ((uint32_t) value[i] - (uint32_t) _twr_radio_compact.slot[index].value[i]);
+
+            absolute_length += _twr_radio_compact_varint_length(_twr_radio_compact_zigzag(value[i]));
+            delta_length += _twr_radio_compact_varint_length(_twr_radio_compact_zigzag(delta));
+        }
+
+        record = delta_length < absolute_length ? _TWR_RADIO_COMPACT_RECORD_DELTA : _TWR_RADIO_COMPACT_RECORD_ABSOLUTE;
+
+        record_length = 1;
+    }
+    else
+    {
+        index = _twr_radio_compact.slot_next;
+
+        for (int i = 0; i < TWR_RADIO_COMPACT_SLOTS; i++)
+        {
+            if (_twr_radio_compact.slot[i].key_length == 0)
+            {
+                index = i;
+
+                break;
+            }
+        }
+
+        record_length = 2 + key_length;
+    }
+
+    for (int i = 0; i < format->value_count; i++)
+    {
+        if (record == _TWR_RADIO_COMPACT_RECORD_DELTA)
+        {
+            varint[i] = _twr_radio_compact_zigzag((int32_t) ((uint32_t) value[i] - (uint32_t) _twr_radio_compact.slot[index].value[i]));
+        }
+        else
+        {
+            varint[i] = _twr_radio_compact_zigzag(value[i]);
+        }
+
+        record_length += _twr_radio_compact_varint_length(varint[i]);
+    }
+
+    if (record_length > size)
+    {
+        return 0;
+    }
+
+    if (!commit)
+    {
+        return record_length;
+    }
+
+    uint8_t *pointer = buffer;
+
+    *pointer++ = record | index;
+
+    if (record == _TWR_RADIO_COMPACT_RECORD_DEFINE)
+    {
+        *pointer++ = key_length;
+
+        memcpy(pointer, key, key_length);
+
+        pointer += key_length;
+
+        _twr_radio_compact.slot[index].key_length = key_length;
+
+        memcpy(_twr_radio_compact.slot[index].key, key, key_length);
+
+        if (index == _twr_radio_compact.slot_next)
+        {
+            _twr_radio_compact.slot_next = (_twr_radio_compact.slot_next + 1) % TWR_RADIO_COMPACT_SLOTS;
+        }
+    }
+
+    for (int i = 0; i < format->value_count; i++)
+    {
+        pointer = _twr_radio_compact_varint_write(varint[i], pointer);
+
+        _twr_radio_compact.slot[index].value[i] = value[i];
+    }
+
+    return record_length;
+}
+
+void twr_radio_compact_reset(void)
+{
+    memset(_twr_radio_compact.slot, 0, sizeof(_twr_radio_compact.slot));
+
+    _twr_radio_compact.slot_next = 0;
+}
+
+bool twr_radio_compact_decode(uint64_t *id, uint8_t *buffer, size_t length)
+{
+    _twr_radio_compact_slot_t *slots = _twr_radio_compact_get_peer_slots(*id);
+    uint8_t message[TWR_RADIO_MAX_BUFFER_SIZE];
+    size_t offset = 0;
+
+    while (offset < length)
+    {
+        uint8_t record = buffer[offset] & _TWR_RADIO_COMPACT_RECORD_MASK;
+        uint8_t index = buffer[offset] & ~_TWR_RADIO_COMPACT_RECORD_MASK;
+
+        offset++;
+
+        if (record == _TWR_RADIO_COMPACT_RECORD_RAW)
+        {
+            if ((offset >= length) || (buffer[offset] == 0) || (offset + 1 + buffer[offset] > length))
+            {
+                return false;
+            }
+
+            memcpy(message, buffer + offset + 1, buffer[offset]);
+
+            twr_radio_pub_decode(id, message, buffer[offset]);
+
+            offset += 1 + buffer[offset];
+
+            continue;
+        }
+
+        if (index >= TWR_RADIO_COMPACT_SLOTS)
+        {
+            return false;
+        }
+
+        _twr_radio_compact_slot_t *slot = &slots[index];
+
+        if (record == _TWR_RADIO_COMPACT_RECORD_DEFINE)
+        {
+            size_t key_length = offset < length ? buffer[offset] : 0;
+
+            if ((key_length == 0) || (key_length > TWR_RADIO_COMPACT_KEY_SIZE) || (offset + 1 + key_length > length))
+            {
+                return false;
+            }
+
+            const _twr_radio_compact_format_t *format = _twr_radio_compact_find_format(buffer[offset + 1]);
+
+            if ((format == NULL) || !_twr_radio_compact_key_check(format, key_length))
+            {
+                slot->key_length = 0;
+
+                return false;
+            }
+
+            slot->key_length = key_length;
+
+            memcpy(slot->key, buffer + offset + 1, key_length);
+
+            offset += 1 + key_length;
+        }
+        else if (slot->key_length == 0)
+        {
+            return false;
+        }
+
+        const _twr_radio_compact_format_t *format = _twr_radio_compact_find_format(slot->key[0]);
+
+        uint8_t *pointer = message;
+
+        memcpy(pointer, slot->key, 1 + format->key_length);
+
+        pointer += 1 + format->key_length;
+
+        for (int i = 0; i < format->value_count; i++)
+        {
+            uint32_t varint;
+
+            size_t varint_length = _twr_radio_compact_varint_read(buffer + offset, length - offset, &varint);
+
+            if (varint_length == 0)
+            {
+                return false;
+            }
+
+            offset += varint_length;
+
+            if (record == _TWR_RADIO_COMPACT_RECORD_DELTA)
+            {
+                slot->value[i] = (int32_t) ((uint32_t) slot->value[i] + (uint32_t) _twr_radio_compact_unzigzag(varint));
+            }
+            else
+            {
+                slot->value[i] = _twr_radio_compact_unzigzag(varint);
+            }
+
+            pointer = _twr_radio_compact_value_write(format, slot->value[i], pointer);
+        }
+
+        memcpy(pointer, slot->key + 1 + format->key_length, slot->key_length - 1 - format->key_length);
+
+        pointer += slot->key_length - 1 - format->key_length;
+
+        twr_radio_pub_decode(id, message, pointer - message);
+    }
+
+    return true;
+}
+
+void twr_radio_compact_peer_reset(uint64_t *id)
+{
+    _twr_radio_compact_slot_t *slots = _twr_radio_compact_get_peer_slots(*id);
+
+    memset(slots, 0, sizeof(_twr_radio_compact.peer[0].slot));
+}
+
+static const _twr_radio_compact_format_t *_twr_radio_compact_find_format(uint8_t header)
+{
+    for (size_t i = 0; i < sizeof(_twr_radio_compact_formats) / sizeof(_twr_radio_compact_formats[0]); i++)
+    {
+        if (_twr_radio_compact_formats[i].header == header)
+        {
+            return &_twr_radio_compact_formats[i];
+        }
+    }
+
+    return NULL;
+}
+
+static size_t _twr_radio_compact_value_size(_twr_radio_compact_type_t type)
+{
+    switch (type)
+    {
+        case _TWR_RADIO_COMPACT_TYPE_BOOL:
+        {
+            return sizeof(uint8_t);
+        }
+        case _TWR_RADIO_COMPACT_TYPE_UINT16:
+        {
+            return sizeof(uint16_t);
+        }
+        case _TWR_RADIO_COMPACT_TYPE_INT:
+        case _TWR_RADIO_COMPACT_TYPE_UINT32:
+        case _TWR_RADIO_COMPACT_TYPE_FLOAT:
+        default:
+        {
+            return sizeof(uint32_t);
+        }
+    }
+}
+
+static bool _twr_radio_compact_key_check(const _twr_radio_compact_format_t *format, size_t key_length)
+{
+    // Subtopic is sent with terminating zero
+    if (format->subtopic)
+    {
+        return key_length > 1U + format->key_length;
+    }
+
+    return key_length == 1U + format->key_length;
+}
+
+static bool _twr_radio_compact_value_read(const _twr_radio_compact_format_t *format, const uint8_t *buffer, int32_t *value)
+{
+    switch (format->type)
+    {
+        case _TWR_RADIO_COMPACT_TYPE_BOOL:
+        {
+            if (buffer[0] > 1)
+            {
+                return false;
+            }
+
+            *value = buffer[0];
+
+            return true;
+        }
+        case _TWR_RADIO_COMPACT_TYPE_UINT16:
+        {
+            uint16_t u;
+
+            memcpy(&u, buffer, sizeof(u));
+
+            *value = u;
+
+            return true;
+        }
+        case _TWR_RADIO_COMPACT_TYPE_INT:
+        {
+            int i;
+
+            memcpy(&i, buffer, sizeof(i));
+
+            *value = i;
+
+            return i != TWR_RADIO_NULL_INT;
+        }
+        case _TWR_RADIO_COMPACT_TYPE_UINT32:
+        {
+            uint32_t u;
+
+            memcpy(&u, buffer, sizeof(u));
+
+            *value = (int32_t) u;
+
+            return u <= INT32_MAX;
+        }
+        case _TWR_RADIO_COMPACT_TYPE_FLOAT:
+        {
+            float f;
+
+            memcpy(&f, buffer, sizeof(f));
+
+            f *= format->scale;
+
+            // Also false for NaN (null value)
+            if (!((f > -2.0e9f) && (f < 2.0e9f)))
+            {
+                return false;
+            }
+
+            *value = (int32_t) (f < 0.f ? f - 0.5f : f + 0.5f);
+
+            return true;
+        }
+        default:
+        {
+            return false;
+        }
+    }
+}
+
+static uint8_t *_twr_radio_compact_value_write(const _twr_radio_compact_format_t *format, int32_t value, uint8_t *buffer)
+{
+    switch (format->type)
+    {
+        case _TWR_RADIO_COMPACT_TYPE_BOOL:
+        {
+            *buffer = value != 0;
+
+            return buffer + 1;
+        }
+        case _TWR_RADIO_COMPACT_TYPE_UINT16:
+        {
+            uint16_t u = value;
+
+            return twr_radio_uint16_to_buffer(&u, buffer);
+        }
+        case _TWR_RADIO_COMPACT_TYPE_INT:
+        {
+            int i = value;
+
+            return twr_radio_int_to_buffer(&i, buffer);
+        }
+        case _TWR_RADIO_COMPACT_TYPE_UINT32:
+        {
+            uint32_t u = value;
+
+            return twr_radio_uint32_to_buffer(&u, buffer);
+        }
+        case _TWR_RADIO_COMPACT_TYPE_FLOAT:
+        default:
+        {
+            float f = (float) value / format->scale;
+
+            return twr_radio_float_to_buffer(&f, buffer);
+        }
+    }
+}
+
+static size_t _twr_radio_compact_varint_length(uint32_t value)
+{
+    size_t length = 1;
+
+    while (value >= 0x80)
+    {
+        value >>= 7;
+
+        length++;
+    }
+
+    return length;
+}
+
+static uint8_t *_twr_radio_compact_varint_write(uint32_t value, uint8_t *buffer)
+{
+    while (value >= 0x80)
+    {
+        *buffer++ = (value & 0x7f) | 0x80;
+
+        value >>= 7;
+    }
+
+    *buffer++ = value;
+
+    return buffer;
+}
+
+static size_t _twr_radio_compact_varint_read(const uint8_t *buffer, size_t length, uint32_t *value)
+{
+    *value = 0;
+
+    for (size_t i = 0; (i < length) && (i < 5); i++)
+    {
+        *value |= (uint32_t) (buffer[i] & 0x7f) << (7 * i);
+
+        if ((buffer[i] & 0x80) == 0)
+        {
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
+
+static uint32_t _twr_radio_compact_zigzag(int32_t value)
+{
+    return ((uint32_t) value << 1) ^ (uint32_t) (value >> 31);
+}
+
+static int32_t _twr_radio_compact_unzigzag(uint32_t value)
+{
+    return (int32_t) ((value >> 1) ^ (0 - (value & 1)));
+}
+
+static _twr_radio_compact_slot_t *_twr_radio_compact_get_peer_slots(uint64_t id)
+{
+    for (int i = 0; i < _twr_radio_compact.peer_length; i++)
+    {
+        if (_twr_radio_compact.peer[i].id == id)
+        {
+            return _twr_radio_compact.peer[i].slot;
+        }
+    }
+
+    int i;
+
+    if (_twr_radio_compact.peer_length < TWR_RADIO_COMPACT_PEERS)
+    {
+        i = _twr_radio_compact.peer_length++;
+    }
+    else
+    {
+        i = _twr_radio_compact.peer_next;
+
+        _twr_radio_compact.peer_next = (_twr_radio_compact.peer_next + 1) % TWR_RADIO_COMPACT_PEERS;
+    }
+
+    _twr_radio_compact.peer[i].id = id;
+
+    memset(_twr_radio_compact.peer[i].slot, 0, sizeof(_twr_radio_compact.peer[i].slot));
+
+    return _twr_radio_compact.peer[i].slot;
+}
+
+#endif
@@ -126,9 +126,14 @@ bool twr_radio_pub_acceleration(float *x_axis, float *y_axis, float *z_axis)
 
 bool twr_radio_pub_buffer(void *buffer, size_t length)
 {
-    uint8_t qbuffer[TWR_RADIO_MAX_BUFFER_SIZE];
+    if (length > TWR_RADIO_MAX_BUFFER_SIZE - 1)
+    {
+        return false;
+    }
 
-    if (length > sizeof(qbuffer) - 1)
+    uint8_t *qbuffer = twr_radio_pub_queue_reserve(length + 1);
+
+    if (qbuffer == NULL)
     {
         return false;
     }
@@ -137,7 +142,9 @@ bool twr_radio_pub_buffer(void *buffer, size_t length)
 
     memcpy(&qbuffer[1], buffer, length);
 
-    return twr_radio_pub_queue_put(qbuffer, length + 1);
+    twr_radio_pub_queue_commit(length + 1);
+
+    return true;
 }
 
 bool twr_radio_pub_state(uint8_t state_id, bool *state)
@@ -166,6 +173,23 @@ bool twr_radio_pub_value_int(uint8_t value_id, int *value)
 
 bool twr_radio_pub_bool(const char *subtopic, bool *value)
 {
+#if TWR_RADIO_TOPICS
+    int topic_id = twr_radio_get_topic_id(subtopic);
+
+    if (topic_id >= 0)
+    {
+        uint8_t buffer[3 + 1];
+
+        buffer[0] = TWR_RADIO_HEADER_PUB_TOPIC_ID;
+        buffer[1] = TWR_RADIO_HEADER_PUB_TOPIC_BOOL;
+        buffer[2] = topic_id;
+
+        twr_radio_bool_to_buffer(value, buffer + 3);
+
+        return twr_radio_pub_queue_put(buffer, sizeof(buffer));
+    }
+#endif
+
     size_t len = strlen(subtopic);
 
     if (len > TWR_RADIO_MAX_TOPIC_LEN)
@@ -186,6 +210,23 @@ bool twr_radio_pub_bool(const char *subtopic, bool *value)
 
 bool twr_radio_pub_int(const char *subtopic, int *value)
 {
+#if TWR_RADIO_TOPICS
+    int topic_id = twr_radio_get_topic_id(subtopic);
+
+    if (topic_id >= 0)
+    {
+        uint8_t buffer[3 + 4];
+
+        buffer[0] = TWR_RADIO_HEADER_PUB_TOPIC_ID;
+        buffer[1] = TWR_RADIO_HEADER_PUB_TOPIC_INT;
+        buffer[2] = topic_id;
+
+        twr_radio_int_to_buffer(value, buffer + 3);
+
+        return twr_radio_pub_queue_put(buffer, sizeof(buffer));
+    }
+#endif
+
     size_t len = strlen(subtopic);
 
     if (len > TWR_RADIO_MAX_TOPIC_LEN)
@@ -206,6 +247,23 @@ bool twr_radio_pub_int(const char *subtopic, int *value)
 
 bool twr_radio_pub_uint32(const char *subtopic, uint32_t *value)
 {
+#if TWR_RADIO_TOPICS
+    int topic_id = twr_radio_get_topic_id(subtopic);
+
+    if (topic_id >= 0)
+    {
+        uint8_t buffer[3 + 4];
+
+        buffer[0] = TWR_RADIO_HEADER_PUB_TOPIC_ID;
+        buffer[1] = TWR_RADIO_HEADER_PUB_TOPIC_UINT32;
+        buffer[2] = topic_id;
+
+        twr_radio_uint32_to_buffer(value, buffer + 3);
+
+        return twr_radio_pub_queue_put(buffer, sizeof(buffer));
+    }
+#endif
+
     size_t len = strlen(subtopic);
 
     if (len > TWR_RADIO_MAX_TOPIC_LEN)
@@ -226,6 +284,23 @@ bool twr_radio_pub_uint32(const char *subtopic, uint32_t *value)
 
 bool twr_radio_pub_float(const char *subtopic, float *value)
 {
+#if TWR_RADIO_TOPICS
+    int topic_id = twr_radio_get_topic_id(subtopic);
+
+    if (topic_id >= 0)
+    {
+        uint8_t buffer[3 + 4];
+
+        buffer[0] = TWR_RADIO_HEADER_PUB_TOPIC_ID;
+        buffer[1] = TWR_RADIO_HEADER_PUB_TOPIC_FLOAT;
+        buffer[2] = topic_id;
+
+        twr_radio_float_to_buffer(value, buffer + 3);
+
+        return twr_radio_pub_queue_put(buffer, sizeof(buffer));
+    }
+#endif
+
     size_t len = strlen(subtopic);
 
     if (len > TWR_RADIO_MAX_TOPIC_LEN)
@@ -246,9 +321,32 @@ bool twr_radio_pub_float(const char *subtopic, float *value)
 
 bool twr_radio_pub_string(const char *subtopic, const char *value)
 {
-    size_t len = strlen(subtopic);
     size_t len_value = strlen(value);
 
+#if TWR_RADIO_TOPICS
+    int topic_id = twr_radio_get_topic_id(subtopic);
+
+    if (topic_id >= 0)
+    {
+        if (len_value > (TWR_RADIO_MAX_BUFFER_SIZE - 4))
+        {
+            return false;
+        }
+
+        uint8_t buffer[TWR_RADIO_MAX_BUFFER_SIZE];
+
+        buffer[0] = TWR_RADIO_HEADER_PUB_TOPIC_ID;
+        buffer[1] = TWR_RADIO_HEADER_PUB_TOPIC_STRING;
+        buffer[2] = topic_id;
+
+        strcpy((char *)buffer + 3, value);
+
+        return twr_radio_pub_queue_put(buffer, len_value + 4);
+    }
+#endif
+
+    size_t len = strlen(subtopic);
+
     if (len + len_value > (TWR_RADIO_MAX_BUFFER_SIZE - 3))
     {
         return false;
@@ -484,6 +582,60 @@ void twr_radio_pub_decode(uint64_t *id, uint8_t *buffer, size_t length)
 
         twr_radio_pub_on_string(id, (char *) buffer + 1, (char *) buffer + 2 + len);
     }
+#if TWR_RADIO_TOPICS
+    else if ((buffer[0] == TWR_RADIO_HEADER_PUB_TOPIC_ID) && (length > 3))
+    {
+        char *subtopic = (char *) twr_radio_get_topic(id, buffer[2]);
+
+        if (subtopic == NULL)
+        {
+            return;
+        }
+
+        if ((buffer[1] == TWR_RADIO_HEADER_PUB_TOPIC_BOOL) && (length == 3 + 1))
+        {
+            bool value;
+            bool *pvalue;
+
+            twr_radio_bool_from_buffer(buffer + 3, &value, &pvalue);
+
+            twr_radio_pub_on_bool(id, subtopic, pvalue);
+        }
+        else if ((buffer[1] == TWR_RADIO_HEADER_PUB_TOPIC_INT) && (length == 3 + 4))
+        {
+            int value;
+            int *pvalue;
+
+            twr_radio_int_from_buffer(buffer + 3, &value, &pvalue);
+
+            twr_radio_pub_on_int(id, subtopic, pvalue);
+        }
+        else if ((buffer[1] == TWR_RADIO_HEADER_PUB_TOPIC_UINT32) && (length == 3 + 4))
+        {
+            uint32_t value;
+            uint32_t *pvalue;
+
+            twr_radio_uint32_from_buffer(buffer + 3, &value, &pvalue);
+
+            twr_radio_pub_on_uint32(id, subtopic, pvalue);
+        }
+        else if ((buffer[1] == TWR_RADIO_HEADER_PUB_TOPIC_FLOAT) && (length == 3 + 4))
+        {
+            float value;
+            float *pvalue;
+
+            twr_radio_float_from_buffer(buffer + 3, &value, &pvalue);
+
+            twr_radio_pub_on_float(id, subtopic, pvalue);
+        }
+        else if (buffer[1] == TWR_RADIO_HEADER_PUB_TOPIC_STRING)
+        {
+            buffer[length - 1] = 0;
+
+            twr_radio_pub_on_string(id, subtopic, (char *) buffer + 3);
+        }
+    }
+#endif
     else if (buffer[0] == TWR_RADIO_HEADER_PUB_VALUE_INT)
     {
         int value;
@@ -1,7 +1,5 @@
 #include <twr_ramp.h>
 
-static float _twr_ramp_interpolate(twr_tick_t x, twr_tick_t x_min, twr_tick_t x_max, float y_min, float y_max);
-
 void twr_ramp_init(twr_ramp_t *self, float start, float stop, twr_tick_t duration)
 {
     memset(self, 0, sizeof(*self));
@@ -10,20 +8,41 @@ void twr_ramp_init(twr_ramp_t *self, float start, float stop, twr_tick_t duratio
     self->_stop = stop;
     self->_now = start;
 
+    self->_start_int = (int32_t) (start < 0.f ? start - 0.5f : start + 0.5f);
+    self->_stop_int = (int32_t) (stop < 0.f ? stop - 0.5f : stop + 0.5f);
+
     self->_duration = duration;
 }
 
+void twr_ramp_init_int(twr_ramp_t *self, int32_t start, int32_t stop, twr_tick_t duration)
+{
+    twr_ramp_init(self, (float) start, (float) stop, duration);
+
+    self->_start_int = start;
+    self->_stop_int = stop;
+}
+
 void twr_ramp_start(twr_ramp_t *self)
 {
     self->_tick_start = twr_tick_get();
     self->_tick_end = self->_tick_start + self->_duration;
 
+    // Division is done once per ramp, not per value
+    if (self->_duration != 0)
+    {
+        self->_slope = (self->_stop - self->_start) / (float) self->_duration;
+
+        self->_slope_q16 = (int32_t) (((int64_t) (self->_stop_int - self->_start_int) << 16) / (int64_t) self->_duration);
+    }
+
     self->_active = true;
 }
 
 float twr_ramp_get(twr_ramp_t *self)
 {
-    if (twr_tick_get() >= self->_tick_end)
+    twr_tick_t tick_now = twr_tick_get();
+
+    if (tick_now >= self->_tick_end)
     {
         self->_active = false;
     }
@@ -33,13 +52,46 @@ float twr_ramp_get(twr_ramp_t *self)
         return self->_stop;
     }
 
-    return _twr_ramp_interpolate(twr_tick_get(), self->_tick_start, self->_tick_end, self->_start, self->_stop);
+    return self->_start + self->_slope * (float) (tick_now - self->_tick_start);
 }
 
-static float _twr_ramp_interpolate(twr_tick_t x, twr_tick_t x_min, twr_tick_t x_max, float y_min, float y_max)
+int32_t twr_ramp_get_int(twr_ramp_t *self)
 {
-    if (x < x_min) { x = x_min; }
-    if (x > x_max) { x = x_max; }
+    twr_tick_t tick_now = twr_tick_get();
+
+    if (tick_now >= self->_tick_end)
+    {
+        self->_active = false;
+    }
 
-    return (float) (x - x_min) * (y_max - y_min) / (float) (x_max - x_min) + y_min;
+    if (!self->_active)
+    {
+        return self->_stop_int;
+    }
+
+    int64_t value = (int64_t) self->_slope_q16 * (int32_t) (tick_now - self->_tick_start) + 0x8000;
+
+    return self->_start_int + (int32_t) (value >> 16);
+}
+
+void twr_ramp_compile(twr_ramp_t *self, uint16_t *buffer, size_t count, size_t stride)
+{
+    // Values are accumulated in Q16 by constant step
+    int64_t value = (int64_t) (self->_start * 65536.f) + 0x8000;
+    int64_t step = count > 1 ? (int64_t) ((self->_stop - self->_start) * 65536.f) / (int64_t) (count - 1) : 0;
+
+    if (count == 1)
+    {
+        value = (int64_t) (self->_stop * 65536.f) + 0x8000;
+    }
+
+    for (size_t i = 0; i < count; i++, value += step)
+    {
+        int32_t sample = (int32_t) (value >> 16);
+
+        if (sample < 0) { sample = 0; }
+        if (sample > 65535) { sample = 65535; }
+
+        buffer[i * stride] = (uint16_t) sample;
+    }
 }
@@ -1,7 +1,10 @@
 #include <twr_rf_ook.h>
 #include <twr_timer.h>
+#include <twr_dma.h>
 
 void _twr_rf_ook_irq_TIM3_handler(void *param);
+static void _twr_rf_ook_pattern_dma_irq_handler(twr_dma_channel_t channel, twr_dma_event_t event, void *param);
+static void _twr_rf_ook_pattern_irq_TIM3_handler(void *param);
 
 static struct
 {
@@ -11,8 +14,14 @@ static struct
     volatile bool is_busy;
     uint32_t bit_length_us;
     twr_gpio_channel_t gpio;
+    uint16_t pattern_length;
+    volatile uint16_t pattern_repeat;
+    twr_dma_channel_t dma_channel;
 } _twr_rf_ook;
 
+// Kept apart, so it is dropped by linker when pattern is not used
+static uint32_t _twr_rf_ook_pattern[TWR_RF_OOK_PATTERN_LENGTH];
+
 static int _twr_rf_ook_char_to_int(char input)
 {
     if(input >= '0' && input <= '9')
@@ -33,7 +42,7 @@ static int _twr_rf_ook_char_to_int(char input)
     }
 }
 
-static uint8_t _twr_rf_ook_string_to_array(char *str, uint8_t *array)
+static uint8_t _twr_rf_ook_string_to_array(const char *str, uint8_t *array)
 {
     uint8_t array_length = (strlen(str) + 1) / 2;
 
@@ -135,6 +144,98 @@ bool twr_rf_ook_send_hex_string(char *hex_string)
     return twr_rf_ook_send(_twr_rf_ook.packet_data, packet_length);
 }
 
+bool twr_rf_ook_pattern_set(const uint8_t *packet, uint8_t length)
+{
+    if (_twr_rf_ook.is_busy || length * 8 > TWR_RF_OOK_PATTERN_LENGTH)
+    {
+        return false;
+    }
+
+    // Every bit is BSRR word which sets or resets the pin
+    for (uint16_t i = 0; i < length * 8; i++)
+    {
+        bool state = (packet[i / 8] & (1 << (7 - i % 8))) != 0;
+
+        _twr_rf_ook_pattern[i] = state ? twr_gpio_16_bit_mask[_twr_rf_ook.gpio] : twr_gpio_32_bit_upper_mask[_twr_rf_ook.gpio];
+    }
+
+    _twr_rf_ook.pattern_length = length * 8;
+
+    return true;
+}
+
+bool twr_rf_ook_pattern_set_hex_string(const char *hex_string)
+{
+    uint8_t packet[TWR_RF_OOK_PATTERN_LENGTH / 8];
+
+    if (_twr_rf_ook.is_busy || strlen(hex_string) > TWR_RF_OOK_PATTERN_LENGTH / 4)
+    {
+        return false;
+    }
+
+    uint8_t packet_length = _twr_rf_ook_string_to_array(hex_string, packet);
+
+    return twr_rf_ook_pattern_set(packet, packet_length);
+}
+
+bool twr_rf_ook_pattern_play(uint16_t repeat)
+{
+    if ((TIM3->CR1 & TIM_CR1_CEN) != 0 || _twr_rf_ook.is_busy)
+    {
+        // TIM3 is busy
+        return false;
+    }
+
+    if (_twr_rf_ook.pattern_length == 0 || repeat == 0)
+    {
+        return false;
+    }
+
+    twr_dma_channel_config_t config =
+    {
+        .direction = TWR_DMA_DIRECTION_TO_PERIPHERAL,
+        .data_size_memory = TWR_DMA_SIZE_4,
+        .data_size_peripheral = TWR_DMA_SIZE_4,
+        .length = _twr_rf_ook.pattern_length,
+        .mode = TWR_DMA_MODE_CIRCULAR,
+        .address_memory = _twr_rf_ook_pattern,
+        .address_peripheral = (void *) &twr_gpio_port[_twr_rf_ook.gpio]->BSRR,
+        .priority = TWR_DMA_PRIORITY_HIGH
+    };
+
+    if (!twr_dma_channel_allocate(TWR_DMA_LINE_TIM3_UP, &_twr_rf_ook.dma_channel, &config.request))
+    {
+        return false;
+    }
+
+    twr_system_pll_enable();
+
+    _twr_rf_ook_tim3_configure(1, _twr_rf_ook.bit_length_us);
+
+    // Load prescaler before DMA requests are enabled, bits are written on update events only
+    TIM3->EGR = TIM_EGR_UG;
+    TIM3->SR = 0;
+    TIM3->DIER = TIM_DIER_UDE;
+
+    _twr_rf_ook.pattern_repeat = repeat;
+
+    twr_dma_init();
+
+    twr_dma_channel_config(_twr_rf_ook.dma_channel, &config);
+
+    twr_dma_set_irq_handler(_twr_rf_ook.dma_channel, _twr_rf_ook_pattern_dma_irq_handler, NULL);
+
+    twr_dma_channel_run(_twr_rf_ook.dma_channel);
+
+    twr_timer_set_irq_handler(TIM3, _twr_rf_ook_pattern_irq_TIM3_handler, NULL);
+
+    _twr_rf_ook.is_busy = true;
+
+    TIM3->CR1 |= TIM_CR1_CEN;
+
+    return true;
+}
+
 bool twr_rf_ook_is_busy()
 {
     return _twr_rf_ook.is_busy;
@@ -178,3 +279,37 @@ void _twr_rf_ook_irq_TIM3_handler(void *param)
     _twr_rf_ook.packet_bit_position++;
 }
 
+
+static void _twr_rf_ook_pattern_dma_irq_handler(twr_dma_channel_t channel, twr_dma_event_t event, void *param)
+{
+    (void) channel;
+    (void) param;
+
+    if (event != TWR_DMA_EVENT_DONE || --_twr_rf_ook.pattern_repeat != 0)
+    {
+        return;
+    }
+
+    // Last bit of the last frame has just been written, the next update ends it
+    TIM3->DIER = 0;
+    TIM3->SR = ~TIM_SR_UIF;
+    TIM3->DIER = TIM_DIER_UIE;
+}
+
+static void _twr_rf_ook_pattern_irq_TIM3_handler(void *param)
+{
+    (void) param;
+
+    TIM3->SR = ~TIM_SR_UIF;
+
+    twr_gpio_set_output(_twr_rf_ook.gpio, 0);
+
+    TIM3->CR1 &= ~TIM_CR1_CEN;
+    TIM3->DIER = 0;
+
+    twr_dma_channel_release(_twr_rf_ook.dma_channel);
+
+    _twr_rf_ook.is_busy = false;
+
+    twr_system_pll_disable();
+}
@@ -137,6 +137,15 @@ static const uint16_t days_since_new_year[2][12] = {
     {0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335}  // Leap year
 };
 
+static struct
+{
+    bool synced;
+    time_t seconds;
+    uint32_t milliseconds;
+    twr_tick_t tick;
+
+} _twr_rtc_cache;
+
 void twr_rtc_init(void)
 {
 }
@@ -240,7 +249,7 @@ void twr_rtc_get_timestamp(struct timespec *tv)
 
     // Note: The code generated by the following expression will only be fast if
     // TWR_RTC_PREDIV_S is a power of two.
-    tv->tv_nsec = 1000000 * (TWR_RTC_PREDIV_S - 1 - ssr.SS) / TWR_RTC_PREDIV_S;
+    tv->tv_nsec = (TWR_RTC_PREDIV_S - 1 - ssr.SS) * (1000000000 / TWR_RTC_PREDIV_S);
 
     if (tr.i != mem.tr.i) {
         mem.s1 = (10 * tr.HT + tr.HU) * _TWR_RTC_SECONDS_PER_HOUR
@@ -267,6 +276,39 @@ void twr_rtc_get_timestamp(struct timespec *tv)
     tv->tv_sec = mem.s1 + mem.s2;
 }
 
+void twr_rtc_sync(void)
+{
+    struct timespec tv;
+
+    twr_rtc_wait();
+
+    // Tick is taken right after RTC, so both refer to the same instant within a tick
+    twr_rtc_get_timestamp(&tv);
+
+    _twr_rtc_cache.tick = twr_tick_get();
+    _twr_rtc_cache.seconds = tv.tv_sec;
+    _twr_rtc_cache.milliseconds = tv.tv_nsec / 1000000;
+    _twr_rtc_cache.synced = true;
+}
+
+void twr_rtc_get_timestamp_cached(struct timespec *tv)
+{
+    twr_tick_t elapsed = twr_tick_get() - _twr_rtc_cache.tick;
+
+    if (!_twr_rtc_cache.synced || elapsed >= TWR_RTC_SYNC_INTERVAL_MS)
+    {
+        twr_rtc_sync();
+
+        elapsed = 0;
+    }
+
+    // Interval between synchronizations fits into 32 bits, so no 64-bit division is needed
+    uint32_t milliseconds = _twr_rtc_cache.milliseconds + (uint32_t) elapsed;
+
+    tv->tv_sec = _twr_rtc_cache.seconds + milliseconds / 1000;
+    tv->tv_nsec = (milliseconds % 1000) * 1000000;
+}
+
 int twr_rtc_set_datetime(struct tm *tm, int ms)
 {
     int year = tm->tm_year + 1900 - _TWR_RTC_CALENDAR_CENTURY;
@@ -322,6 +364,9 @@ int twr_rtc_set_datetime(struct tm *tm, int ms)
     RTC->DR = dr.i;
     twr_rtc_set_init(false);
     twr_rtc_disable_write();
+
+    // Shadow register flag is cleared in initialization mode, so sync waits for new time
+    twr_rtc_sync();
     return 0;
 }
 
@@ -9,6 +9,12 @@ static void _twr_sam_m8q_clear(twr_sam_m8q_t *self);
 static bool _twr_sam_m8q_enable(twr_sam_m8q_t *self);
 static bool _twr_sam_m8q_disable(twr_sam_m8q_t *self);
 static bool _twr_sam_m8q_send_config(twr_sam_m8q_t *self);
+static bool _twr_sam_m8q_set_message_rate(twr_sam_m8q_t *self, uint8_t message_class, uint8_t message_id, uint8_t rate);
+static bool _twr_sam_m8q_is_wanted(const char *header);
+static bool _twr_sam_m8q_feed_ubx(twr_sam_m8q_t *self, uint8_t c);
+static void _twr_sam_m8q_parse_pvt(twr_sam_m8q_t *self, const uint8_t *payload);
+static bool _twr_sam_m8q_send_ubx(twr_sam_m8q_t *self, uint8_t message_class, uint8_t message_id, const uint8_t *payload, size_t length);
+static uint32_t _twr_sam_m8q_get_u32(const uint8_t *buffer);
 
 void twr_sam_m8q_init(twr_sam_m8q_t *self, twr_i2c_channel_t channel, uint8_t i2c_address, const twr_sam_m8q_driver_t *driver)
 {
@@ -29,6 +35,17 @@ void twr_sam_m8q_set_event_handler(twr_sam_m8q_t *self, twr_sam_m8q_event_handle
     self->_event_param = event_param;
 }
 
+void twr_sam_m8q_set_protocol(twr_sam_m8q_t *self, twr_sam_m8q_protocol_t protocol)
+{
+    if (self->_protocol != protocol)
+    {
+        self->_protocol = protocol;
+        self->_configured = false;
+
+        twr_sam_m8q_invalidate(self);
+    }
+}
+
 void twr_sam_m8q_start(twr_sam_m8q_t *self)
 {
     if (!self->_running)
@@ -55,12 +72,31 @@ void twr_sam_m8q_invalidate(twr_sam_m8q_t *self)
     self->_rmc.valid = false;
     self->_gga.valid = false;
     self->_pubx.valid = false;
+    self->_pvt.valid = false;
 }
 
 bool twr_sam_m8q_get_time(twr_sam_m8q_t *self, twr_sam_m8q_time_t *time)
 {
     memset(time, 0, sizeof(*time));
 
+    if (self->_protocol == TWR_SAM_M8Q_PROTOCOL_UBX)
+    {
+        // Both date and time have to be valid
+        if (!self->_pvt.valid || (self->_pvt.validity & 0x03) != 0x03)
+        {
+            return false;
+        }
+
+        time->year = self->_pvt.year;
+        time->month = self->_pvt.month;
+        time->day = self->_pvt.day;
+        time->hours = self->_pvt.hours;
+        time->minutes = self->_pvt.minutes;
+        time->seconds = self->_pvt.seconds;
+
+        return true;
+    }
+
     if (!self->_rmc.valid)
     {
         return false;
@@ -80,6 +116,19 @@ bool twr_sam_m8q_get_position(twr_sam_m8q_t *self, twr_sam_m8q_position_t *posit
 {
     memset(position, 0, sizeof(*position));
 
+    if (self->_protocol == TWR_SAM_M8Q_PROTOCOL_UBX)
+    {
+        if (!self->_pvt.valid || (self->_pvt.flags & 0x01) == 0)
+        {
+            return false;
+        }
+
+        position->latitude = self->_pvt.latitude / 10000000.f;
+        position->longitude = self->_pvt.longitude / 10000000.f;
+
+        return true;
+    }
+
     if (!self->_rmc.valid)
     {
         return false;
@@ -95,6 +144,19 @@ bool twr_sam_m8q_get_altitude(twr_sam_m8q_t *self, twr_sam_m8q_altitude_t *altit
 {
     memset(altitude, 0, sizeof(*altitude));
 
+    if (self->_protocol == TWR_SAM_M8Q_PROTOCOL_UBX)
+    {
+        if (!self->_pvt.valid || (self->_pvt.flags & 0x01) == 0)
+        {
+            return false;
+        }
+
+        altitude->altitude = self->_pvt.altitude / 1000.f;
+        altitude->units = 'M';
+
+        return true;
+    }
+
     if (!self->_gga.valid || self->_gga.fix_quality < 1)
     {
         return false;
@@ -110,6 +172,28 @@ bool twr_sam_m8q_get_quality(twr_sam_m8q_t *self, twr_sam_m8q_quality_t *quality
 {
     memset(quality, 0, sizeof(*quality));
 
+    if (self->_protocol == TWR_SAM_M8Q_PROTOCOL_UBX)
+    {
+        if (!self->_pvt.valid)
+        {
+            return false;
+        }
+
+        // Fix quality as in GGA, 2 for differential solution
+        if ((self->_pvt.flags & 0x01) == 0)
+        {
+            quality->fix_quality = 0;
+        }
+        else
+        {
+            quality->fix_quality = (self->_pvt.flags & 0x02) != 0 ? 2 : 1;
+        }
+
+        quality->satellites_tracked = self->_pvt.satellites;
+
+        return true;
+    }
+
     if (!self->_gga.valid || !self->_pubx.valid)
     {
         return false;
@@ -125,6 +209,19 @@ bool twr_sam_m8q_get_accuracy(twr_sam_m8q_t *self, twr_sam_m8q_accuracy_t *accur
 {
     memset(accuracy, 0, sizeof(*accuracy));
 
+    if (self->_protocol == TWR_SAM_M8Q_PROTOCOL_UBX)
+    {
+        if (!self->_pvt.valid || (self->_pvt.flags & 0x01) == 0)
+        {
+            return false;
+        }
+
+        accuracy->horizontal = self->_pvt.h_accuracy / 1000.f;
+        accuracy->vertical = self->_pvt.v_accuracy / 1000.f;
+
+        return true;
+    }
+
     if (!self->_pubx.valid || self->_gga.fix_quality < 1)
     {
         return false;
@@ -176,6 +273,8 @@ start:
 
             _twr_sam_m8q_clear(self);
 
+            self->_ubx.position = 0;
+
             if (self->_event_handler != NULL)
             {
                 self->_event_handler(self, TWR_SAM_M8Q_EVENT_START, self->_event_param);
@@ -207,8 +306,6 @@ start:
                     self->_ddc_length = sizeof(self->_ddc_buffer);
                 }
 
-                memset(self->_ddc_buffer, 0, sizeof(self->_ddc_buffer));
-
                 twr_i2c_memory_transfer_t transfer;
 
                 transfer.device_address = self->_i2c_address;
@@ -349,12 +446,20 @@ static bool _twr_sam_m8q_feed(twr_sam_m8q_t *self, char c)
 {
     bool ret = false;
 
+    // UBX sync character never occurs in NMEA output
+    if (self->_ubx.position != 0 || (uint8_t) c == 0xb5)
+    {
+        return _twr_sam_m8q_feed_ubx(self, (uint8_t) c);
+    }
+
     if (c == '\r' || c == '\n')
     {
         if (self->_line_length != 0)
         {
-            if (!self->_line_clipped)
+            if (!self->_line_clipped && !self->_line_skipped)
             {
+                self->_line_buffer[self->_line_length] = '\0';
+
                 if (_twr_sam_m8q_parse(self, self->_line_buffer))
                 {
                     ret = true;
@@ -372,6 +477,11 @@ static bool _twr_sam_m8q_feed(twr_sam_m8q_t *self, char c)
             }
         }
     }
+    else if (self->_line_skipped)
+    {
+        // Rest of unwanted sentence is only counted, so its end is still recognized
+        self->_line_length++;
+    }
     else
     {
         if (self->_line_length < sizeof(self->_line_buffer) - 1)
@@ -382,16 +492,147 @@ static bool _twr_sam_m8q_feed(twr_sam_m8q_t *self, char c)
         {
             self->_line_clipped = true;
         }
+
+        // Sentence is recognized by its header, the ones parser does not use are not stored
+        if ((self->_line_length == 1 && c != '$') ||
+            (self->_line_length == 6 && !_twr_sam_m8q_is_wanted(self->_line_buffer)))
+        {
+            self->_line_skipped = true;
+        }
     }
 
     return ret;
 }
 
-static void _twr_sam_m8q_clear(twr_sam_m8q_t *self)
+static bool _twr_sam_m8q_is_wanted(const char *header)
+{
+    // Talker of standard sentences differs with GNSS configuration ($GP, $GN, ...)
+    return memcmp(&header[3], "RMC", 3) == 0 || memcmp(&header[3], "GGA", 3) == 0 || memcmp(&header[1], "PUBX,", 5) == 0;
+}
+
+static bool _twr_sam_m8q_feed_ubx(twr_sam_m8q_t *self, uint8_t c)
+{
+    size_t position = self->_ubx.position++;
+
+    if (position == 0)
+    {
+        // Message interrupts sentence, its payload is kept in line buffer
+        _twr_sam_m8q_clear(self);
+
+        return false;
+    }
+
+    if (position == 1)
+    {
+        if (c != 0x62)
+        {
+            self->_ubx.position = 0;
+        }
+
+        self->_ubx.ck_a = 0;
+        self->_ubx.ck_b = 0;
+
+        return false;
+    }
+
+    if (position < 6 + self->_ubx.length || position < 6)
+    {
+        self->_ubx.ck_a += c;
+        self->_ubx.ck_b += self->_ubx.ck_a;
+
+        if (position == 2)
+        {
+            self->_ubx.message_class = c;
+        }
+        else if (position == 3)
+        {
+            self->_ubx.message_id = c;
+        }
+        else if (position == 4)
+        {
+            self->_ubx.length = c;
+        }
+        else if (position == 5)
+        {
+            self->_ubx.length |= (size_t) c << 8;
+        }
+        else if (position - 6 < sizeof(self->_line_buffer))
+        {
+            self->_line_buffer[position - 6] = c;
+        }
+
+        return false;
+    }
+
+    if (position == 6 + self->_ubx.length)
+    {
+        if (c != self->_ubx.ck_a)
+        {
+            self->_ubx.position = 0;
+        }
+
+        return false;
+    }
+
+    bool ret = false;
+
+    self->_ubx.position = 0;
+
+    if (c != self->_ubx.ck_b)
+    {
+        return false;
+    }
+
+    // NAV-PVT
+    if (self->_ubx.message_class == 0x01 && self->_ubx.message_id == 0x07 && self->_ubx.length == 92)
+    {
+        _twr_sam_m8q_parse_pvt(self, (const uint8_t *) self->_line_buffer);
+
+        ret = true;
+    }
+
+    // Module which keeps UBX only output from previous run sends no sentence
+    if (!self->_configured)
+    {
+        if (_twr_sam_m8q_send_config(self))
+        {
+            self->_configured = true;
+        }
+    }
+
+    return ret;
+}
+
+static void _twr_sam_m8q_parse_pvt(twr_sam_m8q_t *self, const uint8_t *payload)
+{
+    self->_pvt.year = payload[4] | (uint16_t) payload[5] << 8;
+    self->_pvt.month = payload[6];
+    self->_pvt.day = payload[7];
+    self->_pvt.hours = payload[8];
+    self->_pvt.minutes = payload[9];
+    self->_pvt.seconds = payload[10];
+    self->_pvt.validity = payload[11];
+    self->_pvt.fix_type = payload[20];
+    self->_pvt.flags = payload[21];
+    self->_pvt.satellites = payload[23];
+    self->_pvt.longitude = (int32_t) _twr_sam_m8q_get_u32(&payload[24]);
+    self->_pvt.latitude = (int32_t) _twr_sam_m8q_get_u32(&payload[28]);
+    self->_pvt.altitude = (int32_t) _twr_sam_m8q_get_u32(&payload[36]);
+    self->_pvt.h_accuracy = _twr_sam_m8q_get_u32(&payload[40]);
+    self->_pvt.v_accuracy = _twr_sam_m8q_get_u32(&payload[44]);
+    self->_pvt.valid = true;
+}
+
+static uint32_t _twr_sam_m8q_get_u32(const uint8_t *buffer)
 {
-    memset(self->_line_buffer, 0, sizeof(self->_line_buffer));
+    // Payload is not aligned, Cortex-M0+ does not allow unaligned access
+    return buffer[0] | (uint32_t) buffer[1] << 8 | (uint32_t) buffer[2] << 16 | (uint32_t) buffer[3] << 24;
+}
 
+static void _twr_sam_m8q_clear(twr_sam_m8q_t *self)
+{
     self->_line_clipped = false;
+    self->_line_skipped = false;
     self->_line_length = 0;
 }
 
@@ -423,52 +664,48 @@ static bool _twr_sam_m8q_disable(twr_sam_m8q_t *self)
 
 static bool _twr_sam_m8q_send_config(twr_sam_m8q_t *self)
 {
-    // Enable PUBX POSITION message
-    uint8_t config_msg_pubx[] = {
-        0xb5, 0x62, 0x06, 0x01, 0x08, 0x00, 0xf1, 0x00,
-        0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x04, 0x3b
-    };
-    twr_i2c_transfer_t transfer;
+    bool ubx = self->_protocol == TWR_SAM_M8Q_PROTOCOL_UBX;
 
-    transfer.device_address = self->_i2c_address;
-    transfer.buffer = config_msg_pubx;
-    transfer.length = sizeof(config_msg_pubx);
+    // Set protocols of DDC port (address 0x42), output is UBX only in UBX mode
+    const uint8_t config_port[] = {
+        0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x03, 0x00, ubx ? 0x01 : 0x03, 0x00,
+        0x00, 0x00, 0x00, 0x00
+    };
 
-    if (!twr_i2c_write(self->_i2c_channel, &transfer))
+    if (!_twr_sam_m8q_send_ubx(self, 0x06, 0x00, config_port, sizeof(config_port)))
     {
         return false;
     }
 
-    // Disable GSA message
-    uint8_t config_msg_gsa[] = {
-        0xb5, 0x62, 0x06, 0x01, 0x08, 0x00, 0xf0, 0x02,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x31,
-    };
-
-    transfer.device_address = self->_i2c_address;
-    transfer.buffer = config_msg_gsa;
-    transfer.length = sizeof(config_msg_gsa);
-
-    if (!twr_i2c_write(self->_i2c_channel, &transfer))
+    // Enable NAV-PVT message in UBX mode
+    if (!_twr_sam_m8q_set_message_rate(self, 0x01, 0x07, ubx ? 1 : 0))
     {
         return false;
     }
 
-    // Disable GSV message
-    uint8_t config_msg_gsv[] = {
-        0xb5, 0x62, 0x06, 0x01, 0x08, 0x00, 0xf0, 0x03,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x38,
-    };
+    if (!ubx)
+    {
+        // Enable PUBX POSITION message
+        if (!_twr_sam_m8q_set_message_rate(self, 0xf1, 0x00, 1))
+        {
+            return false;
+        }
 
-    transfer.device_address = self->_i2c_address;
-    transfer.buffer = config_msg_gsv;
-    transfer.length = sizeof(config_msg_gsv);
+        // Disable standard messages parser does not use (GLL, GSA, GSV, VTG and TXT)
+        static const uint8_t nmea_disabled[] = { 0x01, 0x02, 0x03, 0x05, 0x41 };
 
-    if (!twr_i2c_write(self->_i2c_channel, &transfer))
-    {
-        return false;
+        for (size_t i = 0; i < sizeof(nmea_disabled); i++)
+        {
+            if (!_twr_sam_m8q_set_message_rate(self, 0xf0, nmea_disabled[i], 0))
+            {
+                return false;
+            }
+        }
     }
 
+    twr_i2c_transfer_t transfer;
+
     // Enable Galileo
     uint8_t config_gnss[] = {
         0xb5, 0x62, 0x06, 0x3e, 0x3c, 0x00, 0x00, 0x20,
@@ -510,3 +747,52 @@ static bool _twr_sam_m8q_send_config(twr_sam_m8q_t *self)
 
     return true;
 }
+
+static bool _twr_sam_m8q_set_message_rate(twr_sam_m8q_t *self, uint8_t message_class, uint8_t message_id, uint8_t rate)
+{
+    // UBX CFG-MSG with rate on DDC, UART1, USB and SPI ports
+    const uint8_t config_msg[] = {
+        message_class, message_id, rate, rate, 0x00, rate, rate, 0x00
+    };
+
+    return _twr_sam_m8q_send_ubx(self, 0x06, 0x01, config_msg, sizeof(config_msg));
+}
+
+static bool _twr_sam_m8q_send_ubx(twr_sam_m8q_t *self, uint8_t message_class, uint8_t message_id, const uint8_t *payload, size_t length)
+{
+    uint8_t buffer[8 + 20];
+
+    if (length > sizeof(buffer) - 8)
+    {
+        return false;
+    }
+
+    buffer[0] = 0xb5;
+    buffer[1] = 0x62;
+    buffer[2] = message_class;
+    buffer[3] = message_id;
+    buffer[4] = length;
+    buffer[5] = length >> 8;
+
+    memcpy(&buffer[6], payload, length);
+
+    uint8_t ck_a = 0;
+    uint8_t ck_b = 0;
+
+    for (size_t i = 2; i < 6 + length; i++)
+    {
+        ck_a += buffer[i];
+        ck_b += ck_a;
+    }
+
+    buffer[6 + length] = ck_a;
+    buffer[7 + length] = ck_b;
+
+    twr_i2c_transfer_t transfer;
+
+    transfer.device_address = self->_i2c_address;
+    transfer.buffer = buffer;
+    transfer.length = 8 + length;
+
+    return twr_i2c_write(self->_i2c_channel, &transfer);
+}
@@ -0,0 +1,86 @@
+#include <twr_sampler.h>
+#include <math.h>
+
+static void _twr_sampler_apply(twr_sampler_t *self, twr_tick_t interval);
+
+void twr_sampler_init(twr_sampler_t *self, twr_sampler_set_interval_t set_interval, void *sensor, twr_tick_t interval_min, twr_tick_t interval_max, float threshold)
+{
+    memset(self, 0, sizeof(*self));
+
+    self->_set_interval = set_interval;
+    self->_sensor = sensor;
+    self->_interval_min = interval_min;
+    self->_interval_max = interval_max;
+    self->_threshold = threshold;
+
+    _twr_sampler_apply(self, interval_min);
+}
+
+void twr_sampler_set_bounds(twr_sampler_t *self, twr_tick_t interval_min, twr_tick_t interval_max)
+{
+    self->_interval_min = interval_min;
+    self->_interval_max = interval_max;
+
+    _twr_sampler_apply(self, self->_interval);
+}
+
+void twr_sampler_set_threshold(twr_sampler_t *self, float threshold)
+{
+    self->_threshold = threshold;
+}
+
+void twr_sampler_feed(twr_sampler_t *self, float value)
+{
+    if (isnan(value))
+    {
+        return;
+    }
+
+    if (!self->_valid)
+    {
+        self->_value = value;
+        self->_valid = true;
+
+        return;
+    }
+
+    float change = fabsf(value - self->_value);
+
+    self->_value = value;
+
+    if (change >= self->_threshold)
+    {
+        _twr_sampler_apply(self, self->_interval_min);
+    }
+    else if (change < self->_threshold / 4.f)
+    {
+        _twr_sampler_apply(self, self->_interval * 2);
+    }
+}
+
+twr_tick_t twr_sampler_get_interval(twr_sampler_t *self)
+{
+    return self->_interval;
+}
+
+static void _twr_sampler_apply(twr_sampler_t *self, twr_tick_t interval)
+{
+    if (interval < self->_interval_min)
+    {
+        interval = self->_interval_min;
+    }
+
+    if (interval > self->_interval_max)
+    {
+        interval = self->_interval_max;
+    }
+
+    if (interval == self->_interval)
+    {
+        return;
+    }
+
+    self->_interval = interval;
+
+    self->_set_interval(self->_sensor, interval);
+}
@@ -6,6 +6,14 @@
 #define _TWR_SC16IS740_REG_THR                 0x00
 #define _TWR_SC16IS740_REG_IER                 0x01 << 3
 #define _TWR_SC16IS740_REG_FCR                 0x02 << 3
+#define _TWR_SC16IS740_REG_IIR                 0x02 << 3
+#define _TWR_SC16IS740_IIR_MASK                0x3f
+#define _TWR_SC16IS740_IIR_RX_TIMEOUT          0x0c
+#define _TWR_SC16IS740_IIR_RHR                 0x04
+#define _TWR_SC16IS740_IIR_THR                 0x02
+#define _TWR_SC16IS740_IIR_NONE                0x01
+#define _TWR_SC16IS740_IER_RHR                 0x01
+#define _TWR_SC16IS740_IER_THR                 0x02
 #define _TWR_SC16IS740_REG_LCR                 0x03 << 3
 #define _TWR_SC16IS740_REG_MCR                 0x04 << 3
 #define _TWR_SC16IS740_BIT_FIFO_ENABLE         0x01
@@ -20,6 +28,12 @@
 #define _TWR_SC16IS740_LCR_SPECIAL_ENHANCED_REGISTER  0xBF
 #define _TWR_SC16IS740_ENHANCED_REG_EFR        0x02 << 3
 
+// Interrupt sources served per IRQ edge, IRQ stays asserted while any source is pending
+#define _TWR_SC16IS740_IRQ_LOOP_LIMIT 3
+
+static void _twr_sc16is740_irq(twr_exti_line_t line, void *param);
+static bool _twr_sc16is740_update_ier(twr_sc16is740_t *self, uint8_t mask, uint8_t value);
+
 bool twr_sc16is740_init(twr_sc16is740_t *self, twr_i2c_channel_t i2c_channel, uint8_t i2c_address)
 {
     memset(self, 0, sizeof(*self));
@@ -82,6 +96,11 @@ bool twr_sc16is740_reset_fifo(twr_sc16is740_t *self, twr_sc16is740_fifo_t fifo)
 
     register_fcr = fifo | _TWR_SC16IS740_BIT_FIFO_ENABLE;
 
+    if ((fifo & TWR_SC16IS740_FIFO_TX) != 0)
+    {
+        self->_tx_space = 0;
+    }
+
     return twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, _TWR_SC16IS740_REG_FCR, register_fcr);
 }
 
@@ -96,26 +115,37 @@ bool twr_sc16is740_get_spaces_available(twr_sc16is740_t *self, size_t *spaces_av
 
     *spaces_available = value;
 
+    self->_tx_space = value;
+
     return true;
 }
 
 size_t twr_sc16is740_write(twr_sc16is740_t *self, uint8_t *buffer, size_t length)
 {
-    size_t spaces_available;
-
     if (length > _TWR_SC16IS740_FIFO_SIZE)
     {
         return 0;
     }
 
-    if (!twr_sc16is740_get_spaces_available(self, &spaces_available))
+    // Space known from the last check only grows as FIFO drains, so it is checked again only when short
+    if (self->_tx_space < length)
     {
-        return 0;
-    }
+        size_t spaces_available;
 
-    if (spaces_available < length)
-    {
-        return 0;
+        if (!twr_sc16is740_get_spaces_available(self, &spaces_available))
+        {
+            return 0;
+        }
+
+        if (spaces_available < length)
+        {
+            if (self->_irq)
+            {
+                _twr_sc16is740_update_ier(self, _TWR_SC16IS740_IER_THR, _TWR_SC16IS740_IER_THR);
+            }
+
+            return 0;
+        }
     }
 
     twr_i2c_memory_transfer_t transfer;
@@ -127,9 +157,13 @@ size_t twr_sc16is740_write(twr_sc16is740_t *self, uint8_t *buffer, size_t length
 
     if (!twr_i2c_memory_write(self->_i2c_channel, &transfer))
     {
+        self->_tx_space = 0;
+
         return 0;
     }
 
+    self->_tx_space -= length;
+
     return length;
 }
 
@@ -157,6 +191,12 @@ size_t twr_sc16is740_read(twr_sc16is740_t *self, uint8_t *buffer, size_t length,
     {
         size_t available;
 
+        // Nothing has come since FIFO was emptied
+        if (self->_irq && !self->_rx_pending)
+        {
+            continue;
+        }
+
         if (!twr_sc16is740_available(self, &available))
         {
             return 0;
@@ -188,17 +228,67 @@ size_t twr_sc16is740_read(twr_sc16is740_t *self, uint8_t *buffer, size_t length,
 
             read_length += transfer.length;
 
+            if (transfer.length == available)
+            {
+                self->_rx_pending = false;
+            }
+
             if (read_length == length)
             {
                 return read_length;
             }
         }
+        else
+        {
+            self->_rx_pending = false;
+        }
 
     } while (twr_tick_get() > stop);
 
     return read_length;
 }
 
+bool twr_sc16is740_set_rx_trigger(twr_sc16is740_t *self, twr_sc16is740_rx_trigger_t rx_trigger)
+{
+    // FIFO control register is write only, FIFO reset bits are left zero
+    return twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, _TWR_SC16IS740_REG_FCR, rx_trigger | _TWR_SC16IS740_BIT_FIFO_ENABLE);
+}
+
+bool twr_sc16is740_set_irq(twr_sc16is740_t *self, twr_exti_line_t line, void (*event_handler)(twr_sc16is740_t *, twr_sc16is740_event_t, void *), void *event_param)
+{
+    self->_event_handler = event_handler;
+    self->_event_param = event_param;
+
+    // Data may be waiting already
+    self->_rx_pending = true;
+
+    if (!_twr_sc16is740_update_ier(self, _TWR_SC16IS740_IER_RHR | _TWR_SC16IS740_IER_THR, _TWR_SC16IS740_IER_RHR))
+    {
+        return false;
+    }
+
+    // IRQ output is active low, I2C is accessed by callback run from task
+    twr_exti_register_deferred(line, TWR_EXTI_EDGE_FALLING, _twr_sc16is740_irq, self);
+
+    self->_irq = true;
+
+    return true;
+}
+
+bool twr_sc16is740_get_rx_timeout(twr_sc16is740_t *self, bool *rx_timeout)
+{
+    uint8_t value;
+
+    if (!twr_i2c_memory_read_8b(self->_i2c_channel, self->_i2c_address, _TWR_SC16IS740_REG_IIR, &value))
+    {
+        return false;
+    }
+
+    *rx_timeout = (value & _TWR_SC16IS740_IIR_MASK) == _TWR_SC16IS740_IIR_RX_TIMEOUT;
+
+    return true;
+}
+
 bool twr_sc16is740_set_baudrate(twr_sc16is740_t *self, twr_sc16is740_baudrate_t baudrate)
 {
     uint8_t lcr_read;
@@ -233,3 +323,66 @@ bool twr_sc16is740_set_baudrate(twr_sc16is740_t *self, twr_sc16is740_baudrate_t
 
     return true;
 }
+
+static void _twr_sc16is740_irq(twr_exti_line_t line, void *param)
+{
+    (void) line;
+
+    twr_sc16is740_t *self = param;
+
+    uint8_t previous = _TWR_SC16IS740_IIR_NONE;
+
+    for (int i = 0; i < _TWR_SC16IS740_IRQ_LOOP_LIMIT; i++)
+    {
+        uint8_t iir;
+
+        if (!twr_i2c_memory_read_8b(self->_i2c_channel, self->_i2c_address, _TWR_SC16IS740_REG_IIR, &iir))
+        {
+            return;
+        }
+
+        iir &= _TWR_SC16IS740_IIR_MASK;
+
+        // Source left pending by handler would come again without end
+        if ((iir & _TWR_SC16IS740_IIR_NONE) != 0 || iir == previous)
+        {
+            return;
+        }
+
+        previous = iir;
+
+        if (iir == _TWR_SC16IS740_IIR_RHR || iir == _TWR_SC16IS740_IIR_RX_TIMEOUT)
+        {
+            self->_rx_pending = true;
+
+            if (self->_event_handler != NULL)
+            {
+                self->_event_handler(self, TWR_SC16IS740_EVENT_RX, self->_event_param);
+            }
+        }
+        else if (iir == _TWR_SC16IS740_IIR_THR)
+        {
+            // Reading IIR cleared the source, it is enabled again by write which does not fit
+            _twr_sc16is740_update_ier(self, _TWR_SC16IS740_IER_THR, 0);
+
+            self->_tx_space = 0;
+
+            if (self->_event_handler != NULL)
+            {
+                self->_event_handler(self, TWR_SC16IS740_EVENT_TX, self->_event_param);
+            }
+        }
+    }
+}
+
+static bool _twr_sc16is740_update_ier(twr_sc16is740_t *self, uint8_t mask, uint8_t value)
+{
+    uint8_t ier;
+
+    if (!twr_i2c_memory_read_8b(self->_i2c_channel, self->_i2c_address, _TWR_SC16IS740_REG_IER, &ier))
+    {
+        return false;
+    }
+
+    return twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, _TWR_SC16IS740_REG_IER, (ier & ~mask) | value);
+}
@@ -1,6 +1,46 @@
+#define TWR_LOG_MODULE TWR_LOG_MODULE_SYSTEM
+
 #include <twr_scheduler.h>
 #include <twr_system.h>
 #include <twr_error.h>
+#include <twr_irq.h>
+#include <twr_sleep.h>
+#include <twr_stack.h>
+#include <twr_trace.h>
+
+#if TWR_SCHEDULER_PROFILE
+#include <twr_timer.h>
+#include <twr_log.h>
+#include <twr_atci.h>
+#endif
+
+#if TWR_SCHEDULER_WATCHDOG
+#include <twr_watchdog.h>
+#include <twr_hrtick.h>
+#include <twr_log.h>
+#endif
+
+#if TWR_SCHEDULER_HEAP
+
+#define _TWR_SCHEDULER_HEAP_NONE TWR_SCHEDULER_MAX_TASKS
+
+#endif
+
+#if TWR_SCHEDULER_WATCHDOG
+
+#define _TWR_SCHEDULER_WATCHDOG_MAGIC 0x57444f47
+
+#endif
+
+#define _TWR_SCHEDULER_STR(x) _TWR_SCHEDULER_STR_(x)
+#define _TWR_SCHEDULER_STR_(x) #x
+
+// Table of static tasks collected by linker
+extern const twr_scheduler_task_static_t __twr_scheduler_task_start[];
+extern const twr_scheduler_task_static_t __twr_scheduler_task_end[];
+
+// Absolute symbol for linker check of static tasks against size of pool
+__asm__ (".global _twr_scheduler_max_tasks\n.equ _twr_scheduler_max_tasks, " _TWR_SCHEDULER_STR(TWR_SCHEDULER_MAX_TASKS));
 
 static struct
 {
@@ -10,56 +50,532 @@ static struct
         void (*task)(void *);
         void *param;
 
+#if TWR_SCHEDULER_HEAP
+        size_t heap_index;
+        uint32_t spin;
+        bool deferred;
+#endif
+
+#if TWR_SCHEDULER_WATCHDOG
+        uint32_t budget;
+#endif
+
     } pool[TWR_SCHEDULER_MAX_TASKS];
 
     twr_tick_t tick_spin;
     twr_scheduler_task_id_t current_task_id;
     twr_scheduler_task_id_t max_task_id;
 
+#if TWR_SCHEDULER_HEAP
+    // Binary min-heap of planned task IDs ordered by tick_execution (tasks planned to infinity are not in heap)
+    twr_scheduler_task_id_t heap[TWR_SCHEDULER_MAX_TASKS];
+    size_t heap_length;
+    uint32_t spin;
+#endif
+
+    // Tasks signalled from interrupts since the last spin
+    volatile uint32_t signal[(TWR_SCHEDULER_MAX_TASKS + 31) / 32];
+
+    // Tasks of high priority and those of them which have run in this spin
+    uint32_t high[(TWR_SCHEDULER_MAX_TASKS + 31) / 32];
+    uint32_t high_ran[(TWR_SCHEDULER_MAX_TASKS + 31) / 32];
+
+#if TWR_SCHEDULER_PROFILE
+    twr_scheduler_profile_t profile[TWR_SCHEDULER_MAX_TASKS];
+#endif
+
+#if TWR_SCHEDULER_TICKLESS
+    // Tick at which tickless idle wakes up (zero when not in tickless idle)
+    twr_tick_t tick_tickless;
+#endif
+
+#if TWR_SCHEDULER_WATCHDOG
+    // Task which has been running at reset, taken over from _twr_scheduler_running
+    bool stalled;
+    bool stalled_watchdog;
+    twr_scheduler_task_id_t stalled_task_id;
+    void (*stalled_task)(void *);
+#endif
+
 } _twr_scheduler;
 
+#if TWR_SCHEDULER_WATCHDOG
+
+// Task in progress, kept over reset to find out which task has been stalled
+static struct
+{
+    uint32_t magic;
+    twr_scheduler_task_id_t task_id;
+    void (*task)(void *);
+
+} _twr_scheduler_running __attribute__((section(".noinit")));
+
+#endif
+
 void application_idle();
 void application_error(twr_error_t code);
 
+static void _twr_scheduler_set_tick(twr_scheduler_task_id_t task_id, twr_tick_t tick);
+
+static void _twr_scheduler_idle(void);
+
+static void _twr_scheduler_execute(twr_scheduler_task_id_t task_id);
+
+static void _twr_scheduler_signal_collect(void);
+
+static void _twr_scheduler_run_high(void);
+
+static inline void _twr_scheduler_tickless_check(twr_tick_t tick);
+
+static inline void _twr_scheduler_standby_check(void);
+
+static inline void _twr_scheduler_watchdog_init(void);
+
+static inline void _twr_scheduler_watchdog_report(void);
+
+static inline void _twr_scheduler_watchdog_refresh(void);
+
+static inline uint32_t _twr_scheduler_watchdog_task_start(twr_scheduler_task_id_t task_id);
+
+static inline void _twr_scheduler_watchdog_task_end(twr_scheduler_task_id_t task_id, uint32_t start);
+
+#if TWR_SCHEDULER_HEAP
+
+static void _twr_scheduler_heap_swap(size_t a, size_t b);
+static void _twr_scheduler_heap_sift_up(size_t index);
+static void _twr_scheduler_heap_sift_down(size_t index);
+static void _twr_scheduler_heap_remove(twr_scheduler_task_id_t task_id);
+
+#endif
+
 void twr_scheduler_init(void)
 {
     memset(&_twr_scheduler, 0, sizeof(_twr_scheduler));
+
+#if TWR_SCHEDULER_HEAP
+    for (twr_scheduler_task_id_t i = 0; i < TWR_SCHEDULER_MAX_TASKS; i++)
+    {
+        _twr_scheduler.pool[i].heap_index = _TWR_SCHEDULER_HEAP_NONE;
+    }
+#endif
+
+    for (twr_scheduler_task_id_t i = 0; i < twr_scheduler_get_static_count(); i++)
+    {
+        _twr_scheduler.pool[i].task = __twr_scheduler_task_start[i].task;
+        _twr_scheduler.pool[i].param = __twr_scheduler_task_start[i].param;
+        _twr_scheduler.pool[i].tick_execution = TWR_TICK_INFINITY;
+
+        _twr_scheduler.max_task_id = i;
+    }
+
+#if TWR_SCHEDULER_PROFILE
+    twr_timer_init();
+#endif
+
+    _twr_scheduler_watchdog_init();
+}
+
+#if TWR_SCHEDULER_HEAP
+
+void twr_scheduler_run(void)
+{
+    twr_scheduler_task_id_t deferred[TWR_SCHEDULER_MAX_TASKS];
+
+    _twr_scheduler_watchdog_report();
+
+    while (true)
+    {
+        _twr_scheduler.tick_spin = twr_tick_get();
+
+#if TWR_STACK_PAINT
+        if (!twr_stack_check_guard())
+        {
+            application_error(TWR_ERROR_STACK_OVERFLOW);
+        }
+#endif
+
+        _twr_scheduler.spin++;
+
+        memset(_twr_scheduler.high_ran, 0, sizeof(_twr_scheduler.high_ran));
+
+        _twr_scheduler_run_high();
+
+        size_t deferred_length = 0;
+
+        while (true)
+        {
+            uint32_t primask = twr_irq_save();
+
+            if (_twr_scheduler.heap_length == 0 || _twr_scheduler.pool[_twr_scheduler.heap[0]].tick_execution > _twr_scheduler.tick_spin)
+            {
+                twr_irq_restore(primask);
+
+                break;
+            }
+
+            twr_scheduler_task_id_t task_id = _twr_scheduler.heap[0];
+
+            _twr_scheduler_heap_remove(task_id);
+
+            twr_irq_restore(primask);
+
+            // Each task runs at most once per spin, the one planned again meanwhile waits for the next spin
+            if (_twr_scheduler.pool[task_id].spin == _twr_scheduler.spin)
+            {
+                if (!_twr_scheduler.pool[task_id].deferred)
+                {
+                    _twr_scheduler.pool[task_id].deferred = true;
+
+                    deferred[deferred_length++] = task_id;
+                }
+
+                continue;
+            }
+
+            _twr_scheduler.pool[task_id].spin = _twr_scheduler.spin;
+
+            _twr_scheduler.current_task_id = task_id;
+
+            _twr_scheduler_execute(task_id);
+
+            _twr_scheduler_run_high();
+        }
+
+        for (size_t i = 0; i < deferred_length; i++)
+        {
+            twr_scheduler_task_id_t task_id = deferred[i];
+
+            _twr_scheduler.pool[task_id].deferred = false;
+
+            // Put back unless it has been planned once more or unregistered meanwhile
+            if (_twr_scheduler.pool[task_id].task != NULL && _twr_scheduler.pool[task_id].heap_index == _TWR_SCHEDULER_HEAP_NONE)
+            {
+                _twr_scheduler_set_tick(task_id, _twr_scheduler.pool[task_id].tick_execution);
+            }
+        }
+
+        _twr_scheduler_watchdog_refresh();
+
+        _twr_scheduler_idle();
+    }
 }
 
+#else
+
 void twr_scheduler_run(void)
 {
-    static twr_scheduler_task_id_t *task_id = &_twr_scheduler.current_task_id;
+    _twr_scheduler_watchdog_report();
 
     while (true)
     {
         _twr_scheduler.tick_spin = twr_tick_get();
 
-        for (*task_id = 0; *task_id <= _twr_scheduler.max_task_id; (*task_id)++)
+#if TWR_STACK_PAINT
+        if (!twr_stack_check_guard())
         {
-            if (_twr_scheduler.pool[*task_id].task != NULL)
+            application_error(TWR_ERROR_STACK_OVERFLOW);
+        }
+#endif
+
+        memset(_twr_scheduler.high_ran, 0, sizeof(_twr_scheduler.high_ran));
+
+        _twr_scheduler_run_high();
+
+        for (twr_scheduler_task_id_t task_id = 0; task_id <= _twr_scheduler.max_task_id; task_id++)
+        {
+            // Tasks of high priority are run by _twr_scheduler_run_high only
+            if (_twr_scheduler.pool[task_id].task != NULL && (_twr_scheduler.high[task_id / 32] & (1UL << (task_id % 32))) == 0)
             {
-                if (_twr_scheduler.tick_spin >= _twr_scheduler.pool[*task_id].tick_execution)
+                if (_twr_scheduler.tick_spin >= _twr_scheduler.pool[task_id].tick_execution)
                 {
-                    _twr_scheduler.pool[*task_id].tick_execution = TWR_TICK_INFINITY;
+                    _twr_scheduler.current_task_id = task_id;
 
-                    _twr_scheduler.pool[*task_id].task(_twr_scheduler.pool[*task_id].param);
+                    _twr_scheduler_execute(task_id);
+
+                    _twr_scheduler_run_high();
                 }
             }
         }
-        application_idle();
+
+        _twr_scheduler_watchdog_refresh();
+
+        _twr_scheduler_idle();
+    }
+}
+
+#endif
+
+static void _twr_scheduler_signal_collect(void)
+{
+    for (size_t i = 0; i < sizeof(_twr_scheduler.signal) / sizeof(_twr_scheduler.signal[0]); i++)
+    {
+        if (_twr_scheduler.signal[i] == 0)
+        {
+            continue;
+        }
+
+        uint32_t primask = __get_PRIMASK();
+
+        __disable_irq();
+
+        uint32_t signal = _twr_scheduler.signal[i];
+
+        _twr_scheduler.signal[i] = 0;
+
+        __set_PRIMASK(primask);
+
+        while (signal != 0)
+        {
+            twr_scheduler_task_id_t task_id = i * 32 + __builtin_ctz(signal);
+
+            signal &= signal - 1;
+
+            if (_twr_scheduler.pool[task_id].task != NULL)
+            {
+                _twr_scheduler_set_tick(task_id, 0);
+            }
+        }
+    }
+}
+
+static void _twr_scheduler_run_high(void)
+{
+    // Signals are collected here, so tasks of high priority signalled during a long task do not wait for next spin
+    _twr_scheduler_signal_collect();
+
+    for (size_t i = 0; i < sizeof(_twr_scheduler.high) / sizeof(_twr_scheduler.high[0]); i++)
+    {
+        // Each task runs at most once per spin, the one planned again meanwhile waits for the next spin
+        uint32_t pending = _twr_scheduler.high[i] & ~_twr_scheduler.high_ran[i];
+
+        while (pending != 0)
+        {
+            twr_scheduler_task_id_t task_id = i * 32 + __builtin_ctz(pending);
+
+            pending &= pending - 1;
+
+            uint32_t primask = twr_irq_save();
+
+            bool due = _twr_scheduler.pool[task_id].task != NULL && _twr_scheduler.pool[task_id].tick_execution <= _twr_scheduler.tick_spin;
+
+#if TWR_SCHEDULER_HEAP
+            // Task run from the heap in this spin stays there to be deferred
+            due = due && _twr_scheduler.pool[task_id].spin != _twr_scheduler.spin;
+
+            if (due && _twr_scheduler.pool[task_id].heap_index != _TWR_SCHEDULER_HEAP_NONE)
+            {
+                _twr_scheduler_heap_remove(task_id);
+            }
+#endif
+
+            twr_irq_restore(primask);
+
+            if (!due)
+            {
+                continue;
+            }
+
+            _twr_scheduler.high_ran[i] |= 1UL << (task_id % 32);
+
+#if TWR_SCHEDULER_HEAP
+            _twr_scheduler.pool[task_id].spin = _twr_scheduler.spin;
+#endif
+
+            _twr_scheduler.current_task_id = task_id;
+
+            _twr_scheduler_execute(task_id);
+        }
+    }
+}
+
+#if TWR_SCHEDULER_PROFILE
+
+static void _twr_scheduler_execute(twr_scheduler_task_id_t task_id)
+{
+    twr_tick_t tick_execution = _twr_scheduler.pool[task_id].tick_execution;
+
+    _twr_scheduler.pool[task_id].tick_execution = TWR_TICK_INFINITY;
+
+#if TWR_STACK_PAINT
+    // Use since previous measurement is not counted against this run, measurement is kept out of execution time
+    twr_stack_measure();
+#endif
+
+    twr_tick_t tick_start = twr_tick_get();
+
+    twr_timer_start();
+
+    uint16_t microseconds = twr_timer_get_microseconds();
+
+    uint32_t start = _twr_scheduler_watchdog_task_start(task_id);
+
+    twr_trace_task_start(task_id);
+
+    _twr_scheduler.pool[task_id].task(_twr_scheduler.pool[task_id].param);
+
+    twr_trace_task_end(task_id);
+
+    _twr_scheduler_watchdog_task_end(task_id, start);
+
+    // Timer counter is 16-bit only, so long runs are taken from tick
+    uint32_t duration = (uint16_t) (twr_timer_get_microseconds() - microseconds);
+
+    twr_timer_stop();
+
+#if TWR_STACK_PAINT
+    uint32_t stack = twr_stack_measure();
+#endif
+
+    twr_tick_t ticks = twr_tick_get() - tick_start;
+
+    if (ticks >= TWR_SCHEDULER_PROFILE_TIMER_LIMIT_MS)
+    {
+        duration = ticks * 1000;
+    }
+
+    twr_scheduler_profile_t *profile = &_twr_scheduler.profile[task_id];
+
+    profile->count++;
+
+    profile->time_total += duration;
+
+    if (profile->time_max < duration)
+    {
+        profile->time_max = duration;
+    }
+
+    // Task planned to run now has nothing to be late against
+    if (tick_execution != 0 && tick_start > tick_execution)
+    {
+        twr_tick_t late = tick_start - tick_execution;
+
+        profile->late_total += late;
+
+        if (profile->late_max < late)
+        {
+            profile->late_max = late;
+        }
     }
+
+#if TWR_STACK_PAINT
+    if (profile->stack_max < stack)
+    {
+        profile->stack_max = stack;
+    }
+#endif
+}
+
+#else
+
+static void _twr_scheduler_execute(twr_scheduler_task_id_t task_id)
+{
+    _twr_scheduler.pool[task_id].tick_execution = TWR_TICK_INFINITY;
+
+    uint32_t start = _twr_scheduler_watchdog_task_start(task_id);
+
+    twr_trace_task_start(task_id);
+
+    _twr_scheduler.pool[task_id].task(_twr_scheduler.pool[task_id].param);
+
+    twr_trace_task_end(task_id);
+
+    _twr_scheduler_watchdog_task_end(task_id, start);
 }
 
+#endif
+
+#if TWR_SCHEDULER_TICKLESS
+
+static void _twr_scheduler_idle(void)
+{
+    // Releases made during spin are applied at once
+    twr_system_clock_commit();
+
+    _twr_scheduler_standby_check();
+
+    uint32_t primask = twr_irq_save();
+
+    twr_tick_t tick_next = twr_scheduler_get_next_tick();
+
+    twr_tick_t tick_now = twr_tick_get();
+
+    // Short waits are left to periodic tick, reprogramming RTC is not worth it
+    bool signalled = false;
+
+    for (size_t i = 0; i < sizeof(_twr_scheduler.signal) / sizeof(_twr_scheduler.signal[0]); i++)
+    {
+        signalled |= _twr_scheduler.signal[i] != 0;
+    }
+
+    if (!signalled && sleep_manager.disable_sleep_semaphore == 0 && tick_next > tick_now + 2 * TWR_SCHEDULER_INTERVAL_MS)
+    {
+        twr_tick_t timeout = tick_next - tick_now;
+
+#if TWR_SCHEDULER_WATCHDOG
+        // Spin has to refresh watchdog before it expires
+        if (timeout > TWR_SCHEDULER_WATCHDOG_IDLE_MS)
+        {
+            timeout = TWR_SCHEDULER_WATCHDOG_IDLE_MS;
+        }
+#endif
+
+        if (twr_system_tickless_enter(timeout > UINT32_MAX ? UINT32_MAX : (uint32_t) timeout))
+        {
+            _twr_scheduler.tick_tickless = tick_next;
+        }
+    }
+
+    twr_irq_restore(primask);
+
+    application_idle();
+
+    primask = twr_irq_save();
+
+    if (_twr_scheduler.tick_tickless != 0)
+    {
+        twr_system_tickless_exit();
+
+        _twr_scheduler.tick_tickless = 0;
+    }
+
+    twr_irq_restore(primask);
+}
+
+#else
+
+static void _twr_scheduler_idle(void)
+{
+    // Releases made during spin are applied at once
+    twr_system_clock_commit();
+
+    _twr_scheduler_standby_check();
+
+    application_idle();
+}
+
+#endif
+
 twr_scheduler_task_id_t twr_scheduler_register(void (*task)(void *), void *param, twr_tick_t tick)
 {
     for (twr_scheduler_task_id_t i = 0; i < TWR_SCHEDULER_MAX_TASKS; i++)
     {
         if (_twr_scheduler.pool[i].task == NULL)
         {
-            _twr_scheduler.pool[i].tick_execution = tick;
             _twr_scheduler.pool[i].task = task;
             _twr_scheduler.pool[i].param = param;
 
+            _twr_scheduler.high[i / 32] &= ~(1UL << (i % 32));
+
+#if TWR_SCHEDULER_PROFILE
+            memset(&_twr_scheduler.profile[i], 0, sizeof(_twr_scheduler.profile[i]));
+#endif
+
+#if TWR_SCHEDULER_WATCHDOG
+            _twr_scheduler.pool[i].budget = 0;
+#endif
+
+            _twr_scheduler_set_tick(i, tick);
+
             if (_twr_scheduler.max_task_id < i)
             {
                 _twr_scheduler.max_task_id = i;
@@ -74,12 +590,56 @@ twr_scheduler_task_id_t twr_scheduler_register(void (*task)(void *), void *param
     return 0;
 }
 
+void twr_scheduler_set_priority(twr_scheduler_task_id_t task_id, twr_scheduler_priority_t priority)
+{
+    if (task_id >= TWR_SCHEDULER_MAX_TASKS || _twr_scheduler.pool[task_id].task == NULL)
+    {
+        application_error(TWR_ERROR_INVALID_PARAMETER);
+    }
+
+    if (priority == TWR_SCHEDULER_PRIORITY_HIGH)
+    {
+        _twr_scheduler.high[task_id / 32] |= 1UL << (task_id % 32);
+    }
+    else
+    {
+        _twr_scheduler.high[task_id / 32] &= ~(1UL << (task_id % 32));
+    }
+}
+
+#if TWR_SCHEDULER_WATCHDOG
+
+void twr_scheduler_set_budget(twr_scheduler_task_id_t task_id, uint32_t budget)
+{
+    if (task_id >= TWR_SCHEDULER_MAX_TASKS || _twr_scheduler.pool[task_id].task == NULL)
+    {
+        application_error(TWR_ERROR_INVALID_PARAMETER);
+    }
+
+    _twr_scheduler.pool[task_id].budget = budget;
+}
+
+#endif
+
+twr_scheduler_task_id_t twr_scheduler_get_static_id(const twr_scheduler_task_static_t *descriptor)
+{
+    return descriptor - __twr_scheduler_task_start;
+}
+
+size_t twr_scheduler_get_static_count(void)
+{
+    return __twr_scheduler_task_end - __twr_scheduler_task_start;
+}
+
 void twr_scheduler_unregister(twr_scheduler_task_id_t task_id)
 {
-    if (task_id >= TWR_SCHEDULER_MAX_TASKS)
+    if (task_id >= TWR_SCHEDULER_MAX_TASKS || task_id < twr_scheduler_get_static_count())
     {
         application_error(TWR_ERROR_INVALID_PARAMETER);
     }
+
+    _twr_scheduler_set_tick(task_id, TWR_TICK_INFINITY);
+
     _twr_scheduler.pool[task_id].task = NULL;
 
     if (_twr_scheduler.max_task_id == task_id)
@@ -107,13 +667,106 @@ twr_tick_t twr_scheduler_get_spin_tick(void)
     return _twr_scheduler.tick_spin;
 }
 
+#if TWR_SCHEDULER_PROFILE
+
+bool twr_scheduler_get_profile(twr_scheduler_task_id_t task_id, twr_scheduler_profile_t *profile)
+{
+    if (task_id >= TWR_SCHEDULER_MAX_TASKS || _twr_scheduler.pool[task_id].task == NULL)
+    {
+        return false;
+    }
+
+    *profile = _twr_scheduler.profile[task_id];
+
+    return true;
+}
+
+void twr_scheduler_profile_reset(void)
+{
+    memset(_twr_scheduler.profile, 0, sizeof(_twr_scheduler.profile));
+}
+
+void twr_scheduler_profile_log(void)
+{
+    twr_log_info("id task     count      total us   max us   late ms  max late ms  stack");
+
+    for (twr_scheduler_task_id_t i = 0; i <= _twr_scheduler.max_task_id; i++)
+    {
+        twr_scheduler_profile_t *profile = &_twr_scheduler.profile[i];
+
+        if (_twr_scheduler.pool[i].task != NULL)
+        {
+            twr_log_info("%2u %08" PRIxPTR " %8" PRIu32 " %12" PRIu64 " %8" PRIu32 " %9" PRIu64 " %12" PRIu64 " %6" PRIu32,
+                    (unsigned int) i, (uintptr_t) _twr_scheduler.pool[i].task, profile->count, profile->time_total,
+                    profile->time_max, profile->late_total, profile->late_max, profile->stack_max);
+        }
+    }
+}
+
+bool twr_scheduler_profile_atci_action(void)
+{
+    for (twr_scheduler_task_id_t i = 0; i <= _twr_scheduler.max_task_id; i++)
+    {
+        twr_scheduler_profile_t *profile = &_twr_scheduler.profile[i];
+
+        if (_twr_scheduler.pool[i].task != NULL)
+        {
+            twr_atci_printfln("$SCHEDPROF: %u,%08" PRIxPTR ",%" PRIu32 ",%" PRIu64 ",%" PRIu32 ",%" PRIu64 ",%" PRIu64 ",%" PRIu32,
+                    (unsigned int) i, (uintptr_t) _twr_scheduler.pool[i].task, profile->count, profile->time_total,
+                    profile->time_max, profile->late_total, profile->late_max, profile->stack_max);
+        }
+    }
+
+    return true;
+}
+
+#endif
+
+#if TWR_SCHEDULER_HEAP
+
+twr_tick_t twr_scheduler_get_next_tick(void)
+{
+    twr_tick_t tick = TWR_TICK_INFINITY;
+
+    uint32_t primask = twr_irq_save();
+
+    if (_twr_scheduler.heap_length != 0)
+    {
+        tick = _twr_scheduler.pool[_twr_scheduler.heap[0]].tick_execution;
+    }
+
+    twr_irq_restore(primask);
+
+    return tick;
+}
+
+#else
+
+twr_tick_t twr_scheduler_get_next_tick(void)
+{
+    twr_tick_t tick = TWR_TICK_INFINITY;
+
+    for (twr_scheduler_task_id_t i = 0; i <= _twr_scheduler.max_task_id; i++)
+    {
+        if (_twr_scheduler.pool[i].task != NULL && _twr_scheduler.pool[i].tick_execution < tick)
+        {
+            tick = _twr_scheduler.pool[i].tick_execution;
+        }
+    }
+
+    return tick;
+}
+
+#endif
+
 void twr_scheduler_plan_now(twr_scheduler_task_id_t task_id)
 {
     if (task_id >= TWR_SCHEDULER_MAX_TASKS)
     {
         application_error(TWR_ERROR_INVALID_PARAMETER);
     }
-    _twr_scheduler.pool[task_id].tick_execution = 0;
+
+    _twr_scheduler_set_tick(task_id, 0);
 }
 
 void twr_scheduler_plan_absolute(twr_scheduler_task_id_t task_id, twr_tick_t tick)
@@ -122,7 +775,8 @@ void twr_scheduler_plan_absolute(twr_scheduler_task_id_t task_id, twr_tick_t tic
     {
         application_error(TWR_ERROR_INVALID_PARAMETER);
     }
-    _twr_scheduler.pool[task_id].tick_execution = tick;
+
+    _twr_scheduler_set_tick(task_id, tick);
 }
 
 void twr_scheduler_plan_relative(twr_scheduler_task_id_t task_id, twr_tick_t tick)
@@ -131,7 +785,8 @@ void twr_scheduler_plan_relative(twr_scheduler_task_id_t task_id, twr_tick_t tic
     {
         application_error(TWR_ERROR_INVALID_PARAMETER);
     }
-    _twr_scheduler.pool[task_id].tick_execution = _twr_scheduler.tick_spin + tick;
+
+    _twr_scheduler_set_tick(task_id, _twr_scheduler.tick_spin + tick);
 }
 
 void twr_scheduler_plan_from_now(twr_scheduler_task_id_t task_id, twr_tick_t tick)
@@ -140,25 +795,305 @@ void twr_scheduler_plan_from_now(twr_scheduler_task_id_t task_id, twr_tick_t tic
     {
         application_error(TWR_ERROR_INVALID_PARAMETER);
     }
-    _twr_scheduler.pool[task_id].tick_execution = twr_tick_get() + tick;
+
+    _twr_scheduler_set_tick(task_id, twr_tick_get() + tick);
+}
+
+void twr_scheduler_signal(twr_scheduler_task_id_t task_id)
+{
+    if (task_id >= TWR_SCHEDULER_MAX_TASKS)
+    {
+        application_error(TWR_ERROR_INVALID_PARAMETER);
+    }
+
+    // Cortex-M0+ has no exclusive access instructions, masking interrupts just for the read-modify-write makes it atomic
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    _twr_scheduler.signal[task_id / 32] |= 1UL << (task_id % 32);
+
+    __set_PRIMASK(primask);
+
+    _twr_scheduler_tickless_check(0);
 }
 
 void twr_scheduler_plan_current_now(void)
 {
-    _twr_scheduler.pool[_twr_scheduler.current_task_id].tick_execution = 0;
+    _twr_scheduler_set_tick(_twr_scheduler.current_task_id, 0);
 }
 
 void twr_scheduler_plan_current_absolute(twr_tick_t tick)
 {
-    _twr_scheduler.pool[_twr_scheduler.current_task_id].tick_execution = tick;
+    _twr_scheduler_set_tick(_twr_scheduler.current_task_id, tick);
 }
 
 void twr_scheduler_plan_current_relative(twr_tick_t tick)
 {
-    _twr_scheduler.pool[_twr_scheduler.current_task_id].tick_execution = _twr_scheduler.tick_spin + tick;
+    _twr_scheduler_set_tick(_twr_scheduler.current_task_id, _twr_scheduler.tick_spin + tick);
 }
 
 void twr_scheduler_plan_current_from_now(twr_tick_t tick)
 {
-    _twr_scheduler.pool[_twr_scheduler.current_task_id].tick_execution = twr_tick_get() + tick;
+    _twr_scheduler_set_tick(_twr_scheduler.current_task_id, twr_tick_get() + tick);
 }
+
+static inline void _twr_scheduler_standby_check(void)
+{
+#if TWR_SCHEDULER_STANDBY
+    if (sleep_manager.disable_sleep_semaphore != 0)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < sizeof(_twr_scheduler.signal) / sizeof(_twr_scheduler.signal[0]); i++)
+    {
+        if (_twr_scheduler.signal[i] != 0)
+        {
+            return;
+        }
+    }
+
+    twr_tick_t tick_next = twr_scheduler_get_next_tick();
+
+    twr_tick_t tick_now = twr_tick_get();
+
+    if (tick_next >= tick_now + TWR_SCHEDULER_STANDBY_THRESHOLD_MS)
+    {
+        twr_tick_t timeout = tick_next - tick_now;
+
+        // Does not return, program starts from reset on the alarm with tick restored
+        twr_system_enter_standby_alarm(timeout > UINT32_MAX ? UINT32_MAX : (uint32_t) timeout);
+    }
+#endif
+}
+
+static inline void _twr_scheduler_watchdog_init(void)
+{
+#if TWR_SCHEDULER_WATCHDOG
+    if (_twr_scheduler_running.magic == _TWR_SCHEDULER_WATCHDOG_MAGIC)
+    {
+        _twr_scheduler.stalled = true;
+        _twr_scheduler.stalled_watchdog = (RCC->CSR & RCC_CSR_IWDGRSTF) != 0;
+        _twr_scheduler.stalled_task_id = _twr_scheduler_running.task_id;
+        _twr_scheduler.stalled_task = _twr_scheduler_running.task;
+    }
+
+    _twr_scheduler_running.magic = 0;
+
+    // Reset flags are cleared, so that the next reset is told apart
+    RCC->CSR |= RCC_CSR_RMVF;
+#endif
+}
+
+static inline void _twr_scheduler_watchdog_report(void)
+{
+#if TWR_SCHEDULER_WATCHDOG
+    if (_twr_scheduler.stalled)
+    {
+        twr_log_error("Reset%s in task %u (%p)", _twr_scheduler.stalled_watchdog ? " by watchdog" : "",
+                      (unsigned int) _twr_scheduler.stalled_task_id, _twr_scheduler.stalled_task);
+
+        _twr_scheduler.stalled = false;
+    }
+#endif
+}
+
+static inline void _twr_scheduler_watchdog_refresh(void)
+{
+#if TWR_SCHEDULER_WATCHDOG
+    twr_watchdog_refresh();
+#endif
+}
+
+static inline uint32_t _twr_scheduler_watchdog_task_start(twr_scheduler_task_id_t task_id)
+{
+#if TWR_SCHEDULER_WATCHDOG
+    _twr_scheduler_running.task_id = task_id;
+    _twr_scheduler_running.task = _twr_scheduler.pool[task_id].task;
+    _twr_scheduler_running.magic = _TWR_SCHEDULER_WATCHDOG_MAGIC;
+
+    return twr_hrtick_is_running() ? twr_hrtick_get_32() : (uint32_t) twr_tick_get() * 1000;
+#else
+    (void) task_id;
+
+    return 0;
+#endif
+}
+
+static inline void _twr_scheduler_watchdog_task_end(twr_scheduler_task_id_t task_id, uint32_t start)
+{
+#if TWR_SCHEDULER_WATCHDOG
+    _twr_scheduler_running.magic = 0;
+
+    uint32_t budget = _twr_scheduler.pool[task_id].budget;
+
+    if (budget == 0)
+    {
+        return;
+    }
+
+    uint32_t duration = (twr_hrtick_is_running() ? twr_hrtick_get_32() : (uint32_t) twr_tick_get() * 1000) - start;
+
+    if (duration > budget)
+    {
+        twr_log_error("Task %u (%p) took %lu us over budget %lu us", (unsigned int) task_id,
+                      _twr_scheduler_running.task, (unsigned long) duration, (unsigned long) budget);
+    }
+#else
+    (void) task_id;
+    (void) start;
+#endif
+}
+
+static inline void _twr_scheduler_tickless_check(twr_tick_t tick)
+{
+#if TWR_SCHEDULER_TICKLESS
+    // Task planned from interrupt before the tickless wake-up must not wait for it
+    uint32_t primask = twr_irq_save();
+
+    if (_twr_scheduler.tick_tickless != 0 && tick < _twr_scheduler.tick_tickless)
+    {
+        twr_system_tickless_exit();
+
+        _twr_scheduler.tick_tickless = 0;
+    }
+
+    twr_irq_restore(primask);
+#else
+    (void) tick;
+#endif
+}
+
+#if TWR_SCHEDULER_HEAP
+
+static void _twr_scheduler_set_tick(twr_scheduler_task_id_t task_id, twr_tick_t tick)
+{
+    // Planning is allowed from interrupts, so the heap is guarded
+    uint32_t primask = twr_irq_save();
+
+    _twr_scheduler_tickless_check(tick);
+
+    twr_tick_t tick_previous = _twr_scheduler.pool[task_id].tick_execution;
+
+    _twr_scheduler.pool[task_id].tick_execution = tick;
+
+    size_t index = _twr_scheduler.pool[task_id].heap_index;
+
+    // Unregistered slot can be planned too (e.g. from late interrupt), but it must not get into heap
+    if (tick == TWR_TICK_INFINITY || _twr_scheduler.pool[task_id].task == NULL)
+    {
+        if (index != _TWR_SCHEDULER_HEAP_NONE)
+        {
+            _twr_scheduler_heap_remove(task_id);
+        }
+    }
+    else if (index == _TWR_SCHEDULER_HEAP_NONE)
+    {
+        index = _twr_scheduler.heap_length++;
+
+        _twr_scheduler.heap[index] = task_id;
+
+        _twr_scheduler.pool[task_id].heap_index = index;
+
+        _twr_scheduler_heap_sift_up(index);
+    }
+    else if (tick < tick_previous)
+    {
+        _twr_scheduler_heap_sift_up(index);
+    }
+    else
+    {
+        _twr_scheduler_heap_sift_down(index);
+    }
+
+    twr_irq_restore(primask);
+}
+
+static void _twr_scheduler_heap_swap(size_t a, size_t b)
+{
+    twr_scheduler_task_id_t task_id = _twr_scheduler.heap[a];
+
+    _twr_scheduler.heap[a] = _twr_scheduler.heap[b];
+    _twr_scheduler.heap[b] = task_id;
+
+    _twr_scheduler.pool[_twr_scheduler.heap[a]].heap_index = a;
+    _twr_scheduler.pool[_twr_scheduler.heap[b]].heap_index = b;
+}
+
+static void _twr_scheduler_heap_sift_up(size_t index)
+{
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / 2;
+
+        if (_twr_scheduler.pool[_twr_scheduler.heap[parent]].tick_execution <= _twr_scheduler.pool[_twr_scheduler.heap[index]].tick_execution)
+        {
+            break;
+        }
+
+        _twr_scheduler_heap_swap(index, parent);
+
+        index = parent;
+    }
+}
+
+static void _twr_scheduler_heap_sift_down(size_t index)
+{
+    while (true)
+    {
+        size_t smallest = index;
+        size_t left = 2 * index + 1;
+        size_t right = left + 1;
+
+        if (left < _twr_scheduler.heap_length && _twr_scheduler.pool[_twr_scheduler.heap[left]].tick_execution < _twr_scheduler.pool[_twr_scheduler.heap[smallest]].tick_execution)
+        {
+            smallest = left;
+        }
+
+        if (right < _twr_scheduler.heap_length && _twr_scheduler.pool[_twr_scheduler.heap[right]].tick_execution < _twr_scheduler.pool[_twr_scheduler.heap[smallest]].tick_execution)
+        {
+            smallest = right;
+        }
+
+        if (smallest == index)
+        {
+            break;
+        }
+
+        _twr_scheduler_heap_swap(index, smallest);
+
+        index = smallest;
+    }
+}
+
+static void _twr_scheduler_heap_remove(twr_scheduler_task_id_t task_id)
+{
+    size_t index = _twr_scheduler.pool[task_id].heap_index;
+
+    size_t last = --_twr_scheduler.heap_length;
+
+    if (index != last)
+    {
+        _twr_scheduler_heap_swap(index, last);
+    }
+
+    _twr_scheduler.pool[task_id].heap_index = _TWR_SCHEDULER_HEAP_NONE;
+
+    if (index != last)
+    {
+        _twr_scheduler_heap_sift_up(index);
+        _twr_scheduler_heap_sift_down(index);
+    }
+}
+
+#else
+
+static void _twr_scheduler_set_tick(twr_scheduler_task_id_t task_id, twr_tick_t tick)
+{
+    _twr_scheduler_tickless_check(tick);
+
+    _twr_scheduler.pool[task_id].tick_execution = tick;
+}
+
+#endif
@@ -0,0 +1,338 @@
+#include <twr_sensor.h>
+
+static struct
+{
+    bool initialized;
+    bool running;
+    twr_scheduler_task_id_t task_id;
+    twr_tick_t tick_planned;
+    twr_sensor_t *head;
+
+} _twr_sensor;
+
+static void _twr_sensor_task(void *param);
+
+static void _twr_sensor_step(twr_sensor_t *self);
+
+static void _twr_sensor_plan(twr_tick_t tick);
+
+void twr_sensor_init(twr_sensor_t *self, const twr_sensor_descriptor_t *descriptor, void *param, twr_tick_t delay_run)
+{
+    memset(self, 0, sizeof(*self));
+
+    self->_descriptor = descriptor;
+    self->_param = param;
+    self->_state = TWR_SENSOR_STATE_INITIALIZE;
+    self->_conversion_time = descriptor->conversion_time;
+    self->_update_interval = TWR_TICK_INFINITY;
+    self->_tick_interval = TWR_TICK_INFINITY;
+    self->_tick_ready = twr_tick_get() + delay_run;
+    self->_tick_action = self->_tick_ready;
+
+    if (!_twr_sensor.initialized)
+    {
+        _twr_sensor.task_id = twr_scheduler_register(_twr_sensor_task, NULL, TWR_TICK_INFINITY);
+        _twr_sensor.tick_planned = TWR_TICK_INFINITY;
+        _twr_sensor.initialized = true;
+    }
+
+    self->_next = _twr_sensor.head;
+    _twr_sensor.head = self;
+
+    _twr_sensor_plan(self->_tick_action);
+}
+
+void twr_sensor_unregister(twr_sensor_t *self)
+{
+    twr_sensor_t **sensor = &_twr_sensor.head;
+
+    while (*sensor != NULL)
+    {
+        if (*sensor == self)
+        {
+            *sensor = self->_next;
+
+            break;
+        }
+
+        sensor = &(*sensor)->_next;
+    }
+
+    self->_next = NULL;
+    self->_tick_action = TWR_TICK_INFINITY;
+    self->_tick_interval = TWR_TICK_INFINITY;
+}
+
+void twr_sensor_set_update_interval(twr_sensor_t *self, twr_tick_t interval)
+{
+    self->_update_interval = interval;
+
+    if (self->_update_interval == TWR_TICK_INFINITY)
+    {
+        self->_tick_interval = TWR_TICK_INFINITY;
+    }
+    else
+    {
+        self->_tick_interval = twr_tick_get() + self->_update_interval;
+
+        twr_sensor_measure(self);
+
+        _twr_sensor_plan(self->_tick_interval);
+    }
+}
+
+void twr_sensor_set_conversion_time(twr_sensor_t *self, twr_tick_t conversion_time)
+{
+    self->_conversion_time = conversion_time;
+}
+
+void twr_sensor_reinitialize(twr_sensor_t *self)
+{
+    self->_state = TWR_SENSOR_STATE_INITIALIZE;
+}
+
+void twr_sensor_hold_read(twr_sensor_t *self, twr_tick_t tick)
+{
+    self->_tick_hold = tick;
+
+    // Conversion which is already running is postponed too
+    if (self->_state == TWR_SENSOR_STATE_READ && self->_tick_action < tick)
+    {
+        self->_tick_action = tick;
+    }
+}
+
+bool twr_sensor_measure(twr_sensor_t *self)
+{
+    if (self->_measurement_active)
+    {
+        return false;
+    }
+
+    self->_measurement_active = true;
+
+    self->_tick_action = self->_tick_ready;
+
+    _twr_sensor_plan(self->_tick_action);
+
+    return true;
+}
+
+void twr_sensor_signal(twr_sensor_t *self)
+{
+    self->_signal = true;
+
+    twr_scheduler_signal(_twr_sensor.task_id);
+}
+
+static void _twr_sensor_task(void *param)
+{
+    (void) param;
+
+    _twr_sensor.running = true;
+
+    twr_tick_t now = twr_tick_get();
+
+    twr_sensor_t *sensor = _twr_sensor.head;
+
+    while (sensor != NULL)
+    {
+        // Event handler is allowed to unregister the sensor
+        twr_sensor_t *next = sensor->_next;
+
+        if (sensor->_signal)
+        {
+            sensor->_signal = false;
+
+            twr_sensor_measure(sensor);
+        }
+
+        if (sensor->_tick_interval <= now)
+        {
+            twr_sensor_measure(sensor);
+
+            sensor->_tick_interval += sensor->_update_interval;
+
+            if (sensor->_tick_interval <= now)
+            {
+                sensor->_tick_interval = now + sensor->_update_interval;
+            }
+        }
+
+        if (sensor->_tick_action <= now)
+        {
+            _twr_sensor_step(sensor);
+        }
+
+        sensor = next;
+    }
+
+    twr_tick_t tick_min = TWR_TICK_INFINITY;
+
+    for (sensor = _twr_sensor.head; sensor != NULL; sensor = sensor->_next)
+    {
+        if (sensor->_tick_action < tick_min)
+        {
+            tick_min = sensor->_tick_action;
+        }
+
+        if (sensor->_tick_interval < tick_min)
+        {
+            tick_min = sensor->_tick_interval;
+        }
+    }
+
+    twr_tick_t tick_planned = tick_min;
+
+    if (tick_min != TWR_TICK_INFINITY)
+    {
+        // Join the latest step which is due shortly after the earliest one
+        twr_tick_t tick_limit = tick_min + TWR_SENSOR_GROUP_WINDOW;
+
+        for (sensor = _twr_sensor.head; sensor != NULL; sensor = sensor->_next)
+        {
+            if (sensor->_tick_action > tick_planned && sensor->_tick_action <= tick_limit)
+            {
+                tick_planned = sensor->_tick_action;
+            }
+
+            if (sensor->_tick_interval > tick_planned && sensor->_tick_interval <= tick_limit)
+            {
+                tick_planned = sensor->_tick_interval;
+            }
+        }
+    }
+
+    _twr_sensor.tick_planned = tick_planned;
+
+    _twr_sensor.running = false;
+
+    twr_scheduler_plan_current_absolute(tick_planned);
+}
+
+static void _twr_sensor_step(twr_sensor_t *self)
+{
+    const twr_sensor_descriptor_t *descriptor = self->_descriptor;
+
+    self->_tick_action = TWR_TICK_INFINITY;
+
+    while (true)
+    {
+        switch (self->_state)
+        {
+            case TWR_SENSOR_STATE_ERROR:
+            {
+                self->_measurement_active = false;
+                self->_tick_hold = 0;
+
+                self->_state = TWR_SENSOR_STATE_INITIALIZE;
+
+                descriptor->event(self->_param, TWR_SENSOR_EVENT_ERROR);
+
+                return;
+            }
+            case TWR_SENSOR_STATE_INITIALIZE:
+            {
+                self->_state = TWR_SENSOR_STATE_ERROR;
+
+                if (!descriptor->initialize(self->_param))
+                {
+                    continue;
+                }
+
+                self->_state = TWR_SENSOR_STATE_MEASURE;
+
+                self->_tick_ready = twr_tick_get() + descriptor->initialization_time;
+
+                if (self->_measurement_active)
+                {
+                    self->_tick_action = self->_tick_ready;
+                }
+
+                return;
+            }
+            case TWR_SENSOR_STATE_MEASURE:
+            {
+                twr_tick_t now = twr_tick_get();
+
+                if (self->_conversion_time == 0)
+                {
+                    self->_state = TWR_SENSOR_STATE_READ;
+
+                    if (self->_tick_hold > now)
+                    {
+                        self->_tick_action = self->_tick_hold;
+
+                        return;
+                    }
+
+                    continue;
+                }
+
+                self->_state = TWR_SENSOR_STATE_ERROR;
+
+                if (!descriptor->trigger(self->_param))
+                {
+                    continue;
+                }
+
+                self->_state = TWR_SENSOR_STATE_READ;
+
+                self->_tick_action = now + self->_conversion_time;
+
+                if (self->_tick_action < self->_tick_hold)
+                {
+                    self->_tick_action = self->_tick_hold;
+                }
+
+                return;
+            }
+            case TWR_SENSOR_STATE_READ:
+            {
+                self->_state = TWR_SENSOR_STATE_ERROR;
+
+                if (!descriptor->read(self->_param))
+                {
+                    continue;
+                }
+
+                self->_state = TWR_SENSOR_STATE_UPDATE;
+
+                continue;
+            }
+            case TWR_SENSOR_STATE_UPDATE:
+            {
+                self->_measurement_active = false;
+                self->_tick_hold = 0;
+
+                self->_state = TWR_SENSOR_STATE_MEASURE;
+
+                descriptor->event(self->_param, TWR_SENSOR_EVENT_UPDATE);
+
+                return;
+            }
+            default:
+            {
+                self->_state = TWR_SENSOR_STATE_ERROR;
+
+                continue;
+            }
+        }
+    }
+}
+
+static void _twr_sensor_plan(twr_tick_t tick)
+{
+    // Running task plans itself after all sensors are processed
+    if (_twr_sensor.running)
+    {
+        return;
+    }
+
+    if (tick < _twr_sensor.tick_planned)
+    {
+        _twr_sensor.tick_planned = tick;
+
+        twr_scheduler_plan_absolute(_twr_sensor.task_id, tick);
+    }
+}
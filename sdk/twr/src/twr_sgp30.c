@@ -1,4 +1,6 @@
 #include <twr_sgp30.h>
+#include <twr_kv.h>
+#include <twr_rtc.h>
 
 #define _TWR_SGP30_DELAY_RUN 100
 #define _TWR_SGP30_DELAY_INITIALIZE 500
@@ -7,6 +9,19 @@
 #define _TWR_SGP30_DELAY_SET_HUMIDITY 30
 #define _TWR_SGP30_DELAY_MEASURE_AIR_QUALITY 30
 #define _TWR_SGP30_DELAY_READ_AIR_QUALITY 30
+#define _TWR_SGP30_DELAY_SET_BASELINE 30
+#define _TWR_SGP30_DELAY_READ_BASELINE 30
+
+// Baseline of sensor started without restored baseline is valid after 12 hours
+#define _TWR_SGP30_BASELINE_FIRST (12 * 60 * 60 * 1000)
+
+typedef struct __attribute__((packed))
+{
+    uint16_t co2eq;
+    uint16_t tvoc;
+    uint32_t timestamp;
+
+} twr_sgp30_baseline_t;
 
 static void _twr_sgp30_task_interval(void *param);
 
@@ -14,6 +29,8 @@ static void _twr_sgp30_task_measure(void *param);
 
 static uint8_t _twr_sgp30_calculate_crc(uint8_t *buffer, size_t length);
 
+static uint32_t _twr_sgp30_get_timestamp(void);
+
 void twr_sgp30_init(twr_sgp30_t *self, twr_i2c_channel_t i2c_channel, uint8_t i2c_address)
 {
     memset(self, 0, sizeof(*self));
@@ -121,6 +138,21 @@ float twr_sgp30_set_compensation(twr_sgp30_t *self, float *t_celsius, float *rh_
     return ah;
 }
 
+void twr_sgp30_set_compensation_source(twr_sgp30_t *self, bool (*source)(void *, float *, float *), void *param)
+{
+    self->_compensation_source = source;
+    self->_compensation_param = param;
+}
+
+void twr_sgp30_set_baseline_key(twr_sgp30_t *self, uint16_t key)
+{
+    self->_baseline_enabled = true;
+    self->_baseline_key = key;
+
+    // Baseline of measurement already running is not known to be valid yet
+    self->_tick_baseline = twr_tick_get() + _TWR_SGP30_BASELINE_FIRST;
+}
+
 static void _twr_sgp30_task_interval(void *param)
 {
     twr_sgp30_t *self = param;
@@ -229,16 +261,79 @@ start:
                 goto start;
             }
 
-            self->_state = TWR_SGP30_STATE_SET_HUMIDITY;
+            self->_state = self->_baseline_enabled ? TWR_SGP30_STATE_SET_BASELINE : TWR_SGP30_STATE_SET_HUMIDITY;
 
             twr_scheduler_plan_current_from_now(_TWR_SGP30_DELAY_SET_HUMIDITY);
 
             return;
         }
+        case TWR_SGP30_STATE_SET_BASELINE:
+        {
+            self->_state = TWR_SGP30_STATE_ERROR;
+
+            self->_tick_baseline = twr_tick_get() + _TWR_SGP30_BASELINE_FIRST;
+
+            twr_sgp30_baseline_t baseline;
+
+            size_t length = sizeof(baseline);
+
+            uint32_t timestamp = _twr_sgp30_get_timestamp();
+
+            // Baseline from the future is left over from RTC set back or lost
+            if (twr_kv_get(self->_baseline_key, &baseline, &length) && length == sizeof(baseline) &&
+                timestamp >= baseline.timestamp && timestamp - baseline.timestamp <= TWR_SGP30_BASELINE_MAX_AGE)
+            {
+                // Baselines are written in reverse order of readout
+                uint8_t buffer[8];
+
+                buffer[0] = 0x20;
+                buffer[1] = 0x1e;
+                buffer[2] = baseline.tvoc >> 8;
+                buffer[3] = baseline.tvoc;
+                buffer[4] = _twr_sgp30_calculate_crc(&buffer[2], 2);
+                buffer[5] = baseline.co2eq >> 8;
+                buffer[6] = baseline.co2eq;
+                buffer[7] = _twr_sgp30_calculate_crc(&buffer[5], 2);
+
+                twr_i2c_transfer_t transfer;
+
+                transfer.device_address = self->_i2c_address;
+                transfer.buffer = buffer;
+                transfer.length = sizeof(buffer);
+
+                if (!twr_i2c_write(self->_i2c_channel, &transfer))
+                {
+                    goto start;
+                }
+
+                self->_tick_baseline = twr_tick_get() + TWR_SGP30_BASELINE_INTERVAL;
+            }
+
+            self->_state = TWR_SGP30_STATE_SET_HUMIDITY;
+
+            twr_scheduler_plan_current_from_now(_TWR_SGP30_DELAY_SET_BASELINE);
+
+            return;
+        }
         case TWR_SGP30_STATE_SET_HUMIDITY:
         {
             self->_state = TWR_SGP30_STATE_ERROR;
 
+            if (self->_compensation_source != NULL)
+            {
+                float t_celsius;
+                float rh_percentage;
+
+                if (self->_compensation_source(self->_compensation_param, &t_celsius, &rh_percentage))
+                {
+                    twr_sgp30_set_compensation(self, &t_celsius, &rh_percentage);
+                }
+                else
+                {
+                    twr_sgp30_set_compensation(self, NULL, NULL);
+                }
+            }
+
             uint8_t buffer[5];
 
             buffer[0] = 0x20;
@@ -317,6 +412,78 @@ start:
 
             self->_measurement_valid = true;
 
+            if (self->_baseline_enabled && twr_tick_get() >= self->_tick_baseline)
+            {
+                self->_state = TWR_SGP30_STATE_GET_BASELINE;
+
+                twr_scheduler_plan_current_now();
+
+                return;
+            }
+
+            self->_state = TWR_SGP30_STATE_SET_HUMIDITY;
+
+            twr_scheduler_plan_current_absolute(self->_tick_last_measurement + 1000);
+
+            return;
+        }
+        case TWR_SGP30_STATE_GET_BASELINE:
+        {
+            self->_state = TWR_SGP30_STATE_ERROR;
+
+            static const uint8_t buffer[] = { 0x20, 0x15 };
+
+            twr_i2c_transfer_t transfer;
+
+            transfer.device_address = self->_i2c_address;
+            transfer.buffer = (uint8_t *) buffer;
+            transfer.length = sizeof(buffer);
+
+            if (!twr_i2c_write(self->_i2c_channel, &transfer))
+            {
+                goto start;
+            }
+
+            self->_state = TWR_SGP30_STATE_READ_BASELINE;
+
+            twr_scheduler_plan_current_from_now(_TWR_SGP30_DELAY_READ_BASELINE);
+
+            return;
+        }
+        case TWR_SGP30_STATE_READ_BASELINE:
+        {
+            self->_state = TWR_SGP30_STATE_ERROR;
+
+            uint8_t buffer[6];
+
+            twr_i2c_transfer_t transfer;
+
+            transfer.device_address = self->_i2c_address;
+            transfer.buffer = buffer;
+            transfer.length = sizeof(buffer);
+
+            if (!twr_i2c_read(self->_i2c_channel, &transfer))
+            {
+                goto start;
+            }
+
+            if (_twr_sgp30_calculate_crc(&buffer[0], 3) != 0 ||
+                _twr_sgp30_calculate_crc(&buffer[3], 3) != 0)
+            {
+                goto start;
+            }
+
+            twr_sgp30_baseline_t baseline;
+
+            baseline.co2eq = (buffer[0] << 8) | buffer[1];
+            baseline.tvoc = (buffer[3] << 8) | buffer[4];
+            baseline.timestamp = _twr_sgp30_get_timestamp();
+
+            // Failed write is retried in the next interval, measurement goes on
+            twr_kv_set(self->_baseline_key, &baseline, sizeof(baseline));
+
+            self->_tick_baseline = twr_tick_get() + TWR_SGP30_BASELINE_INTERVAL;
+
             self->_state = TWR_SGP30_STATE_SET_HUMIDITY;
 
             twr_scheduler_plan_current_absolute(self->_tick_last_measurement + 1000);
@@ -355,3 +522,12 @@ static uint8_t _twr_sgp30_calculate_crc(uint8_t *buffer, size_t length)
 
     return crc;
 }
+
+static uint32_t _twr_sgp30_get_timestamp(void)
+{
+    struct timespec tv;
+
+    twr_rtc_get_timestamp_cached(&tv);
+
+    return (uint32_t) tv.tv_sec;
+}
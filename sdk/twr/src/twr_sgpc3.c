@@ -1,13 +1,16 @@
 #include <twr_sgpc3.h>
+#include <twr_kv.h>
 
 #define _TWR_SGPC3_DELAY_RUN 30
 #define _TWR_SGPC3_DELAY_INITIALIZE 500
 #define _TWR_SGPC3_DELAY_READ_FEATURE_SET 30
 #define _TWR_SGPC3_DELAY_SET_POWER_MODE 30
 #define _TWR_SGPC3_DELAY_INIT_AIR_QUALITY 30
+#define _TWR_SGPC3_DELAY_SET_BASELINE 30
 #define _TWR_SGPC3_DELAY_SET_HUMIDITY 30
 #define _TWR_SGPC3_DELAY_MEASURE_AIR_QUALITY 30
 #define _TWR_SGPC3_DELAY_READ_AIR_QUALITY 150
+#define _TWR_SGPC3_DELAY_READ_BASELINE 30
 
 static void _twr_sgpc3_task_interval(void *param);
 
@@ -15,6 +18,8 @@ static void _twr_sgpc3_task_measure(void *param);
 
 static uint8_t _twr_sgpc3_calculate_crc(uint8_t *buffer, size_t length);
 
+static twr_tick_t _twr_sgpc3_get_sampling_interval(twr_sgpc3_t *self);
+
 void twr_sgpc3_init(twr_sgpc3_t *self, twr_i2c_channel_t i2c_channel, uint8_t i2c_address)
 {
     memset(self, 0, sizeof(*self));
@@ -78,6 +83,30 @@ bool twr_sgpc3_measure(twr_sgpc3_t *self)
     return true;
 }
 
+void twr_sgpc3_set_power_mode(twr_sgpc3_t *self, twr_sgpc3_power_mode_t mode)
+{
+    if (self->_power_mode == mode)
+    {
+        return;
+    }
+
+    self->_power_mode = mode;
+
+    self->_state = TWR_SGPC3_STATE_INITIALIZE;
+
+    twr_scheduler_plan_from_now(self->_task_id_measure, _TWR_SGPC3_DELAY_RUN);
+}
+
+void twr_sgpc3_set_baseline_key(twr_sgpc3_t *self, uint16_t key)
+{
+    self->_baseline_key_enabled = true;
+    self->_baseline_key = key;
+
+    size_t length = sizeof(self->_baseline);
+
+    self->_baseline_valid = twr_kv_get(key, &self->_baseline, &length) && (length == sizeof(self->_baseline));
+}
+
 bool twr_sgpc3_get_tvoc_ppb(twr_sgpc3_t *self, uint16_t *ppb)
 {
     if (!self->_measurement_valid)
@@ -110,6 +139,12 @@ float twr_sgpc3_set_compensation(twr_sgpc3_t *self, float *t_celsius, float *rh_
     return ah;
 }
 
+void twr_sgpc3_set_compensation_source(twr_sgpc3_t *self, bool (*source)(void *, float *, float *), void *param)
+{
+    self->_compensation_source = source;
+    self->_compensation_param = param;
+}
+
 static void _twr_sgpc3_task_interval(void *param)
 {
     twr_sgpc3_t *self = param;
@@ -164,7 +199,7 @@ start:
 
             self->_state = TWR_SGPC3_STATE_READ_FEATURE_SET;
 
-            twr_scheduler_plan_current_from_now(_TWR_SGPC3_DELAY_SET_POWER_MODE);
+            twr_scheduler_plan_current_from_now(_TWR_SGPC3_DELAY_READ_FEATURE_SET);
 
             return;
         }
@@ -177,7 +212,7 @@ start:
             buffer[0] = 0x20;
             buffer[1] = 0x9f;
             buffer[2] = 0x00;
-            buffer[3] = 0x00;
+            buffer[3] = self->_power_mode;
             buffer[4] = _twr_sgpc3_calculate_crc(&buffer[2], 2);
 
             twr_i2c_transfer_t transfer;
@@ -191,9 +226,9 @@ start:
                 goto start;
             }
 
-            self->_state = TWR_SGPC3_STATE_READ_FEATURE_SET;
+            self->_state = TWR_SGPC3_STATE_INIT_AIR_QUALITY;
 
-            twr_scheduler_plan_current_from_now(_TWR_SGPC3_DELAY_READ_FEATURE_SET);
+            twr_scheduler_plan_current_from_now(_TWR_SGPC3_DELAY_INIT_AIR_QUALITY);
 
             return;
         }
@@ -224,9 +259,9 @@ start:
                 goto start;
             }
 
-            self->_state = TWR_SGPC3_STATE_INIT_AIR_QUALITY;
+            self->_state = TWR_SGPC3_STATE_SET_POWER_MODE;
 
-            twr_scheduler_plan_current_from_now(_TWR_SGPC3_DELAY_INIT_AIR_QUALITY);
+            twr_scheduler_plan_current_from_now(_TWR_SGPC3_DELAY_SET_POWER_MODE);
 
             return;
         }
@@ -234,12 +269,56 @@ start:
         {
             self->_state = TWR_SGPC3_STATE_ERROR;
 
-            static const uint8_t buffer[] = { 0x20, 0xae };
+            // Restored baseline makes preheating of continuous initialization unnecessary
+            uint8_t buffer[2];
+
+            buffer[0] = 0x20;
+            buffer[1] = self->_baseline_valid ? 0x89 : 0xae;
 
             twr_i2c_transfer_t transfer;
 
             transfer.device_address = self->_i2c_address;
-            transfer.buffer = (uint8_t *) buffer;
+            transfer.buffer = buffer;
+            transfer.length = sizeof(buffer);
+
+            if (!twr_i2c_write(self->_i2c_channel, &transfer))
+            {
+                goto start;
+            }
+
+            self->_tick_baseline_save = twr_scheduler_get_spin_tick() + TWR_SGPC3_BASELINE_SAVE_INTERVAL;
+
+            if (self->_baseline_valid)
+            {
+                self->_state = TWR_SGPC3_STATE_SET_BASELINE;
+
+                twr_scheduler_plan_current_from_now(_TWR_SGPC3_DELAY_SET_BASELINE);
+            }
+            else
+            {
+                self->_state = TWR_SGPC3_STATE_SET_HUMIDITY;
+
+                twr_scheduler_plan_current_from_now(_TWR_SGPC3_DELAY_SET_HUMIDITY);
+            }
+
+            return;
+        }
+        case TWR_SGPC3_STATE_SET_BASELINE:
+        {
+            self->_state = TWR_SGPC3_STATE_ERROR;
+
+            uint8_t buffer[5];
+
+            buffer[0] = 0x20;
+            buffer[1] = 0x1e;
+            buffer[2] = self->_baseline >> 8;
+            buffer[3] = self->_baseline;
+            buffer[4] = _twr_sgpc3_calculate_crc(&buffer[2], 2);
+
+            twr_i2c_transfer_t transfer;
+
+            transfer.device_address = self->_i2c_address;
+            transfer.buffer = buffer;
             transfer.length = sizeof(buffer);
 
             if (!twr_i2c_write(self->_i2c_channel, &transfer))
@@ -257,6 +336,14 @@ start:
         {
             self->_state = TWR_SGPC3_STATE_ERROR;
 
+            float t_celsius;
+            float rh_percentage;
+
+            if (self->_compensation_source != NULL && self->_compensation_source(self->_compensation_param, &t_celsius, &rh_percentage))
+            {
+                twr_sgpc3_set_compensation(self, &t_celsius, &rh_percentage);
+            }
+
             uint8_t buffer[5];
 
             buffer[0] = 0x20;
@@ -333,9 +420,76 @@ start:
 
             self->_measurement_valid = true;
 
+            if (self->_baseline_key_enabled && twr_scheduler_get_spin_tick() >= self->_tick_baseline_save)
+            {
+                self->_state = TWR_SGPC3_STATE_GET_BASELINE;
+
+                goto start;
+            }
+
+            self->_state = TWR_SGPC3_STATE_SET_HUMIDITY;
+
+            twr_scheduler_plan_current_absolute(self->_tick_last_measurement + _twr_sgpc3_get_sampling_interval(self));
+
+            return;
+        }
+        case TWR_SGPC3_STATE_GET_BASELINE:
+        {
+            self->_state = TWR_SGPC3_STATE_ERROR;
+
+            static const uint8_t buffer[] = { 0x20, 0x15 };
+
+            twr_i2c_transfer_t transfer;
+
+            transfer.device_address = self->_i2c_address;
+            transfer.buffer = (uint8_t *) buffer;
+            transfer.length = sizeof(buffer);
+
+            if (!twr_i2c_write(self->_i2c_channel, &transfer))
+            {
+                goto start;
+            }
+
+            self->_state = TWR_SGPC3_STATE_READ_BASELINE;
+
+            twr_scheduler_plan_current_from_now(_TWR_SGPC3_DELAY_READ_BASELINE);
+
+            return;
+        }
+        case TWR_SGPC3_STATE_READ_BASELINE:
+        {
+            self->_state = TWR_SGPC3_STATE_ERROR;
+
+            uint8_t buffer[3];
+
+            twr_i2c_transfer_t transfer;
+
+            transfer.device_address = self->_i2c_address;
+            transfer.buffer = buffer;
+            transfer.length = sizeof(buffer);
+
+            if (!twr_i2c_read(self->_i2c_channel, &transfer))
+            {
+                goto start;
+            }
+
+            if (_twr_sgpc3_calculate_crc(&buffer[0], 3) != 0)
+            {
+                goto start;
+            }
+
+            self->_baseline = (buffer[0] << 8) | buffer[1];
+
+            self->_baseline_valid = true;
+
+            // Store skips value equal to the stored one, so EEPROM is written only when baseline moves
+            twr_kv_set(self->_baseline_key, &self->_baseline, sizeof(self->_baseline));
+
+            self->_tick_baseline_save += TWR_SGPC3_BASELINE_SAVE_INTERVAL;
+
             self->_state = TWR_SGPC3_STATE_SET_HUMIDITY;
 
-            twr_scheduler_plan_current_absolute(self->_tick_last_measurement + 30000);
+            twr_scheduler_plan_current_absolute(self->_tick_last_measurement + _twr_sgpc3_get_sampling_interval(self));
 
             return;
         }
@@ -348,6 +502,11 @@ start:
     }
 }
 
+static twr_tick_t _twr_sgpc3_get_sampling_interval(twr_sgpc3_t *self)
+{
+    return self->_power_mode == TWR_SGPC3_POWER_MODE_LOW ? 2000 : 30000;
+}
+
 static uint8_t _twr_sgpc3_calculate_crc(uint8_t *buffer, size_t length)
 {
     uint8_t crc = 0xff;
@@ -2,13 +2,40 @@
 
 #define _TWR_SHA256_RL(a, b) (((a) << (b)) | ((a) >> (32 - (b))))
 #define _TWR_SHA256_RR(a, b) (((a) >> (b)) | ((a) << (32 - (b))))
-#define _TWR_SHA256_CH(x, y, z) (((x) & (y)) ^ (~(x) & (z)))
-#define _TWR_SHA256_MAJ(x, y, z) (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+#define _TWR_SHA256_CH(x, y, z) ((z) ^ ((x) & ((y) ^ (z))))
+#define _TWR_SHA256_MAJ(x, y, z) (((x) & (y)) | ((z) & ((x) | (y))))
 #define _TWR_SHA256_EP0(x) (_TWR_SHA256_RR(x, 2) ^ _TWR_SHA256_RR(x, 13) ^ _TWR_SHA256_RR(x, 22))
 #define _TWR_SHA256_EP1(x) (_TWR_SHA256_RR(x, 6) ^ _TWR_SHA256_RR(x, 11) ^ _TWR_SHA256_RR(x, 25))
 #define _TWR_SHA256_SIG0(x) (_TWR_SHA256_RR(x, 7) ^ _TWR_SHA256_RR(x, 18) ^ ((x) >> 3))
 #define _TWR_SHA256_SIG1(x) (_TWR_SHA256_RR(x, 17) ^ _TWR_SHA256_RR(x, 19) ^ ((x) >> 10))
 
+// Message schedule kept in ring of 16 words
+#define _TWR_SHA256_M(i) (m[(i) & 15] += _TWR_SHA256_SIG1(m[((i) - 2) & 15]) + m[((i) - 7) & 15] + _TWR_SHA256_SIG0(m[((i) - 15) & 15]))
+
+// Round renames working variables instead of moving them
+#define _TWR_SHA256_ROUND(a, b, c, d, e, f, g, h, i, w) \
+    do \
+    { \
+        uint32_t t1 = h + _TWR_SHA256_EP1(e) + _TWR_SHA256_CH(e, f, g) + _twr_sha256_k[i] + (w); \
+        d += t1; \
+        h = t1 + _TWR_SHA256_EP0(a) + _TWR_SHA256_MAJ(a, b, c); \
+    } while (0)
+
+#define _TWR_SHA256_ROUND8(i, w) \
+    do \
+    { \
+        _TWR_SHA256_ROUND(a, b, c, d, e, f, g, h, (i) + 0, w((i) + 0)); \
+        _TWR_SHA256_ROUND(h, a, b, c, d, e, f, g, (i) + 1, w((i) + 1)); \
+        _TWR_SHA256_ROUND(g, h, a, b, c, d, e, f, (i) + 2, w((i) + 2)); \
+        _TWR_SHA256_ROUND(f, g, h, a, b, c, d, e, (i) + 3, w((i) + 3)); \
+        _TWR_SHA256_ROUND(e, f, g, h, a, b, c, d, (i) + 4, w((i) + 4)); \
+        _TWR_SHA256_ROUND(d, e, f, g, h, a, b, c, (i) + 5, w((i) + 5)); \
+        _TWR_SHA256_ROUND(c, d, e, f, g, h, a, b, (i) + 6, w((i) + 6)); \
+        _TWR_SHA256_ROUND(b, c, d, e, f, g, h, a, (i) + 7, w((i) + 7)); \
+    } while (0)
+
+#define _TWR_SHA256_W(i) m[(i) & 15]
+
 static const uint32_t _twr_sha256_k[64] =
 {
     0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
@@ -41,9 +68,34 @@ void twr_sha256_update(twr_sha256_t *self, const void *buffer, size_t length)
 {
     const uint8_t *p = buffer;
 
-    for (size_t i = 0; i < length; i++)
+    while (length > 0)
     {
-        self->_buffer[self->_length++] = p[i];
+        // Whole blocks are transformed right from the source
+        if (self->_length == 0 && length >= 64)
+        {
+            _twr_sha256_transform(self, p);
+
+            self->_bit_length += 512;
+
+            p += 64;
+            length -= 64;
+
+            continue;
+        }
+
+        size_t chunk = 64 - self->_length;
+
+        if (chunk > length)
+        {
+            chunk = length;
+        }
+
+        memcpy(&self->_buffer[self->_length], p, chunk);
+
+        self->_length += chunk;
+
+        p += chunk;
+        length -= chunk;
 
         if (self->_length == 64)
         {
@@ -127,18 +179,11 @@ void twr_sha256_final(twr_sha256_t *self, uint8_t *hash, bool little_endian)
 
 static void _twr_sha256_transform(twr_sha256_t *self, const uint8_t *buffer)
 {
-    uint32_t a, b, c, d, e, f, g, h, t1, t2, m[64];
-
-    size_t i, j;
+    uint32_t a, b, c, d, e, f, g, h, m[16];
 
-    for (i = 0, j = 0; i < 16; i++, j += 4)
+    for (size_t i = 0; i < 16; i++, buffer += 4)
     {
-        m[i] = buffer[j] << 24 | buffer[j + 1] << 16 | buffer[j + 2] << 8 | buffer[j + 3];
-    }
-
-    for (; i < 64; i++)
-    {
-        m[i] = _TWR_SHA256_SIG1(m[i - 2]) + m[i - 7] + _TWR_SHA256_SIG0(m[i - 15]) + m[i - 16];
+        m[i] = (uint32_t) buffer[0] << 24 | (uint32_t) buffer[1] << 16 | (uint32_t) buffer[2] << 8 | buffer[3];
     }
 
     a = self->_state[0];
@@ -150,18 +195,14 @@ static void _twr_sha256_transform(twr_sha256_t *self, const uint8_t *buffer)
     g = self->_state[6];
     h = self->_state[7];
 
-    for (i = 0; i < 64; i++)
+    _TWR_SHA256_ROUND8(0, _TWR_SHA256_W);
+    _TWR_SHA256_ROUND8(8, _TWR_SHA256_W);
+
+    // Loop over unrolled rounds keeps code size within reach of M0+ flash
+    for (size_t i = 16; i < 64; i += 16)
     {
-        t1 = h + _TWR_SHA256_EP1(e) + _TWR_SHA256_CH(e, f, g) + _twr_sha256_k[i] + m[i];
-        t2 = _TWR_SHA256_EP0(a) + _TWR_SHA256_MAJ(a, b, c);
-        h = g;
-        g = f;
-        f = e;
-        e = d + t1;
-        d = c;
-        c = b;
-        b = a;
-        a = t1 + t2;
+        _TWR_SHA256_ROUND8(i, _TWR_SHA256_M);
+        _TWR_SHA256_ROUND8(i + 8, _TWR_SHA256_M);
     }
 
     self->_state[0] += a;
@@ -11,6 +11,8 @@ static void _twr_sht20_task_measure(void *param);
 
 static bool _twr_sht20_write(twr_sht20_t *self, const uint8_t data);
 
+static twr_i2c_async_t *_twr_sht20_read_transaction(twr_sht20_t *self);
+
 // TODO SHT20 has only one fixed address so it is no necessary to pass it as parameter
 
 void twr_sht20_init(twr_sht20_t *self, twr_i2c_channel_t i2c_channel, uint8_t i2c_address)
@@ -178,148 +180,99 @@ static void _twr_sht20_task_measure(void *param)
 {
     twr_sht20_t *self = param;
 
-start:
+    TWR_COROUTINE_BEGIN(&self->_coroutine);
 
-    switch (self->_state)
+    if (!_twr_sht20_write(self, 0xfe))
     {
-        case TWR_SHT20_STATE_ERROR:
-        {
-            self->_humidity_valid = false;
-            self->_temperature_valid = false;
+        goto error;
+    }
 
-            self->_measurement_active = false;
+    self->_tick_ready = twr_tick_get() + _TWR_SHT20_DELAY_INITIALIZATION;
 
-            if (self->_event_handler != NULL)
-            {
-                self->_event_handler(self, TWR_SHT20_EVENT_ERROR, self->_event_param);
-            }
+    if (self->_measurement_active)
+    {
+        twr_scheduler_plan_current_absolute(self->_tick_ready);
+    }
 
-            self->_state = TWR_SHT20_STATE_INITIALIZE;
+    // Continued by twr_sht20_measure
+    TWR_COROUTINE_SUSPEND(&self->_coroutine);
 
-            return;
-        }
-        case TWR_SHT20_STATE_INITIALIZE:
+    while (true)
+    {
+        if (!_twr_sht20_write(self, 0xf5))
         {
-            self->_state = TWR_SHT20_STATE_ERROR;
-
-            if (!_twr_sht20_write(self, 0xfe))
-            {
-                goto start;
-            }
-
-            self->_state = TWR_SHT20_STATE_MEASURE_RH;
-
-            self->_tick_ready = twr_tick_get() + _TWR_SHT20_DELAY_INITIALIZATION;
-
-            if (self->_measurement_active)
-            {
-                twr_scheduler_plan_current_absolute(self->_tick_ready);
-            }
-
-            return;
+            goto error;
         }
-        case TWR_SHT20_STATE_MEASURE_RH:
-        {
-            self->_state = TWR_SHT20_STATE_ERROR;
-
-            if (!_twr_sht20_write(self, 0xf5))
-            {
-                goto start;
-            }
 
-            self->_state = TWR_SHT20_STATE_READ_RH;
+        TWR_COROUTINE_WAIT_MS(&self->_coroutine, _TWR_SHT20_DELAY_MEASUREMENT_RH);
 
-            twr_scheduler_plan_current_from_now(_TWR_SHT20_DELAY_MEASUREMENT_RH);
+        TWR_COROUTINE_AWAIT_I2C(&self->_coroutine, self->_i2c_channel, _twr_sht20_read_transaction(self));
 
-            return;
-        }
-        case TWR_SHT20_STATE_READ_RH:
+        if (!twr_coroutine_get_result(&self->_coroutine))
         {
-            self->_state = TWR_SHT20_STATE_ERROR;
-
-            uint8_t buffer[2];
-
-            twr_i2c_transfer_t transfer;
+            goto error;
+        }
 
-            transfer.device_address = self->_i2c_address;
-            transfer.buffer = buffer;
-            transfer.length = sizeof(buffer);
+        self->_reg_humidity = self->_buffer[0] << 8 | self->_buffer[1];
+        self->_reg_humidity &= ~0x3;
 
-            if (!twr_i2c_read(self->_i2c_channel, &transfer))
-            {
-                goto start;
-            }
+        self->_humidity_valid = true;
 
-            self->_reg_humidity = buffer[0] << 8 | buffer[1];
-            self->_reg_humidity &= ~0x3;
+        if (!_twr_sht20_write(self, 0xf3))
+        {
+            goto error;
+        }
 
-            self->_humidity_valid = true;
+        TWR_COROUTINE_WAIT_MS(&self->_coroutine, _TWR_SHT20_DELAY_MEASUREMENT_T);
 
-            self->_state = TWR_SHT20_STATE_MEASURE_T;
+        TWR_COROUTINE_AWAIT_I2C(&self->_coroutine, self->_i2c_channel, _twr_sht20_read_transaction(self));
 
-            goto start;
-        }
-        case TWR_SHT20_STATE_MEASURE_T:
+        if (!twr_coroutine_get_result(&self->_coroutine))
         {
-            self->_state = TWR_SHT20_STATE_ERROR;
+            goto error;
+        }
 
-            if (!_twr_sht20_write(self, 0xf3))
-            {
-                goto start;
-            }
+        self->_reg_temperature = self->_buffer[0] << 8 | self->_buffer[1];
+        self->_reg_temperature &= ~0x3;
 
-            self->_state = TWR_SHT20_STATE_READ_T;
+        self->_temperature_valid = true;
 
-            twr_scheduler_plan_current_from_now(_TWR_SHT20_DELAY_MEASUREMENT_T);
+        self->_measurement_active = false;
 
-            return;
-        }
-        case TWR_SHT20_STATE_READ_T:
+        if (self->_event_handler != NULL)
         {
-            self->_state = TWR_SHT20_STATE_ERROR;
-
-            uint8_t buffer[2];
-
-            twr_i2c_transfer_t transfer;
-
-            transfer.device_address = self->_i2c_address;
-            transfer.buffer = buffer;
-            transfer.length = sizeof(buffer);
+            self->_event_handler(self, TWR_SHT20_EVENT_UPDATE, self->_event_param);
+        }
 
-            if (!twr_i2c_read(self->_i2c_channel, &transfer))
-            {
-                goto start;
-            }
+        TWR_COROUTINE_SUSPEND(&self->_coroutine);
+    }
 
-            self->_reg_temperature = buffer[0] << 8 | buffer[1];
-            self->_reg_temperature &= ~0x3;
+error:
 
-            self->_temperature_valid = true;
+    self->_humidity_valid = false;
+    self->_temperature_valid = false;
 
-            self->_state = TWR_SHT20_STATE_UPDATE;
+    self->_measurement_active = false;
 
-            goto start;
-        }
-        case TWR_SHT20_STATE_UPDATE:
-        {
-            self->_measurement_active = false;
+    if (self->_event_handler != NULL)
+    {
+        self->_event_handler(self, TWR_SHT20_EVENT_ERROR, self->_event_param);
+    }
 
-            if (self->_event_handler != NULL)
-            {
-                self->_event_handler(self, TWR_SHT20_EVENT_UPDATE, self->_event_param);
-            }
+    // Initialization is run again by the next measurement
+    TWR_COROUTINE_RESTART(&self->_coroutine);
 
-            self->_state = TWR_SHT20_STATE_MEASURE_RH;
+    TWR_COROUTINE_END(&self->_coroutine);
+}
 
-            return;
-        }
-        default:
-        {
-            self->_state = TWR_SHT20_STATE_ERROR;
+static twr_i2c_async_t *_twr_sht20_read_transaction(twr_sht20_t *self)
+{
+    self->_transaction.type = TWR_I2C_ASYNC_READ;
+    self->_transaction.device_address = self->_i2c_address;
+    self->_transaction.buffer = self->_buffer;
+    self->_transaction.length = sizeof(self->_buffer);
 
-            goto start;
-        }
-    }
+    return &self->_transaction;
 }
 
 static bool _twr_sht20_write(twr_sht20_t *self, const uint8_t data)
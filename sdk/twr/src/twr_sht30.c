@@ -1,16 +1,57 @@
 #include <twr_sht30.h>
 #include <twr_crc.h>
 #include <twr_log.h>
+#include <twr_timer.h>
 
 #define _TWR_SHT30_DELAY_RUN 20
 #define _TWR_SHT30_DELAY_INITIALIZATION 50
 #define _TWR_SHT30_DELAY_MEASUREMENT 20
 
-static void _twr_sht30_task_interval(void *param);
+#define _TWR_SHT30_COMMAND_SOFT_RESET 0x30a2
+#define _TWR_SHT30_COMMAND_BREAK 0x3093
+#define _TWR_SHT30_COMMAND_FETCH_DATA 0xe000
+#define _TWR_SHT30_COMMAND_ART 0x2b32
 
-static void _twr_sht30_task_measure(void *param);
+// Measurement commands by mode and repeatability (low, medium, high), single-shot ones with clock stretching
+static const uint16_t _twr_sht30_command[][3] =
+{
+    { 0x2c10, 0x2c0d, 0x2c06 },
+    { 0x202f, 0x2024, 0x2032 },
+    { 0x212d, 0x2126, 0x2130 },
+    { 0x222b, 0x2220, 0x2236 },
+    { 0x2329, 0x2322, 0x2334 },
+    { 0x272a, 0x2721, 0x2737 }
+};
+
+// Maximum single-shot conversion time by repeatability in milliseconds
+static const twr_tick_t _twr_sht30_conversion_time[3] = { 6, 8, 17 };
+
+// Period of measurements by mode in milliseconds
+static const twr_tick_t _twr_sht30_period[] = { 0, 2000, 1000, 500, 250, 100, 250 };
+
+static bool _twr_sht30_initialize(void *param);
+
+static bool _twr_sht30_trigger(void *param);
+
+static bool _twr_sht30_read(void *param);
 
-static bool _twr_sht30_write(twr_sht30_t *self, const uint16_t data);
+static void _twr_sht30_event(void *param, twr_sensor_event_t event);
+
+static bool _twr_sht30_write(twr_sht30_t *self, uint16_t command);
+
+static void _twr_sht30_stop(twr_sht30_t *self);
+
+static void _twr_sht30_reconfigure(twr_sht30_t *self);
+
+static const twr_sensor_descriptor_t _twr_sht30_descriptor =
+{
+    .initialize = _twr_sht30_initialize,
+    .initialization_time = _TWR_SHT30_DELAY_INITIALIZATION,
+    .trigger = _twr_sht30_trigger,
+    .conversion_time = _TWR_SHT30_DELAY_MEASUREMENT,
+    .read = _twr_sht30_read,
+    .event = _twr_sht30_event
+};
 
 void twr_sht30_init(twr_sht30_t *self, twr_i2c_channel_t i2c_channel, uint8_t i2c_address)
 {
@@ -18,20 +59,24 @@ void twr_sht30_init(twr_sht30_t *self, twr_i2c_channel_t i2c_channel, uint8_t i2
 
     self->_i2c_channel = i2c_channel;
     self->_i2c_address = i2c_address;
+    self->_repeatability = TWR_SHT30_REPEATABILITY_MEDIUM;
 
-    self->_task_id_interval = twr_scheduler_register(_twr_sht30_task_interval, self, TWR_TICK_INFINITY);
-    self->_task_id_measure = twr_scheduler_register(_twr_sht30_task_measure, self, _TWR_SHT30_DELAY_RUN);
+    twr_sensor_init(&self->_sensor, &_twr_sht30_descriptor, self, _TWR_SHT30_DELAY_RUN);
 
-    self->_tick_ready = _TWR_SHT30_DELAY_RUN;
+    _twr_sht30_reconfigure(self);
 
     twr_i2c_init(self->_i2c_channel, TWR_I2C_SPEED_400_KHZ);
+
+    twr_timer_init();
 }
 
 void twr_sht30_deinit(twr_sht30_t *self)
 {
-    _twr_sht30_write(self, 0xa230);
-    twr_scheduler_unregister(self->_task_id_interval);
-    twr_scheduler_unregister(self->_task_id_measure);
+    _twr_sht30_stop(self);
+
+    _twr_sht30_write(self, _TWR_SHT30_COMMAND_SOFT_RESET);
+
+    twr_sensor_unregister(&self->_sensor);
 }
 
 void twr_sht30_set_event_handler(twr_sht30_t *self, void (*event_handler)(twr_sht30_t *, twr_sht30_event_t, void *), void *event_param)
@@ -42,32 +87,26 @@ void twr_sht30_set_event_handler(twr_sht30_t *self, void (*event_handler)(twr_sh
 
 void twr_sht30_set_update_interval(twr_sht30_t *self, twr_tick_t interval)
 {
-    self->_update_interval = interval;
+    twr_sensor_set_update_interval(&self->_sensor, interval);
+}
 
-    if (self->_update_interval == TWR_TICK_INFINITY)
-    {
-        twr_scheduler_plan_absolute(self->_task_id_interval, TWR_TICK_INFINITY);
-    }
-    else
-    {
-        twr_scheduler_plan_relative(self->_task_id_interval, self->_update_interval);
+void twr_sht30_set_mode(twr_sht30_t *self, twr_sht30_mode_t mode)
+{
+    self->_mode = mode;
 
-        twr_sht30_measure(self);
-    }
+    _twr_sht30_reconfigure(self);
 }
 
-bool twr_sht30_measure(twr_sht30_t *self)
+void twr_sht30_set_repeatability(twr_sht30_t *self, twr_sht30_repeatability_t repeatability)
 {
-    if (self->_measurement_active)
-    {
-        return false;
-    }
+    self->_repeatability = repeatability;
 
-    self->_measurement_active = true;
-
-    twr_scheduler_plan_absolute(self->_task_id_measure, self->_tick_ready);
+    _twr_sht30_reconfigure(self);
+}
 
-    return true;
+bool twr_sht30_measure(twr_sht30_t *self)
+{
+    return twr_sensor_measure(&self->_sensor);
 }
 
 bool twr_sht30_get_humidity_raw(twr_sht30_t *self, uint16_t *raw)
@@ -164,135 +203,152 @@ bool twr_sht30_get_temperature_kelvin(twr_sht30_t *self, float *kelvin)
     return true;
 }
 
-static void _twr_sht30_task_interval(void *param)
+static bool _twr_sht30_initialize(void *param)
 {
     twr_sht30_t *self = param;
 
-    twr_sht30_measure(self);
+    // Soft reset is accepted in idle state only
+    _twr_sht30_stop(self);
 
-    twr_scheduler_plan_current_relative(self->_update_interval);
-}
+    if (!_twr_sht30_write(self, _TWR_SHT30_COMMAND_SOFT_RESET))
+    {
+        return false;
+    }
 
-static void _twr_sht30_task_measure(void *param)
-{
-    twr_sht30_t *self = param;
+    if (self->_mode == TWR_SHT30_MODE_SINGLE_SHOT)
+    {
+        return true;
+    }
 
-start:
+    // Sensor is ready 1 ms after soft reset
+    twr_timer_start();
 
-    switch (self->_state)
-    {
-        case TWR_SHT30_STATE_ERROR:
-        {
-            self->_humidity_valid = false;
-            self->_temperature_valid = false;
+    twr_timer_delay(1500);
 
-            self->_measurement_active = false;
+    twr_timer_stop();
 
-            if (self->_event_handler != NULL)
-            {
-                self->_event_handler(self, TWR_SHT30_EVENT_ERROR, self->_event_param);
-            }
+    uint16_t command = self->_mode == TWR_SHT30_MODE_ART ? _TWR_SHT30_COMMAND_ART : _twr_sht30_command[self->_mode][self->_repeatability];
 
-            self->_state = TWR_SHT30_STATE_INITIALIZE;
+    if (!_twr_sht30_write(self, command))
+    {
+        return false;
+    }
 
-            return;
-        }
-        case TWR_SHT30_STATE_INITIALIZE:
-        {
-            self->_state = TWR_SHT30_STATE_ERROR;
+    self->_periodic = true;
 
-            if (!_twr_sht30_write(self, 0xa230))
-            {
-                goto start;
-            }
+    // The first result comes after one period
+    twr_sensor_hold_read(&self->_sensor, twr_tick_get() + _TWR_SHT30_DELAY_INITIALIZATION + _twr_sht30_period[self->_mode]);
 
-            self->_state = TWR_SHT30_STATE_MEASURE;
+    return true;
+}
 
-            self->_tick_ready = twr_tick_get() + _TWR_SHT30_DELAY_INITIALIZATION;
+static bool _twr_sht30_trigger(void *param)
+{
+    twr_sht30_t *self = param;
 
-            if (self->_measurement_active)
-            {
-                twr_scheduler_plan_current_absolute(self->_tick_ready);
-            }
+    return _twr_sht30_write(self, _twr_sht30_command[TWR_SHT30_MODE_SINGLE_SHOT][self->_repeatability]);
+}
 
-            return;
-        }
-        case TWR_SHT30_STATE_MEASURE:
-        {
-            self->_state = TWR_SHT30_STATE_ERROR;
+static bool _twr_sht30_read(void *param)
+{
+    twr_sht30_t *self = param;
 
-            if (!_twr_sht30_write(self, 0x0d2c))
-            {
-                goto start;
-            }
+    uint8_t buffer[6];
 
-            self->_state = TWR_SHT30_STATE_READ;
+    twr_i2c_transfer_t transfer;
 
-            twr_scheduler_plan_current_from_now(_TWR_SHT30_DELAY_MEASUREMENT);
+    transfer.device_address = self->_i2c_address;
+    transfer.buffer = buffer;
+    transfer.length = sizeof(buffer);
 
-            return;
+    if (self->_periodic)
+    {
+        if (!_twr_sht30_write(self, _TWR_SHT30_COMMAND_FETCH_DATA))
+        {
+            return false;
         }
-        case TWR_SHT30_STATE_READ:
+
+        // Read is not acknowledged when no result has come since the last fetch, the previous one is current for one more period
+        if (!twr_i2c_read(self->_i2c_channel, &transfer))
         {
-            self->_state = TWR_SHT30_STATE_ERROR;
+            return self->_humidity_valid && twr_tick_get() < self->_tick_fetch + 2 * _twr_sht30_period[self->_mode];
+        }
 
-            uint8_t buffer[6];
+        self->_tick_fetch = twr_tick_get();
+    }
+    else if (!twr_i2c_read(self->_i2c_channel, &transfer))
+    {
+        return false;
+    }
 
-            twr_i2c_transfer_t transfer;
+    if ((twr_crc8(0x31, buffer, 2, 0xff) != buffer[2]) || (twr_crc8(0x31, buffer + 3, 2, 0xff) != buffer[5]))
+    {
+        return false;
+    }
 
-            transfer.device_address = self->_i2c_address;
-            transfer.buffer = buffer;
-            transfer.length = sizeof(buffer);
+    self->_reg_humidity = buffer[3] << 8 | buffer[4];
+    self->_reg_temperature = buffer[0] << 8 | buffer[1];
 
-            if (!twr_i2c_read(self->_i2c_channel, &transfer))
-            {
-                goto start;
-            }
+    self->_humidity_valid = true;
+    self->_temperature_valid = true;
 
-            if ((twr_crc8(0x31, buffer, 2, 0xff) != buffer[2]) || (twr_crc8(0x31, buffer + 3, 2, 0xff) != buffer[5]))
-            {
-                goto start;
-            }
+    return true;
+}
 
-            self->_reg_humidity = buffer[3] << 8 | buffer[4];
-            self->_reg_temperature = buffer[0] << 8 | buffer[1];
+static void _twr_sht30_event(void *param, twr_sensor_event_t event)
+{
+    twr_sht30_t *self = param;
 
-            self->_humidity_valid = true;
-            self->_temperature_valid = true;
+    if (event == TWR_SENSOR_EVENT_ERROR)
+    {
+        self->_humidity_valid = false;
+        self->_temperature_valid = false;
+    }
 
-            self->_state = TWR_SHT30_STATE_UPDATE;
+    if (self->_event_handler != NULL)
+    {
+        self->_event_handler(self, event == TWR_SENSOR_EVENT_ERROR ? TWR_SHT30_EVENT_ERROR : TWR_SHT30_EVENT_UPDATE, self->_event_param);
+    }
+}
 
-            goto start;
-        }
-        case TWR_SHT30_STATE_UPDATE:
-        {
-            self->_measurement_active = false;
+static bool _twr_sht30_write(twr_sht30_t *self, uint16_t command)
+{
+    uint8_t buffer[2] = { command >> 8, command };
 
-            if (self->_event_handler != NULL)
-            {
-                self->_event_handler(self, TWR_SHT30_EVENT_UPDATE, self->_event_param);
-            }
+    twr_i2c_transfer_t transfer;
 
-            self->_state = TWR_SHT30_STATE_MEASURE;
+    transfer.device_address = self->_i2c_address;
+    transfer.buffer = buffer;
+    transfer.length = sizeof(buffer);
 
-            return;
-        }
-        default:
-        {
-            self->_state = TWR_SHT30_STATE_ERROR;
+    return twr_i2c_write(self->_i2c_channel, &transfer);
+}
 
-            goto start;
-        }
+static void _twr_sht30_stop(twr_sht30_t *self)
+{
+    if (!self->_periodic)
+    {
+        return;
     }
+
+    self->_periodic = false;
+
+    // Sensor which has lost power is idle already and does not acknowledge
+    _twr_sht30_write(self, _TWR_SHT30_COMMAND_BREAK);
+
+    // Sensor returns to idle state 1 ms after break
+    twr_timer_start();
+
+    twr_timer_delay(1500);
+
+    twr_timer_stop();
 }
 
-static bool _twr_sht30_write(twr_sht30_t *self, const uint16_t data)
+static void _twr_sht30_reconfigure(twr_sht30_t *self)
 {
-    twr_i2c_transfer_t transfer;
+    // In periodic mode the last result is fetched without trigger
+    twr_sensor_set_conversion_time(&self->_sensor, self->_mode == TWR_SHT30_MODE_SINGLE_SHOT ? _twr_sht30_conversion_time[self->_repeatability] : 0);
 
-    transfer.device_address = self->_i2c_address;
-    transfer.buffer = (void *) &data;
-    transfer.length = sizeof(data);
-
-    return twr_i2c_write(self->_i2c_channel, &transfer);
+    // Mode is written again before next measurement
+    twr_sensor_reinitialize(&self->_sensor);
 }
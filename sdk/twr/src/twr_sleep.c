@@ -8,14 +8,14 @@ twr_sleep_manager_t sleep_manager = {
 
 void twr_sleep_disable(void)
 {
-    twr_irq_disable();
+    uint32_t primask = twr_irq_save();
     sleep_manager.disable_sleep_semaphore++;
-    twr_irq_enable();
+    twr_irq_restore(primask);
 }
 
 void twr_sleep_enable(void)
 {
-    twr_irq_disable();
+    uint32_t primask = twr_irq_save();
     sleep_manager.disable_sleep_semaphore--;
-    twr_irq_enable();
+    twr_irq_restore(primask);
 }
@@ -40,6 +40,8 @@ void twr_soil_sensor_init_multiple(twr_soil_sensor_t *self, twr_soil_sensor_sens
     self->_onewire = twr_module_sensor_get_onewire();
     twr_onewire_auto_ds28e17_sleep_mode(self->_onewire, true);
 
+    memset(sensors, 0, sizeof(*sensors) * sensor_count);
+
     self->_sensor = sensors;
     self->_sensor_count = sensor_count;
 
@@ -383,7 +385,15 @@ static void _twr_soil_sensor_task_measure(void *param)
 
             while ((self->_sensor_found < self->_sensor_count) && twr_onewire_search_next(self->_onewire, &device_address))
             {
-                twr_ds28e17_init(&self->_sensor[self->_sensor_found]._ds28e17, self->_onewire, device_address);
+                twr_soil_sensor_sensor_t *sensor = &self->_sensor[self->_sensor_found];
+
+                // EEPROM content stays cached while the same probe is found at the same position
+                if (sensor->_ds28e17._device_number != device_address)
+                {
+                    sensor->_eeprom_loaded = false;
+                }
+
+                twr_ds28e17_init(&sensor->_ds28e17, self->_onewire, device_address);
 
                 self->_sensor_found++;
             }
@@ -411,6 +421,11 @@ static void _twr_soil_sensor_task_measure(void *param)
 
             for (int i = 0; i < self->_sensor_found; i++)
             {
+                if (self->_sensor[i]._eeprom_loaded)
+                {
+                    continue;
+                }
+
                 twr_soil_sensor_error_t error = _twr_soil_sensor_eeprom_load(&self->_sensor[i]);
 
                 if (error)
@@ -426,6 +441,8 @@ static void _twr_soil_sensor_task_measure(void *param)
 
                     return;
                 }
+
+                self->_sensor[i]._eeprom_loaded = true;
             }
 
             for (int i = 0; i < self->_sensor_found; i++)
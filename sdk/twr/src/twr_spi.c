@@ -3,6 +3,7 @@
 #include <twr_dma.h>
 #include <twr_system.h>
 #include <twr_timer.h>
+#include <twr_irq.h>
 #include <stm32l0xx.h>
 
 #define _TWR_SPI_EVENT_CLEAR 0
@@ -41,6 +42,14 @@ static struct
     uint16_t cs_delay;
     uint16_t delay;
     uint16_t cs_quit;
+    twr_spi_transaction_t *queue_head;
+    twr_spi_transaction_t *queue_tail;
+    twr_spi_transaction_t *queue_current;
+    twr_spi_transaction_t *done_head;
+    twr_spi_transaction_t *done_tail;
+    bool queue_pll;
+    bool dma_allocated;
+    twr_dma_channel_t dma_channel;
 
 } _twr_spi;
 
@@ -57,10 +66,18 @@ static twr_dma_channel_config_t _twr_spi_dma_config =
 
 static uint8_t _twr_spi_transfer_byte(uint8_t value);
 
-static void _twr_spi_dma_event_handler(twr_dma_channel_t channel, twr_dma_event_t event, void *event_param);
+static void _twr_spi_dma_irq_handler(twr_dma_channel_t channel, twr_dma_event_t event, void *irq_param);
+
+static void _twr_spi_apply(twr_spi_speed_t speed, twr_spi_mode_t mode);
+
+static void _twr_spi_queue_start(bool irq);
+
+static void _twr_spi_queue_done(twr_spi_transaction_t *transaction);
 
 static void _twr_spi_task();
 
+TWR_SCHEDULER_TASK_STATIC(_twr_spi_task_static, _twr_spi_task, NULL);
+
 void twr_spi_init(twr_spi_speed_t speed, twr_spi_mode_t mode)
 {
     // If is already initilized ...
@@ -111,31 +128,23 @@ void twr_spi_init(twr_spi_speed_t speed, twr_spi_mode_t mode)
 
     twr_timer_init();
 
-    twr_dma_set_event_handler(TWR_DMA_CHANNEL_5, _twr_spi_dma_event_handler, NULL);
+    // Without DMA channel only blocking transfers are available
+    _twr_spi.dma_allocated = twr_dma_channel_allocate(TWR_DMA_LINE_SPI2_TX, &_twr_spi.dma_channel, &_twr_spi_dma_config.request);
+
+    if (_twr_spi.dma_allocated)
+    {
+        twr_dma_set_irq_handler(_twr_spi.dma_channel, _twr_spi_dma_irq_handler, NULL);
+    }
 
-    _twr_spi.task_id = twr_scheduler_register(_twr_spi_task, NULL, TWR_TICK_INFINITY);
+    _twr_spi.task_id = twr_scheduler_get_static_id(&_twr_spi_task_static);
 }
 
 void twr_spi_set_speed(twr_spi_speed_t speed)
 {
-    uint32_t cr1;
-
     // Store desired speed
     _twr_spi.speed = speed;
 
-    // Disable SPI
-    SPI2->CR1 &= ~SPI_CR1_SPE;
-
-    // Edit the registry image
-    cr1 = SPI2->CR1;
-    cr1 &= ~(SPI_CR1_BR_Msk | SPI_CR1_SPE);
-    cr1 |= _twr_spi_speed_table[speed];
-
-    // Update CR1
-    SPI2->CR1 = cr1;
-
-    // Enable SPI
-    SPI2->CR1 |= SPI_CR1_SPE;
+    _twr_spi_apply(_twr_spi.speed, _twr_spi.mode);
 }
 
 void twr_spi_set_timing(uint16_t cs_delay, uint16_t delay, uint16_t cs_quit)
@@ -154,24 +163,10 @@ twr_spi_speed_t twr_spi_get_speed(void)
 
 void twr_spi_set_mode(twr_spi_mode_t mode)
 {
-    uint32_t cr1;
-
     // Store desired mode
     _twr_spi.mode = mode;
 
-    // Disable SPI
-    SPI2->CR1 &= ~SPI_CR1_SPE;
-
-    // Edit the registry image
-    cr1 = SPI2->CR1;
-    cr1 &= ~(SPI_CR1_CPHA_Msk | SPI_CR1_CPOL_Msk | SPI_CR1_SPE);
-    cr1 |= _twr_spi_mode_table[mode];
-
-    // Update CR1
-    SPI2->CR1 = cr1;
-
-    // Enable SPI
-    SPI2->CR1 |= SPI_CR1_SPE;
+    _twr_spi_apply(_twr_spi.speed, _twr_spi.mode);
 }
 
 twr_spi_mode_t twr_spi_get_mode(void)
@@ -186,13 +181,13 @@ void twr_spi_set_manual_cs_control(bool manual_cs_control)
 
 bool twr_spi_is_ready(void)
 {
-	return (!_twr_spi.in_progress) && (_twr_spi.pending_event_done == _TWR_SPI_EVENT_CLEAR);
+	return (!_twr_spi.in_progress) && (_twr_spi.pending_event_done == _TWR_SPI_EVENT_CLEAR) && twr_spi_queue_is_empty();
 }
 
 bool twr_spi_transfer(const void *source, void *destination, size_t length)
 {
     // If another transfer cannot be executed ...
-    if (_twr_spi.in_progress == true)
+    if (_twr_spi.in_progress == true || !twr_spi_queue_is_empty())
     {
         // ... dont do it
         return false;
@@ -267,7 +262,7 @@ bool twr_spi_transfer(const void *source, void *destination, size_t length)
 bool twr_spi_async_transfer(const void *source, void *destination, size_t length, void (*event_handler)(twr_spi_event_t event, void *event_param), void (*event_param))
 {
     // If another transfer cannot be executed now ...
-    if((_twr_spi.in_progress == true) || (_twr_spi.pending_event_done != _TWR_SPI_EVENT_CLEAR))
+    if(!_twr_spi.dma_allocated || (_twr_spi.in_progress == true) || (_twr_spi.pending_event_done != _TWR_SPI_EVENT_CLEAR) || !twr_spi_queue_is_empty())
     {
         // ... dont do it
         return false;
@@ -303,8 +298,8 @@ bool twr_spi_async_transfer(const void *source, void *destination, size_t length
         // Setup DMA channel
         _twr_spi_dma_config.address_memory = (void *)source;
         _twr_spi_dma_config.length = length;
-        twr_dma_channel_config(TWR_DMA_CHANNEL_5, &_twr_spi_dma_config);
-        twr_dma_channel_run(TWR_DMA_CHANNEL_5);
+        twr_dma_channel_config(_twr_spi.dma_channel, &_twr_spi_dma_config);
+        twr_dma_channel_run(_twr_spi.dma_channel);
 
         return true;
     }
@@ -358,39 +353,280 @@ static uint8_t _twr_spi_transfer_byte(uint8_t value)
     return value;
 }
 
-static void _twr_spi_dma_event_handler(twr_dma_channel_t channel, twr_dma_event_t event, void *event_param)
+static void _twr_spi_dma_irq_handler(twr_dma_channel_t channel, twr_dma_event_t event, void *irq_param)
 {
-	(void) channel;
-	(void) event_param;
-
-	if (event == TWR_DMA_EVENT_DONE)
-	{
-	    // Update status
-	    _twr_spi.in_progress = false;
-	    _twr_spi.pending_event_done = true;
-
-	    GPIOB->BSRR = GPIO_BSRR_BS_12;
-
-	    // Plan task that call event handler
-	    twr_scheduler_plan_now(_twr_spi.task_id);
-	}
-	else if (event == TWR_DMA_EVENT_ERROR)
-	{
-	    twr_system_reset();
-	}
+    (void) channel;
+    (void) irq_param;
+
+    if (event == TWR_DMA_EVENT_ERROR)
+    {
+        twr_system_reset();
+    }
+
+    if (event != TWR_DMA_EVENT_DONE)
+    {
+        return;
+    }
+
+    // DMA is done once the last byte is written to data register, wait until it is shifted out
+    while ((SPI2->SR & SPI_SR_TXE) == 0)
+    {
+        continue;
+    }
+
+    while ((SPI2->SR & SPI_SR_BSY) != 0)
+    {
+        continue;
+    }
+
+    // Discard data received during transmit and clear overrun flag
+    (void) SPI2->DR;
+    (void) SPI2->SR;
+
+    if (_twr_spi.in_progress)
+    {
+        // Update status
+        _twr_spi.in_progress = false;
+        _twr_spi.pending_event_done = true;
+
+        GPIOB->BSRR = GPIO_BSRR_BS_12;
+
+        // Plan task that call event handler
+        twr_scheduler_plan_now(_twr_spi.task_id);
+
+        return;
+    }
+
+    twr_spi_transaction_t *transaction = _twr_spi.queue_current;
+
+    if (transaction == NULL)
+    {
+        return;
+    }
+
+    if (transaction->cs_set == NULL)
+    {
+        GPIOB->BSRR = GPIO_BSRR_BS_12;
+    }
+
+    _twr_spi.queue_current = NULL;
+
+    _twr_spi_queue_done(transaction);
+
+    // Chain next transaction without waiting for task
+    _twr_spi_queue_start(true);
+
+    twr_scheduler_plan_now(_twr_spi.task_id);
 }
 
 static void _twr_spi_task()
 {
-    // If is event handler valid ...
-    if (_twr_spi.event_handler != NULL)
+    if (_twr_spi.pending_event_done)
     {
-        // ... call event handler
-        _twr_spi.event_handler(TWR_SPI_EVENT_DONE, _twr_spi.event_param);
+        // If is event handler valid ...
+        if (_twr_spi.event_handler != NULL)
+        {
+            // ... call event handler
+            _twr_spi.event_handler(TWR_SPI_EVENT_DONE, _twr_spi.event_param);
+        }
 
         // Disable PLL and enable sleep
         twr_system_pll_disable();
+
+        _twr_spi.pending_event_done = false;
+    }
+
+    while (true)
+    {
+        twr_irq_disable();
+
+        twr_spi_transaction_t *transaction = _twr_spi.done_head;
+
+        if (transaction != NULL)
+        {
+            _twr_spi.done_head = transaction->_next;
+        }
+
+        twr_irq_enable();
+
+        if (transaction == NULL)
+        {
+            break;
+        }
+
+        if (transaction->cs_set != NULL)
+        {
+            transaction->cs_set(false, transaction->event_param);
+        }
+
+        if (transaction->event_handler != NULL)
+        {
+            transaction->event_handler(transaction->_error ? TWR_SPI_EVENT_ERROR : TWR_SPI_EVENT_DONE, transaction->event_param);
+        }
+    }
+
+    if (_twr_spi.queue_current != NULL || _twr_spi.in_progress)
+    {
+        return;
+    }
+
+    if (_twr_spi.queue_head != NULL)
+    {
+        _twr_spi_queue_start(false);
+    }
+    else if (_twr_spi.queue_pll)
+    {
+        // Queue is drained, restore configuration of blocking transfers
+        _twr_spi_apply(_twr_spi.speed, _twr_spi.mode);
+
+        _twr_spi.queue_pll = false;
+
+        // Disable PLL and enable sleep
+        twr_system_pll_disable();
+    }
+}
+
+bool twr_spi_submit(twr_spi_transaction_t *transaction)
+{
+    if (!_twr_spi.initilized || !_twr_spi.dma_allocated || transaction->length == 0)
+    {
+        return false;
+    }
+
+    transaction->_next = NULL;
+    transaction->_error = false;
+
+    twr_irq_disable();
+
+    if (_twr_spi.queue_head == NULL)
+    {
+        _twr_spi.queue_head = transaction;
+    }
+    else
+    {
+        _twr_spi.queue_tail->_next = transaction;
+    }
+
+    _twr_spi.queue_tail = transaction;
+
+    bool idle = _twr_spi.queue_current == NULL && !_twr_spi.in_progress && _twr_spi.pending_event_done == _TWR_SPI_EVENT_CLEAR;
+
+    twr_irq_enable();
+
+    if (idle)
+    {
+        _twr_spi_queue_start(false);
+    }
+
+    return true;
+}
+
+bool twr_spi_queue_is_empty(void)
+{
+    return _twr_spi.queue_head == NULL && _twr_spi.queue_current == NULL && _twr_spi.done_head == NULL && !_twr_spi.queue_pll;
+}
+
+static void _twr_spi_apply(twr_spi_speed_t speed, twr_spi_mode_t mode)
+{
+    uint32_t cr1;
+
+    // Disable SPI
+    SPI2->CR1 &= ~SPI_CR1_SPE;
+
+    // Edit the registry image
+    cr1 = SPI2->CR1;
+    cr1 &= ~(SPI_CR1_BR_Msk | SPI_CR1_CPHA_Msk | SPI_CR1_CPOL_Msk | SPI_CR1_SPE);
+    cr1 |= _twr_spi_speed_table[speed] | _twr_spi_mode_table[mode];
+
+    // Update CR1
+    SPI2->CR1 = cr1;
+
+    // Enable SPI
+    SPI2->CR1 |= SPI_CR1_SPE;
+}
+
+static void _twr_spi_queue_start(bool irq)
+{
+    while (true)
+    {
+        twr_irq_disable();
+
+        twr_spi_transaction_t *transaction = _twr_spi.queue_head;
+
+        // Chip select by function has to be done from task
+        if (transaction == NULL || (irq && transaction->cs_set != NULL))
+        {
+            twr_irq_enable();
+
+            return;
+        }
+
+        _twr_spi.queue_head = transaction->_next;
+
+        _twr_spi.queue_current = transaction;
+
+        twr_irq_enable();
+
+        if (!_twr_spi.queue_pll)
+        {
+            // Enable PLL and disable sleep
+            twr_system_pll_enable();
+
+            _twr_spi.queue_pll = true;
+        }
+
+        if (transaction->cs_set != NULL)
+        {
+            if (!transaction->cs_set(true, transaction->event_param))
+            {
+                transaction->_error = true;
+
+                twr_irq_disable();
+
+                _twr_spi.queue_current = NULL;
+
+                _twr_spi_queue_done(transaction);
+
+                twr_irq_enable();
+
+                twr_scheduler_plan_now(_twr_spi.task_id);
+
+                continue;
+            }
+        }
+        else
+        {
+            // Set CS to active level
+            GPIOB->BSRR = GPIO_BSRR_BR_12;
+        }
+
+        _twr_spi_apply(transaction->speed, transaction->mode);
+
+        // Enable TX DMA request
+        SPI2->CR2 |= SPI_CR2_TXDMAEN;
+
+        // Setup DMA channel
+        _twr_spi_dma_config.address_memory = (void *) transaction->source;
+        _twr_spi_dma_config.length = transaction->length;
+        twr_dma_channel_config(_twr_spi.dma_channel, &_twr_spi_dma_config);
+        twr_dma_channel_run(_twr_spi.dma_channel);
+
+        return;
+    }
+}
+
+static void _twr_spi_queue_done(twr_spi_transaction_t *transaction)
+{
+    transaction->_next = NULL;
+
+    if (_twr_spi.done_head == NULL)
+    {
+        _twr_spi.done_head = transaction;
+    }
+    else
+    {
+        _twr_spi.done_tail->_next = transaction;
     }
 
-    _twr_spi.pending_event_done = false;
+    _twr_spi.done_tail = transaction;
 }
@@ -3,6 +3,8 @@
 #include <twr_exti.h>
 #include <twr_system.h>
 #include <twr_timer.h>
+#include <twr_dma.h>
+#include <twr_trace.h>
 #include <stm32l0xx.h>
 #include <SPIRIT_Config.h>
 #include <SDK_Configuration_Common.h>
@@ -17,6 +19,8 @@ typedef enum
 
 } twr_spirit1_state_t;
 
+#define _TWR_SPIRIT1_SHADOW_SIZE (0x70 + 4)
+
 typedef struct
 {
     int initialized_semaphore;
@@ -32,11 +36,31 @@ typedef struct
     int rx_rssi;
     twr_tick_t rx_timeout;
     twr_tick_t rx_tick_timeout;
+    twr_tick_t state_tick;
+    twr_spirit1_stats_t stats;
+#if TWR_SPIRIT1_SHADOW
+    uint8_t shadow[_TWR_SPIRIT1_SHADOW_SIZE];
+    uint32_t shadow_valid[(_TWR_SPIRIT1_SHADOW_SIZE + 31) / 32];
+    uint16_t shadow_status;
+#endif
 
 } twr_spirit1_t;
 
 static twr_spirit1_t _twr_spirit1;
 
+static const struct
+{
+    uint32_t datarate;
+    uint32_t deviation;
+    uint32_t bandwidth;
+
+} _twr_spirit1_profile[] =
+{
+    [TWR_SPIRIT1_PROFILE_19200] = { 19200, 20000, 100000 },
+    [TWR_SPIRIT1_PROFILE_38400] = { 38400, 20000, 100000 },
+    [TWR_SPIRIT1_PROFILE_100000] = { 100000, 50000, 250000 }
+};
+
 #define XTAL_FREQUENCY 50000000
 
 SRadioInit xRadioInit = {
@@ -83,10 +107,12 @@ static void _twr_spirit1_check_state_tx(void);
 static void _twr_spirit1_enter_state_rx(void);
 static void _twr_spirit1_check_state_rx(void);
 static void _twr_spirit1_enter_state_sleep(void);
+static void _twr_spirit1_account_state(twr_spirit1_stats_t *stats, twr_tick_t now);
 
 void twr_spirit1_hal_chip_select_low(void);
 void twr_spirit1_hal_chip_select_high(void);
 uint8_t twr_spirit1_hal_transfer_byte(uint8_t value);
+static bool twr_spirit1_hal_transfer_burst(const uint8_t *tx_buffer, uint8_t *rx_buffer, size_t length);
 static void twr_spirit1_hal_init_gpio(void);
 static void twr_spirit1_hal_deinit_gpio(void);
 static void twr_spirit1_hal_init_spi(void);
@@ -95,6 +121,12 @@ static void twr_spirit1_hal_deinit_spi(void);
 static void _twr_spirit1_task(void *param);
 static void _twr_spirit1_interrupt(twr_exti_line_t line, void *param);
 
+#if TWR_SPIRIT1_SHADOW
+static bool _twr_spirit1_shadow_load(uint8_t address, uint8_t *buffer, size_t length);
+static bool _twr_spirit1_shadow_match(uint8_t address, const uint8_t *buffer, size_t length);
+static void _twr_spirit1_shadow_store(uint8_t address, const uint8_t *buffer, size_t length);
+#endif
+
 bool twr_spirit1_init(void)
 {
     if (_twr_spirit1.initialized_semaphore > 0)
@@ -142,11 +174,49 @@ bool twr_spirit1_init(void)
 
     _twr_spirit1.task_id = twr_scheduler_register(_twr_spirit1_task, NULL, 0);
 
+    twr_scheduler_set_priority(_twr_spirit1.task_id, TWR_SCHEDULER_PRIORITY_HIGH);
+
     _twr_spirit1.initialized_semaphore++;
 
     return true;
 }
 
+bool twr_spirit1_set_profile(twr_spirit1_profile_t profile)
+{
+    if (profile > TWR_SPIRIT1_PROFILE_100000)
+    {
+        return false;
+    }
+
+    if (_twr_spirit1.initialized_semaphore > 0)
+    {
+        if ((_twr_spirit1.current_state != TWR_SPIRIT1_STATE_INIT) && (_twr_spirit1.current_state != TWR_SPIRIT1_STATE_SLEEP))
+        {
+            return false;
+        }
+
+        if (_twr_spirit1.desired_state != TWR_SPIRIT1_STATE_SLEEP)
+        {
+            return false;
+        }
+    }
+
+    xRadioInit.lDatarate = _twr_spirit1_profile[profile].datarate;
+    xRadioInit.lFreqDev = _twr_spirit1_profile[profile].deviation;
+    xRadioInit.lBandwidth = _twr_spirit1_profile[profile].bandwidth;
+
+    if (_twr_spirit1.initialized_semaphore > 0)
+    {
+        SpiritRadioSetDatarate(xRadioInit.lDatarate);
+
+        SpiritRadioSetFrequencyDev(xRadioInit.lFreqDev);
+
+        SpiritRadioSetChannelBW(xRadioInit.lBandwidth);
+    }
+
+    return true;
+}
+
 bool twr_spirit1_deinit(void)
 {
     if (--_twr_spirit1.initialized_semaphore != 0)
@@ -203,6 +273,30 @@ int twr_spirit1_get_rx_rssi(void)
     return _twr_spirit1.rx_rssi;
 }
 
+bool twr_spirit1_get_rssi(int *rssi)
+{
+    if (_twr_spirit1.current_state != TWR_SPIRIT1_STATE_RX)
+    {
+        return false;
+    }
+
+    uint8_t rssi_level;
+
+    // Level is updated continuously by receiver until sync word is detected
+    twr_spirit1_read(RSSI_LEVEL_BASE, &rssi_level, 1);
+
+    *rssi = ((int) rssi_level) / 2 - 130;
+
+    return true;
+}
+
+void twr_spirit1_get_stats(twr_spirit1_stats_t *stats)
+{
+    *stats = _twr_spirit1.stats;
+
+    _twr_spirit1_account_state(stats, twr_tick_get());
+}
+
 void twr_spirit1_set_rx_timeout(twr_tick_t timeout)
 {
     _twr_spirit1.rx_timeout = timeout;
@@ -305,12 +399,40 @@ static void _twr_spirit1_task(void *param)
     }
 }
 
+static void _twr_spirit1_account_state(twr_spirit1_stats_t *stats, twr_tick_t now)
+{
+    twr_tick_t duration = now - _twr_spirit1.state_tick;
+
+    if (_twr_spirit1.current_state == TWR_SPIRIT1_STATE_TX)
+    {
+        stats->tx_time += duration;
+    }
+    else if (_twr_spirit1.current_state == TWR_SPIRIT1_STATE_RX)
+    {
+        stats->rx_time += duration;
+    }
+    else if (_twr_spirit1.current_state == TWR_SPIRIT1_STATE_SLEEP)
+    {
+        stats->sleep_time += duration;
+    }
+}
+
 static void _twr_spirit1_enter_state_tx(void)
 {
     GPIOA->PUPDR |= GPIO_PUPDR_PUPD7_1;
 
+    twr_tick_t now = twr_tick_get();
+
+    _twr_spirit1_account_state(&_twr_spirit1.stats, now);
+
+    _twr_spirit1.state_tick = now;
+
+    _twr_spirit1.stats.tx_count++;
+
     _twr_spirit1.current_state = TWR_SPIRIT1_STATE_TX;
 
+    twr_trace_state(TWR_TRACE_DRIVER_SPIRIT1, TWR_SPIRIT1_STATE_TX);
+
     SpiritCmdStrobeSabort();
     SpiritCmdStrobeReady();
     SpiritCmdStrobeFlushTxFifo();
@@ -367,8 +489,16 @@ static void _twr_spirit1_enter_state_rx(void)
 {
     GPIOA->PUPDR |= GPIO_PUPDR_PUPD7_1;
 
+    twr_tick_t now = twr_tick_get();
+
+    _twr_spirit1_account_state(&_twr_spirit1.stats, now);
+
+    _twr_spirit1.state_tick = now;
+
     _twr_spirit1.current_state = TWR_SPIRIT1_STATE_RX;
 
+    twr_trace_state(TWR_TRACE_DRIVER_SPIRIT1, TWR_SPIRIT1_STATE_RX);
+
     if (_twr_spirit1.rx_timeout == TWR_TICK_INFINITY)
     {
         _twr_spirit1.rx_tick_timeout = TWR_TICK_INFINITY;
@@ -433,6 +563,8 @@ static void _twr_spirit1_check_state_rx(void)
 
             _twr_spirit1.rx_length = cRxData;
 
+            _twr_spirit1.stats.rx_count++;
+
             uint8_t rssi_level;
 
             twr_spirit1_read(RSSI_LEVEL_BASE, &rssi_level, 1);
@@ -466,8 +598,16 @@ static void _twr_spirit1_check_state_rx(void)
 
 static void _twr_spirit1_enter_state_sleep(void)
 {
+    twr_tick_t now = twr_tick_get();
+
+    _twr_spirit1_account_state(&_twr_spirit1.stats, now);
+
+    _twr_spirit1.state_tick = now;
+
     _twr_spirit1.current_state = TWR_SPIRIT1_STATE_SLEEP;
 
+    twr_trace_state(TWR_TRACE_DRIVER_SPIRIT1, TWR_SPIRIT1_STATE_SLEEP);
+
     SpiritCmdStrobeSabort();
     SpiritCmdStrobeReady();
     SpiritIrqDeInit(NULL);
@@ -479,6 +619,14 @@ static void _twr_spirit1_enter_state_sleep(void)
 
 twr_spirit_status_t twr_spirit1_command(uint8_t command)
 {
+#if TWR_SPIRIT1_SHADOW
+    // Reset of digital part returns registers to their defaults
+    if (command == COMMAND_SRES)
+    {
+        memset(_twr_spirit1.shadow_valid, 0, sizeof(_twr_spirit1.shadow_valid));
+    }
+#endif
+
     // Enable PLL
     twr_system_pll_enable();
 
@@ -505,6 +653,14 @@ twr_spirit_status_t twr_spirit1_command(uint8_t command)
 
 twr_spirit_status_t twr_spirit1_write(uint8_t address, const void *buffer, size_t length)
 {
+#if TWR_SPIRIT1_SHADOW
+    // Skip write of values already in registers
+    if (_twr_spirit1_shadow_match(address, buffer, length))
+    {
+        return *((twr_spirit_status_t *) &_twr_spirit1.shadow_status);
+    }
+#endif
+
     // Enable PLL
     twr_system_pll_enable();
 
@@ -517,11 +673,14 @@ twr_spirit_status_t twr_spirit1_write(uint8_t address, const void *buffer, size_
     // Write memory map address and read status bits (LSB)
     status_value |= twr_spirit1_hal_transfer_byte(address);
 
-    // Write buffer
-    for (size_t i = 0; i < length; i++)
+    // Write buffer by DMA if possible
+    if (length < TWR_SPIRIT1_DMA_THRESHOLD || !twr_spirit1_hal_transfer_burst(buffer, NULL, length))
     {
-        // Write data
-        twr_spirit1_hal_transfer_byte(*((uint8_t *) buffer + i));
+        for (size_t i = 0; i < length; i++)
+        {
+            // Write data
+            twr_spirit1_hal_transfer_byte(*((uint8_t *) buffer + i));
+        }
     }
 
     // Set chip select high
@@ -530,6 +689,12 @@ twr_spirit_status_t twr_spirit1_write(uint8_t address, const void *buffer, size_
     // Disable PLL
     twr_system_pll_disable();
 
+#if TWR_SPIRIT1_SHADOW
+    _twr_spirit1_shadow_store(address, buffer, length);
+
+    _twr_spirit1.shadow_status = status_value;
+#endif
+
     twr_spirit_status_t *status = ((twr_spirit_status_t *) &status_value);
 
     // TODO Why this cast?
@@ -538,6 +703,14 @@ twr_spirit_status_t twr_spirit1_write(uint8_t address, const void *buffer, size_
 
 twr_spirit_status_t twr_spirit1_read(uint8_t address, void *buffer, size_t length)
 {
+#if TWR_SPIRIT1_SHADOW
+    // Read configuration registers from shadow copy
+    if (_twr_spirit1_shadow_load(address, buffer, length))
+    {
+        return *((twr_spirit_status_t *) &_twr_spirit1.shadow_status);
+    }
+#endif
+
     // Enable PLL
     twr_system_pll_enable();
 
@@ -550,11 +723,14 @@ twr_spirit_status_t twr_spirit1_read(uint8_t address, void *buffer, size_t lengt
     // Write memory map address and read status bits (LSB)
     status_value |= twr_spirit1_hal_transfer_byte(address);
 
-    // Read buffer
-    for (size_t i = 0; i < length; i++)
+    // Read buffer by DMA if possible
+    if (length < TWR_SPIRIT1_DMA_THRESHOLD || !twr_spirit1_hal_transfer_burst(NULL, buffer, length))
     {
-        // Write dummy byte and read data
-        *((uint8_t *) buffer + i) = twr_spirit1_hal_transfer_byte(0);
+        for (size_t i = 0; i < length; i++)
+        {
+            // Write dummy byte and read data
+            *((uint8_t *) buffer + i) = twr_spirit1_hal_transfer_byte(0);
+        }
     }
 
     // Set chip select high
@@ -563,6 +739,12 @@ twr_spirit_status_t twr_spirit1_read(uint8_t address, void *buffer, size_t lengt
     // Disable PLL
     twr_system_pll_disable();
 
+#if TWR_SPIRIT1_SHADOW
+    _twr_spirit1_shadow_store(address, buffer, length);
+
+    _twr_spirit1.shadow_status = status_value;
+#endif
+
     twr_spirit_status_t *status = ((twr_spirit_status_t *) &status_value);
 
     // TODO Why this cast?
@@ -603,6 +785,11 @@ void twr_spirit1_hal_shutdown_low(void)
 
 void twr_spirit1_hal_shutdown_high(void)
 {
+#if TWR_SPIRIT1_SHADOW
+    // Registers are lost in shutdown
+    memset(_twr_spirit1.shadow_valid, 0, sizeof(_twr_spirit1.shadow_valid));
+#endif
+
     // Enable PLL
     twr_system_pll_enable();
 
@@ -684,6 +871,70 @@ uint8_t twr_spirit1_hal_transfer_byte(uint8_t value)
     return value;
 }
 
+static bool twr_spirit1_hal_transfer_burst(const uint8_t *tx_buffer, uint8_t *rx_buffer, size_t length)
+{
+    // Dummy byte transmitted on read and sink of received bytes on write
+    static uint8_t dummy;
+
+    twr_dma_channel_t rx_channel;
+    twr_dma_channel_t tx_channel;
+
+    // SPI1 requests are routed only to channels 2 and 3, which are shared with other drivers
+    if (!twr_dma_channel_allocate(TWR_DMA_LINE_SPI1_RX, &rx_channel, NULL))
+    {
+        return false;
+    }
+
+    if (!twr_dma_channel_allocate(TWR_DMA_LINE_SPI1_TX, &tx_channel, NULL))
+    {
+        twr_dma_channel_release(rx_channel);
+
+        return false;
+    }
+
+    dummy = 0;
+
+    // Clear flags of both channels
+    DMA1->IFCR = DMA_IFCR_CGIF2 | DMA_IFCR_CGIF3;
+
+    // Select SPI1 requests for channel 2 (RX) and channel 3 (TX)
+    DMA1_CSELR->CSELR = (DMA1_CSELR->CSELR & ~(DMA_CSELR_C2S | DMA_CSELR_C3S)) | (1 << DMA_CSELR_C2S_Pos) | (1 << DMA_CSELR_C3S_Pos);
+
+    // Configure receive channel without interrupts, completion is polled
+    DMA1_Channel2->CCR = rx_buffer != NULL ? DMA_CCR_PL_1 | DMA_CCR_MINC : DMA_CCR_PL_1;
+    DMA1_Channel2->CNDTR = length;
+    DMA1_Channel2->CPAR = (uint32_t) &SPI1->DR;
+    DMA1_Channel2->CMAR = (uint32_t) (rx_buffer != NULL ? rx_buffer : &dummy);
+
+    // Configure transmit channel without interrupts
+    DMA1_Channel3->CCR = tx_buffer != NULL ? DMA_CCR_DIR | DMA_CCR_MINC : DMA_CCR_DIR;
+    DMA1_Channel3->CNDTR = length;
+    DMA1_Channel3->CPAR = (uint32_t) &SPI1->DR;
+    DMA1_Channel3->CMAR = (uint32_t) (tx_buffer != NULL ? tx_buffer : &dummy);
+
+    // Enable receive requests before transmission starts
+    SPI1->CR2 |= SPI_CR2_RXDMAEN;
+
+    DMA1_Channel2->CCR |= DMA_CCR_EN;
+    DMA1_Channel3->CCR |= DMA_CCR_EN;
+
+    SPI1->CR2 |= SPI_CR2_TXDMAEN;
+
+    // Wait until the last byte is received
+    while ((DMA1->ISR & (DMA_ISR_TCIF2 | DMA_ISR_TEIF2)) == 0)
+    {
+        continue;
+    }
+
+    SPI1->CR2 &= ~(SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN);
+
+    // Stops channels and clears their flags for other drivers
+    twr_dma_channel_release(tx_channel);
+    twr_dma_channel_release(rx_channel);
+
+    return true;
+}
+
 static void twr_spirit1_hal_init_gpio(void)
 {
     // Enable clock for GPIOH, GPIOB and GPIOA
@@ -752,6 +1003,9 @@ static void twr_spirit1_hal_deinit_gpio(void)
 
 static void twr_spirit1_hal_init_spi(void)
 {
+    // Initialize DMA used for FIFO bursts
+    twr_dma_init();
+
     // Enable clock for SPI1
     RCC->APB2ENR |= RCC_APB2ENR_SPI1EN;
 
@@ -778,3 +1032,102 @@ static void _twr_spirit1_interrupt(twr_exti_line_t line, void *param)
 
     twr_scheduler_plan_now(_twr_spirit1.task_id);
 }
+
+#if TWR_SPIRIT1_SHADOW
+
+static int _twr_spirit1_shadow_index(uint8_t address)
+{
+    // Configuration registers
+    if (address < 0x70)
+    {
+        return address;
+    }
+
+    // IRQ mask
+    if ((address >= IRQ_MASK3_BASE) && (address <= IRQ_MASK0_BASE))
+    {
+        return 0x70 + address - IRQ_MASK3_BASE;
+    }
+
+    return -1;
+}
+
+static bool _twr_spirit1_shadow_is_valid(uint8_t address, size_t length)
+{
+    if (length == 0)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < length; i++)
+    {
+        if (address + i > 0xff)
+        {
+            return false;
+        }
+
+        int index = _twr_spirit1_shadow_index(address + i);
+
+        if (index < 0)
+        {
+            return false;
+        }
+
+        if ((_twr_spirit1.shadow_valid[index / 32] & (1UL << (index % 32))) == 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool _twr_spirit1_shadow_load(uint8_t address, uint8_t *buffer, size_t length)
+{
+    if (!_twr_spirit1_shadow_is_valid(address, length))
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < length; i++)
+    {
+        buffer[i] = _twr_spirit1.shadow[_twr_spirit1_shadow_index(address + i)];
+    }
+
+    return true;
+}
+
+static bool _twr_spirit1_shadow_match(uint8_t address, const uint8_t *buffer, size_t length)
+{
+    if (!_twr_spirit1_shadow_is_valid(address, length))
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < length; i++)
+    {
+        if (buffer[i] != _twr_spirit1.shadow[_twr_spirit1_shadow_index(address + i)])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void _twr_spirit1_shadow_store(uint8_t address, const uint8_t *buffer, size_t length)
+{
+    for (size_t i = 0; (i < length) && (address + i <= 0xff); i++)
+    {
+        int index = _twr_spirit1_shadow_index(address + i);
+
+        if (index >= 0)
+        {
+            _twr_spirit1.shadow[index] = buffer[i];
+
+            _twr_spirit1.shadow_valid[index / 32] |= 1UL << (index % 32);
+        }
+    }
+}
+
+#endif
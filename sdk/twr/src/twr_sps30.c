@@ -5,17 +5,41 @@
 #define _TWR_SPS30_DELAY_READ 30
 #define _TWR_SPS30_DELAY_MEASUREMENT 250
 
-#define TWR_SPS30_NUM_WORDS(x) (sizeof(x) / 2)
+#define _TWR_SPS30_DELAY_WAKE_UP 30
 
-#define be16_to_cpu(s) (((uint16_t)(s) << 8) | (0xff & ((uint16_t)(s)) >> 8))
-#define be32_to_cpu(s) (((uint32_t)be16_to_cpu(s) << 16) | (0xffff & (be16_to_cpu((s) >> 16))))
+// Number of measured values
+#define _TWR_SPS30_VALUES 10
+
+// CRC-8 with polynomial 0x31 by byte
+static const uint8_t _twr_sps30_crc_table[256] =
+{
+    0x00, 0x31, 0x62, 0x53, 0xc4, 0xf5, 0xa6, 0x97, 0xb9, 0x88, 0xdb, 0xea, 0x7d, 0x4c, 0x1f, 0x2e,
+    0x43, 0x72, 0x21, 0x10, 0x87, 0xb6, 0xe5, 0xd4, 0xfa, 0xcb, 0x98, 0xa9, 0x3e, 0x0f, 0x5c, 0x6d,
+    0x86, 0xb7, 0xe4, 0xd5, 0x42, 0x73, 0x20, 0x11, 0x3f, 0x0e, 0x5d, 0x6c, 0xfb, 0xca, 0x99, 0xa8,
+    0xc5, 0xf4, 0xa7, 0x96, 0x01, 0x30, 0x63, 0x52, 0x7c, 0x4d, 0x1e, 0x2f, 0xb8, 0x89, 0xda, 0xeb,
+    0x3d, 0x0c, 0x5f, 0x6e, 0xf9, 0xc8, 0x9b, 0xaa, 0x84, 0xb5, 0xe6, 0xd7, 0x40, 0x71, 0x22, 0x13,
+    0x7e, 0x4f, 0x1c, 0x2d, 0xba, 0x8b, 0xd8, 0xe9, 0xc7, 0xf6, 0xa5, 0x94, 0x03, 0x32, 0x61, 0x50,
+    0xbb, 0x8a, 0xd9, 0xe8, 0x7f, 0x4e, 0x1d, 0x2c, 0x02, 0x33, 0x60, 0x51, 0xc6, 0xf7, 0xa4, 0x95,
+    0xf8, 0xc9, 0x9a, 0xab, 0x3c, 0x0d, 0x5e, 0x6f, 0x41, 0x70, 0x23, 0x12, 0x85, 0xb4, 0xe7, 0xd6,
+    0x7a, 0x4b, 0x18, 0x29, 0xbe, 0x8f, 0xdc, 0xed, 0xc3, 0xf2, 0xa1, 0x90, 0x07, 0x36, 0x65, 0x54,
+    0x39, 0x08, 0x5b, 0x6a, 0xfd, 0xcc, 0x9f, 0xae, 0x80, 0xb1, 0xe2, 0xd3, 0x44, 0x75, 0x26, 0x17,
+    0xfc, 0xcd, 0x9e, 0xaf, 0x38, 0x09, 0x5a, 0x6b, 0x45, 0x74, 0x27, 0x16, 0x81, 0xb0, 0xe3, 0xd2,
+    0xbf, 0x8e, 0xdd, 0xec, 0x7b, 0x4a, 0x19, 0x28, 0x06, 0x37, 0x64, 0x55, 0xc2, 0xf3, 0xa0, 0x91,
+    0x47, 0x76, 0x25, 0x14, 0x83, 0xb2, 0xe1, 0xd0, 0xfe, 0xcf, 0x9c, 0xad, 0x3a, 0x0b, 0x58, 0x69,
+    0x04, 0x35, 0x66, 0x57, 0xc0, 0xf1, 0xa2, 0x93, 0xbd, 0x8c, 0xdf, 0xee, 0x79, 0x48, 0x1b, 0x2a,
+    0xc1, 0xf0, 0xa3, 0x92, 0x05, 0x34, 0x67, 0x56, 0x78, 0x49, 0x1a, 0x2b, 0xbc, 0x8d, 0xde, 0xef,
+    0x82, 0xb3, 0xe0, 0xd1, 0x46, 0x77, 0x24, 0x15, 0x3b, 0x0a, 0x59, 0x68, 0xff, 0xce, 0x9d, 0xac
+};
 
 static void _twr_sps30_task_interval(void *param);
 
 static void _twr_sps30_task_measure(void *param);
 
 static uint8_t _twr_sps30_calculate_crc(uint8_t *buffer, size_t length);
-static bool _twr_sps30_convert_to_words(uint8_t *buffer, size_t buffer_length, uint16_t *data, size_t data_length);
+
+static bool _twr_sps30_convert_to_words(const uint8_t *buffer, size_t buffer_length, uint16_t *words);
+
+static bool _twr_sps30_write_command(twr_sps30_t *self, uint16_t command);
 
 void twr_sps30_init(twr_sps30_t *self, twr_i2c_channel_t i2c_channel, uint8_t i2c_address)
 {
@@ -43,6 +67,19 @@ void twr_sps30_set_startup_time(twr_sps30_t *self, twr_tick_t startup_time)
     self->_startup_time = startup_time;
 }
 
+void twr_sps30_set_output_format(twr_sps30_t *self, twr_sps30_output_format_t output_format)
+{
+    self->_output_format = output_format;
+
+    // Format of result is not known until the next measurement
+    self->_measurement_valid = false;
+}
+
+void twr_sps30_set_sleep(twr_sps30_t *self, bool sleep)
+{
+    self->_sleep = sleep;
+}
+
 void twr_sps30_set_update_interval(twr_sps30_t *self, twr_tick_t interval)
 {
     self->_update_interval = interval;
@@ -61,7 +98,7 @@ bool twr_sps30_measure(twr_sps30_t *self)
 {
     if (self->_state == TWR_SPS30_STATE_READY)
     {
-        self->_state = TWR_SPS30_STATE_START_MEASUREMENT;
+        self->_state = self->_sleep ? TWR_SPS30_STATE_WAKE_UP : TWR_SPS30_STATE_START_MEASUREMENT;
         self->_start_time = twr_tick_get();
 
         twr_scheduler_plan_now(self->_task_id_measure);
@@ -79,10 +116,20 @@ bool twr_sps30_get_mass_concentration(twr_sps30_t *self, twr_sps30_mass_concentr
         return false;
     }
 
-    mass_concentration->mc_1p0 = self->_mass_concentration.mc_1p0;
-    mass_concentration->mc_2p5 = self->_mass_concentration.mc_2p5;
-    mass_concentration->mc_4p0 = self->_mass_concentration.mc_4p0;
-    mass_concentration->mc_10p0 = self->_mass_concentration.mc_10p0;
+    if (self->_output_format == TWR_SPS30_OUTPUT_FORMAT_INTEGER)
+    {
+        mass_concentration->mc_1p0 = self->_value.integer[0];
+        mass_concentration->mc_2p5 = self->_value.integer[1];
+        mass_concentration->mc_4p0 = self->_value.integer[2];
+        mass_concentration->mc_10p0 = self->_value.integer[3];
+
+        return true;
+    }
+
+    mass_concentration->mc_1p0 = self->_value.real[0];
+    mass_concentration->mc_2p5 = self->_value.real[1];
+    mass_concentration->mc_4p0 = self->_value.real[2];
+    mass_concentration->mc_10p0 = self->_value.real[3];
 
     return true;
 }
@@ -94,11 +141,22 @@ bool twr_sps30_get_number_concentration(twr_sps30_t *self, twr_sps30_number_conc
         return false;
     }
 
-    number_concentration->nc_0p5 = self->_number_concentration.nc_0p5;
-    number_concentration->nc_1p0 = self->_number_concentration.nc_1p0;
-    number_concentration->nc_2p5 = self->_number_concentration.nc_2p5;
-    number_concentration->nc_4p0 = self->_number_concentration.nc_4p0;
-    number_concentration->nc_10p0 = self->_number_concentration.nc_10p0;
+    if (self->_output_format == TWR_SPS30_OUTPUT_FORMAT_INTEGER)
+    {
+        number_concentration->nc_0p5 = self->_value.integer[4];
+        number_concentration->nc_1p0 = self->_value.integer[5];
+        number_concentration->nc_2p5 = self->_value.integer[6];
+        number_concentration->nc_4p0 = self->_value.integer[7];
+        number_concentration->nc_10p0 = self->_value.integer[8];
+
+        return true;
+    }
+
+    number_concentration->nc_0p5 = self->_value.real[4];
+    number_concentration->nc_1p0 = self->_value.real[5];
+    number_concentration->nc_2p5 = self->_value.real[6];
+    number_concentration->nc_4p0 = self->_value.real[7];
+    number_concentration->nc_10p0 = self->_value.real[8];
 
     return true;
 }
@@ -110,7 +168,27 @@ bool twr_sps30_get_typical_particle_size(twr_sps30_t *self, float *typical_parti
         return false;
     }
 
-    *typical_particle_size = self->_typical_particle_size;
+    // Integer format gives size in nanometers
+    if (self->_output_format == TWR_SPS30_OUTPUT_FORMAT_INTEGER)
+    {
+        *typical_particle_size = self->_value.integer[9] / 1000.f;
+
+        return true;
+    }
+
+    *typical_particle_size = self->_value.real[9];
+
+    return true;
+}
+
+bool twr_sps30_get_values_integer(twr_sps30_t *self, uint16_t values[10])
+{
+    if (!self->_measurement_valid || self->_output_format != TWR_SPS30_OUTPUT_FORMAT_INTEGER)
+    {
+        return false;
+    }
+
+    memcpy(values, self->_value.integer, sizeof(self->_value.integer));
 
     return true;
 }
@@ -183,10 +261,6 @@ static void _twr_sps30_task_measure(void *param)
                 self->_state = TWR_SPS30_STATE_ERROR;
 
                 uint8_t buffer[48];
-                union {
-                    char serial[32];
-                    uint16_t __enforce_alignment;
-                } data;
 
                 twr_i2c_transfer_t transfer;
 
@@ -199,9 +273,16 @@ static void _twr_sps30_task_measure(void *param)
                     continue;
                 }
 
-                if (!_twr_sps30_convert_to_words(buffer, sizeof(buffer),
-                    (uint16_t *) data.serial, TWR_SPS30_NUM_WORDS(data.serial)))
+                // Serial number only proves communication
+                if (!_twr_sps30_convert_to_words(buffer, sizeof(buffer), NULL))
+                {
+                    continue;
+                }
+
+                if (self->_sleep)
                 {
+                    self->_state = TWR_SPS30_STATE_SLEEP;
+
                     continue;
                 }
 
@@ -209,6 +290,24 @@ static void _twr_sps30_task_measure(void *param)
 
                 continue;
             }
+            case TWR_SPS30_STATE_WAKE_UP:
+            {
+                self->_state = TWR_SPS30_STATE_ERROR;
+
+                // Interface is woken by the first command, which is not acknowledged
+                _twr_sps30_write_command(self, 0x1103);
+
+                if (!_twr_sps30_write_command(self, 0x1103))
+                {
+                    continue;
+                }
+
+                self->_state = TWR_SPS30_STATE_START_MEASUREMENT;
+
+                twr_scheduler_plan_current_from_now(_TWR_SPS30_DELAY_WAKE_UP);
+
+                return;
+            }
             case TWR_SPS30_STATE_START_MEASUREMENT:
             {
                 self->_state = TWR_SPS30_STATE_ERROR;
@@ -217,7 +316,7 @@ static void _twr_sps30_task_measure(void *param)
 
                 buffer[0] = 0x00;
                 buffer[1] = 0x10;
-                buffer[2] = 0x03;
+                buffer[2] = self->_output_format == TWR_SPS30_OUTPUT_FORMAT_INTEGER ? 0x05 : 0x03;
                 buffer[3] = 0x00;
                 buffer[4] = _twr_sps30_calculate_crc(&buffer[2], 2);
 
@@ -321,49 +420,41 @@ static void _twr_sps30_task_measure(void *param)
             {
                 self->_state = TWR_SPS30_STATE_ERROR;
 
-                uint8_t buffer[60];
-                union {
-                    uint16_t uint16_t[2];
-                    uint32_t u;
-                    float f;
-                } val, data[10];
+                // Every value is one word in integer format and two words in float format, each word followed by CRC
+                uint8_t buffer[_TWR_SPS30_VALUES * 2 * 3];
+                uint16_t words[_TWR_SPS30_VALUES * 2];
+
+                size_t length = self->_output_format == TWR_SPS30_OUTPUT_FORMAT_INTEGER ? sizeof(buffer) / 2 : sizeof(buffer);
 
                 twr_i2c_transfer_t transfer;
 
                 transfer.device_address = self->_i2c_address;
-                transfer.buffer = (uint8_t *) buffer;
-                transfer.length = sizeof(buffer);
+                transfer.buffer = buffer;
+                transfer.length = length;
 
                 if (!twr_i2c_read(self->_i2c_channel, &transfer))
                 {
                     continue;
                 }
 
-                if (!_twr_sps30_convert_to_words(buffer, sizeof(buffer), data->uint16_t, TWR_SPS30_NUM_WORDS(data)))
+                if (!_twr_sps30_convert_to_words(buffer, length, words))
                 {
                     continue;
                 }
 
-                val.u = be32_to_cpu(data[0].u);
-                self->_mass_concentration.mc_1p0 = val.f;
-                val.u = be32_to_cpu(data[1].u);
-                self->_mass_concentration.mc_2p5 = val.f;
-                val.u = be32_to_cpu(data[2].u);
-                self->_mass_concentration.mc_4p0 = val.f;
-                val.u = be32_to_cpu(data[3].u);
-                self->_mass_concentration.mc_10p0 = val.f;
-                val.u = be32_to_cpu(data[4].u);
-                self->_number_concentration.nc_0p5 = val.f;
-                val.u = be32_to_cpu(data[5].u);
-                self->_number_concentration.nc_1p0 = val.f;
-                val.u = be32_to_cpu(data[6].u);
-                self->_number_concentration.nc_2p5 = val.f;
-                val.u = be32_to_cpu(data[7].u);
-                self->_number_concentration.nc_4p0 = val.f;
-                val.u = be32_to_cpu(data[8].u);
-                self->_number_concentration.nc_10p0 = val.f;
-                val.u = be32_to_cpu(data[9].u);
-                self->_typical_particle_size = val.f;
+                if (self->_output_format == TWR_SPS30_OUTPUT_FORMAT_INTEGER)
+                {
+                    memcpy(self->_value.integer, words, sizeof(self->_value.integer));
+                }
+                else
+                {
+                    for (size_t i = 0; i < _TWR_SPS30_VALUES; i++)
+                    {
+                        uint32_t value = (uint32_t) words[2 * i] << 16 | words[2 * i + 1];
+
+                        memcpy(&self->_value.real[i], &value, sizeof(value));
+                    }
+                }
 
                 self->_measurement_valid = true;
 
@@ -400,6 +491,20 @@ static void _twr_sps30_task_measure(void *param)
                     continue;
                 }
 
+                self->_state = self->_sleep ? TWR_SPS30_STATE_SLEEP : TWR_SPS30_STATE_READY;
+
+                continue;
+            }
+            case TWR_SPS30_STATE_SLEEP:
+            {
+                self->_state = TWR_SPS30_STATE_ERROR;
+
+                // Fan and laser are off in idle mode already, sleep turns off the rest but interface
+                if (!_twr_sps30_write_command(self, 0x1001))
+                {
+                    continue;
+                }
+
                 self->_state = TWR_SPS30_STATE_READY;
 
                 continue;
@@ -420,44 +525,45 @@ static uint8_t _twr_sps30_calculate_crc(uint8_t *buffer, size_t length)
 
     for (size_t i = 0; i < length; i++)
     {
-        crc ^= buffer[i];
-
-        for (int j = 0; j < 8; j++)
-        {
-            if ((crc & 0x80) != 0)
-            {
-                crc = (crc << 1) ^ 0x31;
-            }
-            else
-            {
-                crc <<= 1;
-            }
-        }
+        crc = _twr_sps30_crc_table[crc ^ buffer[i]];
     }
 
     return crc;
 }
 
-static bool _twr_sps30_convert_to_words(uint8_t *buffer, size_t buffer_length, uint16_t *data, size_t data_length)
+static bool _twr_sps30_convert_to_words(const uint8_t *buffer, size_t buffer_length, uint16_t *words)
 {
-    uint8_t *data8 = (uint8_t *) data;
-    size_t i, j;
-
-    if (buffer_length != (data_length * 3))
+    if (buffer_length % 3 != 0)
     {
         return false;
     }
 
-    for (i = 0, j = 0; i < buffer_length; i += 3)
+    for (size_t i = 0; i < buffer_length; i += 3)
     {
-        if (_twr_sps30_calculate_crc(&buffer[i], 2) != buffer[i + 2])
+        // CRC of word followed by its CRC is zero
+        if (_twr_sps30_crc_table[_twr_sps30_crc_table[0xff ^ buffer[i]] ^ buffer[i + 1]] != buffer[i + 2])
         {
             return false;
         }
 
-        data8[j++] = buffer[i];
-        data8[j++] = buffer[i + 1];
+        if (words != NULL)
+        {
+            *words++ = buffer[i] << 8 | buffer[i + 1];
+        }
     }
 
     return true;
 }
+
+static bool _twr_sps30_write_command(twr_sps30_t *self, uint16_t command)
+{
+    uint8_t buffer[2] = { command >> 8, command };
+
+    twr_i2c_transfer_t transfer;
+
+    transfer.device_address = self->_i2c_address;
+    transfer.buffer = buffer;
+    transfer.length = sizeof(buffer);
+
+    return twr_i2c_write(self->_i2c_channel, &transfer);
+}
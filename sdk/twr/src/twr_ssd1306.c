@@ -30,6 +30,12 @@
 static bool _twr_ssd1306_command(twr_ssd1306_t *self, uint8_t command);
 static bool _twr_ssd1306_send_data(twr_ssd1306_t *self, uint8_t *buffer, size_t length);
 static bool _twr_ssd1306_init(twr_ssd1306_t *self);
+static void _twr_ssd1306_mark_dirty(twr_ssd1306_t *self, int page, int first, int last);
+static bool _twr_ssd1306_take_dirty(twr_ssd1306_t *self, int *page, uint8_t *first, uint8_t *last);
+static void _twr_ssd1306_window_command(twr_ssd1306_t *self, int page, uint8_t first, uint8_t last, uint8_t *command);
+static bool _twr_ssd1306_async_next(twr_ssd1306_t *self);
+static void _twr_ssd1306_async_command_event_handler(twr_i2c_channel_t channel, twr_i2c_event_t event, void *event_param);
+static void _twr_ssd1306_async_data_event_handler(twr_i2c_channel_t channel, twr_i2c_event_t event, void *event_param);
 
 bool twr_ssd1306_init(twr_ssd1306_t *self, twr_i2c_channel_t i2c_channel, uint8_t i2c_address, const twr_ssd1306_framebuffer_t *framebuffer)
 {
@@ -41,6 +47,12 @@ bool twr_ssd1306_init(twr_ssd1306_t *self, twr_i2c_channel_t i2c_channel, uint8_
 
     self->_framebuffer = framebuffer;
 
+    self->_async_page = -1;
+
+    memset(self->_dirty_last, 0, sizeof(self->_dirty_last));
+
+    _twr_ssd1306_mark_dirty(self, -1, 0, framebuffer->width - 1);
+
     twr_i2c_init(self->_i2c_channel, TWR_I2C_SPEED_400_KHZ);
 
     self->_initialized = _twr_ssd1306_init(self);
@@ -68,6 +80,8 @@ bool twr_ssd1306_is_ready(twr_ssd1306_t *self)
 void twr_ssd1306_clear(twr_ssd1306_t *self)
 {
     memset(self->_framebuffer->buffer, 0x00, self->_framebuffer->length);
+
+    _twr_ssd1306_mark_dirty(self, -1, 0, self->_framebuffer->width - 1);
 }
 
 void twr_ssd1306_draw_pixel(twr_ssd1306_t *self, int x, int y, uint32_t color)
@@ -89,6 +103,8 @@ void twr_ssd1306_draw_pixel(twr_ssd1306_t *self, int x, int y, uint32_t color)
     {
         self->_framebuffer->buffer[byteIndex] |= bitMask;
     }
+
+    _twr_ssd1306_mark_dirty(self, y / 8, x, x);
 }
 
 uint32_t twr_ssd1306_get_pixel(twr_ssd1306_t *self, int x, int y)
@@ -112,25 +128,48 @@ bool twr_ssd1306_update(twr_ssd1306_t *self)
         return false;
     }
 
-    if (_twr_ssd1306_command(self, _TWR_SSD1306_COLUMNADDR) &&
-            _twr_ssd1306_command(self, 0) &&        // Column start address. (0 = reset)
-            _twr_ssd1306_command(self, self->_framebuffer->width - 1) &&    // Column end address.
-            _twr_ssd1306_command(self, _TWR_SSD1306_PAGEADDR) &&
-            _twr_ssd1306_command(self, 0) &&        // Page start address. (0 = reset)
-            _twr_ssd1306_command(self, self->_framebuffer->pages - 1)) // Page end address.
+    // Sequence in progress sends pages changed meanwhile too
+    if (self->_async_page >= 0)
     {
-        for (size_t i = 0; i < self->_framebuffer->length; i += 8)
+        return true;
+    }
+
+    if (_twr_ssd1306_async_next(self))
+    {
+        return true;
+    }
+
+    int page;
+    uint8_t first;
+    uint8_t last;
+    uint8_t command[6];
+
+    while (_twr_ssd1306_take_dirty(self, &page, &first, &last))
+    {
+        _twr_ssd1306_window_command(self, page, first, last, command);
+
+        bool status = true;
+
+        for (size_t i = 0; status && i < sizeof(command); i++)
         {
-            if (!_twr_ssd1306_send_data(self, self->_framebuffer->buffer + i, 8))
-            {
-                return false;
-            }
+            status = _twr_ssd1306_command(self, command[i]);
         }
 
-        return true;
+        // Chunks keep transfers short for I2C over 1-Wire bridge
+        for (size_t i = first; status && i <= last; i += 8)
+        {
+            status = _twr_ssd1306_send_data(self, self->_framebuffer->buffer + page * self->_framebuffer->width + i, last - i + 1 < 8 ? last - i + 1 : 8);
+        }
+
+        if (!status)
+        {
+            _twr_ssd1306_mark_dirty(self, page, first, last);
+
+            return false;
+        }
     }
 
-    return false;
+    return true;
 }
 
 const twr_gfx_driver_t *twr_ssd1306_get_driver(void)
@@ -193,3 +232,152 @@ static bool _twr_ssd1306_init(twr_ssd1306_t *self)
             _twr_ssd1306_command(self, _TWR_SSD1306_NORMALDISPLAY) &&
             _twr_ssd1306_command(self, _TWR_SSD1306_DISPLAYON); // Turn on the display.
 }
+
+static void _twr_ssd1306_mark_dirty(twr_ssd1306_t *self, int page, int first, int last)
+{
+    int pages = self->_framebuffer->pages < TWR_SSD1306_PAGES_MAX ? self->_framebuffer->pages : TWR_SSD1306_PAGES_MAX;
+
+    // Negative page marks all pages
+    int page_first = page < 0 ? 0 : page;
+    int page_last = page < 0 ? pages - 1 : page;
+
+    if (page_last >= pages || first < 0 || last >= self->_framebuffer->width)
+    {
+        return;
+    }
+
+    for (int i = page_first; i <= page_last; i++)
+    {
+        if (self->_dirty_first[i] > self->_dirty_last[i])
+        {
+            self->_dirty_first[i] = first;
+            self->_dirty_last[i] = last;
+        }
+        else
+        {
+            if (first < self->_dirty_first[i])
+            {
+                self->_dirty_first[i] = first;
+            }
+
+            if (last > self->_dirty_last[i])
+            {
+                self->_dirty_last[i] = last;
+            }
+        }
+    }
+}
+
+static bool _twr_ssd1306_take_dirty(twr_ssd1306_t *self, int *page, uint8_t *first, uint8_t *last)
+{
+    int pages = self->_framebuffer->pages < TWR_SSD1306_PAGES_MAX ? self->_framebuffer->pages : TWR_SSD1306_PAGES_MAX;
+
+    for (int i = 0; i < pages; i++)
+    {
+        if (self->_dirty_first[i] <= self->_dirty_last[i])
+        {
+            *page = i;
+            *first = self->_dirty_first[i];
+            *last = self->_dirty_last[i];
+
+            // Clean range is marked by first column behind the last one
+            self->_dirty_first[i] = 0xff;
+            self->_dirty_last[i] = 0;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void _twr_ssd1306_window_command(twr_ssd1306_t *self, int page, uint8_t first, uint8_t last, uint8_t *command)
+{
+    (void) self;
+
+    command[0] = _TWR_SSD1306_COLUMNADDR;
+    command[1] = first;
+    command[2] = last;
+    command[3] = _TWR_SSD1306_PAGEADDR;
+    command[4] = page;
+    command[5] = page;
+}
+
+static bool _twr_ssd1306_async_next(twr_ssd1306_t *self)
+{
+    int page;
+
+    if (!_twr_ssd1306_take_dirty(self, &page, &self->_async_first, &self->_async_last))
+    {
+        self->_async_page = -1;
+
+        return true;
+    }
+
+    _twr_ssd1306_window_command(self, page, self->_async_first, self->_async_last, self->_async_command);
+
+    // Control byte 0x00 is followed by stream of commands, control byte 0x40 by stream of data
+    self->_async_command_transaction.type = TWR_I2C_ASYNC_MEMORY_WRITE;
+    self->_async_command_transaction.device_address = self->_i2c_address;
+    self->_async_command_transaction.memory_address = 0x00;
+    self->_async_command_transaction.buffer = self->_async_command;
+    self->_async_command_transaction.length = sizeof(self->_async_command);
+    self->_async_command_transaction.event_handler = _twr_ssd1306_async_command_event_handler;
+    self->_async_command_transaction.event_param = self;
+
+    self->_async_data_transaction.type = TWR_I2C_ASYNC_MEMORY_WRITE;
+    self->_async_data_transaction.device_address = self->_i2c_address;
+    self->_async_data_transaction.memory_address = 0x40;
+    self->_async_data_transaction.buffer = self->_framebuffer->buffer + page * self->_framebuffer->width + self->_async_first;
+    self->_async_data_transaction.length = self->_async_last - self->_async_first + 1;
+    self->_async_data_transaction.event_handler = _twr_ssd1306_async_data_event_handler;
+    self->_async_data_transaction.event_param = self;
+
+    self->_async_page = page;
+    self->_async_error = false;
+
+    if (!twr_i2c_async_submit(self->_i2c_channel, &self->_async_command_transaction))
+    {
+        self->_async_page = -1;
+
+        _twr_ssd1306_mark_dirty(self, page, self->_async_first, self->_async_last);
+
+        return false;
+    }
+
+    // Data transaction cannot be refused when command transaction of the same length limit has been accepted
+    twr_i2c_async_submit(self->_i2c_channel, &self->_async_data_transaction);
+
+    return true;
+}
+
+static void _twr_ssd1306_async_command_event_handler(twr_i2c_channel_t channel, twr_i2c_event_t event, void *event_param)
+{
+    (void) channel;
+
+    twr_ssd1306_t *self = (twr_ssd1306_t *) event_param;
+
+    if (event == TWR_I2C_EVENT_ASYNC_ERROR)
+    {
+        self->_async_error = true;
+    }
+}
+
+static void _twr_ssd1306_async_data_event_handler(twr_i2c_channel_t channel, twr_i2c_event_t event, void *event_param)
+{
+    (void) channel;
+
+    twr_ssd1306_t *self = (twr_ssd1306_t *) event_param;
+
+    if (event == TWR_I2C_EVENT_ASYNC_ERROR || self->_async_error)
+    {
+        // Page is sent again by the next update
+        _twr_ssd1306_mark_dirty(self, self->_async_page, self->_async_first, self->_async_last);
+
+        self->_async_page = -1;
+
+        return;
+    }
+
+    _twr_ssd1306_async_next(self);
+}
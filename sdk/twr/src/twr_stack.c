@@ -0,0 +1,142 @@
+#include <twr_stack.h>
+#include <twr_irq.h>
+#include <twr_atci.h>
+#include <stm32l0xx.h>
+
+// Pattern words which end downward scan of measurement
+#define _TWR_STACK_GAP 8
+
+// Symbols of linker script
+extern uint32_t __heap_end[];
+extern uint32_t _estack[];
+
+#if TWR_STACK_PAINT
+
+static struct
+{
+    size_t peak;
+
+} _twr_stack;
+
+#endif
+
+static inline uint32_t *_twr_stack_bottom(void)
+{
+    return (uint32_t *) (((uintptr_t) __heap_end + 3) & ~(uintptr_t) 3);
+}
+
+#if TWR_STACK_PAINT
+
+void twr_stack_paint(void)
+{
+    uint32_t *end = (uint32_t *) __get_MSP();
+
+    // Nothing is below stack pointer of function which calls nothing
+    for (uint32_t *p = _twr_stack_bottom(); p < end; p++)
+    {
+        *p = TWR_STACK_PATTERN;
+    }
+}
+
+#endif
+
+size_t twr_stack_get_size(void)
+{
+    return (uintptr_t) _estack - (uintptr_t) _twr_stack_bottom();
+}
+
+size_t twr_stack_get_used(void)
+{
+    return (uintptr_t) _estack - __get_MSP();
+}
+
+size_t twr_stack_get_high_watermark(void)
+{
+#if TWR_STACK_PAINT
+    uint32_t *p = _twr_stack_bottom();
+
+    while (p < _estack && *p == TWR_STACK_PATTERN)
+    {
+        p++;
+    }
+
+    size_t used = (uintptr_t) _estack - (uintptr_t) p;
+
+    // Measurement paints used stack again, the deepest use it has seen is kept
+    return used > _twr_stack.peak ? used : _twr_stack.peak;
+#else
+    return 0;
+#endif
+}
+
+bool twr_stack_check_guard(void)
+{
+#if TWR_STACK_PAINT
+    uint32_t *guard = _twr_stack_bottom();
+
+    for (size_t i = 0; i < TWR_STACK_GUARD_SIZE / sizeof(uint32_t); i++)
+    {
+        if (guard[i] != TWR_STACK_PATTERN)
+        {
+            return false;
+        }
+    }
+#endif
+
+    return true;
+}
+
+size_t twr_stack_measure(void)
+{
+#if TWR_STACK_PAINT
+    // Interrupt would use stack which is painted here
+    uint32_t primask = twr_irq_save();
+
+    uint32_t *sp = (uint32_t *) __get_MSP();
+    uint32_t *bottom = _twr_stack_bottom();
+    uint32_t *low = sp;
+    int gap = 0;
+
+    for (uint32_t *p = sp; p > bottom && gap < _TWR_STACK_GAP; )
+    {
+        p--;
+
+        if (*p != TWR_STACK_PATTERN)
+        {
+            low = p;
+
+            gap = 0;
+        }
+        else
+        {
+            gap++;
+        }
+    }
+
+    for (uint32_t *p = low; p < sp; p++)
+    {
+        *p = TWR_STACK_PATTERN;
+    }
+
+    size_t used = (uintptr_t) _estack - (uintptr_t) low;
+
+    if (_twr_stack.peak < used)
+    {
+        _twr_stack.peak = used;
+    }
+
+    twr_irq_restore(primask);
+
+    return (uintptr_t) sp - (uintptr_t) low;
+#else
+    return 0;
+#endif
+}
+
+bool twr_stack_atci_action(void)
+{
+    twr_atci_printfln("$STACK: %u,%u,%u", (unsigned int) twr_stack_get_size(), (unsigned int) twr_stack_get_used(),
+            (unsigned int) twr_stack_get_high_watermark());
+
+    return true;
+}
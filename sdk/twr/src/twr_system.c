@@ -7,24 +7,81 @@
 #include <stm32l0xx_hal_conf.h>
 #include <twr_rtc.h>
 #include <twr_sleep.h>
+#include <twr_atci.h>
 
 #define _TWR_SYSTEM_DEBUG_ENABLE 0
 
-static const uint32_t twr_system_clock_table[3] =
+static const uint32_t twr_system_clock_table[4] =
 {
     RCC_CFGR_SW_MSI,
     RCC_CFGR_SW_HSI,
-    RCC_CFGR_SW_PLL
+    RCC_CFGR_SW_PLL,
+    RCC_CFGR_SW_MSI
 };
 
-static int _twr_system_hsi16_enable_semaphore;
+// Clock levels of governor, ordered by frequency
+#define _TWR_SYSTEM_LEVEL_MSI 0
+#define _TWR_SYSTEM_LEVEL_MSI_FAST 1
+#define _TWR_SYSTEM_LEVEL_HSI 2
+#define _TWR_SYSTEM_LEVEL_PLL 3
+#define _TWR_SYSTEM_LEVEL_COUNT 4
 
-static int _twr_system_pll_enable_semaphore;
+static const uint32_t _twr_system_level_frequency[_TWR_SYSTEM_LEVEL_COUNT] =
+{
+    TWR_SYSTEM_CLOCK_FREQUENCY_MSI,
+    TWR_SYSTEM_CLOCK_FREQUENCY_MSI_FAST,
+    TWR_SYSTEM_CLOCK_FREQUENCY_HSI,
+    TWR_SYSTEM_CLOCK_FREQUENCY_PLL
+};
+
+static struct
+{
+    int request[_TWR_SYSTEM_LEVEL_COUNT];
+    int level;
+    bool release_pending;
+
+} _twr_system_clock;
+
+#if TWR_SYSTEM_RESIDENCY
+
+static struct
+{
+    twr_system_residency_t residency;
+    uint32_t since_ms;
+    uint32_t since_us;
+    bool sleeping;
+    bool stopping;
+    twr_tick_t tick_stop;
+    int owner;
+
+} _twr_system_residency = { .owner = -1 };
+
+static void _twr_system_residency_now(uint32_t *ms, uint32_t *us);
+
+static void _twr_system_residency_update(void);
+
+static void _twr_system_residency_raise(void *caller);
+
+#endif
 
 static int _twr_system_deep_sleep_disable_semaphore;
 
+static struct
+{
+    bool active;
+    uint32_t rtc_start;
+    uint32_t remainder;
+
+} _twr_system_tickless;
+
+static bool _twr_system_standby_wakeup;
+
 static void _twr_system_init_flash(void);
 
+static void _twr_system_standby_resume(void);
+
+static void _twr_system_standby_enter(void);
+
 static void _twr_system_init_debug(void);
 
 static void _twr_system_init_clock(void);
@@ -39,6 +96,24 @@ static void _twr_system_init_shutdown_i2c_sensors(void);
 
 static void _twr_system_switch_clock(twr_system_clock_t clock);
 
+static int _twr_system_clock_level(uint32_t frequency);
+
+static void _twr_system_clock_set_level(int level);
+
+static void _twr_system_clock_request(int level, void *caller);
+
+static void _twr_system_rtc_wakeup_set(uint32_t reload);
+
+#if TWR_SYSTEM_WAKE_STATS
+
+static twr_system_wake_stats_t _twr_system_wake_stats;
+
+static void _twr_system_wake_stats_record(uint32_t cycles);
+
+#endif
+
+static uint32_t _twr_system_rtc_get_subseconds(void);
+
 void twr_system_init(void)
 {
     _twr_system_init_flash();
@@ -170,8 +245,16 @@ static void _twr_system_init_power(void)
     // Enable ultra-low-power mode
     PWR->CR |= PWR_CR_ULP;
 
+#if TWR_SYSTEM_WAKE_PROFILE == TWR_SYSTEM_WAKE_PROFILE_LOW_POWER
     // Enable regulator low-power mode
     PWR->CR |= PWR_CR_LPSDSR;
+#else
+    // Keep main regulator in stop mode, wake-up does not wait for it
+    PWR->CR &= ~PWR_CR_LPSDSR;
+#endif
+
+    // Wake up from stop mode to MSI
+    RCC->CFGR &= ~RCC_CFGR_STOPWUCK;
 
     // Enable deep-sleep
     SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
@@ -230,6 +313,27 @@ static void _twr_system_init_rtc(void)
         twr_rtc_set_init(false);
     }
 
+    twr_rtc_disable_write();
+
+    // Set wake-up auto-reload value based on the configured scheduler interval.
+    _twr_system_rtc_wakeup_set(LSE_VALUE / 16 * TWR_SCHEDULER_INTERVAL_MS / 1000);
+
+    // RTC IRQ needs to be configured through EXTI
+    EXTI->IMR |= EXTI_IMR_IM20;
+
+    // Enable rising edge trigger
+    EXTI->RTSR |= EXTI_IMR_IM20;
+
+    // Enable RTC interrupt requests
+    NVIC_EnableIRQ(RTC_IRQn);
+
+    _twr_system_standby_resume();
+}
+
+static void _twr_system_rtc_wakeup_set(uint32_t reload)
+{
+    twr_rtc_enable_write();
+
     // Disable timer
     RTC->CR &= ~RTC_CR_WUTE;
 
@@ -239,8 +343,7 @@ static void _twr_system_init_rtc(void)
         continue;
     }
 
-    // Set wake-up auto-reload value based on the configured scheduler interval.
-    RTC->WUTR = LSE_VALUE / 16 * TWR_SCHEDULER_INTERVAL_MS / 1000;
+    RTC->WUTR = reload;
 
     // Clear timer flag
     RTC->ISR &= ~RTC_ISR_WUTF;
@@ -252,15 +355,95 @@ static void _twr_system_init_rtc(void)
     RTC->CR |= RTC_CR_WUTE;
 
     twr_rtc_disable_write();
+}
 
-    // RTC IRQ needs to be configured through EXTI
-    EXTI->IMR |= EXTI_IMR_IM20;
+static uint32_t _twr_system_rtc_get_subseconds(void)
+{
+    // Reading RTC_SSR freezes RTC_TR until RTC_DR is read
+    uint32_t ssr = RTC->SSR;
+    uint32_t tr = RTC->TR;
+    (void) RTC->DR;
 
-    // Enable rising edge trigger
-    EXTI->RTSR |= EXTI_IMR_IM20;
+    uint32_t seconds = ((tr & RTC_TR_HT) >> RTC_TR_HT_Pos) * 36000 + ((tr & RTC_TR_HU) >> RTC_TR_HU_Pos) * 3600;
+    seconds += ((tr & RTC_TR_MNT) >> RTC_TR_MNT_Pos) * 600 + ((tr & RTC_TR_MNU) >> RTC_TR_MNU_Pos) * 60;
+    seconds += ((tr & RTC_TR_ST) >> RTC_TR_ST_Pos) * 10 + ((tr & RTC_TR_SU) >> RTC_TR_SU_Pos);
 
-    // Enable RTC interrupt requests
-    NVIC_EnableIRQ(RTC_IRQn);
+    // Sub-second register counts down from the synchronous prescaler value
+    return seconds * TWR_RTC_PREDIV_S + (TWR_RTC_PREDIV_S - 1 - (ssr & RTC_SSR_SS));
+}
+
+bool twr_system_tickless_enter(uint32_t timeout)
+{
+    // Wake-up timer runs from RTCCLK / 16 and has 16-bit auto-reload register
+    uint32_t reload = timeout * (LSE_VALUE / 16) / 1000;
+
+    if (timeout > 0xffff * 1000 / (LSE_VALUE / 16))
+    {
+        reload = 0xffff;
+    }
+
+    twr_irq_disable();
+
+    if (_twr_system_tickless.active)
+    {
+        twr_irq_enable();
+
+        return false;
+    }
+
+    twr_rtc_wait();
+
+    _twr_system_tickless.rtc_start = _twr_system_rtc_get_subseconds();
+
+    _twr_system_rtc_wakeup_set(reload);
+
+    _twr_system_tickless.active = true;
+
+    twr_irq_enable();
+
+    return true;
+}
+
+void twr_system_tickless_exit(void)
+{
+    twr_irq_disable();
+
+    if (!_twr_system_tickless.active)
+    {
+        twr_irq_enable();
+
+        return;
+    }
+
+    // Shadow registers are stale after waking up from deep sleep and this can run before twr_system_sleep returns
+    twr_rtc_enable_write();
+
+    RTC->ISR &= ~RTC_ISR_RSF;
+
+    twr_rtc_disable_write();
+
+    twr_rtc_wait();
+
+    uint32_t rtc_now = _twr_system_rtc_get_subseconds();
+
+    if (rtc_now < _twr_system_tickless.rtc_start)
+    {
+        // Midnight has passed meanwhile
+        rtc_now += 24 * 3600 * TWR_RTC_PREDIV_S;
+    }
+
+    // Keep the fraction of millisecond for the next time so that the tick counter does not drift
+    uint32_t elapsed = (rtc_now - _twr_system_tickless.rtc_start) * 1000 + _twr_system_tickless.remainder;
+
+    _twr_system_tickless.remainder = elapsed % TWR_RTC_PREDIV_S;
+
+    twr_tick_increment_irq(elapsed / TWR_RTC_PREDIV_S);
+
+    _twr_system_rtc_wakeup_set(LSE_VALUE / 16 * TWR_SCHEDULER_INTERVAL_MS / 1000);
+
+    _twr_system_tickless.active = false;
+
+    twr_irq_enable();
 }
 
 static void _twr_system_init_shutdown_i2c_sensors(void)
@@ -301,11 +484,6 @@ void twr_system_enter_standby_mode(void)
 
     __disable_irq();
 
-    GPIOA->MODER = 0xFFFFFFFF;
-    GPIOB->MODER = 0xFFFFFFFF;
-    GPIOC->MODER = 0xFFFFFFFF;
-    GPIOH->MODER = 0xFFFFFFFF;
-
     // Disable RTC clock
     RCC->CSR &= ~(RCC_CSR_RTCEN | RCC_CSR_LSEON | RCC_CSR_RTCSEL_LSE);
 
@@ -314,6 +492,152 @@ void twr_system_enter_standby_mode(void)
 
     RCC->CSR &= ~RCC_CSR_LSEDRV_Msk;
 
+    _twr_system_standby_enter();
+}
+
+void twr_system_enter_standby_alarm(uint32_t timeout)
+{
+    _twr_system_init_shutdown_i2c_sensors();
+
+    __disable_irq();
+
+    twr_rtc_enable_write();
+
+    // Shadow registers may be stale after stop mode
+    RTC->ISR &= ~RTC_ISR_RSF;
+
+    twr_rtc_wait();
+
+    uint32_t rtc_now = _twr_system_rtc_get_subseconds();
+
+    // Tick and RTC time of day at entry let the tick continue after wake-up
+    twr_tick_t tick = twr_tick_get();
+
+    RTC->BKP0R = (uint32_t) tick;
+    RTC->BKP1R = (uint32_t) (tick >> 32);
+    RTC->BKP2R = rtc_now;
+
+    // Alarm has resolution of one second and matches time of day only, round up so tasks are not woken early
+    uint32_t seconds = (timeout + 999) / 1000;
+
+    if (seconds > 24 * 3600 - 1)
+    {
+        seconds = 24 * 3600 - 1;
+    }
+
+    seconds = (rtc_now / TWR_RTC_PREDIV_S + seconds) % (24 * 3600);
+
+    uint32_t hours = seconds / 3600;
+    uint32_t minutes = seconds / 60 % 60;
+
+    seconds %= 60;
+
+    // Periodic tick would wake up from standby too
+    RTC->CR &= ~(RTC_CR_WUTE | RTC_CR_WUTIE | RTC_CR_ALRAE);
+
+    while ((RTC->ISR & RTC_ISR_ALRAWF) == 0)
+    {
+        continue;
+    }
+
+    // Date is not compared, sub-second register is not compared either (ALRMASSR is zero)
+    RTC->ALRMAR = RTC_ALRMAR_MSK4 |
+            ((hours / 10) << RTC_ALRMAR_HT_Pos) | ((hours % 10) << RTC_ALRMAR_HU_Pos) |
+            ((minutes / 10) << RTC_ALRMAR_MNT_Pos) | ((minutes % 10) << RTC_ALRMAR_MNU_Pos) |
+            ((seconds / 10) << RTC_ALRMAR_ST_Pos) | ((seconds % 10) << RTC_ALRMAR_SU_Pos);
+
+    RTC->ALRMASSR = 0;
+
+    RTC->ISR &= ~(RTC_ISR_ALRAF | RTC_ISR_WUTF);
+
+    // Enabled alarm interrupt also marks wake-up by alarm for twr_system_init
+    RTC->CR |= RTC_CR_ALRAIE | RTC_CR_ALRAE;
+
+    twr_rtc_disable_write();
+
+    _twr_system_standby_enter();
+}
+
+bool twr_system_is_standby_wakeup(void)
+{
+    return _twr_system_standby_wakeup;
+}
+
+void twr_system_backup_write(size_t index, uint32_t value)
+{
+    if (index >= TWR_SYSTEM_BACKUP_COUNT)
+    {
+        return;
+    }
+
+    // First three registers keep tick over standby
+    (&RTC->BKP3R)[index] = value;
+}
+
+uint32_t twr_system_backup_read(size_t index)
+{
+    if (index >= TWR_SYSTEM_BACKUP_COUNT)
+    {
+        return 0;
+    }
+
+    return (&RTC->BKP3R)[index];
+}
+
+static void _twr_system_standby_resume(void)
+{
+    bool standby = (PWR->CSR & PWR_CSR_SBF) != 0;
+
+    PWR->CR |= PWR_CR_CSBF;
+
+    // Standby without alarm (twr_system_enter_standby_mode) has nothing to resume
+    if ((RTC->CR & RTC_CR_ALRAIE) == 0)
+    {
+        return;
+    }
+
+    twr_rtc_enable_write();
+
+    RTC->CR &= ~(RTC_CR_ALRAE | RTC_CR_ALRAIE);
+
+    RTC->ISR &= ~(RTC_ISR_ALRAF | RTC_ISR_RSF);
+
+    twr_rtc_disable_write();
+
+    if (!standby)
+    {
+        return;
+    }
+
+    twr_rtc_wait();
+
+    uint32_t rtc_now = _twr_system_rtc_get_subseconds();
+
+    uint32_t rtc_start = RTC->BKP2R;
+
+    if (rtc_now < rtc_start)
+    {
+        // Midnight has passed meanwhile
+        rtc_now += 24 * 3600 * TWR_RTC_PREDIV_S;
+    }
+
+    twr_tick_t tick = ((twr_tick_t) RTC->BKP1R << 32) | RTC->BKP0R;
+
+    tick += (twr_tick_t) (rtc_now - rtc_start) * 1000 / TWR_RTC_PREDIV_S;
+
+    // Counter starts from zero after reset
+    twr_tick_increment_irq(tick);
+
+    _twr_system_standby_wakeup = true;
+}
+
+static void _twr_system_standby_enter(void)
+{
+    GPIOA->MODER = 0xFFFFFFFF;
+    GPIOB->MODER = 0xFFFFFFFF;
+    GPIOC->MODER = 0xFFFFFFFF;
+    GPIOH->MODER = 0xFFFFFFFF;
+
     PWR->CR &= ~PWR_CR_LPSDSR;
 
     PWR->CR |= PWR_CR_PDDS;
@@ -327,128 +651,357 @@ void twr_system_enter_standby_mode(void)
 
 twr_system_clock_t twr_system_clock_get(void)
 {
-    if (_twr_system_pll_enable_semaphore != 0)
+    if (_twr_system_clock.level == _TWR_SYSTEM_LEVEL_PLL)
     {
         return TWR_SYSTEM_CLOCK_PLL;
     }
-    else if (_twr_system_hsi16_enable_semaphore != 0)
+    else if (_twr_system_clock.level == _TWR_SYSTEM_LEVEL_HSI)
     {
         return TWR_SYSTEM_CLOCK_HSI;
     }
+    else if (_twr_system_clock.level == _TWR_SYSTEM_LEVEL_MSI_FAST)
+    {
+        return TWR_SYSTEM_CLOCK_MSI_FAST;
+    }
     else
     {
         return TWR_SYSTEM_CLOCK_MSI;
     }
 }
 
-void twr_system_hsi16_enable(void)
+void twr_system_clock_request(uint32_t frequency)
 {
-    if (++_twr_system_hsi16_enable_semaphore == 1)
+    _twr_system_clock_request(_twr_system_clock_level(frequency), __builtin_return_address(0));
+}
+
+void twr_system_clock_release(uint32_t frequency)
+{
+    int level = _twr_system_clock_level(frequency);
+
+    twr_irq_disable();
+
+    _twr_system_clock.request[level]--;
+
+    _twr_system_clock.release_pending = true;
+
+    twr_irq_enable();
+
+#if !TWR_SYSTEM_CLOCK_DEFER
+    twr_system_clock_commit();
+#endif
+}
+
+void twr_system_clock_commit(void)
+{
+    if (!_twr_system_clock.release_pending)
     {
-        // Set regulator range to 1.8V
-        PWR->CR |= PWR_CR_VOS_0;
-        PWR->CR &= ~PWR_CR_VOS_1;
+        return;
+    }
+
+    int level = _TWR_SYSTEM_LEVEL_MSI;
 
-        // Enable flash latency and preread
-        FLASH->ACR |= FLASH_ACR_LATENCY | FLASH_ACR_PRE_READ;
+    twr_irq_disable();
 
-        // Turn HSI16 on
-        RCC->CR |= RCC_CR_HSION;
+    _twr_system_clock.release_pending = false;
 
-        while ((RCC->CR & RCC_CR_HSIRDY) == 0)
+    for (int i = _TWR_SYSTEM_LEVEL_COUNT - 1; i > _TWR_SYSTEM_LEVEL_MSI; i--)
+    {
+        if (_twr_system_clock.request[i] != 0)
         {
-            continue;
-        }
+            level = i;
 
-        _twr_system_switch_clock(TWR_SYSTEM_CLOCK_HSI);
+            break;
+        }
+    }
 
-        // Set SysTick reload value
-        SysTick->LOAD = 16000 - 1;
+    twr_irq_enable();
 
-        // Update SystemCoreClock variable
-        SystemCoreClock = 16000000;
+    if (level < _twr_system_clock.level)
+    {
+        _twr_system_clock_set_level(level);
     }
+}
 
-    twr_sleep_disable();
+void twr_system_hsi16_enable(void)
+{
+    _twr_system_clock_request(_TWR_SYSTEM_LEVEL_HSI, __builtin_return_address(0));
 }
 
 void twr_system_hsi16_disable(void)
 {
-    if (--_twr_system_hsi16_enable_semaphore == 0)
-    {
-        _twr_system_switch_clock(TWR_SYSTEM_CLOCK_MSI);
+    twr_system_clock_release(TWR_SYSTEM_CLOCK_FREQUENCY_HSI);
+}
 
-        // Turn HSI16 off
-        RCC->CR &= ~RCC_CR_HSION;
+void twr_system_pll_enable(void)
+{
+    _twr_system_clock_request(_TWR_SYSTEM_LEVEL_PLL, __builtin_return_address(0));
+}
 
-        while ((RCC->CR & RCC_CR_HSIRDY) != 0)
+void twr_system_pll_disable(void)
+{
+    twr_system_clock_release(TWR_SYSTEM_CLOCK_FREQUENCY_PLL);
+}
+
+uint32_t twr_system_get_clock(void)
+{
+    return SystemCoreClock;
+}
+
+void twr_system_get_residency(twr_system_residency_t *residency)
+{
+#if TWR_SYSTEM_RESIDENCY
+    twr_irq_disable();
+
+    _twr_system_residency_update();
+
+    *residency = _twr_system_residency.residency;
+
+    twr_irq_enable();
+#else
+    memset(residency, 0, sizeof(*residency));
+#endif
+}
+
+void twr_system_residency_reset(void)
+{
+#if TWR_SYSTEM_RESIDENCY
+    twr_irq_disable();
+
+    _twr_system_residency_update();
+
+    memset(&_twr_system_residency.residency, 0, sizeof(_twr_system_residency.residency));
+
+    _twr_system_residency.owner = -1;
+
+    twr_irq_enable();
+#endif
+}
+
+#if TWR_SYSTEM_RESIDENCY
+
+bool twr_system_residency_atci_action(void)
+{
+    twr_system_residency_t residency;
+
+    twr_system_get_residency(&residency);
+
+    twr_atci_printfln("$RESIDENCY: %" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu32,
+            residency.time[TWR_SYSTEM_STATE_MSI], residency.time[TWR_SYSTEM_STATE_MSI_FAST],
+            residency.time[TWR_SYSTEM_STATE_HSI], residency.time[TWR_SYSTEM_STATE_PLL],
+            residency.time[TWR_SYSTEM_STATE_SLEEP], residency.time[TWR_SYSTEM_STATE_STOP], residency.transitions);
+
+    for (int i = 0; i < TWR_SYSTEM_RESIDENCY_OWNERS; i++)
+    {
+        if (residency.owner[i].count != 0)
         {
-            continue;
+            twr_atci_printfln("$RESIDENCY: %08" PRIxPTR ",%" PRIu32 ",%" PRIu64,
+                    residency.owner[i].caller, residency.owner[i].count, residency.owner[i].time);
         }
+    }
+
+    return true;
+}
 
-        // Set SysTick reload value
-        SysTick->LOAD = 2097 - 1;
+void twr_system_residency_sleep_enter(void)
+{
+    twr_irq_disable();
 
-        // Update SystemCoreClock variable
-        SystemCoreClock = 2097000;
+    _twr_system_residency_update();
 
-        // Disable latency
-        FLASH->ACR &= ~(FLASH_ACR_LATENCY | FLASH_ACR_PRE_READ);
+    if (SCB->SCR & SCB_SCR_SLEEPDEEP_Msk)
+    {
+        _twr_system_residency.stopping = true;
 
-        // Set regulator range to 1.2V
-        PWR->CR |= PWR_CR_VOS;
+        _twr_system_residency.tick_stop = twr_tick_get();
+    }
+    else
+    {
+        _twr_system_residency.sleeping = true;
     }
 
-    twr_sleep_enable();
+    twr_irq_enable();
 }
 
-void twr_system_pll_enable(void)
+void twr_system_residency_sleep_exit(void)
 {
-    if (++_twr_system_pll_enable_semaphore == 1)
+    twr_irq_disable();
+
+    _twr_system_residency_update();
+
+    if (_twr_system_residency.stopping)
     {
-        twr_system_hsi16_enable();
+        // SysTick does not run in stop mode
+        _twr_system_residency.residency.time[TWR_SYSTEM_STATE_STOP] += (twr_tick_get() - _twr_system_residency.tick_stop) * 1000;
+    }
 
-        // Turn PLL on
-        RCC->CR |= RCC_CR_PLLON;
+    _twr_system_residency.sleeping = false;
+    _twr_system_residency.stopping = false;
 
-        while ((RCC->CR & RCC_CR_PLLRDY) == 0)
-        {
-            continue;
-        }
+    twr_irq_enable();
+}
 
-        _twr_system_switch_clock(TWR_SYSTEM_CLOCK_PLL);
+static void _twr_system_residency_now(uint32_t *ms, uint32_t *us)
+{
+    uint32_t value = SysTick->VAL;
 
-        // Set SysTick reload value
-        SysTick->LOAD = 32000 - 1;
+    *ms = HAL_GetTick();
 
-        // Update SystemCoreClock variable
-        SystemCoreClock = 32000000;
+    // Counter has wrapped but its interrupt is still pending
+    if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0)
+    {
+        (*ms)++;
+
+        value = SysTick->VAL;
     }
+
+    *us = (SysTick->LOAD - value) * 1000 / (SysTick->LOAD + 1);
 }
 
-void twr_system_pll_disable(void)
+static void _twr_system_residency_update(void)
 {
-    if (--_twr_system_pll_enable_semaphore == 0)
+    uint32_t ms;
+    uint32_t us;
+
+    _twr_system_residency_now(&ms, &us);
+
+    int64_t elapsed = (int64_t) (ms - _twr_system_residency.since_ms) * 1000 + us - _twr_system_residency.since_us;
+
+    // Fraction read just after change of reload value may step back
+    if (elapsed < 0)
     {
-        _twr_system_switch_clock(TWR_SYSTEM_CLOCK_HSI);
+        elapsed = 0;
+    }
+
+    _twr_system_residency.since_ms = ms;
+    _twr_system_residency.since_us = us;
 
-        // Turn PLL off
-        RCC->CR &= ~RCC_CR_PLLON;
+    // Interrupt handlers woken from stop mode are few microseconds, accounted to the clock
+    int state = _twr_system_residency.sleeping ? TWR_SYSTEM_STATE_SLEEP : _twr_system_clock.level;
 
-        while ((RCC->CR & RCC_CR_PLLRDY) != 0)
+    _twr_system_residency.residency.time[state] += elapsed;
+
+    if ((_twr_system_clock.level != _TWR_SYSTEM_LEVEL_MSI) && (_twr_system_residency.owner >= 0))
+    {
+        _twr_system_residency.residency.owner[_twr_system_residency.owner].time += elapsed;
+    }
+}
+
+static void _twr_system_residency_raise(void *caller)
+{
+    twr_system_residency_t *residency = &_twr_system_residency.residency;
+    int i;
+
+    // The last entry collects all callers beyond table size
+    for (i = 0; i < TWR_SYSTEM_RESIDENCY_OWNERS - 1; i++)
+    {
+        if ((residency->owner[i].count == 0) || (residency->owner[i].caller == (uintptr_t) caller))
         {
-            continue;
+            break;
         }
+    }
 
-        twr_system_hsi16_disable();
+    if (residency->owner[i].count == 0 || residency->owner[i].caller == (uintptr_t) caller)
+    {
+        residency->owner[i].caller = (uintptr_t) caller;
     }
+    else
+    {
+        residency->owner[i].caller = 0;
+    }
+
+    residency->owner[i].count++;
+
+    _twr_system_residency.owner = i;
 }
 
-uint32_t twr_system_get_clock(void)
+#endif
+
+__attribute__((section(".data.twr_system_sleep_ram"), noinline)) void twr_system_sleep_ram(void)
 {
-    return SystemCoreClock;
+    // Interrupt is taken only after wake-up work here is done, as this code does not wait for flash
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    bool deep = (SCB->SCR & SCB_SCR_SLEEPDEEP_Msk) != 0;
+
+    uint32_t value = SysTick->VAL;
+
+    __DSB();
+
+    __WFI();
+
+    // SysTick does not run in stop mode, so it counts only cycles after restart of the clock
+    uint32_t now = SysTick->VAL;
+    uint32_t cycles = value >= now ? value - now : value + SysTick->LOAD + 1 - now;
+
+    if (deep)
+    {
+        // RTC shadow registers are not updated in stop mode (see twr_system_sleep)
+        RTC->WPR = 0xca;
+        RTC->WPR = 0x53;
+        RTC->ISR &= ~RTC_ISR_RSF;
+        RTC->WPR = 0xff;
+    }
+
+    __set_PRIMASK(primask);
+
+#if TWR_SYSTEM_WAKE_STATS
+    if (deep)
+    {
+        _twr_system_wake_stats_record(cycles);
+    }
+#else
+    (void) cycles;
+#endif
+}
+
+void twr_system_get_wake_stats(twr_system_wake_stats_t *stats)
+{
+#if TWR_SYSTEM_WAKE_STATS
+    twr_irq_disable();
+
+    *stats = _twr_system_wake_stats;
+
+    twr_irq_enable();
+#else
+    memset(stats, 0, sizeof(*stats));
+#endif
+}
+
+void twr_system_wake_stats_reset(void)
+{
+#if TWR_SYSTEM_WAKE_STATS
+    twr_irq_disable();
+
+    memset(&_twr_system_wake_stats, 0, sizeof(_twr_system_wake_stats));
+
+    twr_irq_enable();
+#endif
+}
+
+#if TWR_SYSTEM_WAKE_STATS
+
+static void _twr_system_wake_stats_record(uint32_t cycles)
+{
+    uint32_t latency = (uint64_t) cycles * 1000000000 / SystemCoreClock;
+
+    twr_irq_disable();
+
+    _twr_system_wake_stats.count++;
+
+    _twr_system_wake_stats.latency_total += latency;
+
+    if (_twr_system_wake_stats.latency_max < latency)
+    {
+        _twr_system_wake_stats.latency_max = latency;
+    }
+
+    twr_irq_enable();
 }
 
+#endif
+
 void twr_system_reset(void)
 {
     NVIC_SystemReset();
@@ -497,7 +1050,7 @@ void HardFault_Handler(void)
     twr_system_error();
 }
 
-void RTC_IRQHandler(void)
+TWR_RAMFUNC void RTC_IRQHandler(void)
 {
     // If wake-up timer flag is set...
     if (RTC->ISR & RTC_ISR_WUTF)
@@ -505,7 +1058,11 @@ void RTC_IRQHandler(void)
         // Clear wake-up timer flag
         RTC->ISR &= ~RTC_ISR_WUTF;
 
-        twr_tick_increment_irq(TWR_SCHEDULER_INTERVAL_MS);
+        // Time spent in tickless idle is accounted on its exit
+        if (!_twr_system_tickless.active)
+        {
+            twr_tick_increment_irq(TWR_SCHEDULER_INTERVAL_MS);
+        }
     }
 
     // Clear EXTI interrupt flag
@@ -526,3 +1083,186 @@ static void _twr_system_switch_clock(twr_system_clock_t clock)
 
     twr_irq_enable();
 }
+
+static int _twr_system_clock_level(uint32_t frequency)
+{
+    for (int i = _TWR_SYSTEM_LEVEL_MSI; i < _TWR_SYSTEM_LEVEL_PLL; i++)
+    {
+        if (frequency <= _twr_system_level_frequency[i])
+        {
+            return i;
+        }
+    }
+
+    return _TWR_SYSTEM_LEVEL_PLL;
+}
+
+static void _twr_system_clock_request(int level, void *caller)
+{
+    twr_irq_disable();
+
+    _twr_system_clock.request[level]++;
+
+    twr_irq_enable();
+
+    if (level > _twr_system_clock.level)
+    {
+        _twr_system_clock_set_level(level);
+
+#if TWR_SYSTEM_RESIDENCY
+        twr_irq_disable();
+
+        _twr_system_residency_raise(caller);
+
+        twr_irq_enable();
+#else
+        (void) caller;
+#endif
+    }
+}
+
+static void _twr_system_clock_set_level(int level)
+{
+    int current = _twr_system_clock.level;
+
+#if TWR_SYSTEM_RESIDENCY
+    twr_irq_disable();
+
+    _twr_system_residency_update();
+
+    _twr_system_residency.residency.transitions++;
+
+    twr_irq_enable();
+#endif
+
+    if (level > current)
+    {
+        // HSI16 and PLL do not run in stop mode
+        if (level >= _TWR_SYSTEM_LEVEL_HSI && current < _TWR_SYSTEM_LEVEL_HSI)
+        {
+            twr_sleep_disable();
+        }
+
+        if (level == _TWR_SYSTEM_LEVEL_PLL)
+        {
+            // Set regulator range to 1.8V
+            PWR->CR = (PWR->CR & ~PWR_CR_VOS) | PWR_CR_VOS_0;
+        }
+        else if (level == _TWR_SYSTEM_LEVEL_HSI)
+        {
+            // Set regulator range to 1.5V
+            PWR->CR = (PWR->CR & ~PWR_CR_VOS) | PWR_CR_VOS_1;
+        }
+
+        // Wait for regulator before frequency is raised...
+        while ((PWR->CSR & PWR_CSR_VOSF) != 0)
+        {
+            continue;
+        }
+
+        if (level >= _TWR_SYSTEM_LEVEL_HSI)
+        {
+            // Enable flash latency and preread
+            FLASH->ACR |= FLASH_ACR_LATENCY | FLASH_ACR_PRE_READ;
+
+            // Turn HSI16 on
+            RCC->CR |= RCC_CR_HSION;
+
+            while ((RCC->CR & RCC_CR_HSIRDY) == 0)
+            {
+                continue;
+            }
+        }
+
+        if (level == _TWR_SYSTEM_LEVEL_PLL)
+        {
+            // Turn PLL on
+            RCC->CR |= RCC_CR_PLLON;
+
+            while ((RCC->CR & RCC_CR_PLLRDY) == 0)
+            {
+                continue;
+            }
+
+            _twr_system_switch_clock(TWR_SYSTEM_CLOCK_PLL);
+        }
+        else if (level == _TWR_SYSTEM_LEVEL_HSI)
+        {
+            _twr_system_switch_clock(TWR_SYSTEM_CLOCK_HSI);
+        }
+        else
+        {
+            // MSI is the system clock already, its range can change on the fly
+            RCC->ICSCR = (RCC->ICSCR & ~RCC_ICSCR_MSIRANGE_Msk) | RCC_ICSCR_MSIRANGE_6;
+        }
+    }
+    else
+    {
+        if (level == _TWR_SYSTEM_LEVEL_HSI)
+        {
+            _twr_system_switch_clock(TWR_SYSTEM_CLOCK_HSI);
+        }
+        else
+        {
+            // Range is set before MSI takes over, so the frequency never exceeds the target
+            RCC->ICSCR = (RCC->ICSCR & ~RCC_ICSCR_MSIRANGE_Msk) | (level == _TWR_SYSTEM_LEVEL_MSI_FAST ? RCC_ICSCR_MSIRANGE_6 : RCC_ICSCR_MSIRANGE_5);
+
+            _twr_system_switch_clock(TWR_SYSTEM_CLOCK_MSI);
+        }
+
+        if (current == _TWR_SYSTEM_LEVEL_PLL)
+        {
+            // Turn PLL off
+            RCC->CR &= ~RCC_CR_PLLON;
+
+            while ((RCC->CR & RCC_CR_PLLRDY) != 0)
+            {
+                continue;
+            }
+        }
+
+        if (level < _TWR_SYSTEM_LEVEL_HSI && current >= _TWR_SYSTEM_LEVEL_HSI)
+        {
+            // Turn HSI16 off
+            RCC->CR &= ~RCC_CR_HSION;
+
+            while ((RCC->CR & RCC_CR_HSIRDY) != 0)
+            {
+                continue;
+            }
+
+            // Disable latency
+            FLASH->ACR &= ~(FLASH_ACR_LATENCY | FLASH_ACR_PRE_READ);
+
+            // Set regulator range to 1.2V
+            PWR->CR |= PWR_CR_VOS;
+        }
+        else if (level == _TWR_SYSTEM_LEVEL_HSI)
+        {
+            // Set regulator range to 1.5V
+            PWR->CR = (PWR->CR & ~PWR_CR_VOS) | PWR_CR_VOS_1;
+        }
+    }
+
+    // Set SysTick reload value
+    SysTick->LOAD = _twr_system_level_frequency[level] / 1000 - 1;
+
+    // Update SystemCoreClock variable
+    SystemCoreClock = _twr_system_level_frequency[level];
+
+    _twr_system_clock.level = level;
+
+#if TWR_SYSTEM_RESIDENCY
+    twr_irq_disable();
+
+    // Fraction of millisecond is taken with new SysTick reload value from now on
+    _twr_system_residency_now(&_twr_system_residency.since_ms, &_twr_system_residency.since_us);
+
+    twr_irq_enable();
+#endif
+
+    if (level < _TWR_SYSTEM_LEVEL_HSI && current >= _TWR_SYSTEM_LEVEL_HSI)
+    {
+        twr_sleep_enable();
+    }
+}
@@ -29,3 +29,18 @@ bool twr_tag_barometer_get_pressure_pascal(twr_tag_barometer_t *self, float *pas
 {
     return twr_mpl3115a2_get_pressure_pascal(self, pascal);
 }
+
+void twr_tag_barometer_fifo_start(twr_tag_barometer_t *self, twr_mpl3115a2_fifo_mode_t mode, twr_mpl3115a2_period_t period, uint8_t watermark)
+{
+    twr_mpl3115a2_fifo_start(self, mode, period, watermark);
+}
+
+void twr_tag_barometer_fifo_stop(twr_tag_barometer_t *self)
+{
+    twr_mpl3115a2_fifo_stop(self);
+}
+
+size_t twr_tag_barometer_fifo_get(twr_tag_barometer_t *self, float *values, size_t count)
+{
+    return twr_mpl3115a2_fifo_get(self, values, count);
+}
@@ -15,6 +15,16 @@ void twr_tag_lux_meter_set_update_interval(twr_tag_lux_meter_t *self, twr_tick_t
     twr_opt3001_set_update_interval(self, interval);
 }
 
+bool twr_tag_lux_meter_set_alert(twr_tag_lux_meter_t *self, twr_exti_line_t line, float delta)
+{
+    return twr_opt3001_set_alert(self, line, delta);
+}
+
+void twr_tag_lux_meter_clear_alert(twr_tag_lux_meter_t *self)
+{
+    twr_opt3001_clear_alert(self);
+}
+
 bool twr_tag_lux_meter_measure(twr_tag_lux_meter_t *self)
 {
     return twr_opt3001_measure(self);
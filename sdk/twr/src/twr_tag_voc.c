@@ -34,3 +34,13 @@ float twr_tag_voc_set_compensation(twr_tag_voc_t *self, float *t_celsius, float
 {
     return twr_sgp30_set_compensation(self, t_celsius, rh_percentage);
 }
+
+void twr_tag_voc_set_compensation_source(twr_tag_voc_t *self, bool (*source)(void *, float *, float *), void *param)
+{
+    twr_sgp30_set_compensation_source(self, source, param);
+}
+
+void twr_tag_voc_set_baseline_key(twr_tag_voc_t *self, uint16_t key)
+{
+    twr_sgp30_set_baseline_key(self, key);
+}
@@ -1,5 +1,7 @@
 #include <twr_tag_voc_lp.h>
 
+static bool _twr_tag_voc_lp_compensation_source(void *param, float *t_celsius, float *rh_percentage);
+
 void twr_tag_voc_lp_init(twr_tag_voc_lp_t *self, twr_i2c_channel_t i2c_channel)
 {
     twr_sgpc3_init(self, i2c_channel, 0x58);
@@ -20,6 +22,16 @@ bool twr_tag_voc_lp_measure(twr_tag_voc_lp_t *self)
     return twr_sgpc3_measure(self);
 }
 
+void twr_tag_voc_lp_set_power_mode(twr_tag_voc_lp_t *self, twr_sgpc3_power_mode_t mode)
+{
+    twr_sgpc3_set_power_mode(self, mode);
+}
+
+void twr_tag_voc_lp_set_baseline_key(twr_tag_voc_lp_t *self, uint16_t key)
+{
+    twr_sgpc3_set_baseline_key(self, key);
+}
+
 bool twr_tag_voc_lp_get_tvoc_ppb(twr_tag_voc_lp_t *self, uint16_t *ppb)
 {
     return twr_sgpc3_get_tvoc_ppb(self, ppb);
@@ -29,3 +41,15 @@ float twr_tag_voc_lp_set_compensation(twr_tag_voc_lp_t *self, float *t_celsius,
 {
     return twr_sgpc3_set_compensation(self, t_celsius, rh_percentage);
 }
+
+void twr_tag_voc_lp_set_humidity_tag(twr_tag_voc_lp_t *self, twr_tag_humidity_t *tag_humidity)
+{
+    twr_sgpc3_set_compensation_source(self, tag_humidity != NULL ? _twr_tag_voc_lp_compensation_source : NULL, tag_humidity);
+}
+
+static bool _twr_tag_voc_lp_compensation_source(void *param, float *t_celsius, float *rh_percentage)
+{
+    twr_tag_humidity_t *tag_humidity = param;
+
+    return twr_tag_humidity_get_temperature_celsius(tag_humidity, t_celsius) && twr_tag_humidity_get_humidity_percentage(tag_humidity, rh_percentage);
+}
@@ -5,6 +5,17 @@
 #define TWR_TCA9534A_REGISTER_POLARITY_INVERSION 0x02
 #define TWR_TCA9534A_REGISTER_CONFIGURATION 0x03
 
+static struct
+{
+    twr_tca9534a_t *pending[TWR_TCA9534A_DEFERRED_MAX];
+    int pending_length;
+    bool task_registered;
+    twr_scheduler_task_id_t task_id;
+
+} _twr_tca9534a;
+
+static void _twr_tca9534a_flush_task(void *param);
+
 bool twr_tca9534a_init(twr_tca9534a_t *self, twr_i2c_channel_t i2c_channel, uint8_t i2c_address)
 {
     memset(self, 0, sizeof(*self));
@@ -34,16 +45,44 @@ bool twr_tca9534a_read_port(twr_tca9534a_t *self, uint8_t *value)
 
 bool twr_tca9534a_write_port(twr_tca9534a_t *self, uint8_t value)
 {
+    // Shadow is trusted unless the last write failed
+    if (!self->_output_dirty && !self->_output_pending && (value == self->_output_port))
+    {
+        return true;
+    }
+
+    self->_output_port = value;
+    self->_output_pending = false;
+
     if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, TWR_TCA9534A_REGISTER_OUTPUT_PORT, value))
     {
+        self->_output_dirty = true;
+
         return false;
     }
 
-    self->_output_port = value;
+    self->_output_dirty = false;
 
     return true;
 }
 
+bool twr_tca9534a_write_port_masked(twr_tca9534a_t *self, uint8_t mask, uint8_t value)
+{
+    return twr_tca9534a_write_port(self, (self->_output_port & ~mask) | (value & mask));
+}
+
+bool twr_tca9534a_flush(twr_tca9534a_t *self)
+{
+    if (!self->_output_dirty && !self->_output_pending)
+    {
+        return true;
+    }
+
+    self->_output_dirty = true;
+
+    return twr_tca9534a_write_port(self, self->_output_port);
+}
+
 bool twr_tca9534a_read_pin(twr_tca9534a_t *self, twr_tca9534a_pin_t pin, int *value)
 {
     uint8_t port;
@@ -59,6 +98,11 @@ bool twr_tca9534a_read_pin(twr_tca9534a_t *self, twr_tca9534a_pin_t pin, int *va
 }
 
 bool twr_tca9534a_write_pin(twr_tca9534a_t *self, twr_tca9534a_pin_t pin, int value)
+{
+    return twr_tca9534a_write_port_masked(self, 1 << (uint8_t) pin, value != 0 ? 0xff : 0x00);
+}
+
+void twr_tca9534a_write_pin_deferred(twr_tca9534a_t *self, twr_tca9534a_pin_t pin, int value)
 {
     uint8_t port = self->_output_port;
 
@@ -69,12 +113,39 @@ bool twr_tca9534a_write_pin(twr_tca9534a_t *self, twr_tca9534a_pin_t pin, int va
         port |= 1 << (uint8_t) pin;
     }
 
-    if (!twr_tca9534a_write_port(self, port))
+    if (port == self->_output_port)
     {
-        return false;
+        return;
     }
 
-    return true;
+    self->_output_port = port;
+
+    if (self->_output_pending)
+    {
+        return;
+    }
+
+    if (!_twr_tca9534a.task_registered)
+    {
+        _twr_tca9534a.task_id = twr_scheduler_register(_twr_tca9534a_flush_task, NULL, TWR_TICK_INFINITY);
+        _twr_tca9534a.task_registered = true;
+    }
+
+    // Without free entry the change is written at once
+    if (_twr_tca9534a.pending_length == TWR_TCA9534A_DEFERRED_MAX)
+    {
+        self->_output_dirty = true;
+
+        twr_tca9534a_flush(self);
+
+        return;
+    }
+
+    self->_output_pending = true;
+
+    _twr_tca9534a.pending[_twr_tca9534a.pending_length++] = self;
+
+    twr_scheduler_plan_now(_twr_tca9534a.task_id);
 }
 
 bool twr_tca9534a_get_port_direction(twr_tca9534a_t *self, uint8_t *direction)
@@ -128,3 +199,19 @@ bool twr_tca9534a_set_pin_direction(twr_tca9534a_t *self, twr_tca9534a_pin_t pin
 
     return true;
 }
+
+static void _twr_tca9534a_flush_task(void *param)
+{
+    (void) param;
+
+    for (int i = 0; i < _twr_tca9534a.pending_length; i++)
+    {
+        // Instance flushed by immediate write or initialized again meanwhile is skipped
+        if (_twr_tca9534a.pending[i]->_output_pending)
+        {
+            twr_tca9534a_flush(_twr_tca9534a.pending[i]);
+        }
+    }
+
+    _twr_tca9534a.pending_length = 0;
+}
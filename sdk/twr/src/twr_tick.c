@@ -2,35 +2,55 @@
 #include <twr_irq.h>
 #include <stm32l0xx.h>
 
-static volatile twr_tick_t _twr_tick_counter = 0;
+// Counter is kept in two words, so it can be read without disabling interrupts
+static volatile uint32_t _twr_tick_counter_low = 0;
+static volatile uint32_t _twr_tick_counter_high = 0;
 
 twr_tick_t twr_tick_get(void)
 {
-    twr_tick_t tick;
+    uint32_t high;
+    uint32_t low;
 
-    // Disable interrupts
-    twr_irq_disable();
+    // Read again if counter has been incremented in between and the high word changed
+    do
+    {
+        high = _twr_tick_counter_high;
 
-    // Get current tick counter
-    tick = _twr_tick_counter;
+        low = _twr_tick_counter_low;
 
-    // Enable interrupts
-    twr_irq_enable();
+    } while (high != _twr_tick_counter_high);
 
-    return tick;
+    return ((twr_tick_t) high << 32) | low;
+}
+
+uint32_t twr_tick_get_32(void)
+{
+    return _twr_tick_counter_low;
 }
 
 void twr_tick_wait(twr_tick_t delay)
 {
     twr_tick_t timeout = twr_tick_get() + delay;
 
+    // Sleep mode keeps peripherals clocked, periodic tick wakes up the core
+    uint32_t scr = SCB->SCR;
+
+    SCB->SCR = scr & ~SCB_SCR_SLEEPDEEP_Msk;
+
     while (twr_tick_get() < timeout)
     {
-        continue;
+        __WFI();
     }
+
+    SCB->SCR = scr;
 }
 
-void twr_tick_increment_irq(twr_tick_t delta)
+TWR_RAMFUNC void twr_tick_increment_irq(twr_tick_t delta)
 {
-    _twr_tick_counter += delta;
+    twr_tick_t counter = (((twr_tick_t) _twr_tick_counter_high << 32) | _twr_tick_counter_low) + delta;
+
+    // Low word goes first, twr_tick_get retries on the high word
+    _twr_tick_counter_low = (uint32_t) counter;
+
+    _twr_tick_counter_high = (uint32_t) (counter >> 32);
 }
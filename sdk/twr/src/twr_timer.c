@@ -11,11 +11,12 @@ twr_timer_irq_t twr_timer_tim2_irq;
 twr_timer_irq_t twr_timer_tim3_irq;
 twr_timer_irq_t twr_timer_tim6_irq;
 
-const uint16_t _twr_timer_prescaler_lut[3] =
+const uint16_t _twr_timer_prescaler_lut[4] =
 {
     2,
     15,
     31,
+    3,
 };
 
 static int _twr_timer_lock_count = 0;
@@ -23,6 +24,9 @@ static int _twr_timer_lock_count = 0;
 inline void twr_timer_init(void)
 {
     RCC->APB2ENR |= RCC_APB2ENR_TIM22EN;
+
+    // Compare interrupt wakes up long delays, it is enabled in timer only for them
+    NVIC_EnableIRQ(TIM22_IRQn);
 }
 
 inline void twr_timer_start(void)
@@ -58,12 +62,45 @@ inline uint16_t twr_timer_get_microseconds(void)
 
 inline void twr_timer_delay(uint16_t microseconds)
 {
-    uint16_t t = twr_timer_get_microseconds() + microseconds;
+    uint16_t now = twr_timer_get_microseconds();
+
+    uint16_t t = now + microseconds;
+
+    // Short delays and delays crossing counter overflow are spun as entering sleep would not pay off
+    if (microseconds < TWR_TIMER_DELAY_SLEEP_US || t < now)
+    {
+        while (twr_timer_get_microseconds() < t)
+        {
+            continue;
+        }
+
+        return;
+    }
+
+    TIM22->CCR1 = t;
+
+    TIM22->SR = ~TIM_SR_CC1IF;
 
+    TIM22->DIER |= TIM_DIER_CC1IE;
+
+    // Timer is not clocked in stop mode, sleep mode is used instead
+    uint32_t scr = SCB->SCR;
+
+    SCB->SCR = scr & ~SCB_SCR_SLEEPDEEP_Msk;
+
+    // Other interrupts wake up too, also works with interrupts disabled (pending compare interrupt ends WFI)
     while (twr_timer_get_microseconds() < t)
     {
-        continue;
+        __WFI();
     }
+
+    SCB->SCR = scr;
+
+    TIM22->DIER &= ~TIM_DIER_CC1IE;
+
+    TIM22->SR = ~TIM_SR_CC1IF;
+
+    NVIC_ClearPendingIRQ(TIM22_IRQn);
 }
 
 inline void twr_timer_clear(void)
@@ -133,6 +170,12 @@ void TIM2_IRQHandler(void)
     }
 }
 
+void TIM22_IRQHandler(void)
+{
+    // Only wakes up twr_timer_delay, which checks the counter itself
+    TIM22->SR = ~TIM_SR_CC1IF;
+}
+
 void TIM6_IRQHandler()
 {
     if (twr_timer_tim6_irq.irq_handler)
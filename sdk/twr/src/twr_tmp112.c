@@ -4,9 +4,33 @@
 #define _TWR_TMP112_DELAY_INITIALIZATION 50
 #define _TWR_TMP112_DELAY_MEASUREMENT 50
 
-static void _twr_tmp112_task_interval(void *param);
+// Configuration register bits
+#define _TWR_TMP112_CONFIG_TM 0x0200
+#define _TWR_TMP112_CONFIG_CR_POS 6
 
-static void _twr_tmp112_task_measure(void *param);
+static bool _twr_tmp112_initialize(void *param);
+
+static bool _twr_tmp112_trigger(void *param);
+
+static bool _twr_tmp112_read(void *param);
+
+static void _twr_tmp112_event(void *param, twr_sensor_event_t event);
+
+static void _twr_tmp112_reconfigure(twr_tmp112_t *self);
+
+static bool _twr_tmp112_alert_update(twr_tmp112_t *self);
+
+static void _twr_tmp112_alert_interrupt(twr_exti_line_t line, void *param);
+
+static const twr_sensor_descriptor_t _twr_tmp112_descriptor =
+{
+    .initialize = _twr_tmp112_initialize,
+    .initialization_time = _TWR_TMP112_DELAY_INITIALIZATION,
+    .trigger = _twr_tmp112_trigger,
+    .conversion_time = _TWR_TMP112_DELAY_MEASUREMENT,
+    .read = _twr_tmp112_read,
+    .event = _twr_tmp112_event
+};
 
 void twr_tmp112_init(twr_tmp112_t *self, twr_i2c_channel_t i2c_channel, uint8_t i2c_address)
 {
@@ -15,21 +39,21 @@ void twr_tmp112_init(twr_tmp112_t *self, twr_i2c_channel_t i2c_channel, uint8_t
     self->_i2c_channel = i2c_channel;
     self->_i2c_address = i2c_address;
 
-    self->_task_id_interval = twr_scheduler_register(_twr_tmp112_task_interval, self, TWR_TICK_INFINITY);
-    self->_task_id_measure = twr_scheduler_register(_twr_tmp112_task_measure, self, _TWR_TMP112_DELAY_RUN);
-
-    self->_tick_ready = _TWR_TMP112_DELAY_RUN;
+    twr_sensor_init(&self->_sensor, &_twr_tmp112_descriptor, self, _TWR_TMP112_DELAY_RUN);
 
     twr_i2c_init(self->_i2c_channel, TWR_I2C_SPEED_400_KHZ);
 }
 
 void twr_tmp112_deinit(twr_tmp112_t *self)
 {
-    twr_i2c_memory_write_16b(self->_i2c_channel, self->_i2c_address, 0x01, 0x0180);
+    if (self->_alert_active)
+    {
+        twr_exti_unregister(self->_alert_line);
+    }
 
-    twr_scheduler_unregister(self->_task_id_interval);
+    twr_i2c_memory_write_16b(self->_i2c_channel, self->_i2c_address, 0x01, 0x0180);
 
-    twr_scheduler_unregister(self->_task_id_measure);
+    twr_sensor_unregister(&self->_sensor);
 }
 
 void twr_tmp112_set_event_handler(twr_tmp112_t *self, void (*event_handler)(twr_tmp112_t *, twr_tmp112_event_t, void *), void *event_param)
@@ -40,32 +64,64 @@ void twr_tmp112_set_event_handler(twr_tmp112_t *self, void (*event_handler)(twr_
 
 void twr_tmp112_set_update_interval(twr_tmp112_t *self, twr_tick_t interval)
 {
-    self->_update_interval = interval;
+    twr_sensor_set_update_interval(&self->_sensor, interval);
+}
+
+void twr_tmp112_set_conversion(twr_tmp112_t *self, twr_tmp112_conversion_t conversion)
+{
+    self->_conversion = conversion;
+
+    _twr_tmp112_reconfigure(self);
+}
 
-    if (self->_update_interval == TWR_TICK_INFINITY)
+bool twr_tmp112_set_alert(twr_tmp112_t *self, twr_exti_line_t line, float delta)
+{
+    if (!(delta > 0.f))
     {
-        twr_scheduler_plan_absolute(self->_task_id_interval, TWR_TICK_INFINITY);
+        return false;
     }
-    else
+
+    if (self->_alert_active)
     {
-        twr_scheduler_plan_relative(self->_task_id_interval, self->_update_interval);
+        twr_exti_unregister(self->_alert_line);
+    }
+
+    self->_alert_active = true;
+    self->_alert_line = line;
+    self->_alert_delta = delta * 16.f > 2047.f ? 2047 : (int16_t) (delta * 16.f);
 
-        twr_tmp112_measure(self);
+    if (self->_alert_delta == 0)
+    {
+        self->_alert_delta = 1;
     }
+
+    twr_exti_register(line, TWR_EXTI_EDGE_FALLING, _twr_tmp112_alert_interrupt, self);
+
+    _twr_tmp112_reconfigure(self);
+
+    // First result sets the band
+    twr_tmp112_measure(self);
+
+    return true;
 }
 
-bool twr_tmp112_measure(twr_tmp112_t *self)
+void twr_tmp112_clear_alert(twr_tmp112_t *self)
 {
-    if (self->_measurement_active)
+    if (!self->_alert_active)
     {
-        return false;
+        return;
     }
 
-    self->_measurement_active = true;
+    twr_exti_unregister(self->_alert_line);
 
-    twr_scheduler_plan_absolute(self->_task_id_measure, self->_tick_ready);
+    self->_alert_active = false;
 
-    return true;
+    _twr_tmp112_reconfigure(self);
+}
+
+bool twr_tmp112_measure(twr_tmp112_t *self)
+{
+    return twr_sensor_measure(&self->_sensor);
 }
 
 bool twr_tmp112_get_temperature_raw(twr_tmp112_t *self, int16_t *raw)
@@ -127,118 +183,131 @@ bool twr_tmp112_get_temperature_kelvin(twr_tmp112_t *self, float *kelvin)
     return true;
 }
 
-static void _twr_tmp112_task_interval(void *param)
+static bool _twr_tmp112_initialize(void *param)
 {
     twr_tmp112_t *self = param;
 
-    twr_tmp112_measure(self);
+    twr_tmp112_conversion_t conversion = self->_conversion;
 
-    twr_scheduler_plan_current_relative(self->_update_interval);
-}
-
-static void _twr_tmp112_task_measure(void *param)
-{
-    twr_tmp112_t *self = param;
+    if (self->_alert_active && conversion == TWR_TMP112_CONVERSION_ONE_SHOT)
+    {
+        conversion = TWR_TMP112_CONVERSION_0_25_HZ;
+    }
 
-start:
+    uint16_t config = 0x0180;
 
-    switch (self->_state)
+    if (conversion != TWR_TMP112_CONVERSION_ONE_SHOT)
     {
-        case TWR_TMP112_STATE_ERROR:
-        {
-            self->_temperature_valid = false;
+        config = (conversion - 1) << _TWR_TMP112_CONFIG_CR_POS;
 
-            self->_measurement_active = false;
+        if (self->_alert_active)
+        {
+            config |= _TWR_TMP112_CONFIG_TM;
 
-            if (self->_event_handler != NULL)
+            // Thresholds at range limits keep ALERT quiet until the first result is known
+            if (!twr_i2c_memory_write_16b(self->_i2c_channel, self->_i2c_address, 0x02, 0x8000))
             {
-                self->_event_handler(self, TWR_TMP112_EVENT_ERROR, self->_event_param);
+                return false;
             }
 
-            self->_state = TWR_TMP112_STATE_INITIALIZE;
-
-            return;
-        }
-        case TWR_TMP112_STATE_INITIALIZE:
-        {
-            self->_state = TWR_TMP112_STATE_ERROR;
-
-            if (!twr_i2c_memory_write_16b(self->_i2c_channel, self->_i2c_address, 0x01, 0x0180))
+            if (!twr_i2c_memory_write_16b(self->_i2c_channel, self->_i2c_address, 0x03, 0x7ff0))
             {
-                goto start;
+                return false;
             }
+        }
+    }
 
-            self->_state = TWR_TMP112_STATE_MEASURE;
+    return twr_i2c_memory_write_16b(self->_i2c_channel, self->_i2c_address, 0x01, config);
+}
 
-            self->_tick_ready = twr_tick_get() + _TWR_TMP112_DELAY_INITIALIZATION;
+static bool _twr_tmp112_trigger(void *param)
+{
+    twr_tmp112_t *self = param;
 
-            if (self->_measurement_active)
-            {
-                twr_scheduler_plan_current_absolute(self->_tick_ready);
-            }
+    return twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x01, 0x81);
+}
+
+static bool _twr_tmp112_read(void *param)
+{
+    twr_tmp112_t *self = param;
+
+    if (self->_conversion == TWR_TMP112_CONVERSION_ONE_SHOT && !self->_alert_active)
+    {
+        uint8_t reg_configuration;
 
-            return;
+        if (!twr_i2c_memory_read_8b(self->_i2c_channel, self->_i2c_address, 0x01, &reg_configuration))
+        {
+            return false;
         }
-        case TWR_TMP112_STATE_MEASURE:
+
+        if ((reg_configuration & 0x81) != 0x81)
         {
-            self->_state = TWR_TMP112_STATE_ERROR;
+            return false;
+        }
+    }
 
-            if (!twr_i2c_memory_write_8b(self->_i2c_channel, self->_i2c_address, 0x01, 0x81))
-            {
-                goto start;
-            }
+    // Reading clears ALERT in interrupt mode
+    if (!twr_i2c_memory_read_16b(self->_i2c_channel, self->_i2c_address, 0x00, &self->_reg_temperature))
+    {
+        return false;
+    }
 
-            self->_state = TWR_TMP112_STATE_READ;
+    if (self->_alert_active && !_twr_tmp112_alert_update(self))
+    {
+        return false;
+    }
 
-            twr_scheduler_plan_current_from_now(_TWR_TMP112_DELAY_MEASUREMENT);
+    self->_temperature_valid = true;
 
-            return;
-        }
-        case TWR_TMP112_STATE_READ:
-        {
-            self->_state = TWR_TMP112_STATE_ERROR;
+    return true;
+}
 
-            uint8_t reg_configuration;
+static void _twr_tmp112_event(void *param, twr_sensor_event_t event)
+{
+    twr_tmp112_t *self = param;
 
-            if (!twr_i2c_memory_read_8b(self->_i2c_channel, self->_i2c_address, 0x01, &reg_configuration))
-            {
-                goto start;
-            }
+    if (event == TWR_SENSOR_EVENT_ERROR)
+    {
+        self->_temperature_valid = false;
+    }
 
-            if ((reg_configuration & 0x81) != 0x81)
-            {
-                goto start;
-            }
+    if (self->_event_handler != NULL)
+    {
+        self->_event_handler(self, event == TWR_SENSOR_EVENT_ERROR ? TWR_TMP112_EVENT_ERROR : TWR_TMP112_EVENT_UPDATE, self->_event_param);
+    }
+}
 
-            if (!twr_i2c_memory_read_16b(self->_i2c_channel, self->_i2c_address, 0x00, &self->_reg_temperature))
-            {
-                goto start;
-            }
+static void _twr_tmp112_reconfigure(twr_tmp112_t *self)
+{
+    // Continuous conversion has the last result ready all the time
+    bool continuous = self->_conversion != TWR_TMP112_CONVERSION_ONE_SHOT || self->_alert_active;
 
-            self->_temperature_valid = true;
+    twr_sensor_set_conversion_time(&self->_sensor, continuous ? 0 : _TWR_TMP112_DELAY_MEASUREMENT);
 
-            self->_state = TWR_TMP112_STATE_UPDATE;
+    // Configuration is written again before next measurement
+    twr_sensor_reinitialize(&self->_sensor);
+}
 
-            goto start;
-        }
-        case TWR_TMP112_STATE_UPDATE:
-        {
-            self->_measurement_active = false;
+static bool _twr_tmp112_alert_update(twr_tmp112_t *self)
+{
+    int16_t raw = (int16_t) self->_reg_temperature >> 4;
 
-            if (self->_event_handler != NULL)
-            {
-                self->_event_handler(self, TWR_TMP112_EVENT_UPDATE, self->_event_param);
-            }
+    int16_t low = raw - self->_alert_delta < -2048 ? -2048 : raw - self->_alert_delta;
+    int16_t high = raw + self->_alert_delta > 2047 ? 2047 : raw + self->_alert_delta;
 
-            self->_state = TWR_TMP112_STATE_MEASURE;
+    if (!twr_i2c_memory_write_16b(self->_i2c_channel, self->_i2c_address, 0x02, (uint16_t) (low << 4)))
+    {
+        return false;
+    }
 
-            return;
-        }
-        default:
-        {
-            self->_state = TWR_TMP112_STATE_ERROR;
+    return twr_i2c_memory_write_16b(self->_i2c_channel, self->_i2c_address, 0x03, (uint16_t) (high << 4));
+}
 
-            goto start;
-        }
-    }
+static void _twr_tmp112_alert_interrupt(twr_exti_line_t line, void *param)
+{
+    (void) line;
+
+    twr_tmp112_t *self = param;
+
+    twr_sensor_signal(&self->_sensor);
 }
@@ -0,0 +1,269 @@
+#include <twr_trace.h>
+
+#if TWR_TRACE
+
+#include <twr_scheduler.h>
+#include <twr_irq.h>
+#include <twr_tick.h>
+#include <twr_crc.h>
+#include <stm32l0xx.h>
+#include <stm32l0xx_hal_conf.h>
+
+#define _TWR_TRACE_SYNC 0x5a
+
+#define _TWR_TRACE_MASK (TWR_TRACE_SIZE - 1)
+
+#if (TWR_TRACE_SIZE & _TWR_TRACE_MASK) != 0
+#error "TWR_TRACE_SIZE has to be power of 2"
+#endif
+
+static struct
+{
+    twr_trace_record_t ring[TWR_TRACE_SIZE];
+
+    // Free-running indexes, their difference is number of records in ring
+    uint32_t head;
+    uint32_t tail;
+
+    uint32_t lost;
+    uint32_t lost_streamed;
+
+    // Milliseconds of stop mode not counted by SysTick
+    uint32_t offset;
+    bool stopping;
+    twr_tick_t tick_stop;
+    uint32_t ms_stop;
+
+    twr_transport_t *transport;
+    twr_scheduler_task_id_t task_id;
+    bool task_registered;
+
+} _twr_trace;
+
+static void _twr_trace_task(void *param);
+static size_t _twr_trace_peek(twr_trace_record_t *records, size_t count);
+static void _twr_trace_consume(size_t count);
+
+static uint32_t _twr_trace_ms(uint32_t *value)
+{
+    *value = SysTick->VAL;
+
+    uint32_t ms = HAL_GetTick();
+
+    // Counter has wrapped but its interrupt is still pending
+    if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0)
+    {
+        ms++;
+
+        *value = SysTick->VAL;
+    }
+
+    return ms;
+}
+
+static uint32_t _twr_trace_now(void)
+{
+    uint32_t value;
+
+    uint32_t ms = _twr_trace_ms(&value) + _twr_trace.offset;
+
+    return ms * 1000 + (SysTick->LOAD - value) * 1000 / (SysTick->LOAD + 1);
+}
+
+void twr_trace_record(twr_trace_event_t event, uint8_t id, uint16_t arg)
+{
+    uint32_t primask = twr_irq_save();
+
+    twr_trace_record_t *record = &_twr_trace.ring[_twr_trace.head++ & _TWR_TRACE_MASK];
+
+    record->timestamp = _twr_trace_now();
+    record->event = event;
+    record->id = id;
+    record->arg = arg;
+
+    twr_irq_restore(primask);
+}
+
+void twr_trace_set_transport(twr_transport_t *transport)
+{
+    _twr_trace.transport = transport;
+
+    if (!_twr_trace.task_registered)
+    {
+        _twr_trace.task_id = twr_scheduler_register(_twr_trace_task, NULL, 0);
+
+        _twr_trace.task_registered = true;
+    }
+}
+
+size_t twr_trace_read(twr_trace_record_t *records, size_t count)
+{
+    count = _twr_trace_peek(records, count);
+
+    _twr_trace_consume(count);
+
+    return count;
+}
+
+uint32_t twr_trace_get_lost(void)
+{
+    return _twr_trace.lost;
+}
+
+void twr_trace_sleep_enter(void)
+{
+    bool stop = (SCB->SCR & SCB_SCR_SLEEPDEEP_Msk) != 0;
+
+    twr_trace_record(TWR_TRACE_EVENT_SLEEP, stop, 0);
+
+    if (stop)
+    {
+        uint32_t value;
+
+        _twr_trace.ms_stop = _twr_trace_ms(&value);
+
+        _twr_trace.tick_stop = twr_tick_get();
+
+        _twr_trace.stopping = true;
+    }
+}
+
+void twr_trace_sleep_exit(void)
+{
+    // SysTick does not run in stop mode, missing time is taken from tick
+    if (_twr_trace.stopping)
+    {
+        uint32_t value;
+
+        uint32_t ms = _twr_trace_ms(&value) - _twr_trace.ms_stop;
+
+        uint32_t elapsed = (uint32_t) (twr_tick_get() - _twr_trace.tick_stop);
+
+        if (elapsed > ms)
+        {
+            _twr_trace.offset += elapsed - ms;
+        }
+
+        _twr_trace.stopping = false;
+    }
+
+    twr_trace_record(TWR_TRACE_EVENT_WAKE, 0, 0);
+}
+
+static void _twr_trace_task(void *param)
+{
+    (void) param;
+
+    twr_trace_record_t records[TWR_TRACE_STREAM_RECORDS];
+
+    // Whole ring at most, so records of this task do not keep it running
+    for (size_t i = 0; i < TWR_TRACE_SIZE / TWR_TRACE_STREAM_RECORDS + 1; i++)
+    {
+        if (_twr_trace.transport == NULL || !twr_transport_is_ready(_twr_trace.transport))
+        {
+            break;
+        }
+
+        size_t count = 0;
+
+        uint32_t lost = _twr_trace.lost;
+
+        if (lost != _twr_trace.lost_streamed)
+        {
+            uint32_t delta = lost - _twr_trace.lost_streamed;
+
+            uint32_t primask = twr_irq_save();
+
+            records[0].timestamp = _twr_trace_now();
+
+            twr_irq_restore(primask);
+
+            records[0].event = TWR_TRACE_EVENT_LOST;
+            records[0].id = 0;
+            records[0].arg = delta > UINT16_MAX ? UINT16_MAX : delta;
+
+            count = 1;
+        }
+
+        size_t peeked = _twr_trace_peek(records + count, TWR_TRACE_STREAM_RECORDS - count);
+
+        count += peeked;
+
+        if (count == 0)
+        {
+            break;
+        }
+
+        uint8_t header[2] = { _TWR_TRACE_SYNC, count };
+
+        // CRC without final XOR continues from CRC of preceding data
+        uint16_t crc = twr_crc16(0x1021, &header[1], 1, 0xffff);
+
+        crc = twr_crc16(0x1021, records, count * sizeof(twr_trace_record_t), crc);
+
+        uint8_t trailer[2] = { crc, crc >> 8 };
+
+        twr_transport_segment_t segments[3] =
+        {
+            { header, sizeof(header) },
+            { records, count * sizeof(twr_trace_record_t) },
+            { trailer, sizeof(trailer) }
+        };
+
+        if (twr_transport_writev(_twr_trace.transport, segments, 3) == 0)
+        {
+            break;
+        }
+
+        _twr_trace.lost_streamed = lost;
+
+        _twr_trace_consume(peeked);
+    }
+
+    if (_twr_trace.transport != NULL)
+    {
+        twr_transport_flush(_twr_trace.transport);
+    }
+
+    twr_scheduler_plan_current_relative(TWR_TRACE_STREAM_INTERVAL_MS);
+}
+
+static size_t _twr_trace_peek(twr_trace_record_t *records, size_t count)
+{
+    uint32_t primask = twr_irq_save();
+
+    // Records overwritten by writer are skipped
+    if (_twr_trace.head - _twr_trace.tail > TWR_TRACE_SIZE)
+    {
+        _twr_trace.lost += _twr_trace.head - _twr_trace.tail - TWR_TRACE_SIZE;
+
+        _twr_trace.tail = _twr_trace.head - TWR_TRACE_SIZE;
+    }
+
+    size_t length = _twr_trace.head - _twr_trace.tail;
+
+    if (count > length)
+    {
+        count = length;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        records[i] = _twr_trace.ring[(_twr_trace.tail + i) & _TWR_TRACE_MASK];
+    }
+
+    twr_irq_restore(primask);
+
+    return count;
+}
+
+static void _twr_trace_consume(size_t count)
+{
+    uint32_t primask = twr_irq_save();
+
+    _twr_trace.tail += count;
+
+    twr_irq_restore(primask);
+}
+
+#endif
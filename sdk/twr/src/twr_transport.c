@@ -0,0 +1,122 @@
+#include <twr_transport.h>
+
+static size_t _twr_transport_fanout_writev(twr_transport_t *self, const twr_transport_segment_t *segments, size_t count);
+static bool _twr_transport_fanout_flush(twr_transport_t *self);
+static bool _twr_transport_fanout_ready(twr_transport_t *self);
+
+static const twr_transport_driver_t _twr_transport_driver_fanout =
+{
+    .writev = _twr_transport_fanout_writev,
+    .flush = _twr_transport_fanout_flush,
+    .ready = _twr_transport_fanout_ready
+};
+
+void twr_transport_init(twr_transport_t *self, const twr_transport_driver_t *driver, int channel)
+{
+    memset(self, 0, sizeof(*self));
+
+    self->_driver = driver;
+    self->_channel = channel;
+}
+
+void twr_transport_init_fanout(twr_transport_t *self, twr_transport_t **member, size_t count)
+{
+    memset(self, 0, sizeof(*self));
+
+    self->_driver = &_twr_transport_driver_fanout;
+
+    if (count > TWR_TRANSPORT_FANOUT_MAX)
+    {
+        count = TWR_TRANSPORT_FANOUT_MAX;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        self->_member[i] = member[i];
+    }
+
+    self->_member_count = count;
+}
+
+size_t twr_transport_write(twr_transport_t *self, const void *buffer, size_t length)
+{
+    twr_transport_segment_t segment = { .buffer = buffer, .length = length };
+
+    return twr_transport_writev(self, &segment, 1);
+}
+
+size_t twr_transport_writev(twr_transport_t *self, const twr_transport_segment_t *segments, size_t count)
+{
+    return self->_driver->writev(self, segments, count);
+}
+
+bool twr_transport_flush(twr_transport_t *self)
+{
+    if (self->_driver->flush == NULL)
+    {
+        return true;
+    }
+
+    return self->_driver->flush(self);
+}
+
+bool twr_transport_is_ready(twr_transport_t *self)
+{
+    if (self->_driver->ready == NULL)
+    {
+        return true;
+    }
+
+    return self->_driver->ready(self);
+}
+
+static size_t _twr_transport_fanout_writev(twr_transport_t *self, const twr_transport_segment_t *segments, size_t count)
+{
+    size_t written = 0;
+
+    for (size_t i = 0; i < self->_member_count; i++)
+    {
+        // Member which can not deliver does not hold up the others
+        if (!twr_transport_is_ready(self->_member[i]))
+        {
+            continue;
+        }
+
+        size_t length = twr_transport_writev(self->_member[i], segments, count);
+
+        if (length > written)
+        {
+            written = length;
+        }
+    }
+
+    return written;
+}
+
+static bool _twr_transport_fanout_flush(twr_transport_t *self)
+{
+    bool success = true;
+
+    for (size_t i = 0; i < self->_member_count; i++)
+    {
+        if (!twr_transport_flush(self->_member[i]))
+        {
+            success = false;
+        }
+    }
+
+    return success;
+}
+
+static bool _twr_transport_fanout_ready(twr_transport_t *self)
+{
+    for (size_t i = 0; i < self->_member_count; i++)
+    {
+        if (twr_transport_is_ready(self->_member[i]))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -5,6 +5,8 @@
 #include <stm32l0xx.h>
 #include <twr_dma.h>
 #include <twr_gpio.h>
+#include <twr_sleep.h>
+#include <twr_trace.h>
 
 typedef struct
 {
@@ -17,7 +19,22 @@ typedef struct
     twr_scheduler_task_id_t async_read_task_id;
     bool async_write_in_progress;
     bool async_read_in_progress;
+    bool async_write_dma;
+    bool async_write_dma_active;
+    size_t async_write_dma_length;
+    twr_dma_channel_t async_write_dma_channel;
+    twr_dma_request_t async_write_dma_request;
+    bool async_read_dma_active;
+    twr_dma_channel_t async_read_dma_channel;
+    twr_dma_request_t async_read_dma_request;
+    volatile uint32_t async_read_dma_wraps;
+    uint32_t async_read_dma_wraps_committed;
+    bool async_read_overrun;
     twr_tick_t async_timeout;
+    bool flow_control;
+    twr_tick_t clock_linger;
+    twr_scheduler_task_id_t clock_linger_task_id;
+    bool clock_lingering;
     USART_TypeDef *usart;
 
 } twr_uart_t;
@@ -29,32 +46,73 @@ static twr_uart_t _twr_uart[3] =
     [TWR_UART_UART2] = { .initialized = false }
 };
 
-static struct
-{
-    twr_scheduler_task_id_t read_task_id;
-    size_t length;
-
-} _twr_uart_2_dma;
+// USARTs are clocked by PLL while in use, LPUART1 by HSI16
+#define _TWR_UART_USART_CLOCK 32000000
+#define _TWR_UART_LPUART1_CLOCK 16000000
 
-static uint32_t _twr_uart_brr_t[] =
+static const uint32_t _twr_uart_baudrate_lut[] =
 {
-    [TWR_UART_BAUDRATE_9600] = 0xd05,
-    [TWR_UART_BAUDRATE_19200] = 0x682,
-    [TWR_UART_BAUDRATE_38400] = 0x341,
-    [TWR_UART_BAUDRATE_57600] = 0x22b,
-    [TWR_UART_BAUDRATE_115200] = 0x116,
-    [TWR_UART_BAUDRATE_921600] = 0x22
+    [TWR_UART_BAUDRATE_9600] = 9600,
+    [TWR_UART_BAUDRATE_19200] = 19200,
+    [TWR_UART_BAUDRATE_38400] = 38400,
+    [TWR_UART_BAUDRATE_57600] = 57600,
+    [TWR_UART_BAUDRATE_115200] = 115200,
+    [TWR_UART_BAUDRATE_921600] = 921600,
+    [TWR_UART_BAUDRATE_230400] = 230400,
+    [TWR_UART_BAUDRATE_460800] = 460800
 };
 
 static void _twr_uart_async_write_task(void *param);
+
+static void _twr_uart_clock_disable(twr_uart_t *uart);
+
+static void _twr_uart_clock_acquire(twr_uart_channel_t channel);
+
+static void _twr_uart_clock_release(twr_uart_channel_t channel);
+
+static void _twr_uart_clock_linger_task(void *param);
 static void _twr_uart_async_read_task(void *param);
-static void _twr_uart_2_dma_read_task(void *param);
+static bool _twr_uart_async_read_dma_acquire(twr_uart_channel_t channel);
+static void _twr_uart_async_read_dma_release(twr_uart_channel_t channel);
+static bool _twr_uart_async_read_dma_commit(twr_uart_t *uart);
+static void _twr_uart_dma_rx_event_handler(twr_dma_channel_t channel, twr_dma_event_t event, void *event_param);
+static twr_dma_line_t _twr_uart_dma_line(twr_uart_t *uart, bool transmit);
+static bool _twr_uart_async_write_dma_acquire(twr_uart_channel_t channel);
+static void _twr_uart_async_write_dma_release(twr_uart_channel_t channel);
+static void _twr_uart_async_write_dma_next(twr_uart_channel_t channel);
+static void _twr_uart_dma_tx_event_handler(twr_dma_channel_t channel, twr_dma_event_t event, void *event_param);
 static void _twr_uart_irq_handler(twr_uart_channel_t channel);
+static bool _twr_uart_get_brr(bool lpuart, uint32_t baudrate, uint32_t *brr, uint32_t *over8);
+static size_t _twr_uart_transport_writev(twr_transport_t *self, const twr_transport_segment_t *segments, size_t count);
+static bool _twr_uart_transport_ready(twr_transport_t *self);
 
 void twr_uart_init(twr_uart_channel_t channel, twr_uart_baudrate_t baudrate, twr_uart_setting_t setting)
 {
+    twr_uart_init_baudrate(channel, _twr_uart_baudrate_lut[baudrate], setting);
+}
+
+bool twr_uart_init_baudrate(twr_uart_channel_t channel, uint32_t baudrate, twr_uart_setting_t setting)
+{
+    bool lpuart = channel == TWR_UART_UART1 && baudrate <= TWR_UART_LPUART1_MAX_BAUDRATE;
+    bool flow_control = (setting & TWR_UART_SETTING_FLOW_CONTROL) != 0;
+    uint32_t brr;
+    uint32_t over8;
+
+    if (channel > TWR_UART_UART2 || !_twr_uart_get_brr(lpuart, baudrate, &brr, &over8))
+    {
+        return false;
+    }
+
+    // RTS and CTS are routed to header pins for UART1 only
+    if (flow_control && channel != TWR_UART_UART1)
+    {
+        return false;
+    }
+
     memset(&_twr_uart[channel], 0, sizeof(_twr_uart[channel]));
 
+    _twr_uart[channel].flow_control = flow_control;
+
     switch(channel)
     {
         case TWR_UART_UART0:
@@ -76,13 +134,13 @@ void twr_uart_init(twr_uart_channel_t channel, twr_uart_baudrate_t baudrate, twr
             RCC->APB1ENR;
 
             // Enable transmitter and receiver, peripheral enabled in stop mode
-            USART4->CR1 = USART_CR1_TE | USART_CR1_RE | USART_CR1_UESM;
+            USART4->CR1 = USART_CR1_TE | USART_CR1_RE | USART_CR1_UESM | over8;
 
             // Clock enabled in stop mode, disable overrun detection, one bit sampling method
             USART4->CR3 = USART_CR3_UCESM | USART_CR3_OVRDIS | USART_CR3_ONEBIT;
 
             // Configure baudrate
-            USART4->BRR = _twr_uart_brr_t[baudrate];
+            USART4->BRR = brr;
 
             NVIC_EnableIRQ(USART4_5_IRQn);
 
@@ -99,12 +157,22 @@ void twr_uart_init(twr_uart_channel_t channel, twr_uart_baudrate_t baudrate, twr
             // Enable pull-up on RXD1 pin
             twr_gpio_set_pull(TWR_GPIO_P3, TWR_GPIO_PULL_UP);
 
-            if (baudrate <= TWR_UART_BAUDRATE_9600)
+            if (lpuart)
             {
                 // Select AF6 alternate function for TXD1 and RXD1 pins
                 twr_gpio_set_mode(TWR_GPIO_P2, TWR_GPIO_MODE_ALTERNATE_6);
                 twr_gpio_set_mode(TWR_GPIO_P3, TWR_GPIO_MODE_ALTERNATE_6);
 
+                if (flow_control)
+                {
+                    twr_gpio_init(TWR_GPIO_P7); // CTS1
+                    twr_gpio_init(TWR_GPIO_P6); // RTS1
+
+                    // Select AF4 alternate function for CTS1 and RTS1 pins
+                    twr_gpio_set_mode(TWR_GPIO_P7, TWR_GPIO_MODE_ALTERNATE_4);
+                    twr_gpio_set_mode(TWR_GPIO_P6, TWR_GPIO_MODE_ALTERNATE_4);
+                }
+
                 // Set HSI16 as LPUART1 clock source
                 RCC->CCIPR |= RCC_CCIPR_LPUART1SEL_1;
                 RCC->CCIPR &= ~RCC_CCIPR_LPUART1SEL_0;
@@ -121,8 +189,8 @@ void twr_uart_init(twr_uart_channel_t channel, twr_uart_baudrate_t baudrate, twr
                 // Clock disabled in stop mode, disable overrun detection, one bit sampling method
                 LPUART1->CR3 = USART_CR3_OVRDIS | USART_CR3_ONEBIT;
 
-                // Configure baudrate (256 * 16E6 / 9600)
-                LPUART1->BRR = 426667;
+                // Configure baudrate (256 * 16E6 / baudrate)
+                LPUART1->BRR = brr;
 
                 NVIC_EnableIRQ(LPUART1_IRQn);
 
@@ -134,6 +202,16 @@ void twr_uart_init(twr_uart_channel_t channel, twr_uart_baudrate_t baudrate, twr
                 twr_gpio_set_mode(TWR_GPIO_P2, TWR_GPIO_MODE_ALTERNATE_4);
                 twr_gpio_set_mode(TWR_GPIO_P3, TWR_GPIO_MODE_ALTERNATE_4);
 
+                if (flow_control)
+                {
+                    twr_gpio_init(TWR_GPIO_P0); // CTS1
+                    twr_gpio_init(TWR_GPIO_P1); // RTS1
+
+                    // Select AF4 alternate function for CTS1 and RTS1 pins
+                    twr_gpio_set_mode(TWR_GPIO_P0, TWR_GPIO_MODE_ALTERNATE_4);
+                    twr_gpio_set_mode(TWR_GPIO_P1, TWR_GPIO_MODE_ALTERNATE_4);
+                }
+
                 // Enable clock for USART2
                 RCC->APB1ENR |= RCC_APB1ENR_USART2EN;
 
@@ -141,13 +219,13 @@ void twr_uart_init(twr_uart_channel_t channel, twr_uart_baudrate_t baudrate, twr
                 RCC->APB1ENR;
 
                 // Enable transmitter and receiver, peripheral enabled in stop mode
-                USART2->CR1 = USART_CR1_TE | USART_CR1_RE | USART_CR1_UESM;
+                USART2->CR1 = USART_CR1_TE | USART_CR1_RE | USART_CR1_UESM | over8;
 
                 // Clock enabled in stop mode, disable overrun detection, one bit sampling method
                 USART2->CR3 = USART_CR3_UCESM | USART_CR3_OVRDIS | USART_CR3_ONEBIT;
 
                 // Configure baudrate
-                USART2->BRR = _twr_uart_brr_t[baudrate];
+                USART2->BRR = brr;
 
                 NVIC_EnableIRQ(USART2_IRQn);
 
@@ -175,13 +253,13 @@ void twr_uart_init(twr_uart_channel_t channel, twr_uart_baudrate_t baudrate, twr
             RCC->APB2ENR;
 
             // Enable transmitter and receiver, peripheral enabled in stop mode
-            USART1->CR1 = USART_CR1_TE | USART_CR1_RE | USART_CR1_UESM;
+            USART1->CR1 = USART_CR1_TE | USART_CR1_RE | USART_CR1_UESM | over8;
 
             // Clock enabled in stop mode, disable overrun detection, one bit sampling method
             USART1->CR3 = USART_CR3_UCESM | USART_CR3_OVRDIS | USART_CR3_ONEBIT;
 
             // Configure baudrate
-            USART1->BRR = _twr_uart_brr_t[baudrate];
+            USART1->BRR = brr;
 
             NVIC_EnableIRQ(USART1_IRQn);
 
@@ -191,7 +269,7 @@ void twr_uart_init(twr_uart_channel_t channel, twr_uart_baudrate_t baudrate, twr
         }
         default:
         {
-            return;
+            return false;
         }
     }
 
@@ -206,10 +284,16 @@ void twr_uart_init(twr_uart_channel_t channel, twr_uart_baudrate_t baudrate, twr
     _twr_uart[channel].usart->CR1 &= ~(USART_CR1_PCE_Msk | USART_CR1_PS_Msk);
     _twr_uart[channel].usart->CR1 |= (((uint32_t) setting >> 2) & 0x03) << USART_CR1_PS_Pos;
 
+    // Hardware flow control, transmitter pauses while CTS is high, RTS is raised while receive data register is full
+    if (flow_control)
+    {
+        _twr_uart[channel].usart->CR3 |= USART_CR3_CTSE | USART_CR3_RTSE;
+    }
+
     // Word length
     _twr_uart[channel].usart->CR1 &= ~(USART_CR1_M1_Msk | USART_CR1_M0_Msk);
 
-    uint32_t word_length = setting >> 4;
+    uint32_t word_length = (setting >> 4) & 0x0f;
 
     if ((setting & 0x0c) != 0)
     {
@@ -231,6 +315,67 @@ void twr_uart_init(twr_uart_channel_t channel, twr_uart_baudrate_t baudrate, twr
     _twr_uart[channel].usart->CR1 |= USART_CR1_UE;
 
     _twr_uart[channel].initialized = true;
+
+    return true;
+}
+
+static bool _twr_uart_get_brr(bool lpuart, uint32_t baudrate, uint32_t *brr, uint32_t *over8)
+{
+    if (baudrate == 0)
+    {
+        return false;
+    }
+
+    uint64_t clock;
+    uint64_t divider;
+
+    *over8 = 0;
+
+    if (lpuart)
+    {
+        // LPUART1 divider is 256 * fck / baudrate, it must be at least 0x300 and fit in 20 bits
+        clock = (uint64_t) _TWR_UART_LPUART1_CLOCK * 256;
+
+        divider = (clock + baudrate / 2) / baudrate;
+
+        if (divider < 0x300 || divider > 0xfffff)
+        {
+            return false;
+        }
+
+        *brr = divider;
+    }
+    else
+    {
+        clock = _TWR_UART_USART_CLOCK;
+
+        divider = (clock + baudrate / 2) / baudrate;
+
+        uint64_t error = divider * baudrate > clock ? divider * baudrate - clock : clock - divider * baudrate;
+
+        if (divider < 16 || error * 1000 > clock * TWR_UART_BAUDRATE_TOLERANCE)
+        {
+            // Oversampling by 8 doubles reachable baudrate and halves the divider step
+            clock *= 2;
+
+            divider = (clock + baudrate / 2) / baudrate;
+
+            *over8 = USART_CR1_OVER8;
+        }
+
+        if (divider < 16 || divider > 0xffff)
+        {
+            return false;
+        }
+
+        // Oversampling by 8 keeps fraction in BRR[2:0] shifted right by one (BRR[3] must stay clear)
+        *brr = *over8 != 0 ? (divider & 0xfff0) | ((divider & 0x000f) >> 1) : divider;
+    }
+
+    // Actual baudrate is clock / divider, compare it with the requested one
+    uint64_t error = divider * baudrate > clock ? divider * baudrate - clock : clock - divider * baudrate;
+
+    return error * 1000 <= clock * TWR_UART_BAUDRATE_TOLERANCE;
 }
 
 
@@ -245,6 +390,29 @@ void twr_uart_deinit(twr_uart_channel_t channel)
         twr_scheduler_unregister(_twr_uart[channel].async_write_task_id);
     }
 
+    if (_twr_uart[channel].clock_linger_task_id != 0)
+    {
+        twr_scheduler_unregister(_twr_uart[channel].clock_linger_task_id);
+
+        _twr_uart[channel].clock_linger_task_id = 0;
+    }
+
+    if (_twr_uart[channel].clock_lingering)
+    {
+        _twr_uart[channel].clock_lingering = false;
+
+        _twr_uart_clock_disable(&_twr_uart[channel]);
+    }
+
+    if (_twr_uart[channel].async_write_dma_active)
+    {
+        twr_dma_channel_stop(_twr_uart[channel].async_write_dma_channel);
+
+        _twr_uart[channel].usart->CR3 &= ~USART_CR3_DMAT_Msk;
+
+        _twr_uart_async_write_dma_release(channel);
+    }
+
     switch(channel)
     {
         case TWR_UART_UART0:
@@ -285,6 +453,21 @@ void twr_uart_deinit(twr_uart_channel_t channel)
             // Configure TXD1 and RXD1 pins as Analog
             twr_gpio_set_mode(TWR_GPIO_P2, TWR_GPIO_MODE_ANALOG);
             twr_gpio_set_mode(TWR_GPIO_P3, TWR_GPIO_MODE_ANALOG);
+
+            if (_twr_uart[channel].flow_control)
+            {
+                // Configure CTS1 and RTS1 pins as Analog
+                if (_twr_uart[channel].usart == LPUART1)
+                {
+                    twr_gpio_set_mode(TWR_GPIO_P7, TWR_GPIO_MODE_ANALOG);
+                    twr_gpio_set_mode(TWR_GPIO_P6, TWR_GPIO_MODE_ANALOG);
+                }
+                else
+                {
+                    twr_gpio_set_mode(TWR_GPIO_P0, TWR_GPIO_MODE_ANALOG);
+                    twr_gpio_set_mode(TWR_GPIO_P1, TWR_GPIO_MODE_ANALOG);
+                }
+            }
             break;
         }
         case TWR_UART_UART2:
@@ -312,6 +495,13 @@ void twr_uart_deinit(twr_uart_channel_t channel)
 }
 
 size_t twr_uart_write(twr_uart_channel_t channel, const void *buffer, size_t length)
+{
+    twr_uart_segment_t segment = { .buffer = buffer, .length = length };
+
+    return twr_uart_writev(channel, &segment, 1);
+}
+
+size_t twr_uart_writev(twr_uart_channel_t channel, const twr_uart_segment_t *segments, size_t count)
 {
     if (!_twr_uart[channel].initialized || _twr_uart[channel].async_write_in_progress)
     {
@@ -322,23 +512,25 @@ size_t twr_uart_write(twr_uart_channel_t channel, const void *buffer, size_t len
 
     size_t bytes_written = 0;
 
-    if (_twr_uart[channel].usart == LPUART1)
-    {
-        twr_system_hsi16_enable();
-    } else {
-        twr_system_pll_enable();
-    }
+    _twr_uart_clock_acquire(channel);
 
-    while (bytes_written != length)
+    for (size_t i = 0; i < count; i++)
     {
-        // Until transmit data register is not empty...
-        while ((usart->ISR & USART_ISR_TXE) == 0)
+        const uint8_t *buffer = segments[i].buffer;
+
+        for (size_t j = 0; j < segments[i].length; j++)
         {
-            continue;
+            // Until transmit data register is not empty...
+            while ((usart->ISR & USART_ISR_TXE) == 0)
+            {
+                continue;
+            }
+
+            // Load transmit data register
+            usart->TDR = buffer[j];
         }
 
-        // Load transmit data register
-        usart->TDR = *((uint8_t *) buffer + bytes_written++);
+        bytes_written += segments[i].length;
     }
 
     // Until transmission is not complete...
@@ -347,16 +539,51 @@ size_t twr_uart_write(twr_uart_channel_t channel, const void *buffer, size_t len
         continue;
     }
 
-    if (_twr_uart[channel].usart == LPUART1)
+    _twr_uart_clock_release(channel);
+
+    return bytes_written;
+}
+
+void twr_uart_set_clock_linger(twr_uart_channel_t channel, twr_tick_t linger)
+{
+    if (!_twr_uart[channel].initialized)
     {
-        twr_system_hsi16_disable();
+        return;
     }
-    else
+
+    _twr_uart[channel].clock_linger = linger;
+
+    if (linger != 0 && _twr_uart[channel].clock_linger_task_id == 0)
     {
-        twr_system_pll_disable();
+        _twr_uart[channel].clock_linger_task_id = twr_scheduler_register(_twr_uart_clock_linger_task, (void *) channel, TWR_TICK_INFINITY);
     }
 
-    return bytes_written;
+    if (linger == 0 && _twr_uart[channel].clock_lingering)
+    {
+        _twr_uart[channel].clock_lingering = false;
+
+        _twr_uart_clock_disable(&_twr_uart[channel]);
+    }
+}
+
+void twr_uart_write_begin(twr_uart_channel_t channel)
+{
+    if (!_twr_uart[channel].initialized)
+    {
+        return;
+    }
+
+    _twr_uart_clock_acquire(channel);
+}
+
+void twr_uart_write_end(twr_uart_channel_t channel)
+{
+    if (!_twr_uart[channel].initialized)
+    {
+        return;
+    }
+
+    _twr_uart_clock_release(channel);
 }
 
 size_t twr_uart_read(twr_uart_channel_t channel, void *buffer, size_t length, twr_tick_t timeout)
@@ -415,6 +642,11 @@ void twr_uart_set_async_fifo(twr_uart_channel_t channel, twr_fifo_t *write_fifo,
     _twr_uart[channel].read_fifo = read_fifo;
 }
 
+void twr_uart_set_async_write_dma(twr_uart_channel_t channel, bool enable)
+{
+    _twr_uart[channel].async_write_dma = enable;
+}
+
 size_t twr_uart_async_write(twr_uart_channel_t channel, const void *buffer, size_t length)
 {
     if (!_twr_uart[channel].initialized || _twr_uart[channel].write_fifo == NULL)
@@ -435,13 +667,11 @@ size_t twr_uart_async_write(twr_uart_channel_t channel, const void *buffer, size
         {
             _twr_uart[channel].async_write_task_id = twr_scheduler_register(_twr_uart_async_write_task, (void *) channel, TWR_TICK_INFINITY);
 
-            if (_twr_uart[channel].usart == LPUART1)
-            {
-                twr_system_hsi16_enable();
-            }
-            else
+            _twr_uart_clock_acquire(channel);
+
+            if (_twr_uart[channel].async_write_dma)
             {
-                twr_system_pll_enable();
+                _twr_uart[channel].async_write_dma_active = _twr_uart_async_write_dma_acquire(channel);
             }
         }
         else
@@ -449,6 +679,19 @@ size_t twr_uart_async_write(twr_uart_channel_t channel, const void *buffer, size
             twr_scheduler_plan_absolute(_twr_uart[channel].async_write_task_id, TWR_TICK_INFINITY);
         }
 
+        if (_twr_uart[channel].async_write_dma_active)
+        {
+            _twr_uart[channel].async_write_in_progress = true;
+
+            // Data written while a block is in flight are picked up on its completion
+            if (_twr_uart[channel].async_write_dma_length == 0)
+            {
+                _twr_uart_async_write_dma_next(channel);
+            }
+
+            return bytes_written;
+        }
+
         twr_irq_disable();
 
         // Enable transmit interrupt
@@ -473,10 +716,19 @@ bool twr_uart_async_read_start(twr_uart_channel_t channel, twr_tick_t timeout)
 
     _twr_uart[channel].async_read_task_id = twr_scheduler_register(_twr_uart_async_read_task, (void *) channel, _twr_uart[channel].async_timeout);
 
-    if (channel == TWR_UART_UART2)
+    // Received data are drained before the FIFO overflows
+    twr_scheduler_set_priority(_twr_uart[channel].async_read_task_id, TWR_SCHEDULER_PRIORITY_HIGH);
+
+    if (_twr_uart_async_read_dma_acquire(channel))
     {
+        // DMA starts writing at the beginning of buffer
+        twr_fifo_purge(_twr_uart[channel].read_fifo);
+
+        _twr_uart[channel].async_read_dma_wraps = 0;
+        _twr_uart[channel].async_read_dma_wraps_committed = 0;
+
         twr_dma_channel_config_t config = {
-                .request = TWR_DMA_REQUEST_3,
+                .request = _twr_uart[channel].async_read_dma_request,
                 .direction = TWR_DMA_DIRECTION_TO_RAM,
                 .data_size_memory = TWR_DMA_SIZE_1,
                 .data_size_peripheral = TWR_DMA_SIZE_1,
@@ -487,18 +739,17 @@ bool twr_uart_async_read_start(twr_uart_channel_t channel, twr_tick_t timeout)
                 .priority = TWR_DMA_PRIORITY_HIGH
         };
 
-        twr_dma_init();
-
-        twr_dma_channel_config(TWR_DMA_CHANNEL_3, &config);
-
-        _twr_uart_2_dma.read_task_id = twr_scheduler_register(_twr_uart_2_dma_read_task, (void *) channel, 0);
+        twr_dma_channel_config(_twr_uart[channel].async_read_dma_channel, &config);
 
         twr_irq_disable();
-        // Enable receive DMA interrupt
-        _twr_uart[channel].usart->CR3 |=  USART_CR3_DMAR;
+        // Clear idle line flag, it is set after reception has been enabled
+        _twr_uart[channel].usart->ICR = USART_ICR_IDLECF;
+        // Enable receive DMA and idle line interrupt
+        _twr_uart[channel].usart->CR3 |= USART_CR3_DMAR;
+        _twr_uart[channel].usart->CR1 |= USART_CR1_IDLEIE;
         twr_irq_enable();
 
-        twr_dma_channel_run(TWR_DMA_CHANNEL_3);
+        twr_dma_channel_run(_twr_uart[channel].async_read_dma_channel);
     }
     else
     {
@@ -527,16 +778,17 @@ bool twr_uart_async_read_cancel(twr_uart_channel_t channel)
 
     _twr_uart[channel].async_read_in_progress = false;
 
-    if (channel == TWR_UART_UART2)
+    if (_twr_uart[channel].async_read_dma_active)
     {
-        twr_dma_channel_stop(TWR_DMA_CHANNEL_3);
-
-        twr_scheduler_unregister(_twr_uart_2_dma.read_task_id);
+        twr_dma_channel_stop(_twr_uart[channel].async_read_dma_channel);
 
         twr_irq_disable();
-        // Disable receive DMA interrupt
+        // Disable receive DMA and idle line interrupt
         _twr_uart[channel].usart->CR3 &= ~USART_CR3_DMAR_Msk;
+        _twr_uart[channel].usart->CR1 &= ~USART_CR1_IDLEIE_Msk;
         twr_irq_enable();
+
+        _twr_uart_async_read_dma_release(channel);
     }
     else
     {
@@ -570,6 +822,27 @@ size_t twr_uart_async_read(twr_uart_channel_t channel, void *buffer, size_t leng
     return bytes_read;
 }
 
+const twr_transport_driver_t *twr_uart_get_transport_driver(void)
+{
+    static const twr_transport_driver_t driver =
+    {
+        .writev = _twr_uart_transport_writev,
+        .ready = _twr_uart_transport_ready
+    };
+
+    return &driver;
+}
+
+static size_t _twr_uart_transport_writev(twr_transport_t *self, const twr_transport_segment_t *segments, size_t count)
+{
+    return twr_uart_writev((twr_uart_channel_t) self->_channel, segments, count);
+}
+
+static bool _twr_uart_transport_ready(twr_transport_t *self)
+{
+    return _twr_uart[self->_channel].initialized && !_twr_uart[self->_channel].async_write_in_progress;
+}
+
 static void _twr_uart_async_write_task(void *param)
 {
     twr_uart_channel_t channel = (twr_uart_channel_t) param;
@@ -579,6 +852,33 @@ static void _twr_uart_async_write_task(void *param)
 
     twr_scheduler_unregister(uart->async_write_task_id);
 
+    if (uart->async_write_dma_active)
+    {
+        _twr_uart_async_write_dma_release(channel);
+    }
+
+    _twr_uart_clock_release(channel);
+
+    if (uart->event_handler != NULL)
+    {
+        uart->event_handler(channel, TWR_UART_EVENT_ASYNC_WRITE_DONE, uart->event_param);
+    }
+}
+
+static void _twr_uart_clock_enable(twr_uart_t *uart)
+{
+    if (uart->usart == LPUART1)
+    {
+        twr_system_hsi16_enable();
+    }
+    else
+    {
+        twr_system_pll_enable();
+    }
+}
+
+static void _twr_uart_clock_disable(twr_uart_t *uart)
+{
     if (uart->usart == LPUART1)
     {
         twr_system_hsi16_disable();
@@ -587,10 +887,55 @@ static void _twr_uart_async_write_task(void *param)
     {
         twr_system_pll_disable();
     }
+}
 
-    if (uart->event_handler != NULL)
+static void _twr_uart_clock_acquire(twr_uart_channel_t channel)
+{
+    twr_uart_t *uart = &_twr_uart[channel];
+
+    // Take over the reference kept by the linger
+    if (uart->clock_lingering)
     {
-        uart->event_handler(channel, TWR_UART_EVENT_ASYNC_WRITE_DONE, uart->event_param);
+        uart->clock_lingering = false;
+
+        return;
+    }
+
+    _twr_uart_clock_enable(uart);
+}
+
+static void _twr_uart_clock_release(twr_uart_channel_t channel)
+{
+    twr_uart_t *uart = &_twr_uart[channel];
+
+    // Keep one reference for the linger time so back-to-back writes do not restart the clock
+    if (uart->clock_linger != 0 && !uart->clock_lingering && uart->clock_linger_task_id != 0)
+    {
+        uart->clock_lingering = true;
+
+        twr_scheduler_plan_relative(uart->clock_linger_task_id, uart->clock_linger);
+
+        return;
+    }
+
+    if (uart->clock_lingering)
+    {
+        twr_scheduler_plan_relative(uart->clock_linger_task_id, uart->clock_linger);
+    }
+
+    _twr_uart_clock_disable(uart);
+}
+
+static void _twr_uart_clock_linger_task(void *param)
+{
+    twr_uart_channel_t channel = (twr_uart_channel_t) param;
+    twr_uart_t *uart = &_twr_uart[channel];
+
+    if (uart->clock_lingering)
+    {
+        uart->clock_lingering = false;
+
+        _twr_uart_clock_disable(uart);
     }
 }
 
@@ -601,8 +946,20 @@ static void _twr_uart_async_read_task(void *param)
 
     twr_scheduler_plan_current_relative(uart->async_timeout);
 
+    bool overrun = false;
+
+    if (uart->async_read_dma_active)
+    {
+        overrun = _twr_uart_async_read_dma_commit(uart);
+    }
+
     if (uart->event_handler != NULL)
     {
+        if (overrun)
+        {
+            uart->event_handler(channel, TWR_UART_EVENT_ASYNC_READ_OVERRUN, uart->event_param);
+        }
+
         if (twr_fifo_is_empty(uart->read_fifo))
         {
             uart->event_handler(channel, TWR_UART_EVENT_ASYNC_READ_TIMEOUT, uart->event_param);
@@ -614,27 +971,233 @@ static void _twr_uart_async_read_task(void *param)
     }
 }
 
-static void _twr_uart_2_dma_read_task(void *param)
+static bool _twr_uart_async_read_dma_acquire(twr_uart_channel_t channel)
+{
+    twr_uart_t *uart = &_twr_uart[channel];
+
+    // LPUART1 keeps receiving byte by byte, it must be able to wake up from stop mode where DMA does not run
+    if (uart->usart == LPUART1)
+    {
+        return false;
+    }
+
+    twr_dma_channel_t dma_channel;
+
+    if (!twr_dma_channel_allocate(_twr_uart_dma_line(uart, false), &dma_channel, &uart->async_read_dma_request))
+    {
+        // Channels are taken by other drivers, fall back to interrupt driven reception
+        return false;
+    }
+
+    twr_dma_init();
+
+    twr_dma_set_event_handler(dma_channel, _twr_uart_dma_rx_event_handler, (void *) channel);
+
+    uart->async_read_dma_channel = dma_channel;
+    uart->async_read_dma_active = true;
+
+    return true;
+}
+
+static void _twr_uart_async_read_dma_release(twr_uart_channel_t channel)
+{
+    twr_uart_t *uart = &_twr_uart[channel];
+
+    twr_dma_channel_release(uart->async_read_dma_channel);
+
+    uart->async_read_dma_active = false;
+}
+
+static bool _twr_uart_async_read_dma_commit(twr_uart_t *uart)
+{
+    twr_fifo_t *fifo = uart->read_fifo;
+    uint32_t wraps;
+    size_t position;
+
+    // Wrap counted by DMA done event between the reads would be missed
+    do
+    {
+        wraps = uart->async_read_dma_wraps;
+
+        position = fifo->size - twr_dma_channel_get_length(uart->async_read_dma_channel);
+
+    } while (wraps != uart->async_read_dma_wraps);
+
+    // DMA writes circularly straight into FIFO buffer, wraps tell full buffer from no progress since the last head
+    size_t received = (wraps - uart->async_read_dma_wraps_committed) * fifo->size + position - fifo->head;
+    size_t unread = fifo->head >= fifo->tail ? fifo->head - fifo->tail : fifo->head + fifo->size - fifo->tail;
+
+    uart->async_read_dma_wraps_committed = wraps;
+
+    if (received == 0)
+    {
+        return false;
+    }
+
+    if (received + unread < fifo->size)
+    {
+        twr_fifo_commit(fifo, received);
+
+        return false;
+    }
+
+    // Unread data have been overwritten, keep the newest bytes which are received continuously up to position
+    fifo->tail = position + 1 < fifo->size ? position + 1 : 0;
+    fifo->head = position;
+
+    return true;
+}
+
+static void _twr_uart_dma_rx_event_handler(twr_dma_channel_t channel, twr_dma_event_t event, void *event_param)
+{
+    (void) channel;
+
+    twr_uart_channel_t uart_channel = (twr_uart_channel_t) event_param;
+
+    if (event == TWR_DMA_EVENT_DONE)
+    {
+        _twr_uart[uart_channel].async_read_dma_wraps++;
+    }
+
+    // Half and full buffer events keep continuous stream flowing, bursts end with idle line
+    if (_twr_uart[uart_channel].async_read_dma_active)
+    {
+        twr_scheduler_plan_now(_twr_uart[uart_channel].async_read_task_id);
+    }
+}
+
+static twr_dma_line_t _twr_uart_dma_line(twr_uart_t *uart, bool transmit)
+{
+    if (uart->usart == USART1)
+    {
+        return transmit ? TWR_DMA_LINE_USART1_TX : TWR_DMA_LINE_USART1_RX;
+    }
+    else if (uart->usart == USART2)
+    {
+        return transmit ? TWR_DMA_LINE_USART2_TX : TWR_DMA_LINE_USART2_RX;
+    }
+    else if (uart->usart == LPUART1)
+    {
+        return transmit ? TWR_DMA_LINE_LPUART1_TX : TWR_DMA_LINE_LPUART1_RX;
+    }
+
+    return transmit ? TWR_DMA_LINE_USART4_TX : TWR_DMA_LINE_USART4_RX;
+}
+
+static bool _twr_uart_async_write_dma_acquire(twr_uart_channel_t channel)
+{
+    twr_uart_t *uart = &_twr_uart[channel];
+
+    if (!twr_dma_channel_allocate(_twr_uart_dma_line(uart, true), &uart->async_write_dma_channel, &uart->async_write_dma_request))
+    {
+        // Channels are taken by other drivers, fall back to interrupt driven transmission
+        return false;
+    }
+
+    twr_dma_init();
+
+    twr_dma_set_event_handler(uart->async_write_dma_channel, _twr_uart_dma_tx_event_handler, (void *) channel);
+
+    // Core can sleep while DMA feeds the transmitter, but it must not enter stop mode
+    twr_sleep_enable();
+
+    twr_system_deep_sleep_disable();
+
+    return true;
+}
+
+static void _twr_uart_async_write_dma_release(twr_uart_channel_t channel)
+{
+    twr_uart_t *uart = &_twr_uart[channel];
+
+    twr_system_deep_sleep_enable();
+
+    twr_sleep_disable();
+
+    twr_dma_channel_release(uart->async_write_dma_channel);
+
+    uart->async_write_dma_active = false;
+    uart->async_write_dma_length = 0;
+}
+
+static void _twr_uart_async_write_dma_next(twr_uart_channel_t channel)
 {
-    (void) param;
+    twr_uart_t *uart = &_twr_uart[channel];
+    twr_fifo_t *fifo = uart->write_fifo;
 
-    size_t length = twr_dma_channel_get_length(TWR_DMA_CHANNEL_3);
+    const void *data;
 
-    twr_uart_t *uart = &_twr_uart[TWR_UART_UART2];
+    // Transfer the contiguous block from tail up to head or the end of buffer
+    size_t length = twr_fifo_peek(fifo, &data);
 
-    if (_twr_uart_2_dma.length != length)
+    if (length == 0)
     {
-        uart->read_fifo->head = uart->read_fifo->size - length;
+        twr_irq_disable();
+
+        // Disable transmit DMA
+        uart->usart->CR3 &= ~USART_CR3_DMAT;
+
+        // Enable transmission complete interrupt
+        uart->usart->CR1 |= USART_CR1_TCIE;
+
+        twr_irq_enable();
+
+        return;
+    }
+
+    twr_dma_channel_config_t config = {
+            .request = uart->async_write_dma_request,
+            .direction = TWR_DMA_DIRECTION_TO_PERIPHERAL,
+            .data_size_memory = TWR_DMA_SIZE_1,
+            .data_size_peripheral = TWR_DMA_SIZE_1,
+            .length = length,
+            .mode = TWR_DMA_MODE_STANDARD,
+            .address_memory = (void *) data,
+            .address_peripheral = (void *) &uart->usart->TDR,
+            .priority = TWR_DMA_PRIORITY_MEDIUM
+    };
+
+    uart->async_write_dma_length = length;
+
+    twr_dma_channel_config(uart->async_write_dma_channel, &config);
+
+    twr_irq_disable();
+
+    // Disable transmission complete interrupt
+    uart->usart->CR1 &= ~USART_CR1_TCIE;
+
+    // Enable transmit DMA
+    uart->usart->CR3 |= USART_CR3_DMAT;
+
+    twr_irq_enable();
 
-        _twr_uart_2_dma.length = length;
+    twr_dma_channel_run(uart->async_write_dma_channel);
+}
+
+static void _twr_uart_dma_tx_event_handler(twr_dma_channel_t channel, twr_dma_event_t event, void *event_param)
+{
+    twr_uart_channel_t uart_channel = (twr_uart_channel_t) event_param;
+    twr_uart_t *uart = &_twr_uart[uart_channel];
 
-        twr_scheduler_plan_now(uart->async_read_task_id);
+    if (event == TWR_DMA_EVENT_HALF_DONE || uart->async_write_dma_length == 0)
+    {
+        return;
     }
 
-    twr_scheduler_plan_current_now();
+    if (event == TWR_DMA_EVENT_ERROR)
+    {
+        twr_dma_channel_stop(channel);
+    }
+
+    // Release transferred block from FIFO
+    twr_fifo_consume(uart->write_fifo, uart->async_write_dma_length);
+
+    uart->async_write_dma_length = 0;
+
+    _twr_uart_async_write_dma_next(uart_channel);
 }
 
-static void _twr_uart_irq_handler(twr_uart_channel_t channel)
+TWR_RAMFUNC static void _twr_uart_irq_handler(twr_uart_channel_t channel)
 {
     USART_TypeDef *usart = _twr_uart[channel].usart;
 
@@ -650,6 +1213,15 @@ static void _twr_uart_irq_handler(twr_uart_channel_t channel)
         twr_scheduler_plan_now(_twr_uart[channel].async_read_task_id);
     }
 
+    // If it is idle line after DMA reception...
+    if ((usart->CR1 & USART_CR1_IDLEIE) != 0 && (usart->ISR & USART_ISR_IDLE) != 0)
+    {
+        // Clear idle line flag
+        usart->ICR = USART_ICR_IDLECF;
+
+        twr_scheduler_signal(_twr_uart[channel].async_read_task_id);
+    }
+
     // If it is transmit interrupt...
     if ((usart->CR1 & USART_CR1_TXEIE) != 0 && (usart->ISR & USART_ISR_TXE) != 0)
     {
@@ -681,22 +1253,38 @@ static void _twr_uart_irq_handler(twr_uart_channel_t channel)
     }
 }
 
-void AES_RNG_LPUART1_IRQHandler(void)
+TWR_RAMFUNC void AES_RNG_LPUART1_IRQHandler(void)
 {
+    twr_trace_isr_enter(AES_RNG_LPUART1_IRQn);
+
     _twr_uart_irq_handler(TWR_UART_UART1);
+
+    twr_trace_isr_exit(AES_RNG_LPUART1_IRQn);
 }
 
-void USART1_IRQHandler(void)
+TWR_RAMFUNC void USART1_IRQHandler(void)
 {
+    twr_trace_isr_enter(USART1_IRQn);
+
     _twr_uart_irq_handler(TWR_UART_UART2);
+
+    twr_trace_isr_exit(USART1_IRQn);
 }
 
-void USART2_IRQHandler(void)
+TWR_RAMFUNC void USART2_IRQHandler(void)
 {
+    twr_trace_isr_enter(USART2_IRQn);
+
     _twr_uart_irq_handler(TWR_UART_UART1);
+
+    twr_trace_isr_exit(USART2_IRQn);
 }
 
-void USART4_5_IRQHandler(void)
+TWR_RAMFUNC void USART4_5_IRQHandler(void)
 {
+    twr_trace_isr_enter(USART4_5_IRQn);
+
     _twr_uart_irq_handler(TWR_UART_UART0);
+
+    twr_trace_isr_exit(USART4_5_IRQn);
 }
@@ -10,12 +10,20 @@
 
 #include <stm32l0xx.h>
 
+#define _TWR_USB_CDC_TRANSMIT_BUFFER_SIZE 256
+#define _TWR_USB_CDC_RETRY_INTERVAL 10
+
 static struct
 {
     twr_fifo_t receive_fifo;
     uint8_t receive_buffer[1024];
-    uint8_t transmit_buffer[512];
-    size_t transmit_length;
+
+    // One buffer is filled while the other one is transmitted
+    uint8_t transmit_buffer[2][_TWR_USB_CDC_TRANSMIT_BUFFER_SIZE];
+    size_t transmit_length[2];
+    int transmit_fill;
+    volatile bool transmit_busy;
+
     twr_scheduler_task_id_t task_id;
 
 } _twr_usb_cdc;
@@ -25,6 +33,9 @@ USBD_HandleTypeDef hUsbDeviceFS;
 static void _twr_usb_cdc_task_start(void *param);
 static void _twr_usb_cdc_task(void *param);
 static void _twr_usb_cdc_init_hsi48();
+static size_t _twr_usb_cdc_transport_writev(twr_transport_t *self, const twr_transport_segment_t *segments, size_t count);
+static bool _twr_usb_cdc_transport_flush(twr_transport_t *self);
+static bool _twr_usb_cdc_transport_ready(twr_transport_t *self);
 
 void twr_usb_cdc_init(void)
 {
@@ -34,6 +45,8 @@ void twr_usb_cdc_init(void)
 
     twr_fifo_init(&_twr_usb_cdc.receive_fifo, _twr_usb_cdc.receive_buffer, sizeof(_twr_usb_cdc.receive_buffer));
 
+    twr_fifo_set_spsc(&_twr_usb_cdc.receive_fifo, true);
+
     __HAL_RCC_GPIOA_CLK_ENABLE();
 
     USBD_Init(&hUsbDeviceFS, &FS_Desc, DEVICE_FS);
@@ -45,16 +58,22 @@ void twr_usb_cdc_init(void)
 
 bool twr_usb_cdc_write(const void *buffer, size_t length)
 {
-    if (length > (sizeof(_twr_usb_cdc.transmit_buffer) - _twr_usb_cdc.transmit_length))
+    int fill = _twr_usb_cdc.transmit_fill;
+
+    if (length > (sizeof(_twr_usb_cdc.transmit_buffer[fill]) - _twr_usb_cdc.transmit_length[fill]))
     {
         return false;
     }
 
-    memcpy(&_twr_usb_cdc.transmit_buffer[_twr_usb_cdc.transmit_length], buffer, length);
+    memcpy(&_twr_usb_cdc.transmit_buffer[fill][_twr_usb_cdc.transmit_length[fill]], buffer, length);
 
-    _twr_usb_cdc.transmit_length += length;
+    _twr_usb_cdc.transmit_length[fill] += length;
 
-    twr_scheduler_plan_now(_twr_usb_cdc.task_id);
+    // Completion of running transfer plans the task otherwise
+    if (!_twr_usb_cdc.transmit_busy)
+    {
+        twr_scheduler_plan_now(_twr_usb_cdc.task_id);
+    }
 
     return true;
 }
@@ -91,6 +110,28 @@ void twr_usb_cdc_received_data(const void *buffer, size_t length)
     twr_fifo_irq_write(&_twr_usb_cdc.receive_fifo, (uint8_t *) buffer, length);
 }
 
+void twr_usb_cdc_transmit_ready(void)
+{
+    _twr_usb_cdc.transmit_busy = false;
+
+    if (_twr_usb_cdc.transmit_length[_twr_usb_cdc.transmit_fill] != 0)
+    {
+        twr_scheduler_signal(_twr_usb_cdc.task_id);
+    }
+}
+
+const twr_transport_driver_t *twr_usb_cdc_get_transport_driver(void)
+{
+    static const twr_transport_driver_t driver =
+    {
+        .writev = _twr_usb_cdc_transport_writev,
+        .flush = _twr_usb_cdc_transport_flush,
+        .ready = _twr_usb_cdc_transport_ready
+    };
+
+    return &driver;
+}
+
 static void _twr_usb_cdc_task_start(void *param)
 {
     (void) param;
@@ -106,21 +147,47 @@ static void _twr_usb_cdc_task(void *param)
 {
     (void) param;
 
-    if (_twr_usb_cdc.transmit_length == 0)
+    int fill = _twr_usb_cdc.transmit_fill;
+    size_t length = _twr_usb_cdc.transmit_length[fill];
+
+    if (_twr_usb_cdc.transmit_busy || (length == 0))
     {
         return;
     }
 
+    // Transfer of whole packets would need zero-length packet, the last byte goes with the next one
+    if ((length % CDC_DATA_FS_MAX_PACKET_SIZE == 0) && (length > 1))
+    {
+        length--;
+    }
+
     HAL_NVIC_DisableIRQ(USB_IRQn);
 
-    if (CDC_Transmit_FS(_twr_usb_cdc.transmit_buffer, _twr_usb_cdc.transmit_length) == USBD_OK)
+    bool transmitted = CDC_Transmit_FS(_twr_usb_cdc.transmit_buffer[fill], length) == USBD_OK;
+
+    if (transmitted)
     {
-        _twr_usb_cdc.transmit_length = 0;
+        _twr_usb_cdc.transmit_busy = true;
+
+        // Buffers are swapped before completion interrupt can look at the filled one
+        _twr_usb_cdc.transmit_fill = 1 - fill;
+        _twr_usb_cdc.transmit_length[1 - fill] = _twr_usb_cdc.transmit_length[fill] - length;
+
+        if (_twr_usb_cdc.transmit_length[1 - fill] != 0)
+        {
+            _twr_usb_cdc.transmit_buffer[1 - fill][0] = _twr_usb_cdc.transmit_buffer[fill][length];
+        }
+
+        _twr_usb_cdc.transmit_length[fill] = 0;
     }
 
     HAL_NVIC_EnableIRQ(USB_IRQn);
 
-    twr_scheduler_plan_current_now();
+    if (!transmitted)
+    {
+        // Device is not configured yet or endpoint is busy with transfer started elsewhere
+        twr_scheduler_plan_current_relative(_TWR_USB_CDC_RETRY_INTERVAL);
+    }
 }
 
 static void _twr_usb_cdc_init_hsi48()
@@ -139,3 +206,48 @@ static void _twr_usb_cdc_init_hsi48()
     RCC->CCIPR |= RCC_USBCLKSOURCE_HSI48;
     RCC->CFGR &= ~RCC_CFGR_STOPWUCK_Msk;
 }
+
+static size_t _twr_usb_cdc_transport_writev(twr_transport_t *self, const twr_transport_segment_t *segments, size_t count)
+{
+    (void) self;
+
+    int fill = _twr_usb_cdc.transmit_fill;
+    size_t length = 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        length += segments[i].length;
+    }
+
+    // Segments go as one unit or not at all
+    if (length > (sizeof(_twr_usb_cdc.transmit_buffer[fill]) - _twr_usb_cdc.transmit_length[fill]))
+    {
+        return 0;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        twr_usb_cdc_write(segments[i].buffer, segments[i].length);
+    }
+
+    return length;
+}
+
+static bool _twr_usb_cdc_transport_flush(twr_transport_t *self)
+{
+    (void) self;
+
+    if (!_twr_usb_cdc.transmit_busy)
+    {
+        twr_scheduler_plan_now(_twr_usb_cdc.task_id);
+    }
+
+    return true;
+}
+
+static bool _twr_usb_cdc_transport_ready(twr_transport_t *self)
+{
+    (void) self;
+
+    return hUsbDeviceFS.dev_state == USBD_STATE_CONFIGURED;
+}
@@ -0,0 +1,263 @@
+#include <twr_vibration.h>
+
+#if (TWR_VIBRATION_BLOCK_SIZE < 8) || (TWR_VIBRATION_BLOCK_SIZE > 256) || (TWR_VIBRATION_BLOCK_SIZE & (TWR_VIBRATION_BLOCK_SIZE - 1))
+#error "TWR_VIBRATION_BLOCK_SIZE has to be power of two from 8 to 256"
+#endif
+
+// Quarter of sine wave of 256 points in Q15
+static const int16_t _twr_vibration_sine[65] =
+{
+    0, 804, 1608, 2410, 3212, 4011, 4808, 5602, 6393, 7179, 7962, 8739, 9512,
+    10278, 11039, 11793, 12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530, 18204, 18868,
+    19519, 20159, 20787, 21403, 22005, 22594, 23170, 23731, 24279, 24811, 25329, 25832, 26319,
+    26790, 27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956, 30273, 30571, 30852, 31113,
+    31356, 31580, 31785, 31971, 32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757, 32767
+};
+
+static void _twr_vibration_process(twr_vibration_t *self);
+static void _twr_vibration_fft(int16_t *real, int16_t *imaginary);
+static int16_t _twr_vibration_sin(uint8_t angle);
+static uint16_t _twr_vibration_sqrt(uint64_t value);
+
+void twr_vibration_init(twr_vibration_t *self, uint16_t sample_rate)
+{
+    memset(self, 0, sizeof(*self));
+
+    self->_sample_rate = sample_rate;
+}
+
+void twr_vibration_set_event_handler(twr_vibration_t *self, void (*event_handler)(twr_vibration_t *, twr_vibration_event_t, void *), void *event_param)
+{
+    self->_event_handler = event_handler;
+    self->_event_param = event_param;
+}
+
+void twr_vibration_feed_raw(twr_vibration_t *self, const twr_lis2dh12_result_raw_t *samples, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        self->_buffer[0][self->_count] = samples[i].x_axis;
+        self->_buffer[1][self->_count] = samples[i].y_axis;
+        self->_buffer[2][self->_count] = samples[i].z_axis;
+
+        if (++self->_count == TWR_VIBRATION_BLOCK_SIZE)
+        {
+            _twr_vibration_process(self);
+
+            self->_count = 0;
+
+            self->_valid = true;
+
+            if (self->_event_handler != NULL)
+            {
+                self->_event_handler(self, TWR_VIBRATION_EVENT_UPDATE, self->_event_param);
+            }
+        }
+    }
+}
+
+bool twr_vibration_get_features(twr_vibration_t *self, twr_vibration_features_t *features)
+{
+    if (!self->_valid)
+    {
+        return false;
+    }
+
+    *features = self->_features;
+
+    return true;
+}
+
+static void _twr_vibration_process(twr_vibration_t *self)
+{
+    twr_vibration_features_t *features = &self->_features;
+
+    uint16_t rms_max = 0;
+
+    features->axis = 0;
+
+    for (int axis = 0; axis < 3; axis++)
+    {
+        int16_t *buffer = self->_buffer[axis];
+
+        int32_t sum = 0;
+
+        for (size_t i = 0; i < TWR_VIBRATION_BLOCK_SIZE; i++)
+        {
+            sum += buffer[i];
+        }
+
+        int32_t mean = sum / TWR_VIBRATION_BLOCK_SIZE;
+
+        int32_t minimum = INT16_MAX;
+        int32_t maximum = INT16_MIN;
+        uint64_t square_sum = 0;
+
+        for (size_t i = 0; i < TWR_VIBRATION_BLOCK_SIZE; i++)
+        {
+            int32_t value = buffer[i] - mean;
+
+            // Static component is removed in place, values are kept in 16 bits for FFT
+            value = value > INT16_MAX ? INT16_MAX : (value < INT16_MIN ? INT16_MIN : value);
+
+            buffer[i] = (int16_t) value;
+
+            minimum = value < minimum ? value : minimum;
+            maximum = value > maximum ? value : maximum;
+
+            square_sum += (uint64_t) (value * value);
+        }
+
+        features->rms[axis] = _twr_vibration_sqrt(square_sum / TWR_VIBRATION_BLOCK_SIZE);
+
+        features->peak_to_peak[axis] = (uint16_t) (maximum - minimum);
+
+        if (features->rms[axis] > rms_max)
+        {
+            rms_max = features->rms[axis];
+
+            features->axis = axis;
+        }
+    }
+
+    int16_t *real = self->_buffer[features->axis];
+
+    features->zero_crossings = 0;
+
+    for (size_t i = 1; i < TWR_VIBRATION_BLOCK_SIZE; i++)
+    {
+        if ((real[i - 1] < 0 && real[i] >= 0) || (real[i - 1] >= 0 && real[i] < 0))
+        {
+            features->zero_crossings++;
+        }
+    }
+
+    memset(self->_imaginary, 0, sizeof(self->_imaginary));
+
+    _twr_vibration_fft(real, self->_imaginary);
+
+    uint32_t power_max = 0;
+    size_t bin_max = 0;
+
+    // Bin 0 is static component, bins above half are mirror image
+    for (size_t bin = 1; bin < TWR_VIBRATION_BLOCK_SIZE / 2; bin++)
+    {
+        uint32_t power = (uint32_t) (real[bin] * real[bin]) + (uint32_t) (self->_imaginary[bin] * self->_imaginary[bin]);
+
+        if (power > power_max)
+        {
+            power_max = power;
+            bin_max = bin;
+        }
+    }
+
+    features->frequency = (uint16_t) ((uint32_t) bin_max * self->_sample_rate * 10 / TWR_VIBRATION_BLOCK_SIZE);
+
+    // Bins are scaled by block size, sine of amplitude A gives A / 2 in its bin
+    uint32_t amplitude = 2 * (uint32_t) _twr_vibration_sqrt(power_max);
+
+    features->amplitude = amplitude > UINT16_MAX ? UINT16_MAX : amplitude;
+}
+
+static void _twr_vibration_fft(int16_t *real, int16_t *imaginary)
+{
+    // Bit reversal permutation
+    for (size_t i = 1, j = 0; i < TWR_VIBRATION_BLOCK_SIZE; i++)
+    {
+        size_t bit = TWR_VIBRATION_BLOCK_SIZE >> 1;
+
+        for (; j & bit; bit >>= 1)
+        {
+            j ^= bit;
+        }
+
+        j ^= bit;
+
+        if (i < j)
+        {
+            int16_t t = real[i];
+            real[i] = real[j];
+            real[j] = t;
+
+            t = imaginary[i];
+            imaginary[i] = imaginary[j];
+            imaginary[j] = t;
+        }
+    }
+
+    for (size_t length = 2; length <= TWR_VIBRATION_BLOCK_SIZE; length <<= 1)
+    {
+        size_t half = length >> 1;
+
+        // Twiddle angle step in 1/256 of turn
+        size_t step = 256 / length;
+
+        for (size_t k = 0; k < half; k++)
+        {
+            uint8_t angle = (uint8_t) (k * step);
+
+            int32_t wr = _twr_vibration_sin(angle + 64);
+            int32_t wi = _twr_vibration_sin(angle);
+
+            for (size_t i = k; i < TWR_VIBRATION_BLOCK_SIZE; i += length)
+            {
+                size_t j = i + half;
+
+                // Multiplication by twiddle factor cos - j sin
+                int32_t tr = (real[j] * wr + imaginary[j] * wi) >> 15;
+                int32_t ti = (imaginary[j] * wr - real[j] * wi) >> 15;
+
+                int32_t ur = real[i];
+                int32_t ui = imaginary[i];
+
+                real[i] = (int16_t) ((ur + tr) >> 1);
+                imaginary[i] = (int16_t) ((ui + ti) >> 1);
+                real[j] = (int16_t) ((ur - tr) >> 1);
+                imaginary[j] = (int16_t) ((ui - ti) >> 1);
+            }
+        }
+    }
+}
+
+static int16_t _twr_vibration_sin(uint8_t angle)
+{
+    uint8_t index = angle & 0x3f;
+
+    switch (angle >> 6)
+    {
+        case 0:
+        {
+            return _twr_vibration_sine[index];
+        }
+        case 1:
+        {
+            return _twr_vibration_sine[64 - index];
+        }
+        case 2:
+        {
+            return -_twr_vibration_sine[index];
+        }
+        default:
+        {
+            return -_twr_vibration_sine[64 - index];
+        }
+    }
+}
+
+static uint16_t _twr_vibration_sqrt(uint64_t value)
+{
+    uint32_t result = 0;
+
+    // Bitwise integer square root, result fits in 16 bits for values of 16-bit samples
+    for (uint32_t bit = 1UL << 15; bit != 0; bit >>= 1)
+    {
+        uint32_t candidate = result | bit;
+
+        if ((uint64_t) candidate * candidate <= value)
+        {
+            result = candidate;
+        }
+    }
+
+    return (uint16_t) result;
+}
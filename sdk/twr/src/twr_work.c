@@ -0,0 +1,81 @@
+#include <twr_work.h>
+#include <twr_scheduler.h>
+#include <twr_irq.h>
+
+#if (TWR_WORK_QUEUE_SIZE & (TWR_WORK_QUEUE_SIZE - 1)) != 0
+#error "TWR_WORK_QUEUE_SIZE has to be power of two"
+#endif
+
+typedef struct
+{
+    void (*function)(void *);
+    void *param;
+
+} twr_work_item_t;
+
+static struct
+{
+    twr_work_item_t queue[TWR_WORK_QUEUE_SIZE];
+
+    // Free running indexes, head is advanced by producers under masked interrupts, tail by task only
+    volatile uint32_t head;
+    volatile uint32_t tail;
+
+    uint32_t dropped;
+
+} _twr_work;
+
+static void _twr_work_task(void *param);
+
+TWR_SCHEDULER_TASK_STATIC(_twr_work_task_static, _twr_work_task, NULL);
+
+TWR_RAMFUNC bool twr_work_post(void (*function)(void *), void *param)
+{
+    // Producers can preempt each other, consumer only takes items behind head
+    uint32_t primask = twr_irq_save();
+
+    uint32_t head = _twr_work.head;
+
+    if (head - _twr_work.tail >= TWR_WORK_QUEUE_SIZE)
+    {
+        _twr_work.dropped++;
+
+        twr_irq_restore(primask);
+
+        return false;
+    }
+
+    _twr_work.queue[head % TWR_WORK_QUEUE_SIZE].function = function;
+    _twr_work.queue[head % TWR_WORK_QUEUE_SIZE].param = param;
+
+    _twr_work.head = head + 1;
+
+    twr_irq_restore(primask);
+
+    twr_scheduler_signal(twr_scheduler_get_static_id(&_twr_work_task_static));
+
+    return true;
+}
+
+uint32_t twr_work_get_dropped(void)
+{
+    return _twr_work.dropped;
+}
+
+static void _twr_work_task(void *param)
+{
+    (void) param;
+
+    uint32_t tail = _twr_work.tail;
+
+    // Items posted while running are executed too, queue is drained in this run
+    while (tail != _twr_work.head)
+    {
+        twr_work_item_t item = _twr_work.queue[tail % TWR_WORK_QUEUE_SIZE];
+
+        // Slot is released after it has been copied out
+        _twr_work.tail = ++tail;
+
+        item.function(item.param);
+    }
+}
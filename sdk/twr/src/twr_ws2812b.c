@@ -14,18 +14,35 @@
 #define _TWR_WS2812_TWR_WS2812B_PORT GPIOA
 #define _TWR_WS2812_TWR_WS2812B_PIN GPIO_PIN_1
 
+// Every data byte expands to 8 compare values (2 words of pulse table)
+#define _TWR_WS2812_STREAM_HALF_WORDS (TWR_WS2812B_STREAM_CHUNK * 2)
+
 static struct ws2812b_t
 {
     uint32_t *dma_bit_buffer;
     const twr_led_strip_buffer_t *buffer;
+    const uint8_t *lut;
+
+#if TWR_WS2812B_STREAM
+    uint8_t *pixels;
+    size_t position;
+    size_t halves;
+    size_t halves_total;
+#endif
 
     bool transfer;
     twr_scheduler_task_id_t task_id;
     void (*event_handler)(twr_ws2812b_event_t, void *);
     void *event_param;
+    bool dma_allocated;
+    twr_dma_channel_t dma_channel;
 
 } _twr_ws2812b;
 
+#if TWR_WS2812B_STREAM
+static uint32_t _twr_ws2812b_stream_buffer[2 * _TWR_WS2812_STREAM_HALF_WORDS];
+#endif
+
 static twr_dma_channel_config_t _twr_ws2812b_dma_config =
 {
     .request = TWR_DMA_REQUEST_8,
@@ -60,21 +77,47 @@ const uint32_t _twr_ws2812b_pulse_tab[] =
     _TWR_WS2812_COMPARE_PULSE_LOGIC_1 << 24 | _TWR_WS2812_COMPARE_PULSE_LOGIC_1 << 16 | _TWR_WS2812_COMPARE_PULSE_LOGIC_1 << 8 | _TWR_WS2812_COMPARE_PULSE_LOGIC_1,
 };
 
+static void _twr_ws2812b_set_pixel(int position, uint8_t first, uint8_t second, uint8_t third, uint8_t fourth);
 static void _twr_ws2812b_dma_event_handler(twr_dma_channel_t channel, twr_dma_event_t event, void *event_param);
+static void _twr_ws2812b_reset_pulse(void);
 static void _twr_ws2812b_TIM2_interrupt_handler(void *param);
 static void _twr_ws2812b_task(void *param);
 
+#if TWR_WS2812B_STREAM
+
+static void _twr_ws2812b_stream_fill(uint32_t *half);
+static void _twr_ws2812b_dma_irq_handler(twr_dma_channel_t channel, twr_dma_event_t event, void *irq_param);
+
+#endif
+
 bool twr_ws2812b_init(const twr_led_strip_buffer_t *led_strip)
 {
+    twr_dma_channel_t dma_channel = _twr_ws2812b.dma_channel;
+
+    // TIM2 update request has a single channel, report conflict with other DMA users
+    if (!_twr_ws2812b.dma_allocated && !twr_dma_channel_allocate(TWR_DMA_LINE_TIM2_UP, &dma_channel, &_twr_ws2812b_dma_config.request))
+    {
+        return false;
+    }
+
     memset(&_twr_ws2812b, 0, sizeof(_twr_ws2812b));
 
+    _twr_ws2812b.dma_allocated = true;
+    _twr_ws2812b.dma_channel = dma_channel;
+
     _twr_ws2812b.buffer = led_strip;
 
+#if TWR_WS2812B_STREAM
+    _twr_ws2812b.pixels = (uint8_t *) led_strip->buffer;
+
+    memset(_twr_ws2812b.pixels, 0, _twr_ws2812b.buffer->count * _twr_ws2812b.buffer->type);
+#else
     _twr_ws2812b.dma_bit_buffer = led_strip->buffer;
 
     size_t dma_bit_buffer_size = _twr_ws2812b.buffer->count * _twr_ws2812b.buffer->type * 8;
 
     memset(_twr_ws2812b.dma_bit_buffer, _TWR_WS2812_COMPARE_PULSE_LOGIC_0, dma_bit_buffer_size);
+#endif
 
     __HAL_RCC_GPIOA_CLK_ENABLE();
 
@@ -88,7 +131,14 @@ bool twr_ws2812b_init(const twr_led_strip_buffer_t *led_strip)
     HAL_GPIO_Init(_TWR_WS2812_TWR_WS2812B_PORT, &GPIO_InitStruct);
 
     twr_dma_init();
-    twr_dma_set_event_handler(TWR_DMA_CHANNEL_2, _twr_ws2812b_dma_event_handler, NULL);
+
+#if TWR_WS2812B_STREAM
+    // Halves have to be refilled in time, so the whole transfer is handled from DMA interrupt
+    twr_dma_set_event_handler(_twr_ws2812b.dma_channel, NULL, NULL);
+    twr_dma_set_irq_handler(_twr_ws2812b.dma_channel, _twr_ws2812b_dma_irq_handler, NULL);
+#else
+    twr_dma_set_event_handler(_twr_ws2812b.dma_channel, _twr_ws2812b_dma_event_handler, NULL);
+#endif
 
      // TIM2 Periph clock enable
     __HAL_RCC_TIM2_CLK_ENABLE();
@@ -134,82 +184,28 @@ void twr_ws2812b_set_event_handler(void (*event_handler)(twr_ws2812b_event_t, vo
 
 void twr_ws2812b_set_pixel_from_rgb(int position, uint8_t red, uint8_t green, uint8_t blue, uint8_t white)
 {
-    uint32_t calculated_position = (position * _twr_ws2812b.buffer->type * 2);
-
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(green & 0xf0) >> 4];
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[green & 0x0f];
-
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(red & 0xf0) >> 4];
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[red & 0x0f];
-
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(blue & 0xf0) >> 4];
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[blue & 0x0f];
-
-     if (_twr_ws2812b.buffer->type == TWR_LED_STRIP_TYPE_RGBW)
-     {
-         _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(white & 0xf0) >> 4];
-         _twr_ws2812b.dma_bit_buffer[calculated_position] = _twr_ws2812b_pulse_tab[white & 0x0f];
-     }
+    _twr_ws2812b_set_pixel(position, green, red, blue, white);
 }
 
 void twr_ws2812b_set_pixel_from_uint32(int position, uint32_t color)
 {
-    uint32_t calculated_position = (position * _twr_ws2812b.buffer->type * 2);
-
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(color & 0x00f00000) >> 20];
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(color & 0x000f0000) >> 16];
-
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(color & 0xf0000000) >> 28];
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(color & 0x0f000000) >> 24];
-
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(color & 0x0000f000) >> 12];
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(color & 0x00000f00) >>  8];
-
-     if (_twr_ws2812b.buffer->type == TWR_LED_STRIP_TYPE_RGBW)
-     {
-         _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(color & 0x000000f0) >> 4];
-         _twr_ws2812b.dma_bit_buffer[calculated_position] = _twr_ws2812b_pulse_tab[color & 0x0000000f];
-     }
+    _twr_ws2812b_set_pixel(position, color >> 16, color >> 24, color >> 8, color);
 }
 
 void twr_ws2812b_set_pixel_from_rgb_swap_rg(int position, uint8_t red, uint8_t green, uint8_t blue, uint8_t white)
 {
-    uint32_t calculated_position = (position * _twr_ws2812b.buffer->type * 2);
-
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(red & 0xf0) >> 4];
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[red & 0x0f];
-
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(green & 0xf0) >> 4];
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[green & 0x0f];
-
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(blue & 0xf0) >> 4];
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[blue & 0x0f];
-
-     if (_twr_ws2812b.buffer->type == TWR_LED_STRIP_TYPE_RGBW)
-     {
-         _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(white & 0xf0) >> 4];
-         _twr_ws2812b.dma_bit_buffer[calculated_position] = _twr_ws2812b_pulse_tab[white & 0x0f];
-     }
+    _twr_ws2812b_set_pixel(position, red, green, blue, white);
 }
 
 void twr_ws2812b_set_pixel_from_uint32_swap_rg(int position, uint32_t color)
 {
-    uint32_t calculated_position = (position * _twr_ws2812b.buffer->type * 2);
-
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(color & 0xf0000000) >> 28];
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(color & 0x0f000000) >> 24];
-
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(color & 0x00f00000) >> 20];
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(color & 0x000f0000) >> 16];
-
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(color & 0x0000f000) >> 12];
-    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(color & 0x00000f00) >>  8];
+    _twr_ws2812b_set_pixel(position, color >> 24, color >> 16, color >> 8, color);
+}
 
-     if (_twr_ws2812b.buffer->type == TWR_LED_STRIP_TYPE_RGBW)
-     {
-         _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(color & 0x000000f0) >> 4];
-         _twr_ws2812b.dma_bit_buffer[calculated_position] = _twr_ws2812b_pulse_tab[color & 0x0000000f];
-     }
+void twr_ws2812b_set_lut(const uint8_t *lut)
+{
+    // In streaming mode table is applied during transfer, so it takes effect with the next write
+    _twr_ws2812b.lut = lut;
 }
 
 bool twr_ws2812b_write(void)
@@ -233,12 +229,27 @@ bool twr_ws2812b_write(void)
     // clear all TIM2 flags
     __HAL_TIM_CLEAR_FLAG(&_twr_ws2812b_timer2_handle, TIM_FLAG_UPDATE | TIM_FLAG_CC1 | TIM_FLAG_CC2 | TIM_FLAG_CC3 | TIM_FLAG_CC4);
 
+#if TWR_WS2812B_STREAM
+    size_t length = _twr_ws2812b.buffer->count * _twr_ws2812b.buffer->type;
+
+    _twr_ws2812b.position = 0;
+    _twr_ws2812b.halves = 0;
+    _twr_ws2812b.halves_total = (length + TWR_WS2812B_STREAM_CHUNK - 1) / TWR_WS2812B_STREAM_CHUNK;
+
+    _twr_ws2812b_stream_fill(_twr_ws2812b_stream_buffer);
+    _twr_ws2812b_stream_fill(_twr_ws2812b_stream_buffer + _TWR_WS2812_STREAM_HALF_WORDS);
+
+    _twr_ws2812b_dma_config.mode = TWR_DMA_MODE_CIRCULAR;
+    _twr_ws2812b_dma_config.address_memory = (void *)_twr_ws2812b_stream_buffer;
+    _twr_ws2812b_dma_config.length = sizeof(_twr_ws2812b_stream_buffer);
+#else
     size_t dma_bit_buffer_size = _twr_ws2812b.buffer->count * _twr_ws2812b.buffer->type * 8;
 
     _twr_ws2812b_dma_config.address_memory = (void *)_twr_ws2812b.dma_bit_buffer;
     _twr_ws2812b_dma_config.length = dma_bit_buffer_size;
-    twr_dma_channel_config(TWR_DMA_CHANNEL_2, &_twr_ws2812b_dma_config);
-    twr_dma_channel_run(TWR_DMA_CHANNEL_2);
+#endif
+    twr_dma_channel_config(_twr_ws2812b.dma_channel, &_twr_ws2812b_dma_config);
+    twr_dma_channel_run(_twr_ws2812b.dma_channel);
 
     TIM2->CNT = _TWR_WS2812_TIMER_PERIOD - 1;
 
@@ -270,30 +281,35 @@ static void _twr_ws2812b_dma_event_handler(twr_dma_channel_t channel, twr_dma_ev
 
     if (event == TWR_DMA_EVENT_DONE)
     {
-        // Stop timer
-        TIM2->CR1 &= ~TIM_CR1_CEN;
+        _twr_ws2812b_reset_pulse();
+    }
+}
 
-        // Disable the DMA requests
-        __HAL_TIM_DISABLE_DMA(&_twr_ws2812b_timer2_handle, TIM_DMA_UPDATE);
+static void _twr_ws2812b_reset_pulse(void)
+{
+    // Stop timer
+    TIM2->CR1 &= ~TIM_CR1_CEN;
 
-        // Disable PWM output Compare 2
-        (&_twr_ws2812b_timer2_handle)->Instance->CCMR1 &= ~(TIM_CCMR1_OC2M_Msk);
-        (&_twr_ws2812b_timer2_handle)->Instance->CCMR1 |= TIM_CCMR1_OC2M_2;
+    // Disable the DMA requests
+    __HAL_TIM_DISABLE_DMA(&_twr_ws2812b_timer2_handle, TIM_DMA_UPDATE);
 
-        // Set 50us period for Treset pulse
-        TIM2->ARR = _TWR_WS2812_TIMER_RESET_PULSE_PERIOD;
-        // Reset the timer
-        TIM2->CNT = 0;
+    // Disable PWM output Compare 2
+    (&_twr_ws2812b_timer2_handle)->Instance->CCMR1 &= ~(TIM_CCMR1_OC2M_Msk);
+    (&_twr_ws2812b_timer2_handle)->Instance->CCMR1 |= TIM_CCMR1_OC2M_2;
 
-        // Generate an update event to reload the prescaler value immediately
-        TIM2->EGR = TIM_EGR_UG;
-        __HAL_TIM_CLEAR_FLAG(&_twr_ws2812b_timer2_handle, TIM_FLAG_UPDATE);
+    // Set 50us period for Treset pulse
+    TIM2->ARR = _TWR_WS2812_TIMER_RESET_PULSE_PERIOD;
+    // Reset the timer
+    TIM2->CNT = 0;
 
-        // Enable TIM2 Update interrupt for Treset signal
-        __HAL_TIM_ENABLE_IT(&_twr_ws2812b_timer2_handle, TIM_IT_UPDATE);
-        // Enable timer
-        TIM2->CR1 |= TIM_CR1_CEN;
-    }
+    // Generate an update event to reload the prescaler value immediately
+    TIM2->EGR = TIM_EGR_UG;
+    __HAL_TIM_CLEAR_FLAG(&_twr_ws2812b_timer2_handle, TIM_FLAG_UPDATE);
+
+    // Enable TIM2 Update interrupt for Treset signal
+    __HAL_TIM_ENABLE_IT(&_twr_ws2812b_timer2_handle, TIM_IT_UPDATE);
+    // Enable timer
+    TIM2->CR1 |= TIM_CR1_CEN;
 }
 
 // TIM2 Interrupt Handler gets executed on every TIM2 Update if enabled
@@ -337,3 +353,93 @@ static void _twr_ws2812b_task(void *param)
         _twr_ws2812b.event_handler(TWR_WS2812B_SEND_DONE, _twr_ws2812b.event_param);
     }
 }
+
+static void _twr_ws2812b_set_pixel(int position, uint8_t first, uint8_t second, uint8_t third, uint8_t fourth)
+{
+#if TWR_WS2812B_STREAM
+    uint8_t *pixel = _twr_ws2812b.pixels + position * _twr_ws2812b.buffer->type;
+
+    *pixel++ = first;
+    *pixel++ = second;
+    *pixel++ = third;
+
+    if (_twr_ws2812b.buffer->type == TWR_LED_STRIP_TYPE_RGBW)
+    {
+        *pixel = fourth;
+    }
+#else
+    uint32_t calculated_position = (position * _twr_ws2812b.buffer->type * 2);
+
+    if (_twr_ws2812b.lut != NULL)
+    {
+        first = _twr_ws2812b.lut[first];
+        second = _twr_ws2812b.lut[second];
+        third = _twr_ws2812b.lut[third];
+        fourth = _twr_ws2812b.lut[fourth];
+    }
+
+    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(first & 0xf0) >> 4];
+    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[first & 0x0f];
+
+    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(second & 0xf0) >> 4];
+    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[second & 0x0f];
+
+    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(third & 0xf0) >> 4];
+    _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[third & 0x0f];
+
+    if (_twr_ws2812b.buffer->type == TWR_LED_STRIP_TYPE_RGBW)
+    {
+        _twr_ws2812b.dma_bit_buffer[calculated_position++] = _twr_ws2812b_pulse_tab[(fourth & 0xf0) >> 4];
+        _twr_ws2812b.dma_bit_buffer[calculated_position] = _twr_ws2812b_pulse_tab[fourth & 0x0f];
+    }
+#endif
+}
+
+#if TWR_WS2812B_STREAM
+
+static void _twr_ws2812b_stream_fill(uint32_t *half)
+{
+    size_t length = _twr_ws2812b.buffer->count * _twr_ws2812b.buffer->type;
+
+    for (size_t i = 0; i < TWR_WS2812B_STREAM_CHUNK; i++)
+    {
+        if (_twr_ws2812b.position < length)
+        {
+            uint8_t value = _twr_ws2812b.pixels[_twr_ws2812b.position++];
+
+            if (_twr_ws2812b.lut != NULL)
+            {
+                value = _twr_ws2812b.lut[value];
+            }
+
+            *half++ = _twr_ws2812b_pulse_tab[value >> 4];
+            *half++ = _twr_ws2812b_pulse_tab[value & 0x0f];
+        }
+        else
+        {
+            // Zero compare keeps output low after the last bit
+            *half++ = 0;
+            *half++ = 0;
+        }
+    }
+}
+
+static void _twr_ws2812b_dma_irq_handler(twr_dma_channel_t channel, twr_dma_event_t event, void *irq_param)
+{
+    (void) irq_param;
+
+    // Transfer stops after one half of zeros, so the last bit is not cut off by stopped timer
+    if (event == TWR_DMA_EVENT_ERROR || ++_twr_ws2812b.halves > _twr_ws2812b.halves_total)
+    {
+        twr_dma_channel_stop(channel);
+
+        _twr_ws2812b_reset_pulse();
+
+        return;
+    }
+
+    // Half just sent is refilled while DMA sends the other one
+    _twr_ws2812b_stream_fill(event == TWR_DMA_EVENT_HALF_DONE ? _twr_ws2812b_stream_buffer : _twr_ws2812b_stream_buffer + _TWR_WS2812_STREAM_HALF_WORDS);
+}
+
+#endif
@@ -120,9 +120,11 @@ static int8_t CDC_Init_FS     (void);
 static int8_t CDC_DeInit_FS   (void);
 static int8_t CDC_Control_FS  (uint8_t cmd, uint8_t* pbuf, uint16_t length);
 static int8_t CDC_Receive_FS  (uint8_t* pbuf, uint32_t *Len);
+static int8_t CDC_TransmitCplt_FS (uint8_t* pbuf, uint32_t *Len, uint8_t epnum);
 
 /* USER CODE BEGIN PRIVATE_FUNCTIONS_DECLARATION */
 void twr_usb_cdc_received_data(const void *buffer, size_t length);
+void twr_usb_cdc_transmit_ready(void);
 
 /* USER CODE END PRIVATE_FUNCTIONS_DECLARATION */
 
@@ -135,7 +137,8 @@ USBD_CDC_ItfTypeDef USBD_Interface_fops_FS =
   CDC_Init_FS,
   CDC_DeInit_FS,
   CDC_Control_FS,
-  CDC_Receive_FS
+  CDC_Receive_FS,
+  CDC_TransmitCplt_FS
 };
 
 /* Private functions ---------------------------------------------------------*/
@@ -151,6 +154,8 @@ static int8_t CDC_Init_FS(void)
   /* Set Application Buffers */
 //  USBD_CDC_SetTxBuffer(&hUsbDeviceFS, UserTxBufferFS, 0);
   USBD_CDC_SetRxBuffer(&hUsbDeviceFS, UserRxBufferFS);
+  /* Transfer interrupted by reset or disconnection never completes */
+  twr_usb_cdc_transmit_ready();
   return (USBD_OK);
   /* USER CODE END 3 */
 }
@@ -303,6 +308,26 @@ uint8_t CDC_Transmit_FS(uint8_t* Buf, uint16_t Len)
   return result;
 }
 
+/**
+  * @brief  CDC_TransmitCplt_FS
+  *         Data transmitted callback
+  *
+  * @param  Buf: Buffer of data transmitted
+  * @param  Len: Number of data transmitted (in bytes)
+  * @param  epnum: Endpoint number
+  * @retval Result of the operation: USBD_OK
+  */
+static int8_t CDC_TransmitCplt_FS(uint8_t *Buf, uint32_t *Len, uint8_t epnum)
+{
+  /* USER CODE BEGIN 13 */
+  (void) Buf;
+  (void) Len;
+  (void) epnum;
+  twr_usb_cdc_transmit_ready();
+  return (USBD_OK);
+  /* USER CODE END 13 */
+}
+
 /* USER CODE BEGIN PRIVATE_FUNCTIONS_IMPLEMENTATION */
 /* USER CODE END PRIVATE_FUNCTIONS_IMPLEMENTATION */
 
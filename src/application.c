@@ -1,14 +1,142 @@
 #include <application.h>
+#include <report.h>
 
-// Service mode interval defines how much time
-#define SERVICE_MODE_INTERVAL (15 * 60 * 1000)
-#define BATTERY_UPDATE_INTERVAL (60 * 60 * 1000)
-#define TEMPERATURE_PUB_INTERVAL (15 * 60 * 1000)
-#define TEMPERATURE_PUB_DIFFERENCE 0.2f
+// Intervals, thresholds and report stream settings are given by power profile (see profiles below)
 #define TEMPERATURE_UPDATE_SERVICE_INTERVAL (1 * 1000)
-#define TEMPERATURE_UPDATE_NORMAL_INTERVAL (10 * 1000)
-#define ACCELEROMETER_UPDATE_SERVICE_INTERVAL (1 * 1000)
-#define ACCELEROMETER_UPDATE_NORMAL_INTERVAL (10 * 1000)
+
+// Version of stored configuration, change when config_t changes
+#define CONFIG_SIGNATURE 0x50524f46494c4501
+
+// Dice face must stay this long before it is reported, handling and vibration do not produce report bursts
+#define DICE_DWELL_TIME 500
+#define DICE_HYSTERESIS 0.1f
+
+// Accelerometer accepts configuration this long after it has been initialized
+#define ACCELEROMETER_BOOT_DELAY 5
+
+// Vibration features computed from accelerometer FIFO stream and reported instead of raw samples
+#ifndef VIBRATION
+#define VIBRATION 0
+#endif
+
+#define VIBRATION_ODR TWR_LIS2DH12_ODR_100HZ
+#define VIBRATION_SAMPLE_RATE 100
+#define VIBRATION_WATERMARK 16
+
+// Format of the UART report stream (REPORT_FORMAT_TEXT or REPORT_FORMAT_BINARY)
+#ifndef REPORT_FORMAT
+#define REPORT_FORMAT REPORT_FORMAT_TEXT
+#endif
+
+// Binary reports are kept in EEPROM while host sends no keepalive bytes and sent when it comes back
+#ifndef REPORT_STORE
+#define REPORT_STORE 0
+#endif
+
+// Stored configuration occupies the beginning of EEPROM
+#define REPORT_STORE_ADDRESS 256
+#define REPORT_STORE_SIZE 1536
+
+// Copy of report stream and log over USB CDC (keeps PLL running while enabled)
+#ifndef REPORT_USB_CDC
+#define REPORT_USB_CDC 0
+#endif
+
+// AT commands on report UART (AT$PROFILE), receiving keeps PLL running, so disable for the lowest consumption
+#ifndef ATCI
+#define ATCI 1
+#endif
+
+// Power profile sets all intervals and report stream settings together
+typedef struct
+{
+    // Time after start in which thermometer is sampled at TEMPERATURE_UPDATE_SERVICE_INTERVAL
+    uint32_t service_mode_interval;
+
+    uint32_t battery_update_interval;
+
+    // Thermometer update interval adapts to rate of change of temperature within these bounds
+    uint32_t temperature_update_min_interval;
+    uint32_t temperature_update_max_interval;
+
+    uint32_t temperature_pub_interval;
+    float temperature_pub_difference;
+
+    // Window in which reports raised close together are sent as one UART write
+    uint32_t report_window;
+
+    // Host is considered gone when no byte arrives within this timeout
+    uint32_t report_link_timeout;
+
+} profile_t;
+
+typedef enum
+{
+    PROFILE_RESPONSIVE = 0,
+    PROFILE_BALANCED = 1,
+    PROFILE_ULTRA_LOW_POWER = 2,
+    PROFILE_COUNT = 3
+
+} profile_id_t;
+
+static const char *profile_names[PROFILE_COUNT] = { "responsive", "balanced", "ultra-low-power" };
+
+static const profile_t profiles[PROFILE_COUNT] =
+{
+    [PROFILE_RESPONSIVE] =
+    {
+        .service_mode_interval = 15 * 60 * 1000,
+        .battery_update_interval = 10 * 60 * 1000,
+        .temperature_update_min_interval = 1 * 1000,
+        .temperature_update_max_interval = 10 * 1000,
+        .temperature_pub_interval = 60 * 1000,
+        .temperature_pub_difference = 0.1f,
+        .report_window = 10,
+        .report_link_timeout = 10 * 1000
+    },
+    [PROFILE_BALANCED] =
+    {
+        .service_mode_interval = 15 * 60 * 1000,
+        .battery_update_interval = 60 * 60 * 1000,
+        .temperature_update_min_interval = 10 * 1000,
+        .temperature_update_max_interval = 2 * 60 * 1000,
+        .temperature_pub_interval = 15 * 60 * 1000,
+        .temperature_pub_difference = 0.2f,
+        .report_window = 50,
+        .report_link_timeout = 30 * 1000
+    },
+    [PROFILE_ULTRA_LOW_POWER] =
+    {
+        .service_mode_interval = 60 * 1000,
+        .battery_update_interval = 6 * 60 * 60 * 1000,
+        .temperature_update_min_interval = 60 * 1000,
+        .temperature_update_max_interval = 10 * 60 * 1000,
+        .temperature_pub_interval = 60 * 60 * 1000,
+        .temperature_pub_difference = 0.5f,
+        .report_window = 500,
+        .report_link_timeout = 2 * 60 * 1000
+    }
+};
+
+// Configuration stored in EEPROM
+typedef struct
+{
+    uint8_t profile_id;
+    profile_t profile;
+
+} config_t;
+
+config_t config;
+
+// Thermometer samples at fixed interval until exit_service_mode_task
+bool service_mode = true;
+
+// Transports of report stream
+twr_transport_t uart_transport;
+#if REPORT_USB_CDC
+twr_transport_t usb_cdc_transport;
+twr_transport_t report_transport;
+#endif
 
 // LED instance
 twr_led_t led;
@@ -19,9 +147,18 @@ twr_button_t button;
 // Thermometer instance
 twr_tmp112_t tmp112;
 
+// Adaptive update interval of thermometer
+twr_sampler_t tmp112_sampler;
+
 // Accelerometer instance
 twr_lis2dh12_t lis2dh12;
 
+#if VIBRATION
+// Vibration feature extraction instance and buffer for FIFO blocks
+twr_vibration_t vibration;
+twr_lis2dh12_result_raw_t vibration_fifo_buffer[TWR_LIS2DH12_FIFO_SIZE];
+#endif
+
 // Dice instance
 twr_dice_t dice;
 
@@ -37,21 +174,176 @@ bool button_hold_event;
 // Time of next temperature report
 twr_tick_t tick_temperature_report = 0;
 
+#if REPORT_STORE || ATCI
+// FIFO for bytes from host, keepalive bytes and AT commands
+twr_fifo_t uart_read_fifo;
+uint8_t uart_read_fifo_buffer[64];
+
+// This function tracks link to host by its keepalive bytes and passes AT commands on
+void uart_event_handler(twr_uart_channel_t channel, twr_uart_event_t event, void *event_param)
+{
+    if (event == TWR_UART_EVENT_ASYNC_READ_DATA)
+    {
+#if ATCI
+        // Bytes are read by ATCI, which ignores empty lines, so line ends make good keepalive
+        twr_atci_receive();
+#else
+        uint8_t buffer[16];
+
+        while (twr_uart_async_read(channel, buffer, sizeof(buffer)) != 0)
+        {
+            continue;
+        }
+#endif
+
+#if REPORT_STORE
+        report_set_link(true);
+#endif
+    }
+#if REPORT_STORE
+    else if (event == TWR_UART_EVENT_ASYNC_READ_TIMEOUT)
+    {
+        report_set_link(false);
+    }
+#endif
+}
+#endif
+
+// This function applies settings of current profile to running application
+void profile_apply(void)
+{
+    twr_module_battery_set_update_interval(config.profile.battery_update_interval);
+
+    twr_sampler_set_threshold(&tmp112_sampler, config.profile.temperature_pub_difference);
+
+    // Service mode keeps its fixed interval until it ends
+    if (!service_mode)
+    {
+        twr_sampler_set_bounds(&tmp112_sampler, config.profile.temperature_update_min_interval, config.profile.temperature_update_max_interval);
+    }
+
+    report_set_window(config.profile.report_window);
+
+#if REPORT_STORE
+    // Restart reading to apply new link timeout
+    twr_uart_async_read_cancel(TWR_UART_UART2);
+    twr_uart_async_read_start(TWR_UART_UART2, config.profile.report_link_timeout);
+#endif
+}
+
+// This function switches to profile and stores it
+void profile_select(profile_id_t profile_id)
+{
+    config.profile_id = profile_id;
+    config.profile = profiles[profile_id];
+
+    twr_config_save();
+}
+
+#if ATCI
+// Read function of ATCI on report UART
+size_t atci_uart_read(void *buffer, size_t length)
+{
+    return twr_uart_async_read(TWR_UART_UART2, buffer, length);
+}
+
+// AT$PROFILE? prints current profile
+bool atci_profile_read(void)
+{
+    twr_atci_printfln("$PROFILE: %d,\"%s\"", config.profile_id, profile_names[config.profile_id]);
+
+    return true;
+}
+
+// AT$PROFILE=<number> or AT$PROFILE="<name>" switches profile
+bool atci_profile_set(twr_atci_param_t *param)
+{
+    uint32_t profile_id;
+
+    if (param->length > param->offset && param->txt[param->offset] == '"')
+    {
+        char name[16];
+
+        if (!twr_atci_get_string(param, name, sizeof(name)))
+        {
+            return false;
+        }
+
+        for (profile_id = 0; profile_id < PROFILE_COUNT; profile_id++)
+        {
+            if (strcmp(name, profile_names[profile_id]) == 0)
+            {
+                break;
+            }
+        }
+    }
+    else if (!twr_atci_get_uint(param, &profile_id))
+    {
+        return false;
+    }
+
+    if (profile_id >= PROFILE_COUNT)
+    {
+        return false;
+    }
+
+    profile_select(profile_id);
+
+    profile_apply();
+
+    return true;
+}
+
+#if TWR_LATENCY
+// AT$LATENCY prints button latency of stages in microseconds and clears it
+bool atci_latency_action(void)
+{
+    static const char *stages[TWR_LATENCY_STAGE_COUNT] = { "handler", "transmit", "total" };
+
+    for (int i = 0; i < TWR_LATENCY_STAGE_COUNT; i++)
+    {
+        twr_latency_stats_t stats;
+
+        twr_latency_get_stats(TWR_LATENCY_PROBE_BUTTON, i, &stats);
+
+        twr_atci_printfln("$LATENCY: \"%s\",%lu,%lu,%lu,%lu,%lu", stages[i], (unsigned long) stats.count,
+                          (unsigned long) stats.min, (unsigned long) stats.avg, (unsigned long) stats.p99,
+                          (unsigned long) stats.max);
+    }
+
+    twr_latency_reset(TWR_LATENCY_PROBE_BUTTON);
+
+    return true;
+}
+#endif
+
+static const twr_atci_command_t atci_commands[] =
+{
+    {"$PROFILE", NULL, atci_profile_set, atci_profile_read, NULL, "0:responsive, 1:balanced, 2:ultra-low-power"},
+#if TWR_LATENCY
+    {"$LATENCY", atci_latency_action, NULL, NULL, NULL, "Button latency: stage,count,min,avg,p99,max in us"},
+#endif
+    TWR_ATCI_COMMAND_CLAC,
+    TWR_ATCI_COMMAND_HELP
+};
+#endif
+
 // This function dispatches button events
 void button_event_handler(twr_button_t *self, twr_button_event_t event, void *event_param)
 {
     if (event == TWR_BUTTON_EVENT_CLICK)
     {
+        // Latency is measured from release edge to transmission of report
+        twr_latency_handler(TWR_LATENCY_PROBE_BUTTON);
+
         // Pulse LED for 100 milliseconds
         twr_led_pulse(&led, 100);
 
         // Increment press count
         button_click_count++;
 
-        // Publish button message on radio
-        char buffer[32];
-        sprintf(buffer, "Button: %d", button_click_count);
-        twr_uart_write(TWR_UART_UART2, buffer, strlen(buffer));
+        // Report button click
+        report_button_click(button_click_count);
     }
     else if (event == TWR_BUTTON_EVENT_HOLD)
     {
@@ -61,10 +353,8 @@ void button_event_handler(twr_button_t *self, twr_button_event_t event, void *ev
         // Increment hold count
         button_hold_count++;
 
-        // Publish message on radio
-        char buffer[32];
-        sprintf(buffer, "Button_hold: %d", button_hold_count);
-        twr_uart_write(TWR_UART_UART2, buffer, strlen(buffer));
+        // Report button hold
+        report_button_hold(button_hold_count);
 
         // Set button hold event flag
         button_hold_event = true;
@@ -80,11 +370,11 @@ void button_event_handler(twr_button_t *self, twr_button_event_t event, void *ev
     {
         if (button_hold_event)
         {
-            int hold_duration = twr_tick_get() - tick_start_button_press;
+            twr_latency_handler(TWR_LATENCY_PROBE_BUTTON);
+
+            twr_tick_t hold_duration = twr_tick_get() - tick_start_button_press;
 
-            char buffer[32];
-            sprintf(buffer, "Button_hold_duration: %d\r\n", hold_duration);
-            twr_uart_write(TWR_UART_UART2, buffer, strlen(buffer));
+            report_button_hold_duration(hold_duration);
         }
     }
 }
@@ -100,9 +390,7 @@ void battery_event_handler(twr_module_battery_event_t event, void *event_param)
         // Read battery voltage
         if (twr_module_battery_get_voltage(&voltage))
         {
-            char buffer[32];
-            sprintf(buffer, "Battery: %.2f\r\n", voltage);
-            twr_uart_write(TWR_UART_UART2, buffer, strlen(buffer));
+            report_battery(voltage);
         }
     }
 }
@@ -118,6 +406,9 @@ void tmp112_event_handler(twr_tmp112_t *self, twr_tmp112_event_t event, void *ev
         // Successfully read temperature?
         if (twr_tmp112_get_temperature_celsius(self, &temperature))
         {
+            // Sample faster while temperature moves, slower while it is stable
+            twr_sampler_feed(&tmp112_sampler, temperature);
+
             // Implicitly do not publish message on radio
             bool publish = false;
 
@@ -135,7 +426,7 @@ void tmp112_event_handler(twr_tmp112_t *self, twr_tmp112_event_t event, void *ev
             if (last_published_temperature != NAN)
             {
                 // Is temperature difference from last published value significant?
-                if (fabsf(temperature - last_published_temperature) >= TEMPERATURE_PUB_DIFFERENCE)
+                if (fabsf(temperature - last_published_temperature) >= config.profile.temperature_pub_difference)
                 {
                     // Publish message on radio
                     publish = true;
@@ -145,12 +436,10 @@ void tmp112_event_handler(twr_tmp112_t *self, twr_tmp112_event_t event, void *ev
             // Publish message on radio?
             if (publish)
             {
-                char buffer[32];
-                sprintf(buffer, "Temperature: %.2f\r\n", temperature);
-                twr_uart_write(TWR_UART_UART2, buffer, strlen(buffer));
+                report_temperature(temperature);
 
                 // Schedule next temperature report
-                tick_temperature_report = twr_tick_get() + TEMPERATURE_PUB_INTERVAL;
+                tick_temperature_report = twr_tick_get() + config.profile.temperature_pub_interval;
 
                 // Remember last published value
                 last_published_temperature = temperature;
@@ -163,91 +452,230 @@ void tmp112_event_handler(twr_tmp112_t *self, twr_tmp112_event_t event, void *ev
     }
 }
 
+// This function reports dice face if it changed from last time
+void dice_face_report(void)
+{
+    // This variable holds last dice face
+    static twr_dice_face_t last_face = TWR_DICE_FACE_UNKNOWN;
+
+    // Get current dice face
+    twr_dice_face_t face = twr_dice_get_face(&dice);
+
+    // Did dice face change from last time?
+    if (last_face != face)
+    {
+        // Remember last dice face
+        last_face = face;
+
+        report_orientation(face);
+    }
+}
+
+// This function dispatches dice events
+void dice_event_handler(twr_dice_t *self, twr_dice_event_t event, void *event_param)
+{
+    // Face change has passed dwell filter?
+    if (event == TWR_DICE_EVENT_FACE_CHANGE)
+    {
+        dice_face_report();
+    }
+}
+
 // This function dispatches accelerometer events
 void lis2dh12_event_handler(twr_lis2dh12_t *self, twr_lis2dh12_event_t event, void *event_param)
 {
-    // Update event?
+    // Update event (initial measurement)?
     if (event == TWR_LIS2DH12_EVENT_UPDATE)
     {
-        twr_lis2dh12_result_g_t result;
+        twr_lis2dh12_result_raw_t result;
 
-        // Successfully read accelerometer vectors?
-        if (twr_lis2dh12_get_result_g(self, &result))
+        // Successfully read accelerometer samples?
+        if (twr_lis2dh12_get_result_raw(self, &result))
         {
-            // Update dice with new vectors
-            twr_dice_feed_vectors(&dice, result.x_axis, result.y_axis, result.z_axis);
-
-            // This variable holds last dice face
-            static twr_dice_face_t last_face = TWR_DICE_FACE_UNKNOWN;
-
-            // Get current dice face
-            twr_dice_face_t face = twr_dice_get_face(&dice);
+            // Update dice with new samples, raw path avoids soft-float
+            twr_dice_feed_raw(&dice, result.x_axis, result.y_axis, result.z_axis);
+        }
+    }
+    // Orientation change event?
+    else if (event == TWR_LIS2DH12_EVENT_ORIENTATION)
+    {
+        twr_dice_face_t face;
 
-            // Did dice face change from last time?
-            if (last_face != face)
-            {
-                // Remember last dice face
-                last_face = face;
+        // Update dice with face recognized by accelerometer
+        if (twr_lis2dh12_get_orientation(self, &face))
+        {
+            twr_dice_feed_face(&dice, face);
+        }
+    }
+#if VIBRATION
+    // FIFO block of samples?
+    else if (event == TWR_LIS2DH12_EVENT_FIFO)
+    {
+        const twr_lis2dh12_result_raw_t *samples;
 
-                // Convert dice face to integer
-                int orientation = face;
+        size_t count = twr_lis2dh12_get_fifo_result_raw(self, &samples);
 
-                char buffer[32];
-                sprintf(buffer, "Orientation: %d\r\n", orientation);
-                twr_uart_write(TWR_UART_UART2, buffer, strlen(buffer));
-            }
-        }
+        twr_vibration_feed_raw(&vibration, samples, count);
     }
+#endif
     // Error event?
     else if (event == TWR_LIS2DH12_EVENT_ERROR)
     {
     }
 }
 
+#if VIBRATION
+// This function dispatches vibration events
+void vibration_event_handler(twr_vibration_t *self, twr_vibration_event_t event, void *event_param)
+{
+    twr_vibration_features_t features;
+
+    // Features of block computed?
+    if (event == TWR_VIBRATION_EVENT_UPDATE && twr_vibration_get_features(self, &features))
+    {
+        report_vibration(&features);
+    }
+}
+#endif
+
 // This function is run as task and exits service mode
 void exit_service_mode_task(void *param)
 {
-    // Set thermometer update interval to normal
-    twr_tmp112_set_update_interval(&tmp112, TEMPERATURE_UPDATE_NORMAL_INTERVAL);
+    service_mode = false;
 
-    // Set accelerometer update interval to normal
-    twr_lis2dh12_set_update_interval(&lis2dh12, ACCELEROMETER_UPDATE_NORMAL_INTERVAL);
+    // Let thermometer update interval adapt
+    twr_sampler_set_bounds(&tmp112_sampler, config.profile.temperature_update_min_interval, config.profile.temperature_update_max_interval);
 
     // Unregister current task (it has only one-shot purpose)
     twr_scheduler_unregister(twr_scheduler_get_current_task_id());
 }
 
-void application_init(void)
+// Boot step bringing up battery measurement
+void battery_boot_step(void *param)
 {
-    // Initialize LED
-    twr_led_init(&led, TWR_GPIO_LED, false, false);
-    twr_led_set_mode(&led, TWR_LED_MODE_OFF);
-
-    // Initialize button
-    twr_button_init(&button, TWR_GPIO_BUTTON, TWR_GPIO_PULL_DOWN, false);
-    twr_button_set_event_handler(&button, button_event_handler, NULL);
+    (void) param;
 
-    // Initialize battery
     twr_module_battery_init();
     twr_module_battery_set_event_handler(battery_event_handler, NULL);
-    twr_module_battery_set_update_interval(BATTERY_UPDATE_INTERVAL);
+    twr_module_battery_set_update_interval(config.profile.battery_update_interval);
+}
+
+// Boot step bringing up thermometer
+void thermometer_boot_step(void *param)
+{
+    (void) param;
 
-    // Initialize thermometer
     twr_tmp112_init(&tmp112, TWR_I2C_I2C0, 0x49);
     twr_tmp112_set_event_handler(&tmp112, tmp112_event_handler, NULL);
-    twr_tmp112_set_update_interval(&tmp112, TEMPERATURE_UPDATE_SERVICE_INTERVAL);
 
-    // Initialize accelerometer
+    // Service mode samples at fixed interval until exit_service_mode_task
+    twr_sampler_init(&tmp112_sampler, (twr_sampler_set_interval_t) twr_tmp112_set_update_interval, &tmp112,
+                     TEMPERATURE_UPDATE_SERVICE_INTERVAL, TEMPERATURE_UPDATE_SERVICE_INTERVAL, config.profile.temperature_pub_difference);
+}
+
+// Boot step bringing up accelerometer and dice
+void accelerometer_boot_step(void *param)
+{
+    (void) param;
+
     twr_lis2dh12_init(&lis2dh12, TWR_I2C_I2C0, 0x19);
     twr_lis2dh12_set_event_handler(&lis2dh12, lis2dh12_event_handler, NULL);
-    twr_lis2dh12_set_update_interval(&lis2dh12, ACCELEROMETER_UPDATE_SERVICE_INTERVAL);
 
-    // Initialize dice
     twr_dice_init(&dice, TWR_DICE_FACE_UNKNOWN);
+    twr_dice_set_raw_one_g(&dice, twr_lis2dh12_get_raw_one_g(&lis2dh12));
+    twr_dice_set_hysteresis(&dice, DICE_HYSTERESIS);
+    twr_dice_set_dwell(&dice, 1, DICE_DWELL_TIME);
+    twr_dice_set_event_handler(&dice, dice_event_handler, NULL);
+}
+
+// Boot step configuring orientation detection, once accelerometer accepts its registers
+void orientation_boot_step(void *param)
+{
+    (void) param;
+
+    // Orientation changes are signalled by accelerometer interrupt, there is no periodic polling
+    twr_lis2dh12_set_orientation_detection(&lis2dh12, true);
 
-    twr_scheduler_register(exit_service_mode_task, NULL, SERVICE_MODE_INTERVAL);
+#if VIBRATION
+    twr_vibration_init(&vibration, VIBRATION_SAMPLE_RATE);
+    twr_vibration_set_event_handler(&vibration, vibration_event_handler, NULL);
+
+    twr_lis2dh12_fifo_t fifo = { .odr = VIBRATION_ODR, .watermark = VIBRATION_WATERMARK, .buffer = vibration_fifo_buffer };
+
+    twr_lis2dh12_set_fifo(&lis2dh12, &fifo);
+#endif
+}
+
+void application_init(void)
+{
+#if TWR_LATENCY
+    // Button latency is stamped by high-resolution clock
+    twr_latency_init();
+#endif
+
+    // Load configuration, fresh or invalidated one has no profile values
+    twr_config_init(CONFIG_SIGNATURE, &config, sizeof(config), NULL);
+
+    if (config.profile_id >= PROFILE_COUNT || config.profile.service_mode_interval == 0)
+    {
+        profile_select(PROFILE_BALANCED);
+    }
+
+    // Initialize LED
+    twr_led_init(&led, TWR_GPIO_LED, false, false);
+    twr_led_set_mode(&led, TWR_LED_MODE_OFF);
 
     twr_uart_init(TWR_UART_UART2, TWR_UART_BAUDRATE_115200, TWR_UART_SETTING_8N1);
+    twr_transport_init(&uart_transport, twr_uart_get_transport_driver(), TWR_UART_UART2);
+
+#if REPORT_USB_CDC
+    twr_usb_cdc_init();
+    twr_transport_init(&usb_cdc_transport, twr_usb_cdc_get_transport_driver(), 0);
+
+    // Stream goes to every transport which is connected
+    twr_transport_t *report_transports[] = { &uart_transport, &usb_cdc_transport };
+    twr_transport_init_fanout(&report_transport, report_transports, 2);
+
+    // Initialize report stream, every other part reports through it
+    report_init(&report_transport, REPORT_FORMAT);
+#else
+    // Initialize report stream, every other part reports through it
+    report_init(&uart_transport, REPORT_FORMAT);
+#endif
+    report_set_window(config.profile.report_window);
+
+#if REPORT_STORE
+    report_store_init(REPORT_STORE_ADDRESS, REPORT_STORE_SIZE);
+#endif
+
+#if ATCI
+    // AT commands share report UART, its bytes are read on receive event instead of polling
+    twr_atci_init(atci_commands, TWR_ATCI_COMMANDS_LENGTH(atci_commands));
+    twr_atci_set_transport(&uart_transport, atci_uart_read);
+    twr_atci_set_poll_interval(TWR_TICK_INFINITY);
+#endif
+
+#if REPORT_STORE || ATCI
+    twr_fifo_init(&uart_read_fifo, uart_read_fifo_buffer, sizeof(uart_read_fifo_buffer));
+    twr_uart_set_async_fifo(TWR_UART_UART2, NULL, &uart_read_fifo);
+    twr_uart_set_event_handler(TWR_UART_UART2, uart_event_handler, NULL);
+    twr_uart_async_read_start(TWR_UART_UART2, config.profile.report_link_timeout);
+#endif
+
+    // Initialize button
+    twr_button_init(&button, TWR_GPIO_BUTTON, TWR_GPIO_PULL_DOWN, false);
+    twr_button_set_event_handler(&button, button_event_handler, NULL);
+    twr_button_set_interrupt(&button, true);
+
+    // Sensors are brought up by scheduler in independent chains
+    twr_boot_register("battery", battery_boot_step, NULL, TWR_BOOT_STEP_NONE, 0);
+    twr_boot_register("thermometer", thermometer_boot_step, NULL, TWR_BOOT_STEP_NONE, 0);
+
+    int accelerometer = twr_boot_register("accelerometer", accelerometer_boot_step, NULL, TWR_BOOT_STEP_NONE, 0);
+
+    twr_boot_register("orientation", orientation_boot_step, NULL, accelerometer, ACCELEROMETER_BOOT_DELAY);
+
+    twr_scheduler_register(exit_service_mode_task, NULL, config.profile.service_mode_interval);
 
     // Pulse LED
     twr_led_pulse(&led, 2000);
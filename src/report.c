@@ -0,0 +1,510 @@
+#include <report.h>
+#include <twr_crc.h>
+#include <twr_eeprom.h>
+
+#define REPORT_FRAME_SYNC 0xa5
+#define REPORT_FRAME_CRC_POLYNOMIAL 0x07
+#define REPORT_FRAME_CRC_INITIALIZATION 0x00
+#define REPORT_FRAME_PAYLOAD_MAX 60
+#define REPORT_FRAME_OVERHEAD 4
+#define REPORT_BUFFER_SIZE 128
+#define REPORT_TEXT_LINE_MAX 96
+#define REPORT_STORE_RECORD_SIZE 12
+#define REPORT_STORE_RECORD_PAYLOAD_MAX 4
+#define REPORT_STORE_CAPACITY_MAX 128
+#define REPORT_STORE_CRC_INITIALIZATION 0xff
+#define REPORT_STORE_DRAIN_INTERVAL 20
+
+static struct
+{
+    twr_transport_t *transport;
+    report_format_t format;
+    twr_tick_t window;
+    twr_scheduler_task_id_t flush_task_id;
+    uint8_t buffer[REPORT_BUFFER_SIZE];
+    size_t length;
+
+    bool link_down;
+    uint32_t store_address;
+    int store_capacity;
+    int store_tail;
+    int store_count;
+    int store_boot_count;
+    uint8_t store_sequence;
+    uint32_t store_rejected_count;
+    twr_scheduler_task_id_t drain_task_id;
+
+} _report;
+
+static void _report_flush_task(void *param);
+static void _report_write(const void *buffer, size_t length);
+static void _report_text(const char *format, ...);
+static void _report_frame(report_type_t type, const uint8_t *payload, uint8_t length);
+static void _report_frame_u16(report_type_t type, uint16_t value);
+static bool _report_store_read(int position, uint8_t *record);
+static void _report_store_put(report_type_t type, const uint8_t *payload, uint8_t length);
+static void _report_drain_task(void *param);
+
+void report_init(twr_transport_t *transport, report_format_t format)
+{
+    memset(&_report, 0, sizeof(_report));
+
+    _report.transport = transport;
+    _report.format = format;
+
+    _report.flush_task_id = twr_scheduler_register(_report_flush_task, NULL, TWR_TICK_INFINITY);
+}
+
+void report_store_init(uint32_t address, size_t size)
+{
+    uint8_t record[REPORT_STORE_RECORD_SIZE];
+    uint8_t previous[REPORT_STORE_RECORD_SIZE];
+
+    _report.store_address = address;
+    _report.store_capacity = size / REPORT_STORE_RECORD_SIZE;
+
+    if (_report.store_capacity > REPORT_STORE_CAPACITY_MAX)
+    {
+        _report.store_capacity = REPORT_STORE_CAPACITY_MAX;
+    }
+
+    _report.store_tail = 0;
+    _report.store_count = 0;
+    _report.store_sequence = 0;
+
+    // The oldest record is valid one which does not follow valid record with preceding sequence number
+    for (int i = 0; i < _report.store_capacity; i++)
+    {
+        if (!_report_store_read(i, record))
+        {
+            continue;
+        }
+
+        if (_report_store_read((i + _report.store_capacity - 1) % _report.store_capacity, previous) &&
+            ((uint8_t) (previous[0] + 1) == record[0]))
+        {
+            continue;
+        }
+
+        _report.store_tail = i;
+
+        break;
+    }
+
+    while ((_report.store_count < _report.store_capacity) &&
+           _report_store_read((_report.store_tail + _report.store_count) % _report.store_capacity, record) &&
+           ((_report.store_count == 0) || (record[0] == _report.store_sequence)))
+    {
+        _report.store_sequence = record[0] + 1;
+
+        _report.store_count++;
+    }
+
+    // Age of records from before reset is unknown
+    _report.store_boot_count = _report.store_count;
+
+    // Host is not known to listen after reset, so records are kept until it shows up by report_set_link
+    _report.link_down = _report.store_capacity > 0;
+
+    _report.drain_task_id = twr_scheduler_register(_report_drain_task, NULL, TWR_TICK_INFINITY);
+}
+
+uint32_t report_store_get_rejected_count(void)
+{
+    return _report.store_rejected_count;
+}
+
+void report_set_link(bool up)
+{
+    _report.link_down = !up;
+
+    if (up && (_report.store_capacity > 0))
+    {
+        twr_scheduler_plan_now(_report.drain_task_id);
+    }
+}
+
+void report_set_window(twr_tick_t window)
+{
+    if (window == 0)
+    {
+        report_flush();
+    }
+
+    _report.window = window;
+}
+
+void report_flush(void)
+{
+    if (_report.length != 0)
+    {
+        twr_transport_write(_report.transport, _report.buffer, _report.length);
+
+        _report.length = 0;
+
+        twr_transport_flush(_report.transport);
+
+        // Pending report of button event has been transmitted
+        twr_latency_transmit(TWR_LATENCY_PROBE_BUTTON);
+    }
+    else
+    {
+        twr_transport_flush(_report.transport);
+    }
+
+    twr_scheduler_plan_absolute(_report.flush_task_id, TWR_TICK_INFINITY);
+}
+
+void report_button_click(uint16_t count)
+{
+    if (_report.format == REPORT_FORMAT_BINARY)
+    {
+        _report_frame_u16(REPORT_TYPE_BUTTON_CLICK, count);
+    }
+    else
+    {
+        _report_text("Button: %d", count);
+    }
+}
+
+void report_button_hold(uint16_t count)
+{
+    if (_report.format == REPORT_FORMAT_BINARY)
+    {
+        _report_frame_u16(REPORT_TYPE_BUTTON_HOLD, count);
+    }
+    else
+    {
+        _report_text("Button_hold: %d", count);
+    }
+}
+
+void report_button_hold_duration(uint32_t duration)
+{
+    if (_report.format == REPORT_FORMAT_BINARY)
+    {
+        uint8_t payload[4] =
+        {
+            duration, duration >> 8, duration >> 16, duration >> 24
+        };
+
+        _report_frame(REPORT_TYPE_BUTTON_HOLD_DURATION, payload, sizeof(payload));
+    }
+    else
+    {
+        _report_text("Button_hold_duration: %lu\r\n", (unsigned long) duration);
+    }
+}
+
+void report_battery(float voltage)
+{
+    if (_report.format == REPORT_FORMAT_BINARY)
+    {
+        // Convert to millivolts with rounding
+        _report_frame_u16(REPORT_TYPE_BATTERY, voltage > 0.f ? (uint16_t) (voltage * 1000.f + 0.5f) : 0);
+    }
+    else
+    {
+        _report_text("Battery: %.2f\r\n", voltage);
+    }
+}
+
+void report_temperature(float temperature)
+{
+    if (_report.format == REPORT_FORMAT_BINARY)
+    {
+        // Convert to hundredths of degree with rounding to nearest
+        int16_t value = (int16_t) (temperature * 100.f + (temperature < 0.f ? -0.5f : 0.5f));
+
+        _report_frame_u16(REPORT_TYPE_TEMPERATURE, (uint16_t) value);
+    }
+    else
+    {
+        _report_text("Temperature: %.2f\r\n", temperature);
+    }
+}
+
+void report_orientation(twr_dice_face_t face)
+{
+    if (_report.format == REPORT_FORMAT_BINARY)
+    {
+        uint8_t payload = (uint8_t) face;
+
+        _report_frame(REPORT_TYPE_ORIENTATION, &payload, sizeof(payload));
+    }
+    else
+    {
+        _report_text("Orientation: %d\r\n", (int) face);
+    }
+}
+
+void report_vibration(const twr_vibration_features_t *features)
+{
+    if (_report.format == REPORT_FORMAT_BINARY)
+    {
+        uint8_t payload[19];
+        uint8_t *p = payload;
+
+        for (int axis = 0; axis < 3; axis++)
+        {
+            *p++ = features->rms[axis];
+            *p++ = features->rms[axis] >> 8;
+        }
+
+        for (int axis = 0; axis < 3; axis++)
+        {
+            *p++ = features->peak_to_peak[axis];
+            *p++ = features->peak_to_peak[axis] >> 8;
+        }
+
+        *p++ = features->axis;
+        *p++ = features->zero_crossings;
+        *p++ = features->zero_crossings >> 8;
+        *p++ = features->frequency;
+        *p++ = features->frequency >> 8;
+        *p++ = features->amplitude;
+        *p++ = features->amplitude >> 8;
+
+        _report_frame(REPORT_TYPE_VIBRATION, payload, sizeof(payload));
+    }
+    else
+    {
+        _report_text("Vibration: %u %u %u %u %u %u %u %u %u.%u %u\r\n",
+                     features->rms[0], features->rms[1], features->rms[2],
+                     features->peak_to_peak[0], features->peak_to_peak[1], features->peak_to_peak[2],
+                     features->axis, features->zero_crossings, features->frequency / 10, features->frequency % 10,
+                     features->amplitude);
+    }
+}
+
+static void _report_flush_task(void *param)
+{
+    (void) param;
+
+    report_flush();
+}
+
+static void _report_write(const void *buffer, size_t length)
+{
+    if (_report.window == 0 || length > sizeof(_report.buffer))
+    {
+        report_flush();
+
+        twr_transport_write(_report.transport, buffer, length);
+
+        twr_latency_transmit(TWR_LATENCY_PROBE_BUTTON);
+
+        return;
+    }
+
+    // Does not fit into the pending frame?
+    if (_report.length + length > sizeof(_report.buffer))
+    {
+        report_flush();
+    }
+
+    // First report opens the window, so no report waits longer than that
+    if (_report.length == 0)
+    {
+        twr_scheduler_plan_from_now(_report.flush_task_id, _report.window);
+    }
+
+    memcpy(&_report.buffer[_report.length], buffer, length);
+
+    _report.length += length;
+}
+
+static void _report_text(const char *format, ...)
+{
+    char buffer[REPORT_TEXT_LINE_MAX];
+
+    va_list ap;
+
+    va_start(ap, format);
+    int length = vsnprintf(buffer, sizeof(buffer), format, ap);
+    va_end(ap);
+
+    if (length < 0)
+    {
+        return;
+    }
+
+    _report_write(buffer, (size_t) length < sizeof(buffer) ? (size_t) length : sizeof(buffer) - 1);
+}
+
+static void _report_frame(report_type_t type, const uint8_t *payload, uint8_t length)
+{
+    uint8_t frame[REPORT_FRAME_PAYLOAD_MAX + REPORT_FRAME_OVERHEAD];
+
+    if (length > REPORT_FRAME_PAYLOAD_MAX)
+    {
+        return;
+    }
+
+    if (_report.link_down && (_report.store_capacity > 0) && (type != REPORT_TYPE_STORED))
+    {
+        _report_store_put(type, payload, length);
+
+        return;
+    }
+
+    frame[0] = REPORT_FRAME_SYNC;
+    frame[1] = type;
+    frame[2] = length;
+
+    memcpy(&frame[3], payload, length);
+
+    // CRC covers type, length and payload
+    frame[3 + length] = twr_crc8(REPORT_FRAME_CRC_POLYNOMIAL, &frame[1], length + 2, REPORT_FRAME_CRC_INITIALIZATION);
+
+    _report_write(frame, length + REPORT_FRAME_OVERHEAD);
+}
+
+static void _report_frame_u16(report_type_t type, uint16_t value)
+{
+    uint8_t payload[2] = { value, value >> 8 };
+
+    _report_frame(type, payload, sizeof(payload));
+}
+
+static uint8_t _report_store_crc(const uint8_t *record)
+{
+    // CRC byte itself is skipped, initialization keeps zeroed record invalid
+    uint8_t crc = twr_crc8(REPORT_FRAME_CRC_POLYNOMIAL, record, 3, REPORT_STORE_CRC_INITIALIZATION);
+
+    return twr_crc8(REPORT_FRAME_CRC_POLYNOMIAL, &record[4], REPORT_STORE_RECORD_SIZE - 4, crc);
+}
+
+static bool _report_store_read(int position, uint8_t *record)
+{
+    if (!twr_eeprom_read(_report.store_address + position * REPORT_STORE_RECORD_SIZE, record, REPORT_STORE_RECORD_SIZE))
+    {
+        return false;
+    }
+
+    return (record[2] <= REPORT_STORE_RECORD_PAYLOAD_MAX) && (record[3] == _report_store_crc(record));
+}
+
+static void _report_store_put(report_type_t type, const uint8_t *payload, uint8_t length)
+{
+    uint8_t record[REPORT_STORE_RECORD_SIZE] = { 0 };
+
+    // Payload does not fit into record (e.g. vibration)
+    if (length > REPORT_STORE_RECORD_PAYLOAD_MAX)
+    {
+        _report.store_rejected_count++;
+
+        return;
+    }
+
+    // Full log drops the oldest record, which is overwritten by the new one
+    if (_report.store_count == _report.store_capacity)
+    {
+        _report.store_tail = (_report.store_tail + 1) % _report.store_capacity;
+
+        _report.store_count--;
+
+        if (_report.store_boot_count > 0)
+        {
+            _report.store_boot_count--;
+        }
+    }
+
+    twr_tick_t tick = twr_tick_get();
+
+    record[0] = _report.store_sequence;
+    record[1] = type;
+    record[2] = length;
+
+    memcpy(&record[4], payload, length);
+
+    record[8] = tick;
+    record[9] = tick >> 8;
+    record[10] = tick >> 16;
+    record[11] = tick >> 24;
+
+    record[3] = _report_store_crc(record);
+
+    int position = (_report.store_tail + _report.store_count) % _report.store_capacity;
+
+    if (twr_eeprom_write(_report.store_address + position * REPORT_STORE_RECORD_SIZE, record, sizeof(record)))
+    {
+        _report.store_sequence++;
+
+        _report.store_count++;
+    }
+}
+
+static void _report_drain_task(void *param)
+{
+    (void) param;
+
+    uint8_t payload[REPORT_FRAME_PAYLOAD_MAX];
+    uint8_t record[REPORT_STORE_RECORD_SIZE];
+    size_t length = 0;
+    int n;
+
+    if (_report.link_down || (_report.store_count == 0))
+    {
+        return;
+    }
+
+    twr_tick_t now = twr_tick_get();
+
+    // Frame is filled by the oldest records, corrupted ones are dropped
+    for (n = 0; n < _report.store_count; n++)
+    {
+        if (!_report_store_read((_report.store_tail + n) % _report.store_capacity, record))
+        {
+            continue;
+        }
+
+        if (length + 6 + record[2] > sizeof(payload))
+        {
+            break;
+        }
+
+        uint32_t tick = record[8] | (uint32_t) record[9] << 8 | (uint32_t) record[10] << 16 | (uint32_t) record[11] << 24;
+        uint32_t age = n < _report.store_boot_count ? 0xffffffff : (uint32_t) (now - tick);
+
+        payload[length++] = age;
+        payload[length++] = age >> 8;
+        payload[length++] = age >> 16;
+        payload[length++] = age >> 24;
+        payload[length++] = record[1];
+        payload[length++] = record[2];
+
+        memcpy(&payload[length], &record[4], record[2]);
+
+        length += record[2];
+    }
+
+    if (length > 0)
+    {
+        _report_frame(REPORT_TYPE_STORED, payload, length);
+    }
+
+    // Sent records are invalidated by inverted CRC
+    for (int i = 0; i < n; i++)
+    {
+        uint32_t address = _report.store_address + ((_report.store_tail + i) % _report.store_capacity) * REPORT_STORE_RECORD_SIZE;
+        uint8_t crc;
+
+        twr_eeprom_read(address + 3, &crc, 1);
+
+        crc = ~crc;
+
+        twr_eeprom_write(address + 3, &crc, 1);
+    }
+
+    _report.store_tail = (_report.store_tail + n) % _report.store_capacity;
+
+    _report.store_count -= n;
+
+    _report.store_boot_count = _report.store_boot_count > n ? _report.store_boot_count - n : 0;
+
+    if (_report.store_count > 0)
+    {
+        twr_scheduler_plan_current_relative(REPORT_STORE_DRAIN_INTERVAL);
+    }
+}
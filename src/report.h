@@ -0,0 +1,159 @@
+#ifndef _REPORT_H
+#define _REPORT_H
+
+#include <twr.h>
+
+//! @addtogroup report report
+//! @brief Report stream sent by the application over transport (UART, USB CDC or both)
+//!
+//! The stream is either human readable text (one line per report, the original format) or compact binary frames.
+//!
+//! Binary frame layout (all multi-byte fields are little-endian):
+//!
+//! | Offset  | Size   | Field                                                        |
+//! |---------|--------|--------------------------------------------------------------|
+//! | 0       | 1      | Sync byte 0xa5 (never present in the text stream)            |
+//! | 1       | 1      | Report type (see @ref report_type_t)                         |
+//! | 2       | 1      | Payload length N                                             |
+//! | 3       | N      | Payload                                                      |
+//! | 3 + N   | 1      | CRC-8 (polynomial 0x07, initial value 0x00) over bytes 1..2+N |
+//!
+//! Payload per report type:
+//!
+//! | Type | Report               | Payload                                    |
+//! |------|----------------------|--------------------------------------------|
+//! | 0x01 | Button click         | uint16 click count                         |
+//! | 0x02 | Button hold          | uint16 hold count                          |
+//! | 0x03 | Button hold duration | uint32 duration in milliseconds            |
+//! | 0x04 | Battery              | uint16 voltage in millivolts               |
+//! | 0x05 | Temperature          | int16 temperature in hundredths of a °C    |
+//! | 0x06 | Orientation          | uint8 dice face (0 = unknown, 1 to 6)      |
+//! | 0x07 | Stored reports       | sequence of stored records (see below)     |
+//! | 0x08 | Vibration            | uint16 RMS X, Y, Z, uint16 peak-to-peak X, Y, Z, uint8 dominant axis, uint16 zero crossings, uint16 dominant frequency in tenths of Hz, uint16 its amplitude (raw accelerometer units) |
+//!
+//! Binary reports raised while link is down (see @ref report_set_link) are kept in ring log in EEPROM, the oldest ones
+//! are overwritten when it is full. Reports with payload longer than 4 bytes (vibration) do not fit into record and
+//! are rejected and counted instead (see @ref report_store_get_rejected_count). When link comes up, they are sent oldest first in frames of type 0x07, each record
+//! in them is uint32 age in milliseconds (0xffffffff for report raised before reset), type, length and payload of the
+//! original frame.
+//!
+//! Host decoder: scan for 0xa5, read type and length, wait for N + 1 more bytes, verify the CRC and drop the sync byte
+//! and resynchronize on the next 0xa5 if it does not match. Unknown types with a valid CRC should be skipped by length.
+//! @{
+
+//! @brief Report stream format
+
+typedef enum
+{
+    //! @brief Text lines
+    REPORT_FORMAT_TEXT = 0,
+
+    //! @brief Binary frames
+    REPORT_FORMAT_BINARY = 1
+
+} report_format_t;
+
+//! @brief Report type (binary frame type byte)
+
+typedef enum
+{
+    //! @brief Button click count
+    REPORT_TYPE_BUTTON_CLICK = 0x01,
+
+    //! @brief Button hold count
+    REPORT_TYPE_BUTTON_HOLD = 0x02,
+
+    //! @brief Button hold duration
+    REPORT_TYPE_BUTTON_HOLD_DURATION = 0x03,
+
+    //! @brief Battery voltage
+    REPORT_TYPE_BATTERY = 0x04,
+
+    //! @brief Temperature
+    REPORT_TYPE_TEMPERATURE = 0x05,
+
+    //! @brief Orientation
+    REPORT_TYPE_ORIENTATION = 0x06,
+
+    //! @brief Reports stored while link was down
+    REPORT_TYPE_STORED = 0x07,
+
+    //! @brief Vibration features
+    REPORT_TYPE_VIBRATION = 0x08
+
+} report_type_t;
+
+//! @brief Initialize report stream
+//! @param[in] transport Transport the stream is written to (has to be initialized by caller)
+//! @param[in] format Report stream format
+
+void report_init(twr_transport_t *transport, report_format_t format);
+
+//! @brief Set coalescing window
+//!
+//! Reports are gathered for up to window milliseconds after the first one and then sent in one transport write.
+//! @param[in] window Coalescing window in milliseconds (0 sends every report immediately, default)
+
+void report_set_window(twr_tick_t window);
+
+//! @brief Keep binary reports in EEPROM while link is down
+//!
+//! Every report takes record of 12 bytes protected by CRC-8, content of region survives reset. Link is considered down
+//! from now on, so reports raised before reset are kept until host is reported by @ref report_set_link.
+//! @param[in] address EEPROM address of region (multiple of 4)
+//! @param[in] size Size of region in bytes (up to 128 records are used)
+
+void report_store_init(uint32_t address, size_t size);
+
+//! @brief Get number of reports raised while link was down that did not fit into store record
+//! @return Number of rejected reports
+
+uint32_t report_store_get_rejected_count(void);
+
+//! @brief Set state of link to host, stored reports are sent when link comes up
+//! @param[in] up Host receives reports (default without store)
+
+void report_set_link(bool up);
+
+//! @brief Send gathered reports immediately
+
+void report_flush(void);
+
+//! @brief Report button click
+//! @param[in] count Click count
+
+void report_button_click(uint16_t count);
+
+//! @brief Report button hold
+//! @param[in] count Hold count
+
+void report_button_hold(uint16_t count);
+
+//! @brief Report button hold duration
+//! @param[in] duration Hold duration in milliseconds
+
+void report_button_hold_duration(uint32_t duration);
+
+//! @brief Report battery voltage
+//! @param[in] voltage Battery voltage in volts
+
+void report_battery(float voltage);
+
+//! @brief Report temperature
+//! @param[in] temperature Temperature in degrees of Celsius
+
+void report_temperature(float temperature);
+
+//! @brief Report orientation
+//! @param[in] face Dice face
+
+void report_orientation(twr_dice_face_t face);
+
+//! @brief Report vibration features
+//! @param[in] features Features of block of accelerometer samples
+
+void report_vibration(const twr_vibration_features_t *features);
+
+//! @}
+
+#endif // _REPORT_H